@@ -53,6 +53,9 @@ _CSHARP_FFI_ALIASES = {
     "GoudTextureHandle": "u64",
     "GoudFontHandle": "u64",
     "GoudAtlasHandle": "u64",
+    "GoudStaticLayerHandle": "u64",
+    "GoudTilemapHandle": "u64",
+    "GoudParticleEmitterHandle": "u64",
     "GoudEntityId": "u64",
     "GoudKeyCode": "i32",
     "GoudMouseButton": "i32",
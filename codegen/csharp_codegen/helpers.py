@@ -116,6 +116,8 @@ def _cs_ffi_param_type(raw: str) -> str:
         "*mut FfiTransform2DBuilder": "IntPtr",
         "*mut FfiSpriteBuilder": "IntPtr",
         "*mut FfiAnimationClipBuilder": "IntPtr",
+        "*mut FfiInputSnapshot": "IntPtr",
+        "*const FfiParticleEmitterConfig": "IntPtr",
         "*const FfiSpriteAnimator": "ref FfiSpriteAnimator",
         "*mut FfiText": "ref FfiText",
         "*const FfiText": "ref FfiText",
@@ -35,7 +35,8 @@ def _normalize(raw: str) -> str:
 # ── Type classification ──
 # C scalar typedefs (backed by an integer) -- zero value is 0
 _C_SCALAR_TYPEDEFS = {
-    "GoudEntityId", "GoudTextureHandle", "GoudFontHandle",  # uint64_t
+    "GoudEntityId", "GoudTextureHandle", "GoudFontHandle", "GoudStaticLayerHandle",
+    "GoudTilemapHandle", "GoudParticleEmitterHandle",  # uint64_t
     "GoudErrorCode", "GoudKeyCode", "GoudMouseButton",  # int32_t
 }
 
@@ -331,6 +331,8 @@ CTYPES_MAP = {
     "*mut FfiTransform2DBuilder": "ctypes.c_void_p",
     "*mut FfiSpriteBuilder": "ctypes.c_void_p",
     "*mut FfiAnimationClipBuilder": "ctypes.c_void_p",
+    "*mut FfiInputSnapshot": "ctypes.c_void_p",
+    "*const FfiParticleEmitterConfig": "ctypes.c_void_p",
     "*mut c_void": "ctypes.c_void_p",
     "Option<CollisionCallback>": "ctypes.c_void_p",
     "FfiTransform2D": "FfiTransform2D",
@@ -346,6 +348,17 @@ CTYPES_MAP = {
     "FfiFramePhaseTimings": "FfiFramePhaseTimings",
     "*mut FfiPoolStats": "ctypes.POINTER(FfiPoolStats)",
     "*mut FfiArenaStats": "ctypes.POINTER(FfiArenaStats)",
+    "*mut FfiTextLayoutCacheStats": "ctypes.POINTER(FfiTextLayoutCacheStats)",
+    "*mut FfiAudioClipCacheStats": "ctypes.POINTER(FfiAudioClipCacheStats)",
+    "*mut FfiAudioStreamStats": "ctypes.POINTER(FfiAudioStreamStats)",
+    "*mut FfiNetworkMessage": "ctypes.POINTER(FfiNetworkMessage)",
+    "*const FfiUiCommand": "ctypes.POINTER(FfiUiCommand)",
+    "*const FfiSpatialSourceUpdate": "ctypes.POINTER(FfiSpatialSourceUpdate)",
+    "*mut FfiCollisionEvent": "ctypes.POINTER(FfiCollisionEvent)",
+    "*mut FfiAnimationEvent": "ctypes.POINTER(FfiAnimationEvent)",
+    "*const FfiRay": "ctypes.POINTER(FfiRay)",
+    "*mut FfiRaycastHit": "ctypes.POINTER(FfiRaycastHit)",
+    "*const FfiRect": "ctypes.POINTER(FfiRect)",
     "*const u32": "ctypes.POINTER(ctypes.c_uint32)",
     "FfiMat3x3": "FfiMat3x3",
     "NetworkSimulationConfig": "NetworkSimulationConfig",
@@ -98,6 +98,9 @@ _TYPE_ALIASES: dict[str, str] = {
     "EngineConfigHandle": "*mut c_void",
     "GoudFontHandle": "u64",
     "GoudAtlasHandle": "u64",
+    "GoudStaticLayerHandle": "u64",
+    "GoudTilemapHandle": "u64",
+    "GoudParticleEmitterHandle": "u64",
     "FfiTransitionType": "u8",
     "FfiNetworkSimulationConfig": "NetworkSimulationConfig",
     "ref FfiNetworkStats": "*mut FfiNetworkStats",
@@ -95,6 +95,29 @@ int main() {
         }
     }
 
+    // -- Test: Headless engine runs real frames without window or GPU ----------
+    {
+        auto config = goud::EngineConfig::create();
+        config.setTitle("Headless Frame Loop");
+        config.setSize(320, 240);
+        bool selected = config.setHeadless() == SUCCESS;
+
+        int engineStatus = 0;
+        auto engine = goud::Engine::create(std::move(config), &engineStatus);
+        int frames = 0;
+        if (engine.valid()) {
+            engine.run([](float) {},
+                       [&](float) {
+                           engine.context().beginFrame();
+                           engine.context().endFrame();
+                           if (++frames == 3) {
+                               engine.stop();
+                           }
+                       });
+        }
+        record("Headless Engine::create runs the frame loop", selected && engine.valid() && frames == 3);
+    }
+
     // -- Summary --------------------------------------------------------------
     int passCount = 0;
     for (const auto& r : results) {
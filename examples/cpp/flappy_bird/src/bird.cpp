@@ -47,11 +47,11 @@ Bird::Bounds Bird::getBounds() const {
     return { x_, y_, BIRD_WIDTH, BIRD_HEIGHT };
 }
 
-void Bird::draw(const goud::Context& ctx, goud_texture tex) const {
+void Bird::draw(const goud::Context& ctx, const goud::TextureRegion& frame) const {
     float radians = rotation_ * (3.14159265358979323846f / 180.0f);
     goud_color white{ 1.0f, 1.0f, 1.0f, 1.0f };
     ctx.drawSprite(
-        tex,
+        frame,
         x_ + BIRD_WIDTH / 2.0f,
         y_ + BIRD_HEIGHT / 2.0f,
         BIRD_WIDTH,
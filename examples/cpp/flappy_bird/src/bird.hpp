@@ -25,7 +25,7 @@ public:
     Bounds getBounds() const;
 
     /// Draw the bird sprite at its current position and rotation.
-    void draw(const goud::Context& ctx, goud_texture tex) const;
+    void draw(const goud::Context& ctx, const goud::TextureRegion& frame) const;
 
     /// Reset to starting position, velocity, and animation.
     void reset();
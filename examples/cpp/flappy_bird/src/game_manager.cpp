@@ -9,24 +9,49 @@ namespace flappy {
 // (run the binary from the build/ subdirectory created by cmake)
 static const std::string ASSET_BASE = "../../../csharp/flappy_goud/assets/sprites/";
 
-static goud_texture loadTex(goud::Context& ctx, const std::string& file) {
-    goud_texture tex = 0;
+static goud::AssetFuture<goud_texture> loadTex(goud::Context& ctx, const std::string& file) {
     std::string path = ASSET_BASE + file;
-    ctx.loadTexture(path.c_str(), tex);
-    return tex;
+    return ctx.loadTextureAsync(path.c_str());
+}
+
+static std::uint32_t addToAtlas(goud::AtlasBuilder& atlas, const std::string& file) {
+    std::string path = ASSET_BASE + file;
+    std::uint32_t id = 0;
+    atlas.add(path.c_str(), &id);
+    return id;
 }
 
 void GameManager::init(goud::Context& ctx) {
-    backgroundTex_ = loadTex(ctx, "background-day.png");
-    baseTex_       = loadTex(ctx, "base.png");
-    pipeTex_       = loadTex(ctx, "pipe-green.png");
+    // Read and decode the large sprites on the loader's worker threads, then
+    // upload them all here before the first frame.
+    auto background = loadTex(ctx, "background-day.png");
+    auto base       = loadTex(ctx, "base.png");
+    auto pipe       = loadTex(ctx, "pipe-green.png");
+
+    // The small, frequently drawn sprites are packed into one atlas page
+    // so the bird and score draw without switching textures.
+    spriteAtlas_ = goud::AtlasBuilder(ctx, 512);
+    std::uint32_t birdIds[3] = {
+        addToAtlas(spriteAtlas_, "bluebird-downflap.png"),
+        addToAtlas(spriteAtlas_, "bluebird-midflap.png"),
+        addToAtlas(spriteAtlas_, "bluebird-upflap.png"),
+    };
+    std::uint32_t digitIds[10];
+    for (int i = 0; i < 10; ++i) {
+        digitIds[i] = addToAtlas(spriteAtlas_, std::to_string(i) + ".png");
+    }
+    spriteAtlas_.build();
 
-    birdFrames_[0] = loadTex(ctx, "bluebird-downflap.png");
-    birdFrames_[1] = loadTex(ctx, "bluebird-midflap.png");
-    birdFrames_[2] = loadTex(ctx, "bluebird-upflap.png");
+    ctx.finishAssetLoads();
 
+    backgroundTex_ = background.get();
+    baseTex_       = base.get();
+    pipeTex_       = pipe.get();
+    for (int i = 0; i < 3; ++i) {
+        birdFrames_[i] = spriteAtlas_.region(birdIds[i]);
+    }
     for (int i = 0; i < 10; ++i) {
-        digitTex_[i] = loadTex(ctx, std::to_string(i) + ".png");
+        digitTex_[i] = spriteAtlas_.region(digitIds[i]);
     }
 
     reset();
@@ -40,20 +65,28 @@ void GameManager::reset() {
     state_ = GameState::WAITING;
 }
 
-bool GameManager::handleInput(goud::Context& ctx) {
+bool GameManager::pollInput(goud::Context& ctx) {
     // Escape quits.
     if (ctx.keyDown(static_cast<goud_key>(KEY_ESCAPE))) {
         return false;
     }
 
-    // R restarts.
+    // R restarts. A frame can run no fixed step, so the press is kept until
+    // the next step consumes it.
     if (ctx.keyJustPressed(static_cast<goud_key>(KEY_R))) {
-        reset();
+        restartPressed_ = true;
     }
 
     return true;
 }
 
+void GameManager::handleInput() {
+    if (restartPressed_) {
+        restartPressed_ = false;
+        reset();
+    }
+}
+
 void GameManager::update(goud::Context& ctx, float dt) {
     // Determine jump input.
     bool jumpInput = ctx.keyDown(static_cast<goud_key>(KEY_SPACE))
@@ -126,8 +159,7 @@ void GameManager::draw(goud::Context& ctx) {
     }
 
     // Layer 3: Bird
-    goud_texture birdTex = birdFrames_[bird_.animFrame()];
-    bird_.draw(ctx, birdTex);
+    bird_.draw(ctx, birdFrames_[bird_.animFrame()]);
 
     // Layer 4: Base / ground (in front of everything)
     ctx.drawSprite(
@@ -1,6 +1,7 @@
 #ifndef FLAPPY_GAME_MANAGER_HPP
 #define FLAPPY_GAME_MANAGER_HPP
 
+#include <goud/atlas_builder.hpp>
 #include <goud/goud.hpp>
 #include <vector>
 
@@ -26,8 +27,12 @@ public:
     /// Load all textures and prepare the initial game state.
     void init(goud::Context& ctx);
 
-    /// Process one frame of input. Returns false when the game should quit.
-    bool handleInput(goud::Context& ctx);
+    /// Latch this frame's key presses. Call once per frame, after events are
+    /// polled. Returns false when the game should quit.
+    bool pollInput(goud::Context& ctx);
+
+    /// Apply the presses latched since the last fixed step.
+    void handleInput();
 
     /// Advance game logic by dt seconds.
     void update(goud::Context& ctx, float dt);
@@ -44,13 +49,17 @@ private:
     ScoreCounter  score_;
     GameState     state_ = GameState::WAITING;
     float         pipeSpawnTimer_ = 0.0f;
+    bool          restartPressed_ = false;
 
     // Textures
     goud_texture backgroundTex_ = 0;
     goud_texture baseTex_       = 0;
     goud_texture pipeTex_       = 0;
-    goud_texture birdFrames_[3] = {};
-    goud_texture digitTex_[10]  = {};
+
+    // Bird frames and score digits share one atlas page.
+    goud::AtlasBuilder  spriteAtlas_;
+    goud::TextureRegion birdFrames_[3] = {};
+    goud::TextureRegion digitTex_[10]  = {};
 };
 
 }  // namespace flappy
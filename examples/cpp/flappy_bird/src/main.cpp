@@ -36,25 +36,30 @@ int main() {
     manager.init(ctx);
 
     // -- Game loop ------------------------------------------------------------
+    // Game logic runs in fixed 1/TARGET_FPS steps, so the per-frame constants
+    // scaled by dt * TARGET_FPS advance by exactly one frame's worth per step.
     goud_color skyBlue{ 0.4f, 0.7f, 0.9f, 1.0f };
 
-    while (!engine.shouldClose()) {
-        float dt = engine.pollEvents();
-        if (dt <= 0.0f) {
-            dt = 1.0f / TARGET_FPS;
-        }
-
-        if (!manager.handleInput(ctx)) {
-            break;  // Escape pressed
-        }
-        manager.update(ctx, dt);
-
-        ctx.beginFrame();
-        ctx.clear(skyBlue);
-        manager.draw(ctx);
-        ctx.endFrame();
-        engine.swapBuffers();
-    }
+    goud::RunOptions options;
+    options.fixed_dt = 1.0f / TARGET_FPS;
+    options.target_fps = static_cast<std::uint32_t>(TARGET_FPS);
+
+    engine.run(
+        [&](float dt) {
+            manager.handleInput();
+            manager.update(ctx, dt);
+        },
+        [&](float) {
+            // Input is latched once per frame; steps run zero or more times.
+            if (!manager.pollInput(ctx)) {
+                engine.stop();  // Escape pressed
+            }
+            ctx.beginFrame();
+            ctx.clear(skyBlue);
+            manager.draw(ctx);
+            ctx.endFrame();
+        },
+        options);
 
     return 0;
 }
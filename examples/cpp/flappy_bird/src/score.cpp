@@ -4,7 +4,7 @@
 
 namespace flappy {
 
-void ScoreCounter::draw(const goud::Context& ctx, goud_texture digitTextures[10]) const {
+void ScoreCounter::draw(const goud::Context& ctx, const goud::TextureRegion digitRegions[10]) const {
     std::string scoreStr = std::to_string(score_);
     float xOffset = SCREEN_WIDTH / 2.0f - 30.0f;
     float yOffset = 50.0f;
@@ -15,7 +15,7 @@ void ScoreCounter::draw(const goud::Context& ctx, goud_texture digitTextures[10]
         float x = xOffset + static_cast<float>(i) * SCORE_DIGIT_SPACING + SCORE_DIGIT_WIDTH / 2.0f;
         float y = yOffset + SCORE_DIGIT_HEIGHT / 2.0f;
         ctx.drawSprite(
-            digitTextures[digit],
+            digitRegions[digit],
             x, y,
             SCORE_DIGIT_WIDTH, SCORE_DIGIT_HEIGHT,
             0.0f,
@@ -16,7 +16,7 @@ public:
     int  value() const { return score_; }
 
     /// Draw the score as centered digit sprites near the top of the screen.
-    void draw(const goud::Context& ctx, goud_texture digitTextures[10]) const;
+    void draw(const goud::Context& ctx, const goud::TextureRegion digitRegions[10]) const;
 
 private:
     int score_ = 0;
@@ -0,0 +1,77 @@
+//! Scene Load Benchmarks
+//!
+//! Compares loading the same scene from JSON and from the packed binary
+//! scene format.
+//!
+//! Run with: `cargo bench --bench scene_load_benchmarks`
+
+use criterion::{black_box, criterion_group, criterion_main, BenchmarkId, Criterion};
+use goud_engine::context_registry::scene::{
+    deserialize_packed_scene, deserialize_scene, scene_from_json, scene_to_json, scene_to_packed,
+    serialize_scene,
+};
+use goud_engine::core::math::Vec2;
+use goud_engine::ecs::components::{Name, Transform2D};
+use goud_engine::ecs::World;
+
+// =============================================================================
+// Test data helpers
+// =============================================================================
+
+fn scene_world(count: usize) -> World {
+    let mut world = World::new();
+    world.register_builtin_serializables();
+    for i in 0..count {
+        let entity = world.spawn_empty();
+        world.insert(entity, Name::new(format!("entity_{i}")));
+        world.insert(
+            entity,
+            Transform2D::new(Vec2::new(i as f32, -(i as f32)), 0.25, Vec2::one()),
+        );
+    }
+    world
+}
+
+fn empty_world() -> World {
+    let mut world = World::new();
+    world.register_builtin_serializables();
+    world
+}
+
+// =============================================================================
+// Scene load benchmarks
+// =============================================================================
+
+fn bench_scene_load(c: &mut Criterion) {
+    let mut group = c.benchmark_group("scene_load");
+
+    for count in [1_000usize, 10_000] {
+        let world = scene_world(count);
+        let json = scene_to_json(&serialize_scene(&world, "level").unwrap()).unwrap();
+        let packed = scene_to_packed(&world, "level").unwrap();
+
+        group.bench_with_input(BenchmarkId::new("json", count), &json, |b, json| {
+            b.iter(|| {
+                let mut target = empty_world();
+                let data = scene_from_json(black_box(json)).unwrap();
+                deserialize_scene(&data, &mut target).unwrap()
+            });
+        });
+        group.bench_with_input(BenchmarkId::new("packed", count), &packed, |b, packed| {
+            b.iter(|| {
+                let mut target = empty_world();
+                deserialize_packed_scene(black_box(packed), &mut target).unwrap()
+            });
+        });
+    }
+
+    group.finish();
+}
+
+// =============================================================================
+// Criterion configuration
+// =============================================================================
+
+criterion_group!(scene_benches, bench_scene_load);
+
+criterion_main!(scene_benches);
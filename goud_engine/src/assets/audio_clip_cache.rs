@@ -0,0 +1,252 @@
+//! Cache of decoded audio clips.
+//!
+//! Playing from encoded bytes decodes the file again on every trigger, which
+//! dominates the cost of short sound effects fired many times a second.  An
+//! [`AudioClipCache`] decodes a clip once into interleaved `f32` PCM that every
+//! playback reads from, and keeps the (much smaller) encoded bytes so a clip
+//! whose PCM was evicted is decoded again on its next play.  Decoded PCM is
+//! evicted least-recently-played first once it exceeds the byte budget.
+//!
+//! The cache does not decode by itself: callers pass the decoder, which keeps
+//! this module free of the audio backend and usable in every build.
+
+use std::collections::HashMap;
+use std::sync::Arc;
+
+use crate::core::error::{GoudError, GoudResult};
+
+/// Default budget for decoded PCM: about 95 seconds of 44.1 kHz stereo.
+pub const DEFAULT_AUDIO_CLIP_BUDGET: u64 = 32 * 1024 * 1024;
+
+/// Interleaved PCM of one decoded clip.
+#[derive(Clone)]
+pub struct DecodedClip {
+    /// Interleaved samples in `[-1, 1]`.
+    pub samples: Arc<[f32]>,
+    /// Number of interleaved channels.
+    pub channels: u16,
+    /// Frames per second.
+    pub sample_rate: u32,
+}
+
+impl DecodedClip {
+    /// Bytes held by the samples.
+    pub fn byte_len(&self) -> u64 {
+        (self.samples.len() * std::mem::size_of::<f32>()) as u64
+    }
+}
+
+impl std::fmt::Debug for DecodedClip {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        f.debug_struct("DecodedClip")
+            .field("samples", &self.samples.len())
+            .field("channels", &self.channels)
+            .field("sample_rate", &self.sample_rate)
+            .finish()
+    }
+}
+
+/// Occupancy and hit counters of an [`AudioClipCache`].
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct AudioClipCacheStats {
+    /// Loaded clip handles.
+    pub clips: u64,
+    /// Clips whose decoded PCM is in memory.
+    pub resident_clips: u64,
+    /// Bytes of decoded PCM in memory.
+    pub pcm_bytes: u64,
+    /// Bytes of encoded source data kept for re-decoding.
+    pub encoded_bytes: u64,
+    /// Configured PCM byte budget.
+    pub budget_bytes: u64,
+    /// Plays served from resident PCM.
+    pub hits: u64,
+    /// Plays that had to decode an evicted clip again.
+    pub misses: u64,
+    /// Clips whose PCM was evicted to stay within the budget.
+    pub evictions: u64,
+}
+
+struct ClipEntry {
+    encoded: Arc<[u8]>,
+    decoded: Option<DecodedClip>,
+    last_played: u64,
+}
+
+/// Decoded clips keyed by handle, with a PCM byte budget.
+///
+/// Handles start at 1 and are never reused, so 0 can mean "no clip".
+pub struct AudioClipCache {
+    clips: HashMap<u64, ClipEntry>,
+    next_id: u64,
+    clock: u64,
+    budget_bytes: u64,
+    pcm_bytes: u64,
+    encoded_bytes: u64,
+    hits: u64,
+    misses: u64,
+    evictions: u64,
+}
+
+impl Default for AudioClipCache {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl AudioClipCache {
+    /// Creates an empty cache with [`DEFAULT_AUDIO_CLIP_BUDGET`].
+    pub fn new() -> Self {
+        Self::with_budget(DEFAULT_AUDIO_CLIP_BUDGET)
+    }
+
+    /// Creates an empty cache with a PCM budget of `budget_bytes`.
+    pub fn with_budget(budget_bytes: u64) -> Self {
+        Self {
+            clips: HashMap::new(),
+            next_id: 1,
+            clock: 0,
+            budget_bytes,
+            pcm_bytes: 0,
+            encoded_bytes: 0,
+            hits: 0,
+            misses: 0,
+            evictions: 0,
+        }
+    }
+
+    /// Decodes `encoded` with `decode` and stores it as a new clip.
+    ///
+    /// The new clip counts as the most recently played one, so it stays
+    /// resident even if it alone exceeds the budget.
+    ///
+    /// # Errors
+    ///
+    /// Returns `ResourceLoadFailed` if `encoded` is empty, or whatever
+    /// `decode` returns; nothing is stored then.
+    pub fn insert(
+        &mut self,
+        encoded: Vec<u8>,
+        decode: impl FnOnce(&[u8]) -> GoudResult<DecodedClip>,
+    ) -> GoudResult<u64> {
+        if encoded.is_empty() {
+            return Err(GoudError::ResourceLoadFailed(
+                "Cannot load empty audio clip".to_string(),
+            ));
+        }
+        let decoded = decode(&encoded[..])?;
+        let id = self.next_id;
+        self.next_id += 1;
+        self.clock += 1;
+        self.pcm_bytes += decoded.byte_len();
+        self.encoded_bytes += encoded.len() as u64;
+        self.clips.insert(
+            id,
+            ClipEntry {
+                encoded: encoded.into(),
+                decoded: Some(decoded),
+                last_played: self.clock,
+            },
+        );
+        self.evict_to_budget(Some(id));
+        Ok(id)
+    }
+
+    /// Returns the PCM of clip `id` for playback and marks it most recently
+    /// played, decoding it again with `decode` if it was evicted.
+    ///
+    /// # Errors
+    ///
+    /// Returns `InvalidHandle` for an unknown `id`, or whatever `decode`
+    /// returns.
+    pub fn acquire(
+        &mut self,
+        id: u64,
+        decode: impl FnOnce(&[u8]) -> GoudResult<DecodedClip>,
+    ) -> GoudResult<DecodedClip> {
+        self.clock += 1;
+        let clock = self.clock;
+        let entry = self.clips.get_mut(&id).ok_or(GoudError::InvalidHandle)?;
+        entry.last_played = clock;
+        if let Some(decoded) = &entry.decoded {
+            self.hits += 1;
+            return Ok(decoded.clone());
+        }
+
+        let decoded = decode(&entry.encoded[..])?;
+        self.misses += 1;
+        self.pcm_bytes += decoded.byte_len();
+        entry.decoded = Some(decoded.clone());
+        self.evict_to_budget(Some(id));
+        Ok(decoded)
+    }
+
+    /// Drops clip `id`.  Returns `false` if it was not loaded.
+    pub fn remove(&mut self, id: u64) -> bool {
+        let Some(entry) = self.clips.remove(&id) else {
+            return false;
+        };
+        self.encoded_bytes -= entry.encoded.len() as u64;
+        if let Some(decoded) = entry.decoded {
+            self.pcm_bytes -= decoded.byte_len();
+        }
+        true
+    }
+
+    /// Returns whether clip `id` is loaded.
+    pub fn contains(&self, id: u64) -> bool {
+        self.clips.contains_key(&id)
+    }
+
+    /// Sets the PCM budget and evicts until the cache fits.
+    ///
+    /// A budget of 0 keeps no PCM between plays: every play decodes.
+    pub fn set_budget(&mut self, budget_bytes: u64) {
+        self.budget_bytes = budget_bytes;
+        self.evict_to_budget(None);
+    }
+
+    /// Bytes of PCM and encoded data held by the cache.
+    pub fn memory_bytes(&self) -> u64 {
+        self.pcm_bytes + self.encoded_bytes
+    }
+
+    /// Returns the cache's occupancy and hit counters.
+    pub fn stats(&self) -> AudioClipCacheStats {
+        AudioClipCacheStats {
+            clips: self.clips.len() as u64,
+            resident_clips: self.clips.values().filter(|e| e.decoded.is_some()).count() as u64,
+            pcm_bytes: self.pcm_bytes,
+            encoded_bytes: self.encoded_bytes,
+            budget_bytes: self.budget_bytes,
+            hits: self.hits,
+            misses: self.misses,
+            evictions: self.evictions,
+        }
+    }
+
+    /// Evicts least-recently-played PCM, never `keep`, until within budget.
+    fn evict_to_budget(&mut self, keep: Option<u64>) {
+        while self.pcm_bytes > self.budget_bytes {
+            let victim = self
+                .clips
+                .iter()
+                .filter(|(id, entry)| entry.decoded.is_some() && Some(**id) != keep)
+                .min_by_key(|(_, entry)| entry.last_played)
+                .map(|(id, _)| *id);
+            let Some(victim) = victim else {
+                break;
+            };
+            if let Some(entry) = self.clips.get_mut(&victim) {
+                if let Some(decoded) = entry.decoded.take() {
+                    self.pcm_bytes -= decoded.byte_len();
+                    self.evictions += 1;
+                }
+            }
+        }
+    }
+}
+
+#[cfg(test)]
+#[path = "audio_clip_cache_tests.rs"]
+mod tests;
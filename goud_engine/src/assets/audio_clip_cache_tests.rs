@@ -0,0 +1,121 @@
+use std::cell::Cell;
+
+use super::*;
+
+/// Fake decoder: one mono sample per encoded byte, so PCM is 4x the input.
+fn decode(bytes: &[u8]) -> GoudResult<DecodedClip> {
+    Ok(DecodedClip {
+        samples: bytes.iter().map(|b| f32::from(*b) / 255.0).collect(),
+        channels: 1,
+        sample_rate: 8_000,
+    })
+}
+
+fn failing_decode(_: &[u8]) -> GoudResult<DecodedClip> {
+    Err(GoudError::ResourceLoadFailed("bad data".to_string()))
+}
+
+#[test]
+fn test_insert_decodes_once_and_plays_hit() {
+    let mut cache = AudioClipCache::new();
+    let id = cache.insert(vec![1, 2, 3, 4], decode).unwrap();
+    assert_ne!(id, 0);
+
+    let decodes = Cell::new(0);
+    let counting = |bytes: &[u8]| {
+        decodes.set(decodes.get() + 1);
+        decode(bytes)
+    };
+    for _ in 0..10 {
+        let clip = cache.acquire(id, counting).unwrap();
+        assert_eq!(clip.samples.len(), 4);
+    }
+    assert_eq!(decodes.get(), 0);
+
+    let stats = cache.stats();
+    assert_eq!(stats.clips, 1);
+    assert_eq!(stats.resident_clips, 1);
+    assert_eq!(stats.hits, 10);
+    assert_eq!(stats.misses, 0);
+    assert_eq!(stats.pcm_bytes, 16);
+    assert_eq!(stats.encoded_bytes, 4);
+    assert_eq!(cache.memory_bytes(), 20);
+}
+
+#[test]
+fn test_insert_rejects_empty_and_undecodable_data() {
+    let mut cache = AudioClipCache::new();
+    assert!(cache.insert(Vec::new(), decode).is_err());
+    assert!(cache.insert(vec![1], failing_decode).is_err());
+    assert_eq!(
+        cache.stats(),
+        AudioClipCacheStats {
+            budget_bytes: DEFAULT_AUDIO_CLIP_BUDGET,
+            ..AudioClipCacheStats::default()
+        }
+    );
+}
+
+#[test]
+fn test_budget_evicts_least_recently_played() {
+    // Each clip decodes to 40 bytes; the budget holds two.
+    let mut cache = AudioClipCache::with_budget(80);
+    let a = cache.insert(vec![0; 10], decode).unwrap();
+    let b = cache.insert(vec![0; 10], decode).unwrap();
+    cache.acquire(a, decode).unwrap();
+
+    let c = cache.insert(vec![0; 10], decode).unwrap();
+    let stats = cache.stats();
+    assert_eq!(stats.resident_clips, 2);
+    assert_eq!(stats.evictions, 1);
+    assert_eq!(stats.pcm_bytes, 80);
+
+    // b was evicted: playing it decodes again and evicts a, now the oldest.
+    cache.acquire(b, decode).unwrap();
+    let stats = cache.stats();
+    assert_eq!(stats.misses, 1);
+    assert_eq!(stats.evictions, 2);
+    assert!(cache.contains(a) && cache.contains(b) && cache.contains(c));
+}
+
+#[test]
+fn test_oversized_clip_stays_resident_while_newest() {
+    let mut cache = AudioClipCache::with_budget(8);
+    let big = cache.insert(vec![0; 100], decode).unwrap();
+    assert_eq!(cache.stats().resident_clips, 1);
+
+    cache.insert(vec![0; 1], decode).unwrap();
+    assert_eq!(cache.stats().evictions, 1);
+    assert_eq!(cache.stats().pcm_bytes, 4);
+    assert!(cache.contains(big));
+}
+
+#[test]
+fn test_zero_budget_decodes_every_play() {
+    let mut cache = AudioClipCache::new();
+    let id = cache.insert(vec![1, 2], decode).unwrap();
+    cache.set_budget(0);
+    assert_eq!(cache.stats().pcm_bytes, 0);
+
+    cache.acquire(id, decode).unwrap();
+    cache.insert(vec![3], decode).unwrap();
+    cache.acquire(id, decode).unwrap();
+    assert_eq!(cache.stats().misses, 2);
+}
+
+#[test]
+fn test_remove_and_unknown_handles() {
+    let mut cache = AudioClipCache::new();
+    let id = cache.insert(vec![1, 2, 3], decode).unwrap();
+    assert!(cache.remove(id));
+    assert!(!cache.remove(id));
+    assert!(matches!(
+        cache.acquire(id, decode),
+        Err(GoudError::InvalidHandle)
+    ));
+    assert_eq!(cache.memory_bytes(), 0);
+
+    // Handles are not reused.
+    let next = cache.insert(vec![1], decode).unwrap();
+    assert_ne!(next, id);
+}
@@ -0,0 +1,230 @@
+//! Decoded clip playback: load a sound once, play it many times without decoding.
+
+use std::sync::Arc;
+use std::time::Duration;
+
+use rodio::{ChannelCount, Decoder, Player, SampleRate, Source};
+
+use crate::assets::audio_clip_cache::{AudioClipCacheStats, DecodedClip};
+use crate::core::error::{GoudError, GoudResult};
+use crate::ecs::components::AudioChannel;
+
+use super::{AudioManager, PlayerEntry};
+
+/// Decodes encoded audio bytes (WAV/OGG/MP3/FLAC) into interleaved PCM.
+fn decode_clip(bytes: &[u8]) -> GoudResult<DecodedClip> {
+    let decoder = Decoder::new(std::io::Cursor::new(bytes.to_vec()))
+        .map_err(|e| GoudError::ResourceLoadFailed(format!("Failed to decode audio: {}", e)))?;
+    let channels = u16::from(decoder.channels());
+    let sample_rate = u32::from(decoder.sample_rate());
+    let samples: Arc<[f32]> = decoder.collect();
+    Ok(DecodedClip {
+        samples,
+        channels,
+        sample_rate,
+    })
+}
+
+/// Rodio source reading a clip's shared PCM through a cursor.
+///
+/// Every play holds the same `Arc`, so starting one costs a reference
+/// count rather than a copy of the samples.  Looping wraps the cursor
+/// instead of going through `repeat_infinite()`, which would buffer the
+/// samples again as they play.
+pub(super) struct ClipSource {
+    samples: Arc<[f32]>,
+    position: usize,
+    looping: bool,
+    channels: ChannelCount,
+    sample_rate: SampleRate,
+}
+
+impl ClipSource {
+    pub(super) fn new(clip: &DecodedClip, looping: bool) -> GoudResult<Self> {
+        let invalid =
+            || GoudError::ResourceInvalidFormat("Decoded clip has no channels".to_string());
+        Ok(Self {
+            samples: Arc::clone(&clip.samples),
+            position: 0,
+            // An empty clip has nothing to repeat.
+            looping: looping && !clip.samples.is_empty(),
+            channels: ChannelCount::try_from(clip.channels).map_err(|_| invalid())?,
+            sample_rate: SampleRate::try_from(clip.sample_rate).map_err(|_| invalid())?,
+        })
+    }
+}
+
+impl Iterator for ClipSource {
+    type Item = rodio::Sample;
+
+    #[inline]
+    fn next(&mut self) -> Option<Self::Item> {
+        if self.position == self.samples.len() && self.looping {
+            self.position = 0;
+        }
+        let sample = self.samples.get(self.position).copied()?;
+        self.position += 1;
+        Some(sample)
+    }
+
+    fn size_hint(&self) -> (usize, Option<usize>) {
+        if self.looping {
+            (usize::MAX, None)
+        } else {
+            let remaining = self.samples.len() - self.position;
+            (remaining, Some(remaining))
+        }
+    }
+}
+
+impl Source for ClipSource {
+    fn current_span_len(&self) -> Option<usize> {
+        None
+    }
+
+    fn channels(&self) -> ChannelCount {
+        self.channels
+    }
+
+    fn sample_rate(&self) -> SampleRate {
+        self.sample_rate
+    }
+
+    fn total_duration(&self) -> Option<Duration> {
+        if self.looping {
+            return None;
+        }
+        let frames = self.samples.len() / usize::from(self.channels.get());
+        Some(Duration::from_secs_f64(
+            frames as f64 / f64::from(self.sample_rate.get()),
+        ))
+    }
+}
+
+impl AudioManager {
+    /// Decodes `bytes` once and caches the PCM as a clip.
+    ///
+    /// # Returns
+    ///
+    /// A non-zero clip ID for `play_clip()` and `play_clip_spatial()`.
+    ///
+    /// # Errors
+    ///
+    /// Returns `ResourceLoadFailed` if the data is empty or cannot be decoded.
+    pub fn load_clip(&mut self, bytes: Vec<u8>) -> GoudResult<u64> {
+        self.clips
+            .lock()
+            .unwrap_or_else(|poisoned| poisoned.into_inner())
+            .insert(bytes, decode_clip)
+    }
+
+    /// Unloads a clip.  Players already started from it keep playing.
+    ///
+    /// Returns `true` if the clip was loaded.
+    pub fn unload_clip(&mut self, clip_id: u64) -> bool {
+        self.clips
+            .lock()
+            .unwrap_or_else(|poisoned| poisoned.into_inner())
+            .remove(clip_id)
+    }
+
+    /// Plays a cached clip with custom volume, pitch, looping, and channel.
+    ///
+    /// A clip whose PCM was evicted from the cache is decoded again here.
+    ///
+    /// # Arguments
+    ///
+    /// * `clip_id` - ID returned from `load_clip()`
+    /// * `volume` - Individual volume multiplier (0.0-1.0, will be clamped)
+    /// * `speed` - Playback speed multiplier (0.1-10.0, affects pitch)
+    /// * `looping` - Whether to loop indefinitely
+    /// * `channel` - The audio channel to play on
+    ///
+    /// # Errors
+    ///
+    /// Returns `InvalidHandle` for an unknown clip.
+    pub fn play_clip(
+        &mut self,
+        clip_id: u64,
+        volume: f32,
+        speed: f32,
+        looping: bool,
+        channel: AudioChannel,
+    ) -> GoudResult<u64> {
+        let clip = self
+            .clips
+            .lock()
+            .unwrap_or_else(|poisoned| poisoned.into_inner())
+            .acquire(clip_id, decode_clip)?;
+        let source = ClipSource::new(&clip, looping)?.speed(speed.clamp(0.1, 10.0));
+
+        let player = Player::connect_new(self.output.mixer());
+        let clamped_volume = volume.clamp(0.0, 1.0);
+        player.set_volume(self.effective_volume(channel, clamped_volume));
+        player.append(source);
+
+        let player_id = self.allocate_player_id();
+        self.players
+            .lock()
+            .unwrap_or_else(|poisoned| poisoned.into_inner())
+            .insert(
+                player_id,
+                PlayerEntry {
+                    player,
+                    channel,
+                    individual_volume: clamped_volume,
+                },
+            );
+
+        Ok(player_id)
+    }
+
+    /// Plays a cached clip on the SFX channel with 3D spatial attenuation.
+    ///
+    /// The sink is tracked like `play_spatial()`, so later listener and
+    /// source movement updates its volume.
+    pub fn play_clip_spatial(
+        &mut self,
+        clip_id: u64,
+        source_position: [f32; 3],
+        listener_position: [f32; 3],
+        max_distance: f32,
+        rolloff: f32,
+    ) -> GoudResult<u64> {
+        self.set_listener_position(listener_position);
+        let sink_id = self.play_clip(clip_id, 1.0, 1.0, false, AudioChannel::SFX)?;
+        if self.register_spatial_source(sink_id, source_position, max_distance, rolloff, 1.0) {
+            Ok(sink_id)
+        } else {
+            let _ = self.stop(sink_id);
+            Err(GoudError::InvalidHandle)
+        }
+    }
+
+    /// Sets the byte budget for decoded clip PCM, evicting until it fits.
+    ///
+    /// Least-recently-played clips lose their PCM first and are decoded
+    /// again on their next play.
+    pub fn set_clip_budget(&mut self, budget_bytes: u64) {
+        self.clips
+            .lock()
+            .unwrap_or_else(|poisoned| poisoned.into_inner())
+            .set_budget(budget_bytes);
+    }
+
+    /// Returns the clip cache's occupancy and hit counters.
+    pub fn clip_stats(&self) -> AudioClipCacheStats {
+        self.clips
+            .lock()
+            .unwrap_or_else(|poisoned| poisoned.into_inner())
+            .stats()
+    }
+
+    /// Bytes of decoded PCM and encoded source data held by the clip cache.
+    pub fn clip_memory_bytes(&self) -> u64 {
+        self.clips
+            .lock()
+            .unwrap_or_else(|poisoned| poisoned.into_inner())
+            .memory_bytes()
+    }
+}
@@ -66,17 +66,31 @@ impl AudioManager {
         to_asset: &AudioAsset,
         duration_sec: f32,
         channel: AudioChannel,
+    ) -> GoudResult<u64> {
+        self.crossfade_into(from_id, duration_sec, |audio, volume| {
+            audio.play_with_settings(to_asset, volume, 1.0, false, channel)
+        })
+    }
+
+    /// Crossfades from `from_id` to the sink `start` plays at a given volume.
+    ///
+    /// Shared by asset and streamed crossfades; see `crossfade_to()`.
+    pub(super) fn crossfade_into(
+        &mut self,
+        from_id: u64,
+        duration_sec: f32,
+        start: impl FnOnce(&mut Self, f32) -> GoudResult<u64>,
     ) -> GoudResult<u64> {
         let from_volume = self.sink_volume(from_id).ok_or(GoudError::InvalidHandle)?;
         let duration_sec = clamp_duration(duration_sec);
 
         if duration_sec <= f32::EPSILON {
-            let to_id = self.play_with_settings(to_asset, from_volume, 1.0, false, channel)?;
+            let to_id = start(self, from_volume)?;
             let _ = self.stop(from_id);
             return Ok(to_id);
         }
 
-        let to_id = self.play_with_settings(to_asset, 0.0, 1.0, false, channel)?;
+        let to_id = start(self, 0.0)?;
 
         self.crossfades
             .lock()
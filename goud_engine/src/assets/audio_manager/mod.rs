@@ -7,6 +7,8 @@
 //! # Features
 //!
 //! - Play audio from loaded assets
+//! - Play decoded clips from a budgeted cache without re-decoding
+//! - Stream long tracks from disk, decoded on a background thread
 //! - Control global volume
 //! - Play, pause, stop, resume audio
 //! - Check playback state
@@ -31,16 +33,22 @@
 
 pub(super) mod spatial;
 
+mod clips;
 mod controls;
 mod mixing;
+mod output;
 mod playback;
 mod spatial_playback;
+mod streaming;
 #[cfg(test)]
 mod tests;
 
+use crate::assets::audio_clip_cache::AudioClipCache;
+use crate::assets::audio_stream::AudioStreamCounters;
 use crate::core::error::{GoudError, GoudResult};
 use crate::ecs::components::AudioChannel;
-use rodio::{DeviceSinkBuilder, MixerDeviceSink, Player};
+use output::{AudioOutput, NullSink};
+use rodio::{DeviceSinkBuilder, Player};
 use std::collections::HashMap;
 use std::sync::{Arc, Mutex};
 
@@ -58,6 +66,8 @@ pub(crate) struct SpatialSourceState {
     pub(crate) max_distance: f32,
     pub(crate) rolloff: f32,
     pub(crate) base_volume: f32,
+    /// Paused by `update_spatial_sources()` for being out of range.
+    pub(crate) culled: bool,
 }
 
 /// Active crossfade state between two sink IDs.
@@ -97,8 +107,8 @@ pub(crate) struct CrossfadeState {
 /// assert_eq!(audio_manager.global_volume(), 0.5);
 /// ```
 pub struct AudioManager {
-    /// Audio device sink (must be kept alive for playback).
-    pub(super) device_sink: MixerDeviceSink,
+    /// Audio output the players mix into (must be kept alive for playback).
+    pub(super) output: AudioOutput,
 
     /// Global volume (0.0 to 1.0).
     pub(super) global_volume: Arc<Mutex<f32>>,
@@ -120,6 +130,12 @@ pub struct AudioManager {
 
     /// In-progress crossfades, keyed by destination sink ID.
     pub(super) crossfades: Arc<Mutex<HashMap<u64, CrossfadeState>>>,
+
+    /// Decoded clips played by ID, with a PCM byte budget.
+    pub(super) clips: Arc<Mutex<AudioClipCache>>,
+
+    /// Counters shared with the decoder threads of streamed tracks.
+    pub(super) streams: Arc<AudioStreamCounters>,
 }
 
 impl AudioManager {
@@ -145,7 +161,24 @@ impl AudioManager {
         })?;
         // Suppress the log message rodio prints when the device sink is dropped.
         device_sink.log_on_drop(false);
+        Ok(Self::with_output(AudioOutput::Device(device_sink)))
+    }
+
+    /// Creates an AudioManager that mixes into a null sink instead of a device.
+    ///
+    /// Playback behaves as it does on real hardware — sources advance in real
+    /// time and finished sounds are reclaimed — but the mixed samples are
+    /// discarded. Headless engines use this on servers and CI machines that
+    /// have no audio device.
+    ///
+    /// # Errors
+    ///
+    /// Returns `AudioInitFailed` if the sink's mixing thread cannot start.
+    pub fn new_null() -> GoudResult<Self> {
+        Ok(Self::with_output(AudioOutput::Null(NullSink::open()?)))
+    }
 
+    fn with_output(output: AudioOutput) -> Self {
         let mut channel_volumes = HashMap::new();
         channel_volumes.insert(AudioChannel::Music, 1.0);
         channel_volumes.insert(AudioChannel::SFX, 1.0);
@@ -153,8 +186,8 @@ impl AudioManager {
         channel_volumes.insert(AudioChannel::Ambience, 1.0);
         channel_volumes.insert(AudioChannel::UI, 1.0);
 
-        Ok(Self {
-            device_sink,
+        Self {
+            output,
             global_volume: Arc::new(Mutex::new(1.0)),
             players: Arc::new(Mutex::new(HashMap::new())),
             next_player_id: Arc::new(Mutex::new(0)),
@@ -162,14 +195,16 @@ impl AudioManager {
             listener_position: Arc::new(Mutex::new([0.0, 0.0, 0.0])),
             spatial_sources: Arc::new(Mutex::new(HashMap::new())),
             crossfades: Arc::new(Mutex::new(HashMap::new())),
-        })
+            clips: Arc::new(Mutex::new(AudioClipCache::new())),
+            streams: Arc::new(AudioStreamCounters::default()),
+        }
     }
 }
 
-// SAFETY: AudioManager is Send because all fields are Send (Arc, Mutex, MixerDeviceSink).
+// SAFETY: AudioManager is Send because all fields are Send (Arc, Mutex, AudioOutput).
 // AudioManager is Sync because:
 // - global_volume, players, next_player_id, channel_volumes are Arc<Mutex<_>> (inherently Sync)
-// - device_sink (MixerDeviceSink/cpal::Stream) is NOT Sync, but is only accessed through
+// - output (MixerDeviceSink/cpal::Stream) is NOT Sync, but is only accessed through
 //   &mut self methods, which guarantees exclusive access and prevents concurrent use.
 unsafe impl Send for AudioManager {}
 unsafe impl Sync for AudioManager {}
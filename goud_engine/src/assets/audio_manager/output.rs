@@ -0,0 +1,102 @@
+//! Audio output targets: the default device, or a null sink for headless runs.
+
+use std::sync::atomic::{AtomicBool, Ordering};
+use std::sync::Arc;
+use std::thread::JoinHandle;
+use std::time::{Duration, Instant};
+
+use rodio::mixer::{Mixer, MixerSource};
+use rodio::MixerDeviceSink;
+
+use crate::core::error::{GoudError, GoudResult};
+
+/// Channel count of the null sink's mix.
+const NULL_SINK_CHANNELS: u16 = 2;
+/// Sample rate of the null sink's mix.
+const NULL_SINK_SAMPLE_RATE: u32 = 48_000;
+/// How much audio the null sink pulls per wake-up.
+const NULL_SINK_PERIOD: Duration = Duration::from_millis(10);
+
+/// Where the audio manager's players mix into.
+pub(crate) enum AudioOutput {
+    /// The platform's default audio device.
+    Device(MixerDeviceSink),
+    /// A real-time sink that mixes and discards samples.
+    Null(NullSink),
+}
+
+impl AudioOutput {
+    /// The mixer new players connect to.
+    pub(crate) fn mixer(&self) -> &Mixer {
+        match self {
+            Self::Device(sink) => sink.mixer(),
+            Self::Null(sink) => &sink.mixer,
+        }
+    }
+}
+
+/// Mixer drained by a background thread at playback speed.
+///
+/// Sources advance, finish, and free their players exactly as they would on
+/// a device, so game logic that waits for a sound to end keeps working on a
+/// machine with no audio hardware.
+pub(crate) struct NullSink {
+    mixer: Mixer,
+    stop: Arc<AtomicBool>,
+    drain: Option<JoinHandle<()>>,
+}
+
+impl NullSink {
+    /// Creates the mixer and starts the thread that consumes it.
+    pub(crate) fn open() -> GoudResult<Self> {
+        let invalid = || GoudError::AudioInitFailed("Invalid null sink format".to_string());
+        let channels = rodio::ChannelCount::try_from(NULL_SINK_CHANNELS).map_err(|_| invalid())?;
+        let sample_rate =
+            rodio::SampleRate::try_from(NULL_SINK_SAMPLE_RATE).map_err(|_| invalid())?;
+        let (mixer, source) = rodio::mixer::mixer(channels, sample_rate);
+
+        let stop = Arc::new(AtomicBool::new(false));
+        let drain = std::thread::Builder::new()
+            .name("goud-null-audio".to_string())
+            .spawn({
+                let stop = Arc::clone(&stop);
+                move || drain(source, &stop)
+            })
+            .map_err(|e| {
+                GoudError::AudioInitFailed(format!("Failed to start null audio sink: {}", e))
+            })?;
+
+        Ok(Self {
+            mixer,
+            stop,
+            drain: Some(drain),
+        })
+    }
+}
+
+impl Drop for NullSink {
+    fn drop(&mut self) {
+        self.stop.store(true, Ordering::Relaxed);
+        if let Some(drain) = self.drain.take() {
+            let _ = drain.join();
+        }
+    }
+}
+
+/// Pulls one period of samples every [`NULL_SINK_PERIOD`] until stopped.
+fn drain(mut source: MixerSource, stop: &AtomicBool) {
+    let samples_per_period =
+        (NULL_SINK_SAMPLE_RATE as u128 * NULL_SINK_CHANNELS as u128 * NULL_SINK_PERIOD.as_millis()
+            / 1000) as usize;
+    let mut deadline = Instant::now();
+    while !stop.load(Ordering::Relaxed) {
+        for _ in 0..samples_per_period {
+            let _ = source.next();
+        }
+        deadline += NULL_SINK_PERIOD;
+        // A period that ran late is made up on the next pass instead of sleeping.
+        if let Some(wait) = deadline.checked_duration_since(Instant::now()) {
+            std::thread::sleep(wait);
+        }
+    }
+}
@@ -9,7 +9,7 @@ use rodio::{Decoder, Player, Source};
 use super::{AudioManager, PlayerEntry};
 
 /// Opens a streaming audio file and returns a decoder over a buffered reader.
-fn open_streaming_decoder(
+pub(super) fn open_streaming_decoder(
     path: &std::path::Path,
 ) -> GoudResult<Decoder<std::io::BufReader<std::fs::File>>> {
     let file = std::fs::File::open(path).map_err(|e| {
@@ -73,7 +73,7 @@ impl AudioManager {
             ));
         }
 
-        let player = Player::connect_new(self.device_sink.mixer());
+        let player = Player::connect_new(self.output.mixer());
         let effective = self.effective_volume(channel, 1.0);
         player.set_volume(effective);
 
@@ -121,7 +121,7 @@ impl AudioManager {
         }
 
         let channel = AudioChannel::SFX;
-        let player = Player::connect_new(self.device_sink.mixer());
+        let player = Player::connect_new(self.output.mixer());
         let effective = self.effective_volume(channel, 1.0);
         player.set_volume(effective);
 
@@ -178,7 +178,7 @@ impl AudioManager {
         }
 
         let clamped_speed = speed.clamp(0.1, 10.0);
-        let player = Player::connect_new(self.device_sink.mixer());
+        let player = Player::connect_new(self.output.mixer());
         let clamped_volume = volume.clamp(0.0, 1.0);
         let effective = self.effective_volume(channel, clamped_volume);
         player.set_volume(effective);
@@ -234,6 +234,16 @@ impl AudioManager {
             .unwrap_or_else(|poisoned| poisoned.into_inner());
         if let Some(entry) = players.get(&sink_id) {
             entry.player.pause();
+            // An explicit pause must not be undone when a culled source
+            // comes back into range.
+            if let Some(state) = self
+                .spatial_sources
+                .lock()
+                .unwrap_or_else(|poisoned| poisoned.into_inner())
+                .get_mut(&sink_id)
+            {
+                state.culled = false;
+            }
             true
         } else {
             false
@@ -301,6 +311,7 @@ impl AudioManager {
     /// # Returns
     ///
     /// `true` if the sink exists and is not paused, `false` otherwise.
+    /// Sinks paused only by spatial culling count as playing.
     pub fn is_playing(&self, sink_id: u64) -> bool {
         let players = self
             .players
@@ -308,6 +319,12 @@ impl AudioManager {
             .unwrap_or_else(|poisoned| poisoned.into_inner());
         if let Some(entry) = players.get(&sink_id) {
             !entry.player.is_paused()
+                || self
+                    .spatial_sources
+                    .lock()
+                    .unwrap_or_else(|poisoned| poisoned.into_inner())
+                    .get(&sink_id)
+                    .is_some_and(|state| state.culled)
         } else {
             false
         }
@@ -1,14 +1,61 @@
 //! Spatial audio playback: distance-based attenuation for positioned audio sources.
 
-use std::collections::HashSet;
+use std::collections::{HashMap, HashSet};
 
 use crate::assets::loaders::AudioAsset;
+use crate::assets::spatial_audio::SpatialSourceUpdate;
 use crate::core::error::GoudResult;
 use crate::core::math::Vec2;
 use crate::ecs::components::AudioChannel;
 
 use super::spatial::spatial_attenuation_3d;
-use super::{AudioManager, SpatialSourceState};
+use super::{AudioManager, PlayerEntry, SpatialSourceState};
+
+/// Re-applies attenuation to every tracked source and drops sources whose
+/// sink is gone.
+///
+/// In-range culled sinks always resume; out-of-range sinks are paused and
+/// marked culled only when `cull` is set, and never if already paused by
+/// the caller.
+fn attenuate_sources(
+    players: &mut HashMap<u64, PlayerEntry>,
+    spatial_sources: &mut HashMap<u64, SpatialSourceState>,
+    listener: [f32; 3],
+    global: f32,
+    channel_volumes: &HashMap<AudioChannel, f32>,
+    cull: bool,
+) {
+    spatial_sources.retain(|sink_id, state| {
+        let Some(entry) = players.get_mut(sink_id) else {
+            return false;
+        };
+
+        let attenuation = spatial_attenuation_3d(
+            state.source_position,
+            listener,
+            state.max_distance,
+            state.rolloff,
+        );
+        let individual = (state.base_volume * attenuation).clamp(0.0, 1.0);
+        entry.individual_volume = individual;
+
+        let channel_volume = channel_volumes.get(&entry.channel).copied().unwrap_or(1.0);
+        entry
+            .player
+            .set_volume(global * channel_volume * entry.individual_volume);
+
+        if attenuation > 0.0 {
+            if state.culled {
+                entry.player.play();
+                state.culled = false;
+            }
+        } else if cull && !state.culled && !entry.player.is_paused() {
+            entry.player.pause();
+            state.culled = true;
+        }
+        true
+    });
+}
 
 impl AudioManager {
     /// Returns the current 3D listener position.
@@ -43,17 +90,22 @@ impl AudioManager {
             return false;
         }
 
-        let state = SpatialSourceState {
-            source_position,
-            max_distance: max_distance.max(0.1),
-            rolloff: rolloff.max(0.01),
-            base_volume: base_volume.clamp(0.0, 1.0),
-        };
-
-        self.spatial_sources
+        let mut spatial = self
+            .spatial_sources
             .lock()
-            .unwrap_or_else(|poisoned| poisoned.into_inner())
-            .insert(sink_id, state);
+            .unwrap_or_else(|poisoned| poisoned.into_inner());
+        let culled = spatial.get(&sink_id).is_some_and(|state| state.culled);
+        spatial.insert(
+            sink_id,
+            SpatialSourceState {
+                source_position,
+                max_distance: max_distance.max(0.1),
+                rolloff: rolloff.max(0.01),
+                base_volume: base_volume.clamp(0.0, 1.0),
+                culled,
+            },
+        );
+        drop(spatial);
 
         self.refresh_spatial_sources();
         true
@@ -91,6 +143,41 @@ impl AudioManager {
     /// Re-applies attenuation to all tracked spatial sinks.
     pub fn refresh_spatial_sources(&self) {
         let listener = self.listener_position();
+        self.apply_spatial_sources(listener, std::iter::empty(), false);
+    }
+
+    /// Applies a frame of spatial updates in one pass.
+    ///
+    /// Sets the listener, updates or registers the source of every update
+    /// whose sink is active, and re-attenuates all tracked sources once, so
+    /// the cost is linear in the number of sources rather than quadratic as
+    /// with per-source `set_source_position()` calls.
+    ///
+    /// Sources beyond their `max_distance` are also culled: the sink is
+    /// paused so the mixer stops pulling samples from it, and resumes once
+    /// it is back in range.  Sinks paused by the caller are left alone, and
+    /// `is_playing()` still reports culled sinks as playing.
+    ///
+    /// Returns the number of updates applied; updates for unknown sinks are
+    /// skipped.
+    pub fn update_spatial_sources(
+        &self,
+        listener_position: [f32; 3],
+        updates: impl IntoIterator<Item = SpatialSourceUpdate>,
+    ) -> usize {
+        *self
+            .listener_position
+            .lock()
+            .unwrap_or_else(|poisoned| poisoned.into_inner()) = listener_position;
+        self.apply_spatial_sources(listener_position, updates, true)
+    }
+
+    fn apply_spatial_sources(
+        &self,
+        listener: [f32; 3],
+        updates: impl IntoIterator<Item = SpatialSourceUpdate>,
+        cull: bool,
+    ) -> usize {
         let global = self.global_volume();
         let channel_volumes = self
             .channel_volumes
@@ -102,30 +189,41 @@ impl AudioManager {
             .players
             .lock()
             .unwrap_or_else(|poisoned| poisoned.into_inner());
-
-        self.spatial_sources
+        let mut spatial = self
+            .spatial_sources
             .lock()
-            .unwrap_or_else(|poisoned| poisoned.into_inner())
-            .retain(|sink_id, state| {
-                let Some(entry) = players.get_mut(sink_id) else {
-                    return false;
-                };
-
-                let attenuation = spatial_attenuation_3d(
-                    state.source_position,
-                    listener,
-                    state.max_distance,
-                    state.rolloff,
-                );
-                let individual = (state.base_volume * attenuation).clamp(0.0, 1.0);
-                entry.individual_volume = individual;
-
-                let channel_volume = channel_volumes.get(&entry.channel).copied().unwrap_or(1.0);
-                entry
-                    .player
-                    .set_volume(global * channel_volume * entry.individual_volume);
-                true
-            });
+            .unwrap_or_else(|poisoned| poisoned.into_inner());
+
+        let mut applied = 0;
+        for update in updates {
+            if !players.contains_key(&update.sink_id) {
+                continue;
+            }
+            let culled = spatial
+                .get(&update.sink_id)
+                .is_some_and(|state| state.culled);
+            spatial.insert(
+                update.sink_id,
+                SpatialSourceState {
+                    source_position: update.source_position,
+                    max_distance: update.max_distance.max(0.1),
+                    rolloff: update.rolloff.max(0.01),
+                    base_volume: update.base_volume.clamp(0.0, 1.0),
+                    culled,
+                },
+            );
+            applied += 1;
+        }
+
+        attenuate_sources(
+            &mut players,
+            &mut spatial,
+            listener,
+            global,
+            &channel_volumes,
+            cull,
+        );
+        applied
     }
 
     /// Plays audio with spatial positioning (2D).
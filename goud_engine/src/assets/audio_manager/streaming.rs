@@ -0,0 +1,154 @@
+//! Streamed playback: long tracks decoded from disk on a background thread.
+
+use std::path::Path;
+use std::sync::Arc;
+use std::time::Duration;
+
+use rodio::{ChannelCount, Player, SampleRate, Source};
+
+use crate::assets::audio_stream::{spawn_stream, AudioStreamStats, StreamReader};
+use crate::core::error::{GoudError, GoudResult};
+use crate::ecs::components::AudioChannel;
+
+use super::playback::open_streaming_decoder;
+use super::{AudioManager, PlayerEntry};
+
+/// Rodio source reading a stream's decoded chunks.
+struct StreamSource {
+    reader: StreamReader,
+    channels: ChannelCount,
+    sample_rate: SampleRate,
+}
+
+impl Iterator for StreamSource {
+    type Item = rodio::Sample;
+
+    #[inline]
+    fn next(&mut self) -> Option<Self::Item> {
+        self.reader.next()
+    }
+}
+
+impl Source for StreamSource {
+    fn current_span_len(&self) -> Option<usize> {
+        None
+    }
+
+    fn channels(&self) -> ChannelCount {
+        self.channels
+    }
+
+    fn sample_rate(&self) -> SampleRate {
+        self.sample_rate
+    }
+
+    fn total_duration(&self) -> Option<Duration> {
+        None
+    }
+}
+
+impl AudioManager {
+    /// Streams an audio file, decoding it on a background thread.
+    ///
+    /// Only a few hundred milliseconds of decoded audio are buffered, and
+    /// the file is read as it plays rather than loaded up front, so long
+    /// music tracks cost the same memory as short ones.  The returned ID
+    /// works with every player control, `crossfade_to()` and `mix_with()`.
+    ///
+    /// # Arguments
+    ///
+    /// * `path` - Audio file (WAV/OGG/MP3/FLAC)
+    /// * `volume` - Individual volume multiplier (0.0-1.0, will be clamped)
+    /// * `looping` - Whether to restart from the beginning at the end
+    /// * `channel` - The audio channel to play on
+    ///
+    /// # Errors
+    ///
+    /// Returns `ResourceLoadFailed` if the file cannot be opened or decoded.
+    pub fn play_stream(
+        &mut self,
+        path: &Path,
+        volume: f32,
+        looping: bool,
+        channel: AudioChannel,
+    ) -> GoudResult<u64> {
+        let decoder = open_streaming_decoder(path)?;
+        let channels = decoder.channels();
+        let sample_rate = decoder.sample_rate();
+        let reopen_path = path.to_path_buf();
+        let reader = spawn_stream(
+            decoder,
+            move || open_streaming_decoder(&reopen_path),
+            looping,
+            u16::from(channels),
+            Arc::clone(&self.streams),
+        )?;
+
+        let player = Player::connect_new(self.output.mixer());
+        let clamped_volume = volume.clamp(0.0, 1.0);
+        player.set_volume(self.effective_volume(channel, clamped_volume));
+        player.append(StreamSource {
+            reader,
+            channels,
+            sample_rate,
+        });
+
+        let player_id = self.allocate_player_id();
+        self.players
+            .lock()
+            .unwrap_or_else(|poisoned| poisoned.into_inner())
+            .insert(
+                player_id,
+                PlayerEntry {
+                    player,
+                    channel,
+                    individual_volume: clamped_volume,
+                },
+            );
+
+        Ok(player_id)
+    }
+
+    /// Starts a crossfade from an active sink to a newly streamed file.
+    ///
+    /// Behaves like `crossfade_to()`; the destination loops when `looping`.
+    pub fn crossfade_to_stream(
+        &mut self,
+        from_id: u64,
+        path: &Path,
+        duration_sec: f32,
+        looping: bool,
+        channel: AudioChannel,
+    ) -> GoudResult<u64> {
+        self.crossfade_into(from_id, duration_sec, |audio, volume| {
+            audio.play_stream(path, volume, looping, channel)
+        })
+    }
+
+    /// Layers a streamed file on top of an active primary sink.
+    ///
+    /// Behaves like `mix_with()`; the secondary layer loops when `looping`.
+    pub fn mix_with_stream(
+        &mut self,
+        primary_id: u64,
+        path: &Path,
+        secondary_volume: f32,
+        looping: bool,
+        secondary_channel: AudioChannel,
+    ) -> GoudResult<u64> {
+        if !self.has_sink(primary_id) {
+            return Err(GoudError::InvalidHandle);
+        }
+        self.play_stream(path, secondary_volume, looping, secondary_channel)
+    }
+
+    /// Returns counters for the streams decoding in the background.
+    pub fn stream_stats(&self) -> AudioStreamStats {
+        self.streams.stats()
+    }
+
+    /// Bytes held by the clip cache and the active streams' buffers.
+    pub fn memory_bytes(&self) -> u64 {
+        self.clip_memory_bytes() + self.streams.stats().buffer_bytes
+    }
+}
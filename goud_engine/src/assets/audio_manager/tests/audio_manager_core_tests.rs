@@ -18,6 +18,88 @@ fn test_audio_manager_new() {
     }
 }
 
+/// A 20 ms mono 48 kHz WAV clip.
+fn short_wav_bytes() -> Vec<u8> {
+    let spec = hound::WavSpec {
+        channels: 1,
+        sample_rate: 48_000,
+        bits_per_sample: 16,
+        sample_format: hound::SampleFormat::Int,
+    };
+    let mut cursor = std::io::Cursor::new(Vec::new());
+    {
+        let mut writer = hound::WavWriter::new(&mut cursor, spec).unwrap();
+        for i in 0..960 {
+            writer.write_sample(((i % 64) * 256) as i16).unwrap();
+        }
+        writer.finalize().unwrap();
+    }
+    cursor.into_inner()
+}
+
+#[test]
+fn test_null_sink_plays_clips_to_completion_without_hardware() {
+    let mut manager = AudioManager::new_null().expect("null sink needs no device");
+    assert_eq!(manager.global_volume(), 1.0);
+
+    let clip = manager.load_clip(short_wav_bytes()).unwrap();
+    let sink = manager
+        .play_clip(
+            clip,
+            1.0,
+            1.0,
+            false,
+            crate::ecs::components::AudioChannel::SFX,
+        )
+        .unwrap();
+    assert_eq!(manager.active_count(), 1);
+
+    // The sink drains in real time, so a 20 ms clip ends well within a second.
+    let started = std::time::Instant::now();
+    while !manager.is_finished(sink) {
+        assert!(started.elapsed() < std::time::Duration::from_secs(2));
+        std::thread::sleep(std::time::Duration::from_millis(5));
+    }
+    manager.cleanup_finished();
+    assert_eq!(manager.active_count(), 0);
+}
+
+#[test]
+fn test_clip_sources_share_decoded_samples() {
+    use super::super::clips::ClipSource;
+    use crate::assets::audio_clip_cache::DecodedClip;
+    use rodio::Source;
+    use std::sync::Arc;
+
+    let clip = DecodedClip {
+        samples: Arc::from(&[0.25_f32, -0.25, 0.5, -0.5][..]),
+        channels: 2,
+        sample_rate: 4,
+    };
+    let once = ClipSource::new(&clip, false).unwrap();
+    let looped = ClipSource::new(&clip, true).unwrap();
+    assert_eq!(Arc::strong_count(&clip.samples), 3);
+
+    assert_eq!(
+        once.total_duration(),
+        Some(std::time::Duration::from_millis(500))
+    );
+    assert_eq!(once.collect::<Vec<_>>(), clip.samples.to_vec());
+    let repeated: Vec<f32> = looped.take(6).collect();
+    assert_eq!(repeated, [0.25, -0.25, 0.5, -0.5, 0.25, -0.25]);
+
+    let silent = DecodedClip {
+        samples: Arc::from(&[][..]),
+        ..clip.clone()
+    };
+    assert_eq!(ClipSource::new(&silent, true).unwrap().next(), None);
+    let no_channels = DecodedClip {
+        channels: 0,
+        ..clip
+    };
+    assert!(ClipSource::new(&no_channels, false).is_err());
+}
+
 #[test]
 #[ignore] // requires audio hardware
 fn test_audio_manager_global_volume() {
@@ -7,6 +7,7 @@ use crate::assets::audio_manager::{
     AudioManager,
 };
 use crate::assets::loaders::AudioAsset;
+use crate::assets::SpatialSourceUpdate;
 use crate::core::math::Vec2;
 
 #[test]
@@ -40,6 +41,22 @@ fn test_spatial_audio_update_volume_nonexistent() {
     }
 }
 
+#[test]
+#[ignore] // requires audio hardware
+fn test_batched_spatial_update_skips_unknown_sinks_and_moves_listener() {
+    if let Ok(manager) = AudioManager::new() {
+        let updates = (0..4).map(|i| SpatialSourceUpdate {
+            sink_id: 1000 + i,
+            source_position: [i as f32, 0.0, 0.0],
+            max_distance: 10.0,
+            rolloff: 1.0,
+            base_volume: 1.0,
+        });
+        assert_eq!(manager.update_spatial_sources([3.0, 4.0, 5.0], updates), 0);
+        assert_eq!(manager.listener_position(), [3.0, 4.0, 5.0]);
+    }
+}
+
 #[test]
 fn test_compute_attenuation_linear() {
     // (distance, max_distance, rolloff, expected)
@@ -1,4 +1,9 @@
+use std::path::Path;
+
+use crate::assets::audio_clip_cache::AudioClipCacheStats;
+use crate::assets::audio_stream::AudioStreamStats;
 use crate::assets::loaders::AudioAsset;
+use crate::assets::spatial_audio::SpatialSourceUpdate;
 use crate::core::error::{GoudError, GoudResult};
 use crate::core::math::Vec2;
 use crate::ecs::components::AudioChannel;
@@ -16,6 +21,11 @@ impl AudioManager {
         Err(GoudError::AudioInitFailed(AUDIO_UNAVAILABLE.to_string()))
     }
 
+    /// Creates a placeholder null-sink audio manager for builds without desktop audio.
+    pub fn new_null() -> GoudResult<Self> {
+        Err(GoudError::AudioInitFailed(AUDIO_UNAVAILABLE.to_string()))
+    }
+
     pub fn play(&mut self, _asset: &AudioAsset) -> GoudResult<u64> {
         Err(audio_unavailable())
     }
@@ -43,6 +53,86 @@ impl AudioManager {
         Err(audio_unavailable())
     }
 
+    pub fn load_clip(&mut self, _bytes: Vec<u8>) -> GoudResult<u64> {
+        Err(audio_unavailable())
+    }
+
+    pub fn unload_clip(&mut self, _clip_id: u64) -> bool {
+        false
+    }
+
+    pub fn play_clip(
+        &mut self,
+        _clip_id: u64,
+        _volume: f32,
+        _speed: f32,
+        _looping: bool,
+        _channel: AudioChannel,
+    ) -> GoudResult<u64> {
+        Err(audio_unavailable())
+    }
+
+    pub fn play_clip_spatial(
+        &mut self,
+        _clip_id: u64,
+        _source_position: [f32; 3],
+        _listener_position: [f32; 3],
+        _max_distance: f32,
+        _rolloff: f32,
+    ) -> GoudResult<u64> {
+        Err(audio_unavailable())
+    }
+
+    pub fn set_clip_budget(&mut self, _budget_bytes: u64) {}
+
+    pub fn clip_stats(&self) -> AudioClipCacheStats {
+        AudioClipCacheStats::default()
+    }
+
+    pub fn clip_memory_bytes(&self) -> u64 {
+        0
+    }
+
+    pub fn play_stream(
+        &mut self,
+        _path: &Path,
+        _volume: f32,
+        _looping: bool,
+        _channel: AudioChannel,
+    ) -> GoudResult<u64> {
+        Err(audio_unavailable())
+    }
+
+    pub fn crossfade_to_stream(
+        &mut self,
+        _from_id: u64,
+        _path: &Path,
+        _duration_sec: f32,
+        _looping: bool,
+        _channel: AudioChannel,
+    ) -> GoudResult<u64> {
+        Err(audio_unavailable())
+    }
+
+    pub fn mix_with_stream(
+        &mut self,
+        _primary_id: u64,
+        _path: &Path,
+        _secondary_volume: f32,
+        _looping: bool,
+        _secondary_channel: AudioChannel,
+    ) -> GoudResult<u64> {
+        Err(audio_unavailable())
+    }
+
+    pub fn stream_stats(&self) -> AudioStreamStats {
+        AudioStreamStats::default()
+    }
+
+    pub fn memory_bytes(&self) -> u64 {
+        0
+    }
+
     pub fn pause(&self, _sink_id: u64) -> bool {
         false
     }
@@ -122,6 +212,14 @@ impl AudioManager {
 
     pub fn refresh_spatial_sources(&self) {}
 
+    pub fn update_spatial_sources(
+        &self,
+        _listener_position: [f32; 3],
+        _updates: impl IntoIterator<Item = SpatialSourceUpdate>,
+    ) -> usize {
+        0
+    }
+
     pub fn play_spatial(
         &mut self,
         _asset: &AudioAsset,
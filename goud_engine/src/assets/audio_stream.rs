@@ -0,0 +1,241 @@
+//! Background-decoded audio streams.
+//!
+//! Long music tracks should not be decoded up front or held in memory as
+//! encoded bytes.  A stream decodes its source on a background thread into
+//! fixed-size chunks of interleaved `f32` samples, passed to the audio thread
+//! through a small bounded queue.  Spent chunks are handed back to the
+//! decoder for reuse, and it allocates at most [`STREAM_BUFFER_CHUNKS`]
+//! chunks: the queue's, the one playing and the one being decoded.  Once all
+//! of them are in use it blocks until playback returns one, so a stream
+//! holds at most [`STREAM_BUFFER_BYTES`] of decoded audio however long the
+//! track is.
+//!
+//! The audio thread never waits on the decoder: if the queue runs dry it
+//! plays a frame of silence and counts an underrun.
+//!
+//! Like the clip cache, this module does not decode by itself: callers pass
+//! the decoder as a sample iterator, which keeps it free of the audio backend
+//! and usable in every build.
+
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::Arc;
+use std::thread;
+
+use crossbeam_channel::{bounded, Receiver, Sender, TryRecvError};
+
+use crate::core::error::{GoudError, GoudResult};
+
+/// Samples per decoded chunk, rounded down to whole frames per stream.
+pub const STREAM_CHUNK_SAMPLES: usize = 4096;
+
+/// Decoded chunks queued ahead of playback: about 0.37 s of 44.1 kHz stereo.
+pub const STREAM_QUEUE_CHUNKS: usize = 8;
+
+/// Chunk buffers one stream allocates at most: a full queue, the chunk
+/// playing and the chunk being decoded.
+pub const STREAM_BUFFER_CHUNKS: usize = STREAM_QUEUE_CHUNKS + 2;
+
+/// Bytes of decoded audio one stream holds at most, 160 KiB: every chunk
+/// buffer it can allocate, whether queued, recycled, playing or in flight.
+pub const STREAM_BUFFER_BYTES: u64 =
+    (STREAM_BUFFER_CHUNKS * STREAM_CHUNK_SAMPLES * std::mem::size_of::<f32>()) as u64;
+
+/// Counters shared by every stream of one audio manager.
+#[derive(Debug, Default)]
+pub struct AudioStreamCounters {
+    active: AtomicU64,
+    underruns: AtomicU64,
+}
+
+impl AudioStreamCounters {
+    /// Returns a snapshot of the counters.
+    pub fn stats(&self) -> AudioStreamStats {
+        let active_streams = self.active.load(Ordering::Relaxed);
+        AudioStreamStats {
+            active_streams,
+            buffer_bytes: active_streams * STREAM_BUFFER_BYTES,
+            underruns: self.underruns.load(Ordering::Relaxed),
+        }
+    }
+}
+
+/// Snapshot of [`AudioStreamCounters`].
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct AudioStreamStats {
+    /// Streams whose decoder thread is still running.
+    pub active_streams: u64,
+    /// Decoded-audio buffers the active streams can hold at most.
+    pub buffer_bytes: u64,
+    /// Times playback found a stream's queue empty and played silence.
+    pub underruns: u64,
+}
+
+/// Playback end of a stream: yields interleaved samples as they are decoded.
+///
+/// Dropping the reader stops the decoder thread.
+pub struct StreamReader {
+    chunks: Receiver<Vec<f32>>,
+    recycle: Sender<Vec<f32>>,
+    current: Vec<f32>,
+    position: usize,
+    channels: usize,
+    silence: usize,
+    starved: bool,
+    finished: bool,
+    counters: Arc<AudioStreamCounters>,
+}
+
+impl Iterator for StreamReader {
+    type Item = f32;
+
+    fn next(&mut self) -> Option<f32> {
+        loop {
+            if self.silence > 0 {
+                self.silence -= 1;
+                return Some(0.0);
+            }
+            if let Some(&sample) = self.current.get(self.position) {
+                self.position += 1;
+                return Some(sample);
+            }
+            if self.finished {
+                return None;
+            }
+            match self.chunks.try_recv() {
+                Ok(chunk) => {
+                    let mut spent = std::mem::replace(&mut self.current, chunk);
+                    spent.clear();
+                    let _ = self.recycle.try_send(spent);
+                    self.position = 0;
+                    self.starved = false;
+                }
+                Err(TryRecvError::Empty) => {
+                    // Chunks hold whole frames, so a whole frame of silence
+                    // keeps the channels aligned.
+                    if !self.starved {
+                        self.starved = true;
+                        self.counters.underruns.fetch_add(1, Ordering::Relaxed);
+                    }
+                    self.silence = self.channels;
+                }
+                Err(TryRecvError::Disconnected) => self.finished = true,
+            }
+        }
+    }
+}
+
+/// Fills `chunk` up to `len` samples.  Returns `true` if `source` ran out.
+fn fill_chunk(source: &mut impl Iterator<Item = f32>, chunk: &mut Vec<f32>, len: usize) -> bool {
+    while chunk.len() < len {
+        match source.next() {
+            Some(sample) => chunk.push(sample),
+            None => return true,
+        }
+    }
+    false
+}
+
+/// Starts decoding `first` on a background thread and returns its reader.
+///
+/// The first chunk is decoded before returning so playback does not start
+/// on an underrun.  With `looping`, `reopen` is called each time the source
+/// runs out; the stream ends when it fails or yields no samples.
+///
+/// # Errors
+///
+/// Returns `InvalidState` if `channels` is 0 and `InternalError` if the
+/// decoder thread cannot be spawned.
+pub fn spawn_stream<I, F>(
+    mut first: I,
+    mut reopen: F,
+    looping: bool,
+    channels: u16,
+    counters: Arc<AudioStreamCounters>,
+) -> GoudResult<StreamReader>
+where
+    I: Iterator<Item = f32> + Send + 'static,
+    F: FnMut() -> GoudResult<I> + Send + 'static,
+{
+    let channels = usize::from(channels);
+    if channels == 0 {
+        return Err(GoudError::InvalidState(
+            "Audio stream has no channels".to_string(),
+        ));
+    }
+    let chunk_len = STREAM_CHUNK_SAMPLES - STREAM_CHUNK_SAMPLES % channels;
+
+    let mut current = Vec::with_capacity(chunk_len);
+    let mut exhausted = fill_chunk(&mut first, &mut current, chunk_len);
+    let prefilled_empty = current.is_empty();
+    let (chunk_tx, chunk_rx) = bounded(STREAM_QUEUE_CHUNKS);
+    // Room for every buffer, so handing one back never drops it.
+    let (recycle_tx, recycle_rx) = bounded::<Vec<f32>>(STREAM_BUFFER_CHUNKS);
+
+    counters.active.fetch_add(1, Ordering::Relaxed);
+    let thread_counters = Arc::clone(&counters);
+    let decoder = move || {
+        let mut source = first;
+        // Whether the current source yielded anything; an empty source
+        // would otherwise be reopened forever.
+        let mut produced = !prefilled_empty;
+        // Counts the prefilled chunk the reader starts on.
+        let mut allocated = 1;
+        loop {
+            if exhausted {
+                if !looping || !produced {
+                    break;
+                }
+                match reopen() {
+                    Ok(next) => source = next,
+                    Err(_) => break,
+                }
+                produced = false;
+            }
+            let mut chunk = match recycle_rx.try_recv() {
+                Ok(chunk) => chunk,
+                Err(_) if allocated < STREAM_BUFFER_CHUNKS => {
+                    allocated += 1;
+                    Vec::with_capacity(chunk_len)
+                }
+                // Every buffer is queued or playing, so the queue is not
+                // full and the reader hands one back as it plays on.
+                Err(_) => match recycle_rx.recv() {
+                    Ok(chunk) => chunk,
+                    Err(_) => break,
+                },
+            };
+            exhausted = fill_chunk(&mut source, &mut chunk, chunk_len);
+            produced |= !chunk.is_empty();
+            if !chunk.is_empty() && chunk_tx.send(chunk).is_err() {
+                break;
+            }
+        }
+        thread_counters.active.fetch_sub(1, Ordering::Relaxed);
+    };
+    if let Err(e) = thread::Builder::new()
+        .name("goud-audio-stream".to_string())
+        .spawn(decoder)
+    {
+        counters.active.fetch_sub(1, Ordering::Relaxed);
+        return Err(GoudError::InternalError(format!(
+            "Failed to spawn audio stream decoder: {}",
+            e
+        )));
+    }
+
+    Ok(StreamReader {
+        chunks: chunk_rx,
+        recycle: recycle_tx,
+        current,
+        position: 0,
+        channels,
+        silence: 0,
+        starved: false,
+        finished: false,
+        counters,
+    })
+}
+
+#[cfg(test)]
+#[path = "audio_stream_tests.rs"]
+mod tests;
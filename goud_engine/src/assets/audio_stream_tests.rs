@@ -0,0 +1,152 @@
+use std::sync::atomic::AtomicUsize;
+use std::time::{Duration, Instant};
+
+use super::*;
+
+type Samples = std::vec::IntoIter<f32>;
+
+fn ramp(len: usize) -> Samples {
+    (0..len).map(|i| i as f32).collect::<Vec<_>>().into_iter()
+}
+
+fn no_reopen() -> GoudResult<Samples> {
+    Err(GoudError::ResourceLoadFailed("not looping".to_string()))
+}
+
+/// Pulls samples like the audio thread, waiting out underruns, until the
+/// stream ends or `limit` samples arrived.
+fn drain(reader: &mut StreamReader, limit: usize) -> Vec<f32> {
+    let deadline = Instant::now() + Duration::from_secs(5);
+    let mut samples = Vec::new();
+    while samples.len() < limit && Instant::now() < deadline {
+        let underruns = reader.counters.underruns.load(Ordering::Relaxed);
+        match reader.next() {
+            Some(sample) if reader.counters.underruns.load(Ordering::Relaxed) == underruns => {
+                samples.push(sample);
+            }
+            Some(_) => {
+                // Silence: skip the rest of the frame and let the decoder catch up.
+                for _ in 1..reader.channels {
+                    reader.next();
+                }
+                reader.starved = false;
+                thread::sleep(Duration::from_millis(1));
+            }
+            None => break,
+        }
+    }
+    samples
+}
+
+fn wait_for_idle(counters: &AudioStreamCounters) {
+    let deadline = Instant::now() + Duration::from_secs(5);
+    while counters.stats().active_streams > 0 && Instant::now() < deadline {
+        thread::sleep(Duration::from_millis(1));
+    }
+}
+
+#[test]
+fn test_stream_yields_every_sample_in_order() {
+    let counters = Arc::new(AudioStreamCounters::default());
+    let len = STREAM_CHUNK_SAMPLES * STREAM_QUEUE_CHUNKS * 3 + 17;
+    let mut reader = spawn_stream(ramp(len), no_reopen, false, 1, Arc::clone(&counters)).unwrap();
+
+    let samples = drain(&mut reader, usize::MAX);
+    assert_eq!(samples, ramp(len).collect::<Vec<_>>());
+    wait_for_idle(&counters);
+    assert_eq!(counters.stats().active_streams, 0);
+}
+
+#[test]
+fn test_stream_reuses_a_bounded_set_of_chunk_buffers() {
+    let counters = Arc::new(AudioStreamCounters::default());
+    let len = STREAM_CHUNK_SAMPLES * STREAM_BUFFER_CHUNKS * 4;
+    let mut reader = spawn_stream(ramp(len), no_reopen, false, 1, Arc::clone(&counters)).unwrap();
+
+    let mut buffers = std::collections::HashSet::new();
+    let mut received = 0;
+    while received < len {
+        if reader.next().is_none() {
+            break;
+        }
+        received += 1;
+        buffers.insert(reader.current.as_ptr() as usize);
+    }
+    assert_eq!(received, len);
+    assert!(buffers.len() <= STREAM_BUFFER_CHUNKS);
+}
+
+#[test]
+fn test_first_chunk_is_decoded_before_returning() {
+    let counters = Arc::new(AudioStreamCounters::default());
+    let mut reader = spawn_stream(ramp(8), no_reopen, false, 2, Arc::clone(&counters)).unwrap();
+    assert_eq!(reader.next(), Some(0.0));
+    assert_eq!(counters.stats().underruns, 0);
+}
+
+#[test]
+fn test_looping_reopens_until_reader_is_dropped() {
+    let counters = Arc::new(AudioStreamCounters::default());
+    let reopens = Arc::new(AtomicUsize::new(0));
+    let reopen_count = Arc::clone(&reopens);
+    let reopen = move || {
+        reopen_count.fetch_add(1, Ordering::Relaxed);
+        Ok(ramp(10))
+    };
+    let mut reader = spawn_stream(ramp(10), reopen, true, 2, Arc::clone(&counters)).unwrap();
+
+    let samples = drain(&mut reader, 35);
+    assert_eq!(&samples[..10], &samples[10..20]);
+    assert_eq!(samples[30], 0.0);
+    assert!(reopens.load(Ordering::Relaxed) >= 3);
+    assert_eq!(counters.stats().active_streams, 1);
+    assert_eq!(counters.stats().buffer_bytes, STREAM_BUFFER_BYTES);
+
+    drop(reader);
+    wait_for_idle(&counters);
+    assert_eq!(counters.stats().active_streams, 0);
+}
+
+#[test]
+fn test_looping_empty_source_ends() {
+    let counters = Arc::new(AudioStreamCounters::default());
+    let mut reader = spawn_stream(ramp(0), || Ok(ramp(0)), true, 1, Arc::clone(&counters)).unwrap();
+    assert!(drain(&mut reader, usize::MAX).is_empty());
+}
+
+#[test]
+fn test_underrun_plays_a_frame_of_silence() {
+    let counters = Arc::new(AudioStreamCounters::default());
+    let (chunk_tx, chunks) = bounded(1);
+    let (recycle, _recycled) = bounded(1);
+    let mut reader = StreamReader {
+        chunks,
+        recycle,
+        current: vec![0.5, 0.5],
+        position: 0,
+        channels: 2,
+        silence: 0,
+        starved: false,
+        finished: false,
+        counters: Arc::clone(&counters),
+    };
+
+    assert_eq!(reader.by_ref().take(2).collect::<Vec<_>>(), vec![0.5, 0.5]);
+    assert_eq!(reader.by_ref().take(4).collect::<Vec<_>>(), vec![0.0; 4]);
+    assert_eq!(counters.stats().underruns, 1);
+
+    chunk_tx.send(vec![0.25, 0.75]).unwrap();
+    drop(chunk_tx);
+    assert_eq!(
+        reader.by_ref().take(3).collect::<Vec<_>>(),
+        vec![0.25, 0.75]
+    );
+    assert_eq!(counters.stats().underruns, 1);
+}
+
+#[test]
+fn test_zero_channels_is_rejected() {
+    let counters = Arc::new(AudioStreamCounters::default());
+    assert!(spawn_stream(ramp(4), no_reopen, false, 0, Arc::clone(&counters)).is_err());
+    assert_eq!(counters.stats(), AudioStreamStats::default());
+}
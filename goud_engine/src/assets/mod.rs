@@ -70,10 +70,12 @@
 //! ```
 
 mod asset;
+pub mod audio_clip_cache;
 #[cfg(feature = "desktop-native")]
 mod audio_manager;
 #[cfg(not(feature = "desktop-native"))]
 mod audio_manager_stub;
+pub mod audio_stream;
 pub mod dependency;
 pub mod fallback;
 mod handle;
@@ -82,6 +84,7 @@ mod hot_reload;
 mod loader;
 pub mod packager;
 mod server;
+pub mod spatial_audio;
 mod storage;
 pub mod vfs;
 #[cfg(feature = "web")]
@@ -115,14 +118,17 @@ pub use storage::{AnyAssetStorage, AssetEntry, AssetStorage, TypedAssetStorage};
 #[cfg(feature = "desktop-native")]
 pub use hot_reload::{AssetChangeEvent, HotReloadConfig, HotReloadWatcher};
 
-// Re-export audio manager
+// Re-export audio manager, its clip cache, stream counters, and spatial updates
+pub use audio_clip_cache::{AudioClipCache, AudioClipCacheStats, DecodedClip};
 #[cfg(feature = "desktop-native")]
 pub use audio_manager::AudioManager;
 #[cfg(not(feature = "desktop-native"))]
 pub use audio_manager_stub::AudioManager;
+pub use audio_stream::AudioStreamStats;
+pub use spatial_audio::SpatialSourceUpdate;
 
 // Re-export virtual filesystem types
-pub use vfs::{ArchiveFs, OsFs, VirtualFs};
+pub use vfs::{ArchiveFs, AssetPack, OsFs, VirtualFs};
 
 // Re-export web fetch
 #[cfg(feature = "web")]
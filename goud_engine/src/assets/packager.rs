@@ -1,9 +1,30 @@
 //! Asset directory packager for creating distribution archives.
 
-use crate::assets::vfs::archive_format::ArchiveWriter;
+use crate::assets::vfs::archive_format::{ArchiveWriter, DEFAULT_ENTRY_ALIGNMENT};
 use crate::assets::AssetLoadError;
 use std::path::Path;
 
+/// Options controlling how [`package_directory_with`] lays out an archive.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct PackOptions {
+    /// Byte alignment of each entry's data, rounded up to a power of two.
+    /// Page-size alignment (4096) lets mapped entries be handed to APIs that
+    /// require page-aligned buffers.
+    pub alignment: u32,
+    /// LZ4-compress entries that get smaller by doing so. Compressed entries
+    /// cannot be read in place from an [`AssetPack`](crate::assets::AssetPack).
+    pub compress: bool,
+}
+
+impl Default for PackOptions {
+    fn default() -> Self {
+        Self {
+            alignment: DEFAULT_ENTRY_ALIGNMENT,
+            compress: false,
+        }
+    }
+}
+
 /// Packages all files in a directory into a GOUD archive file.
 ///
 /// Walks `input_dir` recursively, adding every file to the archive.
@@ -23,8 +44,30 @@ use std::path::Path;
 /// packager::package_directory(Path::new("assets"), Path::new("game.goud")).unwrap();
 /// ```
 pub fn package_directory(input_dir: &Path, output_path: &Path) -> Result<(), AssetLoadError> {
+    package_directory_with(input_dir, output_path, &PackOptions::default())
+}
+
+/// Packages a directory like [`package_directory`], with explicit layout
+/// options.
+///
+/// # Example
+///
+/// ```no_run
+/// use std::path::Path;
+/// use goud_engine::assets::packager::{self, PackOptions};
+///
+/// let options = PackOptions { alignment: 4096, compress: true };
+/// packager::package_directory_with(Path::new("assets"), Path::new("game.goud"), &options)
+///     .unwrap();
+/// ```
+pub fn package_directory_with(
+    input_dir: &Path,
+    output_path: &Path,
+    options: &PackOptions,
+) -> Result<(), AssetLoadError> {
     let mut writer = ArchiveWriter::new();
-    collect_files(input_dir, input_dir, &mut writer)?;
+    writer.set_alignment(options.alignment);
+    collect_files(input_dir, input_dir, options.compress, &mut writer)?;
 
     let mut file =
         std::fs::File::create(output_path).map_err(|e| AssetLoadError::io_error(output_path, e))?;
@@ -34,6 +77,7 @@ pub fn package_directory(input_dir: &Path, output_path: &Path) -> Result<(), Ass
 fn collect_files(
     base: &Path,
     dir: &Path,
+    compress: bool,
     writer: &mut ArchiveWriter,
 ) -> Result<(), AssetLoadError> {
     let entries = std::fs::read_dir(dir).map_err(|e| AssetLoadError::io_error(dir, e))?;
@@ -56,7 +100,7 @@ fn collect_files(
     for entry in sorted_entries {
         let path = entry.path();
         if path.is_dir() {
-            collect_files(base, &path, writer)?;
+            collect_files(base, &path, compress, writer)?;
         } else if path.is_file() {
             let relative = path
                 .strip_prefix(base)
@@ -64,7 +108,11 @@ fn collect_files(
             // Normalize to forward slashes
             let key = relative.to_string_lossy().replace('\\', "/");
             let data = std::fs::read(&path).map_err(|e| AssetLoadError::io_error(&path, e))?;
-            writer.add_file(&key, &data);
+            if compress {
+                writer.add_file_compressed(&key, &data);
+            } else {
+                writer.add_file(&key, &data);
+            }
         }
     }
     Ok(())
@@ -0,0 +1,21 @@
+//! Per-frame spatial audio updates applied in one batch.
+//!
+//! Games with many emitters used to move each one with a separate
+//! `set_source_position` call, and every call re-attenuated every tracked
+//! source.  A [`SpatialSourceUpdate`] slice is applied by
+//! `AudioManager::update_spatial_sources()` in a single pass instead.
+
+/// New position and attenuation settings for one spatial sink.
+#[derive(Debug, Clone, Copy, PartialEq)]
+pub struct SpatialSourceUpdate {
+    /// Player ID of the sink.
+    pub sink_id: u64,
+    /// Source position in world space.
+    pub source_position: [f32; 3],
+    /// Distance at which the source is silent (clamped to at least 0.1).
+    pub max_distance: f32,
+    /// Attenuation curve exponent (clamped to at least 0.01).
+    pub rolloff: f32,
+    /// Volume before attenuation (0.0-1.0, clamped).
+    pub base_volume: f32,
+}
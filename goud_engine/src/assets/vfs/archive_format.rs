@@ -5,36 +5,102 @@
 //! ```text
 //! [MAGIC: 4 bytes "GOUD"]
 //! [TOC_SIZE: u32 LE]
-//! [TOC bytes (entry_count + entries)]
-//! [file data concatenated]
+//! [TOC bytes (version + entry_count + entries), zero-padded]
+//! [file data, each entry starting on an aligned offset]
 //! ```
 //!
-//! TOC entry format:
+//! TOC entry format (version 2):
 //! ```text
-//! [path_len: u32 LE][path bytes][offset: u64 LE][size: u64 LE][crc32: u32 LE]
+//! [path_len: u32 LE][path bytes][name_hash: u64 LE][offset: u64 LE]
+//! [stored_size: u64 LE][size: u64 LE][crc32: u32 LE][compression: u32 LE]
 //! ```
+//!
+//! The TOC is padded so the data section, and with it every entry, starts
+//! on a multiple of the archive's alignment. A memory-mapped archive can
+//! therefore hand out entry bytes in place. Version 1 archives (no hash,
+//! compression, or alignment) are still readable.
 
 use crate::assets::AssetLoadError;
+use rustc_hash::FxHashMap;
+use std::borrow::Cow;
 use std::collections::HashMap;
 use std::io::Write;
 
+use super::archive_toc::{deserialize_toc, serialize_toc, write_all};
+use super::lz4;
+
 /// Magic bytes identifying a GOUD archive.
 pub const ARCHIVE_MAGIC: [u8; 4] = *b"GOUD";
 
 /// Current archive format version.
-pub const ARCHIVE_VERSION: u32 = 1;
+pub const ARCHIVE_VERSION: u32 = 2;
+
+/// Entry alignment used unless [`ArchiveWriter::set_alignment`] is called.
+pub const DEFAULT_ENTRY_ALIGNMENT: u32 = 16;
+
+/// Returns the 64-bit FNV-1a hash that identifies `path` in an archive.
+///
+/// `const`, so lookups by hash can be computed at compile time:
+///
+/// ```
+/// use goud_engine::assets::vfs::archive_format::name_hash;
+///
+/// const PLAYER: u64 = name_hash("sprites/player.png");
+/// assert_eq!(PLAYER, name_hash("sprites/player.png"));
+/// ```
+pub const fn name_hash(path: &str) -> u64 {
+    name_hash_bytes(path.as_bytes())
+}
+
+/// [`name_hash`] over raw bytes, for names that arrive as byte slices.
+pub const fn name_hash_bytes(bytes: &[u8]) -> u64 {
+    let mut hash: u64 = 0xcbf2_9ce4_8422_2325;
+    let mut i = 0;
+    while i < bytes.len() {
+        hash ^= bytes[i] as u64;
+        hash = hash.wrapping_mul(0x0000_0100_0000_01b3);
+        i += 1;
+    }
+    hash
+}
+
+/// How an entry's bytes are stored.
+#[repr(u32)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum ArchiveCompression {
+    /// Stored as-is; readable in place.
+    None = 0,
+    /// LZ4 block format; decompressed on read.
+    Lz4 = 1,
+}
+
+impl ArchiveCompression {
+    pub(super) fn from_u32(value: u32) -> Option<Self> {
+        match value {
+            0 => Some(Self::None),
+            1 => Some(Self::Lz4),
+            _ => None,
+        }
+    }
+}
 
 /// A single entry in the archive table of contents.
 #[derive(Debug, Clone)]
 pub struct ArchiveEntry {
     /// Relative path of the asset (forward slashes).
     pub path: String,
+    /// [`name_hash`] of `path`.
+    pub name_hash: u64,
     /// Byte offset from the start of the data section.
     pub offset: u64,
-    /// Size of the asset data in bytes.
+    /// Bytes the entry occupies in the archive.
+    pub stored_size: u64,
+    /// Size of the asset data in bytes, after decompression.
     pub size: u64,
     /// CRC32 checksum (reserved, currently 0).
     pub crc32: u32,
+    /// How the entry is stored.
+    pub compression: ArchiveCompression,
 }
 
 /// Table of contents for an archive.
@@ -50,65 +116,139 @@ pub struct ArchiveToc {
 // ArchiveWriter
 // ============================================================================
 
+#[derive(Debug)]
+struct PendingFile {
+    path: String,
+    stored: Vec<u8>,
+    size: u64,
+    compression: ArchiveCompression,
+}
+
 /// Builds an archive from in-memory file data.
 ///
-/// Files are added with [`add_file`](Self::add_file) and the archive is
+/// Files are added with [`add_file`](Self::add_file) or
+/// [`add_file_compressed`](Self::add_file_compressed) and the archive is
 /// written to any [`Write`] target via [`write_to`](Self::write_to).
 ///
 /// Entries are sorted by path for reproducible output.
 #[derive(Debug)]
 pub struct ArchiveWriter {
-    files: Vec<(String, Vec<u8>)>,
+    files: Vec<PendingFile>,
+    alignment: u64,
 }
 
 impl ArchiveWriter {
     /// Creates an empty archive writer.
     pub fn new() -> Self {
-        Self { files: Vec::new() }
+        Self {
+            files: Vec::new(),
+            alignment: DEFAULT_ENTRY_ALIGNMENT as u64,
+        }
+    }
+
+    /// Sets the byte alignment of every entry.
+    ///
+    /// Use the GPU's upload alignment or the page size when entries are
+    /// handed to APIs that need it. Values that are not a power of two are
+    /// rounded up to one.
+    pub fn set_alignment(&mut self, alignment: u32) {
+        self.alignment = alignment.max(1).next_power_of_two() as u64;
     }
 
-    /// Adds a file to the archive.
+    /// Adds a file to the archive, stored uncompressed.
     ///
     /// The `path` should use forward slashes and be relative to the asset root.
     /// Adding the same path twice is allowed but only the last entry will be
     /// accessible via `ArchiveReader::read_entry`.
     pub fn add_file(&mut self, path: &str, data: &[u8]) {
-        self.files.push((path.to_string(), data.to_vec()));
+        self.files.push(PendingFile {
+            path: path.to_string(),
+            stored: data.to_vec(),
+            size: data.len() as u64,
+            compression: ArchiveCompression::None,
+        });
+    }
+
+    /// Adds a file to the archive, LZ4-compressed if that makes it smaller.
+    ///
+    /// Already-compressed formats (PNG, OGG, ...) rarely shrink and are kept
+    /// uncompressed so they can still be read in place.
+    pub fn add_file_compressed(&mut self, path: &str, data: &[u8]) {
+        let packed = lz4::compress(data);
+        if packed.len() >= data.len() {
+            self.add_file(path, data);
+            return;
+        }
+        self.files.push(PendingFile {
+            path: path.to_string(),
+            stored: packed,
+            size: data.len() as u64,
+            compression: ArchiveCompression::Lz4,
+        });
     }
 
     /// Writes the archive to the given writer.
     ///
     /// Entries are sorted by path for reproducibility.
+    ///
+    /// # Errors
+    ///
+    /// Fails if two different paths have the same [`name_hash`], since
+    /// hashed lookups could not tell them apart.
     pub fn write_to(&self, writer: &mut impl Write) -> Result<(), AssetLoadError> {
         let mut sorted: Vec<_> = self.files.iter().collect();
-        sorted.sort_by(|a, b| a.0.cmp(&b.0));
+        sorted.sort_by(|a, b| a.path.cmp(&b.path));
+
+        let mut hashes: HashMap<u64, &str> = HashMap::with_capacity(sorted.len());
+        for file in &sorted {
+            let hash = name_hash(&file.path);
+            if let Some(other) = hashes.insert(hash, &file.path) {
+                if other != file.path {
+                    return Err(AssetLoadError::custom(format!(
+                        "Archive paths '{}' and '{}' have the same name hash",
+                        other, file.path
+                    )));
+                }
+            }
+        }
 
         // Compute offsets: each file's offset is relative to the data section start.
         let mut entries = Vec::with_capacity(sorted.len());
         let mut current_offset: u64 = 0;
-        for (path, data) in &sorted {
+        for file in &sorted {
+            current_offset = align_up(current_offset, self.alignment);
             entries.push(ArchiveEntry {
-                path: path.clone(),
+                path: file.path.clone(),
+                name_hash: name_hash(&file.path),
                 offset: current_offset,
-                size: data.len() as u64,
+                stored_size: file.stored.len() as u64,
+                size: file.size,
                 crc32: 0,
+                compression: file.compression,
             });
-            current_offset += data.len() as u64;
+            current_offset += file.stored.len() as u64;
         }
 
-        // Serialize the TOC to a buffer.
-        let toc_bytes = serialize_toc(&ArchiveToc {
+        // Serialize the TOC, padded so the data section starts aligned.
+        let mut toc_bytes = serialize_toc(&ArchiveToc {
             version: ARCHIVE_VERSION,
             entries,
         })?;
+        let data_start = align_up(8 + toc_bytes.len() as u64, self.alignment);
+        toc_bytes.resize(data_start as usize - 8, 0);
 
         // Write header: MAGIC + TOC_SIZE + TOC + data.
         write_all(writer, &ARCHIVE_MAGIC)?;
         write_all(writer, &(toc_bytes.len() as u32).to_le_bytes())?;
         write_all(writer, &toc_bytes)?;
 
-        for (_, data) in &sorted {
-            write_all(writer, data)?;
+        let mut written: u64 = 0;
+        let padding = vec![0u8; self.alignment as usize];
+        for file in &sorted {
+            let pad = align_up(written, self.alignment) - written;
+            write_all(writer, &padding[..pad as usize])?;
+            write_all(writer, &file.stored)?;
+            written += pad + file.stored.len() as u64;
         }
 
         Ok(())
@@ -121,6 +261,10 @@ impl Default for ArchiveWriter {
     }
 }
 
+fn align_up(value: u64, alignment: u64) -> u64 {
+    value.div_ceil(alignment) * alignment
+}
+
 // ============================================================================
 // ArchiveReader
 // ============================================================================
@@ -128,7 +272,8 @@ impl Default for ArchiveWriter {
 /// Reads assets from an in-memory archive.
 ///
 /// The reader borrows the archive bytes and provides zero-copy access to
-/// individual entries via [`read_entry`](Self::read_entry).
+/// uncompressed entries via [`read_entry`](Self::read_entry), by path, or
+/// [`read_hashed`](Self::read_hashed), by [`name_hash`].
 #[derive(Debug)]
 pub struct ArchiveReader {
     toc: ArchiveToc,
@@ -136,6 +281,8 @@ pub struct ArchiveReader {
     data_start: usize,
     /// Lookup table for fast path-based access.
     index: HashMap<String, usize>,
+    /// Lookup table for name-hash access.
+    hash_index: FxHashMap<u64, usize>,
 }
 
 impl ArchiveReader {
@@ -172,42 +319,97 @@ impl ArchiveReader {
 
         let toc = deserialize_toc(&data[8..toc_end])?;
 
-        if toc.version != ARCHIVE_VERSION {
-            return Err(AssetLoadError::decode_failed(format!(
-                "Archive version {} not supported; expected {}",
-                toc.version, ARCHIVE_VERSION
-            )));
-        }
-
-        // Build index for O(1) lookups.
+        // Build indices for O(1) lookups.
         let mut index = HashMap::with_capacity(toc.entries.len());
+        let mut hash_index = FxHashMap::default();
+        hash_index.reserve(toc.entries.len());
         for (i, entry) in toc.entries.iter().enumerate() {
             index.insert(entry.path.clone(), i);
+            if let Some(other) = hash_index.insert(entry.name_hash, i) {
+                let other = &toc.entries[other].path;
+                if *other != entry.path {
+                    return Err(AssetLoadError::decode_failed(format!(
+                        "Archive paths '{}' and '{}' have the same name hash",
+                        other, entry.path
+                    )));
+                }
+            }
         }
 
         Ok(Self {
             toc,
             data_start: toc_end,
             index,
+            hash_index,
         })
     }
 
     /// Reads the data for the entry at `path` from the source buffer.
-    pub fn read_entry<'a>(&self, path: &str, source: &'a [u8]) -> Result<&'a [u8], AssetLoadError> {
-        let idx = self
-            .index
-            .get(path)
+    ///
+    /// Uncompressed entries are borrowed from `source`; compressed ones are
+    /// decompressed into a new buffer.
+    pub fn read_entry<'a>(
+        &self,
+        path: &str,
+        source: &'a [u8],
+    ) -> Result<Cow<'a, [u8]>, AssetLoadError> {
+        let entry = self
+            .entry(path)
             .ok_or_else(|| AssetLoadError::not_found(path))?;
-        let entry = &self.toc.entries[*idx];
-        let start = self.data_start + entry.offset as usize;
-        let end = start + entry.size as usize;
-        if end > source.len() {
-            return Err(AssetLoadError::decode_failed(format!(
+        self.decode(entry, source)
+    }
+
+    /// Reads the data for the entry whose path hashes to `hash`.
+    pub fn read_hashed<'a>(
+        &self,
+        hash: u64,
+        source: &'a [u8],
+    ) -> Result<Cow<'a, [u8]>, AssetLoadError> {
+        let entry = self
+            .entry_by_hash(hash)
+            .ok_or_else(|| AssetLoadError::not_found(format!("#{hash:016x}")))?;
+        self.decode(entry, source)
+    }
+
+    /// Returns the bytes `entry` occupies in `source`, still compressed if
+    /// the entry is.
+    pub fn stored_bytes<'a>(
+        &self,
+        entry: &ArchiveEntry,
+        source: &'a [u8],
+    ) -> Result<&'a [u8], AssetLoadError> {
+        let start = (self.data_start as u64).checked_add(entry.offset);
+        let end = start.and_then(|start| start.checked_add(entry.stored_size));
+        match (start, end) {
+            (Some(start), Some(end)) if end <= source.len() as u64 => {
+                Ok(&source[start as usize..end as usize])
+            }
+            _ => Err(AssetLoadError::decode_failed(format!(
                 "Archive entry '{}' extends past end of data",
-                path
-            )));
+                entry.path
+            ))),
+        }
+    }
+
+    /// Returns the decompressed bytes of `entry`.
+    pub fn decode<'a>(
+        &self,
+        entry: &ArchiveEntry,
+        source: &'a [u8],
+    ) -> Result<Cow<'a, [u8]>, AssetLoadError> {
+        let stored = self.stored_bytes(entry, source)?;
+        match entry.compression {
+            ArchiveCompression::None => Ok(Cow::Borrowed(stored)),
+            ArchiveCompression::Lz4 => {
+                let size = usize::try_from(entry.size).map_err(|_| {
+                    AssetLoadError::decode_failed(format!(
+                        "Archive entry '{}' is too large for this platform",
+                        entry.path
+                    ))
+                })?;
+                lz4::decompress(stored, size).map(Cow::Owned)
+            }
         }
-        Ok(&source[start..end])
     }
 
     /// Returns all entries in the TOC.
@@ -215,97 +417,40 @@ impl ArchiveReader {
         &self.toc.entries
     }
 
-    /// Returns `true` if the archive contains an entry at the given path.
-    pub fn entry_exists(&self, path: &str) -> bool {
-        self.index.contains_key(path)
+    /// Returns the entry at `path`, if any.
+    pub fn entry(&self, path: &str) -> Option<&ArchiveEntry> {
+        self.index.get(path).map(|&i| &self.toc.entries[i])
     }
-}
-
-// ============================================================================
-// Binary serialization helpers (no external deps)
-// ============================================================================
 
-fn serialize_toc(toc: &ArchiveToc) -> Result<Vec<u8>, AssetLoadError> {
-    let mut buf = Vec::new();
-    write_all(&mut buf, &toc.version.to_le_bytes())?;
-    write_all(&mut buf, &(toc.entries.len() as u32).to_le_bytes())?;
-    for entry in &toc.entries {
-        let path_bytes = entry.path.as_bytes();
-        write_all(&mut buf, &(path_bytes.len() as u32).to_le_bytes())?;
-        write_all(&mut buf, path_bytes)?;
-        write_all(&mut buf, &entry.offset.to_le_bytes())?;
-        write_all(&mut buf, &entry.size.to_le_bytes())?;
-        write_all(&mut buf, &entry.crc32.to_le_bytes())?;
+    /// Returns the entry whose path hashes to `hash`, if any.
+    pub fn entry_by_hash(&self, hash: u64) -> Option<&ArchiveEntry> {
+        self.hash_index.get(&hash).map(|&i| &self.toc.entries[i])
     }
-    Ok(buf)
-}
-
-fn deserialize_toc(data: &[u8]) -> Result<ArchiveToc, AssetLoadError> {
-    let mut cursor = 0;
-
-    let version = read_u32(data, &mut cursor)?;
-    let entry_count = read_u32(data, &mut cursor)?;
 
-    let mut entries = Vec::with_capacity(entry_count as usize);
-    for _ in 0..entry_count {
-        let path_len = read_u32(data, &mut cursor)? as usize;
-        if cursor + path_len > data.len() {
-            return Err(AssetLoadError::decode_failed("TOC truncated: path data"));
-        }
-        let path = std::str::from_utf8(&data[cursor..cursor + path_len])
-            .map_err(|e| AssetLoadError::decode_failed(format!("Invalid UTF-8 in path: {e}")))?
-            .to_string();
-        cursor += path_len;
-
-        let offset = read_u64(data, &mut cursor)?;
-        let size = read_u64(data, &mut cursor)?;
-        let crc32 = read_u32(data, &mut cursor)?;
-
-        entries.push(ArchiveEntry {
-            path,
-            offset,
-            size,
-            crc32,
-        });
-    }
-
-    Ok(ArchiveToc { version, entries })
-}
-
-fn read_u32(data: &[u8], cursor: &mut usize) -> Result<u32, AssetLoadError> {
-    if *cursor + 4 > data.len() {
-        return Err(AssetLoadError::decode_failed(
-            "Unexpected end of data reading u32",
-        ));
+    /// Returns `true` if the archive contains an entry at the given path.
+    pub fn entry_exists(&self, path: &str) -> bool {
+        self.index.contains_key(path)
     }
-    let val = u32::from_le_bytes(
-        data[*cursor..*cursor + 4]
-            .try_into()
-            .map_err(|_| AssetLoadError::decode_failed("Invalid u32 slice"))?,
-    );
-    *cursor += 4;
-    Ok(val)
-}
 
-fn read_u64(data: &[u8], cursor: &mut usize) -> Result<u64, AssetLoadError> {
-    if *cursor + 8 > data.len() {
-        return Err(AssetLoadError::decode_failed(
-            "Unexpected end of data reading u64",
-        ));
+    /// Lists the paths of all entries under `directory`, recursively and
+    /// sorted. An empty `directory` lists everything.
+    pub fn list(&self, directory: &str) -> Vec<String> {
+        let prefix = if directory.is_empty() || directory.ends_with('/') {
+            directory.to_string()
+        } else {
+            format!("{directory}/")
+        };
+
+        let mut result: Vec<String> = self
+            .toc
+            .entries
+            .iter()
+            .filter(|e| e.path.starts_with(&prefix))
+            .map(|e| e.path.clone())
+            .collect();
+        result.sort();
+        result
     }
-    let val = u64::from_le_bytes(
-        data[*cursor..*cursor + 8]
-            .try_into()
-            .map_err(|_| AssetLoadError::decode_failed("Invalid u64 slice"))?,
-    );
-    *cursor += 8;
-    Ok(val)
-}
-
-fn write_all(writer: &mut impl Write, data: &[u8]) -> Result<(), AssetLoadError> {
-    writer
-        .write_all(data)
-        .map_err(|e| AssetLoadError::custom(format!("Write failed: {e}")))
 }
 
 // ============================================================================
@@ -313,117 +458,5 @@ fn write_all(writer: &mut impl Write, data: &[u8]) -> Result<(), AssetLoadError>
 // ============================================================================
 
 #[cfg(test)]
-mod tests {
-    use super::*;
-
-    #[test]
-    fn round_trip_single_file() {
-        let mut writer = ArchiveWriter::new();
-        writer.add_file("hello.txt", b"Hello, world!");
-
-        let mut buf = Vec::new();
-        writer.write_to(&mut buf).unwrap();
-
-        let reader = ArchiveReader::from_bytes(&buf).unwrap();
-        assert!(reader.entry_exists("hello.txt"));
-        assert!(!reader.entry_exists("missing.txt"));
-
-        let data = reader.read_entry("hello.txt", &buf).unwrap();
-        assert_eq!(data, b"Hello, world!");
-    }
-
-    #[test]
-    fn round_trip_multiple_files() {
-        let mut writer = ArchiveWriter::new();
-        writer.add_file("b.txt", b"BBB");
-        writer.add_file("a.txt", b"AAA");
-        writer.add_file("c/nested.bin", &[1, 2, 3, 4]);
-
-        let mut buf = Vec::new();
-        writer.write_to(&mut buf).unwrap();
-
-        let reader = ArchiveReader::from_bytes(&buf).unwrap();
-        assert_eq!(reader.entries().len(), 3);
-
-        // Verify sorted order.
-        assert_eq!(reader.entries()[0].path, "a.txt");
-        assert_eq!(reader.entries()[1].path, "b.txt");
-        assert_eq!(reader.entries()[2].path, "c/nested.bin");
-
-        assert_eq!(reader.read_entry("a.txt", &buf).unwrap(), b"AAA");
-        assert_eq!(reader.read_entry("b.txt", &buf).unwrap(), b"BBB");
-        assert_eq!(
-            reader.read_entry("c/nested.bin", &buf).unwrap(),
-            &[1, 2, 3, 4]
-        );
-    }
-
-    #[test]
-    fn round_trip_empty_archive() {
-        let writer = ArchiveWriter::new();
-        let mut buf = Vec::new();
-        writer.write_to(&mut buf).unwrap();
-
-        let reader = ArchiveReader::from_bytes(&buf).unwrap();
-        assert_eq!(reader.entries().len(), 0);
-        assert!(!reader.entry_exists("anything"));
-    }
-
-    #[test]
-    fn invalid_magic_returns_error() {
-        let data = b"BAAD\x00\x00\x00\x00";
-        let err = ArchiveReader::from_bytes(data).unwrap_err();
-        assert!(err.is_decode_failed());
-    }
-
-    #[test]
-    fn truncated_header_returns_error() {
-        let err = ArchiveReader::from_bytes(b"GOU").unwrap_err();
-        assert!(err.is_decode_failed());
-    }
-
-    #[test]
-    fn missing_entry_returns_not_found() {
-        let writer = ArchiveWriter::new();
-        let mut buf = Vec::new();
-        writer.write_to(&mut buf).unwrap();
-
-        let reader = ArchiveReader::from_bytes(&buf).unwrap();
-        let err = reader.read_entry("nonexistent", &buf).unwrap_err();
-        assert!(err.is_not_found());
-    }
-
-    #[test]
-    fn reproducible_output() {
-        let mut writer1 = ArchiveWriter::new();
-        writer1.add_file("z.txt", b"Z");
-        writer1.add_file("a.txt", b"A");
-
-        let mut writer2 = ArchiveWriter::new();
-        writer2.add_file("a.txt", b"A");
-        writer2.add_file("z.txt", b"Z");
-
-        let mut buf1 = Vec::new();
-        let mut buf2 = Vec::new();
-        writer1.write_to(&mut buf1).unwrap();
-        writer2.write_to(&mut buf2).unwrap();
-
-        assert_eq!(
-            buf1, buf2,
-            "Archives with same content must be byte-identical"
-        );
-    }
-
-    #[test]
-    fn empty_file_entry() {
-        let mut writer = ArchiveWriter::new();
-        writer.add_file("empty.dat", b"");
-
-        let mut buf = Vec::new();
-        writer.write_to(&mut buf).unwrap();
-
-        let reader = ArchiveReader::from_bytes(&buf).unwrap();
-        let data = reader.read_entry("empty.dat", &buf).unwrap();
-        assert!(data.is_empty());
-    }
-}
+#[path = "archive_format_tests.rs"]
+mod tests;
@@ -0,0 +1,230 @@
+use super::*;
+
+fn write(writer: &ArchiveWriter) -> Vec<u8> {
+    let mut buf = Vec::new();
+    writer.write_to(&mut buf).unwrap();
+    buf
+}
+
+#[test]
+fn round_trip_single_file() {
+    let mut writer = ArchiveWriter::new();
+    writer.add_file("hello.txt", b"Hello, world!");
+    let buf = write(&writer);
+
+    let reader = ArchiveReader::from_bytes(&buf).unwrap();
+    assert!(reader.entry_exists("hello.txt"));
+    assert!(!reader.entry_exists("missing.txt"));
+
+    let data = reader.read_entry("hello.txt", &buf).unwrap();
+    assert_eq!(&*data, b"Hello, world!");
+}
+
+#[test]
+fn round_trip_multiple_files() {
+    let mut writer = ArchiveWriter::new();
+    writer.add_file("b.txt", b"BBB");
+    writer.add_file("a.txt", b"AAA");
+    writer.add_file("c/nested.bin", &[1, 2, 3, 4]);
+    let buf = write(&writer);
+
+    let reader = ArchiveReader::from_bytes(&buf).unwrap();
+    assert_eq!(reader.entries().len(), 3);
+
+    // Verify sorted order.
+    assert_eq!(reader.entries()[0].path, "a.txt");
+    assert_eq!(reader.entries()[1].path, "b.txt");
+    assert_eq!(reader.entries()[2].path, "c/nested.bin");
+
+    assert_eq!(&*reader.read_entry("a.txt", &buf).unwrap(), b"AAA");
+    assert_eq!(&*reader.read_entry("b.txt", &buf).unwrap(), b"BBB");
+    assert_eq!(
+        &*reader.read_entry("c/nested.bin", &buf).unwrap(),
+        &[1, 2, 3, 4]
+    );
+}
+
+#[test]
+fn round_trip_empty_archive() {
+    let buf = write(&ArchiveWriter::new());
+
+    let reader = ArchiveReader::from_bytes(&buf).unwrap();
+    assert_eq!(reader.entries().len(), 0);
+    assert!(!reader.entry_exists("anything"));
+}
+
+#[test]
+fn invalid_magic_returns_error() {
+    let data = b"BAAD\x00\x00\x00\x00";
+    let err = ArchiveReader::from_bytes(data).unwrap_err();
+    assert!(err.is_decode_failed());
+}
+
+#[test]
+fn truncated_header_returns_error() {
+    let err = ArchiveReader::from_bytes(b"GOU").unwrap_err();
+    assert!(err.is_decode_failed());
+}
+
+#[test]
+fn missing_entry_returns_not_found() {
+    let buf = write(&ArchiveWriter::new());
+
+    let reader = ArchiveReader::from_bytes(&buf).unwrap();
+    let err = reader.read_entry("nonexistent", &buf).unwrap_err();
+    assert!(err.is_not_found());
+    let err = reader
+        .read_hashed(name_hash("nonexistent"), &buf)
+        .unwrap_err();
+    assert!(err.is_not_found());
+}
+
+#[test]
+fn reproducible_output() {
+    let mut writer1 = ArchiveWriter::new();
+    writer1.add_file("z.txt", b"Z");
+    writer1.add_file("a.txt", b"A");
+
+    let mut writer2 = ArchiveWriter::new();
+    writer2.add_file("a.txt", b"A");
+    writer2.add_file("z.txt", b"Z");
+
+    assert_eq!(
+        write(&writer1),
+        write(&writer2),
+        "Archives with same content must be byte-identical"
+    );
+}
+
+#[test]
+fn empty_file_entry() {
+    let mut writer = ArchiveWriter::new();
+    writer.add_file("empty.dat", b"");
+    let buf = write(&writer);
+
+    let reader = ArchiveReader::from_bytes(&buf).unwrap();
+    let data = reader.read_entry("empty.dat", &buf).unwrap();
+    assert!(data.is_empty());
+}
+
+#[test]
+fn hashed_lookup_borrows_uncompressed_entries() {
+    let mut writer = ArchiveWriter::new();
+    writer.add_file("sprites/player.png", b"png bytes");
+    let buf = write(&writer);
+
+    let reader = ArchiveReader::from_bytes(&buf).unwrap();
+    let entry = reader
+        .entry_by_hash(name_hash("sprites/player.png"))
+        .unwrap();
+    assert_eq!(entry.path, "sprites/player.png");
+    let data = reader.read_hashed(entry.name_hash, &buf).unwrap();
+    assert!(matches!(data, Cow::Borrowed(_)));
+    assert_eq!(&*data, b"png bytes");
+}
+
+#[test]
+fn entries_start_on_aligned_offsets() {
+    let mut writer = ArchiveWriter::new();
+    writer.set_alignment(4000);
+    writer.add_file("a.bin", &[1; 3]);
+    writer.add_file("b.bin", &[2; 5000]);
+    writer.add_file("c.bin", &[3; 1]);
+    let buf = write(&writer);
+
+    let reader = ArchiveReader::from_bytes(&buf).unwrap();
+    for entry in reader.entries() {
+        let stored = reader.stored_bytes(entry, &buf).unwrap();
+        let start = stored.as_ptr() as usize - buf.as_ptr() as usize;
+        assert_eq!(start % 4096, 0, "{} starts at {start}", entry.path);
+    }
+    assert_eq!(&*reader.read_entry("b.bin", &buf).unwrap(), &[2; 5000][..]);
+}
+
+#[test]
+fn compressed_entries_round_trip() {
+    let text: Vec<u8> = b"{\"entity\": 1}, "
+        .iter()
+        .copied()
+        .cycle()
+        .take(8192)
+        .collect();
+    let mut writer = ArchiveWriter::new();
+    writer.add_file_compressed("scenes/level.json", &text);
+    writer.add_file_compressed("noise.bin", &[7, 1, 9]);
+    let buf = write(&writer);
+    assert!(buf.len() < text.len() / 4);
+
+    let reader = ArchiveReader::from_bytes(&buf).unwrap();
+    let entry = reader.entry("scenes/level.json").unwrap();
+    assert_eq!(entry.compression, ArchiveCompression::Lz4);
+    assert_eq!(entry.size, text.len() as u64);
+    assert!(entry.stored_size < entry.size);
+    assert_eq!(
+        &*reader.read_entry("scenes/level.json", &buf).unwrap(),
+        &text[..]
+    );
+
+    // Data that does not shrink is stored as-is.
+    let entry = reader.entry("noise.bin").unwrap();
+    assert_eq!(entry.compression, ArchiveCompression::None);
+    assert_eq!(&*reader.read_entry("noise.bin", &buf).unwrap(), &[7, 1, 9]);
+}
+
+#[test]
+fn version_1_archives_are_readable() {
+    let mut toc = Vec::new();
+    toc.extend_from_slice(&1u32.to_le_bytes());
+    toc.extend_from_slice(&1u32.to_le_bytes());
+    toc.extend_from_slice(&5u32.to_le_bytes());
+    toc.extend_from_slice(b"a.txt");
+    toc.extend_from_slice(&0u64.to_le_bytes());
+    toc.extend_from_slice(&3u64.to_le_bytes());
+    toc.extend_from_slice(&0u32.to_le_bytes());
+    let mut buf = ARCHIVE_MAGIC.to_vec();
+    buf.extend_from_slice(&(toc.len() as u32).to_le_bytes());
+    buf.extend_from_slice(&toc);
+    buf.extend_from_slice(b"AAA");
+
+    let reader = ArchiveReader::from_bytes(&buf).unwrap();
+    assert_eq!(
+        &*reader.read_hashed(name_hash("a.txt"), &buf).unwrap(),
+        b"AAA"
+    );
+}
+
+#[test]
+fn unknown_versions_and_compression_are_rejected() {
+    let mut writer = ArchiveWriter::new();
+    writer.add_file("a.txt", b"AAA");
+    let buf = write(&writer);
+
+    let mut future = buf.clone();
+    future[8..12].copy_from_slice(&(ARCHIVE_VERSION + 1).to_le_bytes());
+    assert!(ArchiveReader::from_bytes(&future)
+        .unwrap_err()
+        .is_decode_failed());
+
+    // The compression field is the last u32 of the only entry.
+    let compression_at = 8 + 4 + 4 + 4 + 5 + 8 * 4 + 4;
+    let mut unknown = buf;
+    unknown[compression_at..compression_at + 4].copy_from_slice(&9u32.to_le_bytes());
+    assert!(ArchiveReader::from_bytes(&unknown)
+        .unwrap_err()
+        .is_decode_failed());
+}
+
+#[test]
+fn mismatched_name_hashes_are_rejected() {
+    let mut writer = ArchiveWriter::new();
+    writer.add_file("a.txt", b"AAA");
+    let buf = write(&writer);
+
+    // The name hash follows the only entry's path.
+    let hash_at = 8 + 4 + 4 + 4 + 5;
+    let mut tampered = buf;
+    tampered[hash_at..hash_at + 8].copy_from_slice(&name_hash("b.txt").to_le_bytes());
+    assert!(ArchiveReader::from_bytes(&tampered)
+        .unwrap_err()
+        .is_decode_failed());
+}
@@ -33,8 +33,9 @@ impl ArchiveFs {
 
 impl VirtualFs for ArchiveFs {
     fn read(&self, path: &str) -> Result<Vec<u8>, AssetLoadError> {
-        let slice = self.reader.read_entry(path, &self.data)?;
-        Ok(slice.to_vec())
+        self.reader
+            .read_entry(path, &self.data)
+            .map(|data| data.into_owned())
     }
 
     fn exists(&self, path: &str) -> bool {
@@ -42,29 +43,6 @@ impl VirtualFs for ArchiveFs {
     }
 
     fn list(&self, directory: &str) -> Result<Vec<String>, AssetLoadError> {
-        let prefix = if directory.is_empty() {
-            String::new()
-        } else if directory.ends_with('/') {
-            directory.to_string()
-        } else {
-            format!("{directory}/")
-        };
-
-        let mut result: Vec<String> = self
-            .reader
-            .entries()
-            .iter()
-            .filter(|e| {
-                if prefix.is_empty() {
-                    true
-                } else {
-                    e.path.starts_with(&prefix)
-                }
-            })
-            .map(|e| e.path.clone())
-            .collect();
-
-        result.sort();
-        Ok(result)
+        Ok(self.reader.list(directory))
     }
 }
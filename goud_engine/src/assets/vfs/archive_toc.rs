@@ -0,0 +1,134 @@
+//! Table-of-contents encoding for the GOUD archive format.
+//!
+//! Binary serialization helpers with no external dependencies; see
+//! [`archive_format`](super::archive_format) for the layout.
+
+use std::io::Write;
+
+use super::archive_format::{
+    name_hash, ArchiveCompression, ArchiveEntry, ArchiveToc, ARCHIVE_VERSION,
+};
+use crate::assets::AssetLoadError;
+
+pub(super) fn serialize_toc(toc: &ArchiveToc) -> Result<Vec<u8>, AssetLoadError> {
+    let mut buf = Vec::new();
+    write_all(&mut buf, &toc.version.to_le_bytes())?;
+    write_all(&mut buf, &(toc.entries.len() as u32).to_le_bytes())?;
+    for entry in &toc.entries {
+        let path_bytes = entry.path.as_bytes();
+        write_all(&mut buf, &(path_bytes.len() as u32).to_le_bytes())?;
+        write_all(&mut buf, path_bytes)?;
+        write_all(&mut buf, &entry.name_hash.to_le_bytes())?;
+        write_all(&mut buf, &entry.offset.to_le_bytes())?;
+        write_all(&mut buf, &entry.stored_size.to_le_bytes())?;
+        write_all(&mut buf, &entry.size.to_le_bytes())?;
+        write_all(&mut buf, &entry.crc32.to_le_bytes())?;
+        write_all(&mut buf, &(entry.compression as u32).to_le_bytes())?;
+    }
+    Ok(buf)
+}
+
+pub(super) fn deserialize_toc(data: &[u8]) -> Result<ArchiveToc, AssetLoadError> {
+    let mut cursor = 0;
+
+    let version = read_u32(data, &mut cursor)?;
+    if version == 0 || version > ARCHIVE_VERSION {
+        return Err(AssetLoadError::decode_failed(format!(
+            "Archive version {} not supported; expected 1 to {}",
+            version, ARCHIVE_VERSION
+        )));
+    }
+    let entry_count = read_u32(data, &mut cursor)?;
+
+    let mut entries = Vec::with_capacity((entry_count as usize).min(data.len() / 24));
+    for _ in 0..entry_count {
+        let path_len = read_u32(data, &mut cursor)? as usize;
+        if cursor + path_len > data.len() {
+            return Err(AssetLoadError::decode_failed("TOC truncated: path data"));
+        }
+        let path = std::str::from_utf8(&data[cursor..cursor + path_len])
+            .map_err(|e| AssetLoadError::decode_failed(format!("Invalid UTF-8 in path: {e}")))?
+            .to_string();
+        cursor += path_len;
+
+        let entry = if version == 1 {
+            let offset = read_u64(data, &mut cursor)?;
+            let size = read_u64(data, &mut cursor)?;
+            let crc32 = read_u32(data, &mut cursor)?;
+            ArchiveEntry {
+                name_hash: name_hash(&path),
+                path,
+                offset,
+                stored_size: size,
+                size,
+                crc32,
+                compression: ArchiveCompression::None,
+            }
+        } else {
+            let stored_hash = read_u64(data, &mut cursor)?;
+            if stored_hash != name_hash(&path) {
+                return Err(AssetLoadError::decode_failed(format!(
+                    "Archive entry '{path}' has a mismatched name hash"
+                )));
+            }
+            let offset = read_u64(data, &mut cursor)?;
+            let stored_size = read_u64(data, &mut cursor)?;
+            let size = read_u64(data, &mut cursor)?;
+            let crc32 = read_u32(data, &mut cursor)?;
+            let compression = read_u32(data, &mut cursor)?;
+            let compression = ArchiveCompression::from_u32(compression).ok_or_else(|| {
+                AssetLoadError::decode_failed(format!(
+                    "Archive entry '{path}' uses unknown compression {compression}"
+                ))
+            })?;
+            ArchiveEntry {
+                name_hash: stored_hash,
+                path,
+                offset,
+                stored_size,
+                size,
+                crc32,
+                compression,
+            }
+        };
+        entries.push(entry);
+    }
+
+    Ok(ArchiveToc { version, entries })
+}
+
+fn read_u32(data: &[u8], cursor: &mut usize) -> Result<u32, AssetLoadError> {
+    if *cursor + 4 > data.len() {
+        return Err(AssetLoadError::decode_failed(
+            "Unexpected end of data reading u32",
+        ));
+    }
+    let val = u32::from_le_bytes(
+        data[*cursor..*cursor + 4]
+            .try_into()
+            .map_err(|_| AssetLoadError::decode_failed("Invalid u32 slice"))?,
+    );
+    *cursor += 4;
+    Ok(val)
+}
+
+fn read_u64(data: &[u8], cursor: &mut usize) -> Result<u64, AssetLoadError> {
+    if *cursor + 8 > data.len() {
+        return Err(AssetLoadError::decode_failed(
+            "Unexpected end of data reading u64",
+        ));
+    }
+    let val = u64::from_le_bytes(
+        data[*cursor..*cursor + 8]
+            .try_into()
+            .map_err(|_| AssetLoadError::decode_failed("Invalid u64 slice"))?,
+    );
+    *cursor += 8;
+    Ok(val)
+}
+
+pub(super) fn write_all(writer: &mut impl Write, data: &[u8]) -> Result<(), AssetLoadError> {
+    writer
+        .write_all(data)
+        .map_err(|e| AssetLoadError::custom(format!("Write failed: {e}")))
+}
@@ -0,0 +1,156 @@
+//! Memory-mapped asset packs.
+//!
+//! [`AssetPack`] opens a GOUD archive by memory-mapping it instead of
+//! reading it, so opening costs one file open regardless of how many assets
+//! the pack holds, and the OS pages in only the entries that are touched.
+//! Uncompressed entries are handed out as slices of the mapping; nothing is
+//! copied until a decoder needs to. Entries are looked up by the 64-bit
+//! [`name_hash`](super::archive_format::name_hash) of their path, which
+//! callers can precompute, so a lookup never hashes or compares strings.
+//!
+//! On `wasm32`, where there is no file mapping, packs are built from bytes
+//! the caller fetched with [`AssetPack::from_bytes`].
+
+use std::borrow::Cow;
+use std::ops::Deref;
+#[cfg(not(target_arch = "wasm32"))]
+use std::path::Path;
+
+use super::archive_format::{ArchiveCompression, ArchiveEntry, ArchiveReader};
+use super::VirtualFs;
+use crate::assets::AssetLoadError;
+
+#[derive(Debug)]
+enum PackBytes {
+    #[cfg(not(target_arch = "wasm32"))]
+    Mapped(memmap2::Mmap),
+    Owned(Vec<u8>),
+}
+
+impl Deref for PackBytes {
+    type Target = [u8];
+
+    fn deref(&self) -> &[u8] {
+        match self {
+            #[cfg(not(target_arch = "wasm32"))]
+            Self::Mapped(map) => map,
+            Self::Owned(bytes) => bytes,
+        }
+    }
+}
+
+/// A read-only GOUD archive, memory-mapped or held in memory.
+///
+/// `AssetPack` is `Send + Sync`; share one between threads behind an `Arc`.
+/// It also implements [`VirtualFs`], so it can back an
+/// [`AssetServer`](crate::assets::AssetServer) via
+/// [`set_vfs`](crate::assets::AssetServer::set_vfs).
+///
+/// # Example
+///
+/// ```no_run
+/// use goud_engine::assets::vfs::archive_format::name_hash;
+/// use goud_engine::assets::vfs::AssetPack;
+///
+/// const PLAYER: u64 = name_hash("sprites/player.png");
+///
+/// let pack = AssetPack::open("game.goud").unwrap();
+/// let png = pack.read_hashed(PLAYER).unwrap();
+/// assert!(!png.is_empty());
+/// ```
+#[derive(Debug)]
+pub struct AssetPack {
+    bytes: PackBytes,
+    reader: ArchiveReader,
+}
+
+impl AssetPack {
+    /// Memory-maps the archive at `path`.
+    ///
+    /// The file must not be modified or truncated while the pack is open;
+    /// the mapping reflects the file's contents as they change.
+    #[cfg(not(target_arch = "wasm32"))]
+    pub fn open(path: impl AsRef<Path>) -> Result<Self, AssetLoadError> {
+        let path = path.as_ref();
+        let file = std::fs::File::open(path).map_err(|e| AssetLoadError::io_error(path, e))?;
+        // SAFETY: the mapping is read-only and the caller promises not to
+        // modify the file while the pack is open (see above).
+        let map =
+            unsafe { memmap2::Mmap::map(&file) }.map_err(|e| AssetLoadError::io_error(path, e))?;
+        let reader = ArchiveReader::from_bytes(&map)?;
+        Ok(Self {
+            bytes: PackBytes::Mapped(map),
+            reader,
+        })
+    }
+
+    /// Creates a pack from archive bytes already in memory.
+    pub fn from_bytes(bytes: Vec<u8>) -> Result<Self, AssetLoadError> {
+        let reader = ArchiveReader::from_bytes(&bytes)?;
+        Ok(Self {
+            bytes: PackBytes::Owned(bytes),
+            reader,
+        })
+    }
+
+    /// Returns `true` if the pack reads from a file mapping.
+    pub fn is_mapped(&self) -> bool {
+        !matches!(self.bytes, PackBytes::Owned(_))
+    }
+
+    /// Returns the parsed table of contents.
+    pub fn reader(&self) -> &ArchiveReader {
+        &self.reader
+    }
+
+    /// Returns the number of entries in the pack.
+    pub fn len(&self) -> usize {
+        self.reader.entries().len()
+    }
+
+    /// Returns `true` if the pack has no entries.
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    /// Returns the entry whose path hashes to `name_hash`, if any.
+    pub fn entry(&self, name_hash: u64) -> Option<&ArchiveEntry> {
+        self.reader.entry_by_hash(name_hash)
+    }
+
+    /// Returns an entry's bytes in place, without copying.
+    ///
+    /// # Returns
+    ///
+    /// `None` if there is no such entry or it is compressed; use
+    /// [`read_hashed`](Self::read_hashed) for those.
+    pub fn entry_bytes(&self, name_hash: u64) -> Option<&[u8]> {
+        let entry = self.entry(name_hash)?;
+        if entry.compression != ArchiveCompression::None {
+            return None;
+        }
+        self.reader.stored_bytes(entry, &self.bytes).ok()
+    }
+
+    /// Returns an entry's bytes, borrowed when stored uncompressed and
+    /// decompressed into a new buffer otherwise.
+    pub fn read_hashed(&self, name_hash: u64) -> Result<Cow<'_, [u8]>, AssetLoadError> {
+        self.reader.read_hashed(name_hash, &self.bytes)
+    }
+}
+
+impl VirtualFs for AssetPack {
+    fn read(&self, path: &str) -> Result<Vec<u8>, AssetLoadError> {
+        self.reader
+            .read_entry(path, &self.bytes)
+            .map(|data| data.into_owned())
+    }
+
+    fn exists(&self, path: &str) -> bool {
+        self.reader.entry_exists(path)
+    }
+
+    fn list(&self, directory: &str) -> Result<Vec<String>, AssetLoadError> {
+        Ok(self.reader.list(directory))
+    }
+}
@@ -0,0 +1,249 @@
+//! LZ4 block-format compression for archive entries.
+//!
+//! Implements the raw LZ4 block format (no frame header), which is all an
+//! archive entry needs since the TOC already records both sizes. The
+//! compressor is a single-pass greedy matcher: fast enough to run in the
+//! packager and producing output any LZ4 block decoder accepts. The
+//! decompressor validates every offset and length, so a corrupt archive
+//! yields an error rather than an out-of-bounds read.
+
+use crate::assets::AssetLoadError;
+
+/// Shortest match the format can encode.
+const MIN_MATCH: usize = 4;
+/// The last five bytes of a block are always literals.
+const LAST_LITERALS: usize = 5;
+/// No match may start within the last twelve bytes of a block.
+const MF_LIMIT: usize = 12;
+/// Largest back-reference distance.
+const MAX_OFFSET: usize = 0xFFFF;
+/// No block expands by more than this factor: each extra length byte adds
+/// at most 255 output bytes.
+const MAX_EXPANSION: usize = 255;
+const HASH_LOG: u32 = 12;
+
+#[inline]
+fn read_u32(data: &[u8], pos: usize) -> u32 {
+    u32::from_le_bytes([data[pos], data[pos + 1], data[pos + 2], data[pos + 3]])
+}
+
+#[inline]
+fn hash(sequence: u32) -> usize {
+    (sequence.wrapping_mul(2_654_435_761) >> (32 - HASH_LOG)) as usize
+}
+
+/// Appends the 255-run encoding of a length's remainder past the token.
+fn push_length(out: &mut Vec<u8>, mut remainder: usize) {
+    while remainder >= 255 {
+        out.push(255);
+        remainder -= 255;
+    }
+    out.push(remainder as u8);
+}
+
+fn push_sequence(out: &mut Vec<u8>, literals: &[u8], offset: usize, match_len: usize) {
+    let literal_nibble = literals.len().min(15);
+    let match_nibble = (match_len - MIN_MATCH).min(15);
+    out.push(((literal_nibble as u8) << 4) | match_nibble as u8);
+    if literals.len() >= 15 {
+        push_length(out, literals.len() - 15);
+    }
+    out.extend_from_slice(literals);
+    out.extend_from_slice(&(offset as u16).to_le_bytes());
+    if match_len - MIN_MATCH >= 15 {
+        push_length(out, match_len - MIN_MATCH - 15);
+    }
+}
+
+/// Compresses `input` into an LZ4 block.
+pub(crate) fn compress(input: &[u8]) -> Vec<u8> {
+    let mut out = Vec::with_capacity(input.len() + input.len() / 255 + 16);
+    let mut anchor = 0;
+
+    if input.len() > MF_LIMIT {
+        // Positions are stored off by one so 0 means "empty slot".
+        let mut table = vec![0u32; 1 << HASH_LOG];
+        let match_start_limit = input.len() - MF_LIMIT;
+        let match_end_limit = input.len() - LAST_LITERALS;
+        let mut pos = 0;
+        while pos <= match_start_limit {
+            let sequence = read_u32(input, pos);
+            let slot = &mut table[hash(sequence)];
+            let candidate = *slot as usize;
+            *slot = (pos + 1) as u32;
+
+            if candidate != 0 {
+                let candidate = candidate - 1;
+                if pos - candidate <= MAX_OFFSET && read_u32(input, candidate) == sequence {
+                    let mut len = MIN_MATCH;
+                    while pos + len < match_end_limit && input[candidate + len] == input[pos + len]
+                    {
+                        len += 1;
+                    }
+                    push_sequence(&mut out, &input[anchor..pos], pos - candidate, len);
+                    pos += len;
+                    anchor = pos;
+                    continue;
+                }
+            }
+            pos += 1;
+        }
+    }
+
+    let literals = &input[anchor..];
+    out.push((literals.len().min(15) as u8) << 4);
+    if literals.len() >= 15 {
+        push_length(&mut out, literals.len() - 15);
+    }
+    out.extend_from_slice(literals);
+    out
+}
+
+fn corrupt() -> AssetLoadError {
+    AssetLoadError::decode_failed("Corrupt LZ4 block in archive entry")
+}
+
+/// Reads a 255-run length continuation starting at `*pos`.
+fn read_length(input: &[u8], pos: &mut usize) -> Result<usize, AssetLoadError> {
+    let mut len = 0usize;
+    loop {
+        let byte = *input.get(*pos).ok_or_else(corrupt)?;
+        *pos += 1;
+        len = len.checked_add(byte as usize).ok_or_else(corrupt)?;
+        if byte != 255 {
+            return Ok(len);
+        }
+    }
+}
+
+/// Decompresses an LZ4 block that must expand to exactly `raw_size` bytes.
+///
+/// `raw_size` comes from the archive TOC, so it is checked against the
+/// largest size `input` could expand to before anything is allocated.
+pub(crate) fn decompress(input: &[u8], raw_size: usize) -> Result<Vec<u8>, AssetLoadError> {
+    if raw_size > input.len().saturating_mul(MAX_EXPANSION) {
+        return Err(corrupt());
+    }
+    let mut out = Vec::with_capacity(raw_size);
+    let mut pos = 0;
+    loop {
+        let token = *input.get(pos).ok_or_else(corrupt)?;
+        pos += 1;
+
+        let mut literal_len = (token >> 4) as usize;
+        if literal_len == 15 {
+            literal_len += read_length(input, &mut pos)?;
+        }
+        let literal_end = pos.checked_add(literal_len).ok_or_else(corrupt)?;
+        if literal_end > input.len() || out.len() + literal_len > raw_size {
+            return Err(corrupt());
+        }
+        out.extend_from_slice(&input[pos..literal_end]);
+        pos = literal_end;
+        if pos == input.len() {
+            break;
+        }
+
+        if pos + 2 > input.len() {
+            return Err(corrupt());
+        }
+        let offset = u16::from_le_bytes([input[pos], input[pos + 1]]) as usize;
+        pos += 2;
+        let mut match_len = (token & 0x0F) as usize + MIN_MATCH;
+        if token & 0x0F == 0x0F {
+            match_len += read_length(input, &mut pos)?;
+        }
+        if offset == 0 || offset > out.len() || out.len() + match_len > raw_size {
+            return Err(corrupt());
+        }
+
+        let start = out.len() - offset;
+        if offset >= match_len {
+            out.extend_from_within(start..start + match_len);
+        } else {
+            // Overlapping copy: each byte may depend on one written this loop.
+            for i in 0..match_len {
+                out.push(out[start + i]);
+            }
+        }
+    }
+
+    if out.len() != raw_size {
+        return Err(corrupt());
+    }
+    Ok(out)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn round_trip(data: &[u8]) -> Vec<u8> {
+        let packed = compress(data);
+        assert_eq!(decompress(&packed, data.len()).unwrap(), data);
+        packed
+    }
+
+    #[test]
+    fn round_trips_short_and_empty_inputs() {
+        assert_eq!(round_trip(b""), [0]);
+        round_trip(b"a");
+        round_trip(b"hello, world!");
+    }
+
+    #[test]
+    fn compresses_repetitive_data() {
+        let data: Vec<u8> = b"tile-0042;"
+            .iter()
+            .copied()
+            .cycle()
+            .take(64 * 1024)
+            .collect();
+        let packed = round_trip(&data);
+        assert!(packed.len() < data.len() / 20);
+    }
+
+    #[test]
+    fn round_trips_overlapping_and_long_runs() {
+        let mut data = vec![7u8; 5000];
+        data.extend((0..=255u8).cycle().take(3000));
+        data.extend_from_slice(&[1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 9, 9, 9]);
+        round_trip(&data);
+    }
+
+    #[test]
+    fn round_trips_incompressible_data() {
+        let mut state = 0x1234_5678u32;
+        let data: Vec<u8> = (0..10_000)
+            .map(|_| {
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                state as u8
+            })
+            .collect();
+        round_trip(&data);
+    }
+
+    #[test]
+    fn rejects_corrupt_blocks() {
+        let packed = compress(&[3u8; 100]);
+        assert!(decompress(&packed, 99).is_err());
+        assert!(decompress(&packed, 101).is_err());
+        assert!(decompress(&packed[..packed.len() - 1], 100).is_err());
+        // A match that reaches back before the start of the output.
+        assert!(decompress(&[0x00, 0x05, 0x00], 4).is_err());
+        assert!(decompress(&[], 0).is_err());
+    }
+
+    #[test]
+    fn rejects_raw_sizes_beyond_maximum_expansion() {
+        let data = vec![0u8; 100_000];
+        let packed = round_trip(&data);
+        assert!(packed.len() * MAX_EXPANSION >= data.len());
+        // A TOC claiming more than the block could ever produce fails
+        // before the output buffer is reserved.
+        assert!(decompress(&packed, usize::MAX).is_err());
+        assert!(decompress(&packed, packed.len() * MAX_EXPANSION + 1).is_err());
+    }
+}
@@ -2,17 +2,24 @@
 //!
 //! Provides the [`VirtualFs`] trait and concrete implementations so the
 //! [`AssetServer`](super::AssetServer) can load assets from different
-//! storage backends (OS filesystem, archives, embedded resources).
+//! storage backends (OS filesystem, archives, embedded resources), plus
+//! [`AssetPack`] for memory-mapped archives read by name hash.
 
 pub mod archive_format;
 mod archive_fs;
+mod archive_toc;
+mod asset_pack;
+mod lz4;
 mod os_fs;
 mod trait_def;
 
 #[cfg(test)]
 mod tests;
 
-pub use archive_format::{ArchiveEntry, ArchiveReader, ArchiveToc, ArchiveWriter};
+pub use archive_format::{
+    ArchiveCompression, ArchiveEntry, ArchiveReader, ArchiveToc, ArchiveWriter,
+};
 pub use archive_fs::ArchiveFs;
+pub use asset_pack::AssetPack;
 pub use os_fs::OsFs;
 pub use trait_def::VirtualFs;
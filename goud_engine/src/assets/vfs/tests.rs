@@ -1,7 +1,9 @@
 //! Tests for the virtual filesystem implementations.
 
-use super::archive_format::ArchiveWriter;
-use super::{ArchiveFs, OsFs, VirtualFs};
+use std::borrow::Cow;
+
+use super::archive_format::{name_hash, ArchiveWriter};
+use super::{ArchiveFs, AssetPack, OsFs, VirtualFs};
 
 // ---------------------------------------------------------------------------
 // OsFs tests
@@ -160,3 +162,49 @@ fn virtual_fs_can_swap_implementations() {
     assert!(archive.exists("archive_file.txt"));
     assert!(!archive.exists("file.txt"));
 }
+
+// ---------------------------------------------------------------------------
+// AssetPack tests
+// ---------------------------------------------------------------------------
+
+#[test]
+fn asset_pack_maps_file_and_reads_by_hash() {
+    let mut writer = ArchiveWriter::new();
+    writer.add_file("sprites/player.png", b"raw png bytes");
+    writer.add_file_compressed("scenes/level.json", &[b'{'; 4096]);
+    let dir = tempfile::tempdir().expect("failed to create temp dir");
+    let path = dir.path().join("game.goud");
+    let mut file = std::fs::File::create(&path).unwrap();
+    writer.write_to(&mut file).unwrap();
+    drop(file);
+
+    let pack = AssetPack::open(&path).unwrap();
+    assert!(pack.is_mapped());
+    assert_eq!(pack.len(), 2);
+
+    let player = name_hash("sprites/player.png");
+    assert_eq!(pack.entry_bytes(player), Some(&b"raw png bytes"[..]));
+    assert!(matches!(
+        pack.read_hashed(player).unwrap(),
+        Cow::Borrowed(_)
+    ));
+
+    let level = name_hash("scenes/level.json");
+    assert_eq!(pack.entry_bytes(level), None);
+    assert_eq!(&*pack.read_hashed(level).unwrap(), &[b'{'; 4096][..]);
+    assert!(pack.read_hashed(name_hash("missing")).is_err());
+    assert_eq!(pack.read("sprites/player.png").unwrap(), b"raw png bytes");
+}
+
+#[test]
+fn asset_pack_from_bytes_is_not_mapped() {
+    let mut writer = ArchiveWriter::new();
+    writer.add_file("a.txt", b"a");
+    let mut buf = Vec::new();
+    writer.write_to(&mut buf).unwrap();
+
+    let pack = AssetPack::from_bytes(buf).unwrap();
+    assert!(!pack.is_mapped());
+    assert!(pack.exists("a.txt"));
+    assert!(AssetPack::from_bytes(b"not an archive".to_vec()).is_err());
+}
@@ -0,0 +1,60 @@
+//! Builds a GOUD asset pack from a directory.
+//!
+//! ```text
+//! goud_pack <input_dir> <output.goud> [--compress] [--align N]
+//! ```
+//!
+//! Entry names are paths relative to `input_dir` with forward slashes; the
+//! runtime looks them up by `goud_asset_pack_hash` of that name.
+
+use std::path::Path;
+use std::process::ExitCode;
+
+use goud_engine::assets::packager::{package_directory_with, PackOptions};
+use goud_engine::assets::AssetPack;
+
+const USAGE: &str = "usage: goud_pack <input_dir> <output.goud> [--compress] [--align N]";
+
+fn main() -> ExitCode {
+    let mut positional = Vec::new();
+    let mut options = PackOptions::default();
+    let mut args = std::env::args().skip(1);
+    while let Some(arg) = args.next() {
+        match arg.as_str() {
+            "--compress" => options.compress = true,
+            "--align" => match args.next().and_then(|n| n.parse::<u32>().ok()) {
+                Some(n) if n > 0 => options.alignment = n,
+                _ => {
+                    eprintln!("--align expects a positive integer\n{USAGE}");
+                    return ExitCode::FAILURE;
+                }
+            },
+            "-h" | "--help" => {
+                println!("{USAGE}");
+                return ExitCode::SUCCESS;
+            }
+            _ => positional.push(arg),
+        }
+    }
+    let [input, output] = positional.as_slice() else {
+        eprintln!("{USAGE}");
+        return ExitCode::FAILURE;
+    };
+
+    let output = Path::new(output);
+    if let Err(err) = package_directory_with(Path::new(input), output, &options) {
+        eprintln!("goud_pack: {err}");
+        return ExitCode::FAILURE;
+    }
+    let written = std::fs::read(output).map_err(|e| e.to_string());
+    match written.and_then(|bytes| AssetPack::from_bytes(bytes).map_err(|e| e.to_string())) {
+        Ok(pack) => {
+            println!("{}: {} entries", output.display(), pack.len());
+            ExitCode::SUCCESS
+        }
+        Err(err) => {
+            eprintln!("goud_pack: wrote an unreadable pack: {err}");
+            ExitCode::FAILURE
+        }
+    }
+}
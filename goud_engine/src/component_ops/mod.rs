@@ -22,6 +22,7 @@
 mod batch_ops;
 mod helpers;
 mod single_ops;
+mod snapshot;
 mod storage;
 
 // Re-export all public _impl functions so external callers can use
@@ -37,4 +38,10 @@ pub use single_ops::{
 // Entity despawn cleanup: the FFI lifecycle layer computes the context key and
 // purges an entity's dynamic components after despawn.
 pub(crate) use helpers::context_key;
-pub(crate) use storage::purge_context_entity;
+pub(crate) use storage::{clone_context_entity, purge_context_entity};
+
+// World snapshots pack and restore a context's dynamic components.
+pub(crate) use snapshot::{
+    can_restore_context_components, restore_context_components, save_context_components,
+    RawColumnSnapshot, RawComponentSnapshot,
+};
@@ -0,0 +1,258 @@
+//! Packed snapshots of a context's raw component storages.
+//!
+//! Raw components are plain bytes that callers may write through pointers
+//! at any time, so there is no way to tell which storages changed. A
+//! snapshot therefore copies every storage, packing its components back to
+//! back next to its entity list. Restoring writes the bytes back in place
+//! when the storage still holds the same entities, which keeps component
+//! pointers handed out earlier valid; otherwise the storage is rebuilt.
+
+use std::alloc::dealloc;
+
+use super::storage::{get_context_storage_map, ContextComponentStorage, RawComponentStorage};
+
+/// One raw storage inside a [`RawComponentSnapshot`].
+#[derive(Debug, Default)]
+pub(crate) struct RawColumnSnapshot {
+    /// Registered type ID of the stored components.
+    pub(crate) type_id_hash: u64,
+    /// Size and alignment the storage was created with.
+    pub(crate) component_size: usize,
+    pub(crate) component_align: usize,
+    /// Entity bits, in the storage's dense order.
+    pub(crate) entities: Vec<u64>,
+    /// `component_size` bytes per entity in `entities`, back to back.
+    pub(crate) bytes: Vec<u8>,
+}
+
+/// Copy of every raw component storage of one context.
+///
+/// Saving into an existing snapshot reuses its buffers.
+#[derive(Debug, Default)]
+pub(crate) struct RawComponentSnapshot {
+    /// One column per storage, ordered by type ID.
+    pub(crate) columns: Vec<RawColumnSnapshot>,
+}
+
+impl RawComponentSnapshot {
+    /// Returns the number of component bytes held.
+    pub(crate) fn byte_len(&self) -> usize {
+        self.columns.iter().map(|column| column.bytes.len()).sum()
+    }
+}
+
+impl RawComponentStorage {
+    /// Packs this storage into `column`.
+    fn save_into(&self, type_id_hash: u64, column: &mut RawColumnSnapshot) {
+        column.type_id_hash = type_id_hash;
+        column.component_size = self.component_size;
+        column.component_align = self.component_align;
+        column.entities.clone_from(&self.dense);
+        column.bytes.clear();
+        column.bytes.reserve(self.data.len() * self.component_size);
+        for &ptr in &self.data {
+            // SAFETY: every pointer in `data` was allocated in `insert` with
+            // room for `component_size` initialized bytes.
+            let bytes = unsafe { std::slice::from_raw_parts(ptr, self.component_size) };
+            column.bytes.extend_from_slice(bytes);
+        }
+    }
+
+    /// Frees every component, keeping the storage's buffers.
+    fn clear(&mut self) {
+        let layout = self.layout();
+        for ptr in self.data.drain(..) {
+            if !ptr.is_null() {
+                // SAFETY: ptr was allocated with this layout in `insert`.
+                unsafe { dealloc(ptr, layout) };
+            }
+        }
+        self.dense.clear();
+        self.sparse.fill(None);
+    }
+
+    /// Overwrites this storage with `column`, which must have been saved
+    /// from a storage of the same size and alignment.
+    ///
+    /// Returns false if an allocation fails while rebuilding.
+    fn restore_from(&mut self, column: &RawColumnSnapshot) -> bool {
+        let size = self.component_size;
+        debug_assert_eq!(column.bytes.len(), column.entities.len() * size);
+        if self.dense == column.entities {
+            if size > 0 {
+                for (bytes, &ptr) in column.bytes.chunks_exact(size).zip(&self.data) {
+                    // SAFETY: `ptr` has room for `size` bytes and `bytes` holds
+                    // exactly `size`; snapshot buffers never alias storage.
+                    unsafe { std::ptr::copy_nonoverlapping(bytes.as_ptr(), ptr, size) };
+                }
+            }
+            return true;
+        }
+
+        self.clear();
+        column.entities.iter().enumerate().all(|(i, &bits)| {
+            // SAFETY: `bytes` holds `size` initialized bytes for each entity.
+            unsafe { self.insert(bits, column.bytes.as_ptr().add(i * size)) }
+        })
+    }
+}
+
+impl ContextComponentStorage {
+    /// Packs every storage into `snapshot`.
+    pub(crate) fn save_into(&self, snapshot: &mut RawComponentSnapshot) {
+        let mut type_ids: Vec<u64> = self.storages.keys().copied().collect();
+        type_ids.sort_unstable();
+        snapshot
+            .columns
+            .resize_with(type_ids.len(), RawColumnSnapshot::default);
+        for (column, type_id_hash) in snapshot.columns.iter_mut().zip(type_ids) {
+            self.storages[&type_id_hash].save_into(type_id_hash, column);
+        }
+    }
+
+    /// Returns true if every storage `snapshot` holds either does not exist
+    /// yet or still has the size and alignment it was saved with.
+    fn layouts_match(&self, snapshot: &RawComponentSnapshot) -> bool {
+        snapshot.columns.iter().all(|column| {
+            self.storages
+                .get(&column.type_id_hash)
+                .is_none_or(|storage| {
+                    storage.component_size == column.component_size
+                        && storage.component_align == column.component_align
+                })
+        })
+    }
+
+    /// Overwrites every storage with `snapshot`; storages it does not hold
+    /// are emptied.
+    ///
+    /// Returns false, changing nothing, if a storage's component layout no
+    /// longer matches the snapshot.
+    pub(crate) fn restore_from(&mut self, snapshot: &RawComponentSnapshot) -> bool {
+        if !self.layouts_match(snapshot) {
+            return false;
+        }
+
+        for (type_id_hash, storage) in &mut self.storages {
+            if !snapshot
+                .columns
+                .iter()
+                .any(|column| column.type_id_hash == *type_id_hash)
+            {
+                storage.clear();
+            }
+        }
+        let mut restored = true;
+        for column in &snapshot.columns {
+            restored &= self
+                .get_or_create_storage(
+                    column.type_id_hash,
+                    column.component_size,
+                    column.component_align,
+                )
+                .restore_from(column);
+        }
+        restored
+    }
+}
+
+/// Saves the raw components of the context behind `context_key` (see
+/// `helpers::context_key`). A context without storage saves as empty.
+pub(crate) fn save_context_components(context_key: u64, snapshot: &mut RawComponentSnapshot) {
+    let storage_map = get_context_storage_map();
+    match storage_map.as_ref().and_then(|map| map.get(&context_key)) {
+        Some(context_storage) => context_storage.save_into(snapshot),
+        None => snapshot.columns.clear(),
+    }
+}
+
+/// Returns true if [`restore_context_components`] would accept `snapshot`,
+/// without changing anything.
+pub(crate) fn can_restore_context_components(
+    context_key: u64,
+    snapshot: &RawComponentSnapshot,
+) -> bool {
+    let storage_map = get_context_storage_map();
+    storage_map
+        .as_ref()
+        .and_then(|map| map.get(&context_key))
+        .is_none_or(|context_storage| context_storage.layouts_match(snapshot))
+}
+
+/// Restores the raw components of the context behind `context_key`.
+///
+/// Returns false if a component layout changed since the save.
+pub(crate) fn restore_context_components(
+    context_key: u64,
+    snapshot: &RawComponentSnapshot,
+) -> bool {
+    let mut storage_map = get_context_storage_map();
+    let map = storage_map.get_or_insert_with(Default::default);
+    if snapshot.columns.is_empty() && !map.contains_key(&context_key) {
+        return true;
+    }
+    map.entry(context_key).or_default().restore_from(snapshot)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::ecs::Entity;
+
+    fn insert_u32(storage: &mut RawComponentStorage, entity: Entity, value: u32) {
+        let bytes = value.to_ne_bytes();
+        // SAFETY: 4 valid bytes matching the storage's size/align (4/4).
+        assert!(unsafe { storage.insert(entity.to_bits(), bytes.as_ptr()) });
+    }
+
+    fn read_u32(storage: &RawComponentStorage, entity: Entity) -> Option<u32> {
+        let ptr = storage.get(entity.to_bits());
+        // SAFETY: non-null pointers reference 4 initialized bytes.
+        (!ptr.is_null()).then(|| unsafe { (ptr as *const u32).read_unaligned() })
+    }
+
+    #[test]
+    fn restore_in_place_keeps_pointers() {
+        let mut ctx = ContextComponentStorage::default();
+        let entity = Entity::new(0, 1);
+        insert_u32(ctx.get_or_create_storage(7, 4, 4), entity, 1);
+        let mut snapshot = RawComponentSnapshot::default();
+        ctx.save_into(&mut snapshot);
+        assert_eq!(snapshot.byte_len(), 4);
+
+        let before = ctx.get_storage(7).unwrap().get(entity.to_bits());
+        insert_u32(ctx.get_or_create_storage(7, 4, 4), entity, 99);
+        assert!(ctx.restore_from(&snapshot));
+        let storage = ctx.get_storage(7).unwrap();
+        assert_eq!(read_u32(storage, entity), Some(1));
+        assert_eq!(storage.get(entity.to_bits()), before);
+    }
+
+    #[test]
+    fn restore_rebuilds_changed_membership() {
+        let mut ctx = ContextComponentStorage::default();
+        let (a, b) = (Entity::new(0, 1), Entity::new(1, 1));
+        insert_u32(ctx.get_or_create_storage(7, 4, 4), a, 10);
+        let mut snapshot = RawComponentSnapshot::default();
+        ctx.save_into(&mut snapshot);
+
+        assert!(ctx.get_storage_mut(7).unwrap().remove(a.to_bits()));
+        insert_u32(ctx.get_or_create_storage(7, 4, 4), b, 20);
+        insert_u32(ctx.get_or_create_storage(8, 4, 4), b, 30);
+        assert!(ctx.restore_from(&snapshot));
+
+        assert_eq!(read_u32(ctx.get_storage(7).unwrap(), a), Some(10));
+        assert_eq!(read_u32(ctx.get_storage(7).unwrap(), b), None);
+        assert_eq!(read_u32(ctx.get_storage(8).unwrap(), b), None);
+    }
+
+    #[test]
+    fn restore_rejects_changed_layouts() {
+        let mut ctx = ContextComponentStorage::default();
+        insert_u32(ctx.get_or_create_storage(7, 4, 4), Entity::new(0, 1), 1);
+        let mut snapshot = RawComponentSnapshot::default();
+        ctx.save_into(&mut snapshot);
+        snapshot.columns[0].component_size = 8;
+        assert!(!ctx.restore_from(&snapshot));
+    }
+}
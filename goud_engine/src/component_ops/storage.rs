@@ -29,19 +29,19 @@ use crate::ecs::Entity;
 #[derive(Debug)]
 pub(crate) struct RawComponentStorage {
     /// Maps entity index to position in dense array.
-    sparse: Vec<Option<usize>>,
+    pub(super) sparse: Vec<Option<usize>>,
 
     /// Packed array of entities that have components.
-    dense: Vec<u64>,
+    pub(super) dense: Vec<u64>,
 
     /// Packed array of raw component data.
-    data: Vec<*mut u8>,
+    pub(super) data: Vec<*mut u8>,
 
     /// Size of each component in bytes.
-    component_size: usize,
+    pub(super) component_size: usize,
 
     /// Alignment of each component.
-    component_align: usize,
+    pub(super) component_align: usize,
 }
 
 // SAFETY: RawComponentStorage is Send because:
@@ -82,7 +82,7 @@ impl RawComponentStorage {
     }
 
     /// Creates the memory layout for a single component.
-    fn layout(&self) -> Layout {
+    pub(super) fn layout(&self) -> Layout {
         if self.component_size == 0 {
             Layout::from_size_align(1, 1).unwrap()
         } else {
@@ -138,6 +138,34 @@ impl RawComponentStorage {
         }
     }
 
+    /// Copies the component of `source_bits` to every entity in `targets`.
+    ///
+    /// Returns false if `source_bits` has no component here or an
+    /// allocation fails.
+    pub(crate) fn clone_to_many(&mut self, source_bits: u64, targets: &[u64]) -> bool {
+        let Some(dense_index) = self.resolve(source_bits) else {
+            return false;
+        };
+        let mut bytes = vec![0u8; self.component_size];
+        if self.component_size > 0 {
+            // SAFETY: `data[dense_index]` was allocated in `insert` with room
+            // for `component_size` bytes, and `bytes` has the same length.
+            unsafe {
+                std::ptr::copy_nonoverlapping(
+                    self.data[dense_index],
+                    bytes.as_mut_ptr(),
+                    self.component_size,
+                );
+            }
+        }
+        self.dense.reserve(targets.len());
+        self.data.reserve(targets.len());
+        targets.iter().all(|&target| {
+            // SAFETY: `bytes` holds `component_size` initialized bytes.
+            unsafe { self.insert(target, bytes.as_ptr()) }
+        })
+    }
+
     /// Removes a component from the given entity.
     pub(crate) fn remove(&mut self, entity_bits: u64) -> bool {
         // Only remove when the slot belongs to this exact entity (generation
@@ -216,7 +244,7 @@ impl Drop for RawComponentStorage {
 #[derive(Debug, Default)]
 pub(crate) struct ContextComponentStorage {
     /// Maps type_id_hash to raw component storage
-    storages: HashMap<u64, RawComponentStorage>,
+    pub(super) storages: HashMap<u64, RawComponentStorage>,
 }
 
 impl ContextComponentStorage {
@@ -231,6 +259,14 @@ impl ContextComponentStorage {
         }
     }
 
+    /// Copies every component of `source_bits` to each entity in `targets`,
+    /// one storage at a time.
+    pub(crate) fn clone_entity(&mut self, source_bits: u64, targets: &[u64]) {
+        for storage in self.storages.values_mut() {
+            storage.clone_to_many(source_bits, targets);
+        }
+    }
+
     /// Gets or creates storage for a component type.
     pub(crate) fn get_or_create_storage(
         &mut self,
@@ -285,6 +321,19 @@ pub(crate) fn purge_context_entity(context_key: u64, entity_bits: u64) {
     }
 }
 
+/// Copies an entity's dynamic components to each of `targets` after a clone.
+///
+/// `context_key` is as for [`purge_context_entity`]. A no-op if the context
+/// has no storage.
+pub(crate) fn clone_context_entity(context_key: u64, source_bits: u64, targets: &[u64]) {
+    let mut storage_map = get_context_storage_map();
+    if let Some(map) = storage_map.as_mut() {
+        if let Some(context_storage) = map.get_mut(&context_key) {
+            context_storage.clone_entity(source_bits, targets);
+        }
+    }
+}
+
 // ============================================================================
 // Type Registry
 // ============================================================================
@@ -425,4 +474,27 @@ mod tests {
             assert!(!ctx.get_storage(type_id).unwrap().contains(entity.to_bits()));
         }
     }
+
+    #[test]
+    fn clone_entity_copies_every_storage() {
+        let mut ctx = ContextComponentStorage::default();
+        let source = Entity::new(1, 1);
+        for (type_id, value) in [(10u64, 7u32), (20u64, 9u32)] {
+            let storage = ctx.get_or_create_storage(type_id, 4, 4);
+            insert_u32(storage, source, value);
+        }
+        let targets = [Entity::new(5, 1), Entity::new(6, 2)];
+        let bits: Vec<u64> = targets.iter().map(|e| e.to_bits()).collect();
+
+        ctx.clone_entity(source.to_bits(), &bits);
+
+        for (type_id, value) in [(10u64, 7u32), (20u64, 9u32)] {
+            let storage = ctx.get_storage(type_id).unwrap();
+            for &target in &targets {
+                assert_eq!(read_u32(storage, target), Some(value));
+            }
+        }
+        let unknown = ctx.get_or_create_storage(30, 4, 4);
+        assert!(!unknown.clone_to_many(source.to_bits(), &bits));
+    }
 }
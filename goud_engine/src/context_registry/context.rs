@@ -5,9 +5,11 @@
 //! game instances or editor viewports).
 
 use std::collections::HashSet;
+use std::time::Duration;
 
 use crate::context_registry::scene::transition::{TransitionComplete, TransitionType};
-use crate::context_registry::scene::{SceneId, SceneLoader, SceneManager};
+use crate::context_registry::scene::{SceneId, SceneLoader, SceneManager, StreamedSceneLoad};
+use crate::core::arena::FrameArena;
 use crate::core::debugger::{ContextConfig, DebuggerConfig, RuntimeRouteId};
 use crate::ecs::World;
 
@@ -28,6 +30,9 @@ pub struct GoudContext {
     /// The scene currently targeted by `world()` / `world_mut()`.
     current_scene: SceneId,
 
+    /// Streamed scene loads that have not completed yet.
+    scene_streams: Vec<StreamedSceneLoad>,
+
     /// Generation counter for this context slot.
     ///
     /// When a context is destroyed, the generation increments. This detects
@@ -47,6 +52,9 @@ pub struct GoudContext {
     /// Registered debugger route, when debugger mode is enabled.
     debugger_route: Option<RuntimeRouteId>,
 
+    /// Per-frame scratch memory owned by this context alone.
+    frame_arena: FrameArena,
+
     /// Thread ID that created this context (for validation in test builds).
     #[cfg(test)]
     owner_thread: std::thread::ThreadId,
@@ -66,10 +74,12 @@ impl GoudContext {
         Self {
             scene_manager,
             current_scene,
+            scene_streams: Vec::new(),
             generation,
             registered_plugins: HashSet::new(),
             debugger: config.debugger,
             debugger_route: None,
+            frame_arena: FrameArena::new(),
             #[cfg(test)]
             owner_thread: std::thread::current().id(),
         }
@@ -131,6 +141,7 @@ impl GoudContext {
     /// the default scene.
     pub fn destroy_scene(&mut self, id: SceneId) -> Result<(), crate::core::error::GoudError> {
         self.scene_manager.destroy_scene(id)?;
+        self.scene_streams.retain(|stream| stream.scene() != id);
         // If the destroyed scene was current, reset to default
         if self.current_scene == id {
             self.current_scene = self.scene_manager.default_scene();
@@ -151,6 +162,103 @@ impl GoudContext {
         SceneLoader::load_scene_from_json(&mut self.scene_manager, name, json)
     }
 
+    /// Loads a scene from packed binary data.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if the data is not a valid packed scene or scene
+    /// creation fails.
+    pub fn load_scene_from_packed(
+        &mut self,
+        name: &str,
+        bytes: &[u8],
+    ) -> Result<SceneId, crate::core::error::GoudError> {
+        SceneLoader::load_scene_from_packed(&mut self.scene_manager, name, bytes)
+    }
+
+    /// Starts a streamed load of packed scene `bytes` into a new scene.
+    ///
+    /// The scene is created empty; [`step_scene_stream`](Self::step_scene_stream)
+    /// fills it over later frames.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if the data is not a valid packed scene or scene
+    /// creation fails.
+    pub fn begin_scene_stream(
+        &mut self,
+        name: &str,
+        bytes: Vec<u8>,
+    ) -> Result<SceneId, crate::core::error::GoudError> {
+        let stream = StreamedSceneLoad::begin(&mut self.scene_manager, name, bytes)?;
+        let id = stream.scene();
+        self.scene_streams.push(stream);
+        Ok(id)
+    }
+
+    /// Advances the streamed load of scene `id` for up to `budget`.
+    ///
+    /// Returns the load progress in `[0.0, 1.0]`.  Once a load completes it
+    /// is dropped, and stepping a scene with no load in progress returns
+    /// `1.0`.  A step that fails destroys the partially loaded scene.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if the scene does not exist or its data fails to
+    /// decode.
+    pub fn step_scene_stream(
+        &mut self,
+        id: SceneId,
+        budget: Duration,
+    ) -> Result<f32, crate::core::error::GoudError> {
+        let Some(index) = self.scene_streams.iter().position(|s| s.scene() == id) else {
+            if self.scene_manager.get_scene(id).is_none() {
+                return Err(crate::core::error::GoudError::ResourceNotFound(format!(
+                    "Scene id {} not found",
+                    id
+                )));
+            }
+            return Ok(1.0);
+        };
+        let result = self.scene_streams[index].step(&mut self.scene_manager, budget);
+        let failed = result.is_err();
+        if failed || self.scene_streams[index].is_complete() {
+            self.scene_streams.swap_remove(index);
+        }
+        if failed {
+            let _ = self.destroy_scene(id);
+        }
+        result
+    }
+
+    /// Returns the progress of the streamed load of scene `id`, or `None`
+    /// if no load is in progress for it.
+    pub fn scene_stream_progress(&self, id: SceneId) -> Option<f32> {
+        self.scene_streams
+            .iter()
+            .find(|s| s.scene() == id)
+            .map(StreamedSceneLoad::progress)
+    }
+
+    /// Cancels the streamed load of scene `id` and destroys the scene.
+    ///
+    /// # Errors
+    ///
+    /// Returns `GoudError::ResourceNotFound` if no load is in progress for
+    /// the scene.
+    pub fn cancel_scene_stream(
+        &mut self,
+        id: SceneId,
+    ) -> Result<(), crate::core::error::GoudError> {
+        if self.scene_stream_progress(id).is_none() {
+            return Err(crate::core::error::GoudError::ResourceNotFound(format!(
+                "No streamed load for scene id {}",
+                id
+            )));
+        }
+        self.destroy_scene(id)
+    }
+
     /// Unloads a scene by name.
     ///
     /// If the unloaded scene was the current scene, current scene is reset to
@@ -165,6 +273,8 @@ impl GoudContext {
     ) -> Result<(), crate::core::error::GoudError> {
         let target_id = self.scene_manager.get_scene_by_name(name);
         SceneLoader::unload_scene(&mut self.scene_manager, name)?;
+        self.scene_streams
+            .retain(|stream| Some(stream.scene()) != target_id);
 
         if Some(self.current_scene) == target_id {
             self.current_scene = self.scene_manager.default_scene();
@@ -247,6 +357,16 @@ impl GoudContext {
         self.debugger_route = route;
     }
 
+    /// Returns this context's frame arena.
+    pub fn frame_arena(&self) -> &FrameArena {
+        &self.frame_arena
+    }
+
+    /// Returns this context's frame arena for resetting.
+    pub fn frame_arena_mut(&mut self) -> &mut FrameArena {
+        &mut self.frame_arena
+    }
+
     /// Validates that this context is being accessed from the correct thread.
     ///
     /// Panics if called from a different thread than the one that created the context.
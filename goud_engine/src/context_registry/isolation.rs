@@ -0,0 +1,209 @@
+//! Thread-isolated context registries for running worlds in parallel.
+//!
+//! By default every context lives in the process-wide registry, so every FFI
+//! call on every thread takes the same mutex. A thread that calls
+//! [`isolate_current_thread`] gets a private registry instead: contexts it
+//! creates afterwards live there, and lookups from that thread lock only that
+//! registry. N isolated threads can therefore look up N worlds at once
+//! without contending on the context registry.
+//!
+//! Only the context registry is sharded. Physics, spatial, pool,
+//! networking, component storage and the other FFI registries stay
+//! process-wide, so calls into them still serialise across threads.
+//!
+//! Each isolated registry owns a shard tag stamped into the IDs it issues, so
+//! an ID passed to another thread fails validation there instead of resolving
+//! to an unrelated context.
+
+use std::cell::RefCell;
+use std::sync::Mutex;
+
+use crate::core::context_id::CONTEXT_SLOT_BITS;
+use crate::core::error::GoudError;
+
+use super::registry::GoudContextRegistry;
+
+/// Largest shard tag an isolated registry can use.
+///
+/// The all-ones tag is never issued because the invalid ID sets every bit.
+const MAX_SHARD: u32 = (1 << (32 - CONTEXT_SLOT_BITS)) - 2;
+
+type SharedRegistry = &'static Mutex<GoudContextRegistry>;
+
+/// Isolated registries no thread currently owns, plus the next unused shard.
+///
+/// Registries are leaked on first use and recycled here, so a server that
+/// spins worker threads up and down reuses a bounded set of shards.
+struct ShardPool {
+    free: Vec<SharedRegistry>,
+    next_shard: u32,
+}
+
+static SHARD_POOL: Mutex<ShardPool> = Mutex::new(ShardPool {
+    free: Vec::new(),
+    next_shard: 1,
+});
+
+/// The calling thread's registry, returned to the pool when it is dropped.
+struct Isolation(SharedRegistry);
+
+impl Drop for Isolation {
+    fn drop(&mut self) {
+        let empty = self
+            .0
+            .lock()
+            .map(|registry| registry.is_empty())
+            .unwrap_or(false);
+        // Contexts still alive here are not Send and cannot be torn down from
+        // another thread, so a registry that still holds any is leaked along
+        // with its shard rather than handed to a new owner.
+        if empty {
+            if let Ok(mut pool) = SHARD_POOL.lock() {
+                pool.free.push(self.0);
+            }
+        }
+    }
+}
+
+thread_local! {
+    static ISOLATION: RefCell<Option<Isolation>> = const { RefCell::new(None) };
+}
+
+/// Returns the calling thread's isolated registry, if it has one.
+pub(crate) fn current_thread_registry() -> Option<SharedRegistry> {
+    ISOLATION
+        .try_with(|cell| cell.borrow().as_ref().map(|isolation| isolation.0))
+        .ok()
+        .flatten()
+}
+
+/// Gives the calling thread a private context registry.
+///
+/// Contexts created on this thread afterwards are only visible to this
+/// thread. Contexts it created earlier stay in the process-wide registry and
+/// become unreachable from here, so isolate a thread before creating any.
+/// Calling this on an already isolated thread does nothing.
+///
+/// # Errors
+///
+/// Returns `GoudError::InvalidState` when every shard is owned by a live
+/// isolated thread.
+pub fn isolate_current_thread() -> Result<(), GoudError> {
+    if is_current_thread_isolated() {
+        return Ok(());
+    }
+
+    let registry = {
+        let mut pool = SHARD_POOL
+            .lock()
+            .map_err(|_| GoudError::InternalError("Failed to lock shard pool".to_string()))?;
+        match pool.free.pop() {
+            Some(registry) => registry,
+            None => {
+                if pool.next_shard > MAX_SHARD {
+                    return Err(GoudError::InvalidState(format!(
+                        "All {MAX_SHARD} isolated context registries are in use"
+                    )));
+                }
+                let shard = pool.next_shard;
+                pool.next_shard += 1;
+                &*Box::leak(Box::new(Mutex::new(GoudContextRegistry::with_shard(shard))))
+            }
+        }
+    };
+
+    ISOLATION.with(|cell| *cell.borrow_mut() = Some(Isolation(registry)));
+    Ok(())
+}
+
+/// Returns the calling thread to the process-wide registry.
+///
+/// Threads that exit while isolated release their registry automatically.
+/// Calling this on a thread that is not isolated does nothing.
+///
+/// # Errors
+///
+/// Returns `GoudError::InvalidState` while contexts created on this thread
+/// since [`isolate_current_thread`] are still alive.
+pub fn release_current_thread() -> Result<(), GoudError> {
+    let Some(registry) = current_thread_registry() else {
+        return Ok(());
+    };
+
+    let alive = registry.lock().map(|registry| registry.len()).unwrap_or(0);
+    if alive > 0 {
+        return Err(GoudError::InvalidState(format!(
+            "{alive} context(s) still alive in this thread's isolated registry"
+        )));
+    }
+
+    ISOLATION.with(|cell| cell.borrow_mut().take());
+    Ok(())
+}
+
+/// Returns true if the calling thread has a private context registry.
+pub fn is_current_thread_isolated() -> bool {
+    current_thread_registry().is_some()
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::context_registry::get_context_registry;
+
+    #[test]
+    fn isolated_threads_issue_ids_the_global_registry_rejects() {
+        let id = std::thread::spawn(|| {
+            isolate_current_thread().unwrap();
+            let mut registry = get_context_registry().lock().unwrap();
+            let id = registry.create().unwrap();
+            assert!(registry.is_valid(id));
+            assert_ne!(id.shard(), 0);
+            registry.destroy(id).unwrap();
+            id
+        })
+        .join()
+        .unwrap();
+
+        let registry = get_context_registry().lock().unwrap();
+        assert!(!registry.is_valid(id));
+    }
+
+    #[test]
+    fn isolated_registries_are_private_to_their_thread() {
+        let handles: Vec<_> = (0..4)
+            .map(|_| {
+                std::thread::spawn(|| {
+                    isolate_current_thread().unwrap();
+                    let id = get_context_registry().lock().unwrap().create().unwrap();
+                    let shard = id.shard();
+                    assert_eq!(get_context_registry().lock().unwrap().len(), 1);
+                    get_context_registry().lock().unwrap().destroy(id).unwrap();
+                    release_current_thread().unwrap();
+                    assert!(!is_current_thread_isolated());
+                    shard
+                })
+            })
+            .collect();
+        for handle in handles {
+            assert_ne!(handle.join().unwrap(), 0);
+        }
+    }
+
+    #[test]
+    fn release_refuses_while_contexts_are_alive() {
+        std::thread::spawn(|| {
+            isolate_current_thread().unwrap();
+            isolate_current_thread().unwrap();
+            let id = get_context_registry().lock().unwrap().create().unwrap();
+            assert!(matches!(
+                release_current_thread(),
+                Err(GoudError::InvalidState(_))
+            ));
+            get_context_registry().lock().unwrap().destroy(id).unwrap();
+            release_current_thread().unwrap();
+        })
+        .join()
+        .unwrap();
+    }
+}
@@ -13,11 +13,14 @@
 //! ## Thread Safety
 //!
 //! - Contexts are stored in a global registry protected by `Mutex`
+//! - A thread can opt into a private registry with
+//!   `isolation::isolate_current_thread()` so parallel worlds never share a lock
 //! - Each context owns its World (not Send+Sync)
 //! - Context operations must be called from the thread that created the context
 
 pub mod context;
 pub mod context_id;
+pub mod isolation;
 pub mod registry;
 pub mod scene;
 
@@ -13,6 +13,7 @@ use std::sync::{Arc, Mutex, OnceLock, RwLock};
 
 use super::context::GoudContext;
 use super::context_id::GoudContextId;
+use crate::core::context_id::{CONTEXT_SLOT_BITS, CONTEXT_SLOT_MASK};
 
 // =============================================================================
 // Context Slot
@@ -48,19 +49,45 @@ pub struct GoudContextRegistry {
     /// Slots for context storage.
     slots: Vec<ContextSlot>,
 
-    /// Free list of indices that can be reused.
+    /// Free list of slots that can be reused.
     free_list: Vec<u32>,
+
+    /// Shard tag stamped into the high index bits of every ID issued here.
+    ///
+    /// IDs from another shard never resolve in this registry, so a context
+    /// used on the wrong thread fails lookup instead of aliasing a neighbour.
+    shard: u32,
 }
 
 impl GoudContextRegistry {
     /// Creates a new empty registry.
     pub fn new() -> Self {
+        Self::with_shard(0)
+    }
+
+    /// Creates a new empty registry that issues IDs tagged with `shard`.
+    pub(crate) fn with_shard(shard: u32) -> Self {
         Self {
             slots: Vec::new(),
             free_list: Vec::new(),
+            shard,
         }
     }
 
+    /// Maps an ID to its slot, or `None` if it is invalid or from another shard.
+    fn slot_of(&self, id: GoudContextId) -> Option<usize> {
+        if id.is_invalid() || id.shard() != self.shard {
+            return None;
+        }
+        let slot = id.slot() as usize;
+        (slot < self.slots.len()).then_some(slot)
+    }
+
+    /// Builds the ID for `slot` at `generation`.
+    fn id_for(&self, slot: u32, generation: u32) -> GoudContextId {
+        GoudContextId::new((self.shard << CONTEXT_SLOT_BITS) | slot, generation)
+    }
+
     /// Allocates a new context and returns its ID.
     pub fn create(&mut self) -> Result<GoudContextId, GoudError> {
         self.create_with_config(
@@ -76,8 +103,8 @@ impl GoudContextRegistry {
         surface_kind: RuntimeSurfaceKind,
     ) -> Result<GoudContextId, GoudError> {
         // Try to reuse a free slot first
-        let id = if let Some(index) = self.free_list.pop() {
-            let generation = match &self.slots[index as usize] {
+        let id = if let Some(slot) = self.free_list.pop() {
+            let generation = match &self.slots[slot as usize] {
                 ContextSlot::Free { next_generation } => *next_generation,
                 ContextSlot::Occupied(_) => {
                     return Err(GoudError::InternalError(
@@ -87,23 +114,24 @@ impl GoudContextRegistry {
             };
 
             let context = GoudContext::new_with_config(generation, config.clone());
-            self.slots[index as usize] = ContextSlot::Occupied(Box::new(context));
+            self.slots[slot as usize] = ContextSlot::Occupied(Box::new(context));
 
-            GoudContextId::new(index, generation)
+            self.id_for(slot, generation)
         } else {
             // Allocate new slot
-            let index = self.slots.len() as u32;
-            if index == u32::MAX {
-                return Err(GoudError::InternalError(
-                    "Context registry full (u32::MAX contexts)".to_string(),
-                ));
+            let slot = self.slots.len() as u32;
+            if slot > CONTEXT_SLOT_MASK {
+                return Err(GoudError::InternalError(format!(
+                    "Context registry full ({} contexts)",
+                    CONTEXT_SLOT_MASK as u64 + 1
+                )));
             }
 
             let generation = 1; // Generation 0 reserved for "never allocated"
             let context = GoudContext::new_with_config(generation, config.clone());
             self.slots.push(ContextSlot::Occupied(Box::new(context)));
 
-            GoudContextId::new(index, generation)
+            self.id_for(slot, generation)
         };
 
         if config.debugger.enabled {
@@ -130,14 +158,9 @@ impl GoudContextRegistry {
 
     /// Destroys a context and frees its slot for reuse.
     pub fn destroy(&mut self, id: GoudContextId) -> Result<(), GoudError> {
-        if id.is_invalid() {
-            return Err(GoudError::InvalidContext);
-        }
-
-        let index = id.index() as usize;
-        if index >= self.slots.len() {
+        let Some(index) = self.slot_of(id) else {
             return Err(GoudError::InvalidContext);
-        }
+        };
 
         match &self.slots[index] {
             ContextSlot::Occupied(context) => {
@@ -151,7 +174,7 @@ impl GoudContextRegistry {
                 let next_generation = context.generation().checked_add(1).unwrap_or(1);
 
                 self.slots[index] = ContextSlot::Free { next_generation };
-                self.free_list.push(id.index());
+                self.free_list.push(id.slot());
 
                 if let Some(ref route_id) = route_to_remove {
                     debugger::unregister_snapshot_refresh_hook_for_route(route_id);
@@ -166,14 +189,7 @@ impl GoudContextRegistry {
 
     /// Gets an immutable reference to a context.
     pub fn get(&self, id: GoudContextId) -> Option<&GoudContext> {
-        if id.is_invalid() {
-            return None;
-        }
-
-        let index = id.index() as usize;
-        if index >= self.slots.len() {
-            return None;
-        }
+        let index = self.slot_of(id)?;
 
         match &self.slots[index] {
             ContextSlot::Occupied(context) => {
@@ -189,14 +205,7 @@ impl GoudContextRegistry {
 
     /// Gets a mutable reference to a context.
     pub fn get_mut(&mut self, id: GoudContextId) -> Option<&mut GoudContext> {
-        if id.is_invalid() {
-            return None;
-        }
-
-        let index = id.index() as usize;
-        if index >= self.slots.len() {
-            return None;
-        }
+        let index = self.slot_of(id)?;
 
         match &mut self.slots[index] {
             ContextSlot::Occupied(context) => {
@@ -340,14 +349,18 @@ unsafe impl Send for GoudContextHandle {}
 
 /// Global context registry for engine access.
 ///
-/// This is the single source of truth for all engine contexts.
-/// It's thread-safe and can be accessed from any thread, but individual
-/// contexts are single-threaded.
+/// This is the source of truth for every context created on a thread that
+/// has not been isolated (see [`super::isolation`]). It's thread-safe and can
+/// be accessed from any thread, but individual contexts are single-threaded.
 static GOUD_CONTEXT_REGISTRY_CELL: OnceLock<Mutex<GoudContextRegistry>> = OnceLock::new();
 
-/// Gets a reference to the global context registry.
+/// Gets a reference to the calling thread's context registry.
 ///
-/// Initializes the registry on first access.
+/// On an isolated thread this is the thread's private registry, whose lock
+/// no other thread ever takes; everywhere else it is the process-wide
+/// registry, initialized on first access.
 pub fn get_context_registry() -> &'static Mutex<GoudContextRegistry> {
-    GOUD_CONTEXT_REGISTRY_CELL.get_or_init(|| Mutex::new(GoudContextRegistry::new()))
+    super::isolation::current_thread_registry().unwrap_or_else(|| {
+        GOUD_CONTEXT_REGISTRY_CELL.get_or_init(|| Mutex::new(GoudContextRegistry::new()))
+    })
 }
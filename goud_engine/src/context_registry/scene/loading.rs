@@ -10,6 +10,7 @@ use crate::core::error::GoudError;
 
 use super::data::SceneData;
 use super::manager::{SceneId, SceneManager};
+use super::packed::{deserialize_packed_scene, scene_to_packed};
 use super::serialization::{deserialize_scene, scene_from_json, scene_to_json, serialize_scene};
 
 // =============================================================================
@@ -81,6 +82,52 @@ impl SceneLoader {
         Self::load_scene(manager, name, data)
     }
 
+    /// Loads a scene from packed bytes produced by
+    /// [`scene_data_to_packed`](super::packed::scene_data_to_packed) or
+    /// [`save_scene_to_packed`](Self::save_scene_to_packed).
+    ///
+    /// `bytes` is only borrowed, so it may be a memory-mapped file.  On
+    /// failure the partially loaded scene is destroyed again.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if:
+    /// - A scene with the same name already exists
+    /// - The bytes are not a valid packed scene
+    pub fn load_scene_from_packed(
+        manager: &mut SceneManager,
+        name: &str,
+        bytes: &[u8],
+    ) -> Result<SceneId, GoudError> {
+        let id = manager.create_scene(name)?;
+        let world = manager.get_scene_mut(id).ok_or_else(|| {
+            GoudError::InternalError("Scene was created but not accessible".to_string())
+        })?;
+        world.register_builtin_serializables();
+        if let Err(err) = deserialize_packed_scene(bytes, world) {
+            let _ = manager.destroy_scene(id);
+            return Err(err);
+        }
+        Ok(id)
+    }
+
+    /// Saves a scene to packed bytes.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if:
+    /// - The scene ID does not exist
+    /// - Packing fails
+    pub fn save_scene_to_packed(manager: &SceneManager, id: SceneId) -> Result<Vec<u8>, GoudError> {
+        let world = manager
+            .get_scene(id)
+            .ok_or_else(|| GoudError::ResourceNotFound(format!("Scene id {} not found", id)))?;
+        let name = manager
+            .get_scene_name(id)
+            .ok_or_else(|| GoudError::ResourceNotFound(format!("Scene id {} not found", id)))?;
+        scene_to_packed(world, name)
+    }
+
     /// Saves a scene to a JSON string.
     ///
     /// Serializes all entities and components in the scene's world,
@@ -12,16 +12,20 @@ pub mod debugger_snapshot;
 pub mod loading;
 mod manager;
 mod manager_transitions;
+pub mod packed;
 pub mod prefab;
 pub mod prefab_asset;
 pub mod serialization;
+pub mod streaming;
 pub mod transition;
 
 pub use data::*;
 pub use debugger_snapshot::*;
 pub use loading::*;
 pub use manager::{SceneId, SceneManager, DEFAULT_SCENE_NAME};
+pub use packed::*;
 pub use prefab::*;
 pub use prefab_asset::*;
 pub use serialization::*;
+pub use streaming::*;
 pub use transition::*;
@@ -0,0 +1,285 @@
+//! Packed binary scene format.
+//!
+//! JSON scenes (and [`scene_to_binary`](super::serialization::scene_to_binary),
+//! which only wraps the JSON text) are parsed into a `serde_json::Value`
+//! per component and inserted one component at a time.  A packed scene
+//! groups entities that share a component set into blocks and stores each
+//! component type as a bincode column, so loading a block spawns all of its
+//! entities straight into their archetype and fills each storage in one
+//! pass without building any intermediate JSON.
+//!
+//! Packed scenes use the same registered component types and type names as
+//! JSON scenes.  They are produced offline from JSON with
+//! [`scene_data_to_packed`] or from a live world with [`scene_to_packed`].
+//!
+//! # Layout
+//!
+//! All integers are little-endian `u32`s.
+//!
+//! ```text
+//! "GSPK" version name_len name block_count block*
+//! block:  entity_count (index generation)*entity_count column_count column*
+//! column: name_len type_name byte_len bincode_components
+//! ```
+
+use std::collections::HashMap;
+
+use crate::core::error::GoudError;
+use crate::ecs::entity::Entity;
+use crate::ecs::World;
+
+use super::data::{EntityRemap, SceneData, SerializedEntity};
+use super::serialization::{deserialize_scene, remap_entity_references};
+
+/// Leading bytes of every packed scene.
+pub const PACKED_SCENE_MAGIC: [u8; 4] = *b"GSPK";
+
+/// Packed scene layout version written by this build.
+pub const PACKED_SCENE_VERSION: u32 = 1;
+
+/// Most entities [`scene_to_packed`] writes into one block.
+///
+/// Blocks are the unit of work of a
+/// [`StreamedSceneLoad`](super::streaming::StreamedSceneLoad), so this
+/// bounds the time a single streaming step can take.
+pub const PACKED_BLOCK_ENTITIES: usize = 1024;
+
+/// Error for bytes that do not form a valid packed scene.
+pub(super) fn packed_error(what: &str) -> GoudError {
+    GoudError::InternalError(format!("Invalid packed scene: {what}"))
+}
+
+// =============================================================================
+// Writing
+// =============================================================================
+
+fn push_u32(out: &mut Vec<u8>, value: usize) -> Result<(), GoudError> {
+    let value = u32::try_from(value).map_err(|_| packed_error("section exceeds 4 GiB"))?;
+    out.extend_from_slice(&value.to_le_bytes());
+    Ok(())
+}
+
+fn push_str(out: &mut Vec<u8>, value: &str) -> Result<(), GoudError> {
+    push_u32(out, value.len())?;
+    out.extend_from_slice(value.as_bytes());
+    Ok(())
+}
+
+/// Packs every entity of `world` with serializable components.
+///
+/// Entities are written in blocks of up to [`PACKED_BLOCK_ENTITIES`] that
+/// share an archetype, with one column per registered serializable
+/// component of that archetype.  Entities with no
+/// serializable components are skipped, as in
+/// [`serialize_scene`](super::serialization::serialize_scene).
+///
+/// # Errors
+///
+/// Returns [`GoudError::InternalError`] if a component fails to encode.
+pub fn scene_to_packed(world: &World, name: &str) -> Result<Vec<u8>, GoudError> {
+    let mut out = Vec::new();
+    out.extend_from_slice(&PACKED_SCENE_MAGIC);
+    out.extend_from_slice(&PACKED_SCENE_VERSION.to_le_bytes());
+    push_str(&mut out, name)?;
+
+    let count_at = out.len();
+    out.extend_from_slice(&0u32.to_le_bytes());
+    let mut blocks = 0u32;
+    let mut column = Vec::new();
+    for archetype in world.archetypes().iter() {
+        let mut names: Vec<&str> = archetype
+            .components()
+            .iter()
+            .filter_map(|&id| world.serializable_type_name(id))
+            .collect();
+        if names.is_empty() {
+            continue;
+        }
+        names.sort_unstable();
+
+        for entities in archetype.entities().chunks(PACKED_BLOCK_ENTITIES) {
+            push_u32(&mut out, entities.len())?;
+            for &entity in entities {
+                out.extend_from_slice(&entity.index().to_le_bytes());
+                out.extend_from_slice(&entity.generation().to_le_bytes());
+            }
+            push_u32(&mut out, names.len())?;
+            for &type_name in &names {
+                column.clear();
+                if !world.encode_component_column(type_name, entities, &mut column) {
+                    return Err(GoudError::InternalError(format!(
+                        "Failed to encode component '{type_name}' for packed scene"
+                    )));
+                }
+                push_str(&mut out, type_name)?;
+                push_u32(&mut out, column.len())?;
+                out.extend_from_slice(&column);
+            }
+            blocks += 1;
+        }
+    }
+    out[count_at..count_at + 4].copy_from_slice(&blocks.to_le_bytes());
+    Ok(out)
+}
+
+/// Converts a JSON-schema [`SceneData`] into a packed scene.
+///
+/// This is the offline converter: the scene is loaded into a scratch world
+/// with the built-in serializable components, exactly as
+/// [`SceneLoader::load_scene`](super::loading::SceneLoader::load_scene)
+/// would, and that world is packed.  Components the JSON loader would skip
+/// are dropped.
+///
+/// # Errors
+///
+/// Returns an error if deserialization or packing fails.
+pub fn scene_data_to_packed(data: &SceneData) -> Result<Vec<u8>, GoudError> {
+    let mut world = World::new();
+    world.register_builtin_serializables();
+    deserialize_scene(data, &mut world)?;
+    scene_to_packed(&world, &data.name)
+}
+
+// =============================================================================
+// Reading
+// =============================================================================
+
+/// Cursor over packed scene bytes; every read is bounds-checked.
+pub(super) struct Reader<'a> {
+    bytes: &'a [u8],
+}
+
+impl<'a> Reader<'a> {
+    pub(super) fn new(bytes: &'a [u8]) -> Self {
+        Self { bytes }
+    }
+
+    /// Bytes not read yet.
+    pub(super) fn remaining(&self) -> usize {
+        self.bytes.len()
+    }
+
+    fn take(&mut self, len: usize) -> Result<&'a [u8], GoudError> {
+        if self.bytes.len() < len {
+            return Err(packed_error("unexpected end of data"));
+        }
+        let (head, tail) = self.bytes.split_at(len);
+        self.bytes = tail;
+        Ok(head)
+    }
+
+    fn u32(&mut self) -> Result<u32, GoudError> {
+        let bytes = self.take(4)?;
+        Ok(u32::from_le_bytes([bytes[0], bytes[1], bytes[2], bytes[3]]))
+    }
+
+    fn len(&mut self) -> Result<usize, GoudError> {
+        self.u32().map(|value| value as usize)
+    }
+
+    fn str(&mut self) -> Result<&'a str, GoudError> {
+        let len = self.len()?;
+        std::str::from_utf8(self.take(len)?).map_err(|_| packed_error("name is not UTF-8"))
+    }
+
+    /// Reads the scene header and returns the block count.
+    pub(super) fn header(&mut self) -> Result<u32, GoudError> {
+        if self.take(4)? != PACKED_SCENE_MAGIC {
+            return Err(packed_error("bad magic"));
+        }
+        let version = self.u32()?;
+        if version != PACKED_SCENE_VERSION {
+            return Err(packed_error(&format!("unsupported version {version}")));
+        }
+        self.str()?;
+        self.u32()
+    }
+
+    /// Reads the next block without decoding its columns.
+    pub(super) fn block(&mut self) -> Result<PackedBlock<'a>, GoudError> {
+        let count = self.len()?;
+        let ids = self.take(
+            count
+                .checked_mul(8)
+                .ok_or_else(|| packed_error("bad count"))?,
+        )?;
+        let column_count = self.u32()?;
+        let mut columns = Vec::with_capacity(column_count.min(64) as usize);
+        for _ in 0..column_count {
+            let type_name = self.str()?;
+            let len = self.len()?;
+            columns.push((type_name, self.take(len)?));
+        }
+        Ok(PackedBlock { ids, columns })
+    }
+}
+
+/// One block of a packed scene, borrowed from the scene bytes.
+pub(super) struct PackedBlock<'a> {
+    /// `(index, generation)` pairs of the packed entities.
+    ids: &'a [u8],
+    /// Type name and bincode bytes of each column.
+    columns: Vec<(&'a str, &'a [u8])>,
+}
+
+impl PackedBlock<'_> {
+    /// Number of entities in the block.
+    pub(super) fn entity_count(&self) -> usize {
+        self.ids.len() / 8
+    }
+
+    /// Spawns the block's entities into `world` and records them in `remap`.
+    ///
+    /// Returns the spawned entities in block order.
+    pub(super) fn spawn(
+        &self,
+        world: &mut World,
+        remap: &mut HashMap<SerializedEntity, Entity>,
+    ) -> Result<Vec<Entity>, GoudError> {
+        let spawned = world
+            .spawn_with_component_columns(self.entity_count(), &self.columns)
+            .ok_or_else(|| packed_error("component column does not decode"))?;
+        for (id, &entity) in self.ids.chunks_exact(8).zip(&spawned) {
+            let id = SerializedEntity {
+                index: u32::from_le_bytes([id[0], id[1], id[2], id[3]]),
+                generation: u32::from_le_bytes([id[4], id[5], id[6], id[7]]),
+            };
+            remap.insert(id, entity);
+        }
+        Ok(spawned)
+    }
+}
+
+/// Loads a packed scene into `world`, spawning one entity per packed entity.
+///
+/// Component types must be registered as serializable on `world`; columns
+/// of other types are skipped.  Like
+/// [`deserialize_scene`](super::serialization::deserialize_scene), entity
+/// references in [`Parent`](crate::ecs::components::hierarchy::Parent) and
+/// [`Children`](crate::ecs::components::hierarchy::Children) are remapped
+/// to the new entities.
+///
+/// `bytes` is only borrowed, so it may be a memory-mapped file.
+///
+/// # Errors
+///
+/// Returns [`GoudError::InternalError`] if `bytes` is not a packed scene of
+/// a supported version or a column fails to decode.  Blocks loaded before
+/// the failure stay in the world.
+pub fn deserialize_packed_scene(bytes: &[u8], world: &mut World) -> Result<EntityRemap, GoudError> {
+    let mut reader = Reader::new(bytes);
+    let mut remap = HashMap::new();
+    for _ in 0..reader.header()? {
+        reader.block()?.spawn(world, &mut remap)?;
+    }
+    if reader.remaining() != 0 {
+        return Err(packed_error("trailing data"));
+    }
+
+    remap_entity_references(world, &remap);
+    Ok(EntityRemap(remap))
+}
+
+#[cfg(test)]
+#[path = "packed_tests.rs"]
+mod tests;
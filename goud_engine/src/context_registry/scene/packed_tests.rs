@@ -0,0 +1,148 @@
+use super::*;
+use crate::context_registry::scene::loading::SceneLoader;
+use crate::context_registry::scene::manager::SceneManager;
+use crate::context_registry::scene::serialization::{
+    scene_from_json, scene_to_json, serialize_scene,
+};
+use crate::core::math::Vec2;
+use crate::ecs::components::hierarchy::{Children, Name, Parent};
+use crate::ecs::components::Transform2D;
+use crate::ecs::entity::Entity;
+
+/// A parent with named children, plus a few transform-only entities.
+fn sample_world() -> World {
+    let mut world = World::new();
+    world.register_builtin_serializables();
+    let root = world.spawn_empty();
+    world.insert(root, Name::new("root"));
+    let mut children = Vec::new();
+    for i in 0..3 {
+        let child = world.spawn_empty();
+        world.insert(child, Name::new(format!("child{i}")));
+        world.insert(child, Parent::new(root));
+        world.insert(
+            child,
+            Transform2D::new(Vec2::new(i as f32, 2.0), 0.5, Vec2::one()),
+        );
+        children.push(child);
+    }
+    world.insert(root, Children::from_slice(&children));
+    for i in 0..4 {
+        let prop = world.spawn_empty();
+        world.insert(
+            prop,
+            Transform2D::new(Vec2::new(-(i as f32), 0.0), 0.0, Vec2::one()),
+        );
+    }
+    world.spawn_empty();
+    world
+}
+
+fn loaded_world(bytes: &[u8]) -> (World, EntityRemap) {
+    let mut world = World::new();
+    world.register_builtin_serializables();
+    let remap = deserialize_packed_scene(bytes, &mut world).unwrap();
+    (world, remap)
+}
+
+fn named(world: &World, name: &str) -> Entity {
+    world
+        .archetypes()
+        .iter()
+        .flat_map(|archetype| archetype.entities().iter().copied())
+        .find(|&entity| world.get::<Name>(entity).map(Name::as_str) == Some(name))
+        .unwrap()
+}
+
+#[test]
+fn test_packed_roundtrip_keeps_components_and_hierarchy() {
+    let source = sample_world();
+    let bytes = scene_to_packed(&source, "level").unwrap();
+    assert!(bytes.starts_with(&PACKED_SCENE_MAGIC));
+
+    let (world, remap) = loaded_world(&bytes);
+    assert_eq!(world.entity_count(), 8, "the bare entity is skipped");
+    assert_eq!(remap.0.len(), 8);
+
+    let root = named(&world, "root");
+    for i in 0..3 {
+        let child = named(&world, &format!("child{i}"));
+        assert_eq!(world.get::<Parent>(child).unwrap().get(), root);
+        assert_eq!(
+            world.get::<Transform2D>(child).unwrap().position,
+            Vec2::new(i as f32, 2.0)
+        );
+        assert!(world.get::<Children>(root).unwrap().contains(child));
+    }
+
+    for data in serialize_scene(&source, "level").unwrap().entities {
+        let loaded = world.serialize_entity(remap.0[&data.id]).unwrap();
+        let mut names: Vec<&String> = loaded["components"].as_object().unwrap().keys().collect();
+        let mut expected: Vec<&String> = data.components.keys().collect();
+        names.sort();
+        expected.sort();
+        assert_eq!(names, expected);
+    }
+}
+
+#[test]
+fn test_packed_from_json_matches_json_load() {
+    let json = scene_to_json(&serialize_scene(&sample_world(), "level").unwrap()).unwrap();
+    let bytes = scene_data_to_packed(&scene_from_json(&json).unwrap()).unwrap();
+    assert!(bytes.len() < json.len());
+
+    let mut mgr = SceneManager::new();
+    let from_json = SceneLoader::load_scene_from_json(&mut mgr, "json", &json).unwrap();
+    let from_packed = SceneLoader::load_scene_from_packed(&mut mgr, "packed", &bytes).unwrap();
+    let json_world = mgr.get_scene(from_json).unwrap();
+    let packed_world = mgr.get_scene(from_packed).unwrap();
+    assert_eq!(json_world.entity_count(), packed_world.entity_count());
+    let json_root = named(json_world, "root");
+    let packed_root = named(packed_world, "root");
+    assert_eq!(
+        json_world.get::<Children>(json_root).unwrap().len(),
+        packed_world.get::<Children>(packed_root).unwrap().len()
+    );
+
+    let saved = SceneLoader::save_scene_to_packed(&mgr, from_packed).unwrap();
+    let (resaved, _) = loaded_world(&saved);
+    assert_eq!(resaved.entity_count(), packed_world.entity_count());
+}
+
+#[test]
+fn test_invalid_packed_scenes_are_rejected() {
+    let bytes = scene_to_packed(&sample_world(), "level").unwrap();
+    let mut world = World::new();
+    world.register_builtin_serializables();
+
+    assert!(deserialize_packed_scene(b"{\"name\":1}", &mut world).is_err());
+    let mut version = bytes.clone();
+    version[4] = 9;
+    assert!(deserialize_packed_scene(&version, &mut world).is_err());
+    let mut trailing = bytes.clone();
+    trailing.push(0);
+    assert!(deserialize_packed_scene(&trailing, &mut world).is_err());
+    for cut in [3, 12, bytes.len() / 2, bytes.len() - 1] {
+        world.clear();
+        assert!(deserialize_packed_scene(&bytes[..cut], &mut world).is_err());
+    }
+
+    let mut mgr = SceneManager::new();
+    assert!(SceneLoader::load_scene_from_packed(&mut mgr, "level", &bytes[..20]).is_err());
+    assert!(
+        mgr.get_scene_by_name("level").is_none(),
+        "a failed load leaves no scene behind"
+    );
+    assert!(SceneLoader::load_scene_from_packed(&mut mgr, "level", &bytes).is_ok());
+}
+
+#[test]
+fn test_columns_of_unregistered_types_are_skipped() {
+    let bytes = scene_to_packed(&sample_world(), "level").unwrap();
+    let mut world = World::new();
+    world.register_serializable::<Name>();
+    deserialize_packed_scene(&bytes, &mut world).unwrap();
+    assert_eq!(world.entity_count(), 8);
+    let root = named(&world, "root");
+    assert!(!world.has::<Children>(root));
+}
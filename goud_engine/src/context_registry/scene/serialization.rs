@@ -180,11 +180,23 @@ pub fn scene_from_binary(bytes: &[u8]) -> Result<SceneData, GoudError> {
 ///   it with the corresponding new entity.
 /// - If it has a `Children` component, replace each child entity that matches
 ///   an old ID.
-fn remap_entity_references(world: &mut World, remap: &HashMap<SerializedEntity, Entity>) {
+pub(super) fn remap_entity_references(
+    world: &mut World,
+    remap: &HashMap<SerializedEntity, Entity>,
+) {
     // Collect the new entities that need remapping.
     let new_entities: Vec<Entity> = remap.values().copied().collect();
+    remap_entities(world, &new_entities, remap);
+}
 
-    for &entity in &new_entities {
+/// Fixes the [`Parent`] and [`Children`] references of `entities` using the
+/// remap table, as [`remap_entity_references`] does for every new entity.
+pub(super) fn remap_entities(
+    world: &mut World,
+    entities: &[Entity],
+    remap: &HashMap<SerializedEntity, Entity>,
+) {
+    for &entity in entities {
         // Remap Parent.
         if let Some(parent) = world.get::<Parent>(entity) {
             let old_parent = parent.get();
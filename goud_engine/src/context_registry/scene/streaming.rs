@@ -0,0 +1,180 @@
+//! Streamed scene loading under a per-frame time budget.
+//!
+//! [`SceneLoader::load_scene_from_packed`](super::loading::SceneLoader::load_scene_from_packed)
+//! spawns a whole scene in one call.  A [`StreamedSceneLoad`] creates the
+//! scene up front and then spawns one packed block at a time from
+//! [`step`](StreamedSceneLoad::step), stopping once the frame's budget is
+//! spent, so loading screens keep animating and open-world chunk loads do
+//! not stall a frame.  Progress is a value in `[0.0, 1.0]`, like
+//! [`SceneManager::transition_progress`].
+
+use std::collections::HashMap;
+use std::time::{Duration, Instant};
+
+use crate::core::error::GoudError;
+use crate::ecs::entity::Entity;
+
+use super::data::SerializedEntity;
+use super::manager::{SceneId, SceneManager};
+use super::packed::{packed_error, Reader};
+use super::serialization::remap_entities;
+
+/// Entities whose hierarchy references are fixed between budget checks.
+const REMAP_CHUNK: usize = 1024;
+
+/// An in-progress packed scene load spread across frames.
+///
+/// The scene exists (and can be queried) from [`begin`](Self::begin) on,
+/// but only holds every entity once [`is_complete`](Self::is_complete).
+/// Entities are spawned block by block first; [`Parent`] and [`Children`]
+/// references are remapped in a final phase, as for a blocking load.
+///
+/// [`Parent`]: crate::ecs::components::hierarchy::Parent
+/// [`Children`]: crate::ecs::components::hierarchy::Children
+///
+/// # Example
+///
+/// ```ignore
+/// let mut stream = StreamedSceneLoad::begin(&mut manager, "level_2", bytes)?;
+/// // Each frame:
+/// let progress = stream.step(&mut manager, Duration::from_micros(2000))?;
+/// if stream.is_complete() {
+///     manager.start_transition(current, stream.scene(), TransitionType::Fade, 0.5)?;
+/// }
+/// ```
+pub struct StreamedSceneLoad {
+    scene: SceneId,
+    bytes: Vec<u8>,
+    /// Offset of the next unread block in `bytes`.
+    cursor: usize,
+    blocks_left: u32,
+    /// Entities in the whole scene.
+    total: usize,
+    /// Entities spawned so far, in load order.
+    spawned: Vec<Entity>,
+    /// Leading entries of `spawned` whose references are remapped.
+    remapped: usize,
+    remap: HashMap<SerializedEntity, Entity>,
+}
+
+impl StreamedSceneLoad {
+    /// Validates packed scene `bytes` and creates the empty scene `name`.
+    ///
+    /// The whole layout is checked here, so later steps only fail on
+    /// component data that does not decode.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if the bytes are not a valid packed scene or a scene
+    /// with the same name already exists.
+    pub fn begin(
+        manager: &mut SceneManager,
+        name: &str,
+        bytes: Vec<u8>,
+    ) -> Result<Self, GoudError> {
+        let mut reader = Reader::new(&bytes);
+        let blocks_left = reader.header()?;
+        let cursor = bytes.len() - reader.remaining();
+        let mut total = 0usize;
+        for _ in 0..blocks_left {
+            total += reader.block()?.entity_count();
+        }
+        if reader.remaining() != 0 {
+            return Err(packed_error("trailing data"));
+        }
+
+        let scene = manager.create_scene(name)?;
+        if let Some(world) = manager.get_scene_mut(scene) {
+            world.register_builtin_serializables();
+        }
+        Ok(Self {
+            scene,
+            bytes,
+            cursor,
+            blocks_left,
+            total,
+            spawned: Vec::with_capacity(total),
+            remapped: 0,
+            remap: HashMap::with_capacity(total),
+        })
+    }
+
+    /// The scene being loaded.
+    pub fn scene(&self) -> SceneId {
+        self.scene
+    }
+
+    /// Returns `true` once every entity is spawned and remapped.
+    pub fn is_complete(&self) -> bool {
+        self.blocks_left == 0 && self.remapped == self.spawned.len()
+    }
+
+    /// Load progress in `[0.0, 1.0]`; spawning and remapping each count
+    /// for half.
+    pub fn progress(&self) -> f32 {
+        if self.is_complete() {
+            return 1.0;
+        }
+        if self.total == 0 {
+            return 0.0;
+        }
+        let done = self.spawned.len() + self.remapped;
+        (done as f64 / (2 * self.total) as f64).min(1.0) as f32
+    }
+
+    /// Loads blocks until `budget` is spent or the scene is complete.
+    ///
+    /// At least one block (or remap chunk) is processed per call, so a zero
+    /// budget still makes progress.  A block is never split, so a step can
+    /// overrun the budget by up to one block's load time.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if the scene no longer exists or a block fails to
+    /// decode.  The scene then holds a partial load; callers normally
+    /// destroy it.
+    ///
+    /// # Returns
+    ///
+    /// The progress after this step.
+    pub fn step(&mut self, manager: &mut SceneManager, budget: Duration) -> Result<f32, GoudError> {
+        let world = manager.get_scene_mut(self.scene).ok_or_else(|| {
+            GoudError::ResourceNotFound(format!("Scene id {} not found", self.scene))
+        })?;
+        let start = Instant::now();
+        while !self.is_complete() {
+            if self.blocks_left > 0 {
+                let mut reader = Reader::new(&self.bytes[self.cursor..]);
+                let entities = reader.block()?.spawn(world, &mut self.remap)?;
+                self.cursor = self.bytes.len() - reader.remaining();
+                self.blocks_left -= 1;
+                self.spawned.extend(entities);
+            } else {
+                let end = (self.remapped + REMAP_CHUNK).min(self.spawned.len());
+                remap_entities(world, &self.spawned[self.remapped..end], &self.remap);
+                self.remapped = end;
+            }
+            if start.elapsed() >= budget {
+                break;
+            }
+        }
+        if self.is_complete() {
+            self.bytes = Vec::new();
+            self.remap = HashMap::new();
+        }
+        Ok(self.progress())
+    }
+}
+
+impl std::fmt::Debug for StreamedSceneLoad {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        f.debug_struct("StreamedSceneLoad")
+            .field("scene", &self.scene)
+            .field("progress", &self.progress())
+            .finish()
+    }
+}
+
+#[cfg(test)]
+#[path = "streaming_tests.rs"]
+mod tests;
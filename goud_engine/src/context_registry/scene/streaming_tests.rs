@@ -0,0 +1,97 @@
+use super::*;
+use crate::context_registry::scene::packed::{scene_to_packed, PACKED_BLOCK_ENTITIES};
+use crate::core::math::Vec2;
+use crate::ecs::components::hierarchy::{Children, Name, Parent};
+use crate::ecs::components::Transform2D;
+use crate::ecs::World;
+
+/// A root with `count` children, packed into several blocks.
+fn packed_scene(count: usize) -> Vec<u8> {
+    let mut world = World::new();
+    world.register_builtin_serializables();
+    let root = world.spawn_empty();
+    world.insert(root, Name::new("root"));
+    let children: Vec<Entity> = (0..count)
+        .map(|i| {
+            let child = world.spawn_empty();
+            world.insert(child, Parent::new(root));
+            world.insert(
+                child,
+                Transform2D::new(Vec2::new(i as f32, 0.0), 0.0, Vec2::one()),
+            );
+            child
+        })
+        .collect();
+    world.insert(root, Children::from_slice(&children));
+    scene_to_packed(&world, "streamed").unwrap()
+}
+
+fn root_of(world: &World) -> Entity {
+    world
+        .archetypes()
+        .iter()
+        .flat_map(|archetype| archetype.entities().iter().copied())
+        .find(|&entity| world.has::<Children>(entity))
+        .unwrap()
+}
+
+#[test]
+fn test_stream_loads_in_steps_and_reports_monotonic_progress() {
+    let count = PACKED_BLOCK_ENTITIES * 3 + 10;
+    let mut manager = SceneManager::new();
+    let mut stream = StreamedSceneLoad::begin(&mut manager, "level", packed_scene(count)).unwrap();
+    let scene = stream.scene();
+    assert_eq!(manager.get_scene(scene).unwrap().entity_count(), 0);
+    assert_eq!(stream.progress(), 0.0);
+
+    let mut steps = 0;
+    let mut last = 0.0;
+    while !stream.is_complete() {
+        let progress = stream.step(&mut manager, Duration::ZERO).unwrap();
+        assert!(progress > last && progress <= 1.0, "progress must advance");
+        last = progress;
+        steps += 1;
+    }
+    assert_eq!(last, 1.0);
+    assert!(steps >= 5, "a zero budget loads one block per step");
+    assert_eq!(stream.step(&mut manager, Duration::ZERO).unwrap(), 1.0);
+
+    let world = manager.get_scene(scene).unwrap();
+    assert_eq!(world.entity_count(), count + 1);
+    let root = root_of(world);
+    let children = world.get::<Children>(root).unwrap();
+    assert_eq!(children.len(), count);
+    for &child in children.as_slice() {
+        assert_eq!(world.get::<Parent>(child).unwrap().get(), root);
+    }
+}
+
+#[test]
+fn test_stream_finishes_in_one_step_with_a_large_budget() {
+    let mut manager = SceneManager::new();
+    let mut stream = StreamedSceneLoad::begin(&mut manager, "level", packed_scene(100)).unwrap();
+    let progress = stream.step(&mut manager, Duration::from_secs(60)).unwrap();
+    assert_eq!(progress, 1.0);
+    assert!(stream.is_complete());
+}
+
+#[test]
+fn test_stream_rejects_invalid_data_before_creating_the_scene() {
+    let bytes = packed_scene(10);
+    let mut manager = SceneManager::new();
+    let truncated = bytes[..bytes.len() - 1].to_vec();
+    assert!(StreamedSceneLoad::begin(&mut manager, "level", truncated).is_err());
+    assert!(manager.get_scene_by_name("level").is_none());
+
+    let stream = StreamedSceneLoad::begin(&mut manager, "level", bytes.clone()).unwrap();
+    assert!(StreamedSceneLoad::begin(&mut manager, "level", bytes).is_err());
+    manager.destroy_scene(stream.scene()).unwrap();
+}
+
+#[test]
+fn test_stream_step_fails_once_its_scene_is_gone() {
+    let mut manager = SceneManager::new();
+    let mut stream = StreamedSceneLoad::begin(&mut manager, "level", packed_scene(10)).unwrap();
+    manager.destroy_scene(stream.scene()).unwrap();
+    assert!(stream.step(&mut manager, Duration::ZERO).is_err());
+}
@@ -224,6 +224,25 @@ fn test_registry_is_valid() {
     assert!(!registry.is_valid(id));
 }
 
+#[test]
+fn test_registry_shard_tags_ids() {
+    let mut global = GoudContextRegistry::new();
+    let mut sharded = GoudContextRegistry::with_shard(3);
+    let global_id = global.create().unwrap();
+    let sharded_id = sharded.create().unwrap();
+
+    assert_eq!(sharded_id.shard(), 3);
+    assert_eq!(sharded_id.slot(), global_id.slot());
+    assert!(!global.is_valid(sharded_id));
+    assert!(!sharded.is_valid(global_id));
+    assert!(global.destroy(sharded_id).is_err());
+
+    sharded.destroy(sharded_id).unwrap();
+    let reused = sharded.create().unwrap();
+    assert_eq!(reused.shard(), 3);
+    assert_eq!(reused.slot(), sharded_id.slot());
+}
+
 #[test]
 fn test_registry_debug() {
     let mut registry = GoudContextRegistry::new();
@@ -6,6 +6,9 @@
 //! [`reset`](FrameArena::reset) is called, avoiding per-object deallocation
 //! overhead.
 
+use std::alloc::Layout;
+use std::ptr::NonNull;
+
 use bumpalo::Bump;
 
 use super::stats::ArenaStats;
@@ -72,6 +75,15 @@ impl FrameArena {
         self.bump.alloc_slice_copy(src)
     }
 
+    /// Allocate uninitialised memory for `layout` in the arena.
+    ///
+    /// Returns `None` if the backing allocation fails. The memory is valid
+    /// until the next call to [`reset`](Self::reset).
+    #[inline]
+    pub fn alloc_layout(&self, layout: Layout) -> Option<NonNull<u8>> {
+        self.bump.try_alloc_layout(layout).ok()
+    }
+
     /// Reset the arena, freeing all allocations at once.
     ///
     /// This is an O(n) operation over the number of backing chunks, but
@@ -132,6 +144,16 @@ mod tests {
         assert_eq!(*c, 3);
     }
 
+    #[test]
+    fn test_alloc_layout_is_aligned() {
+        let arena = FrameArena::new();
+        arena.alloc(1u8);
+        let layout = Layout::from_size_align(256, 64).unwrap();
+        let ptr = arena.alloc_layout(layout).unwrap();
+        assert_eq!(ptr.as_ptr() as usize % 64, 0);
+        assert!(arena.stats().bytes_allocated >= 256);
+    }
+
     #[test]
     fn test_reset() {
         let mut arena = FrameArena::new();
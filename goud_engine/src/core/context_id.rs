@@ -18,14 +18,25 @@
 #[derive(Clone, Copy, PartialEq, Eq, Hash, Debug)]
 pub struct GoudContextId(u64);
 
+/// Number of low index bits that address a slot within one registry.
+///
+/// The remaining high index bits name the registry shard: 0 for the
+/// process-wide registry, non-zero for a thread-isolated registry.
+pub(crate) const CONTEXT_SLOT_BITS: u32 = 20;
+
+/// Mask selecting the slot bits of a context index.
+pub(crate) const CONTEXT_SLOT_MASK: u32 = (1 << CONTEXT_SLOT_BITS) - 1;
+
 impl GoudContextId {
     /// Creates a new context ID from index and generation.
     ///
     /// # Layout
     ///
     /// ```text
-    /// | 32 bits: generation | 32 bits: index |
+    /// | 32 bits: generation | 12 bits: shard | 20 bits: slot |
     /// ```
+    ///
+    /// The shard and slot together form the 32-bit index.
     pub(crate) fn new(index: u32, generation: u32) -> Self {
         let packed = ((generation as u64) << 32) | (index as u64);
         Self(packed)
@@ -36,6 +47,19 @@ impl GoudContextId {
         self.0 as u32
     }
 
+    /// Returns the registry shard encoded in the index's high bits.
+    pub(crate) fn shard(self) -> u32 {
+        self.index() >> CONTEXT_SLOT_BITS
+    }
+
+    /// Returns the slot within the owning registry (index low bits).
+    ///
+    /// Per-thread side tables indexed by context must use this rather than
+    /// [`index`](Self::index), which carries the shard tag.
+    pub(crate) fn slot(self) -> u32 {
+        self.index() & CONTEXT_SLOT_MASK
+    }
+
     /// Returns the generation component (upper 32 bits).
     pub(crate) fn generation(self) -> u32 {
         (self.0 >> 32) as u32
@@ -48,6 +48,8 @@ pub use runtime::end_frame;
 pub use runtime::fps_stats_for_context;
 #[doc(inline)]
 pub use runtime::get_memory_summary_for_context;
+#[doc(inline)]
+pub use runtime::metrics_counters_for_context;
 pub(crate) use runtime::new_deferred_capture;
 #[doc(inline)]
 pub use runtime::profiler_enabled_for_context;
@@ -107,6 +109,8 @@ pub use runtime::update_memory_category_for_context;
 #[doc(inline)]
 pub use runtime::update_render_stats_for_context;
 #[doc(inline)]
+pub use runtime::update_sprite_culling_for_context;
+#[doc(inline)]
 pub use runtime::with_snapshot_mut;
 #[doc(inline)]
 pub use runtime::AttachAcceptedV1;
@@ -126,6 +130,8 @@ pub use runtime::RawFramebufferReadbackV1;
 #[doc(inline)]
 pub use runtime::RouteControlStateV1;
 #[doc(inline)]
+pub use runtime::RouteMetricsCounters;
+#[doc(inline)]
 pub use runtime::SyntheticInputEventV1;
 #[doc(inline)]
 pub use snapshot::default_capabilities;
@@ -30,10 +30,11 @@ pub(crate) use capture::{
     new_deferred_capture, register_deferred_capture_hook_for_route, DeferredCapture,
 };
 pub use context_updates::{
-    fps_stats_for_context, get_memory_summary_for_context, set_selected_entity_for_context,
-    set_service_state_for_context, set_snapshot_network_stats_for_context,
-    update_fps_stats_for_context, update_memory_category_for_context,
-    update_render_stats_for_context,
+    fps_stats_for_context, get_memory_summary_for_context, metrics_counters_for_context,
+    set_selected_entity_for_context, set_service_state_for_context,
+    set_snapshot_network_stats_for_context, update_fps_stats_for_context,
+    update_memory_category_for_context, update_render_stats_for_context,
+    update_sprite_culling_for_context, RouteMetricsCounters,
 };
 pub use control::{
     control_state_for_route, dispatch_request_json_for_route, take_frame_control_for_route,
@@ -90,6 +91,7 @@ pub fn register_context(
             .entry(route_id.context_id)
             .or_insert_with(|| initialize_route_state(route_id.clone(), surface_kind, config));
         runtime.touch_manifest();
+        sync_route_count(Some(runtime));
         route_id
     };
     republish_manifest();
@@ -106,6 +108,7 @@ pub fn unregister_context(context_id: GoudContextId) {
     let route_key = raw_context_key(context_id);
     attach::detach_sessions_for_route(runtime, route_key);
     runtime.routes.remove(&route_key);
+    sync_route_count(Some(runtime));
 
     if runtime.routes.is_empty() {
         attach::stop_local_attach_server(runtime);
@@ -187,6 +190,7 @@ pub fn begin_frame(route_id: &RuntimeRouteId, index: u64, delta_seconds: f32, to
         route.snapshot.frame.total_seconds = total_seconds;
         route.snapshot.profiler_samples.clear();
         route.snapshot.stats.render = Default::default();
+        route.snapshot.stats.render_metrics = Default::default();
         sync_debugger_state(route);
     });
 }
@@ -366,6 +370,7 @@ pub(crate) fn reset_for_tests() {
         artifacts::cleanup(runtime);
     }
     *guard = None;
+    sync_route_count(None);
     CURRENT_ROUTE.with(|cell| {
         cell.replace(None);
     });
@@ -1,4 +1,4 @@
-use super::super::snapshot::MemorySummaryV1;
+use super::super::snapshot::{MemorySummaryV1, NetworkStatsV1, RenderMetricsV1};
 use super::super::types::CapabilityStateV1;
 use crate::core::context_id::GoudContextId;
 
@@ -86,6 +86,31 @@ pub fn update_render_stats_for_context(
     .unwrap_or(false)
 }
 
+/// Appends culled sprite counts to the current frame's render metrics.
+///
+/// `drawn` sprites passed culling and `culled` sprites were rejected; both
+/// count towards `sprites_submitted`.  One call records one batch of
+/// `draw_calls` draw calls.
+pub fn update_sprite_culling_for_context(
+    context_id: GoudContextId,
+    drawn: u32,
+    culled: u32,
+    draw_calls: u32,
+) -> bool {
+    with_route_state_mut_by_context(context_id, |route| {
+        let metrics = &mut route.snapshot.stats.render_metrics;
+        metrics.sprites_drawn = metrics.sprites_drawn.saturating_add(drawn);
+        metrics.sprites_culled = metrics.sprites_culled.saturating_add(culled);
+        metrics.sprites_submitted = metrics.sprites_drawn.saturating_add(metrics.sprites_culled);
+        metrics.draw_call_count = metrics.draw_call_count.saturating_add(draw_calls);
+        metrics.batches_submitted = metrics.batches_submitted.saturating_add(1);
+        metrics.avg_sprites_per_batch =
+            metrics.sprites_drawn as f32 / metrics.batches_submitted as f32;
+        true
+    })
+    .unwrap_or(false)
+}
+
 /// Updates one tracked memory category for the given context.
 pub fn update_memory_category_for_context(
     context_id: GoudContextId,
@@ -121,6 +146,35 @@ pub fn get_memory_summary_for_context(context_id: GoudContextId) -> Option<Memor
     with_route_state_mut_by_context(context_id, |route| route.snapshot.memory_summary)
 }
 
+/// Per-frame counters copied out of a route without cloning its snapshot.
+#[derive(Debug, Clone, Copy, Default, PartialEq)]
+pub struct RouteMetricsCounters {
+    /// Frame number of the route's current snapshot.
+    pub frame_index: u64,
+    /// FPS overlay statistics, in [`fps_stats_for_context`] order.
+    pub fps: [f32; 5],
+    /// Render metrics accumulated for the current frame.
+    pub render_metrics: RenderMetricsV1,
+    /// Memory category totals.
+    pub memory_summary: MemorySummaryV1,
+    /// Network totals last reported through the network stats exports.
+    pub network: NetworkStatsV1,
+}
+
+/// Returns the per-frame counters for one context, if registered.
+///
+/// Unlike [`snapshot_for_context`](super::snapshot_for_context) this never
+/// allocates, so it is safe to call every frame.
+pub fn metrics_counters_for_context(context_id: GoudContextId) -> Option<RouteMetricsCounters> {
+    with_route_state_mut_by_context(context_id, |route| RouteMetricsCounters {
+        frame_index: route.snapshot.frame.index,
+        fps: route.fps_stats.as_array(),
+        render_metrics: route.snapshot.stats.render_metrics,
+        memory_summary: route.snapshot.memory_summary,
+        network: route.snapshot.stats.network,
+    })
+}
+
 /// Stores the latest network snapshot totals for a context.
 pub fn set_snapshot_network_stats_for_context(
     context_id: GoudContextId,
@@ -1,6 +1,6 @@
 use std::collections::{BTreeMap, HashMap, HashSet, VecDeque};
 use std::path::PathBuf;
-use std::sync::atomic::AtomicBool;
+use std::sync::atomic::{AtomicBool, AtomicUsize, Ordering};
 use std::sync::{Arc, Mutex, MutexGuard, OnceLock};
 use std::thread::JoinHandle;
 use std::time::{SystemTime, UNIX_EPOCH};
@@ -206,6 +206,23 @@ pub(super) struct DebuggerRuntimeState {
 
 static DEBUGGER_RUNTIME: OnceLock<Mutex<Option<DebuggerRuntimeState>>> = OnceLock::new();
 static PROCESS_NONCE: OnceLock<u64> = OnceLock::new();
+/// Mirror of the registered route count, readable without the runtime lock.
+///
+/// Per-frame hooks run for every context; when no context enabled the
+/// debugger they return here instead of serializing all threads on
+/// [`DEBUGGER_RUNTIME`].
+static ROUTE_COUNT: AtomicUsize = AtomicUsize::new(0);
+
+/// Publishes the current route count; call with the runtime lock held after
+/// adding or removing routes.
+pub(super) fn sync_route_count(runtime: Option<&DebuggerRuntimeState>) {
+    let count = runtime.map_or(0, |runtime| runtime.routes.len());
+    ROUTE_COUNT.store(count, Ordering::Release);
+}
+
+fn has_routes() -> bool {
+    ROUTE_COUNT.load(Ordering::Acquire) > 0
+}
 
 pub(super) fn runtime_cell() -> &'static Mutex<Option<DebuggerRuntimeState>> {
     DEBUGGER_RUNTIME.get_or_init(|| Mutex::new(None))
@@ -400,6 +417,9 @@ pub(super) fn with_route_state_mut<R>(
     route_id: &RuntimeRouteId,
     f: impl FnOnce(&mut RouteState) -> R,
 ) -> Option<R> {
+    if !has_routes() {
+        return None;
+    }
     let mut guard = lock_runtime();
     let route = guard.as_mut()?.routes.get_mut(&route_id.context_id)?;
     Some(f(route))
@@ -409,6 +429,9 @@ pub(super) fn with_route_state_mut_by_context<R>(
     context_id: GoudContextId,
     f: impl FnOnce(&mut RouteState) -> R,
 ) -> Option<R> {
+    if !has_routes() {
+        return None;
+    }
     let key = raw_context_key(context_id);
     let mut guard = lock_runtime();
     let route = guard.as_mut()?.routes.get_mut(&key)?;
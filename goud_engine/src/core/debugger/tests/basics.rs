@@ -2,8 +2,9 @@ use super::super::{
     active_route_count, current_manifest, current_route, default_capabilities, default_services,
     register_context, reset_for_tests, scoped_route, set_profiling_enabled_for_context,
     set_selected_entity_for_context, snapshot_for_context, snapshot_for_route, test_lock,
-    update_memory_category_for_context, update_render_stats_for_context, CapabilityStateV1,
-    DebuggerConfig, RuntimeSurfaceKind, ROUTE_CAPABILITY_KEYS,
+    update_memory_category_for_context, update_render_stats_for_context,
+    update_sprite_culling_for_context, CapabilityStateV1, DebuggerConfig, RuntimeSurfaceKind,
+    ROUTE_CAPABILITY_KEYS,
 };
 use crate::core::context_id::GoudContextId;
 use std::panic::{catch_unwind, AssertUnwindSafe};
@@ -122,6 +123,43 @@ fn test_debugger_runtime_collects_per_frame_render_and_memory_stats() {
     assert!(snapshot.stats.memory.peak_bytes >= 256);
 }
 
+#[test]
+fn test_debugger_runtime_accumulates_sprite_culling_per_frame() {
+    let _guard = test_lock();
+    reset_for_tests();
+
+    let context_id = GoudContextId::new(84, 1);
+    let route = register_context(
+        context_id,
+        RuntimeSurfaceKind::WindowedGame,
+        &DebuggerConfig {
+            enabled: true,
+            publish_local_attach: false,
+            route_label: Some("culling".to_string()),
+        },
+    );
+
+    super::super::begin_frame(&route, 1, 0.016, 0.016);
+    assert!(update_sprite_culling_for_context(context_id, 30, 970, 2));
+    assert!(update_sprite_culling_for_context(context_id, 10, 0, 1));
+    let metrics = snapshot_for_context(context_id)
+        .unwrap()
+        .stats
+        .render_metrics;
+    assert_eq!(metrics.sprites_drawn, 40);
+    assert_eq!(metrics.sprites_culled, 970);
+    assert_eq!(metrics.sprites_submitted, 1010);
+    assert_eq!(metrics.draw_call_count, 3);
+    assert_eq!(metrics.batches_submitted, 2);
+
+    super::super::begin_frame(&route, 2, 0.016, 0.032);
+    let metrics = snapshot_for_context(context_id)
+        .unwrap()
+        .stats
+        .render_metrics;
+    assert_eq!(metrics.sprites_submitted, 0);
+}
+
 #[test]
 fn test_debugger_runtime_resets_profiler_samples_each_frame() {
     let _guard = test_lock();
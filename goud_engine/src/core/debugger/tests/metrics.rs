@@ -1,6 +1,8 @@
 use super::super::{
-    begin_frame, dispatch_request_json_for_route, end_frame, register_context, reset_for_tests,
-    test_lock, DebuggerConfig, RuntimeSurfaceKind,
+    begin_frame, dispatch_request_json_for_route, end_frame, metrics_counters_for_context,
+    register_context, reset_for_tests, set_snapshot_network_stats_for_context, test_lock,
+    update_fps_stats_for_context, update_sprite_culling_for_context, DebuggerConfig,
+    RuntimeSurfaceKind,
 };
 use crate::core::context_id::GoudContextId;
 use serde_json::json;
@@ -93,3 +95,36 @@ fn test_get_metrics_trace_returns_versioned_object_shape() {
     let metrics_file = format!("{runtime_dir}/artifacts/{route_bucket}/metrics/{artifact_id}.json");
     assert!(fs::metadata(metrics_file).is_ok());
 }
+
+#[test]
+fn test_metrics_counters_copy_current_frame_without_snapshot() {
+    let _guard = test_lock();
+    reset_for_tests();
+    let context_id = GoudContextId::new(52, 1);
+    assert!(metrics_counters_for_context(context_id).is_none());
+
+    let route = register_context(
+        context_id,
+        RuntimeSurfaceKind::HeadlessContext,
+        &DebuggerConfig {
+            enabled: true,
+            publish_local_attach: false,
+            route_label: Some("metrics-counters".to_string()),
+        },
+    );
+    begin_frame(&route, 7, 0.016, 0.112);
+    assert!(update_fps_stats_for_context(
+        context_id, 60.0, 55.0, 62.0, 59.0, 16.6
+    ));
+    assert!(update_sprite_culling_for_context(context_id, 30, 10, 2));
+    assert!(set_snapshot_network_stats_for_context(context_id, 512, 256));
+
+    let counters = metrics_counters_for_context(context_id).expect("route is registered");
+    assert_eq!(counters.frame_index, 7);
+    assert_eq!(counters.fps, [60.0, 55.0, 62.0, 59.0, 16.6]);
+    assert_eq!(counters.render_metrics.sprites_submitted, 40);
+    assert_eq!(counters.render_metrics.draw_call_count, 2);
+    assert_eq!(counters.network.bytes_sent, 512);
+    assert_eq!(counters.network.bytes_received, 256);
+    end_frame(&route);
+}
@@ -201,6 +201,19 @@ impl InputManager {
         self.keys_current.iter()
     }
 
+    /// Returns every key held this frame or last frame.
+    ///
+    /// These are the only keys for which a pressed, just-pressed or
+    /// just-released query can return true; keys held in both frames appear once.
+    pub fn keys_tracked(&self) -> impl Iterator<Item = Key> + '_ {
+        self.keys_current.iter().copied().chain(
+            self.keys_previous
+                .iter()
+                .copied()
+                .filter(|key| !self.keys_current.contains(key)),
+        )
+    }
+
     // === Mouse Input ===
 
     /// Sets a mouse button as pressed.
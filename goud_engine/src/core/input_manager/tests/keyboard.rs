@@ -164,3 +164,20 @@ fn test_consumed_key_is_masked_for_queries() {
     input.update();
     assert!(input.key_pressed(Key::Tab));
 }
+
+#[test]
+fn test_keys_tracked_covers_held_and_released_keys() {
+    let mut input = InputManager::new();
+    input.press_key(Key::A);
+    input.press_key(Key::B);
+    input.update();
+    input.release_key(Key::A);
+    input.press_key(Key::C);
+
+    let mut tracked: Vec<u32> = input.keys_tracked().map(|key| key as u32).collect();
+    tracked.sort_unstable();
+    assert_eq!(tracked, vec![Key::A as u32, Key::B as u32, Key::C as u32]);
+
+    input.update();
+    assert_eq!(input.keys_tracked().count(), 2);
+}
@@ -167,3 +167,21 @@ fn touch_position_none_for_unknown_id() {
     let input = InputManager::new();
     assert_eq!(input.touch_position(999), None);
 }
+
+#[test]
+fn touch_ids_include_touches_released_this_frame() {
+    let mut input = InputManager::new();
+    input.touch_start(3, Vec2::new(1.0, 1.0));
+    input.touch_start(7, Vec2::new(2.0, 2.0));
+    input.update();
+    input.touch_end(3);
+
+    let mut ids: Vec<u64> = input.touch_ids().collect();
+    ids.sort_unstable();
+    assert_eq!(ids, vec![3, 7]);
+    assert!(input.touch_just_released(3));
+
+    input.update();
+    input.update();
+    assert_eq!(input.touch_ids().collect::<Vec<_>>(), vec![7]);
+}
@@ -96,6 +96,19 @@ impl InputManager {
                 .unwrap_or(false)
     }
 
+    /// Returns the IDs of every touch seen this frame or last frame.
+    ///
+    /// Includes touches that ended this frame, so `touch_just_released` can
+    /// be queried for each; an ID present in both frames appears once.
+    pub fn touch_ids(&self) -> impl Iterator<Item = u64> + '_ {
+        self.touches_current.keys().copied().chain(
+            self.touches_previous
+                .keys()
+                .copied()
+                .filter(|id| !self.touches_current.contains_key(id)),
+        )
+    }
+
     /// Returns the number of currently active touches.
     pub fn touch_count(&self) -> usize {
         self.touches_current
@@ -9,7 +9,9 @@ use super::types::{
     JointDesc, JointHandle, PhysicsCapabilities, RaycastHit,
 };
 use super::{Provider, ProviderLifecycle};
-use crate::core::error::GoudResult;
+use std::any::Any;
+
+use crate::core::error::{GoudError, GoudResult};
 
 /// Trait for physics backends.
 ///
@@ -59,6 +61,13 @@ pub trait PhysicsProvider: Provider + ProviderLifecycle {
     /// Get the velocity of a body as [x, y].
     fn body_velocity(&self, handle: BodyHandle) -> GoudResult<[f32; 2]>;
 
+    /// Get the rotation of a body in radians.
+    ///
+    /// Providers without angular state report 0 for every valid body.
+    fn body_rotation(&self, handle: BodyHandle) -> GoudResult<f32> {
+        self.body_position(handle).map(|_| 0.0)
+    }
+
     /// Set the velocity of a body.
     fn set_body_velocity(&mut self, handle: BodyHandle, vel: [f32; 2]) -> GoudResult<()>;
 
@@ -131,6 +140,15 @@ pub trait PhysicsProvider: Provider + ProviderLifecycle {
     /// Find all bodies whose colliders overlap the given circle.
     fn overlap_circle(&self, center: [f32; 2], radius: f32) -> Vec<BodyHandle>;
 
+    /// Find all bodies with a collider on `layer_mask` that overlaps the
+    /// axis-aligned box spanning `min` to `max`.
+    ///
+    /// Providers without shape queries report no overlaps.
+    fn overlap_aabb(&self, min: [f32; 2], max: [f32; 2], layer_mask: u32) -> Vec<BodyHandle> {
+        let _ = (min, max, layer_mask);
+        Vec::new()
+    }
+
     // -------------------------------------------------------------------------
     // Collision Events
     // -------------------------------------------------------------------------
@@ -167,4 +185,42 @@ pub trait PhysicsProvider: Provider + ProviderLifecycle {
 
     /// Returns a snapshot of 2D physics diagnostics.
     fn physics_diagnostics(&self) -> PhysicsDiagnosticsV1;
+
+    // -------------------------------------------------------------------------
+    // Rollback
+    // -------------------------------------------------------------------------
+
+    /// Capture the entire simulation (bodies, colliders, joints, contact and
+    /// solver caches, handle maps) for a later [`load_state`](Self::load_state).
+    ///
+    /// Providers without snapshot support return `None`.
+    fn save_state(&self) -> Option<Box<dyn Any + Send + Sync>> {
+        None
+    }
+
+    /// Restore a state returned by [`save_state`](Self::save_state) on a
+    /// provider of the same type. Collision events not yet drained are
+    /// replaced by the ones pending when the state was saved.
+    fn load_state(&mut self, state: &(dyn Any + Send + Sync)) -> GoudResult<()> {
+        let _ = state;
+        Err(GoudError::NotImplemented(format!(
+            "{} physics has no state snapshots",
+            self.name()
+        )))
+    }
+
+    /// Switch deterministic stepping on or off.
+    ///
+    /// While on, `step` ignores its `delta` and always advances by the last
+    /// [`set_timestep`](Self::set_timestep) value, never by a delta passed to
+    /// an earlier variable step, and collision events come out in the
+    /// same order on every machine, so peers replaying the same inputs from
+    /// the same state stay in lockstep.
+    fn set_deterministic(&mut self, enabled: bool) -> GoudResult<()> {
+        let _ = enabled;
+        Err(GoudError::NotImplemented(format!(
+            "{} physics has no deterministic mode",
+            self.name()
+        )))
+    }
 }
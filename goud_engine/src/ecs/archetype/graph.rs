@@ -34,7 +34,7 @@ use super::storage::Archetype;
 /// let id = graph.find_or_create(components.clone());
 /// assert_eq!(graph.find_or_create(components), id); // same set -> same ID
 /// ```
-#[derive(Debug)]
+#[derive(Debug, Clone)]
 pub struct ArchetypeGraph {
     /// All archetypes; index == `ArchetypeId.index()`. Index 0 is always the empty archetype.
     archetypes: Vec<Archetype>,
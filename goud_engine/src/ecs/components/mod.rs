@@ -27,6 +27,7 @@
 //! - [`BoneTransform`]: Position + rotation + scale for a bone
 //! - [`SkeletalAnimation`]: Keyframe animation clip
 //! - [`SkeletalAnimator`]: Playback controller component
+//! - [`SkeletalLayer`]: Clip blended over an animator's base clip
 //! - [`SkeletalMesh2D`]: Deformable mesh with bone weights
 //!
 //! ## Audio Components
@@ -195,7 +196,7 @@ pub use joint::Joint;
 pub use rigidbody::{RigidBody, RigidBodyType};
 pub use skeleton2d::{
     Bone2D, BoneKeyframe, BoneTrack, BoneTransform, BoneWeight, SkeletalAnimation,
-    SkeletalAnimator, SkeletalMesh2D, SkeletalVertex, Skeleton2D,
+    SkeletalAnimator, SkeletalLayer, SkeletalMesh2D, SkeletalVertex, Skeleton2D,
 };
 pub use sprite::Sprite;
 pub use sprite_animator::{AnimationClip, PlaybackMode, SpriteAnimator};
@@ -5,7 +5,7 @@
 //! - [`Skeleton2D`] / [`Bone2D`] / [`BoneTransform`]: Bone hierarchy and transforms
 //! - [`SkeletalAnimation`] / [`BoneTrack`] / [`BoneKeyframe`]: Keyframe animation data
 //! - [`SkeletalMesh2D`] / [`SkeletalVertex`] / [`BoneWeight`]: Weighted mesh vertices
-//! - [`SkeletalAnimator`]: Playback controller component
+//! - [`SkeletalAnimator`] / [`SkeletalLayer`]: Playback controller component and blend layers
 
 mod animation;
 mod mesh;
@@ -14,5 +14,5 @@ mod types;
 
 pub use animation::{BoneKeyframe, BoneTrack, SkeletalAnimation};
 pub use mesh::{BoneWeight, SkeletalMesh2D, SkeletalVertex};
-pub use playback::SkeletalAnimator;
+pub use playback::{SkeletalAnimator, SkeletalLayer};
 pub use types::{Bone2D, BoneTransform, Skeleton2D};
@@ -1,11 +1,51 @@
 //! Skeletal animation playback controller.
 //!
-//! [`SkeletalAnimator`] drives a single [`SkeletalAnimation`] at runtime,
-//! tracking elapsed time, play/pause state, and playback speed.
+//! [`SkeletalAnimator`] drives a base [`SkeletalAnimation`] at runtime,
+//! tracking elapsed time, play/pause state, and playback speed, plus any
+//! [`SkeletalLayer`]s blended over it.
 
 use super::animation::SkeletalAnimation;
+use crate::ecs::systems::animation::BlendMode;
 use crate::ecs::Component;
 
+/// A clip blended over an animator's base clip.
+///
+/// Layers advance with their animator.  When the entity also has an
+/// [`AnimationLayerStack`](crate::ecs::components::AnimationLayerStack) with
+/// a layer of the same name, that layer's weight and blend mode are used
+/// instead of the ones stored here, so one set of layer controls drives
+/// both sprite and skeletal animation.
+#[derive(Debug, Clone)]
+pub struct SkeletalLayer {
+    /// Layer name, matched against the entity's animation layer stack.
+    pub name: String,
+    /// The clip sampled by this layer.
+    pub animation: SkeletalAnimation,
+    /// Current playback position in seconds.
+    pub current_time: f32,
+    /// Blend weight in `0.0..=1.0`.
+    pub weight: f32,
+    /// How the sampled pose combines with the layers below.
+    pub blend_mode: BlendMode,
+}
+
+impl SkeletalLayer {
+    /// Creates a layer at t=0 with a weight of `1.0`.
+    pub fn new(
+        name: impl Into<String>,
+        animation: SkeletalAnimation,
+        blend_mode: BlendMode,
+    ) -> Self {
+        Self {
+            name: name.into(),
+            animation,
+            current_time: 0.0,
+            weight: 1.0,
+            blend_mode,
+        }
+    }
+}
+
 /// Controls playback of a [`SkeletalAnimation`] on an entity.
 ///
 /// Attach alongside a [`Skeleton2D`](super::Skeleton2D) component.
@@ -21,6 +61,8 @@ pub struct SkeletalAnimator {
     pub playing: bool,
     /// Playback speed multiplier (1.0 = normal).
     pub speed: f32,
+    /// Clips blended over `animation`, bottom to top.
+    pub layers: Vec<SkeletalLayer>,
 }
 
 impl Component for SkeletalAnimator {}
@@ -33,6 +75,7 @@ impl SkeletalAnimator {
             current_time: 0.0,
             playing: false,
             speed: 1.0,
+            layers: Vec::new(),
         }
     }
 
@@ -51,8 +94,41 @@ impl SkeletalAnimator {
         self.current_time = 0.0;
     }
 
+    /// Advances the base clip and every layer by `dt * speed`.
+    ///
+    /// Looping clips wrap and others clamp to their duration.  Returns
+    /// `false`, changing nothing, when paused or the base clip is empty.
+    pub fn advance(&mut self, dt: f32) -> bool {
+        if !self.playing || self.animation.duration <= 0.0 {
+            return false;
+        }
+        let step = dt * self.speed;
+        self.current_time = wrap_time(self.current_time + step, &self.animation);
+        for layer in &mut self.layers {
+            if layer.animation.duration > 0.0 {
+                layer.current_time = wrap_time(layer.current_time + step, &layer.animation);
+            }
+        }
+        true
+    }
+
     /// Returns `true` if a non-looping animation has reached its end.
     pub fn is_finished(&self) -> bool {
         !self.animation.looping && self.current_time >= self.animation.duration
     }
 }
+
+/// Wraps `time` into a looping clip or clamps it to a one-shot clip.
+fn wrap_time(mut time: f32, animation: &SkeletalAnimation) -> f32 {
+    if animation.looping {
+        while time >= animation.duration {
+            time -= animation.duration;
+        }
+        while time < 0.0 {
+            time += animation.duration;
+        }
+        time
+    } else {
+        time.clamp(0.0, animation.duration)
+    }
+}
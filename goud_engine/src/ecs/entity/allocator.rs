@@ -61,6 +61,7 @@ use super::types::Entity;
 ///
 /// `EntityAllocator` is NOT thread-safe. For concurrent access, wrap in
 /// appropriate synchronization primitives (Mutex, RwLock, etc.).
+#[derive(Clone)]
 pub struct EntityAllocator {
     /// Generation counter for each slot.
     ///
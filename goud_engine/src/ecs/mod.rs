@@ -109,4 +109,4 @@ pub use sparse_set::{SparseSet, SparseSetIter, SparseSetIterMut};
 pub use spatial_grid::SpatialGrid;
 pub use storage::{AnyComponentStorage, ComponentStorage};
 pub use systems::TransformPropagationSystem;
-pub use world::{EntityWorldMut, World};
+pub use world::{EntityWorldMut, PrefabInstances, World, WorldSnapshot};
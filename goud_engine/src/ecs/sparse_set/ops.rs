@@ -196,4 +196,38 @@ impl<T> SparseSet<T> {
     pub fn get_mut_by_dense_index(&mut self, dense_index: usize) -> Option<&mut T> {
         self.values.get_mut(dense_index)
     }
+
+    /// Returns every value as one mutable slice, parallel to [`dense()`](Self::dense).
+    ///
+    /// This is an advanced method for updating many values at once, for
+    /// example from worker threads after splitting the slice.  Change ticks
+    /// are not touched; use `set_changed_tick` for the values modified.
+    #[inline]
+    pub fn dense_values_mut(&mut self) -> &mut [T] {
+        &mut self.values
+    }
+}
+
+impl<T: Clone> Clone for SparseSet<T> {
+    fn clone(&self) -> Self {
+        Self {
+            sparse: self.sparse.clone(),
+            dense: self.dense.clone(),
+            values: self.values.clone(),
+            added_ticks: self.added_ticks.clone(),
+            changed_ticks: self.changed_ticks.clone(),
+        }
+    }
+
+    /// Copies `source` into `self`, reusing this set's allocations.
+    ///
+    /// World snapshots restore storages this way every rollback, so a set
+    /// that already holds about as many values never reallocates.
+    fn clone_from(&mut self, source: &Self) {
+        self.sparse.clone_from(&source.sparse);
+        self.dense.clone_from(&source.dense);
+        self.values.clone_from(&source.values);
+        self.added_ticks.clone_from(&source.added_ticks);
+        self.changed_ticks.clone_from(&source.changed_ticks);
+    }
 }
@@ -66,6 +66,24 @@ mod tests {
         assert_eq!(set.get(Entity::new(0, 1)), Some(&100));
     }
 
+    #[test]
+    fn test_dense_values_mut() {
+        let mut set = SparseSet::new();
+
+        let e1 = Entity::new(3, 1);
+        let e2 = Entity::new(7, 1);
+        set.insert(e1, 1);
+        set.insert(e2, 2);
+
+        for value in set.dense_values_mut() {
+            *value *= 10;
+        }
+
+        assert_eq!(set.dense_values_mut().len(), 2);
+        assert_eq!(set.get(e1), Some(&10));
+        assert_eq!(set.get(e2), Some(&20));
+    }
+
     // =========================================================================
     // Clone Tests
     // =========================================================================
@@ -12,4 +12,5 @@ mod system;
 mod tests;
 
 pub use blend::{blend_rects, compute_blended_rect, BlendMode};
+pub(crate) use system::advance_animator;
 pub use system::update_sprite_animations;
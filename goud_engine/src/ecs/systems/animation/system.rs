@@ -6,7 +6,7 @@ use crate::ecs::components::sprite::Sprite;
 use crate::ecs::components::sprite_animator::events::AnimationEventFired;
 use crate::ecs::components::sprite_animator::{PlaybackMode, SpriteAnimator};
 use crate::ecs::systems::animation::blend::compute_blended_rect;
-use crate::ecs::World;
+use crate::ecs::{Entity, World};
 
 /// Advances all sprite animations by `dt` seconds.
 ///
@@ -45,56 +45,9 @@ pub fn update_sprite_animations(world: &mut World, dt: f32) {
             let Some(animator) = world.get_mut::<SpriteAnimator>(entity) else {
                 continue;
             };
-
-            if !animator.playing || animator.finished {
+            if !advance_animator(entity, animator, dt, &mut pending_events) {
                 continue;
             }
-
-            let frame_count = animator.clip.frames.len();
-            if frame_count == 0 {
-                continue;
-            }
-
-            if animator.clip.frame_duration <= 0.0 {
-                continue;
-            }
-
-            animator.previous_frame = animator.current_frame;
-            animator.elapsed += dt;
-            let mut frames_advanced: usize = 0;
-
-            while animator.elapsed >= animator.clip.frame_duration {
-                animator.elapsed -= animator.clip.frame_duration;
-                animator.current_frame += 1;
-                frames_advanced += 1;
-
-                if animator.current_frame >= frame_count {
-                    match animator.clip.mode {
-                        PlaybackMode::Loop => {
-                            animator.current_frame = 0;
-                        }
-                        PlaybackMode::OneShot => {
-                            animator.current_frame = frame_count - 1;
-                            animator.finished = true;
-                            animator.playing = false;
-                            animator.elapsed = 0.0;
-                            break;
-                        }
-                    }
-                }
-            }
-
-            // Collect events for frames that were crossed.
-            collect_animation_events(
-                entity,
-                animator.previous_frame,
-                animator.current_frame,
-                frame_count,
-                frames_advanced,
-                &animator.clip.events,
-                &mut pending_events,
-            );
-
             animator.current_rect()
         };
 
@@ -119,6 +72,68 @@ pub fn update_sprite_animations(world: &mut World, dt: f32) {
     update_animation_layer_stacks(world, dt);
 }
 
+/// Advances one sprite animator by `dt` seconds.
+///
+/// Applies steps 1–5 of [`update_sprite_animations`] and appends the
+/// events of every frame crossed to `pending`.  Returns `false` when the
+/// animator was skipped (not playing, finished, or without frames).
+pub(crate) fn advance_animator(
+    entity: Entity,
+    animator: &mut SpriteAnimator,
+    dt: f32,
+    pending: &mut Vec<AnimationEventFired>,
+) -> bool {
+    if !animator.playing || animator.finished {
+        return false;
+    }
+
+    let frame_count = animator.clip.frames.len();
+    if frame_count == 0 {
+        return false;
+    }
+
+    if animator.clip.frame_duration <= 0.0 {
+        return false;
+    }
+
+    animator.previous_frame = animator.current_frame;
+    animator.elapsed += dt;
+    let mut frames_advanced: usize = 0;
+
+    while animator.elapsed >= animator.clip.frame_duration {
+        animator.elapsed -= animator.clip.frame_duration;
+        animator.current_frame += 1;
+        frames_advanced += 1;
+
+        if animator.current_frame >= frame_count {
+            match animator.clip.mode {
+                PlaybackMode::Loop => {
+                    animator.current_frame = 0;
+                }
+                PlaybackMode::OneShot => {
+                    animator.current_frame = frame_count - 1;
+                    animator.finished = true;
+                    animator.playing = false;
+                    animator.elapsed = 0.0;
+                    break;
+                }
+            }
+        }
+    }
+
+    // Collect events for frames that were crossed.
+    collect_animation_events(
+        entity,
+        animator.previous_frame,
+        animator.current_frame,
+        frame_count,
+        frames_advanced,
+        &animator.clip.events,
+        pending,
+    );
+    true
+}
+
 /// Advances all [`AnimationLayerStack`] components and applies the blended
 /// result to each entity's [`Sprite`] source rect.
 fn update_animation_layer_stacks(world: &mut World, dt: f32) {
@@ -195,7 +210,7 @@ fn update_animation_layer_stacks(world: &mut World, dt: f32) {
 /// When `frames_advanced >= frame_count`, a full cycle occurred and
 /// all configured events fire exactly once.
 fn collect_animation_events(
-    entity: crate::ecs::Entity,
+    entity: Entity,
     prev_frame: usize,
     current_frame: usize,
     frame_count: usize,
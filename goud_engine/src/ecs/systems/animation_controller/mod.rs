@@ -9,4 +9,5 @@ mod system;
 #[cfg(test)]
 mod tests;
 
+pub(crate) use system::update_animation_controller;
 pub use system::update_animation_controllers;
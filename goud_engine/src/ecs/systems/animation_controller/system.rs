@@ -1,12 +1,13 @@
 //! Animation controller system logic.
 
+use crate::core::math::Rect;
 use crate::ecs::components::animation_controller::{
     AnimParam, AnimationController, TransitionCondition,
 };
 use crate::ecs::components::sprite::Sprite;
 use crate::ecs::components::sprite_animator::SpriteAnimator;
 use crate::ecs::systems::animation::blend_rects;
-use crate::ecs::World;
+use crate::ecs::{Entity, World};
 
 /// Evaluates whether a single transition condition is satisfied.
 fn evaluate_condition(condition: &TransitionCondition, controller: &AnimationController) -> bool {
@@ -65,80 +66,115 @@ pub fn update_animation_controllers(world: &mut World, dt: f32) {
         .collect();
 
     for entity in entities {
-        // Phase 1: Read controller state and decide what action to take.
-        let action = {
-            let Some(controller) = world.get::<AnimationController>(entity) else {
-                continue;
-            };
+        update_animation_controller(world, entity, dt);
+    }
+}
 
-            if let Some(ref progress) = controller.transition_progress {
-                let new_elapsed = progress.elapsed + dt;
-                if new_elapsed >= progress.duration {
-                    // Transition complete
-                    Action::CompleteTransition {
-                        to_state: progress.to_state.clone(),
-                    }
-                } else {
-                    // Advance transition
-                    Action::AdvanceTransition { new_elapsed }
+/// Advances the animation controller of one entity by `dt` seconds.
+///
+/// Runs the same steps as [`update_animation_controllers`] for `entity`.
+/// While a transition is crossfading, the blended rect is applied to the
+/// entity's [`Sprite`] and also returned.
+pub(crate) fn update_animation_controller(
+    world: &mut World,
+    entity: Entity,
+    dt: f32,
+) -> Option<Rect> {
+    // Phase 1: Read controller state and decide what action to take.
+    let action = {
+        let Some(controller) = world.get::<AnimationController>(entity) else {
+            return None;
+        };
+
+        if let Some(ref progress) = controller.transition_progress {
+            let new_elapsed = progress.elapsed + dt;
+            if new_elapsed >= progress.duration {
+                // Transition complete
+                Action::CompleteTransition {
+                    to_state: progress.to_state.clone(),
                 }
             } else {
-                // Check for new transitions
-                find_matching_transition(controller)
+                // Advance transition
+                Action::AdvanceTransition { new_elapsed }
             }
-        };
+        } else {
+            // Check for new transitions
+            find_matching_transition(controller)
+        }
+    };
 
-        // Phase 2: Apply the action with mutable access.
-        match action {
-            Action::None => {}
-            Action::AdvanceTransition { new_elapsed } => {
-                // Read the from/to clips and compute blended rect for crossfade.
-                let blended_rect = {
-                    let Some(ctrl) = world.get::<AnimationController>(entity) else {
-                        continue;
-                    };
-                    let Some(ref progress) = ctrl.transition_progress else {
-                        continue;
-                    };
-                    let blend_weight = (new_elapsed / progress.duration).clamp(0.0, 1.0);
-                    let from_clip = ctrl.states.get(&progress.from_state).map(|s| &s.clip);
-                    let to_clip = ctrl.states.get(&progress.to_state).map(|s| &s.clip);
+    // Phase 2: Apply the action with mutable access.
+    let blended = match action {
+        Action::None => None,
+        Action::AdvanceTransition { new_elapsed } => {
+            // Read the from/to clips and compute blended rect for crossfade.
+            let blended_rect = {
+                let Some(ctrl) = world.get::<AnimationController>(entity) else {
+                    return None;
+                };
+                let Some(ref progress) = ctrl.transition_progress else {
+                    return None;
+                };
+                let blend_weight = (new_elapsed / progress.duration).clamp(0.0, 1.0);
+                let from_clip = ctrl.states.get(&progress.from_state).map(|s| &s.clip);
+                let to_clip = ctrl.states.get(&progress.to_state).map(|s| &s.clip);
 
-                    match (from_clip, to_clip) {
-                        (Some(fc), Some(tc)) => {
-                            let from_frame = world
-                                .get::<SpriteAnimator>(entity)
-                                .map(|a| a.current_frame)
-                                .unwrap_or(0);
-                            let from_rect = fc.frames.get(from_frame).or(fc.frames.last());
-                            let to_rect = tc.frames.first();
-                            match (from_rect, to_rect) {
-                                (Some(&fr), Some(&tr)) => Some(blend_rects(fr, tr, blend_weight)),
-                                _ => None,
-                            }
+                match (from_clip, to_clip) {
+                    (Some(fc), Some(tc)) => {
+                        let from_frame = world
+                            .get::<SpriteAnimator>(entity)
+                            .map(|a| a.current_frame)
+                            .unwrap_or(0);
+                        let from_rect = fc.frames.get(from_frame).or(fc.frames.last());
+                        let to_rect = tc.frames.first();
+                        match (from_rect, to_rect) {
+                            (Some(&fr), Some(&tr)) => Some(blend_rects(fr, tr, blend_weight)),
+                            _ => None,
                         }
-                        _ => None,
                     }
-                };
+                    _ => None,
+                }
+            };
 
-                // Update elapsed on the transition progress.
-                if let Some(ctrl) = world.get_mut::<AnimationController>(entity) {
-                    if let Some(ref mut progress) = ctrl.transition_progress {
-                        progress.elapsed = new_elapsed;
-                    }
+            // Update elapsed on the transition progress.
+            if let Some(ctrl) = world.get_mut::<AnimationController>(entity) {
+                if let Some(ref mut progress) = ctrl.transition_progress {
+                    progress.elapsed = new_elapsed;
                 }
+            }
 
-                // Apply blended rect to sprite.
-                if let Some(rect) = blended_rect {
-                    if let Some(sprite) = world.get_mut::<Sprite>(entity) {
-                        sprite.source_rect = Some(rect);
-                    }
+            // Apply blended rect to sprite.
+            if let Some(rect) = blended_rect {
+                if let Some(sprite) = world.get_mut::<Sprite>(entity) {
+                    sprite.source_rect = Some(rect);
+                }
+            }
+            blended_rect
+        }
+        Action::CompleteTransition { to_state } => {
+            let new_clip = {
+                let Some(ctrl) = world.get_mut::<AnimationController>(entity) else {
+                    return None;
+                };
+                ctrl.current_state = to_state;
+                ctrl.transition_progress = None;
+                ctrl.current_clip().cloned()
+            };
+            if let Some(clip) = new_clip {
+                if let Some(animator) = world.get_mut::<SpriteAnimator>(entity) {
+                    animator.clip = clip;
+                    animator.current_frame = 0;
+                    animator.elapsed = 0.0;
                 }
             }
-            Action::CompleteTransition { to_state } => {
+            None
+        }
+        Action::StartTransition { to_state, duration } => {
+            if duration <= 0.0 {
+                // Zero-duration transition: complete immediately
                 let new_clip = {
                     let Some(ctrl) = world.get_mut::<AnimationController>(entity) else {
-                        continue;
+                        return None;
                     };
                     ctrl.current_state = to_state;
                     ctrl.transition_progress = None;
@@ -151,61 +187,40 @@ pub fn update_animation_controllers(world: &mut World, dt: f32) {
                         animator.elapsed = 0.0;
                     }
                 }
+            } else if let Some(ctrl) = world.get_mut::<AnimationController>(entity) {
+                ctrl.transition_progress = Some(
+                    crate::ecs::components::animation_controller::TransitionProgress {
+                        from_state: ctrl.current_state.clone(),
+                        to_state,
+                        elapsed: 0.0,
+                        duration,
+                    },
+                );
             }
-            Action::StartTransition { to_state, duration } => {
-                if duration <= 0.0 {
-                    // Zero-duration transition: complete immediately
-                    let new_clip = {
-                        let Some(ctrl) = world.get_mut::<AnimationController>(entity) else {
-                            continue;
-                        };
-                        ctrl.current_state = to_state;
-                        ctrl.transition_progress = None;
-                        ctrl.current_clip().cloned()
-                    };
-                    if let Some(clip) = new_clip {
-                        if let Some(animator) = world.get_mut::<SpriteAnimator>(entity) {
-                            animator.clip = clip;
-                            animator.current_frame = 0;
-                            animator.elapsed = 0.0;
-                        }
-                    }
-                } else if let Some(ctrl) = world.get_mut::<AnimationController>(entity) {
-                    ctrl.transition_progress = Some(
-                        crate::ecs::components::animation_controller::TransitionProgress {
-                            from_state: ctrl.current_state.clone(),
-                            to_state,
-                            elapsed: 0.0,
-                            duration,
-                        },
-                    );
-                }
-            }
+            None
         }
+    };
 
-        // Phase 3: Sync animator clip with current state (if no transition).
-        {
-            let current_clip = {
-                let Some(ctrl) = world.get::<AnimationController>(entity) else {
-                    continue;
-                };
-                if ctrl.transition_progress.is_some() {
-                    None
-                } else {
-                    ctrl.current_clip().cloned()
-                }
-            };
-            if let Some(clip) = current_clip {
-                if let Some(animator) = world.get_mut::<SpriteAnimator>(entity) {
-                    if animator.clip != clip {
-                        animator.clip = clip;
-                        animator.current_frame = 0;
-                        animator.elapsed = 0.0;
-                    }
-                }
-            }
+    // Phase 3: Sync animator clip with current state (if no transition).
+    // The clip is only cloned when it differs from the animator's.
+    let stale_clip = match (
+        world.get::<AnimationController>(entity),
+        world.get::<SpriteAnimator>(entity),
+    ) {
+        (Some(ctrl), Some(animator)) if ctrl.transition_progress.is_none() => ctrl
+            .current_clip()
+            .filter(|clip| animator.clip != **clip)
+            .cloned(),
+        _ => None,
+    };
+    if let Some(clip) = stale_clip {
+        if let Some(animator) = world.get_mut::<SpriteAnimator>(entity) {
+            animator.clip = clip;
+            animator.current_frame = 0;
+            animator.elapsed = 0.0;
         }
     }
+    blended
 }
 
 /// Internal action enum to separate read and write phases.
@@ -6,6 +6,8 @@
 #[cfg(feature = "native")]
 use crate::assets::AudioManager;
 #[cfg(any(feature = "native", test))]
+use crate::assets::SpatialSourceUpdate;
+#[cfg(any(feature = "native", test))]
 use crate::ecs::components::{AudioEmitter, AudioListener, AudioSource, Transform, Transform2D};
 #[cfg(any(feature = "native", test))]
 use crate::ecs::Entity;
@@ -15,17 +17,7 @@ use crate::ecs::World;
 #[derive(Debug, Clone)]
 struct SpatialAudioFrame {
     listener_position: [f32; 3],
-    sources: Vec<SpatialEmitterUpdate>,
-}
-
-#[cfg(any(feature = "native", test))]
-#[derive(Debug, Clone)]
-struct SpatialEmitterUpdate {
-    sink_id: u64,
-    source_position: [f32; 3],
-    max_distance: f32,
-    rolloff: f32,
-    base_volume: f32,
+    sources: Vec<SpatialSourceUpdate>,
 }
 
 #[cfg(any(feature = "native", test))]
@@ -84,7 +76,7 @@ fn collect_spatial_audio_frame(world: &World) -> SpatialAudioFrame {
             continue;
         };
 
-        sources.push(SpatialEmitterUpdate {
+        sources.push(SpatialSourceUpdate {
             sink_id,
             source_position: position,
             max_distance: emitter.max_distance.max(0.1),
@@ -111,22 +103,11 @@ pub fn update_spatial_audio(world: &mut World) {
         return;
     };
 
-    audio_manager.set_listener_position(frame.listener_position);
-
-    let mut active_sink_ids = Vec::with_capacity(frame.sources.len());
-    for update in &frame.sources {
-        if audio_manager.register_spatial_source(
-            update.sink_id,
-            update.source_position,
-            update.max_distance,
-            update.rolloff,
-            update.base_volume,
-        ) {
-            active_sink_ids.push(update.sink_id);
-        }
-    }
-
+    // Drop sources whose emitter went away, then apply the frame in one
+    // pass; out-of-range emitters are culled from the mixer.
+    let active_sink_ids: Vec<u64> = frame.sources.iter().map(|update| update.sink_id).collect();
     audio_manager.retain_spatial_sources(&active_sink_ids);
+    audio_manager.update_spatial_sources(frame.listener_position, frame.sources);
 }
 
 /// Web builds do not include the native `AudioManager` resource.
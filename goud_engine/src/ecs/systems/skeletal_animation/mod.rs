@@ -6,11 +6,16 @@
 //!   and propagates bone transforms through the hierarchy.
 //! - [`deform_skeletal_meshes`]: Applies bone world transforms to mesh vertices
 //!   via linear blend skinning.
+//!
+//! [`evaluate_pose`] and [`write_bone_palette`] expose the per-skeleton pose
+//! and skinning-matrix steps for callers that batch many skeletons.
 
 mod interpolation;
+mod pose;
 mod system;
 
 #[cfg(test)]
 mod tests;
 
+pub use pose::{evaluate_pose, write_bone_palette, PoseScratch, BONE_PALETTE_FLOATS};
 pub use system::{deform_skeletal_meshes, update_skeletal_animations};
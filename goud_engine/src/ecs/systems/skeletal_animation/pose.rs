@@ -0,0 +1,220 @@
+//! Layered pose evaluation and bone palette output.
+//!
+//! [`evaluate_pose`] samples an animator's base clip and blend layers into a
+//! structure-of-arrays local pose and propagates it through the bone
+//! hierarchy.  [`write_bone_palette`] turns the resulting world transforms
+//! into skinning matrices laid out for a single GPU upload.
+
+use super::interpolation::sample_track;
+use crate::core::math::Vec2;
+use crate::ecs::components::skeleton2d::{
+    Bone2D, BoneTrack, BoneTransform, SkeletalAnimator, SkeletalLayer,
+};
+use crate::ecs::components::AnimationLayerStack;
+use crate::ecs::systems::animation::BlendMode;
+
+/// Floats written per bone by [`write_bone_palette`].
+///
+/// Each bone's skinning matrix is stored as the first two rows of the
+/// affine matrix, each padded to a `vec4` (`[a, b, tx, 0]`, `[c, d, ty, 0]`),
+/// so the palette can be bound directly as a std140 uniform or storage
+/// buffer of `vec4`s.
+pub const BONE_PALETTE_FLOATS: usize = 8;
+
+/// Reusable per-worker buffers for pose evaluation.
+///
+/// Holds one channel per transform component so blending and matrix
+/// building run over contiguous `f32` arrays.  Buffers only grow, so a
+/// scratch reused across skeletons stops allocating after the largest one.
+#[derive(Debug, Default, Clone)]
+pub struct PoseScratch {
+    x: Vec<f32>,
+    y: Vec<f32>,
+    rotation: Vec<f32>,
+    scale_x: Vec<f32>,
+    scale_y: Vec<f32>,
+    sin: Vec<f32>,
+    cos: Vec<f32>,
+}
+
+impl PoseScratch {
+    fn resize(&mut self, len: usize) {
+        for channel in [
+            &mut self.x,
+            &mut self.y,
+            &mut self.rotation,
+            &mut self.scale_x,
+            &mut self.scale_y,
+            &mut self.sin,
+            &mut self.cos,
+        ] {
+            channel.resize(len, 0.0);
+        }
+    }
+
+    fn load(&self, i: usize) -> BoneTransform {
+        BoneTransform {
+            position: Vec2::new(self.x[i], self.y[i]),
+            rotation: self.rotation[i],
+            scale: Vec2::new(self.scale_x[i], self.scale_y[i]),
+        }
+    }
+
+    fn store(&mut self, i: usize, t: &BoneTransform) {
+        self.x[i] = t.position.x;
+        self.y[i] = t.position.y;
+        self.rotation[i] = t.rotation;
+        self.scale_x[i] = t.scale.x;
+        self.scale_y[i] = t.scale.y;
+    }
+}
+
+/// Computes the world transform of every bone for the animator's current time.
+///
+/// Starts from each bone's `local_transform`, replaces it with the base
+/// clip's sampled track where one exists, then applies each layer in order:
+/// override layers blend toward their sampled pose by their weight, and
+/// additive layers add their weighted offset from the bone's rest pose.
+/// Layer weights and blend modes come from a same-named layer of `stack`
+/// when there is one.  Bones whose parent is not an earlier bone are roots.
+///
+/// `world_out` must hold `bones.len()` transforms.
+pub fn evaluate_pose(
+    bones: &[Bone2D],
+    animator: Option<&SkeletalAnimator>,
+    stack: Option<&AnimationLayerStack>,
+    scratch: &mut PoseScratch,
+    world_out: &mut [BoneTransform],
+) {
+    let count = bones.len().min(world_out.len());
+    scratch.resize(count);
+    for (i, bone) in bones[..count].iter().enumerate() {
+        scratch.store(i, &bone.local_transform);
+    }
+
+    if let Some(animator) = animator {
+        let time = animator.current_time;
+        for track in animator
+            .animation
+            .tracks
+            .iter()
+            .filter(|t| t.bone_id < count)
+        {
+            scratch.store(track.bone_id, &sample_track(&track.keyframes, time));
+        }
+        for layer in &animator.layers {
+            let (weight, mode) = layer_blend(layer, stack);
+            if weight > 0.0 {
+                blend_layer(
+                    bones,
+                    &layer.animation.tracks,
+                    layer.current_time,
+                    weight,
+                    mode,
+                    scratch,
+                );
+            }
+        }
+    }
+
+    for i in 0..count {
+        let local = scratch.load(i);
+        world_out[i] = match bones[i].parent_id {
+            Some(pid) if pid < i => BoneTransform::combine(&world_out[pid], &local),
+            _ => local,
+        };
+    }
+}
+
+/// Writes the skinning matrix (`world * bind_pose_inverse`) of every bone.
+///
+/// `out` receives [`BONE_PALETTE_FLOATS`] floats per bone, in bone order;
+/// bones beyond `out`'s length are skipped.
+pub fn write_bone_palette(
+    bones: &[Bone2D],
+    world: &[BoneTransform],
+    scratch: &mut PoseScratch,
+    out: &mut [f32],
+) {
+    let count = bones
+        .len()
+        .min(world.len())
+        .min(out.len() / BONE_PALETTE_FLOATS);
+    scratch.resize(count);
+    for i in 0..count {
+        let skin = BoneTransform::combine(&world[i], &bones[i].bind_pose_inverse);
+        scratch.store(i, &skin);
+    }
+
+    let PoseScratch {
+        x,
+        y,
+        rotation,
+        scale_x,
+        scale_y,
+        sin,
+        cos,
+    } = scratch;
+    for ((s, c), r) in sin.iter_mut().zip(cos.iter_mut()).zip(rotation.iter()) {
+        (*s, *c) = r.sin_cos();
+    }
+    // Straight-line channel arithmetic the compiler can vectorise.
+    for (i, m) in out
+        .chunks_exact_mut(BONE_PALETTE_FLOATS)
+        .take(count)
+        .enumerate()
+    {
+        m[0] = scale_x[i] * cos[i];
+        m[1] = -scale_y[i] * sin[i];
+        m[2] = x[i];
+        m[3] = 0.0;
+        m[4] = scale_x[i] * sin[i];
+        m[5] = scale_y[i] * cos[i];
+        m[6] = y[i];
+        m[7] = 0.0;
+    }
+}
+
+/// Returns a layer's effective weight and blend mode.
+fn layer_blend(layer: &SkeletalLayer, stack: Option<&AnimationLayerStack>) -> (f32, BlendMode) {
+    stack
+        .and_then(|stack| stack.layers.iter().find(|l| l.name == layer.name))
+        .map_or((layer.weight, layer.blend_mode), |l| {
+            (l.weight, l.blend_mode)
+        })
+}
+
+/// Blends one layer's sampled tracks into `scratch`.
+fn blend_layer(
+    bones: &[Bone2D],
+    tracks: &[BoneTrack],
+    time: f32,
+    weight: f32,
+    mode: BlendMode,
+    scratch: &mut PoseScratch,
+) {
+    let weight = weight.min(1.0);
+    let count = scratch.x.len();
+    for track in tracks.iter().filter(|t| t.bone_id < count) {
+        let i = track.bone_id;
+        let sampled = sample_track(&track.keyframes, time);
+        match mode {
+            BlendMode::Override => {
+                let blended = scratch.load(i).lerp(sampled, weight);
+                scratch.store(i, &blended);
+            }
+            BlendMode::Additive => {
+                let rest = &bones[i].local_transform;
+                scratch.x[i] += (sampled.position.x - rest.position.x) * weight;
+                scratch.y[i] += (sampled.position.y - rest.position.y) * weight;
+                scratch.rotation[i] += (sampled.rotation - rest.rotation) * weight;
+                scratch.scale_x[i] += (sampled.scale.x - rest.scale.x) * weight;
+                scratch.scale_y[i] += (sampled.scale.y - rest.scale.y) * weight;
+            }
+        }
+    }
+}
+
+#[cfg(test)]
+#[path = "pose_tests.rs"]
+mod tests;
@@ -0,0 +1,172 @@
+//! Tests for layered pose evaluation and bone palettes.
+
+use super::*;
+use crate::ecs::components::skeleton2d::{BoneKeyframe, SkeletalAnimation, Skeleton2D};
+use crate::ecs::components::sprite_animator::AnimationClip;
+use crate::ecs::systems::update_skeletal_animations;
+use crate::ecs::World;
+use std::f32::consts::FRAC_PI_2;
+
+/// Root at origin with a child offset by (10, 0) and a matching bind pose.
+fn two_bones() -> Vec<Bone2D> {
+    let child = BoneTransform {
+        position: Vec2::new(10.0, 0.0),
+        ..BoneTransform::default()
+    };
+    vec![
+        Bone2D {
+            id: 0,
+            name: "root".into(),
+            parent_id: None,
+            local_transform: BoneTransform::default(),
+            bind_pose_inverse: BoneTransform::default(),
+        },
+        Bone2D {
+            id: 1,
+            name: "child".into(),
+            parent_id: Some(0),
+            local_transform: child,
+            bind_pose_inverse: BoneTransform {
+                position: Vec2::new(-10.0, 0.0),
+                ..BoneTransform::default()
+            },
+        },
+    ]
+}
+
+/// A looping one-second clip holding `transform` on `bone`.
+fn hold(bone: usize, transform: BoneTransform) -> SkeletalAnimation {
+    SkeletalAnimation {
+        name: "hold".into(),
+        duration: 1.0,
+        looping: true,
+        tracks: vec![BoneTrack {
+            bone_id: bone,
+            keyframes: vec![BoneKeyframe {
+                time: 0.0,
+                transform,
+            }],
+        }],
+    }
+}
+
+fn rotated(rotation: f32) -> BoneTransform {
+    BoneTransform {
+        rotation,
+        ..BoneTransform::default()
+    }
+}
+
+fn animator_with_layer(mode: BlendMode, weight: f32) -> SkeletalAnimator {
+    let mut animator = SkeletalAnimator::new(SkeletalAnimation {
+        name: "base".into(),
+        duration: 1.0,
+        looping: true,
+        tracks: Vec::new(),
+    });
+    let mut layer = SkeletalLayer::new("aim", hold(0, rotated(FRAC_PI_2)), mode);
+    layer.weight = weight;
+    animator.layers.push(layer);
+    animator
+}
+
+fn evaluate(
+    bones: &[Bone2D],
+    animator: &SkeletalAnimator,
+    stack: Option<&AnimationLayerStack>,
+) -> Vec<BoneTransform> {
+    let mut world = vec![BoneTransform::default(); bones.len()];
+    evaluate_pose(
+        bones,
+        Some(animator),
+        stack,
+        &mut PoseScratch::default(),
+        &mut world,
+    );
+    world
+}
+
+#[test]
+fn test_rest_pose_without_animator() {
+    let bones = two_bones();
+    let mut world = vec![BoneTransform::default(); 2];
+    evaluate_pose(&bones, None, None, &mut PoseScratch::default(), &mut world);
+    assert!((world[1].position.x - 10.0).abs() < 1e-5);
+}
+
+#[test]
+fn test_override_layer_blends_by_weight() {
+    let bones = two_bones();
+    let world = evaluate(&bones, &animator_with_layer(BlendMode::Override, 0.5), None);
+    assert!((world[0].rotation - FRAC_PI_2 * 0.5).abs() < 1e-5);
+    assert!((world[1].rotation - FRAC_PI_2 * 0.5).abs() < 1e-5);
+}
+
+#[test]
+fn test_additive_layer_adds_offset_from_rest() {
+    let mut bones = two_bones();
+    bones[0].local_transform.rotation = 0.25;
+    let mut animator = animator_with_layer(BlendMode::Additive, 1.0);
+    animator.animation = hold(0, rotated(1.0));
+    let world = evaluate(&bones, &animator, None);
+    // Base clip sets 1.0; the layer adds (PI/2 - 0.25).
+    assert!((world[0].rotation - (1.0 + FRAC_PI_2 - 0.25)).abs() < 1e-5);
+}
+
+#[test]
+fn test_animation_layer_stack_sets_weight_and_mode() {
+    let bones = two_bones();
+    let animator = animator_with_layer(BlendMode::Additive, 1.0);
+    let clip = AnimationClip::new(Vec::new(), 0.1);
+    let muted =
+        AnimationLayerStack::new().with_layer("aim", clip.clone(), 0.0, BlendMode::Override);
+    assert!(evaluate(&bones, &animator, Some(&muted))[0].rotation.abs() < 1e-5);
+
+    let half = AnimationLayerStack::new().with_layer("aim", clip, 0.5, BlendMode::Override);
+    let rotation = evaluate(&bones, &animator, Some(&half))[0].rotation;
+    assert!((rotation - FRAC_PI_2 * 0.5).abs() < 1e-5);
+}
+
+#[test]
+fn test_palette_matches_skinning_transform() {
+    let bones = two_bones();
+    let world = evaluate(&bones, &animator_with_layer(BlendMode::Override, 1.0), None);
+    let mut palette = vec![f32::NAN; 2 * BONE_PALETTE_FLOATS];
+    write_bone_palette(&bones, &world, &mut PoseScratch::default(), &mut palette);
+
+    for (i, m) in palette.chunks_exact(BONE_PALETTE_FLOATS).enumerate() {
+        let skin = BoneTransform::combine(&world[i], &bones[i].bind_pose_inverse).to_matrix();
+        let expected = [
+            skin[0][0], skin[0][1], skin[0][2], 0.0, skin[1][0], skin[1][1], skin[1][2], 0.0,
+        ];
+        for (got, want) in m.iter().zip(expected) {
+            assert!((got - want).abs() < 1e-5, "bone {i}: {m:?}");
+        }
+    }
+    // The child's rest offset cancels its bind pose; rotation moves it.
+    assert!((palette[BONE_PALETTE_FLOATS + 2]).abs() < 1e-4);
+}
+
+#[test]
+fn test_system_advances_and_applies_layers() {
+    let mut world = World::new();
+    let entity = world.spawn_empty();
+    let mut animator = animator_with_layer(BlendMode::Override, 1.0);
+    animator.layers[0].animation.tracks[0]
+        .keyframes
+        .push(BoneKeyframe {
+            time: 1.0,
+            transform: rotated(0.0),
+        });
+    animator.layers[0].current_time = 0.5;
+    animator.play();
+    world.insert(entity, Skeleton2D::new(two_bones()));
+    world.insert(entity, animator);
+
+    update_skeletal_animations(&mut world, 0.25);
+
+    let animator = world.get::<SkeletalAnimator>(entity).unwrap();
+    assert!((animator.layers[0].current_time - 0.75).abs() < 1e-5);
+    let skel = world.get::<Skeleton2D>(entity).unwrap();
+    assert!((skel.world_transforms[0].rotation - FRAC_PI_2 * 0.25).abs() < 1e-5);
+}
@@ -7,11 +7,12 @@
 //! 2. [`deform_skeletal_meshes`] -- applies bone transforms to mesh vertices
 //!    via linear blend skinning.
 
-use super::interpolation::sample_track;
+use super::pose::{evaluate_pose, PoseScratch};
 use crate::core::math::Vec2;
 use crate::ecs::components::skeleton2d::{
     BoneTransform, SkeletalAnimator, SkeletalMesh2D, Skeleton2D,
 };
+use crate::ecs::components::AnimationLayerStack;
 use crate::ecs::World;
 
 /// Advances skeletal animations and propagates bone transforms.
@@ -20,7 +21,8 @@ use crate::ecs::World;
 ///
 /// 1. Advance `current_time` by `dt * speed`.
 /// 2. Handle looping (wrap) or clamping for non-looping animations.
-/// 3. Sample each bone track at the current time to get local transforms.
+/// 3. Sample each bone track at the current time to get local transforms,
+///    blending the animator's layers over the base clip.
 /// 4. Propagate through the bone hierarchy to compute world transforms.
 pub fn update_skeletal_animations(world: &mut World, dt: f32) {
     let entities: Vec<_> = world
@@ -30,83 +32,38 @@ pub fn update_skeletal_animations(world: &mut World, dt: f32) {
         .filter(|&entity| world.has::<SkeletalAnimator>(entity) && world.has::<Skeleton2D>(entity))
         .collect();
 
+    let mut scratch = PoseScratch::default();
     for entity in entities {
         // --- Phase 1: advance time on the animator ---
-        let (tracks, current_time, bone_count) = {
-            let Some(animator) = world.get_mut::<SkeletalAnimator>(entity) else {
-                continue;
-            };
-
-            if !animator.playing || animator.animation.duration <= 0.0 {
-                continue;
-            }
-
-            animator.current_time += dt * animator.speed;
-
-            if animator.animation.looping {
-                while animator.current_time >= animator.animation.duration {
-                    animator.current_time -= animator.animation.duration;
-                }
-                while animator.current_time < 0.0 {
-                    animator.current_time += animator.animation.duration;
-                }
-            } else {
-                animator.current_time = animator
-                    .current_time
-                    .clamp(0.0, animator.animation.duration);
-            }
-
-            let time = animator.current_time;
-            // PERF: tracks.clone() allocates per frame. An arena allocator or
-            // shared reference (e.g. Arc<Vec<BoneTrack>>) would avoid this.
-            let tracks = animator.animation.tracks.clone();
-            let bone_count = {
-                let Some(skel) = world.get::<Skeleton2D>(entity) else {
-                    continue;
-                };
-                skel.bone_count()
-            };
-            (tracks, time, bone_count)
+        let Some(animator) = world.get_mut::<SkeletalAnimator>(entity) else {
+            continue;
         };
-
-        // --- Phase 2: sample keyframes into local transforms ---
-        let mut local_transforms = vec![BoneTransform::default(); bone_count];
-
-        // Start from the skeleton's stored local transforms as defaults.
-        {
-            let Some(skel) = world.get::<Skeleton2D>(entity) else {
-                continue;
-            };
-            for (i, bone) in skel.bones.iter().enumerate() {
-                local_transforms[i] = bone.local_transform;
-            }
-        }
-
-        // Override with sampled keyframe data for animated bones.
-        for track in &tracks {
-            if track.bone_id < bone_count {
-                local_transforms[track.bone_id] = sample_track(&track.keyframes, current_time);
-            }
+        if !animator.advance(dt) {
+            continue;
         }
 
-        // --- Phase 3: propagate hierarchy to world transforms ---
-        // Collect parent IDs so we can do indexed parent lookups on world_transforms.
-        let parent_ids: Vec<Option<usize>> = {
-            let Some(skel) = world.get::<Skeleton2D>(entity) else {
+        // --- Phase 2: sample and propagate into the skeleton's cache ---
+        // The cache is moved out so the pose can be evaluated from shared
+        // borrows of the animator and skeleton without cloning either.
+        let mut world_transforms = {
+            let Some(skel) = world.get_mut::<Skeleton2D>(entity) else {
                 continue;
             };
-            skel.bones.iter().map(|b| b.parent_id).collect()
-        };
-
-        let Some(skel) = world.get_mut::<Skeleton2D>(entity) else {
-            continue;
+            let mut cache = std::mem::take(&mut skel.world_transforms);
+            cache.resize(skel.bone_count(), BoneTransform::default());
+            cache
         };
-
-        for (i, (local, parent_id)) in local_transforms.iter().zip(parent_ids.iter()).enumerate() {
-            skel.world_transforms[i] = match parent_id {
-                Some(pid) => BoneTransform::combine(&skel.world_transforms[*pid], local),
-                None => *local,
-            };
+        if let Some(skel) = world.get::<Skeleton2D>(entity) {
+            evaluate_pose(
+                &skel.bones,
+                world.get::<SkeletalAnimator>(entity),
+                world.get::<AnimationLayerStack>(entity),
+                &mut scratch,
+                &mut world_transforms,
+            );
+        }
+        if let Some(skel) = world.get_mut::<Skeleton2D>(entity) {
+            skel.world_transforms = world_transforms;
         }
     }
 }
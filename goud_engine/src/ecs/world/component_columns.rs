@@ -0,0 +1,198 @@
+//! Bulk component columns for packed scene data.
+//!
+//! [`serialize_entity`](World::serialize_entity) and
+//! [`deserialize_entity_components`](World::deserialize_entity_components)
+//! go through one `serde_json::Value` and one archetype move per component.
+//! Columns instead hold the bincode encoding of one serializable component
+//! type for a run of entities back to back, so a block of entities that
+//! share a component set is spawned straight into its final archetype and
+//! each storage is filled in one pass.
+
+use std::collections::BTreeSet;
+
+use super::super::component::ComponentId;
+use super::super::entity::Entity;
+use super::World;
+
+impl World {
+    /// Returns the registered type name of a serializable component.
+    ///
+    /// `None` if `id` is not registered via
+    /// [`register_serializable`](Self::register_serializable).
+    pub fn serializable_type_name(&self, id: ComponentId) -> Option<&'static str> {
+        self.storages.get(&id)?.type_name()
+    }
+
+    /// Appends the bincode encoding of each entity's `type_name` component to
+    /// `out`, in the order of `entities`.
+    ///
+    /// # Returns
+    ///
+    /// `false` if `type_name` is not registered as serializable, an entity
+    /// lacks the component, or encoding fails. `out` may then hold a partial
+    /// column and should be discarded.
+    pub fn encode_component_column(
+        &self,
+        type_name: &str,
+        entities: &[Entity],
+        out: &mut Vec<u8>,
+    ) -> bool {
+        let Some(id) = self.serializable_names.get(type_name) else {
+            return false;
+        };
+        self.storages
+            .get(id)
+            .is_some_and(|entry| entry.encode_column(entities, out))
+    }
+
+    /// Spawns `count` entities whose components are decoded from columns.
+    ///
+    /// Each column is a registered type name and the bytes written by
+    /// [`encode_component_column`](Self::encode_component_column) for exactly
+    /// `count` entities. All entities go straight into the archetype of the
+    /// registered column types; columns of unregistered types are skipped,
+    /// as [`deserialize_entity_components`](Self::deserialize_entity_components)
+    /// skips unknown components.
+    ///
+    /// # Returns
+    ///
+    /// The spawned entities in column order, or `None` if a column does not
+    /// decode to `count` components, in which case nothing is spawned.
+    pub fn spawn_with_component_columns(
+        &mut self,
+        count: usize,
+        columns: &[(&str, &[u8])],
+    ) -> Option<Vec<Entity>> {
+        let columns: Vec<(ComponentId, &[u8])> = columns
+            .iter()
+            .filter_map(|&(name, bytes)| Some((*self.serializable_names.get(name)?, bytes)))
+            .collect();
+        if count == 0 {
+            return Some(Vec::new());
+        }
+
+        let components: BTreeSet<ComponentId> = columns.iter().map(|&(id, _)| id).collect();
+        let archetype_id = self.archetypes.find_or_create(components);
+        let entities = self.entities.allocate_batch(count);
+        let archetype = self
+            .archetypes
+            .get_mut(archetype_id)
+            .expect("archetype was just found or created");
+        for &entity in &entities {
+            archetype.add_entity(entity);
+            self.entity_archetypes.insert(entity, archetype_id);
+        }
+
+        let tick = self.change_tick;
+        let decoded = columns.iter().all(|&(id, bytes)| {
+            self.storages
+                .get_mut(&id)
+                .is_some_and(|entry| entry.decode_column(&entities, bytes, tick))
+        });
+        if !decoded {
+            for &entity in &entities {
+                self.despawn(entity);
+            }
+            return None;
+        }
+        Some(entities)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::super::super::Component;
+    use super::super::World;
+
+    #[derive(Debug, Clone, PartialEq, serde::Serialize, serde::Deserialize)]
+    struct Position {
+        x: f32,
+        y: f32,
+    }
+    impl Component for Position {}
+
+    #[derive(Debug, Clone, PartialEq, serde::Serialize, serde::Deserialize)]
+    struct Label(String);
+    impl Component for Label {}
+
+    fn world() -> World {
+        let mut world = World::new();
+        world.register_serializable::<Position>();
+        world.register_serializable::<Label>();
+        world
+    }
+
+    #[test]
+    fn test_columns_roundtrip_into_one_archetype() {
+        let mut source = world();
+        let entities: Vec<_> = (0..5)
+            .map(|i| {
+                let entity = source.spawn_empty();
+                source.insert(
+                    entity,
+                    Position {
+                        x: i as f32,
+                        y: 1.0,
+                    },
+                );
+                source.insert(entity, Label(format!("e{i}")));
+                entity
+            })
+            .collect();
+        let position = std::any::type_name::<Position>();
+        let label = std::any::type_name::<Label>();
+        let (mut positions, mut labels) = (Vec::new(), Vec::new());
+        assert!(source.encode_component_column(position, &entities, &mut positions));
+        assert!(source.encode_component_column(label, &entities, &mut labels));
+
+        let mut target = world();
+        let archetypes_before = target.archetype_count();
+        let spawned = target
+            .spawn_with_component_columns(
+                5,
+                &[
+                    (position, positions.as_slice()),
+                    (label, labels.as_slice()),
+                    ("unknown", &[1u8, 2][..]),
+                ],
+            )
+            .unwrap();
+        assert_eq!(spawned.len(), 5);
+        assert_eq!(target.archetype_count(), archetypes_before + 1);
+        for (i, &entity) in spawned.iter().enumerate() {
+            assert_eq!(
+                target.get::<Position>(entity),
+                Some(&Position {
+                    x: i as f32,
+                    y: 1.0
+                })
+            );
+            assert_eq!(target.get::<Label>(entity), Some(&Label(format!("e{i}"))));
+        }
+    }
+
+    #[test]
+    fn test_bad_columns_spawn_nothing() {
+        let mut source = world();
+        let entity = source.spawn_empty();
+        source.insert(entity, Position { x: 1.0, y: 2.0 });
+        let position = std::any::type_name::<Position>();
+        let mut bytes = Vec::new();
+        assert!(!source.encode_component_column("unknown", &[entity], &mut bytes));
+        let bare = source.spawn_empty();
+        assert!(!source.encode_component_column(position, &[bare], &mut bytes));
+
+        bytes.clear();
+        assert!(source.encode_component_column(position, &[entity], &mut bytes));
+        let mut target = world();
+        assert!(target
+            .spawn_with_component_columns(2, &[(position, bytes.as_slice())])
+            .is_none());
+        let mut trailing = bytes.clone();
+        trailing.push(0);
+        assert!(target
+            .spawn_with_component_columns(1, &[(position, trailing.as_slice())])
+            .is_none());
+        assert_eq!(target.entity_count(), 0);
+    }
+}
@@ -0,0 +1,374 @@
+//! Batched prefab instantiation.
+//!
+//! [`clone_entity_recursive`](World::clone_entity_recursive) clones one
+//! hierarchy per call, moving each clone through one archetype per
+//! component.  [`instantiate_batch`](World::instantiate_batch) clones a
+//! template hierarchy many times at once: for every template entity, all of
+//! its clones are allocated straight into their final archetype and each
+//! component storage is filled for the whole run in one pass.
+
+use std::collections::BTreeSet;
+
+use rustc_hash::FxHashSet;
+
+use super::super::component::ComponentId;
+use super::super::entity::Entity;
+use super::storage_entry::ComponentStorageEntry;
+use super::World;
+use crate::ecs::components::hierarchy::{Children, Parent};
+
+/// The entities created by [`World::instantiate_batch`].
+///
+/// Template entities are listed root first, with every parent before its
+/// children.  Each template entity has one clone per instance, and clone
+/// `k` of every template entity belongs to instance `k`.
+#[derive(Debug, Clone, Default, PartialEq, Eq)]
+pub struct PrefabInstances {
+    templates: Vec<Entity>,
+    /// `count` clones per template entity, in the order of `templates`.
+    clones: Vec<Entity>,
+    count: usize,
+}
+
+impl PrefabInstances {
+    /// Number of instances.
+    #[inline]
+    pub fn len(&self) -> usize {
+        self.count
+    }
+
+    /// Returns `true` if no instances were created.
+    #[inline]
+    pub fn is_empty(&self) -> bool {
+        self.count == 0
+    }
+
+    /// The template hierarchy, root first.
+    #[inline]
+    pub fn templates(&self) -> &[Entity] {
+        &self.templates
+    }
+
+    /// The root entity of every instance.
+    #[inline]
+    pub fn roots(&self) -> &[Entity] {
+        self.clones_of(0)
+    }
+
+    /// The clones of `templates()[node]`, one per instance.
+    ///
+    /// Empty if `node` is out of range.
+    pub fn clones_of(&self, node: usize) -> &[Entity] {
+        let start = node.saturating_mul(self.count);
+        self.clones
+            .get(start..start.saturating_add(self.count))
+            .unwrap_or(&[])
+    }
+
+    /// Every created entity.
+    #[inline]
+    pub fn entities(&self) -> &[Entity] {
+        &self.clones
+    }
+}
+
+impl World {
+    /// Clones the hierarchy rooted at `template` `count` times.
+    ///
+    /// Produces the same entities as `count` calls to
+    /// [`clone_entity_recursive`](Self::clone_entity_recursive): each
+    /// instance copies every cloneable component of every template entity,
+    /// instance roots have no [`Parent`], and cloned children are parented
+    /// under the matching cloned parent, in the template's child order.
+    /// Components whose types were not registered via
+    /// [`register_cloneable`](Self::register_cloneable) are skipped.
+    ///
+    /// # Returns
+    ///
+    /// The created entities, or `None` if `template` is not alive.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use goud_engine::ecs::World;
+    /// use goud_engine::ecs::components::Name;
+    ///
+    /// let mut world = World::new();
+    /// world.register_builtin_cloneables();
+    /// let template = world.spawn_empty();
+    /// world.insert(template, Name::new("enemy"));
+    ///
+    /// let instances = world.instantiate_batch(template, 500).unwrap();
+    /// assert_eq!(instances.roots().len(), 500);
+    /// assert_eq!(world.get::<Name>(instances.roots()[0]).map(Name::as_str), Some("enemy"));
+    /// ```
+    pub fn instantiate_batch(&mut self, template: Entity, count: usize) -> Option<PrefabInstances> {
+        if !self.is_alive(template) {
+            return None;
+        }
+        let (templates, parents) = self.template_hierarchy(template);
+        if count == 0 {
+            return Some(PrefabInstances {
+                templates,
+                clones: Vec::new(),
+                count,
+            });
+        }
+
+        let parent_id = ComponentId::of::<Parent>();
+        let children_id = ComponentId::of::<Children>();
+        let mut child_nodes: Vec<Vec<usize>> = vec![Vec::new(); templates.len()];
+        for (node, parent) in parents.iter().enumerate() {
+            if let Some(parent) = *parent {
+                child_nodes[parent].push(node);
+            }
+        }
+
+        let tick = self.change_tick;
+        let mut clones = Vec::with_capacity(templates.len() * count);
+        for (node, &source) in templates.iter().enumerate() {
+            let cloned: Vec<ComponentId> = self
+                .entity_archetypes
+                .get(&source)
+                .and_then(|&id| self.archetypes.get(id))
+                .map(|archetype| {
+                    archetype
+                        .components()
+                        .iter()
+                        .copied()
+                        .filter(|&id| id != parent_id && id != children_id)
+                        .filter(|id| {
+                            self.storages
+                                .get(id)
+                                .is_some_and(ComponentStorageEntry::is_cloneable)
+                        })
+                        .collect()
+                })
+                .unwrap_or_default();
+
+            let mut components: BTreeSet<ComponentId> = cloned.iter().copied().collect();
+            if parents[node].is_some() {
+                components.insert(parent_id);
+            }
+            if !child_nodes[node].is_empty() {
+                components.insert(children_id);
+            }
+            let archetype_id = self.archetypes.find_or_create(components);
+            let entities = self.entities.allocate_batch(count);
+            let archetype = self
+                .archetypes
+                .get_mut(archetype_id)
+                .expect("archetype was just found or created");
+            for &entity in &entities {
+                archetype.add_entity(entity);
+                self.entity_archetypes.insert(entity, archetype_id);
+            }
+
+            for id in &cloned {
+                if let Some(entry) = self.storages.get_mut(id) {
+                    entry.clone_to_many(source, &entities, tick);
+                }
+            }
+            clones.extend(entities);
+        }
+
+        self.link_instances(&parents, &child_nodes, &clones, count);
+        Some(PrefabInstances {
+            templates,
+            clones,
+            count,
+        })
+    }
+
+    /// Collects the live hierarchy under `root` breadth-first.
+    ///
+    /// Returns the template entities and the index of each one's parent in
+    /// that list (`None` for the root).  An entity reachable twice is only
+    /// visited once.
+    fn template_hierarchy(&self, root: Entity) -> (Vec<Entity>, Vec<Option<usize>>) {
+        let mut templates = vec![root];
+        let mut parents = vec![None];
+        let mut seen = FxHashSet::default();
+        seen.insert(root);
+        let mut next = 0;
+        while next < templates.len() {
+            if let Some(children) = self.get::<Children>(templates[next]) {
+                for &child in children.as_slice() {
+                    if self.is_alive(child) && seen.insert(child) {
+                        templates.push(child);
+                        parents.push(Some(next));
+                    }
+                }
+            }
+            next += 1;
+        }
+        (templates, parents)
+    }
+
+    /// Writes the `Parent` and `Children` components of freshly cloned
+    /// instances, whose archetypes already include them.
+    fn link_instances(
+        &mut self,
+        parents: &[Option<usize>],
+        child_nodes: &[Vec<usize>],
+        clones: &[Entity],
+        count: usize,
+    ) {
+        let tick = self.change_tick;
+        if let Some(storage) = self
+            .storages
+            .entry(ComponentId::of::<Parent>())
+            .or_insert_with(ComponentStorageEntry::new::<Parent>)
+            .downcast_mut::<Parent>()
+        {
+            storage.reserve(clones.len().saturating_sub(count));
+            for (node, parent) in parents.iter().enumerate() {
+                let Some(parent) = *parent else {
+                    continue;
+                };
+                for k in 0..count {
+                    let parent = Parent::new(clones[parent * count + k]);
+                    storage.insert_with_tick(clones[node * count + k], parent, tick);
+                }
+            }
+        }
+
+        if let Some(storage) = self
+            .storages
+            .entry(ComponentId::of::<Children>())
+            .or_insert_with(ComponentStorageEntry::new::<Children>)
+            .downcast_mut::<Children>()
+        {
+            let mut children = Vec::new();
+            for (node, nodes) in child_nodes.iter().enumerate() {
+                if nodes.is_empty() {
+                    continue;
+                }
+                for k in 0..count {
+                    children.clear();
+                    children.extend(nodes.iter().map(|&child| clones[child * count + k]));
+                    let value = Children::from_slice(&children);
+                    storage.insert_with_tick(clones[node * count + k], value, tick);
+                }
+            }
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::super::super::entity::Entity;
+    use super::super::super::Component;
+    use super::super::World;
+    use crate::ecs::components::hierarchy::{Children, Name, Parent};
+
+    #[derive(Debug, Clone, Copy, PartialEq)]
+    struct Health(u32);
+    impl Component for Health {}
+
+    #[derive(Debug, Clone, Copy, PartialEq)]
+    struct Speed(f32);
+    impl Component for Speed {}
+
+    #[derive(Debug, Clone, Copy, PartialEq)]
+    struct Unregistered;
+    impl Component for Unregistered {}
+
+    /// An enemy root with three children, each with a grandchild on the last.
+    fn enemy(world: &mut World) -> Entity {
+        world.register_builtin_cloneables();
+        world.register_cloneable::<Health>();
+        world.register_cloneable::<Speed>();
+        let root = world.spawn_empty();
+        world.insert(root, Name::new("enemy"));
+        world.insert(root, Health(10));
+        world.insert(root, Unregistered);
+        let mut children = Vec::new();
+        for i in 0..3 {
+            let child = world.spawn_empty();
+            world.insert(child, Speed(i as f32));
+            world.insert(child, Parent::new(root));
+            children.push(child);
+        }
+        world.insert(root, Children::from_slice(&children));
+        let grandchild = world.spawn_empty();
+        world.insert(grandchild, Health(1));
+        world.insert(grandchild, Parent::new(children[2]));
+        world.insert(children[2], Children::from_slice(&[grandchild]));
+        root
+    }
+
+    #[test]
+    fn test_instantiate_batch_clones_the_hierarchy_per_instance() {
+        let mut world = World::new();
+        let template = enemy(&mut world);
+        let before = world.entity_count();
+
+        let instances = world.instantiate_batch(template, 50).unwrap();
+        assert_eq!(instances.len(), 50);
+        assert_eq!(instances.templates().len(), 5);
+        assert_eq!(instances.entities().len(), 250);
+        assert_eq!(world.entity_count(), before + 250);
+
+        for &root in instances.roots() {
+            assert!(!world.has::<Parent>(root), "instance roots are detached");
+            assert!(!world.has::<Unregistered>(root));
+            assert_eq!(world.get::<Health>(root), Some(&Health(10)));
+            assert_eq!(world.get::<Name>(root).map(Name::as_str), Some("enemy"));
+
+            let children = world.get::<Children>(root).unwrap().as_slice().to_vec();
+            assert_eq!(children.len(), 3);
+            for (i, &child) in children.iter().enumerate() {
+                assert_eq!(world.get::<Parent>(child).unwrap().get(), root);
+                assert_eq!(world.get::<Speed>(child), Some(&Speed(i as f32)));
+            }
+            let grandchild = world.get::<Children>(children[2]).unwrap().as_slice()[0];
+            assert_eq!(world.get::<Parent>(grandchild).unwrap().get(), children[2]);
+            assert_eq!(world.get::<Health>(grandchild), Some(&Health(1)));
+        }
+
+        let template_children = world.get::<Children>(template).unwrap();
+        assert_eq!(template_children.len(), 3, "the template is untouched");
+    }
+
+    #[test]
+    fn test_instantiate_batch_matches_recursive_clone_archetypes() {
+        let mut world = World::new();
+        let template = enemy(&mut world);
+        let single = world.clone_entity_recursive(template).unwrap();
+        let archetypes = world.archetype_count();
+
+        let instances = world.instantiate_batch(template, 4).unwrap();
+        assert_eq!(
+            world.archetype_count(),
+            archetypes,
+            "instances land in the archetypes a recursive clone uses"
+        );
+        let root = instances.roots()[0];
+        assert_eq!(
+            world.get::<Children>(root).unwrap().len(),
+            world.get::<Children>(single).unwrap().len()
+        );
+    }
+
+    #[test]
+    fn test_instantiate_batch_edge_cases() {
+        let mut world = World::new();
+        let template = enemy(&mut world);
+        let before = world.entity_count();
+
+        let none = world.instantiate_batch(template, 0).unwrap();
+        assert!(none.is_empty());
+        assert!(none.roots().is_empty());
+        assert_eq!(world.entity_count(), before);
+
+        let leaf = world.spawn_empty();
+        world.insert(leaf, Health(3));
+        let leaves = world.instantiate_batch(leaf, 3).unwrap();
+        assert_eq!(leaves.entities(), leaves.roots());
+        assert!(leaves.clones_of(1).is_empty());
+
+        world.despawn(leaf);
+        assert!(world.instantiate_batch(leaf, 3).is_none());
+    }
+}
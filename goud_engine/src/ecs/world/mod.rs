@@ -48,16 +48,21 @@ use super::resource::{NonSendResources, Resources};
 
 mod clone_entity;
 mod component_access;
+mod component_columns;
 mod component_mutation;
 mod entity_ops;
 mod entity_world_mut;
+mod instantiate;
 mod non_send_resources;
 mod pool_ops;
 mod resources;
 mod serialize_entity;
+mod snapshot;
 mod storage_entry;
 
+pub use instantiate::PrefabInstances;
 pub use pool_ops::EntityPoolRegistry;
+pub use snapshot::WorldSnapshot;
 
 #[cfg(test)]
 mod tests;
@@ -0,0 +1,189 @@
+//! In-memory world snapshots for rollback and resimulation.
+//!
+//! [`World::save_snapshot`] captures everything a simulation step changes:
+//! entity allocation, archetype membership, every component storage and the
+//! change ticks. [`World::restore_snapshot`] puts it all back. Nothing is
+//! encoded; each storage is cloned as a whole, and a storage that has not
+//! been written since it was last saved or restored is shared with that
+//! snapshot instead of copied. A ring of per-frame snapshots therefore copies
+//! only the component types that actually changed each frame.
+//!
+//! Resources and non-send resources are not captured.
+
+use rustc_hash::FxHashMap;
+
+use super::super::archetype::{ArchetypeGraph, ArchetypeId};
+use super::super::component::ComponentId;
+use super::super::entity::{Entity, EntityAllocator};
+use super::storage_entry::{ComponentStorageEntry, SnapshotColumn};
+use super::World;
+
+/// A saved copy of a world's entities and components.
+///
+/// Create one with [`World::save_snapshot`], refresh it in place every frame
+/// with [`World::save_snapshot_into`], and roll back with
+/// [`World::restore_snapshot`]. A snapshot holds no reference to the world
+/// and can be restored any number of times.
+#[derive(Debug)]
+pub struct WorldSnapshot {
+    entities: EntityAllocator,
+    archetypes: ArchetypeGraph,
+    entity_archetypes: FxHashMap<Entity, ArchetypeId>,
+    columns: FxHashMap<ComponentId, SnapshotColumn>,
+    change_tick: u32,
+    last_change_tick: u32,
+    shared_columns: usize,
+}
+
+impl Default for WorldSnapshot {
+    /// Creates a snapshot of an empty world, to be filled by
+    /// [`World::save_snapshot_into`].
+    fn default() -> Self {
+        Self {
+            entities: EntityAllocator::new(),
+            archetypes: ArchetypeGraph::new(),
+            entity_archetypes: FxHashMap::default(),
+            columns: FxHashMap::default(),
+            change_tick: 0,
+            last_change_tick: 0,
+            shared_columns: 0,
+        }
+    }
+}
+
+impl WorldSnapshot {
+    /// Returns the number of entities alive when the snapshot was saved.
+    #[inline]
+    pub fn entity_count(&self) -> usize {
+        self.entity_archetypes.len()
+    }
+
+    /// Returns the number of component storages saved.
+    #[inline]
+    pub fn column_count(&self) -> usize {
+        self.columns.len()
+    }
+
+    /// Returns how many saved storages are shared with an earlier snapshot
+    /// because they had not changed, rather than copied.
+    #[inline]
+    pub fn shared_column_count(&self) -> usize {
+        self.shared_columns
+    }
+}
+
+impl World {
+    /// Saves the world's entities and components into a new snapshot.
+    ///
+    /// Only component types registered via
+    /// [`register_cloneable`](Self::register_cloneable) can be saved.
+    ///
+    /// # Returns
+    ///
+    /// `None` if a component type that is not cloneable has any components.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use goud_engine::ecs::{Component, World};
+    ///
+    /// #[derive(Clone, Debug, PartialEq)]
+    /// struct Health(i32);
+    /// impl Component for Health {}
+    ///
+    /// let mut world = World::new();
+    /// world.register_cloneable::<Health>();
+    /// let entity = world.spawn_empty();
+    /// world.insert(entity, Health(10));
+    ///
+    /// let snapshot = world.save_snapshot().unwrap();
+    /// world.insert(entity, Health(0));
+    /// assert!(world.restore_snapshot(&snapshot));
+    /// assert_eq!(world.get::<Health>(entity), Some(&Health(10)));
+    /// ```
+    pub fn save_snapshot(&mut self) -> Option<WorldSnapshot> {
+        let mut snapshot = WorldSnapshot::default();
+        self.save_snapshot_into(&mut snapshot).then_some(snapshot)
+    }
+
+    /// Overwrites `snapshot` with the world's current entities and components.
+    ///
+    /// Storages unchanged since the last save or restore are shared with
+    /// that snapshot; the rest are copied, reusing `snapshot`'s previous copy
+    /// when no other snapshot shares it.
+    ///
+    /// # Returns
+    ///
+    /// `false`, leaving `snapshot` untouched, if a component type that is
+    /// not cloneable has any components.
+    pub fn save_snapshot_into(&mut self, snapshot: &mut WorldSnapshot) -> bool {
+        if !self
+            .storages
+            .values()
+            .all(ComponentStorageEntry::is_snapshottable)
+        {
+            return false;
+        }
+
+        snapshot.entities.clone_from(&self.entities);
+        snapshot.archetypes.clone_from(&self.archetypes);
+        snapshot
+            .entity_archetypes
+            .clone_from(&self.entity_archetypes);
+        snapshot.change_tick = self.change_tick;
+        snapshot.last_change_tick = self.last_change_tick;
+        snapshot.shared_columns = 0;
+
+        for (&id, entry) in &mut self.storages {
+            let recycled = snapshot.columns.remove(&id);
+            if let Some((column, shared)) = entry.save_column(recycled) {
+                snapshot.shared_columns += usize::from(shared);
+                snapshot.columns.insert(id, column);
+            }
+        }
+        let storages = &self.storages;
+        snapshot.columns.retain(|id, _| storages.contains_key(id));
+        true
+    }
+
+    /// Returns `true` if [`restore_snapshot`](Self::restore_snapshot) would
+    /// succeed: every component type in the snapshot still has a storage
+    /// here that can take it back, which is not the case after
+    /// [`clear`](Self::clear).
+    pub fn can_restore_snapshot(&self, snapshot: &WorldSnapshot) -> bool {
+        snapshot.columns.iter().all(|(id, column)| {
+            self.storages
+                .get(id)
+                .is_some_and(|entry| entry.can_restore_column(column))
+        })
+    }
+
+    /// Rolls the world back to `snapshot`.
+    ///
+    /// Entities spawned since the snapshot are gone afterwards and
+    /// despawned ones are alive again with their old IDs. Components of
+    /// types that had none when the snapshot was saved are cleared.
+    ///
+    /// # Returns
+    ///
+    /// `false`, leaving the world untouched, if
+    /// [`can_restore_snapshot`](Self::can_restore_snapshot) is `false`.
+    pub fn restore_snapshot(&mut self, snapshot: &WorldSnapshot) -> bool {
+        if !self.can_restore_snapshot(snapshot) {
+            return false;
+        }
+
+        self.entities.clone_from(&snapshot.entities);
+        self.archetypes.clone_from(&snapshot.archetypes);
+        self.entity_archetypes
+            .clone_from(&snapshot.entity_archetypes);
+        self.change_tick = snapshot.change_tick;
+        self.last_change_tick = snapshot.last_change_tick;
+
+        let mut restored = true;
+        for (id, entry) in &mut self.storages {
+            restored &= entry.restore_column(snapshot.columns.get(id));
+        }
+        restored
+    }
+}
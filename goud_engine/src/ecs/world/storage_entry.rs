@@ -1,9 +1,12 @@
 use std::any::Any;
+use std::sync::Arc;
 
 use super::super::entity::Entity;
 use super::super::sparse_set::SparseSet;
 use super::super::Component;
 
+mod snapshot;
+
 /// Type-erased function pointer for removing an entity from storage.
 ///
 /// This is used to perform type-erased removal without knowing the concrete
@@ -16,6 +19,14 @@ pub(super) type RemoveEntityFn = fn(storage: &mut dyn Any, entity: Entity) -> bo
 /// to the target entity.
 pub(super) type CloneToFn = fn(storage: &mut dyn Any, source: Entity, target: Entity) -> bool;
 
+/// Type-erased function pointer for cloning one entity's component to many
+/// entities in one pass.
+///
+/// Returns `true` if the source entity had the component and it was cloned
+/// to every target.
+pub(super) type CloneManyFn =
+    fn(storage: &mut dyn Any, source: Entity, targets: &[Entity], change_tick: u32) -> bool;
+
 /// Type-erased function pointer for serializing a component from storage.
 ///
 /// Given a storage and an entity, returns the serialized JSON value if the
@@ -38,6 +49,43 @@ pub(super) type InsertAnyFn =
 /// Type-erased function pointer that returns the type name of a component.
 pub(super) type TypeNameFn = fn() -> &'static str;
 
+/// Type-erased function pointer for bincode-encoding the components of
+/// several entities back to back.
+///
+/// Returns false if an entity lacks the component or encoding fails.
+pub(super) type EncodeColumnFn =
+    fn(storage: &dyn Any, entities: &[Entity], out: &mut Vec<u8>) -> bool;
+
+/// Type-erased function pointer for decoding a column written by an
+/// [`EncodeColumnFn`] and inserting one component per entity.
+///
+/// Nothing is inserted unless every value decodes and the bytes are used up.
+pub(super) type DecodeColumnFn =
+    fn(storage: &mut dyn Any, entities: &[Entity], bytes: &[u8], change_tick: u32) -> bool;
+
+/// Type-erased function pointer that returns the number of stored components.
+pub(super) type LenFn = fn(storage: &dyn Any) -> usize;
+
+/// Type-erased function pointer that removes every component from storage.
+pub(super) type ClearFn = fn(storage: &mut dyn Any);
+
+/// A whole `SparseSet<T>` copied into a [`WorldSnapshot`](super::WorldSnapshot).
+///
+/// Reference counted so every snapshot taken while the storage is untouched
+/// shares one copy.
+pub(super) type SnapshotColumn = Arc<dyn Any + Send + Sync>;
+
+/// Type-erased function pointer for copying a storage into a snapshot column.
+///
+/// Reuses the allocations of `recycled` when no other snapshot shares it.
+pub(super) type SaveColumnFn =
+    fn(storage: &dyn Any, recycled: Option<SnapshotColumn>) -> Option<SnapshotColumn>;
+
+/// Type-erased function pointer for overwriting a storage with a snapshot
+/// column. Returns false if the column holds a different component type.
+pub(super) type RestoreColumnFn =
+    fn(storage: &mut dyn Any, column: &(dyn Any + Send + Sync)) -> bool;
+
 /// Internal wrapper for type-erased component storage.
 ///
 /// This struct allows us to:
@@ -55,11 +103,19 @@ pub(super) struct ComponentStorageEntry {
     /// Returns true if a component was removed.
     remove_entity_fn: RemoveEntityFn,
 
+    /// Function pointers to count and clear the storage without knowing T.
+    len_fn: LenFn,
+    clear_fn: ClearFn,
+
     /// Optional function pointer for cloning a component between entities.
     /// Only set for component types registered as cloneable via
     /// `World::register_cloneable`.
     clone_to_fn: Option<CloneToFn>,
 
+    /// Optional function pointer for cloning a component to many entities.
+    /// Set together with `clone_to_fn`.
+    clone_many_fn: Option<CloneManyFn>,
+
     /// Optional function pointer for serializing a component to JSON.
     /// Only set for component types registered as serializable.
     serialize_fn: Option<SerializeFn>,
@@ -75,6 +131,19 @@ pub(super) struct ComponentStorageEntry {
     /// Optional function pointer that returns the component type name.
     /// Only set for component types registered as serializable.
     type_name_fn: Option<TypeNameFn>,
+
+    /// Optional function pointers for bincode column encoding/decoding.
+    /// Only set for component types registered as serializable.
+    column_fns: Option<(EncodeColumnFn, DecodeColumnFn)>,
+
+    /// Optional function pointers for world snapshots.
+    /// Set together with `clone_to_fn`.
+    snapshot_fns: Option<(SaveColumnFn, RestoreColumnFn)>,
+
+    /// The snapshot column this storage was last saved to or restored from.
+    /// Dropped on every mutable access, so while it is set the storage still
+    /// equals it and the next snapshot shares it instead of copying.
+    shared_column: Option<SnapshotColumn>,
 }
 
 impl ComponentStorageEntry {
@@ -83,11 +152,17 @@ impl ComponentStorageEntry {
         Self {
             storage: Box::new(SparseSet::<T>::new()),
             remove_entity_fn: Self::remove_entity_impl::<T>,
+            len_fn: Self::len_impl::<T>,
+            clear_fn: Self::clear_impl::<T>,
             clone_to_fn: None,
+            clone_many_fn: None,
             serialize_fn: None,
             deserialize_fn: None,
             insert_any_fn: None,
             type_name_fn: None,
+            column_fns: None,
+            snapshot_fns: None,
+            shared_column: None,
         }
     }
 
@@ -107,14 +182,20 @@ impl ComponentStorageEntry {
 
     /// Attempts to downcast to a mutable `SparseSet<T>`.
     pub(super) fn downcast_mut<T: Component>(&mut self) -> Option<&mut SparseSet<T>> {
-        self.storage.downcast_mut::<SparseSet<T>>()
+        self.storage_mut().downcast_mut::<SparseSet<T>>()
+    }
+
+    /// Returns the storage for writing, forgetting the shared snapshot column.
+    fn storage_mut(&mut self) -> &mut dyn Any {
+        self.shared_column = None;
+        self.storage.as_mut()
     }
 
     /// Removes an entity from this storage using type-erased removal.
     ///
     /// Returns `true` if the entity had a component that was removed.
     pub(super) fn remove_entity(&mut self, entity: Entity) -> bool {
-        (self.remove_entity_fn)(self.storage.as_mut(), entity)
+        (self.remove_entity_fn)(self.storage_mut(), entity)
     }
 
     /// Registers a clone function for component type `T`.
@@ -123,6 +204,10 @@ impl ComponentStorageEntry {
     /// between entities without knowing the concrete type at the call site.
     pub(super) fn set_clone_fn<T: Component + Clone>(&mut self) {
         self.clone_to_fn = Some(Self::clone_to_impl::<T>);
+        self.clone_many_fn = Some(Self::clone_many_impl::<T>);
+        let save: SaveColumnFn = Self::save_column_impl::<T>;
+        let restore: RestoreColumnFn = Self::restore_column_impl::<T>;
+        self.snapshot_fns = Some((save, restore));
     }
 
     /// Type-erased implementation of component cloning for `SparseSet<T>`.
@@ -148,12 +233,53 @@ impl ComponentStorageEntry {
     /// - The source entity does not have this component
     pub(super) fn clone_to(&mut self, source: Entity, target: Entity) -> bool {
         if let Some(clone_fn) = self.clone_to_fn {
-            (clone_fn)(self.storage.as_mut(), source, target)
+            (clone_fn)(self.storage_mut(), source, target)
         } else {
             false
         }
     }
 
+    /// Type-erased implementation of one-to-many cloning for `SparseSet<T>`.
+    fn clone_many_impl<T: Component + Clone>(
+        storage: &mut dyn Any,
+        source: Entity,
+        targets: &[Entity],
+        change_tick: u32,
+    ) -> bool {
+        let Some(sparse_set) = storage.downcast_mut::<SparseSet<T>>() else {
+            return false;
+        };
+        let Some(component) = sparse_set.get(source).cloned() else {
+            return false;
+        };
+        sparse_set.reserve(targets.len());
+        for &target in targets {
+            sparse_set.insert_with_tick(target, component.clone(), change_tick);
+        }
+        true
+    }
+
+    /// Returns `true` if a clone function has been registered.
+    pub(super) fn is_cloneable(&self) -> bool {
+        self.clone_many_fn.is_some()
+    }
+
+    /// Clones the component of `source` to every entity in `targets`.
+    ///
+    /// Returns `false` if no clone function has been registered or the
+    /// source entity does not have this component.
+    pub(super) fn clone_to_many(
+        &mut self,
+        source: Entity,
+        targets: &[Entity],
+        change_tick: u32,
+    ) -> bool {
+        match self.clone_many_fn {
+            Some(clone_fn) => (clone_fn)(self.storage_mut(), source, targets, change_tick),
+            None => false,
+        }
+    }
+
     // =========================================================================
     // Serialization
     // =========================================================================
@@ -168,6 +294,9 @@ impl ComponentStorageEntry {
         self.deserialize_fn = Some(Self::deserialize_impl::<T>);
         self.insert_any_fn = Some(Self::insert_any_impl::<T>);
         self.type_name_fn = Some(Self::type_name_impl::<T>);
+        let encode: EncodeColumnFn = Self::encode_column_impl::<T>;
+        let decode: DecodeColumnFn = Self::decode_column_impl::<T>;
+        self.column_fns = Some((encode, decode));
     }
 
     /// Type-erased serialize implementation.
@@ -231,7 +360,7 @@ impl ComponentStorageEntry {
         component: Box<dyn Any + Send + Sync>,
     ) -> bool {
         if let Some(insert_fn) = self.insert_any_fn {
-            (insert_fn)(self.storage.as_mut(), entity, component)
+            (insert_fn)(self.storage_mut(), entity, component)
         } else {
             false
         }
@@ -241,6 +370,76 @@ impl ComponentStorageEntry {
     pub(super) fn type_name(&self) -> Option<&'static str> {
         self.type_name_fn.map(|f| (f)())
     }
+
+    /// Type-erased column encode implementation.
+    fn encode_column_impl<T: Component + serde::Serialize>(
+        storage: &dyn Any,
+        entities: &[Entity],
+        out: &mut Vec<u8>,
+    ) -> bool {
+        let Some(sparse_set) = storage.downcast_ref::<SparseSet<T>>() else {
+            return false;
+        };
+        entities.iter().all(|&entity| {
+            sparse_set
+                .get(entity)
+                .is_some_and(|component| bincode::serialize_into(&mut *out, component).is_ok())
+        })
+    }
+
+    /// Type-erased column decode implementation.
+    fn decode_column_impl<T: Component + for<'de> serde::Deserialize<'de>>(
+        storage: &mut dyn Any,
+        entities: &[Entity],
+        mut bytes: &[u8],
+        change_tick: u32,
+    ) -> bool {
+        let Some(sparse_set) = storage.downcast_mut::<SparseSet<T>>() else {
+            return false;
+        };
+        let mut values: Vec<T> = Vec::with_capacity(entities.len());
+        for _ in entities {
+            match bincode::deserialize_from(&mut bytes) {
+                Ok(value) => values.push(value),
+                Err(_) => return false,
+            }
+        }
+        if !bytes.is_empty() {
+            return false;
+        }
+        sparse_set.reserve(values.len());
+        for (&entity, value) in entities.iter().zip(values) {
+            sparse_set.insert_with_tick(entity, value, change_tick);
+        }
+        true
+    }
+
+    /// Appends the bincode encoding of each entity's component to `out`.
+    ///
+    /// Returns false if serialization is not registered, an entity lacks the
+    /// component, or encoding fails; `out` may then hold a partial column.
+    pub(super) fn encode_column(&self, entities: &[Entity], out: &mut Vec<u8>) -> bool {
+        match self.column_fns {
+            Some((encode, _)) => (encode)(self.storage.as_ref(), entities, out),
+            None => false,
+        }
+    }
+
+    /// Decodes a column of `entities.len()` components and inserts them.
+    ///
+    /// Returns false, inserting nothing, if serialization is not registered
+    /// or `bytes` is not exactly such a column.
+    pub(super) fn decode_column(
+        &mut self,
+        entities: &[Entity],
+        bytes: &[u8],
+        change_tick: u32,
+    ) -> bool {
+        match self.column_fns {
+            Some((_, decode)) => (decode)(self.storage_mut(), entities, bytes, change_tick),
+            None => false,
+        }
+    }
 }
 
 impl std::fmt::Debug for ComponentStorageEntry {
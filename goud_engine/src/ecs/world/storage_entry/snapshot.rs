@@ -0,0 +1,121 @@
+//! Whole-storage copies for [`WorldSnapshot`](super::super::WorldSnapshot).
+
+use std::any::Any;
+use std::sync::Arc;
+
+use super::super::super::sparse_set::SparseSet;
+use super::super::super::Component;
+use super::{ComponentStorageEntry, SnapshotColumn};
+
+impl ComponentStorageEntry {
+    /// Type-erased length implementation.
+    pub(super) fn len_impl<T: Component>(storage: &dyn Any) -> usize {
+        storage
+            .downcast_ref::<SparseSet<T>>()
+            .map_or(0, SparseSet::len)
+    }
+
+    /// Type-erased clear implementation.
+    pub(super) fn clear_impl<T: Component>(storage: &mut dyn Any) {
+        if let Some(sparse_set) = storage.downcast_mut::<SparseSet<T>>() {
+            sparse_set.clear();
+        }
+    }
+
+    /// Type-erased snapshot save implementation.
+    pub(super) fn save_column_impl<T: Component + Clone>(
+        storage: &dyn Any,
+        recycled: Option<SnapshotColumn>,
+    ) -> Option<SnapshotColumn> {
+        let source = storage.downcast_ref::<SparseSet<T>>()?;
+        if let Some(mut column) = recycled {
+            if let Some(target) =
+                Arc::get_mut(&mut column).and_then(|c| c.downcast_mut::<SparseSet<T>>())
+            {
+                target.clone_from(source);
+                return Some(column);
+            }
+        }
+        Some(Arc::new(source.clone()))
+    }
+
+    /// Type-erased snapshot restore implementation.
+    pub(super) fn restore_column_impl<T: Component + Clone>(
+        storage: &mut dyn Any,
+        column: &(dyn Any + Send + Sync),
+    ) -> bool {
+        match (
+            storage.downcast_mut::<SparseSet<T>>(),
+            column.downcast_ref::<SparseSet<T>>(),
+        ) {
+            (Some(target), Some(source)) => {
+                target.clone_from(source);
+                true
+            }
+            _ => false,
+        }
+    }
+
+    /// Returns `true` if a snapshot can capture this storage: its type was
+    /// registered as cloneable, or it holds no components.
+    pub(in crate::ecs::world) fn is_snapshottable(&self) -> bool {
+        self.snapshot_fns.is_some() || (self.len_fn)(self.storage.as_ref()) == 0
+    }
+
+    /// Returns the storage as a snapshot column, and whether that column is
+    /// shared with an earlier snapshot rather than freshly copied.
+    ///
+    /// `None` if the component type was not registered as cloneable.
+    pub(in crate::ecs::world) fn save_column(
+        &mut self,
+        recycled: Option<SnapshotColumn>,
+    ) -> Option<(SnapshotColumn, bool)> {
+        if let Some(shared) = &self.shared_column {
+            return Some((Arc::clone(shared), true));
+        }
+        let (save, _) = self.snapshot_fns?;
+        let column = (save)(self.storage.as_ref(), recycled)?;
+        self.shared_column = Some(Arc::clone(&column));
+        Some((column, false))
+    }
+
+    /// Returns `true` if [`restore_column`](Self::restore_column) would
+    /// accept `column`.
+    pub(in crate::ecs::world) fn can_restore_column(&self, column: &SnapshotColumn) -> bool {
+        self.snapshot_fns.is_some()
+            || self
+                .shared_column
+                .as_ref()
+                .is_some_and(|shared| Arc::ptr_eq(shared, column))
+    }
+
+    /// Overwrites the storage with `column`, or empties it for `None`.
+    ///
+    /// Nothing is copied if the storage has not changed since it was saved
+    /// to or restored from that same column. Returns false if the column
+    /// cannot be restored into this storage.
+    pub(in crate::ecs::world) fn restore_column(
+        &mut self,
+        column: Option<&SnapshotColumn>,
+    ) -> bool {
+        let Some(column) = column else {
+            (self.clear_fn)(self.storage_mut());
+            return true;
+        };
+        if self
+            .shared_column
+            .as_ref()
+            .is_some_and(|shared| Arc::ptr_eq(shared, column))
+        {
+            return true;
+        }
+        let Some((_, restore)) = self.snapshot_fns else {
+            return false;
+        };
+        let restored = (restore)(self.storage_mut(), column.as_ref());
+        if restored {
+            self.shared_column = Some(Arc::clone(column));
+        }
+        restored
+    }
+}
@@ -35,4 +35,5 @@ mod insert_batch_builder_tests;
 mod insert_tests;
 mod pool_ops_tests;
 mod remove_tests;
+mod snapshot_tests;
 mod spawn_tests;
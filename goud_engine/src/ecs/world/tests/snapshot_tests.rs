@@ -0,0 +1,114 @@
+use super::*;
+
+fn cloneable_world() -> World {
+    let mut world = World::new();
+    world.register_cloneable::<Position>();
+    world.register_cloneable::<Velocity>();
+    world
+}
+
+#[test]
+fn test_restore_undoes_spawns_despawns_and_writes() {
+    let mut world = cloneable_world();
+    let kept = world.spawn_empty();
+    world.insert(kept, Position { x: 1.0, y: 2.0 });
+    let doomed = world.spawn_empty();
+    world.insert(doomed, Velocity { x: 3.0, y: 0.0 });
+
+    let snapshot = world.save_snapshot().unwrap();
+    assert_eq!(snapshot.entity_count(), 2);
+
+    world.get_mut::<Position>(kept).unwrap().x = 50.0;
+    world.insert(kept, Velocity { x: 9.0, y: 9.0 });
+    assert!(world.despawn(doomed));
+    let spawned = world.spawn_empty();
+    world.insert(spawned, Position { x: 7.0, y: 7.0 });
+
+    assert!(world.restore_snapshot(&snapshot));
+    assert_eq!(world.entity_count(), 2);
+    assert_eq!(
+        world.get::<Position>(kept),
+        Some(&Position { x: 1.0, y: 2.0 })
+    );
+    assert!(!world.has::<Velocity>(kept));
+    assert!(world.is_alive(doomed));
+    assert_eq!(
+        world.get::<Velocity>(doomed),
+        Some(&Velocity { x: 3.0, y: 0.0 })
+    );
+    assert!(!world.is_alive(spawned));
+}
+
+#[test]
+fn test_snapshot_restores_many_times() {
+    let mut world = cloneable_world();
+    let entity = world.spawn_empty();
+    world.insert(entity, Position { x: 0.0, y: 0.0 });
+    let snapshot = world.save_snapshot().unwrap();
+
+    for step in 1..=8 {
+        world.get_mut::<Position>(entity).unwrap().x = step as f32;
+        assert!(world.restore_snapshot(&snapshot));
+        assert_eq!(world.get::<Position>(entity).unwrap().x, 0.0);
+    }
+}
+
+#[test]
+fn test_unchanged_columns_are_shared() {
+    let mut world = cloneable_world();
+    let entity = world.spawn_empty();
+    world.insert(entity, Position { x: 0.0, y: 0.0 });
+    world.insert(entity, Velocity { x: 1.0, y: 0.0 });
+
+    let first = world.save_snapshot().unwrap();
+    assert_eq!(first.column_count(), 2);
+    assert_eq!(first.shared_column_count(), 0);
+
+    world.get_mut::<Position>(entity).unwrap().x = 1.0;
+    let second = world.save_snapshot().unwrap();
+    assert_eq!(second.shared_column_count(), 1);
+
+    assert!(world.restore_snapshot(&first));
+    let third = world.save_snapshot().unwrap();
+    assert_eq!(third.shared_column_count(), 2);
+}
+
+#[test]
+fn test_save_into_reuses_snapshot() {
+    let mut world = cloneable_world();
+    let entity = world.spawn_empty();
+    world.insert(entity, Position { x: 0.0, y: 0.0 });
+    let mut snapshot = world.save_snapshot().unwrap();
+
+    world.get_mut::<Position>(entity).unwrap().x = 4.0;
+    assert!(world.save_snapshot_into(&mut snapshot));
+    world.get_mut::<Position>(entity).unwrap().x = 8.0;
+    assert!(world.restore_snapshot(&snapshot));
+    assert_eq!(world.get::<Position>(entity).unwrap().x, 4.0);
+}
+
+#[test]
+fn test_non_cloneable_components_block_saving() {
+    let mut world = cloneable_world();
+    let entity = world.spawn_empty();
+    world.insert(entity, Name("hero".to_string()));
+    assert!(world.save_snapshot().is_none());
+
+    world.remove::<Name>(entity);
+    let snapshot = world.save_snapshot().unwrap();
+    world.insert(entity, Name("ghost".to_string()));
+    assert!(world.restore_snapshot(&snapshot));
+    assert!(!world.has::<Name>(entity));
+}
+
+#[test]
+fn test_restore_after_clear_is_rejected() {
+    let mut world = cloneable_world();
+    let entity = world.spawn_empty();
+    world.insert(entity, Position { x: 0.0, y: 0.0 });
+    let snapshot = world.save_snapshot().unwrap();
+
+    world.clear();
+    assert!(!world.restore_snapshot(&snapshot));
+    assert_eq!(world.entity_count(), 0);
+}
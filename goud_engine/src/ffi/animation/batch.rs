@@ -0,0 +1,218 @@
+//! Batched sprite animation update.
+//!
+//! Crowd scenes tick thousands of animated entities.  Stepping each one with
+//! `goud_animation_controller_update` and reading its frame back costs
+//! several FFI calls and registry locks per entity.
+//! `goud_animation_update_batch` steps the controllers and sprite animators
+//! of a whole array of entities under one lock and writes each entity's
+//! current frame into the source rect of a caller `FfiSpriteCmd` array, ready
+//! for `goud_renderer_draw_sprite_batch`.  Large batches advance their
+//! animators on the engine's worker threads on native builds.
+
+use crate::core::error::{set_last_error, GoudError, ERR_INVALID_CONTEXT, ERR_INVALID_STATE};
+use crate::core::event::Events;
+use crate::core::math::Rect;
+use crate::ecs::components::animation_controller::AnimationController;
+use crate::ecs::components::sprite::Sprite;
+use crate::ecs::components::sprite_animator::events::AnimationEventFired;
+use crate::ecs::components::sprite_animator::SpriteAnimator;
+use crate::ecs::systems::animation::advance_animator;
+use crate::ecs::systems::animation_controller::update_animation_controller;
+use crate::ecs::{Entity, World};
+use crate::ffi::context::{get_context_registry, GoudContextId, GOUD_INVALID_CONTEXT_ID};
+use crate::ffi::renderer::FfiSpriteCmd;
+
+use super::controller::lock_error;
+
+/// Animators per worker task; smaller batches run on the calling thread.
+#[cfg_attr(not(feature = "native"), allow(dead_code))]
+const PARALLEL_CHUNK: usize = 256;
+
+/// Result of advancing one animator.
+struct Stepped {
+    /// Index into the caller's entity array.
+    slot: usize,
+    /// Current frame after the advance.
+    rect: Option<Rect>,
+    /// Whether the animator advanced (it was playing and had frames).
+    advanced: bool,
+    /// Events of the frames crossed.
+    events: Vec<AnimationEventFired>,
+}
+
+/// Advances the animation of `count` entities by `dt` seconds.
+///
+/// For each entity, in order, this runs the same steps as the animation
+/// controller system (when it has both an `AnimationController` and a
+/// `SpriteAnimator`), then the sprite animation system's advance of its
+/// `SpriteAnimator`.  Fired events go to the `Events<AnimationEventFired>`
+/// resource, and the `Sprite` source rect of an entity whose animation
+/// advanced is updated, exactly as the systems do.  `AnimationLayerStack`
+/// components are not advanced.
+///
+/// When `out_cmds` is non-null, `out_cmds[i].src_x/src_y/src_w/src_h`
+/// receive the current frame of `entity_ids[i]` (the crossfade rect while a
+/// controller transition blends).  Other fields, and the commands of
+/// entities without a `SpriteAnimator`, are left untouched.
+///
+/// # Safety
+///
+/// `entity_ids` must point to `count` readable `u64`s and `out_cmds`, when
+/// non-null, to `count` writable `FfiSpriteCmd`s.
+///
+/// # Returns
+///
+/// The number of entities with a `SpriteAnimator`, or a negative error
+/// code.  An array that names an entity twice is rejected before anything
+/// is advanced.
+#[no_mangle]
+pub unsafe extern "C" fn goud_animation_update_batch(
+    context_id: GoudContextId,
+    entity_ids: *const u64,
+    count: u32,
+    dt: f32,
+    out_cmds: *mut FfiSpriteCmd,
+) -> i32 {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return -ERR_INVALID_CONTEXT;
+    }
+    if count == 0 {
+        return 0;
+    }
+    if entity_ids.is_null() {
+        set_last_error(GoudError::InvalidState("entity_ids is null".to_string()));
+        return -ERR_INVALID_STATE;
+    }
+
+    // SAFETY: Caller guarantees `entity_ids` holds `count` values.
+    let ids = std::slice::from_raw_parts(entity_ids, count as usize);
+    let mut sorted = ids.to_vec();
+    sorted.sort_unstable();
+    if sorted.windows(2).any(|pair| pair[0] == pair[1]) {
+        set_last_error(GoudError::InvalidState(
+            "entity_ids names an entity twice".to_string(),
+        ));
+        return -ERR_INVALID_STATE;
+    }
+    let entities: Vec<Entity> = ids.iter().map(|&bits| Entity::from_bits(bits)).collect();
+
+    let mut registry = match get_context_registry().lock() {
+        Ok(r) => r,
+        Err(_) => return lock_error(),
+    };
+    let Some(context) = registry.get_mut(context_id) else {
+        set_last_error(GoudError::InvalidContext);
+        return -ERR_INVALID_CONTEXT;
+    };
+    let world = context.world_mut();
+
+    // Controllers switch clips through several components, so they run in
+    // order on this thread.
+    let mut blended: Vec<Option<Rect>> = vec![None; entities.len()];
+    for (slot, &entity) in entities.iter().enumerate() {
+        if world.has::<AnimationController>(entity) && world.has::<SpriteAnimator>(entity) {
+            blended[slot] = update_animation_controller(world, entity, dt);
+        }
+    }
+
+    let mut stepped = advance_animators(world, &entities, dt);
+    stepped.sort_unstable_by_key(|job| job.slot);
+
+    let tick = world.change_tick();
+    let mut fired = Vec::new();
+    let mut sprites = world.get_storage_option_mut::<Sprite>();
+    for job in &mut stepped {
+        fired.append(&mut job.events);
+        let entity = entities[job.slot];
+        if let (true, Some(rect), Some(sprites)) = (job.advanced, job.rect, sprites.as_deref_mut())
+        {
+            if let Some(sprite) = sprites.get_mut(entity) {
+                sprite.source_rect = Some(rect);
+                sprites.set_changed_tick(entity, tick);
+            }
+        }
+        let Some(rect) = blended[job.slot].or(job.rect) else {
+            continue;
+        };
+        if !out_cmds.is_null() {
+            // SAFETY: slot < count, and the caller guarantees `count` commands.
+            let cmd = &mut *out_cmds.add(job.slot);
+            cmd.src_x = rect.x;
+            cmd.src_y = rect.y;
+            cmd.src_w = rect.width;
+            cmd.src_h = rect.height;
+        }
+    }
+
+    if !fired.is_empty() {
+        if let Some(events) = world.get_resource_mut::<Events<AnimationEventFired>>() {
+            events.send_batch(fired);
+        }
+    }
+    stepped.len() as i32
+}
+
+/// Advances the `SpriteAnimator` of every live entity in `entities`.
+///
+/// `entities` must not repeat an entity.  Results are in storage order.
+fn advance_animators(world: &mut World, entities: &[Entity], dt: f32) -> Vec<Stepped> {
+    let alive: Vec<bool> = entities.iter().map(|&e| world.is_alive(e)).collect();
+    let tick = world.change_tick();
+    let Some(storage) = world.get_storage_option_mut::<SpriteAnimator>() else {
+        return Vec::new();
+    };
+
+    let mut targets: Vec<(usize, usize)> = Vec::with_capacity(entities.len());
+    for (slot, &entity) in entities.iter().enumerate() {
+        let Some(dense) = storage.dense_index(entity) else {
+            continue;
+        };
+        if alive[slot] && storage.dense()[dense] == entity {
+            storage.set_changed_tick(entity, tick);
+            targets.push((dense, slot));
+        }
+    }
+    targets.sort_unstable();
+
+    // Split the packed values into one exclusive reference per target; the
+    // entities are distinct, so their dense indices are too.
+    let mut jobs: Vec<(usize, &mut SpriteAnimator)> = Vec::with_capacity(targets.len());
+    let mut rest = storage.dense_values_mut();
+    let mut offset = 0;
+    for &(dense, slot) in &targets {
+        let (_, tail) = std::mem::take(&mut rest).split_at_mut(dense - offset);
+        let Some((animator, tail)) = tail.split_first_mut() else {
+            break;
+        };
+        rest = tail;
+        offset = dense + 1;
+        jobs.push((slot, animator));
+    }
+
+    let step = |(slot, animator): &mut (usize, &mut SpriteAnimator)| -> Stepped {
+        let mut events = Vec::new();
+        let advanced = advance_animator(entities[*slot], animator, dt, &mut events);
+        Stepped {
+            slot: *slot,
+            rect: animator.current_rect(),
+            advanced,
+            events,
+        }
+    };
+
+    #[cfg(feature = "native")]
+    if jobs.len() > PARALLEL_CHUNK {
+        use rayon::prelude::*;
+        return jobs
+            .par_iter_mut()
+            .with_min_len(PARALLEL_CHUNK)
+            .map(step)
+            .collect();
+    }
+    jobs.iter_mut().map(step).collect()
+}
+
+#[cfg(test)]
+#[path = "batch_tests.rs"]
+mod tests;
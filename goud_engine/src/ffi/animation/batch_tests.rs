@@ -0,0 +1,178 @@
+use super::*;
+use crate::assets::AssetHandle;
+use crate::ecs::components::animation_controller::TransitionCondition;
+use crate::ecs::components::sprite_animator::events::EventPayload;
+use crate::ecs::components::sprite_animator::AnimationClip;
+use crate::ecs::systems::update_sprite_animations;
+use crate::ffi::context::{goud_context_create, goud_context_destroy};
+
+fn strip(frames: usize) -> AnimationClip {
+    let frames = (0..frames)
+        .map(|i| Rect::new(i as f32 * 16.0, 0.0, 16.0, 16.0))
+        .collect();
+    AnimationClip::new(frames, 0.1)
+}
+
+fn blank_cmd() -> FfiSpriteCmd {
+    FfiSpriteCmd {
+        texture: 0,
+        x: 0.0,
+        y: 0.0,
+        width: 16.0,
+        height: 16.0,
+        rotation: 0.0,
+        src_x: 0.0,
+        src_y: 0.0,
+        src_w: 0.0,
+        src_h: 0.0,
+        r: 1.0,
+        g: 1.0,
+        b: 1.0,
+        a: 1.0,
+        z_layer: 0,
+        _padding: 0,
+    }
+}
+
+fn with_world<R>(ctx: GoudContextId, f: impl FnOnce(&mut World) -> R) -> R {
+    let mut registry = get_context_registry().lock().unwrap();
+    f(registry.get_mut(ctx).unwrap().world_mut())
+}
+
+fn update(ctx: GoudContextId, ids: &[u64], dt: f32, cmds: &mut [FfiSpriteCmd]) -> i32 {
+    let out = if cmds.is_empty() {
+        std::ptr::null_mut()
+    } else {
+        cmds.as_mut_ptr()
+    };
+    // SAFETY: `ids` and `cmds` (when non-empty) hold `ids.len()` elements.
+    unsafe { goud_animation_update_batch(ctx, ids.as_ptr(), ids.len() as u32, dt, out) }
+}
+
+#[test]
+fn test_update_batch_matches_the_animation_system() {
+    let ctx = goud_context_create();
+    let count = 600;
+    let mut reference = World::new();
+    let mut mirrors = Vec::with_capacity(count);
+    let ids: Vec<u64> = with_world(ctx, |world| {
+        (0..count)
+            .map(|i| {
+                let entity = world.spawn_empty();
+                let mut animator = SpriteAnimator::new(strip(4 + i % 3));
+                animator.elapsed = (i % 7) as f32 * 0.01;
+                let mirror = reference.spawn_empty();
+                reference.insert(mirror, animator.clone());
+                mirrors.push(mirror);
+                world.insert(entity, animator);
+                entity.to_bits()
+            })
+            .collect()
+    });
+
+    let mut cmds = vec![blank_cmd(); count];
+    for _ in 0..5 {
+        assert_eq!(update(ctx, &ids, 0.07, &mut cmds), count as i32);
+        update_sprite_animations(&mut reference, 0.07);
+    }
+
+    with_world(ctx, |world| {
+        for (i, &bits) in ids.iter().enumerate() {
+            let animator = world
+                .get::<SpriteAnimator>(Entity::from_bits(bits))
+                .unwrap();
+            let expected = reference.get::<SpriteAnimator>(mirrors[i]).unwrap();
+            assert_eq!(animator.current_frame, expected.current_frame, "entity {i}");
+            assert_eq!(animator.elapsed, expected.elapsed, "entity {i}");
+            let rect = animator.current_rect().unwrap();
+            assert_eq!((cmds[i].src_x, cmds[i].src_w), (rect.x, rect.width));
+        }
+    });
+    assert!(goud_context_destroy(ctx));
+}
+
+#[test]
+fn test_update_batch_runs_controllers_and_updates_sprites() {
+    let ctx = goud_context_create();
+    let (walker, idle, bare) = with_world(ctx, |world| {
+        world.insert_resource(Events::<AnimationEventFired>::new());
+        let mut controller = AnimationController::new("idle")
+            .with_state("idle", strip(1))
+            .with_state("walk", strip(4).with_event(1, "step", EventPayload::None))
+            .with_transition(
+                "idle",
+                "walk",
+                0.0,
+                vec![TransitionCondition::BoolEquals {
+                    param: "moving".to_string(),
+                    value: true,
+                }],
+            );
+        controller.set_bool("moving", true);
+        let walker = world.spawn_empty();
+        world.insert(walker, controller);
+        world.insert(walker, SpriteAnimator::new(strip(1)));
+        world.insert(walker, Sprite::new(AssetHandle::new(1, 1)));
+
+        let idle = world.spawn_empty();
+        let mut paused = SpriteAnimator::new(strip(3));
+        paused.current_frame = 2;
+        paused.pause();
+        world.insert(idle, paused);
+
+        let bare = world.spawn_empty();
+        (walker.to_bits(), idle.to_bits(), bare.to_bits())
+    });
+
+    let mut cmds = vec![blank_cmd(); 3];
+    cmds[2].src_x = -1.0;
+    assert_eq!(update(ctx, &[walker, idle, bare], 0.15, &mut cmds), 2);
+    // The controller switched the walker to the 4-frame clip, which then
+    // advanced one frame and fired its event.
+    assert_eq!((cmds[0].src_x, cmds[0].src_w), (16.0, 16.0));
+    assert_eq!(
+        cmds[1].src_x, 32.0,
+        "paused animators still report their frame"
+    );
+    assert_eq!(
+        cmds[2].src_x, -1.0,
+        "entities without an animator are untouched"
+    );
+
+    with_world(ctx, |world| {
+        let entity = Entity::from_bits(walker);
+        let sprite = world.get::<Sprite>(entity).unwrap();
+        assert_eq!(sprite.source_rect, Some(Rect::new(16.0, 0.0, 16.0, 16.0)));
+        let events = world
+            .get_resource_mut::<Events<AnimationEventFired>>()
+            .unwrap();
+        events.update();
+        assert_eq!(events.read_len(), 1);
+        assert_eq!(events.read_buffer()[0].event_name, "step");
+    });
+
+    assert_eq!(update(ctx, &[walker], 0.1, &mut []), 1);
+    assert!(goud_context_destroy(ctx));
+}
+
+#[test]
+fn test_update_batch_rejects_bad_arguments() {
+    let ctx = goud_context_create();
+    let bits = with_world(ctx, |world| world.spawn_empty().to_bits());
+
+    assert_eq!(
+        update(GOUD_INVALID_CONTEXT_ID, &[bits], 0.1, &mut []),
+        -ERR_INVALID_CONTEXT
+    );
+    assert_eq!(update(ctx, &[], 0.1, &mut []), 0);
+    assert_eq!(update(ctx, &[bits, bits], 0.1, &mut []), -ERR_INVALID_STATE);
+    // SAFETY: A null id array is the error path under test.
+    unsafe {
+        assert_eq!(
+            goud_animation_update_batch(ctx, std::ptr::null(), 1, 0.1, std::ptr::null_mut()),
+            -ERR_INVALID_STATE
+        );
+    }
+    assert_eq!(update(ctx, &[bits, u64::MAX], 0.1, &mut []), 0);
+    assert!(goud_context_destroy(ctx));
+}
@@ -15,7 +15,7 @@ use crate::ffi::context::{get_context_registry, GoudContextId, GOUD_INVALID_CONT
 use super::str_from_raw;
 
 /// Sets a lock-failure error and returns the internal error code.
-fn lock_error() -> i32 {
+pub(super) fn lock_error() -> i32 {
     set_last_error(GoudError::InternalError(
         "Failed to lock context registry".to_string(),
     ));
@@ -0,0 +1,241 @@
+//! Bulk animation event transfer.
+//!
+//! `goud_animation_events_read` costs one FFI call and one registry lock per
+//! fired event.  `goud_animation_events_copy` writes the whole read buffer of
+//! `Events<AnimationEventFired>` into a caller array in one call.
+
+use crate::core::error::{set_last_error, GoudError};
+use crate::core::event::Events;
+use crate::ecs::components::sprite_animator::events::{AnimationEventFired, EventPayload};
+use crate::ffi::context::{get_context_registry, GoudContextId, GOUD_INVALID_CONTEXT_ID};
+
+use super::events::{PAYLOAD_FLOAT, PAYLOAD_INT, PAYLOAD_NONE, PAYLOAD_STRING};
+
+/// FFI-safe fired animation event.
+///
+/// The string pointers borrow from the event buffer and are only valid until
+/// `Events<AnimationEventFired>::update()` is called; they are not
+/// null-terminated.
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct FfiAnimationEvent {
+    /// Entity whose animation fired the event.
+    pub entity: u64,
+    /// Event name (UTF-8).
+    pub name_ptr: *const u8,
+    /// String payload (UTF-8) when `payload_type == 3`, otherwise null.
+    pub payload_str_ptr: *const u8,
+    /// Byte length of the event name.
+    pub name_len: u32,
+    /// Frame index that triggered the event.
+    pub frame: u32,
+    /// `0` = None, `1` = Int, `2` = Float, `3` = String.
+    pub payload_type: u32,
+    /// Integer payload (valid when `payload_type == 1`).
+    pub payload_int: i32,
+    /// Float payload (valid when `payload_type == 2`).
+    pub payload_float: f32,
+    /// Byte length of the string payload.
+    pub payload_str_len: u32,
+}
+
+impl Default for FfiAnimationEvent {
+    fn default() -> Self {
+        Self {
+            entity: 0,
+            name_ptr: std::ptr::null(),
+            payload_str_ptr: std::ptr::null(),
+            name_len: 0,
+            frame: 0,
+            payload_type: PAYLOAD_NONE,
+            payload_int: 0,
+            payload_float: 0.0,
+            payload_str_len: 0,
+        }
+    }
+}
+
+impl FfiAnimationEvent {
+    fn from_event(event: &AnimationEventFired) -> Self {
+        let mut out = Self {
+            entity: event.entity.to_bits(),
+            name_ptr: event.event_name.as_ptr(),
+            name_len: event.event_name.len() as u32,
+            frame: event.frame_index as u32,
+            ..Self::default()
+        };
+        match &event.payload {
+            EventPayload::None => {}
+            EventPayload::Int(v) => {
+                out.payload_type = PAYLOAD_INT;
+                out.payload_int = *v;
+            }
+            EventPayload::Float(v) => {
+                out.payload_type = PAYLOAD_FLOAT;
+                out.payload_float = *v;
+            }
+            EventPayload::String(s) => {
+                out.payload_type = PAYLOAD_STRING;
+                out.payload_str_ptr = s.as_ptr();
+                out.payload_str_len = s.len() as u32;
+            }
+        }
+        out
+    }
+}
+
+/// Copies the fired animation events in the read buffer into `out_events`.
+///
+/// At most `capacity` events are written, in firing order; a buffer sized by
+/// `goud_animation_events_count` always holds every event.  The buffered
+/// events are not consumed.
+///
+/// # Safety
+///
+/// `out_events` must point to `capacity` writable `FfiAnimationEvent`s.  The
+/// string pointers written borrow from the event buffer and are only valid
+/// until `Events<AnimationEventFired>::update()` is called.
+///
+/// # Returns
+///
+/// The number of events written; 0 on error.
+#[no_mangle]
+pub unsafe extern "C" fn goud_animation_events_copy(
+    context_id: GoudContextId,
+    out_events: *mut FfiAnimationEvent,
+    capacity: u32,
+) -> u32 {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return 0;
+    }
+    if capacity == 0 {
+        return 0;
+    }
+    if out_events.is_null() {
+        set_last_error(GoudError::InvalidState("out_events is null".to_string()));
+        return 0;
+    }
+
+    let registry = match get_context_registry().lock() {
+        Ok(r) => r,
+        Err(_) => {
+            set_last_error(GoudError::InternalError(
+                "context registry lock poisoned".to_string(),
+            ));
+            return 0;
+        }
+    };
+    let Some(context) = registry.get(context_id) else {
+        set_last_error(GoudError::InvalidContext);
+        return 0;
+    };
+    let Some(events) = context
+        .world()
+        .get_resource::<Events<AnimationEventFired>>()
+    else {
+        return 0;
+    };
+
+    let mut written = 0u32;
+    for event in events.read_buffer().iter().take(capacity as usize) {
+        // SAFETY: written < capacity, and the caller guarantees capacity slots.
+        *out_events.add(written as usize) = FfiAnimationEvent::from_event(event);
+        written += 1;
+    }
+    written
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::ecs::Entity;
+    use crate::ffi::animation::events::goud_animation_events_count;
+    use crate::ffi::context::{goud_context_create, goud_context_destroy};
+
+    fn fire(ctx: GoudContextId, fired: Vec<AnimationEventFired>) {
+        let mut registry = get_context_registry().lock().unwrap();
+        let world = registry.get_mut(ctx).unwrap().world_mut();
+        let mut events = Events::<AnimationEventFired>::new();
+        events.send_batch(fired);
+        events.update();
+        world.insert_resource(events);
+    }
+
+    fn copy(ctx: GoudContextId, capacity: usize) -> Vec<FfiAnimationEvent> {
+        let mut out = vec![FfiAnimationEvent::default(); capacity];
+        // SAFETY: out holds capacity elements.
+        let written = unsafe { goud_animation_events_copy(ctx, out.as_mut_ptr(), capacity as u32) };
+        out.truncate(written as usize);
+        out
+    }
+
+    /// # Safety
+    ///
+    /// `ptr` must be valid for `len` bytes of UTF-8.
+    unsafe fn text<'a>(ptr: *const u8, len: u32) -> &'a str {
+        std::str::from_utf8_unchecked(std::slice::from_raw_parts(ptr, len as usize))
+    }
+
+    #[test]
+    fn test_animation_events_copy_writes_read_buffer_in_order() {
+        let ctx = goud_context_create();
+        assert!(copy(ctx, 4).is_empty(), "no events resource yet");
+
+        let entity = Entity::new(7, 1);
+        fire(
+            ctx,
+            vec![
+                AnimationEventFired::new(entity, "step".into(), EventPayload::None, 2),
+                AnimationEventFired::new(entity, "hit".into(), EventPayload::Int(12), 4),
+                AnimationEventFired::new(entity, "fx".into(), EventPayload::Float(0.5), 5),
+                AnimationEventFired::new(
+                    entity,
+                    "sfx".into(),
+                    EventPayload::String("swing.wav".into()),
+                    6,
+                ),
+            ],
+        );
+        assert_eq!(goud_animation_events_count(ctx), 4);
+
+        let all = copy(ctx, 8);
+        assert_eq!(all.len(), 4);
+        assert_eq!(
+            all.iter().map(|e| e.payload_type).collect::<Vec<_>>(),
+            vec![PAYLOAD_NONE, PAYLOAD_INT, PAYLOAD_FLOAT, PAYLOAD_STRING]
+        );
+        assert!(all.iter().all(|e| e.entity == entity.to_bits()));
+        assert_eq!((all[1].frame, all[1].payload_int), (4, 12));
+        assert_eq!(all[2].payload_float, 0.5);
+        assert!(all[0].payload_str_ptr.is_null());
+        // SAFETY: The event buffer is not updated while the pointers are read.
+        unsafe {
+            assert_eq!(text(all[1].name_ptr, all[1].name_len), "hit");
+            assert_eq!(
+                text(all[3].payload_str_ptr, all[3].payload_str_len),
+                "swing.wav"
+            );
+        }
+
+        assert_eq!(copy(ctx, 2).len(), 2);
+        assert_eq!(copy(ctx, 8).len(), 4, "copy must not consume");
+        assert!(goud_context_destroy(ctx));
+    }
+
+    #[test]
+    fn test_animation_events_copy_rejects_bad_arguments() {
+        // SAFETY: Null and invalid arguments are the error paths under test.
+        unsafe {
+            let mut out = [FfiAnimationEvent::default(); 1];
+            assert_eq!(
+                goud_animation_events_copy(GOUD_INVALID_CONTEXT_ID, out.as_mut_ptr(), 1),
+                0
+            );
+            let ctx = goud_context_create();
+            assert_eq!(goud_animation_events_copy(ctx, std::ptr::null_mut(), 1), 0);
+            assert_eq!(goud_animation_events_copy(ctx, std::ptr::null_mut(), 0), 0);
+            assert!(goud_context_destroy(ctx));
+        }
+    }
+}
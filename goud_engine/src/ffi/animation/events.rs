@@ -18,13 +18,13 @@ use crate::ffi::context::{get_context_registry, GoudContextId, GOUD_INVALID_CONT
 use super::str_from_raw;
 
 /// Payload type discriminant: no payload.
-const PAYLOAD_NONE: u32 = 0;
+pub(super) const PAYLOAD_NONE: u32 = 0;
 /// Payload type discriminant: integer payload.
-const PAYLOAD_INT: u32 = 1;
+pub(super) const PAYLOAD_INT: u32 = 1;
 /// Payload type discriminant: float payload.
-const PAYLOAD_FLOAT: u32 = 2;
+pub(super) const PAYLOAD_FLOAT: u32 = 2;
 /// Payload type discriminant: string payload.
-const PAYLOAD_STRING: u32 = 3;
+pub(super) const PAYLOAD_STRING: u32 = 3;
 
 /// Adds an animation event to the clip of an entity's `SpriteAnimator`.
 ///
@@ -17,9 +17,9 @@ use crate::ffi::context::{get_context_registry, GoudContextId, GOUD_INVALID_CONT
 use super::str_from_raw;
 
 /// BlendMode discriminant: Override (replace previous).
-const BLEND_MODE_OVERRIDE: u32 = 0;
+pub(super) const BLEND_MODE_OVERRIDE: u32 = 0;
 /// BlendMode discriminant: Additive (add on top).
-const BLEND_MODE_ADDITIVE: u32 = 1;
+pub(super) const BLEND_MODE_ADDITIVE: u32 = 1;
 /// PlaybackMode discriminant: Loop.
 const PLAYBACK_MODE_LOOP: u32 = 0;
 /// PlaybackMode discriminant: OneShot.
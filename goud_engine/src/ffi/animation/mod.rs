@@ -9,19 +9,27 @@
 //!
 //! ## Module Layout
 //!
+//! - `batch` -- Batched controller/animator update into sprite commands
 //! - `controller` -- AnimationController component operations
 //! - `control` -- High-level animation playback/state/parameter controls
 //! - `tween` -- Standalone tween interpolation with easing
+//! - `tween_batch` -- Bulk stepping of structure-of-arrays tweens
 //! - `skeletal` -- Skeleton2D and SkeletalAnimator operations
+//! - `skeletal_batch` -- Skeletal keyframes, blend layers and batched bone palettes
 //! - `events` -- Animation event add/read operations
+//! - `event_buffer` -- Bulk copy of fired animation events
 //! - `layer` -- AnimationLayerStack component operations
 
+pub mod batch;
 pub mod control;
 pub mod controller;
+pub mod event_buffer;
 pub mod events;
 pub mod layer;
 pub mod skeletal;
+pub mod skeletal_batch;
 pub mod tween;
+pub mod tween_batch;
 
 use crate::core::error::{set_last_error, GoudError, ERR_INVALID_STATE};
 
@@ -48,6 +56,7 @@ pub(super) unsafe fn str_from_raw<'a>(ptr: *const u8, len: i32) -> Result<&'a st
 }
 
 // Re-export all FFI functions for flat namespace access.
+pub use batch::goud_animation_update_batch;
 pub use control::{
     goud_animation_play, goud_animation_set_parameter_bool, goud_animation_set_parameter_float,
     goud_animation_set_state, goud_animation_stop,
@@ -57,6 +66,7 @@ pub use controller::{
     goud_animation_controller_create, goud_animation_controller_get_state,
     goud_animation_controller_set_state, goud_animation_controller_update,
 };
+pub use event_buffer::goud_animation_events_copy;
 pub use events::{
     goud_animation_clip_add_event, goud_animation_events_count, goud_animation_events_read,
 };
@@ -69,7 +79,12 @@ pub use skeletal::{
     goud_skeleton_add_bone, goud_skeleton_create, goud_skeleton_play_clip,
     goud_skeleton_set_bone_transform,
 };
+pub use skeletal_batch::{
+    goud_skeleton_add_keyframe, goud_skeleton_layer_add, goud_skeleton_layer_set_weight,
+    goud_skeleton_update_batch, GOUD_BONE_PALETTE_FLOATS,
+};
 pub use tween::{
     goud_tween_create, goud_tween_destroy, goud_tween_is_complete, goud_tween_reset,
     goud_tween_update, goud_tween_value,
 };
+pub use tween_batch::goud_tween_step_batch;
@@ -208,7 +208,7 @@ pub extern "C" fn goud_skeleton_set_bone_transform(
 
 /// Plays a skeletal animation clip by name on the entity. Always creates a
 /// new `SkeletalAnimator`, replacing any existing one. Previous animator
-/// state (loaded clips, playback position) is discarded.
+/// state (loaded clips, blend layers, playback position) is discarded.
 /// The `looping` flag controls whether the clip loops.
 ///
 /// # Safety
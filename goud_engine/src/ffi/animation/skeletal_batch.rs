@@ -0,0 +1,413 @@
+//! Skeletal clip authoring, blend layers and batched bone palettes.
+//!
+//! Crowds of skinned characters would otherwise cost one FFI call and
+//! registry lock per bone per frame.  `goud_skeleton_update_batch` advances
+//! the animators of a whole array of skeletons under one lock, blends their
+//! layers, and writes every skeleton's skinning matrices into one caller
+//! bone-palette buffer, ready for a single GPU upload.  Large batches
+//! evaluate their poses on the engine's worker threads on native builds.
+//!
+//! Layer `0` of an animator is the base clip started by
+//! `goud_skeleton_play_clip`; `goud_skeleton_layer_add` appends layers
+//! numbered from `1`.  A skeletal layer whose name matches a layer of the
+//! entity's `AnimationLayerStack` takes its weight and blend mode from it,
+//! so `goud_animation_layer_set_weight` drives both.
+
+use crate::core::error::{
+    set_last_error, GoudError, ERR_COMPONENT_NOT_FOUND, ERR_INVALID_CONTEXT, ERR_INVALID_STATE,
+};
+use crate::core::math::Vec2;
+use crate::ecs::components::skeleton2d::{
+    BoneKeyframe, BoneTrack, BoneTransform, SkeletalAnimation, SkeletalAnimator, SkeletalLayer,
+    Skeleton2D,
+};
+use crate::ecs::components::AnimationLayerStack;
+use crate::ecs::systems::animation::BlendMode;
+use crate::ecs::systems::skeletal_animation::{
+    evaluate_pose, write_bone_palette, PoseScratch, BONE_PALETTE_FLOATS,
+};
+use crate::ecs::{Entity, World};
+use crate::ffi::context::{get_context_registry, GoudContextId, GOUD_INVALID_CONTEXT_ID};
+
+use super::controller::lock_error;
+use super::layer::{BLEND_MODE_ADDITIVE, BLEND_MODE_OVERRIDE};
+use super::str_from_raw;
+
+/// Floats per bone in the palette written by `goud_skeleton_update_batch`.
+pub const GOUD_BONE_PALETTE_FLOATS: u32 = BONE_PALETTE_FLOATS as u32;
+
+/// Skeletons per worker task; smaller batches run on the calling thread.
+#[cfg_attr(not(feature = "native"), allow(dead_code))]
+const PARALLEL_CHUNK: usize = 32;
+
+/// Runs `f` on the `SkeletalAnimator` of `entity_id`.
+fn with_animator(
+    context_id: GoudContextId,
+    entity_id: u64,
+    f: impl FnOnce(&mut SkeletalAnimator) -> i32,
+) -> i32 {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return -ERR_INVALID_CONTEXT;
+    }
+    let mut registry = match get_context_registry().lock() {
+        Ok(r) => r,
+        Err(_) => return lock_error(),
+    };
+    let Some(context) = registry.get_mut(context_id) else {
+        set_last_error(GoudError::InvalidContext);
+        return -ERR_INVALID_CONTEXT;
+    };
+    match context
+        .world_mut()
+        .get_mut::<SkeletalAnimator>(Entity::from_bits(entity_id))
+    {
+        Some(animator) => f(animator),
+        None => {
+            set_last_error(GoudError::ComponentNotFound);
+            -ERR_COMPONENT_NOT_FOUND
+        }
+    }
+}
+
+fn invalid_state(message: String) -> i32 {
+    set_last_error(GoudError::InvalidState(message));
+    -ERR_INVALID_STATE
+}
+
+/// Adds a keyframe to a clip of the entity's `SkeletalAnimator`.
+///
+/// `layer` 0 is the base clip; higher values name layers added with
+/// `goud_skeleton_layer_add`.  A keyframe at the same time as an existing
+/// one on that bone replaces it, and a keyframe past the clip's duration
+/// extends it (`goud_skeleton_play_clip` starts clips at one second).
+/// Tracks for bones the skeleton does not have are ignored when sampling.
+#[no_mangle]
+pub extern "C" fn goud_skeleton_add_keyframe(
+    context_id: GoudContextId,
+    entity_id: u64,
+    layer: i32,
+    bone_index: i32,
+    time: f32,
+    x: f32,
+    y: f32,
+    rotation: f32,
+    scale_x: f32,
+    scale_y: f32,
+) -> i32 {
+    if bone_index < 0 {
+        return invalid_state(format!("bone index {} out of range", bone_index));
+    }
+    if !time.is_finite() || time < 0.0 {
+        return invalid_state(format!("invalid keyframe time {}", time));
+    }
+    with_animator(context_id, entity_id, |animator| {
+        let clip = match layer {
+            0 => &mut animator.animation,
+            k if k > 0 && (k as usize) <= animator.layers.len() => {
+                &mut animator.layers[k as usize - 1].animation
+            }
+            _ => return invalid_state(format!("layer {} out of range", layer)),
+        };
+        let keyframe = BoneKeyframe {
+            time,
+            transform: BoneTransform {
+                position: Vec2::new(x, y),
+                rotation,
+                scale: Vec2::new(scale_x, scale_y),
+            },
+        };
+        add_keyframe(clip, bone_index as usize, keyframe);
+        0
+    })
+}
+
+/// Inserts `keyframe` into `clip`'s track for `bone_id`, keeping it sorted.
+fn add_keyframe(clip: &mut SkeletalAnimation, bone_id: usize, keyframe: BoneKeyframe) {
+    let track = match clip.tracks.iter().position(|t| t.bone_id == bone_id) {
+        Some(i) => &mut clip.tracks[i],
+        None => {
+            clip.tracks.push(BoneTrack {
+                bone_id,
+                keyframes: Vec::new(),
+            });
+            clip.tracks.last_mut().expect("track was just pushed")
+        }
+    };
+    let time = keyframe.time;
+    match track
+        .keyframes
+        .binary_search_by(|k| k.time.total_cmp(&time))
+    {
+        Ok(i) => track.keyframes[i] = keyframe,
+        Err(i) => track.keyframes.insert(i, keyframe),
+    }
+    clip.duration = clip.duration.max(time);
+}
+
+/// Adds a blend layer with an empty one-second clip to the entity's
+/// `SkeletalAnimator`. Returns the layer index (>= 1) on success, or a
+/// negative error code.
+///
+/// `blend_mode` is 0 (override) or 1 (additive), as for
+/// `goud_animation_layer_add`.  The layer starts at full weight.
+///
+/// # Safety
+///
+/// `name_ptr` must point to valid UTF-8 of `name_len` bytes.
+#[no_mangle]
+pub unsafe extern "C" fn goud_skeleton_layer_add(
+    context_id: GoudContextId,
+    entity_id: u64,
+    name_ptr: *const u8,
+    name_len: i32,
+    blend_mode: u32,
+    looping: bool,
+) -> i32 {
+    let name = match str_from_raw(name_ptr, name_len) {
+        Ok(s) => s,
+        Err(code) => return code,
+    };
+    let mode = match blend_mode {
+        BLEND_MODE_OVERRIDE => BlendMode::Override,
+        BLEND_MODE_ADDITIVE => BlendMode::Additive,
+        _ => return invalid_state("invalid blend_mode (expected 0 or 1)".into()),
+    };
+    with_animator(context_id, entity_id, |animator| {
+        let clip = SkeletalAnimation {
+            name: name.to_string(),
+            duration: 1.0,
+            tracks: Vec::new(),
+            looping,
+        };
+        animator.layers.push(SkeletalLayer::new(name, clip, mode));
+        animator.layers.len() as i32
+    })
+}
+
+/// Sets the blend weight of a skeletal layer, clamped to `0.0..=1.0`.
+///
+/// Ignored while the entity's `AnimationLayerStack` has a layer of the
+/// same name; set that layer's weight instead.
+#[no_mangle]
+pub extern "C" fn goud_skeleton_layer_set_weight(
+    context_id: GoudContextId,
+    entity_id: u64,
+    layer: i32,
+    weight: f32,
+) -> i32 {
+    with_animator(context_id, entity_id, |animator| {
+        match usize::try_from(layer)
+            .ok()
+            .and_then(|l| l.checked_sub(1))
+            .and_then(|i| animator.layers.get_mut(i))
+        {
+            Some(l) => {
+                l.weight = weight.clamp(0.0, 1.0);
+                0
+            }
+            None => invalid_state(format!("layer {} out of range", layer)),
+        }
+    })
+}
+
+/// Advances `count` skeletons by `dt` seconds and writes their bone palette.
+///
+/// Each entity's `SkeletalAnimator`, when it has one, advances like the
+/// skeletal animation system's, then its pose is evaluated with layers
+/// blended and its `Skeleton2D` world transforms are updated.  Skeletons
+/// without an animator are posed from their bones' local transforms.
+///
+/// `out_palette` receives `GOUD_BONE_PALETTE_FLOATS` floats per bone: the
+/// first two rows of each bone's skinning matrix (world transform times
+/// bind-pose inverse), each padded to four floats, skeletons back to back
+/// in array order.  When `out_offsets` is non-null, `out_offsets[i]` and
+/// `out_offsets[i + 1]` receive the first and one-past-last bone of
+/// `entity_ids[i]` (`count + 1` values); entities without a `Skeleton2D`
+/// span no bones.
+///
+/// A null `out_palette` only reports the sizes: offsets are written and
+/// nothing is advanced.
+///
+/// # Safety
+///
+/// `entity_ids` must point to `count` readable `u64`s, `out_palette`, when
+/// non-null, to `palette_len` writable `f32`s, and `out_offsets`, when
+/// non-null, to `count + 1` writable `u32`s.
+///
+/// # Returns
+///
+/// The total number of bones, or a negative error code.  An array that
+/// names an entity twice, or a palette shorter than the bones need, is
+/// rejected before anything is advanced.
+#[no_mangle]
+pub unsafe extern "C" fn goud_skeleton_update_batch(
+    context_id: GoudContextId,
+    entity_ids: *const u64,
+    count: u32,
+    dt: f32,
+    out_palette: *mut f32,
+    palette_len: u32,
+    out_offsets: *mut u32,
+) -> i32 {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return -ERR_INVALID_CONTEXT;
+    }
+    if count > 0 && entity_ids.is_null() {
+        return invalid_state("entity_ids is null".to_string());
+    }
+    let ids: &[u64] = if count == 0 {
+        &[]
+    } else {
+        // SAFETY: Caller guarantees `entity_ids` holds `count` values.
+        std::slice::from_raw_parts(entity_ids, count as usize)
+    };
+    let mut sorted = ids.to_vec();
+    sorted.sort_unstable();
+    if sorted.windows(2).any(|pair| pair[0] == pair[1]) {
+        return invalid_state("entity_ids names an entity twice".to_string());
+    }
+    let entities: Vec<Entity> = ids.iter().map(|&bits| Entity::from_bits(bits)).collect();
+
+    let mut registry = match get_context_registry().lock() {
+        Ok(r) => r,
+        Err(_) => return lock_error(),
+    };
+    let Some(context) = registry.get_mut(context_id) else {
+        set_last_error(GoudError::InvalidContext);
+        return -ERR_INVALID_CONTEXT;
+    };
+    let world = context.world_mut();
+
+    let skinned: Vec<bool> = entities
+        .iter()
+        .map(|&e| world.has::<Skeleton2D>(e))
+        .collect();
+    let mut offsets = Vec::with_capacity(entities.len() + 1);
+    offsets.push(0_usize);
+    for &entity in &entities {
+        let bones = world
+            .get::<Skeleton2D>(entity)
+            .map_or(0, Skeleton2D::bone_count);
+        offsets.push(offsets[offsets.len() - 1] + bones);
+    }
+    let total = offsets[entities.len()];
+    if total > i32::MAX as usize / BONE_PALETTE_FLOATS {
+        return invalid_state(format!("{} bones exceed the palette limit", total));
+    }
+    if !out_offsets.is_null() {
+        for (i, &offset) in offsets.iter().enumerate() {
+            // SAFETY: i <= count, and the caller guarantees `count + 1` offsets.
+            *out_offsets.add(i) = offset as u32;
+        }
+    }
+    if out_palette.is_null() {
+        return total as i32;
+    }
+    if (palette_len as usize) < total * BONE_PALETTE_FLOATS {
+        return invalid_state(format!(
+            "palette holds {} floats but {} bones need {}",
+            palette_len,
+            total,
+            total * BONE_PALETTE_FLOATS
+        ));
+    }
+
+    let tick = world.change_tick();
+    if let Some(animators) = world.get_storage_option_mut::<SkeletalAnimator>() {
+        for (&entity, _) in entities.iter().zip(&skinned).filter(|(_, &s)| s) {
+            if animators.get_mut(entity).is_some_and(|a| a.advance(dt)) {
+                animators.set_changed_tick(entity, tick);
+            }
+        }
+    }
+
+    let mut transforms = vec![BoneTransform::default(); total];
+    // SAFETY: The caller guarantees `palette_len` floats, checked above to
+    // cover every bone.
+    let palette = std::slice::from_raw_parts_mut(out_palette, total * BONE_PALETTE_FLOATS);
+    evaluate_skeletons(world, &entities, &offsets, &mut transforms, palette);
+
+    if let Some(skeletons) = world.get_storage_option_mut::<Skeleton2D>() {
+        for (slot, &entity) in entities.iter().enumerate() {
+            let Some(skeleton) = skeletons.get_mut(entity).filter(|_| skinned[slot]) else {
+                continue;
+            };
+            skeleton.world_transforms.clear();
+            skeleton
+                .world_transforms
+                .extend_from_slice(&transforms[offsets[slot]..offsets[slot + 1]]);
+            skeletons.set_changed_tick(entity, tick);
+        }
+    }
+    total as i32
+}
+
+/// Evaluates the pose and palette of every skeleton in `entities`.
+///
+/// `offsets` holds each entity's first bone, plus the total; `transforms`
+/// and `palette` are sized for the total.
+fn evaluate_skeletons(
+    world: &World,
+    entities: &[Entity],
+    offsets: &[usize],
+    transforms: &mut [BoneTransform],
+    palette: &mut [f32],
+) {
+    let Some(skeletons) = world.get_storage::<Skeleton2D>() else {
+        return;
+    };
+    let animators = world.get_storage::<SkeletalAnimator>();
+    let stacks = world.get_storage::<AnimationLayerStack>();
+
+    // Split the outputs into one exclusive range per skeleton.
+    let mut jobs: Vec<(Entity, &mut [BoneTransform], &mut [f32])> =
+        Vec::with_capacity(entities.len());
+    let mut world_rest = transforms;
+    let mut palette_rest = palette;
+    for (slot, &entity) in entities.iter().enumerate() {
+        let bones = offsets[slot + 1] - offsets[slot];
+        if bones == 0 {
+            continue;
+        }
+        let (world_out, tail) = std::mem::take(&mut world_rest).split_at_mut(bones);
+        world_rest = tail;
+        let (matrices, tail) =
+            std::mem::take(&mut palette_rest).split_at_mut(bones * BONE_PALETTE_FLOATS);
+        palette_rest = tail;
+        jobs.push((entity, world_out, matrices));
+    }
+
+    let step = |scratch: &mut PoseScratch, job: &mut (Entity, &mut [BoneTransform], &mut [f32])| {
+        let (entity, world_out, matrices) = job;
+        let Some(skeleton) = skeletons.get(*entity) else {
+            return;
+        };
+        evaluate_pose(
+            &skeleton.bones,
+            animators.and_then(|a| a.get(*entity)),
+            stacks.and_then(|s| s.get(*entity)),
+            scratch,
+            world_out,
+        );
+        write_bone_palette(&skeleton.bones, world_out, scratch, matrices);
+    };
+
+    #[cfg(feature = "native")]
+    if jobs.len() > PARALLEL_CHUNK {
+        use rayon::prelude::*;
+        jobs.par_iter_mut()
+            .with_min_len(PARALLEL_CHUNK)
+            .for_each_init(PoseScratch::default, step);
+        return;
+    }
+    let mut scratch = PoseScratch::default();
+    for job in &mut jobs {
+        step(&mut scratch, job);
+    }
+}
+
+#[cfg(test)]
+#[path = "skeletal_batch_tests.rs"]
+mod tests;
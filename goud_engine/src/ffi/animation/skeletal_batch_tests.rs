@@ -0,0 +1,232 @@
+use super::*;
+use crate::ecs::components::sprite_animator::AnimationClip;
+use crate::ffi::animation::skeletal::{
+    goud_skeleton_add_bone, goud_skeleton_create, goud_skeleton_play_clip,
+};
+use crate::ffi::context::{goud_context_create, goud_context_destroy};
+use std::f32::consts::FRAC_PI_2;
+
+fn with_world<R>(ctx: GoudContextId, f: impl FnOnce(&mut World) -> R) -> R {
+    let mut registry = get_context_registry().lock().unwrap();
+    f(registry.get_mut(ctx).unwrap().world_mut())
+}
+
+/// Spawns an entity with a playing two-bone skeleton: root at the origin
+/// and a child offset by (10, 0).
+fn spawn_character(ctx: GoudContextId) -> u64 {
+    let entity = with_world(ctx, |world| world.spawn_empty().to_bits());
+    assert_eq!(goud_skeleton_create(ctx, entity), 0);
+    // SAFETY: The names are valid UTF-8 of the given lengths.
+    unsafe {
+        assert_eq!(
+            goud_skeleton_add_bone(ctx, entity, b"root".as_ptr(), 4, -1, 0.0, 0.0, 0.0),
+            0
+        );
+        assert_eq!(
+            goud_skeleton_add_bone(ctx, entity, b"arm".as_ptr(), 3, 0, 10.0, 0.0, 0.0),
+            1
+        );
+        assert_eq!(
+            goud_skeleton_play_clip(ctx, entity, b"idle".as_ptr(), 4, true),
+            0
+        );
+    }
+    entity
+}
+
+fn key_rotation(ctx: GoudContextId, entity: u64, layer: i32, time: f32, rotation: f32) -> i32 {
+    goud_skeleton_add_keyframe(ctx, entity, layer, 0, time, 0.0, 0.0, rotation, 1.0, 1.0)
+}
+
+fn update(
+    ctx: GoudContextId,
+    ids: &[u64],
+    dt: f32,
+    palette: &mut [f32],
+    offsets: &mut [u32],
+) -> i32 {
+    let out = if palette.is_empty() {
+        std::ptr::null_mut()
+    } else {
+        palette.as_mut_ptr()
+    };
+    // SAFETY: `ids` holds `ids.len()` ids, `palette` its length, and
+    // `offsets` `ids.len() + 1` values.
+    unsafe {
+        goud_skeleton_update_batch(
+            ctx,
+            ids.as_ptr(),
+            ids.len() as u32,
+            dt,
+            out,
+            palette.len() as u32,
+            offsets.as_mut_ptr(),
+        )
+    }
+}
+
+fn root_rotation(ctx: GoudContextId, entity: u64) -> f32 {
+    with_world(ctx, |world| {
+        world
+            .get::<Skeleton2D>(Entity::from_bits(entity))
+            .unwrap()
+            .world_transforms[0]
+            .rotation
+    })
+}
+
+#[test]
+fn test_sizing_query_reports_offsets_without_advancing() {
+    let ctx = goud_context_create();
+    let a = spawn_character(ctx);
+    let empty = with_world(ctx, |world| world.spawn_empty().to_bits());
+    let b = spawn_character(ctx);
+    assert_eq!(key_rotation(ctx, a, 0, 1.0, 1.0), 0);
+
+    let mut offsets = [u32::MAX; 4];
+    assert_eq!(update(ctx, &[a, empty, b], 0.5, &mut [], &mut offsets), 4);
+    assert_eq!(offsets, [0, 2, 2, 4]);
+    assert_eq!(root_rotation(ctx, a), 0.0);
+
+    goud_context_destroy(ctx);
+}
+
+#[test]
+fn test_update_writes_palette_and_world_transforms() {
+    let ctx = goud_context_create();
+    let a = spawn_character(ctx);
+    let b = spawn_character(ctx);
+    assert_eq!(key_rotation(ctx, b, 0, 0.0, 0.0), 0);
+    assert_eq!(key_rotation(ctx, b, 0, 1.0, FRAC_PI_2), 0);
+
+    let floats = GOUD_BONE_PALETTE_FLOATS as usize;
+    let mut palette = vec![f32::NAN; 4 * floats];
+    let mut offsets = [0_u32; 3];
+    assert_eq!(update(ctx, &[a, b], 0.5, &mut palette, &mut offsets), 4);
+    assert_eq!(offsets, [0, 2, 4]);
+
+    // `a` has no keyframes and an identity bind pose: the arm sits at (10, 0).
+    assert_eq!(
+        &palette[floats..2 * floats],
+        &[1.0, 0.0, 10.0, 0.0, 0.0, 1.0, 0.0, 0.0]
+    );
+    // `b`'s root is halfway to a quarter turn, and so is the arm it carries.
+    let (sin, cos) = (FRAC_PI_2 * 0.5).sin_cos();
+    let arm = &palette[3 * floats..4 * floats];
+    let expected = [cos, -sin, 10.0 * cos, 0.0, sin, cos, 10.0 * sin, 0.0];
+    for (got, want) in arm.iter().zip(expected) {
+        assert!((got - want).abs() < 1e-5, "{arm:?}");
+    }
+    assert!((root_rotation(ctx, b) - FRAC_PI_2 * 0.5).abs() < 1e-5);
+
+    goud_context_destroy(ctx);
+}
+
+#[test]
+fn test_layers_blend_and_follow_animation_layer_stack() {
+    let ctx = goud_context_create();
+    let entity = spawn_character(ctx);
+    // SAFETY: The name is valid UTF-8 of the given length.
+    let layer = unsafe {
+        goud_skeleton_layer_add(ctx, entity, b"aim".as_ptr(), 3, BLEND_MODE_ADDITIVE, true)
+    };
+    assert_eq!(layer, 1);
+    assert_eq!(key_rotation(ctx, entity, layer, 0.0, 1.0), 0);
+    assert_eq!(goud_skeleton_layer_set_weight(ctx, entity, layer, 0.5), 0);
+
+    let mut palette = vec![0.0; 2 * GOUD_BONE_PALETTE_FLOATS as usize];
+    let mut offsets = [0_u32; 2];
+    assert_eq!(update(ctx, &[entity], 0.1, &mut palette, &mut offsets), 2);
+    assert!((root_rotation(ctx, entity) - 0.5).abs() < 1e-5);
+
+    with_world(ctx, |world| {
+        let stack = AnimationLayerStack::new().with_layer(
+            "aim",
+            AnimationClip::new(Vec::new(), 0.1),
+            0.25,
+            BlendMode::Additive,
+        );
+        world.insert(Entity::from_bits(entity), stack);
+    });
+    assert_eq!(update(ctx, &[entity], 0.1, &mut palette, &mut offsets), 2);
+    assert!((root_rotation(ctx, entity) - 0.25).abs() < 1e-5);
+
+    goud_context_destroy(ctx);
+}
+
+#[test]
+fn test_parallel_batch_matches_sequential_evaluation() {
+    let ctx = goud_context_create();
+    let ids: Vec<u64> = (0..PARALLEL_CHUNK * 3)
+        .map(|i| {
+            let entity = spawn_character(ctx);
+            assert_eq!(key_rotation(ctx, entity, 0, 0.0, 0.0), 0);
+            assert_eq!(key_rotation(ctx, entity, 0, 2.0, i as f32 * 0.01), 0);
+            entity
+        })
+        .collect();
+
+    let floats = GOUD_BONE_PALETTE_FLOATS as usize;
+    let mut palette = vec![0.0; ids.len() * 2 * floats];
+    let mut offsets = vec![0_u32; ids.len() + 1];
+    assert_eq!(
+        update(ctx, &ids, 1.0, &mut palette, &mut offsets),
+        ids.len() as i32 * 2
+    );
+
+    for (i, &entity) in ids.iter().enumerate() {
+        let expected = i as f32 * 0.005;
+        assert!((root_rotation(ctx, entity) - expected).abs() < 1e-5);
+        let root = offsets[i] as usize * floats;
+        assert!((palette[root + 4] - expected.sin()).abs() < 1e-5);
+    }
+
+    goud_context_destroy(ctx);
+}
+
+#[test]
+fn test_invalid_batches_are_rejected() {
+    let ctx = goud_context_create();
+    let entity = spawn_character(ctx);
+    assert_eq!(key_rotation(ctx, entity, 0, 1.0, 1.0), 0);
+
+    let mut short = vec![0.0; GOUD_BONE_PALETTE_FLOATS as usize];
+    let mut offsets = [0_u32; 3];
+    assert_eq!(
+        update(ctx, &[entity], 0.5, &mut short, &mut offsets),
+        -ERR_INVALID_STATE
+    );
+    assert_eq!(
+        update(ctx, &[entity, entity], 0.5, &mut short, &mut offsets),
+        -ERR_INVALID_STATE
+    );
+    assert_eq!(root_rotation(ctx, entity), 0.0);
+    assert_eq!(
+        update(
+            GOUD_INVALID_CONTEXT_ID,
+            &[entity],
+            0.5,
+            &mut [],
+            &mut offsets
+        ),
+        -ERR_INVALID_CONTEXT
+    );
+
+    assert_eq!(key_rotation(ctx, entity, 1, 0.0, 1.0), -ERR_INVALID_STATE);
+    assert_eq!(key_rotation(ctx, entity, 0, -1.0, 1.0), -ERR_INVALID_STATE);
+    assert_eq!(
+        goud_skeleton_layer_set_weight(ctx, entity, 0, 1.0),
+        -ERR_INVALID_STATE
+    );
+    // SAFETY: The name is valid UTF-8 of the given length.
+    let bad_mode = unsafe { goud_skeleton_layer_add(ctx, entity, b"aim".as_ptr(), 3, 7, true) };
+    assert_eq!(bad_mode, -ERR_INVALID_STATE);
+
+    let bare = with_world(ctx, |world| world.spawn_empty().to_bits());
+    assert_eq!(
+        key_rotation(ctx, bare, 0, 0.0, 1.0),
+        -ERR_COMPONENT_NOT_FOUND
+    );
+
+    goud_context_destroy(ctx);
+}
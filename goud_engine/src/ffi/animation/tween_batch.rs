@@ -0,0 +1,262 @@
+//! Bulk tween stepping over caller-owned arrays.
+//!
+//! `goud_tween_update` and `goud_tween_value` step and read one handle per
+//! call.  `goud_tween_step_batch` advances a whole structure-of-arrays set of
+//! tweens in one call and writes every current value.  The work runs in
+//! three passes over contiguous `f32` slices -- advance and normalize, ease,
+//! interpolate -- and the easing pass applies one curve per run of equal
+//! easing ids, so each pass is a tight loop the compiler can vectorize.
+
+use crate::core::error::{set_last_error, GoudError, ERR_INVALID_STATE};
+use crate::core::math::{ease_in, ease_in_back, ease_in_out, ease_out, ease_out_bounce, linear};
+
+/// Largest easing id accepted (see `goud_tween_create`).
+const MAX_EASING: u8 = 5;
+
+/// Applies `curve` to every value of a run sharing one easing.
+#[inline]
+fn ease_run(values: &mut [f32], curve: fn(f32) -> f32) {
+    for value in values {
+        *value = curve(*value);
+    }
+}
+
+/// Easing curve for a validated easing id.
+fn curve(easing: u8) -> fn(f32) -> f32 {
+    match easing {
+        1 => ease_in,
+        2 => ease_out,
+        3 => ease_in_out,
+        4 => ease_in_back,
+        5 => ease_out_bounce,
+        _ => linear,
+    }
+}
+
+/// Advances `count` tweens stored as parallel arrays by `dt` seconds.
+///
+/// Tween `i` runs from `start[i]` to `end[i]` over `duration[i]` seconds
+/// with easing id `easing[i]` (0=Linear, 1=EaseIn, 2=EaseOut, 3=EaseInOut,
+/// 4=EaseInBack, 5=EaseOutBounce, as for `goud_tween_create`).
+/// `elapsed[i]` is advanced and clamped to the duration (negative durations
+/// count as 0), and `out_values[i]` receives the eased value, exactly as
+/// `goud_tween_update` followed by `goud_tween_value` would produce.
+///
+/// An unknown easing id rejects the whole call before anything is written.
+///
+/// # Safety
+///
+/// `start`, `end`, `duration` and `easing` must point to `count` readable
+/// elements, `elapsed` and `out_values` to `count` writable `f32`s.
+/// `out_values` must not overlap any other array.
+///
+/// # Returns
+///
+/// The number of finished tweens (elapsed has reached the duration), or a
+/// negative error code.
+#[no_mangle]
+pub unsafe extern "C" fn goud_tween_step_batch(
+    start: *const f32,
+    end: *const f32,
+    duration: *const f32,
+    elapsed: *mut f32,
+    easing: *const u8,
+    count: u32,
+    dt: f32,
+    out_values: *mut f32,
+) -> i32 {
+    if count == 0 {
+        return 0;
+    }
+    if start.is_null()
+        || end.is_null()
+        || duration.is_null()
+        || elapsed.is_null()
+        || easing.is_null()
+        || out_values.is_null()
+    {
+        set_last_error(GoudError::InvalidState(
+            "tween array pointer is null".to_string(),
+        ));
+        return -ERR_INVALID_STATE;
+    }
+    if count > i32::MAX as u32 {
+        set_last_error(GoudError::InvalidState("too many tweens".to_string()));
+        return -ERR_INVALID_STATE;
+    }
+
+    let n = count as usize;
+    // SAFETY: Caller guarantees each array holds `count` elements and that
+    // `out_values` overlaps none of them.
+    let start = std::slice::from_raw_parts(start, n);
+    let end = std::slice::from_raw_parts(end, n);
+    let duration = std::slice::from_raw_parts(duration, n);
+    let easing = std::slice::from_raw_parts(easing, n);
+    if let Some(&bad) = easing.iter().find(|&&id| id > MAX_EASING) {
+        set_last_error(GoudError::InvalidState(format!(
+            "unknown easing type {bad}"
+        )));
+        return -ERR_INVALID_STATE;
+    }
+    let elapsed = std::slice::from_raw_parts_mut(elapsed, n);
+    let values = std::slice::from_raw_parts_mut(out_values, n);
+
+    step_tweens(start, end, duration, elapsed, easing, dt, values) as i32
+}
+
+/// Runs the three passes of `goud_tween_step_batch`; returns finished count.
+fn step_tweens(
+    start: &[f32],
+    end: &[f32],
+    duration: &[f32],
+    elapsed: &mut [f32],
+    easing: &[u8],
+    dt: f32,
+    values: &mut [f32],
+) -> usize {
+    // Pass 1: advance and normalize to t in [0, 1].
+    let mut finished = 0usize;
+    for ((e, &d), t) in elapsed.iter_mut().zip(duration).zip(values.iter_mut()) {
+        let d = d.max(0.0);
+        *e = (*e + dt).min(d);
+        *t = if d > 0.0 {
+            (*e / d).clamp(0.0, 1.0)
+        } else {
+            1.0
+        };
+        finished += usize::from(*e >= d);
+    }
+
+    // Pass 2: ease each run of equal easing ids with one curve.
+    let mut run_start = 0;
+    while run_start < easing.len() {
+        let id = easing[run_start];
+        let run_len = easing[run_start..]
+            .iter()
+            .position(|&other| other != id)
+            .unwrap_or(easing.len() - run_start);
+        if id != 0 {
+            ease_run(&mut values[run_start..run_start + run_len], curve(id));
+        }
+        run_start += run_len;
+    }
+
+    // Pass 3: interpolate.
+    for ((v, &a), &b) in values.iter_mut().zip(start).zip(end) {
+        *v = a + (b - a) * *v;
+    }
+    finished
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::ffi::animation::tween::{
+        goud_tween_create, goud_tween_destroy, goud_tween_update, goud_tween_value,
+    };
+    use crate::ffi::context::GOUD_INVALID_CONTEXT_ID;
+
+    #[test]
+    fn test_step_batch_matches_single_tweens() {
+        let ids: Vec<u8> = vec![0, 0, 1, 2, 2, 3, 4, 5, 5, 1];
+        let n = ids.len();
+        let start: Vec<f32> = (0..n).map(|i| i as f32).collect();
+        let end: Vec<f32> = (0..n).map(|i| 10.0 - i as f32 * 3.0).collect();
+        let mut duration: Vec<f32> = (0..n).map(|i| 0.25 + i as f32 * 0.1).collect();
+        duration[1] = 0.0;
+        let handles: Vec<i64> = (0..n)
+            .map(|i| {
+                goud_tween_create(
+                    GOUD_INVALID_CONTEXT_ID,
+                    start[i],
+                    end[i],
+                    duration[i],
+                    i32::from(ids[i]),
+                )
+            })
+            .collect();
+
+        let mut elapsed = vec![0.0; n];
+        let mut values = vec![0.0; n];
+        for _ in 0..6 {
+            // SAFETY: Every array holds n elements and `values` is separate.
+            let finished = unsafe {
+                goud_tween_step_batch(
+                    start.as_ptr(),
+                    end.as_ptr(),
+                    duration.as_ptr(),
+                    elapsed.as_mut_ptr(),
+                    ids.as_ptr(),
+                    n as u32,
+                    0.1,
+                    values.as_mut_ptr(),
+                )
+            };
+            let mut expected_finished = 0;
+            for (i, &handle) in handles.iter().enumerate() {
+                assert_eq!(goud_tween_update(GOUD_INVALID_CONTEXT_ID, handle, 0.1), 0);
+                let mut expected = 0.0;
+                // SAFETY: `expected` is a valid f32.
+                unsafe { goud_tween_value(GOUD_INVALID_CONTEXT_ID, handle, &mut expected) };
+                assert!((values[i] - expected).abs() < 1e-6, "tween {i}");
+                expected_finished += i32::from(elapsed[i] >= duration[i]);
+            }
+            assert_eq!(finished, expected_finished);
+        }
+        assert_eq!(values[1], end[1], "zero-duration tweens jump to the end");
+        for handle in handles {
+            goud_tween_destroy(GOUD_INVALID_CONTEXT_ID, handle);
+        }
+    }
+
+    #[test]
+    fn test_step_batch_rejects_bad_arguments() {
+        let one = [1.0f32];
+        let mut elapsed = [0.0f32];
+        let mut value = [7.0f32];
+        // SAFETY: Null and invalid arguments are the error paths under test.
+        unsafe {
+            assert_eq!(
+                goud_tween_step_batch(
+                    one.as_ptr(),
+                    one.as_ptr(),
+                    one.as_ptr(),
+                    elapsed.as_mut_ptr(),
+                    [6u8].as_ptr(),
+                    1,
+                    0.5,
+                    value.as_mut_ptr(),
+                ),
+                -ERR_INVALID_STATE
+            );
+            assert_eq!((elapsed[0], value[0]), (0.0, 7.0), "nothing written");
+            assert_eq!(
+                goud_tween_step_batch(
+                    one.as_ptr(),
+                    std::ptr::null(),
+                    one.as_ptr(),
+                    elapsed.as_mut_ptr(),
+                    [0u8].as_ptr(),
+                    1,
+                    0.5,
+                    value.as_mut_ptr(),
+                ),
+                -ERR_INVALID_STATE
+            );
+            let null = std::ptr::null_mut();
+            assert_eq!(
+                goud_tween_step_batch(
+                    std::ptr::null(),
+                    std::ptr::null(),
+                    std::ptr::null(),
+                    null,
+                    std::ptr::null(),
+                    0,
+                    0.5,
+                    null,
+                ),
+                0
+            );
+        }
+    }
+}
@@ -0,0 +1,186 @@
+//! FFI exports for per-context frame arenas.
+//!
+//! Every context owns its own [`FrameArena`](crate::core::arena::FrameArena).
+//! Unlike the process-wide arena these take no shared lock beyond the
+//! calling thread's context registry, so contexts ticked on separate
+//! isolated threads never contend for scratch memory.
+
+use std::alloc::Layout;
+
+use crate::context_registry::get_context_registry;
+use crate::core::arena::FrameArena;
+use crate::core::error::{set_last_error, GoudError};
+use crate::ffi::context::GoudContextId;
+
+use super::FfiArenaStats;
+
+/// Runs `f` on the context's frame arena, or returns the error to report.
+fn with_context_arena<R>(
+    context_id: GoudContextId,
+    f: impl FnOnce(&mut FrameArena) -> R,
+) -> Result<R, GoudError> {
+    let mut registry = get_context_registry()
+        .lock()
+        .map_err(|_| GoudError::InternalError("Failed to lock context registry".to_string()))?;
+    let context = registry
+        .get_mut(context_id)
+        .ok_or(GoudError::InvalidContext)?;
+    Ok(f(context.frame_arena_mut()))
+}
+
+/// Resets a context's frame arena, freeing all its allocations at once.
+///
+/// Call once per frame of that context, typically at the start of its tick.
+///
+/// # Returns
+///
+/// 0 on success, negative error code on failure.
+#[no_mangle]
+pub extern "C" fn goud_context_frame_arena_reset(context_id: GoudContextId) -> i32 {
+    match with_context_arena(context_id, |arena| arena.reset()) {
+        Ok(()) => 0,
+        Err(err) => {
+            let code = err.error_code();
+            set_last_error(err);
+            code
+        }
+    }
+}
+
+/// Allocates `size` bytes aligned to `align` from a context's frame arena.
+///
+/// The memory is uninitialised and stays valid until the next
+/// [`goud_context_frame_arena_reset`] or until the context is destroyed; it
+/// must not be freed individually.
+///
+/// # Arguments
+///
+/// * `context_id` - The context that owns the arena.
+/// * `size` - Number of bytes to allocate (0 is treated as 1).
+/// * `align` - Alignment in bytes; must be a power of two.
+///
+/// # Returns
+///
+/// Pointer to the allocation, or null on failure.
+#[no_mangle]
+pub extern "C" fn goud_context_frame_arena_alloc(
+    context_id: GoudContextId,
+    size: usize,
+    align: usize,
+) -> *mut u8 {
+    let layout = match Layout::from_size_align(size.max(1), align) {
+        Ok(layout) => layout,
+        Err(_) => {
+            set_last_error(GoudError::InvalidState(format!(
+                "invalid frame arena layout: size {size}, align {align}"
+            )));
+            return std::ptr::null_mut();
+        }
+    };
+
+    match with_context_arena(context_id, |arena| arena.alloc_layout(layout)) {
+        Ok(Some(ptr)) => ptr.as_ptr(),
+        Ok(None) => {
+            set_last_error(GoudError::InternalError(format!(
+                "frame arena allocation of {size} bytes failed"
+            )));
+            std::ptr::null_mut()
+        }
+        Err(err) => {
+            set_last_error(err);
+            std::ptr::null_mut()
+        }
+    }
+}
+
+/// Retrieves diagnostic statistics for a context's frame arena.
+///
+/// # Arguments
+///
+/// * `context_id` - The context that owns the arena.
+/// * `out_stats` - Pointer to caller-allocated storage for one `FfiArenaStats`.
+///
+/// # Returns
+///
+/// 0 on success, negative error code on failure.
+///
+/// # Safety
+///
+/// `out_stats` must point to writable storage for one [`FfiArenaStats`].
+#[no_mangle]
+pub unsafe extern "C" fn goud_context_frame_arena_stats(
+    context_id: GoudContextId,
+    out_stats: *mut FfiArenaStats,
+) -> i32 {
+    if out_stats.is_null() {
+        set_last_error(GoudError::InvalidState(
+            "out_stats pointer is null".to_string(),
+        ));
+        return GoudError::InvalidState(String::new()).error_code();
+    }
+
+    match with_context_arena(context_id, |arena| arena.stats()) {
+        Ok(stats) => {
+            // SAFETY: out_stats is non-null and points to writable storage for one FfiArenaStats.
+            *out_stats = FfiArenaStats {
+                bytes_allocated: stats.bytes_allocated as u64,
+                bytes_capacity: stats.bytes_capacity as u64,
+                reset_count: stats.reset_count,
+            };
+            0
+        }
+        Err(err) => {
+            let code = err.error_code();
+            set_last_error(err);
+            code
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::ffi::context::{goud_context_create, goud_context_destroy};
+
+    #[test]
+    fn each_context_has_its_own_arena() {
+        let first = goud_context_create();
+        let second = goud_context_create();
+
+        assert!(!goud_context_frame_arena_alloc(first, 64, 8).is_null());
+        assert_eq!(goud_context_frame_arena_reset(second), 0);
+
+        let mut first_stats = FfiArenaStats::default();
+        let mut second_stats = FfiArenaStats::default();
+        // SAFETY: both pointers reference live stack values.
+        unsafe {
+            assert_eq!(goud_context_frame_arena_stats(first, &mut first_stats), 0);
+            assert_eq!(goud_context_frame_arena_stats(second, &mut second_stats), 0);
+        }
+        assert!(first_stats.bytes_allocated >= 64);
+        assert_eq!(first_stats.reset_count, 0);
+        assert_eq!(second_stats.bytes_allocated, 0);
+        assert_eq!(second_stats.reset_count, 1);
+
+        assert!(goud_context_destroy(first));
+        assert!(goud_context_destroy(second));
+    }
+
+    #[test]
+    fn invalid_context_and_layout_are_rejected() {
+        let invalid = crate::ffi::context::GOUD_INVALID_CONTEXT_ID;
+        assert_ne!(goud_context_frame_arena_reset(invalid), 0);
+        assert!(goud_context_frame_arena_alloc(invalid, 16, 8).is_null());
+
+        let context = goud_context_create();
+        assert!(goud_context_frame_arena_alloc(context, 16, 3).is_null());
+        // SAFETY: a null out pointer is the case under test.
+        unsafe {
+            assert_ne!(
+                goud_context_frame_arena_stats(context, std::ptr::null_mut()),
+                0
+            );
+        }
+        assert!(goud_context_destroy(context));
+    }
+}
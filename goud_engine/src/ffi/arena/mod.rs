@@ -2,12 +2,16 @@
 //!
 //! Provides C-compatible functions for resetting and querying a global
 //! per-process frame arena. The arena is a bump allocator designed for
-//! per-frame temporary allocations that are freed in bulk.
+//! per-frame temporary allocations that are freed in bulk. Each context also
+//! owns an arena of its own; see [`context`].
 
 use crate::core::arena::FrameArena;
 use crate::core::error::{set_last_error, GoudError, ERR_INTERNAL_ERROR};
+use std::alloc::Layout;
 use std::sync::{Mutex, OnceLock};
 
+pub mod context;
+
 /// Returns the global frame arena (one per process, thread-safe).
 fn global_arena() -> &'static Mutex<FrameArena> {
     static ARENA: OnceLock<Mutex<FrameArena>> = OnceLock::new();
@@ -50,6 +54,52 @@ pub extern "C" fn goud_frame_arena_reset() -> i32 {
     0
 }
 
+/// Allocates `size` bytes aligned to `align` from the global frame arena.
+///
+/// The memory is uninitialised and stays valid until the next
+/// [`goud_frame_arena_reset`]; it must not be freed individually.
+///
+/// # Arguments
+///
+/// * `size` - Number of bytes to allocate (0 is treated as 1).
+/// * `align` - Alignment in bytes; must be a power of two.
+///
+/// # Returns
+///
+/// Pointer to the allocation, or null on failure.
+#[no_mangle]
+pub extern "C" fn goud_frame_arena_alloc(size: usize, align: usize) -> *mut u8 {
+    let layout = match Layout::from_size_align(size.max(1), align) {
+        Ok(layout) => layout,
+        Err(_) => {
+            set_last_error(GoudError::InvalidState(format!(
+                "invalid frame arena layout: size {size}, align {align}"
+            )));
+            return std::ptr::null_mut();
+        }
+    };
+
+    let arena = match global_arena().lock() {
+        Ok(a) => a,
+        Err(_) => {
+            set_last_error(GoudError::InternalError(
+                "Failed to lock frame arena".to_string(),
+            ));
+            return std::ptr::null_mut();
+        }
+    };
+
+    match arena.alloc_layout(layout) {
+        Some(ptr) => ptr.as_ptr(),
+        None => {
+            set_last_error(GoudError::InternalError(format!(
+                "frame arena allocation of {size} bytes failed"
+            )));
+            std::ptr::null_mut()
+        }
+    }
+}
+
 /// Retrieves diagnostic statistics for the global frame arena.
 ///
 /// # Arguments
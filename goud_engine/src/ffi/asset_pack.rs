@@ -0,0 +1,479 @@
+//! # Asset Pack FFI
+//!
+//! Opens memory-mapped GOUD archives (see [`AssetPack`]) and loads
+//! textures, fonts, audio and scenes straight out of them by name hash.
+//! Build packs with the `goud_pack` tool; hash names with
+//! `goud_asset_pack_hash` (or compute the same 64-bit FNV-1a at build time).
+//!
+//! The loaders hand the decoders a slice of the mapping, so an uncompressed
+//! entry is never copied into an intermediate buffer. Fonts and audio keep
+//! their encoded bytes for the lifetime of the asset, so those loaders copy
+//! the entry once into engine-owned storage. LZ4-compressed entries are
+//! decompressed into a temporary buffer first.
+
+use std::collections::HashMap;
+use std::ffi::CStr;
+use std::os::raw::c_char;
+use std::sync::{Arc, Mutex};
+
+use crate::assets::vfs::archive_format::name_hash_bytes;
+use crate::assets::{AssetLoadError, AssetPack};
+use crate::context_registry::scene::PACKED_SCENE_MAGIC;
+use crate::core::error::{set_last_error, GoudError};
+use crate::ffi::audio::playback::goud_audio_play;
+use crate::ffi::context::{GoudContextId, GOUD_INVALID_CONTEXT_ID};
+use crate::ffi::renderer::{
+    goud_font_load_memory, goud_texture_create_rgba8, goud_texture_stream_load_memory,
+    GoudFontHandle, GoudTextureHandle, GOUD_INVALID_FONT, GOUD_INVALID_TEXTURE,
+};
+use crate::ffi::scene_loading::{goud_scene_load, goud_scene_load_packed, INVALID_SCENE_ID};
+
+/// Opaque asset pack handle for FFI.
+pub type GoudAssetPackHandle = u64;
+
+/// Invalid asset pack handle constant.
+pub const GOUD_INVALID_ASSET_PACK: GoudAssetPackHandle = u64::MAX;
+
+struct PackRegistry {
+    packs: HashMap<GoudAssetPackHandle, Arc<AssetPack>>,
+    next_handle: GoudAssetPackHandle,
+}
+
+static PACKS: Mutex<Option<PackRegistry>> = Mutex::new(None);
+
+fn report(err: GoudError) -> i32 {
+    let code = err.error_code();
+    set_last_error(err);
+    code
+}
+
+fn pack_error(err: AssetLoadError) -> GoudError {
+    if err.is_not_found() {
+        GoudError::ResourceNotFound(err.to_string())
+    } else if err.is_decode_failed() {
+        GoudError::ResourceInvalidFormat(err.to_string())
+    } else {
+        GoudError::ResourceLoadFailed(err.to_string())
+    }
+}
+
+fn lock_error() -> GoudError {
+    GoudError::InternalError("Failed to lock asset pack registry".to_string())
+}
+
+fn register(pack: AssetPack) -> GoudAssetPackHandle {
+    let Ok(mut guard) = PACKS.lock() else {
+        set_last_error(lock_error());
+        return GOUD_INVALID_ASSET_PACK;
+    };
+    let registry = guard.get_or_insert_with(|| PackRegistry {
+        packs: HashMap::new(),
+        next_handle: 1,
+    });
+    let handle = registry.next_handle;
+    registry.next_handle += 1;
+    registry.packs.insert(handle, Arc::new(pack));
+    handle
+}
+
+/// Looks up a pack, cloning its `Arc` so no lock is held while loading.
+fn get_pack(handle: GoudAssetPackHandle) -> Result<Arc<AssetPack>, i32> {
+    let guard = PACKS.lock().map_err(|_| report(lock_error()))?;
+    guard
+        .as_ref()
+        .and_then(|registry| registry.packs.get(&handle).cloned())
+        .ok_or_else(|| {
+            report(GoudError::InvalidState(format!(
+                "Unknown asset pack handle {handle}"
+            )))
+        })
+}
+
+/// Resolves `name_hash` in `pack` and passes its bytes to `f`.
+///
+/// Sets the last error and returns `None` on failure.
+fn with_entry<R>(
+    pack: GoudAssetPackHandle,
+    name_hash: u64,
+    f: impl FnOnce(&[u8]) -> R,
+) -> Option<R> {
+    let pack = get_pack(pack).ok()?;
+    match pack.read_hashed(name_hash) {
+        Ok(bytes) => Some(f(&bytes)),
+        Err(err) => {
+            set_last_error(pack_error(err));
+            None
+        }
+    }
+}
+
+/// Opens a GOUD archive by memory-mapping it.
+///
+/// The file must not be modified while the pack is open.
+///
+/// # Returns
+///
+/// A pack handle on success, or `GOUD_INVALID_ASSET_PACK` on error. Close
+/// it with `goud_asset_pack_close`.
+///
+/// # Safety
+///
+/// `path` must be a valid null-terminated C string.
+#[no_mangle]
+pub unsafe extern "C" fn goud_asset_pack_open(path: *const c_char) -> GoudAssetPackHandle {
+    if path.is_null() {
+        set_last_error(GoudError::InvalidState("path pointer is null".to_string()));
+        return GOUD_INVALID_ASSET_PACK;
+    }
+    // SAFETY: caller guarantees path is a valid null-terminated C string
+    let Ok(path) = CStr::from_ptr(path).to_str() else {
+        set_last_error(GoudError::InvalidState("Invalid UTF-8 in path".to_string()));
+        return GOUD_INVALID_ASSET_PACK;
+    };
+    match AssetPack::open(path) {
+        Ok(pack) => register(pack),
+        Err(err) => {
+            set_last_error(pack_error(err));
+            GOUD_INVALID_ASSET_PACK
+        }
+    }
+}
+
+/// Opens a GOUD archive from an in-memory buffer.
+///
+/// The bytes are copied, so the caller may free `data` afterwards.
+///
+/// # Returns
+///
+/// A pack handle on success, or `GOUD_INVALID_ASSET_PACK` on error.
+///
+/// # Safety
+///
+/// `data` must point to `len` valid bytes.
+#[no_mangle]
+pub unsafe extern "C" fn goud_asset_pack_open_memory(
+    data: *const u8,
+    len: usize,
+) -> GoudAssetPackHandle {
+    if data.is_null() {
+        set_last_error(GoudError::InvalidState("data pointer is null".to_string()));
+        return GOUD_INVALID_ASSET_PACK;
+    }
+    // SAFETY: caller guarantees data points to len valid bytes
+    let bytes = std::slice::from_raw_parts(data, len).to_vec();
+    match AssetPack::from_bytes(bytes) {
+        Ok(pack) => register(pack),
+        Err(err) => {
+            set_last_error(pack_error(err));
+            GOUD_INVALID_ASSET_PACK
+        }
+    }
+}
+
+/// Closes an asset pack.
+///
+/// Pointers returned by `goud_asset_pack_entry_data` are invalid afterwards.
+/// Assets already loaded from the pack are unaffected.
+///
+/// # Returns
+///
+/// 0 on success, or the error code if the handle is unknown.
+#[no_mangle]
+pub extern "C" fn goud_asset_pack_close(pack: GoudAssetPackHandle) -> i32 {
+    let Ok(mut guard) = PACKS.lock() else {
+        return report(lock_error());
+    };
+    match guard
+        .as_mut()
+        .and_then(|registry| registry.packs.remove(&pack))
+    {
+        Some(_) => 0,
+        None => report(GoudError::InvalidState(format!(
+            "Unknown asset pack handle {pack}"
+        ))),
+    }
+}
+
+/// Returns the 64-bit name hash that identifies an entry in a pack.
+///
+/// Entry names are paths relative to the packed directory, with forward
+/// slashes. A null `name` hashes as the empty name.
+///
+/// # Safety
+///
+/// `name` must point to `len` valid bytes or be null.
+#[no_mangle]
+pub unsafe extern "C" fn goud_asset_pack_hash(name: *const u8, len: usize) -> u64 {
+    if name.is_null() {
+        return name_hash_bytes(&[]);
+    }
+    // SAFETY: caller guarantees name points to len valid bytes
+    name_hash_bytes(std::slice::from_raw_parts(name, len))
+}
+
+/// Returns the number of entries in a pack, or -1 if the handle is unknown.
+#[no_mangle]
+pub extern "C" fn goud_asset_pack_entry_count(pack: GoudAssetPackHandle) -> i64 {
+    get_pack(pack).map_or(-1, |pack| pack.len() as i64)
+}
+
+/// Writes the decompressed size of an entry into `out_size`.
+///
+/// # Returns
+///
+/// 0 on success, or the error code if the pack or entry does not exist.
+///
+/// # Safety
+///
+/// `out_size` must point to writable storage for one `u64`.
+#[no_mangle]
+pub unsafe extern "C" fn goud_asset_pack_entry_size(
+    pack: GoudAssetPackHandle,
+    name_hash: u64,
+    out_size: *mut u64,
+) -> i32 {
+    if out_size.is_null() {
+        return report(GoudError::InvalidState(
+            "out_size pointer is null".to_string(),
+        ));
+    }
+    let pack = match get_pack(pack) {
+        Ok(pack) => pack,
+        Err(code) => return code,
+    };
+    match pack.entry(name_hash) {
+        Some(entry) => {
+            // SAFETY: out_size is non-null and the caller guarantees it is writable.
+            *out_size = entry.size;
+            0
+        }
+        None => report(GoudError::ResourceNotFound(format!(
+            "No asset pack entry with hash {name_hash:016x}"
+        ))),
+    }
+}
+
+/// Returns a pointer to an uncompressed entry's bytes inside the pack.
+///
+/// Nothing is copied: the pointer addresses the memory mapping directly
+/// and stays valid until `goud_asset_pack_close`. Compressed entries cannot
+/// be borrowed; read those with `goud_asset_pack_read`.
+///
+/// # Returns
+///
+/// 0 on success, or the error code on failure.
+///
+/// # Safety
+///
+/// `out_data` and `out_len` must point to writable storage. The engine owns
+/// the returned bytes; the caller must not write to or free them.
+#[no_mangle]
+pub unsafe extern "C" fn goud_asset_pack_entry_data(
+    pack: GoudAssetPackHandle,
+    name_hash: u64,
+    out_data: *mut *const u8,
+    out_len: *mut usize,
+) -> i32 {
+    if out_data.is_null() || out_len.is_null() {
+        return report(GoudError::InvalidState("null pointer argument".to_string()));
+    }
+    let pack = match get_pack(pack) {
+        Ok(pack) => pack,
+        Err(code) => return code,
+    };
+    let Some(bytes) = pack.entry_bytes(name_hash) else {
+        return report(if pack.entry(name_hash).is_some() {
+            GoudError::InvalidState(format!(
+                "Asset pack entry {name_hash:016x} is compressed; use goud_asset_pack_read"
+            ))
+        } else {
+            GoudError::ResourceNotFound(format!("No asset pack entry with hash {name_hash:016x}"))
+        });
+    };
+    // SAFETY: both out pointers are non-null and the caller guarantees they
+    // are writable. The bytes live as long as the registry's Arc, which
+    // `goud_asset_pack_close` releases.
+    *out_data = bytes.as_ptr();
+    *out_len = bytes.len();
+    0
+}
+
+/// Copies an entry's decompressed bytes into `out_buf`.
+///
+/// `out_len` receives the entry size even when `capacity` is too small, so
+/// callers can size the buffer with a first call passing a null `out_buf`.
+///
+/// # Returns
+///
+/// 0 on success, or the error code on failure.
+///
+/// # Safety
+///
+/// `out_buf` must point to `capacity` writable bytes (or be null with
+/// `capacity` 0) and `out_len` to writable storage for one `usize`.
+#[no_mangle]
+pub unsafe extern "C" fn goud_asset_pack_read(
+    pack: GoudAssetPackHandle,
+    name_hash: u64,
+    out_buf: *mut u8,
+    capacity: usize,
+    out_len: *mut usize,
+) -> i32 {
+    if out_len.is_null() {
+        return report(GoudError::InvalidState(
+            "out_len pointer is null".to_string(),
+        ));
+    }
+    let pack = match get_pack(pack) {
+        Ok(pack) => pack,
+        Err(code) => return code,
+    };
+    let Some(entry) = pack.entry(name_hash) else {
+        return report(GoudError::ResourceNotFound(format!(
+            "No asset pack entry with hash {name_hash:016x}"
+        )));
+    };
+    // SAFETY: out_len is non-null and the caller guarantees it is writable.
+    *out_len = entry.size as usize;
+    if out_buf.is_null() || (capacity as u64) < entry.size {
+        return report(GoudError::InvalidState(format!(
+            "out_buf holds {capacity} bytes but the entry needs {}",
+            entry.size
+        )));
+    }
+    match pack.read_hashed(name_hash) {
+        Ok(bytes) => {
+            // SAFETY: capacity >= bytes.len() and out_buf is writable for capacity bytes.
+            std::ptr::copy_nonoverlapping(bytes.as_ptr(), out_buf, bytes.len());
+            0
+        }
+        Err(err) => report(pack_error(err)),
+    }
+}
+
+/// Loads a texture from an encoded image (PNG, JPEG, ...) in a pack.
+///
+/// # Returns
+///
+/// A texture handle on success, or `GOUD_INVALID_TEXTURE` on error.
+#[no_mangle]
+pub extern "C" fn goud_texture_load_from_pack(
+    context_id: GoudContextId,
+    pack: GoudAssetPackHandle,
+    name_hash: u64,
+) -> GoudTextureHandle {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return GOUD_INVALID_TEXTURE;
+    }
+    let decoded = with_entry(pack, name_hash, image::load_from_memory);
+    let rgba = match decoded {
+        Some(Ok(image)) => image.to_rgba8(),
+        Some(Err(e)) => {
+            set_last_error(GoudError::ResourceInvalidFormat(format!(
+                "Failed to decode image: {e}"
+            )));
+            return GOUD_INVALID_TEXTURE;
+        }
+        None => return GOUD_INVALID_TEXTURE,
+    };
+    // SAFETY: `rgba` holds width * height * 4 bytes of RGBA8 pixels.
+    unsafe { goud_texture_create_rgba8(context_id, rgba.as_ptr(), rgba.width(), rgba.height()) }
+}
+
+/// Loads an encoded image entry as a streamed texture.
+///
+/// Uploads only the base tier now; see `goud_texture_stream_load_memory`.
+///
+/// # Returns
+///
+/// A texture handle on success, or `GOUD_INVALID_TEXTURE` on error.
+#[no_mangle]
+pub extern "C" fn goud_texture_stream_load_from_pack(
+    context_id: GoudContextId,
+    pack: GoudAssetPackHandle,
+    name_hash: u64,
+) -> GoudTextureHandle {
+    // SAFETY: `bytes` is a live slice for the duration of the closure.
+    with_entry(pack, name_hash, |bytes| unsafe {
+        goud_texture_stream_load_memory(context_id, bytes.as_ptr(), bytes.len())
+    })
+    .unwrap_or(GOUD_INVALID_TEXTURE)
+}
+
+/// Loads a TTF/OTF font from a pack.
+///
+/// # Returns
+///
+/// A font handle on success, or `GOUD_INVALID_FONT` on error.
+#[no_mangle]
+pub extern "C" fn goud_font_load_from_pack(
+    context_id: GoudContextId,
+    pack: GoudAssetPackHandle,
+    name_hash: u64,
+) -> GoudFontHandle {
+    with_entry(pack, name_hash, |bytes| {
+        // SAFETY: `bytes` is a live slice for the duration of the call.
+        unsafe { goud_font_load_memory(context_id, bytes.as_ptr(), bytes.len()) }
+    })
+    .unwrap_or(GOUD_INVALID_FONT)
+}
+
+/// Plays encoded audio (WAV/OGG/MP3/FLAC) from a pack on the SFX channel.
+///
+/// # Returns
+///
+/// A positive player ID on success, or a negative value on error.
+#[no_mangle]
+pub extern "C" fn goud_audio_play_from_pack(
+    context_id: GoudContextId,
+    pack: GoudAssetPackHandle,
+    name_hash: u64,
+) -> i64 {
+    with_entry(pack, name_hash, |bytes| {
+        // SAFETY: `bytes` is a live slice for the duration of the call.
+        unsafe { goud_audio_play(context_id, bytes.as_ptr(), bytes.len()) }
+    })
+    .unwrap_or(-1)
+}
+
+/// Loads a scene from a pack under the given name.
+///
+/// Packed binary scenes (from `goud_scene_pack_json`) and JSON scenes are
+/// both accepted; the format is detected from the entry's magic bytes.
+///
+/// # Returns
+///
+/// The new scene ID, or `u32::MAX` on failure (see the last error).
+///
+/// # Safety
+///
+/// `name_ptr` must be valid for `name_len` bytes.
+#[no_mangle]
+pub unsafe extern "C" fn goud_scene_load_from_pack(
+    context_id: GoudContextId,
+    pack: GoudAssetPackHandle,
+    name_hash: u64,
+    name_ptr: *const u8,
+    name_len: u32,
+) -> u32 {
+    with_entry(pack, name_hash, |bytes| {
+        let Ok(len) = u32::try_from(bytes.len()) else {
+            set_last_error(GoudError::InvalidState(
+                "scene entry exceeds 4 GiB".to_string(),
+            ));
+            return INVALID_SCENE_ID;
+        };
+        // SAFETY: `bytes` is live for the call; the caller guarantees the name.
+        if bytes.starts_with(&PACKED_SCENE_MAGIC) {
+            goud_scene_load_packed(context_id, name_ptr, name_len, bytes.as_ptr(), len)
+        } else {
+            goud_scene_load(context_id, name_ptr, name_len, bytes.as_ptr(), len)
+        }
+    })
+    .unwrap_or(INVALID_SCENE_ID)
+}
+
+#[cfg(test)]
+#[path = "asset_pack_tests.rs"]
+mod tests;
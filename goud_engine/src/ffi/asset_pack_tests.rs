@@ -0,0 +1,163 @@
+use super::*;
+use crate::assets::vfs::archive_format::{name_hash, ArchiveWriter};
+use crate::ffi::context::{goud_context_create, goud_context_destroy};
+use crate::ffi::scene::goud_scene_get_by_name;
+
+const LEVEL_JSON: &[u8] = br#"{"name":"pack_level","entities":[]}"#;
+
+fn build_pack() -> Vec<u8> {
+    let mut writer = ArchiveWriter::new();
+    writer.set_alignment(64);
+    writer.add_file("data/plain.bin", b"in place");
+    writer.add_file_compressed("data/big.txt", &[b'x'; 2048]);
+    writer.add_file("scenes/level.json", LEVEL_JSON);
+    let mut bytes = Vec::new();
+    writer.write_to(&mut bytes).unwrap();
+    bytes
+}
+
+fn open_pack() -> GoudAssetPackHandle {
+    let bytes = build_pack();
+    // SAFETY: `bytes` is a live buffer of the given length.
+    let pack = unsafe { goud_asset_pack_open_memory(bytes.as_ptr(), bytes.len()) };
+    assert_ne!(pack, GOUD_INVALID_ASSET_PACK);
+    pack
+}
+
+#[test]
+fn hash_matches_engine_name_hash() {
+    let name = b"sprites/player.png";
+    // SAFETY: `name` is valid for its length.
+    let hash = unsafe { goud_asset_pack_hash(name.as_ptr(), name.len()) };
+    assert_eq!(hash, name_hash("sprites/player.png"));
+    // SAFETY: null is accepted and hashes as the empty name.
+    assert_eq!(
+        unsafe { goud_asset_pack_hash(std::ptr::null(), 0) },
+        name_hash("")
+    );
+}
+
+#[test]
+fn entry_data_borrows_uncompressed_entries() {
+    let pack = open_pack();
+    assert_eq!(goud_asset_pack_entry_count(pack), 3);
+
+    let mut data = std::ptr::null();
+    let mut len = 0usize;
+    // SAFETY: out pointers reference live stack values.
+    let code = unsafe {
+        goud_asset_pack_entry_data(pack, name_hash("data/plain.bin"), &mut data, &mut len)
+    };
+    assert_eq!(code, 0);
+    // SAFETY: the pack is open, so `data` is valid for `len` bytes.
+    assert_eq!(
+        unsafe { std::slice::from_raw_parts(data, len) },
+        b"in place"
+    );
+
+    // SAFETY: out pointers reference live stack values.
+    let code =
+        unsafe { goud_asset_pack_entry_data(pack, name_hash("data/big.txt"), &mut data, &mut len) };
+    assert_ne!(code, 0, "compressed entries cannot be borrowed");
+    assert_eq!(goud_asset_pack_close(pack), 0);
+}
+
+#[test]
+fn read_decompresses_and_reports_size() {
+    let pack = open_pack();
+    let hash = name_hash("data/big.txt");
+
+    let mut size = 0u64;
+    // SAFETY: `size` is a live stack value.
+    assert_eq!(
+        unsafe { goud_asset_pack_entry_size(pack, hash, &mut size) },
+        0
+    );
+    assert_eq!(size, 2048);
+
+    let mut len = 0usize;
+    // SAFETY: a null buffer with zero capacity only queries the size.
+    let code = unsafe { goud_asset_pack_read(pack, hash, std::ptr::null_mut(), 0, &mut len) };
+    assert_ne!(code, 0);
+    assert_eq!(len, 2048);
+
+    let mut buf = vec![0u8; len];
+    // SAFETY: `buf` holds `len` writable bytes.
+    let code = unsafe { goud_asset_pack_read(pack, hash, buf.as_mut_ptr(), len, &mut len) };
+    assert_eq!(code, 0);
+    assert!(buf.iter().all(|&b| b == b'x'));
+
+    // SAFETY: `size` is a live stack value.
+    let missing = unsafe { goud_asset_pack_entry_size(pack, name_hash("nope"), &mut size) };
+    assert_ne!(missing, 0);
+    assert_eq!(goud_asset_pack_close(pack), 0);
+}
+
+#[test]
+fn closed_or_invalid_packs_are_rejected() {
+    let pack = open_pack();
+    assert_eq!(goud_asset_pack_close(pack), 0);
+    assert_ne!(goud_asset_pack_close(pack), 0);
+    assert_eq!(goud_asset_pack_entry_count(pack), -1);
+
+    let junk = b"not a pack";
+    // SAFETY: `junk` is valid for its length.
+    let bad = unsafe { goud_asset_pack_open_memory(junk.as_ptr(), junk.len()) };
+    assert_eq!(bad, GOUD_INVALID_ASSET_PACK);
+    // SAFETY: null is rejected before it is read.
+    assert_eq!(
+        unsafe { goud_asset_pack_open(std::ptr::null()) },
+        GOUD_INVALID_ASSET_PACK
+    );
+}
+
+#[test]
+fn open_maps_a_pack_file() {
+    let dir = tempfile::tempdir().unwrap();
+    let path = dir.path().join("test.goud");
+    std::fs::write(&path, build_pack()).unwrap();
+    let c_path = std::ffi::CString::new(path.to_str().unwrap()).unwrap();
+
+    // SAFETY: `c_path` is a valid null-terminated string.
+    let pack = unsafe { goud_asset_pack_open(c_path.as_ptr()) };
+    assert_ne!(pack, GOUD_INVALID_ASSET_PACK);
+    assert_eq!(goud_asset_pack_entry_count(pack), 3);
+    assert_eq!(goud_asset_pack_close(pack), 0);
+}
+
+#[test]
+fn scene_loads_from_pack() {
+    let ctx = goud_context_create();
+    let pack = open_pack();
+    let name = b"pack_level";
+
+    // SAFETY: `name` is valid for its length.
+    let id = unsafe {
+        goud_scene_load_from_pack(
+            ctx,
+            pack,
+            name_hash("scenes/level.json"),
+            name.as_ptr(),
+            name.len() as u32,
+        )
+    };
+    assert_ne!(id, INVALID_SCENE_ID);
+    // SAFETY: `name` is valid for its length.
+    let found = unsafe { goud_scene_get_by_name(ctx, name.as_ptr(), name.len() as u32) };
+    assert_eq!(found, id);
+
+    // SAFETY: `name` is valid for its length.
+    let missing = unsafe {
+        goud_scene_load_from_pack(
+            ctx,
+            pack,
+            name_hash("nope"),
+            name.as_ptr(),
+            name.len() as u32,
+        )
+    };
+    assert_eq!(missing, INVALID_SCENE_ID);
+
+    assert_eq!(goud_asset_pack_close(pack), 0);
+    goud_context_destroy(ctx);
+}
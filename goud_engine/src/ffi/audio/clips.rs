@@ -0,0 +1,306 @@
+//! Decoded audio clip FFI: load a sound once, then play it by ID.
+//!
+//! `goud_audio_play*` take encoded file bytes and decode them on every call.
+//! `goud_audio_clip_load` decodes once into PCM held by the context's
+//! `AudioManager`, and `goud_audio_clip_play*` start players from that PCM.
+//! Decoded PCM lives under a byte budget; least-recently-played clips are
+//! evicted first and decoded again from their kept encoded bytes on their
+//! next play.  The cache's footprint is reported as the `audio` category of
+//! `goud_debugger_get_memory_summary`.
+
+use crate::assets::{AudioClipCacheStats, AudioManager};
+use crate::core::debugger;
+use crate::core::error::{set_last_error, GoudError, GoudResult};
+use crate::ecs::components::AudioChannel;
+use crate::ffi::context::GoudContextId;
+
+use super::spatial::shared::{with_audio, with_audio_mut};
+use super::{ERR_AUDIO, ERR_I32};
+
+/// Invalid audio clip handle constant.
+pub const GOUD_INVALID_AUDIO_CLIP: u64 = 0;
+
+/// FFI-safe audio clip cache counters.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default)]
+pub struct FfiAudioClipCacheStats {
+    /// Loaded clip handles.
+    pub clips: u64,
+    /// Clips whose decoded PCM is in memory.
+    pub resident_clips: u64,
+    /// Bytes of decoded PCM in memory.
+    pub pcm_bytes: u64,
+    /// Bytes of encoded source data kept for re-decoding.
+    pub encoded_bytes: u64,
+    /// Configured PCM byte budget.
+    pub budget_bytes: u64,
+    /// Plays served from resident PCM.
+    pub hits: u64,
+    /// Plays that had to decode an evicted clip again.
+    pub misses: u64,
+    /// Clips whose PCM was evicted to stay within the budget.
+    pub evictions: u64,
+}
+
+impl From<AudioClipCacheStats> for FfiAudioClipCacheStats {
+    fn from(value: AudioClipCacheStats) -> Self {
+        Self {
+            clips: value.clips,
+            resident_clips: value.resident_clips,
+            pcm_bytes: value.pcm_bytes,
+            encoded_bytes: value.encoded_bytes,
+            budget_bytes: value.budget_bytes,
+            hits: value.hits,
+            misses: value.misses,
+            evictions: value.evictions,
+        }
+    }
+}
+
+/// Runs `op` on the context's audio manager and reports its clip cache and
+/// stream buffer footprint to the debugger afterwards.
+pub(super) fn with_audio_reporting<R>(
+    context_id: GoudContextId,
+    op: impl FnOnce(&mut AudioManager) -> GoudResult<R>,
+) -> Option<R> {
+    let result = with_audio_mut(context_id, |audio| {
+        let result = op(audio);
+        (result, audio.memory_bytes())
+    });
+    match result {
+        Ok((result, bytes)) => {
+            let _ = debugger::update_memory_category_for_context(context_id, "audio", bytes);
+            result.map_err(set_last_error).ok()
+        }
+        Err(()) => None,
+    }
+}
+
+/// Decodes audio bytes once and caches them as a clip.
+///
+/// # Arguments
+///
+/// * `context_id` - Engine context handle
+/// * `asset_data` - Pointer to encoded audio file bytes (WAV/OGG/MP3/FLAC)
+/// * `asset_len` - Length of the audio data in bytes
+///
+/// # Returns
+///
+/// A positive clip ID on success, or a negative value on error.
+///
+/// # Ownership
+///
+/// The caller retains ownership of `asset_data`. The engine copies
+/// the bytes internally.
+///
+/// # Safety
+///
+/// `asset_data` must point to at least `asset_len` valid bytes, or be null
+/// (which triggers an error return).
+#[no_mangle]
+pub unsafe extern "C" fn goud_audio_clip_load(
+    context_id: GoudContextId,
+    asset_data: *const u8,
+    asset_len: usize,
+) -> i64 {
+    if asset_data.is_null() {
+        set_last_error(GoudError::InvalidState(
+            "asset_data pointer is null".to_string(),
+        ));
+        return ERR_AUDIO;
+    }
+
+    // SAFETY: Caller guarantees asset_data points to asset_len valid bytes.
+    let bytes = unsafe { std::slice::from_raw_parts(asset_data, asset_len) }.to_vec();
+    match with_audio_reporting(context_id, |audio| audio.load_clip(bytes)) {
+        Some(clip_id) => clip_id as i64,
+        None => ERR_AUDIO,
+    }
+}
+
+/// Unloads a clip.  Players already started from it keep playing.
+///
+/// # Returns
+///
+/// `0` on success, `-1` on error (including an unknown clip ID).
+#[no_mangle]
+pub extern "C" fn goud_audio_clip_unload(context_id: GoudContextId, clip_id: u64) -> i32 {
+    let removed = with_audio_reporting(context_id, |audio| {
+        if audio.unload_clip(clip_id) {
+            Ok(())
+        } else {
+            Err(GoudError::InvalidHandle)
+        }
+    });
+    match removed {
+        Some(()) => 0,
+        None => ERR_I32,
+    }
+}
+
+/// Plays a cached clip with full control over volume, speed, looping, and
+/// channel.
+///
+/// # Arguments
+///
+/// * `context_id` - Engine context handle
+/// * `clip_id` - ID returned from `goud_audio_clip_load`
+/// * `volume` - Individual volume multiplier (0.0-1.0, clamped)
+/// * `speed` - Playback speed multiplier (0.1-10.0, affects pitch)
+/// * `looping` - Whether to loop indefinitely
+/// * `channel` - Audio channel ID (0=Music, 1=SFX, 2=Voice, 3=Ambience,
+///   4=UI, 5+=Custom)
+///
+/// # Returns
+///
+/// A positive player ID on success, or a negative value on error.
+#[no_mangle]
+pub extern "C" fn goud_audio_clip_play(
+    context_id: GoudContextId,
+    clip_id: u64,
+    volume: f32,
+    speed: f32,
+    looping: bool,
+    channel: u8,
+) -> i64 {
+    let ch = AudioChannel::from_id(channel);
+    match with_audio_reporting(context_id, |audio| {
+        audio.play_clip(clip_id, volume, speed, looping, ch)
+    }) {
+        Some(player_id) => player_id as i64,
+        None => ERR_AUDIO,
+    }
+}
+
+/// Plays a cached clip on the SFX channel with spatial attenuation in 3D.
+///
+/// Returns a positive player ID on success and `-1` on failure.
+#[no_mangle]
+pub extern "C" fn goud_audio_clip_play_spatial_3d(
+    context_id: GoudContextId,
+    clip_id: u64,
+    source_x: f32,
+    source_y: f32,
+    source_z: f32,
+    listener_x: f32,
+    listener_y: f32,
+    listener_z: f32,
+    max_distance: f32,
+    rolloff: f32,
+) -> i64 {
+    match with_audio_reporting(context_id, |audio| {
+        audio.play_clip_spatial(
+            clip_id,
+            [source_x, source_y, source_z],
+            [listener_x, listener_y, listener_z],
+            max_distance,
+            rolloff,
+        )
+    }) {
+        Some(player_id) => player_id as i64,
+        None => ERR_AUDIO,
+    }
+}
+
+/// Sets the byte budget for decoded clip PCM.
+///
+/// Least-recently-played clips are evicted until the cache fits; they stay
+/// loaded and are decoded again on their next play.  A budget of 0 keeps
+/// no PCM between plays.
+///
+/// # Returns
+///
+/// `0` on success, `-1` on error.
+#[no_mangle]
+pub extern "C" fn goud_audio_clip_cache_set_budget(
+    context_id: GoudContextId,
+    budget_bytes: u64,
+) -> i32 {
+    match with_audio_reporting(context_id, |audio| {
+        audio.set_clip_budget(budget_bytes);
+        Ok(())
+    }) {
+        Some(()) => 0,
+        None => ERR_I32,
+    }
+}
+
+/// Writes the clip cache's occupancy, hit, and eviction counters.
+///
+/// # Returns
+///
+/// `0` on success, `-1` on error.
+///
+/// # Safety
+///
+/// `out_stats` must be a valid pointer to writable memory.
+#[no_mangle]
+pub unsafe extern "C" fn goud_audio_clip_cache_get_stats(
+    context_id: GoudContextId,
+    out_stats: *mut FfiAudioClipCacheStats,
+) -> i32 {
+    if out_stats.is_null() {
+        set_last_error(GoudError::InvalidState(
+            "out_stats pointer is null".to_string(),
+        ));
+        return ERR_I32;
+    }
+
+    match with_audio(context_id, AudioManager::clip_stats) {
+        Ok(stats) => {
+            // SAFETY: out_stats is non-null and the caller guarantees it is writable.
+            unsafe { *out_stats = stats.into() };
+            0
+        }
+        Err(()) => ERR_I32,
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::core::error::{clear_last_error, last_error_code, ERR_INVALID_CONTEXT};
+    use crate::ffi::context::GOUD_INVALID_CONTEXT_ID;
+
+    #[test]
+    fn test_clip_calls_reject_invalid_context() {
+        clear_last_error();
+        let data = [0u8; 4];
+        // SAFETY: `data` is valid for its length.
+        let loaded =
+            unsafe { goud_audio_clip_load(GOUD_INVALID_CONTEXT_ID, data.as_ptr(), data.len()) };
+        assert_eq!(loaded, ERR_AUDIO);
+        assert_eq!(last_error_code(), ERR_INVALID_CONTEXT);
+
+        assert_eq!(
+            goud_audio_clip_play(GOUD_INVALID_CONTEXT_ID, 1, 1.0, 1.0, false, 1),
+            ERR_AUDIO
+        );
+        assert_eq!(goud_audio_clip_unload(GOUD_INVALID_CONTEXT_ID, 1), ERR_I32);
+        assert_eq!(
+            goud_audio_clip_cache_set_budget(GOUD_INVALID_CONTEXT_ID, 0),
+            ERR_I32
+        );
+
+        let mut stats = FfiAudioClipCacheStats::default();
+        // SAFETY: `stats` is a valid, writable struct.
+        let status =
+            unsafe { goud_audio_clip_cache_get_stats(GOUD_INVALID_CONTEXT_ID, &mut stats) };
+        assert_eq!(status, ERR_I32);
+    }
+
+    #[test]
+    fn test_clip_calls_reject_null_pointers() {
+        // SAFETY: Null pointers are the error path under test.
+        unsafe {
+            assert_eq!(
+                goud_audio_clip_load(GOUD_INVALID_CONTEXT_ID, std::ptr::null(), 4),
+                ERR_AUDIO
+            );
+            assert_eq!(
+                goud_audio_clip_cache_get_stats(GOUD_INVALID_CONTEXT_ID, std::ptr::null_mut()),
+                ERR_I32
+            );
+        }
+    }
+}
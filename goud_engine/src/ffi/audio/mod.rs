@@ -7,14 +7,23 @@
 //!
 //! Split across submodules:
 //! - `playback`: play, play_on_channel, play_with_settings
+//! - `clips`: load a clip once and play it by ID from cached decoded PCM
+//! - `streaming`: stream long tracks from disk, with crossfade and mix
 //! - `controls`: stop, pause, resume, stop_all, volume, queries
 //! - `spatial`: spatial play/update, listener/source positioning, per-player mix,
 //!   timed crossfade, and additive mix helpers
+//! - `spatial_batch`: one-call listener and emitter updates with distance culling
 
+/// FFI functions for decoded clips and the clip cache budget.
+pub mod clips;
 /// FFI functions for playback control, channel/volume state, and playback state queries.
 pub mod controls;
 pub mod playback;
 pub mod spatial;
+/// FFI function applying a frame of spatial emitter updates in one pass.
+pub mod spatial_batch;
+/// FFI functions for tracks streamed from disk.
+pub mod streaming;
 
 /// Error sentinel for functions returning `i64` player IDs.
 const ERR_AUDIO: i64 = -1;
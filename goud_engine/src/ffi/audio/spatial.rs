@@ -1,7 +1,7 @@
 //! Spatial and per-player audio FFI exports.
 
 #[path = "spatial/shared.rs"]
-mod shared;
+pub(super) mod shared;
 
 use crate::core::error::{set_last_error, GoudError};
 use crate::ecs::components::AudioChannel;
@@ -5,7 +5,7 @@ use crate::assets::AudioManager;
 use crate::core::error::{set_last_error, GoudError};
 use crate::ffi::context::{get_context_registry, GoudContextId, GOUD_INVALID_CONTEXT_ID};
 
-pub(super) fn with_audio_mut<R>(
+pub(in crate::ffi::audio) fn with_audio_mut<R>(
     context_id: GoudContextId,
     op: impl FnOnce(&mut AudioManager) -> R,
 ) -> Result<R, ()> {
@@ -43,7 +43,7 @@ pub(super) fn with_audio_mut<R>(
     Ok(op(audio))
 }
 
-pub(super) fn with_audio<R>(
+pub(in crate::ffi::audio) fn with_audio<R>(
     context_id: GoudContextId,
     op: impl FnOnce(&AudioManager) -> R,
 ) -> Result<R, ()> {
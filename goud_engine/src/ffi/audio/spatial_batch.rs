@@ -0,0 +1,152 @@
+//! Batched spatial audio FFI: move every emitter and the listener in one call.
+//!
+//! Updating emitters one by one through `goud_audio_set_source_position`
+//! takes the audio locks and re-attenuates every tracked source per call.
+//! `goud_audio_update_spatial_sources` applies a whole frame of updates in
+//! one pass and culls emitters beyond their `max_distance` from the mixer.
+
+use crate::assets::SpatialSourceUpdate;
+use crate::core::error::{set_last_error, GoudError};
+use crate::ffi::context::GoudContextId;
+
+use super::spatial::shared::with_audio;
+use super::ERR_I32;
+
+/// One emitter's position and attenuation for
+/// `goud_audio_update_spatial_sources`.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default)]
+pub struct FfiSpatialSourceUpdate {
+    /// Player ID of the emitter's sink.
+    pub player_id: u64,
+    /// Source position X.
+    pub x: f32,
+    /// Source position Y.
+    pub y: f32,
+    /// Source position Z (0 for 2D).
+    pub z: f32,
+    /// Distance at which the source is silent.
+    pub max_distance: f32,
+    /// Attenuation curve exponent.
+    pub rolloff: f32,
+    /// Volume before attenuation (0.0-1.0, clamped).
+    pub volume: f32,
+}
+
+impl From<&FfiSpatialSourceUpdate> for SpatialSourceUpdate {
+    fn from(value: &FfiSpatialSourceUpdate) -> Self {
+        Self {
+            sink_id: value.player_id,
+            source_position: [value.x, value.y, value.z],
+            max_distance: value.max_distance,
+            rolloff: value.rolloff,
+            base_volume: value.volume,
+        }
+    }
+}
+
+/// Sets the listener and applies `count` emitter updates in one pass.
+///
+/// Updates for players that are not active are skipped.  Emitters beyond
+/// their `max_distance` are paused so the mixer skips them and resume when
+/// back in range; `goud_audio_is_playing` still reports them as playing.
+///
+/// # Returns
+///
+/// The number of updates applied, or `-1` on error.
+///
+/// # Safety
+///
+/// `updates` must point to `count` valid updates, or may be null when
+/// `count` is 0.
+#[no_mangle]
+pub unsafe extern "C" fn goud_audio_update_spatial_sources(
+    context_id: GoudContextId,
+    listener_x: f32,
+    listener_y: f32,
+    listener_z: f32,
+    updates: *const FfiSpatialSourceUpdate,
+    count: u32,
+) -> i32 {
+    let updates = if count == 0 {
+        &[][..]
+    } else if updates.is_null() {
+        set_last_error(GoudError::InvalidState(
+            "updates pointer is null".to_string(),
+        ));
+        return ERR_I32;
+    } else {
+        // SAFETY: Caller guarantees `updates` points to `count` valid updates.
+        unsafe { std::slice::from_raw_parts(updates, count as usize) }
+    };
+
+    match with_audio(context_id, |audio| {
+        audio.update_spatial_sources(
+            [listener_x, listener_y, listener_z],
+            updates.iter().map(SpatialSourceUpdate::from),
+        )
+    }) {
+        Ok(applied) => applied.min(i32::MAX as usize) as i32,
+        Err(()) => ERR_I32,
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::core::error::{clear_last_error, last_error_code, ERR_INVALID_CONTEXT};
+    use crate::ffi::context::GOUD_INVALID_CONTEXT_ID;
+
+    #[test]
+    fn test_update_spatial_sources_rejects_invalid_input() {
+        clear_last_error();
+        let updates = [FfiSpatialSourceUpdate::default(); 2];
+        // SAFETY: `updates` is valid for its length; null with a non-zero
+        // count is the error path under test.
+        unsafe {
+            assert_eq!(
+                goud_audio_update_spatial_sources(
+                    GOUD_INVALID_CONTEXT_ID,
+                    0.0,
+                    0.0,
+                    0.0,
+                    updates.as_ptr(),
+                    2
+                ),
+                ERR_I32
+            );
+            assert_eq!(last_error_code(), ERR_INVALID_CONTEXT);
+            assert_eq!(
+                goud_audio_update_spatial_sources(
+                    GOUD_INVALID_CONTEXT_ID,
+                    0.0,
+                    0.0,
+                    0.0,
+                    std::ptr::null(),
+                    2
+                ),
+                ERR_I32
+            );
+        }
+    }
+
+    #[test]
+    fn test_update_converts_to_engine_layout() {
+        let ffi = FfiSpatialSourceUpdate {
+            player_id: 9,
+            x: 1.0,
+            y: 2.0,
+            z: 3.0,
+            max_distance: 50.0,
+            rolloff: 2.0,
+            volume: 0.5,
+        };
+        let update = SpatialSourceUpdate::from(&ffi);
+        assert_eq!(update.sink_id, 9);
+        assert_eq!(update.source_position, [1.0, 2.0, 3.0]);
+        assert_eq!(update.max_distance, 50.0);
+        assert_eq!(update.rolloff, 2.0);
+        assert_eq!(update.base_volume, 0.5);
+        assert_eq!(std::mem::size_of::<FfiSpatialSourceUpdate>(), 32);
+    }
+}
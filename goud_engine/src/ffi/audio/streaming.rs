@@ -0,0 +1,261 @@
+//! Streamed music FFI: play long tracks from disk without loading them.
+//!
+//! `goud_audio_play*` take the whole encoded file from the caller, which
+//! keeps a long track in memory twice.  `goud_audio_stream_*` take a file
+//! path instead: the engine reads and decodes the file on a background
+//! thread as it plays, buffering only a few hundred milliseconds of decoded
+//! audio per stream.  Streamed players are ordinary player IDs, so they
+//! also work as the source of `goud_audio_crossfade_to` and the primary of
+//! `goud_audio_mix_with`.
+
+use std::ffi::CStr;
+use std::os::raw::c_char;
+use std::path::Path;
+
+use crate::assets::{AudioManager, AudioStreamStats};
+use crate::core::error::{set_last_error, GoudError, GoudResult};
+use crate::ecs::components::AudioChannel;
+use crate::ffi::context::GoudContextId;
+
+use super::clips::with_audio_reporting;
+use super::spatial::shared::with_audio;
+use super::{ERR_AUDIO, ERR_I32};
+
+/// FFI-safe audio stream counters.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default)]
+pub struct FfiAudioStreamStats {
+    /// Streams whose decoder thread is still running.
+    pub active_streams: u64,
+    /// Decoded-audio buffers the active streams can hold at most.
+    pub buffer_bytes: u64,
+    /// Times playback found a stream's queue empty and played silence.
+    pub underruns: u64,
+}
+
+impl From<AudioStreamStats> for FfiAudioStreamStats {
+    fn from(value: AudioStreamStats) -> Self {
+        Self {
+            active_streams: value.active_streams,
+            buffer_bytes: value.buffer_bytes,
+            underruns: value.underruns,
+        }
+    }
+}
+
+/// # Safety
+/// `path` must be null or a valid null-terminated C string.
+unsafe fn path_from_raw<'a>(path: *const c_char) -> Result<&'a Path, ()> {
+    if path.is_null() {
+        set_last_error(GoudError::InvalidState("path pointer is null".to_string()));
+        return Err(());
+    }
+    // SAFETY: Caller guarantees `path` is a valid null-terminated C string.
+    match unsafe { CStr::from_ptr(path) }.to_str() {
+        Ok(path) => Ok(Path::new(path)),
+        Err(_) => {
+            set_last_error(GoudError::InvalidState(
+                "path is not valid UTF-8".to_string(),
+            ));
+            Err(())
+        }
+    }
+}
+
+fn player_or_error(
+    context_id: GoudContextId,
+    op: impl FnOnce(&mut AudioManager) -> GoudResult<u64>,
+) -> i64 {
+    match with_audio_reporting(context_id, op) {
+        Some(player_id) => player_id as i64,
+        None => ERR_AUDIO,
+    }
+}
+
+/// Streams an audio file from disk.
+///
+/// # Arguments
+///
+/// * `context_id` - Engine context handle
+/// * `path` - Null-terminated UTF-8 path to a WAV/OGG/MP3/FLAC file
+/// * `volume` - Individual volume multiplier (0.0-1.0, clamped)
+/// * `looping` - Whether to restart from the beginning at the end
+/// * `channel` - Audio channel ID (0=Music, 1=SFX, 2=Voice, 3=Ambience,
+///   4=UI, 5+=Custom)
+///
+/// # Returns
+///
+/// A positive player ID on success, or a negative value on error.
+///
+/// # Safety
+///
+/// `path` must be a valid null-terminated C string.
+#[no_mangle]
+pub unsafe extern "C" fn goud_audio_stream_play(
+    context_id: GoudContextId,
+    path: *const c_char,
+    volume: f32,
+    looping: bool,
+    channel: u8,
+) -> i64 {
+    // SAFETY: Caller guarantees `path` is a valid null-terminated C string.
+    let Ok(path) = (unsafe { path_from_raw(path) }) else {
+        return ERR_AUDIO;
+    };
+    player_or_error(context_id, |audio| {
+        audio.play_stream(path, volume, looping, AudioChannel::from_id(channel))
+    })
+}
+
+/// Starts a timed crossfade from an active sink to a newly streamed file.
+///
+/// Advance it with `goud_audio_update_crossfades`, as for
+/// `goud_audio_crossfade_to`.
+///
+/// Returns a positive destination player ID on success and `-1` on failure.
+///
+/// # Safety
+///
+/// `path` must be a valid null-terminated C string.
+#[no_mangle]
+pub unsafe extern "C" fn goud_audio_stream_crossfade_to(
+    context_id: GoudContextId,
+    from_player_id: u64,
+    path: *const c_char,
+    duration_sec: f32,
+    looping: bool,
+    channel: u8,
+) -> i64 {
+    // SAFETY: Caller guarantees `path` is a valid null-terminated C string.
+    let Ok(path) = (unsafe { path_from_raw(path) }) else {
+        return ERR_AUDIO;
+    };
+    player_or_error(context_id, |audio| {
+        audio.crossfade_to_stream(
+            from_player_id,
+            path,
+            duration_sec,
+            looping,
+            AudioChannel::from_id(channel),
+        )
+    })
+}
+
+/// Layers a streamed file on top of an active primary sink.
+///
+/// Returns a positive secondary player ID on success and `-1` on failure.
+///
+/// # Safety
+///
+/// `path` must be a valid null-terminated C string.
+#[no_mangle]
+pub unsafe extern "C" fn goud_audio_stream_mix_with(
+    context_id: GoudContextId,
+    primary_player_id: u64,
+    path: *const c_char,
+    secondary_volume: f32,
+    looping: bool,
+    secondary_channel: u8,
+) -> i64 {
+    // SAFETY: Caller guarantees `path` is a valid null-terminated C string.
+    let Ok(path) = (unsafe { path_from_raw(path) }) else {
+        return ERR_AUDIO;
+    };
+    player_or_error(context_id, |audio| {
+        audio.mix_with_stream(
+            primary_player_id,
+            path,
+            secondary_volume,
+            looping,
+            AudioChannel::from_id(secondary_channel),
+        )
+    })
+}
+
+/// Writes the active stream count, buffer footprint, and underrun counter.
+///
+/// # Returns
+///
+/// `0` on success, `-1` on error.
+///
+/// # Safety
+///
+/// `out_stats` must be a valid pointer to writable memory.
+#[no_mangle]
+pub unsafe extern "C" fn goud_audio_stream_get_stats(
+    context_id: GoudContextId,
+    out_stats: *mut FfiAudioStreamStats,
+) -> i32 {
+    if out_stats.is_null() {
+        set_last_error(GoudError::InvalidState(
+            "out_stats pointer is null".to_string(),
+        ));
+        return ERR_I32;
+    }
+
+    match with_audio(context_id, AudioManager::stream_stats) {
+        Ok(stats) => {
+            // SAFETY: out_stats is non-null and the caller guarantees it is writable.
+            unsafe { *out_stats = stats.into() };
+            0
+        }
+        Err(()) => ERR_I32,
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::core::error::{clear_last_error, last_error_code, ERR_INVALID_CONTEXT};
+    use crate::ffi::context::GOUD_INVALID_CONTEXT_ID;
+
+    #[test]
+    fn test_stream_calls_reject_invalid_context() {
+        clear_last_error();
+        let path = std::ffi::CString::new("music/theme.ogg").unwrap();
+        // SAFETY: `path` is a valid C string.
+        unsafe {
+            assert_eq!(
+                goud_audio_stream_play(GOUD_INVALID_CONTEXT_ID, path.as_ptr(), 1.0, true, 0),
+                ERR_AUDIO
+            );
+            assert_eq!(last_error_code(), ERR_INVALID_CONTEXT);
+            assert_eq!(
+                goud_audio_stream_crossfade_to(
+                    GOUD_INVALID_CONTEXT_ID,
+                    1,
+                    path.as_ptr(),
+                    2.0,
+                    true,
+                    0
+                ),
+                ERR_AUDIO
+            );
+            assert_eq!(
+                goud_audio_stream_mix_with(GOUD_INVALID_CONTEXT_ID, 1, path.as_ptr(), 0.5, true, 0),
+                ERR_AUDIO
+            );
+
+            let mut stats = FfiAudioStreamStats::default();
+            assert_eq!(
+                goud_audio_stream_get_stats(GOUD_INVALID_CONTEXT_ID, &mut stats),
+                ERR_I32
+            );
+        }
+    }
+
+    #[test]
+    fn test_stream_calls_reject_null_pointers() {
+        // SAFETY: Null pointers are the error path under test.
+        unsafe {
+            assert_eq!(
+                goud_audio_stream_play(GOUD_INVALID_CONTEXT_ID, std::ptr::null(), 1.0, false, 0),
+                ERR_AUDIO
+            );
+            assert_eq!(
+                goud_audio_stream_get_stats(GOUD_INVALID_CONTEXT_ID, std::ptr::null_mut()),
+                ERR_I32
+            );
+        }
+    }
+}
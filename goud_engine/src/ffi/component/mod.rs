@@ -91,6 +91,7 @@ mod batch;
 mod ops;
 mod query;
 mod registry;
+mod snapshot;
 mod storage;
 
 // Re-export all public FFI functions so callers using `crate::ffi::component::*`
@@ -101,7 +102,10 @@ pub use ops::{goud_component_add, goud_component_register_type, goud_component_r
 pub use query::{goud_component_count, goud_component_get_all, goud_component_get_entities};
 
 // Entity despawn purges this layer's component storage (see ffi::entity::lifecycle).
-pub(crate) use storage::purge_context_entity;
+pub(crate) use snapshot::{
+    can_restore_context_components, restore_context_components, save_context_components,
+};
+pub(crate) use storage::{clone_context_entity, purge_context_entity};
 
 #[cfg(test)]
 mod ffi_tests;
@@ -0,0 +1,188 @@
+//! Packed snapshots of a context's FFI component storages.
+//!
+//! Mirrors `component_ops::snapshot` for the storages behind the
+//! `goud_component_*` exports and shares its snapshot types, so a world
+//! snapshot holds both kinds of raw components in the same format.
+
+use std::alloc::dealloc;
+
+use crate::component_ops::{RawColumnSnapshot, RawComponentSnapshot};
+use crate::core::error::{set_last_error, GoudError};
+use crate::ffi::GoudContextId;
+
+use super::storage::{
+    context_key, get_context_storage_map, ContextComponentStorage, RawComponentStorage,
+};
+
+impl RawComponentStorage {
+    /// Packs this storage into `column`.
+    fn save_into(&self, type_id_hash: u64, column: &mut RawColumnSnapshot) {
+        column.type_id_hash = type_id_hash;
+        column.component_size = self.component_size;
+        column.component_align = self.component_align;
+        column.entities.clone_from(&self.dense);
+        column.bytes.clear();
+        column.bytes.reserve(self.data.len() * self.component_size);
+        for &ptr in &self.data {
+            // SAFETY: every pointer in `data` was allocated in `insert` with
+            // room for `component_size` initialized bytes.
+            let bytes = unsafe { std::slice::from_raw_parts(ptr, self.component_size) };
+            column.bytes.extend_from_slice(bytes);
+        }
+    }
+
+    /// Frees every component, keeping the storage's buffers.
+    fn clear(&mut self) {
+        let layout = self.layout();
+        for ptr in self.data.drain(..) {
+            if !ptr.is_null() {
+                // SAFETY: ptr was allocated with this layout in `insert`.
+                unsafe { dealloc(ptr, layout) };
+            }
+        }
+        self.dense.clear();
+        self.sparse.fill(None);
+    }
+
+    /// Overwrites this storage with `column`, in place when it still holds
+    /// the same entities so earlier component pointers stay valid.
+    ///
+    /// Returns false if an allocation fails while rebuilding.
+    fn restore_from(&mut self, column: &RawColumnSnapshot) -> bool {
+        let size = self.component_size;
+        debug_assert_eq!(column.bytes.len(), column.entities.len() * size);
+        if self.dense == column.entities {
+            if size > 0 {
+                for (bytes, &ptr) in column.bytes.chunks_exact(size).zip(&self.data) {
+                    // SAFETY: `ptr` has room for `size` bytes and `bytes` holds
+                    // exactly `size`; snapshot buffers never alias storage.
+                    unsafe { std::ptr::copy_nonoverlapping(bytes.as_ptr(), ptr, size) };
+                }
+            }
+            return true;
+        }
+
+        self.clear();
+        column.entities.iter().enumerate().all(|(i, &bits)| {
+            // SAFETY: `bytes` holds `size` initialized bytes for each entity.
+            unsafe { self.insert(bits, column.bytes.as_ptr().add(i * size)) }
+        })
+    }
+}
+
+impl ContextComponentStorage {
+    /// Packs every storage into `snapshot`, ordered by type ID.
+    fn save_into(&self, snapshot: &mut RawComponentSnapshot) {
+        let mut type_ids: Vec<u64> = self.storages.keys().copied().collect();
+        type_ids.sort_unstable();
+        snapshot
+            .columns
+            .resize_with(type_ids.len(), RawColumnSnapshot::default);
+        for (column, type_id_hash) in snapshot.columns.iter_mut().zip(type_ids) {
+            self.storages[&type_id_hash].save_into(type_id_hash, column);
+        }
+    }
+
+    /// Returns true if every storage `snapshot` holds either does not exist
+    /// yet or still has the size and alignment it was saved with.
+    fn layouts_match(&self, snapshot: &RawComponentSnapshot) -> bool {
+        snapshot.columns.iter().all(|column| {
+            self.storages
+                .get(&column.type_id_hash)
+                .is_none_or(|storage| {
+                    storage.component_size == column.component_size
+                        && storage.component_align == column.component_align
+                })
+        })
+    }
+
+    /// Overwrites every storage with `snapshot`, emptying the ones it does
+    /// not hold. Changes nothing and returns false on a layout mismatch.
+    fn restore_from(&mut self, snapshot: &RawComponentSnapshot) -> bool {
+        if !self.layouts_match(snapshot) {
+            return false;
+        }
+
+        for (type_id_hash, storage) in &mut self.storages {
+            if !snapshot
+                .columns
+                .iter()
+                .any(|column| column.type_id_hash == *type_id_hash)
+            {
+                storage.clear();
+            }
+        }
+        let mut restored = true;
+        for column in &snapshot.columns {
+            restored &= self
+                .get_or_create_storage(
+                    column.type_id_hash,
+                    column.component_size,
+                    column.component_align,
+                )
+                .restore_from(column);
+        }
+        restored
+    }
+}
+
+fn storage_lock_failed() -> bool {
+    set_last_error(GoudError::InternalError(
+        "Failed to access component storage".to_string(),
+    ));
+    false
+}
+
+/// Saves a context's FFI components. A context without storage saves as
+/// empty. Returns false if the storage map cannot be locked.
+pub(crate) fn save_context_components(
+    context_id: GoudContextId,
+    snapshot: &mut RawComponentSnapshot,
+) -> bool {
+    let Some(storage_map) = get_context_storage_map() else {
+        return storage_lock_failed();
+    };
+    match storage_map
+        .as_ref()
+        .and_then(|map| map.get(&context_key(context_id)))
+    {
+        Some(context_storage) => context_storage.save_into(snapshot),
+        None => snapshot.columns.clear(),
+    }
+    true
+}
+
+/// Returns true if [`restore_context_components`] would accept `snapshot`,
+/// without changing anything. Returns false if the storage map cannot be
+/// locked.
+pub(crate) fn can_restore_context_components(
+    context_id: GoudContextId,
+    snapshot: &RawComponentSnapshot,
+) -> bool {
+    let Some(storage_map) = get_context_storage_map() else {
+        return storage_lock_failed();
+    };
+    storage_map
+        .as_ref()
+        .and_then(|map| map.get(&context_key(context_id)))
+        .is_none_or(|context_storage| context_storage.layouts_match(snapshot))
+}
+
+/// Restores a context's FFI components.
+///
+/// Returns false if the storage map cannot be locked or a component layout
+/// changed since the save.
+pub(crate) fn restore_context_components(
+    context_id: GoudContextId,
+    snapshot: &RawComponentSnapshot,
+) -> bool {
+    let Some(mut storage_map) = get_context_storage_map() else {
+        return storage_lock_failed();
+    };
+    let map = storage_map.get_or_insert_with(Default::default);
+    let key = context_key(context_id);
+    if snapshot.columns.is_empty() && !map.contains_key(&key) {
+        return true;
+    }
+    map.entry(key).or_default().restore_from(snapshot)
+}
@@ -31,20 +31,20 @@ use crate::ffi::GoudContextId;
 #[derive(Debug)]
 pub(super) struct RawComponentStorage {
     /// Maps entity index to position in dense array.
-    sparse: Vec<Option<usize>>,
+    pub(super) sparse: Vec<Option<usize>>,
 
     /// Packed array of entities that have components.
-    dense: Vec<u64>, // Store entity bits for FFI compatibility
+    pub(super) dense: Vec<u64>, // Store entity bits for FFI compatibility
 
     /// Packed array of raw component data.
     /// Each entry is a pointer to heap-allocated bytes.
-    data: Vec<*mut u8>,
+    pub(super) data: Vec<*mut u8>,
 
     /// Size of each component in bytes.
-    component_size: usize,
+    pub(super) component_size: usize,
 
     /// Alignment of each component.
-    component_align: usize,
+    pub(super) component_align: usize,
 }
 
 // SAFETY: RawComponentStorage is Send because:
@@ -85,7 +85,7 @@ impl RawComponentStorage {
     }
 
     /// Creates the memory layout for a single component.
-    fn layout(&self) -> Layout {
+    pub(super) fn layout(&self) -> Layout {
         // Handle zero-sized types
         if self.component_size == 0 {
             Layout::from_size_align(1, 1).unwrap()
@@ -153,6 +153,34 @@ impl RawComponentStorage {
         }
     }
 
+    /// Copies the component of `source_bits` to every entity in `targets`.
+    ///
+    /// Returns false if `source_bits` has no component here or an
+    /// allocation fails.
+    pub(super) fn clone_to_many(&mut self, source_bits: u64, targets: &[u64]) -> bool {
+        let Some(dense_index) = self.resolve(source_bits) else {
+            return false;
+        };
+        let mut bytes = vec![0u8; self.component_size];
+        if self.component_size > 0 {
+            // SAFETY: `data[dense_index]` was allocated in `insert` with room
+            // for `component_size` bytes, and `bytes` has the same length.
+            unsafe {
+                std::ptr::copy_nonoverlapping(
+                    self.data[dense_index],
+                    bytes.as_mut_ptr(),
+                    self.component_size,
+                );
+            }
+        }
+        self.dense.reserve(targets.len());
+        self.data.reserve(targets.len());
+        targets.iter().all(|&target| {
+            // SAFETY: `bytes` holds `component_size` initialized bytes.
+            unsafe { self.insert(target, bytes.as_ptr()) }
+        })
+    }
+
     /// Removes a component from the given entity.
     ///
     /// Returns true if the component was removed, false if the entity didn't have one.
@@ -260,7 +288,7 @@ impl Drop for RawComponentStorage {
 #[derive(Debug, Default)]
 pub(super) struct ContextComponentStorage {
     /// Maps type_id_hash to raw component storage
-    storages: HashMap<u64, RawComponentStorage>,
+    pub(super) storages: HashMap<u64, RawComponentStorage>,
 }
 
 impl ContextComponentStorage {
@@ -298,6 +326,14 @@ impl ContextComponentStorage {
             storage.remove(entity_bits);
         }
     }
+
+    /// Copies every component of `source_bits` to each entity in `targets`,
+    /// one storage at a time.
+    pub(super) fn clone_entity(&mut self, source_bits: u64, targets: &[u64]) {
+        for storage in self.storages.values_mut() {
+            storage.clone_to_many(source_bits, targets);
+        }
+    }
 }
 
 /// Purges an entity's components from the given context's storage. Called from
@@ -312,6 +348,19 @@ pub(crate) fn purge_context_entity(context_id: GoudContextId, entity_bits: u64)
     }
 }
 
+/// Copies an entity's components in the given context's storage to each of
+/// `targets`. Called from the prefab instantiation FFI. A no-op if the context
+/// has no component storage.
+pub(crate) fn clone_context_entity(context_id: GoudContextId, source_bits: u64, targets: &[u64]) {
+    if let Some(mut storage_map) = get_context_storage_map() {
+        if let Some(map) = storage_map.as_mut() {
+            if let Some(context_storage) = map.get_mut(&context_key(context_id)) {
+                context_storage.clone_entity(source_bits, targets);
+            }
+        }
+    }
+}
+
 /// Global storage for per-context component data.
 ///
 /// Maps context ID (as u64) to component storage for that context.
@@ -0,0 +1,60 @@
+//! # Thread Isolation FFI Functions
+//!
+//! Entry points that let a worker thread own a private context registry, so
+//! many headless contexts can be ticked on parallel threads without sharing
+//! the process-wide context registry lock. The other FFI registries
+//! (physics, spatial, pool, networking, component storage) are not sharded.
+
+use crate::context_registry::isolation;
+use crate::core::error::set_last_error;
+
+/// Gives the calling thread a private context registry.
+///
+/// Contexts this thread creates afterwards live in that registry: FFI calls
+/// that take one of their IDs look the context up under this thread's
+/// registry lock instead of the process-wide one, and the IDs fail
+/// validation on any other thread. Subsystem registries such as physics
+/// and networking are still process-wide. Contexts the thread created
+/// before isolating become unreachable from it, so call this first.
+/// Calling it again on an isolated thread does nothing.
+///
+/// # Returns
+///
+/// 0 on success, negative error code when no registry shard is free.
+#[no_mangle]
+pub extern "C" fn goud_context_isolate_thread() -> i32 {
+    match isolation::isolate_current_thread() {
+        Ok(()) => 0,
+        Err(err) => {
+            let code = err.error_code();
+            set_last_error(err);
+            code
+        }
+    }
+}
+
+/// Returns the calling thread to the process-wide context registry.
+///
+/// Threads that exit while isolated release their registry automatically.
+///
+/// # Returns
+///
+/// 0 on success, negative error code while contexts created on this thread
+/// since [`goud_context_isolate_thread`] are still alive.
+#[no_mangle]
+pub extern "C" fn goud_context_release_thread() -> i32 {
+    match isolation::release_current_thread() {
+        Ok(()) => 0,
+        Err(err) => {
+            let code = err.error_code();
+            set_last_error(err);
+            code
+        }
+    }
+}
+
+/// Returns `true` if the calling thread has a private context registry.
+#[no_mangle]
+pub extern "C" fn goud_context_thread_is_isolated() -> bool {
+    isolation::is_current_thread_isolated()
+}
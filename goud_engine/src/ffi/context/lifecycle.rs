@@ -134,6 +134,8 @@ pub unsafe extern "C" fn goud_context_create_with_config(
 pub extern "C" fn goud_context_destroy(context_id: GoudContextId) -> bool {
     // Clean up provider registry before destroying the context.
     crate::ffi::providers::provider_registry_remove(context_id);
+    #[cfg(feature = "native")]
+    crate::ffi::debug::cleanup_metrics_state(context_id);
     Context::destroy(context_id)
 }
 
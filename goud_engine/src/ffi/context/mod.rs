@@ -14,10 +14,14 @@ pub use crate::context_registry::{
 
 #[cfg(test)]
 mod debugger_tests;
+mod isolation;
 mod lifecycle;
 #[cfg(test)]
 mod tests;
 
+pub use isolation::{
+    goud_context_isolate_thread, goud_context_release_thread, goud_context_thread_is_isolated,
+};
 pub use lifecycle::{
     goud_context_create, goud_context_create_with_config, goud_context_destroy,
     goud_context_is_valid, GoudContextConfig, GoudDebuggerConfig,
@@ -1,6 +1,8 @@
 //! # Debug Overlay FFI
 //!
 //! FFI functions for querying FPS statistics and controlling the debug overlay.
+//! [`goud_metrics_buffer`] exposes the same counters as a binary block that
+//! other threads can poll without locking.
 
 use crate::core::debugger;
 use crate::core::error::{
@@ -12,6 +14,7 @@ use crate::sdk::debug_overlay::{FpsStats, OverlayCorner, RenderMetrics};
 
 mod debugger_control;
 pub(crate) mod debugger_runtime;
+mod metrics_block;
 
 #[cfg(test)]
 mod debugger_control_tests;
@@ -31,6 +34,11 @@ pub use debugger_runtime::{
     goud_debugger_set_profiling_enabled, goud_debugger_set_selected_entity,
     GoudMemoryCategoryStats, GoudMemorySummary,
 };
+pub(crate) use metrics_block::{cleanup_metrics_state, publish_metrics_if_enabled};
+pub use metrics_block::{
+    goud_metrics_attach_buffer, goud_metrics_buffer, goud_metrics_publish, goud_metrics_read,
+    GoudMetricsBlock, GoudMetricsBuffer, GoudMetricsSlot, GOUD_METRICS_BLOCK_VERSION,
+};
 
 /// Retrieves the current FPS statistics from the debug overlay.
 ///
@@ -0,0 +1,421 @@
+//! # Binary Metrics Block FFI
+//!
+//! A [`GoudMetricsBlock`] carries the counters the JSON debugger exports
+//! report -- render metrics, frame phase timings, the context's frame arena,
+//! FPS, entity count, memory and network totals -- in one fixed-layout
+//! struct.  A context publishes it into a double-buffered
+//! [`GoudMetricsBuffer`] at the end of every rendered frame once the buffer
+//! has been requested, or on demand with [`goud_metrics_publish`].
+//! Publishing formats and allocates nothing, and a reader on any thread (or
+//! in another process, when the buffer is attached to shared memory) copies
+//! the latest block without taking a lock.
+//!
+//! # Read protocol
+//!
+//! `published` counts publishes and the latest block lives in
+//! `slots[published % 2]`.  A slot's `sequence` is odd while the slot is
+//! being written.  A reader loads `published`, loads the slot's `sequence`,
+//! copies the block, then loads `sequence` again; the copy is consistent when
+//! both loads are equal and even.  Publishes alternate slots, so a reader
+//! only retries when it stalls for a whole frame mid-copy.
+//! [`goud_metrics_read`] implements the protocol.
+
+use std::cell::{RefCell, UnsafeCell};
+use std::collections::HashMap;
+use std::ptr;
+use std::sync::atomic::{fence, AtomicU64, Ordering};
+
+use crate::core::debugger;
+use crate::core::error::{set_last_error, GoudError};
+use crate::ffi::arena::FfiArenaStats;
+use crate::ffi::context::{get_context_registry, GoudContextId, GOUD_INVALID_CONTEXT_ID};
+use crate::ffi::network::{network_stats_for_context, FfiNetworkStats};
+use crate::ffi::renderer::metrics::latest_phase_timings;
+use crate::ffi::types::{FfiFramePhaseTimings, FfiRenderMetrics};
+use crate::ffi::window::with_window_state;
+use crate::sdk::debug_overlay::FpsStats;
+
+use super::debugger_runtime::GoudMemorySummary;
+
+/// Layout version written to [`GoudMetricsBuffer::version`].
+pub const GOUD_METRICS_BLOCK_VERSION: u32 = 1;
+
+/// Copies [`goud_metrics_read`] attempts before reporting the buffer busy.
+const READ_ATTEMPTS: u32 = 64;
+
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default)]
+/// One frame's engine counters in a fixed binary layout.
+pub struct GoudMetricsBlock {
+    /// Publish number of this block, starting at 1; 0 before the first publish.
+    pub publish_index: u64,
+    /// Debugger frame index, or 0 when the context has no debugger route.
+    pub frame_index: u64,
+    /// Frame phase timings recorded on the publishing thread.
+    pub phases: FfiFramePhaseTimings,
+    /// The context's frame arena statistics.
+    pub arena: FfiArenaStats,
+    /// Stats of the context's active network handle, or the debugger's byte
+    /// totals when it has none.
+    pub network: FfiNetworkStats,
+    /// Debugger memory category totals.
+    pub memory: GoudMemorySummary,
+    /// Render metrics accumulated for the frame.
+    pub render: FfiRenderMetrics,
+    /// Frame rate statistics.
+    pub fps: FpsStats,
+    /// Alive entities in the context's world.
+    pub entity_count: u32,
+}
+
+#[repr(C)]
+/// One half of a [`GoudMetricsBuffer`].
+pub struct GoudMetricsSlot {
+    /// Odd while the slot is being written, even once it is stable.
+    pub sequence: AtomicU64,
+    /// The block last published into this slot.
+    pub block: UnsafeCell<GoudMetricsBlock>,
+}
+
+#[repr(C)]
+/// Double-buffered metrics block shared between a context and its readers.
+pub struct GoudMetricsBuffer {
+    /// Layout version; [`GOUD_METRICS_BLOCK_VERSION`].
+    pub version: u32,
+    /// Size in bytes of one [`GoudMetricsBlock`].
+    pub block_size: u32,
+    /// Blocks published so far; the latest is in `slots[published % 2]`.
+    pub published: AtomicU64,
+    /// The two block slots.
+    pub slots: [GoudMetricsSlot; 2],
+}
+
+// SAFETY: Only the owning context's thread writes a buffer, and readers only
+// copy blocks out under the sequence check in `read`, which discards copies
+// that overlapped a write.
+unsafe impl Sync for GoudMetricsBuffer {}
+
+impl GoudMetricsBuffer {
+    fn new() -> Self {
+        let slot = || GoudMetricsSlot {
+            sequence: AtomicU64::new(0),
+            block: UnsafeCell::new(GoudMetricsBlock::default()),
+        };
+        Self {
+            version: GOUD_METRICS_BLOCK_VERSION,
+            block_size: std::mem::size_of::<GoudMetricsBlock>() as u32,
+            published: AtomicU64::new(0),
+            slots: [slot(), slot()],
+        }
+    }
+
+    /// Publishes `block` into the slot readers are not expected to be on.
+    ///
+    /// Must only be called from the thread that owns the buffer.
+    fn publish(&self, mut block: GoudMetricsBlock) {
+        let index = self.published.load(Ordering::Relaxed).wrapping_add(1);
+        block.publish_index = index;
+        let slot = &self.slots[(index % 2) as usize];
+        let sequence = slot.sequence.load(Ordering::Relaxed);
+        slot.sequence
+            .store(sequence.wrapping_add(1), Ordering::Relaxed);
+        fence(Ordering::Release);
+        // SAFETY: This thread is the only writer, and readers that overlap
+        // the write see an odd or changed sequence and discard their copy.
+        unsafe { ptr::write_volatile(slot.block.get(), block) };
+        slot.sequence
+            .store(sequence.wrapping_add(2), Ordering::Release);
+        self.published.store(index, Ordering::Release);
+    }
+
+    /// Copies the latest block, or `None` if every attempt raced a write.
+    fn read(&self) -> Option<GoudMetricsBlock> {
+        for _ in 0..READ_ATTEMPTS {
+            let published = self.published.load(Ordering::Acquire);
+            let slot = &self.slots[(published % 2) as usize];
+            let before = slot.sequence.load(Ordering::Acquire);
+            if before % 2 == 0 {
+                // SAFETY: The block is plain data; a torn copy is detected by
+                // the sequence recheck below and never returned.
+                let block = unsafe { ptr::read_volatile(slot.block.get()) };
+                fence(Ordering::Acquire);
+                if slot.sequence.load(Ordering::Relaxed) == before {
+                    return Some(block);
+                }
+            }
+            std::hint::spin_loop();
+        }
+        None
+    }
+}
+
+/// Per-context publishing state.
+struct MetricsState {
+    owned: Box<GoudMetricsBuffer>,
+    /// Caller-provided buffer published instead of `owned`, or null.
+    attached: *mut GoudMetricsBuffer,
+}
+
+impl MetricsState {
+    fn new() -> Self {
+        Self {
+            owned: Box::new(GoudMetricsBuffer::new()),
+            attached: ptr::null_mut(),
+        }
+    }
+
+    fn buffer(&self) -> &GoudMetricsBuffer {
+        if self.attached.is_null() {
+            &self.owned
+        } else {
+            // SAFETY: goud_metrics_attach_buffer requires attached buffers
+            // to outlive the attachment.
+            unsafe { &*self.attached }
+        }
+    }
+}
+
+thread_local! {
+    static METRICS: RefCell<HashMap<(u32, u32), MetricsState>> = RefCell::new(HashMap::new());
+}
+
+fn context_key(context_id: GoudContextId) -> (u32, u32) {
+    (context_id.index(), context_id.generation())
+}
+
+fn report(err: GoudError) -> i32 {
+    let code = err.error_code();
+    set_last_error(err);
+    code
+}
+
+/// Gathers the current counters for one context.
+fn gather_block(context_id: GoudContextId) -> Result<GoudMetricsBlock, GoudError> {
+    let mut block = GoudMetricsBlock {
+        phases: latest_phase_timings(),
+        ..Default::default()
+    };
+    {
+        let registry = get_context_registry()
+            .lock()
+            .map_err(|_| GoudError::InternalError("Failed to lock context registry".to_string()))?;
+        let context = registry.get(context_id).ok_or(GoudError::InvalidContext)?;
+        block.entity_count = context.world().entity_count() as u32;
+        let arena = context.frame_arena().stats();
+        block.arena = FfiArenaStats {
+            bytes_allocated: arena.bytes_allocated as u64,
+            bytes_capacity: arena.bytes_capacity as u64,
+            reset_count: arena.reset_count,
+        };
+    }
+
+    match debugger::metrics_counters_for_context(context_id) {
+        Some(counters) => {
+            let [current_fps, min_fps, max_fps, avg_fps, frame_time_ms] = counters.fps;
+            block.frame_index = counters.frame_index;
+            block.fps = FpsStats {
+                current_fps,
+                min_fps,
+                max_fps,
+                avg_fps,
+                frame_time_ms,
+            };
+            block.render = counters.render_metrics.into();
+            block.memory = counters.memory_summary.into();
+            block.network.bytes_sent = counters.network.bytes_sent;
+            block.network.bytes_received = counters.network.bytes_received;
+        }
+        None => {
+            if let Some(fps) = with_window_state(context_id, |state| state.debug_overlay.stats()) {
+                block.fps = fps;
+            }
+        }
+    }
+    if let Some(network) = network_stats_for_context(context_id) {
+        block.network = network;
+    }
+    Ok(block)
+}
+
+fn publish(context_id: GoudContextId, state: &MetricsState) -> Result<(), GoudError> {
+    let block = gather_block(context_id)?;
+    state.buffer().publish(block);
+    Ok(())
+}
+
+fn ensure_context(context_id: GoudContextId) -> Result<(), GoudError> {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        return Err(GoudError::InvalidContext);
+    }
+    let registry = get_context_registry()
+        .lock()
+        .map_err(|_| GoudError::InternalError("Failed to lock context registry".to_string()))?;
+    registry
+        .get(context_id)
+        .map(|_| ())
+        .ok_or(GoudError::InvalidContext)
+}
+
+/// Returns the buffer a context publishes its metrics into.
+///
+/// The first call enables per-frame publishing from `goud_renderer_end`.
+/// The pointer stays valid until the context is destroyed or a buffer is
+/// attached with [`goud_metrics_attach_buffer`], and may be handed to any
+/// thread for [`goud_metrics_read`].  Call from the context's own thread.
+///
+/// # Returns
+///
+/// The buffer, or null on error.
+#[no_mangle]
+pub extern "C" fn goud_metrics_buffer(context_id: GoudContextId) -> *const GoudMetricsBuffer {
+    if let Err(err) = ensure_context(context_id) {
+        set_last_error(err);
+        return ptr::null();
+    }
+    METRICS.with(|cell| {
+        let mut states = cell.borrow_mut();
+        let state = states
+            .entry(context_key(context_id))
+            .or_insert_with(MetricsState::new);
+        state.buffer() as *const GoudMetricsBuffer
+    })
+}
+
+/// Publishes a context's metrics into caller-provided storage instead.
+///
+/// Lets a process that maps `buffer` from shared memory read the metrics
+/// without calling into the engine.  The buffer header and both slots are
+/// initialised here.  Passing null detaches and resumes publishing into the
+/// context's own buffer.
+///
+/// # Returns
+///
+/// 0 on success, negative error code on failure.
+///
+/// # Safety
+///
+/// A non-null `buffer` must be 8-byte aligned, writable for one
+/// [`GoudMetricsBuffer`], and stay valid until it is detached or the context
+/// is destroyed.  The engine does not take ownership of it.
+#[no_mangle]
+pub unsafe extern "C" fn goud_metrics_attach_buffer(
+    context_id: GoudContextId,
+    buffer: *mut GoudMetricsBuffer,
+) -> i32 {
+    if let Err(err) = ensure_context(context_id) {
+        return report(err);
+    }
+    if buffer as usize % std::mem::align_of::<GoudMetricsBuffer>() != 0 {
+        return report(GoudError::InvalidState(
+            "metrics buffer is not 8-byte aligned".to_string(),
+        ));
+    }
+    if !buffer.is_null() {
+        // SAFETY: Caller guarantees `buffer` is aligned and writable for one
+        // GoudMetricsBuffer; its previous contents are not read.
+        ptr::write(buffer, GoudMetricsBuffer::new());
+    }
+    METRICS.with(|cell| {
+        let mut states = cell.borrow_mut();
+        states
+            .entry(context_key(context_id))
+            .or_insert_with(MetricsState::new)
+            .attached = buffer;
+    });
+    0
+}
+
+/// Gathers and publishes a context's metrics now.
+///
+/// Rendered contexts publish automatically in `goud_renderer_end` once
+/// [`goud_metrics_buffer`] or [`goud_metrics_attach_buffer`] has been
+/// called; headless contexts call this once per tick instead.
+///
+/// # Returns
+///
+/// 0 on success, negative error code on failure.
+#[no_mangle]
+pub extern "C" fn goud_metrics_publish(context_id: GoudContextId) -> i32 {
+    if let Err(err) = ensure_context(context_id) {
+        return report(err);
+    }
+    METRICS.with(|cell| {
+        let mut states = cell.borrow_mut();
+        let state = states
+            .entry(context_key(context_id))
+            .or_insert_with(MetricsState::new);
+        match publish(context_id, state) {
+            Ok(()) => 0,
+            Err(err) => report(err),
+        }
+    })
+}
+
+/// Copies the latest published block out of `buffer` without locking.
+///
+/// Safe to call from any thread.  Before the first publish the copied block
+/// is zeroed, with `publish_index` 0.
+///
+/// # Returns
+///
+/// 0 on success, negative error code if a pointer is null, the buffer was
+/// written by an incompatible engine, or every copy raced a publish.
+///
+/// # Safety
+///
+/// `buffer` must point to a live [`GoudMetricsBuffer`] and `out_block` to
+/// writable storage for one [`GoudMetricsBlock`].
+#[no_mangle]
+pub unsafe extern "C" fn goud_metrics_read(
+    buffer: *const GoudMetricsBuffer,
+    out_block: *mut GoudMetricsBlock,
+) -> i32 {
+    if buffer.is_null() || out_block.is_null() {
+        return report(GoudError::InvalidState(
+            "buffer and out_block must be non-null".to_string(),
+        ));
+    }
+    // SAFETY: Caller guarantees `buffer` points to a live GoudMetricsBuffer.
+    let buffer = &*buffer;
+    if buffer.version != GOUD_METRICS_BLOCK_VERSION
+        || buffer.block_size as usize != std::mem::size_of::<GoudMetricsBlock>()
+    {
+        return report(GoudError::InvalidState(format!(
+            "metrics buffer version {} is not supported",
+            buffer.version
+        )));
+    }
+    match buffer.read() {
+        Some(block) => {
+            // SAFETY: out_block is non-null and points to writable storage for one GoudMetricsBlock.
+            *out_block = block;
+            0
+        }
+        None => report(GoudError::InvalidState(
+            "metrics buffer is being written too often to copy".to_string(),
+        )),
+    }
+}
+
+/// Publishes a context's metrics if its buffer has been requested.
+///
+/// Called from `goud_renderer_end`; contexts nobody monitors pay one map
+/// lookup.
+pub(crate) fn publish_metrics_if_enabled(context_id: GoudContextId) {
+    METRICS.with(|cell| {
+        if let Some(state) = cell.borrow().get(&context_key(context_id)) {
+            let _ = publish(context_id, state);
+        }
+    });
+}
+
+/// Drops a context's metrics buffer.  Attached buffers are left untouched.
+pub(crate) fn cleanup_metrics_state(context_id: GoudContextId) {
+    METRICS.with(|cell| {
+        cell.borrow_mut().remove(&context_key(context_id));
+    });
+}
+
+#[cfg(test)]
+#[path = "metrics_block_tests.rs"]
+mod tests;
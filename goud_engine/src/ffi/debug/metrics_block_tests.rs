@@ -0,0 +1,122 @@
+use super::*;
+use crate::ffi::context::{goud_context_create, goud_context_destroy};
+use crate::ffi::entity::goud_entity_spawn_empty;
+
+fn read(buffer: *const GoudMetricsBuffer) -> GoudMetricsBlock {
+    let mut block = GoudMetricsBlock::default();
+    // SAFETY: `buffer` is a live metrics buffer and `block` is writable.
+    assert_eq!(unsafe { goud_metrics_read(buffer, &mut block) }, 0);
+    block
+}
+
+#[test]
+fn test_publish_alternates_slots_and_counts() {
+    let buffer = GoudMetricsBuffer::new();
+    assert_eq!(buffer.read().unwrap().publish_index, 0);
+
+    for frame in 1..=3_u64 {
+        buffer.publish(GoudMetricsBlock {
+            frame_index: frame * 10,
+            ..Default::default()
+        });
+        let block = buffer.read().unwrap();
+        assert_eq!(block.publish_index, frame);
+        assert_eq!(block.frame_index, frame * 10);
+    }
+    assert_eq!(buffer.published.load(Ordering::Relaxed), 3);
+    assert_eq!(buffer.slots[0].sequence.load(Ordering::Relaxed), 2);
+    assert_eq!(buffer.slots[1].sequence.load(Ordering::Relaxed), 4);
+}
+
+#[test]
+fn test_reader_thread_never_sees_torn_blocks() {
+    let buffer = std::sync::Arc::new(GoudMetricsBuffer::new());
+    let reader = {
+        let buffer = std::sync::Arc::clone(&buffer);
+        std::thread::spawn(move || {
+            let mut last = 0;
+            while last < 2_000 {
+                if let Some(block) = buffer.read() {
+                    assert_eq!(block.frame_index, block.publish_index);
+                    assert_eq!(block.entity_count as u64, block.publish_index % 1000);
+                    assert!(block.publish_index >= last);
+                    last = block.publish_index;
+                }
+            }
+        })
+    };
+    for index in 1..=2_000_u64 {
+        buffer.publish(GoudMetricsBlock {
+            frame_index: index,
+            entity_count: (index % 1000) as u32,
+            ..Default::default()
+        });
+    }
+    reader.join().unwrap();
+}
+
+#[test]
+fn test_publish_reports_context_counters() {
+    let ctx = goud_context_create();
+    goud_entity_spawn_empty(ctx);
+    goud_entity_spawn_empty(ctx);
+
+    let buffer = goud_metrics_buffer(ctx);
+    assert!(!buffer.is_null());
+    assert_eq!(read(buffer).publish_index, 0);
+
+    assert_eq!(goud_metrics_publish(ctx), 0);
+    let block = read(buffer);
+    assert_eq!(block.publish_index, 1);
+    assert_eq!(block.entity_count, 2);
+    assert_eq!(goud_metrics_buffer(ctx), buffer);
+
+    publish_metrics_if_enabled(ctx);
+    assert_eq!(read(buffer).publish_index, 2);
+
+    cleanup_metrics_state(ctx);
+    goud_context_destroy(ctx);
+}
+
+#[test]
+fn test_attached_buffer_receives_publishes() {
+    let ctx = goud_context_create();
+    let mut shared = std::mem::MaybeUninit::<GoudMetricsBuffer>::uninit();
+    // SAFETY: `shared` is aligned, writable and outlives the attachment.
+    assert_eq!(
+        unsafe { goud_metrics_attach_buffer(ctx, shared.as_mut_ptr()) },
+        0
+    );
+    assert_eq!(goud_metrics_buffer(ctx), shared.as_ptr());
+
+    assert_eq!(goud_metrics_publish(ctx), 0);
+    assert_eq!(read(shared.as_ptr()).publish_index, 1);
+
+    // SAFETY: Detaching with null never dereferences the pointer.
+    assert_eq!(
+        unsafe { goud_metrics_attach_buffer(ctx, ptr::null_mut()) },
+        0
+    );
+    assert_eq!(goud_metrics_publish(ctx), 0);
+    assert_eq!(read(shared.as_ptr()).publish_index, 1);
+    assert_eq!(read(goud_metrics_buffer(ctx)).publish_index, 1);
+
+    cleanup_metrics_state(ctx);
+    goud_context_destroy(ctx);
+}
+
+#[test]
+fn test_invalid_arguments_are_rejected() {
+    assert!(goud_metrics_buffer(GOUD_INVALID_CONTEXT_ID).is_null());
+    assert_ne!(goud_metrics_publish(GOUD_INVALID_CONTEXT_ID), 0);
+    publish_metrics_if_enabled(GOUD_INVALID_CONTEXT_ID);
+
+    let mut block = GoudMetricsBlock::default();
+    // SAFETY: Null pointers are rejected before any dereference.
+    assert_ne!(unsafe { goud_metrics_read(ptr::null(), &mut block) }, 0);
+
+    let mut stale = GoudMetricsBuffer::new();
+    stale.version = GOUD_METRICS_BLOCK_VERSION + 1;
+    // SAFETY: `stale` is live and `block` is writable.
+    assert_ne!(unsafe { goud_metrics_read(&stale, &mut block) }, 0);
+}
@@ -313,11 +313,19 @@ pub unsafe extern "C" fn goud_engine_config_set_physics_backend_2d(
     true
 }
 
+/// Window backend value for the windowless headless runtime.
+pub const GOUD_WINDOW_BACKEND_HEADLESS: u32 = 5;
+
+/// Render backend value for the GPU-free null recorder used by headless engines.
+pub const GOUD_RENDER_BACKEND_NULL: u32 = 3;
+
 /// Sets the native render backend used when creating windowed engines.
 ///
 /// Backend values:
 /// - 0: wgpu
 /// - 1: legacy OpenGL
+/// - 2: auto-detect
+/// - 3: null (headless; pair with window backend 5)
 ///
 /// # Safety
 /// `handle` must be a valid `EngineConfig` handle.
@@ -354,6 +362,7 @@ pub unsafe extern "C" fn goud_engine_config_set_render_backend(
 /// Backend values:
 /// - 0: winit
 /// - 1: legacy GLFW
+/// - 5: headless (no window; pair with render backend 3)
 ///
 /// # Safety
 /// `handle` must be a valid `EngineConfig` handle.
@@ -4,7 +4,7 @@ use crate::ecs::InputManager;
 use crate::ffi::context::{get_context_registry, GoudContextId, GOUD_INVALID_CONTEXT_ID};
 use crate::ffi::window::{set_window_state, WindowState};
 use crate::libs::platform::native_runtime::create_native_runtime;
-use crate::libs::platform::WindowConfig;
+use crate::libs::platform::{WindowBackendKind, WindowConfig};
 
 /// Consumes an `EngineConfig` handle and creates a windowed engine context.
 ///
@@ -12,6 +12,10 @@ use crate::libs::platform::WindowConfig;
 /// [`goud_window_create`](crate::ffi::window::goud_window_create)
 /// but uses the configuration from the builder instead of explicit parameters.
 ///
+/// With the headless window backend (5) and null render backend (3) no
+/// window or GPU is opened: the context runs the same frame loop, audio
+/// mixes into a null sink, and draw calls are recorded but not rasterized.
+///
 /// # Ownership
 /// The `handle` is consumed (freed) by this call. The caller must NOT use it
 /// again or call [`super::goud_engine_config_destroy`] on it.
@@ -44,6 +48,7 @@ pub unsafe extern "C" fn goud_engine_create(handle: EngineConfigHandle) -> GoudC
         fullscreen_mode: game_config.fullscreen_mode,
     };
 
+    let headless = game_config.window_backend == WindowBackendKind::Headless;
     let native_runtime = match create_native_runtime(
         &window_config,
         game_config.window_backend,
@@ -71,7 +76,11 @@ pub unsafe extern "C" fn goud_engine_create(handle: EngineConfigHandle) -> GoudC
             ContextConfig {
                 debugger: game_config.debugger.clone(),
             },
-            RuntimeSurfaceKind::WindowedGame,
+            if headless {
+                RuntimeSurfaceKind::HeadlessContext
+            } else {
+                RuntimeSurfaceKind::WindowedGame
+            },
         ) {
             Ok(id) => id,
             Err(e) => {
@@ -95,7 +104,12 @@ pub unsafe extern "C" fn goud_engine_create(handle: EngineConfigHandle) -> GoudC
         if let Some(context) = registry.get_mut(context_id) {
             context.world_mut().insert_resource(InputManager::new());
 
-            if let Ok(am) = crate::assets::AudioManager::new() {
+            let audio = if headless {
+                crate::assets::AudioManager::new_null()
+            } else {
+                crate::assets::AudioManager::new()
+            };
+            if let Ok(am) = audio {
                 context.world_mut().insert_resource(am);
             }
         }
@@ -58,3 +58,59 @@ fn test_engine_create_rejects_mixed_native_backend_pair() {
         .expect("expected error message")
         .contains("invalid native backend pair"),);
 }
+
+#[test]
+fn test_headless_backend_constants_match_backend_kinds() {
+    assert_eq!(
+        WindowBackendKind::from_u32(GOUD_WINDOW_BACKEND_HEADLESS),
+        Some(WindowBackendKind::Headless)
+    );
+    assert_eq!(
+        RenderBackendKind::from_u32(GOUD_RENDER_BACKEND_NULL),
+        Some(RenderBackendKind::Null)
+    );
+}
+
+#[cfg(feature = "native")]
+#[test]
+fn test_engine_create_headless_runs_frames_without_a_window() {
+    use crate::ffi::renderer::{goud_renderer_begin, goud_renderer_end};
+    use crate::ffi::window::{
+        goud_window_destroy, goud_window_get_framebuffer_size, goud_window_poll_events,
+        goud_window_should_close, goud_window_swap_buffers,
+    };
+
+    let handle = goud_engine_config_create();
+    assert!(!handle.is_null());
+
+    // SAFETY: `handle` is valid for all setter calls below.
+    unsafe {
+        assert!(goud_engine_config_set_size(handle, 320, 180));
+        assert!(goud_engine_config_set_window_backend(
+            handle,
+            GOUD_WINDOW_BACKEND_HEADLESS,
+        ));
+        assert!(goud_engine_config_set_render_backend(
+            handle,
+            GOUD_RENDER_BACKEND_NULL,
+        ));
+    }
+
+    // SAFETY: `handle` is consumed by `goud_engine_create`.
+    let context_id = unsafe { goud_engine_create(handle) };
+    assert_ne!(context_id, crate::ffi::context::GOUD_INVALID_CONTEXT_ID);
+
+    for _ in 0..3 {
+        assert!(goud_window_poll_events(context_id) >= 0.0);
+        assert!(goud_renderer_begin(context_id));
+        assert!(goud_renderer_end(context_id));
+        goud_window_swap_buffers(context_id);
+    }
+    assert!(!goud_window_should_close(context_id));
+
+    let (mut width, mut height) = (0, 0);
+    // SAFETY: both out-pointers reference live locals.
+    assert!(unsafe { goud_window_get_framebuffer_size(context_id, &mut width, &mut height) });
+    assert_eq!((width, height), (320, 180));
+    assert!(goud_window_destroy(context_id));
+}
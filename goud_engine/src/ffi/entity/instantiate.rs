@@ -0,0 +1,124 @@
+//! Batched prefab instantiation FFI.
+//!
+//! `goud_entity_clone_recursive` clones one hierarchy per call.
+//! `goud_entity_instantiate` clones a template hierarchy many times in one
+//! call, copying each component column-wise into archetype storage.
+
+use crate::core::error::{set_last_error, GoudError};
+use crate::ecs::Entity;
+use crate::ffi::{GoudContextId, GOUD_INVALID_CONTEXT_ID};
+
+use super::GOUD_INVALID_ENTITY_ID;
+
+/// Clones the entity hierarchy rooted at `template_id` `count` times.
+///
+/// Each instance is a deep copy like the result of
+/// `goud_entity_clone_recursive()`: cloneable built-in components and the
+/// template's FFI components are copied to every entity of the hierarchy,
+/// instance roots have no parent, and cloned children are parented under
+/// the matching cloned parent.  All instances are created in one call, with
+/// the clones of each template entity spawned straight into their archetype,
+/// so spawning a wave of enemies costs one call instead of one per enemy.
+///
+/// # Arguments
+///
+/// * `context_id` - The context containing the template
+/// * `template_id` - The root entity of the template hierarchy
+/// * `count` - Number of instances to create
+/// * `out_entities` - Output buffer for the instance root IDs (must hold at least `count` u64s)
+///
+/// # Returns
+///
+/// The number of instances created: `count` on success, 0 on failure.
+///
+/// # Safety
+///
+/// Caller must ensure `out_entities` points to valid memory with capacity for `count` u64 values.
+///
+/// # Error Codes
+///
+/// - `CONTEXT_ERROR_BASE + 3` (InvalidContext) - Invalid context ID
+/// - `ENTITY_ERROR_BASE + 0` (EntityNotFound) - The template does not exist
+/// - `INTERNAL_ERROR_BASE + 2` (InvalidState) - `out_entities` is null
+///
+/// # Thread Safety
+///
+/// Must be called from the thread that owns the context.
+#[no_mangle]
+pub unsafe extern "C" fn goud_entity_instantiate(
+    context_id: GoudContextId,
+    template_id: u64,
+    count: u32,
+    out_entities: *mut u64,
+) -> u32 {
+    use crate::ffi::context::get_context_registry;
+    use crate::ffi::GoudEntityId;
+
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return 0;
+    }
+
+    if template_id == GOUD_INVALID_ENTITY_ID {
+        set_last_error(GoudError::EntityNotFound);
+        return 0;
+    }
+
+    if out_entities.is_null() && count > 0 {
+        set_last_error(GoudError::InvalidState(
+            "out_entities pointer is null".to_string(),
+        ));
+        return 0;
+    }
+
+    // Clone under the registry lock, then release it before touching the
+    // component storage (lock order: registry -> storage, never nested here).
+    let instances = {
+        let mut registry = match get_context_registry().lock() {
+            Ok(r) => r,
+            Err(_) => {
+                set_last_error(GoudError::InternalError(
+                    "Failed to lock context registry".to_string(),
+                ));
+                return 0;
+            }
+        };
+        let context = match registry.get_mut(context_id) {
+            Some(guard) => guard,
+            None => {
+                set_last_error(GoudError::InvalidContext);
+                return 0;
+            }
+        };
+
+        let template = Entity::from_bits(GoudEntityId::new(template_id).bits());
+        let world = context.world_mut();
+        world.register_builtin_cloneables();
+        match world.instantiate_batch(template, count as usize) {
+            Some(instances) => instances,
+            None => {
+                set_last_error(GoudError::EntityNotFound);
+                return 0;
+            }
+        }
+    };
+    if instances.is_empty() {
+        return 0;
+    }
+
+    let key = crate::component_ops::context_key(context_id);
+    let mut targets = Vec::with_capacity(instances.len());
+    for (node, template) in instances.templates().iter().enumerate() {
+        targets.clear();
+        targets.extend(instances.clones_of(node).iter().map(|e| e.to_bits()));
+        crate::ffi::component::clone_context_entity(context_id, template.to_bits(), &targets);
+        crate::component_ops::clone_context_entity(key, template.to_bits(), &targets);
+    }
+
+    // SAFETY: caller guarantees out_entities is valid for count elements.
+    let out_slice = std::slice::from_raw_parts_mut(out_entities, count as usize);
+    for (slot, root) in out_slice.iter_mut().zip(instances.roots()) {
+        *slot = root.to_bits();
+    }
+    instances.len() as u32
+}
@@ -20,8 +20,10 @@
 //! ## Submodules
 //!
 //! - `lifecycle` - Entity spawn and despawn functions
+//! - `instantiate` - Batched prefab instantiation
 //! - `queries` - Entity liveness checks and counting
 
+pub mod instantiate;
 pub mod lifecycle;
 pub mod queries;
 
@@ -29,8 +31,11 @@ pub mod queries;
 mod tests;
 #[cfg(test)]
 mod tests_batch_alive;
+#[cfg(test)]
+mod tests_instantiate;
 
 // Re-export all public FFI functions so existing callers see the same API.
+pub use instantiate::goud_entity_instantiate;
 pub use lifecycle::{
     goud_entity_clone, goud_entity_clone_recursive, goud_entity_despawn, goud_entity_despawn_batch,
     goud_entity_spawn_batch, goud_entity_spawn_empty,
@@ -0,0 +1,127 @@
+//! Tests for the `goud_entity_instantiate` FFI function.
+
+use crate::core::error::{ERR_ENTITY_NOT_FOUND, ERR_INVALID_STATE};
+use crate::ecs::components::hierarchy::{Children, Name, Parent};
+use crate::ecs::Entity;
+use crate::ffi::component::{goud_component_add, goud_component_get, goud_component_register_type};
+use crate::ffi::context::{get_context_registry, goud_context_create, goud_context_destroy};
+use crate::ffi::entity::{
+    instantiate::goud_entity_instantiate, lifecycle::goud_entity_despawn, GOUD_INVALID_ENTITY_ID,
+};
+use crate::ffi::error::goud_last_error_code;
+use crate::ffi::{GoudContextId, GoudEntityId, GOUD_INVALID_CONTEXT_ID};
+
+const HEALTH_TYPE_ID: u64 = 0x1A57_0001;
+
+/// Spawns a named root with two children; the root carries an FFI component.
+fn spawn_template(ctx: GoudContextId) -> (u64, Vec<u64>) {
+    let (root, children) = {
+        let mut registry = get_context_registry().lock().unwrap();
+        let world = registry.get_mut(ctx).unwrap().world_mut();
+        let root = world.spawn_empty();
+        world.insert(root, Name::new("enemy"));
+        let children: Vec<Entity> = (0..2)
+            .map(|_| {
+                let child = world.spawn_empty();
+                world.insert(child, Parent::new(root));
+                child
+            })
+            .collect();
+        world.insert(root, Children::from_slice(&children));
+        (root, children)
+    };
+
+    let name = b"Health";
+    let health = 42u32;
+    // SAFETY: name is a valid byte slice; size and align match a u32, and
+    // health is a live u32 for the duration of the add.
+    unsafe {
+        goud_component_register_type(HEALTH_TYPE_ID, name.as_ptr(), name.len(), 4, 4);
+        let result = goud_component_add(
+            ctx,
+            GoudEntityId::new(root.to_bits()),
+            HEALTH_TYPE_ID,
+            &health as *const u32 as *const u8,
+            4,
+        );
+        assert!(result.is_ok());
+    }
+    (
+        root.to_bits(),
+        children.iter().map(|e| e.to_bits()).collect(),
+    )
+}
+
+#[test]
+fn test_instantiate_creates_detached_hierarchies() {
+    let ctx = goud_context_create();
+    let (template, template_children) = spawn_template(ctx);
+
+    let mut roots = vec![GOUD_INVALID_ENTITY_ID; 8];
+    // SAFETY: roots has capacity for 8 u64 values.
+    let created = unsafe { goud_entity_instantiate(ctx, template, 8, roots.as_mut_ptr()) };
+    assert_eq!(created, 8);
+
+    {
+        let registry = get_context_registry().lock().unwrap();
+        let world = registry.get(ctx).unwrap().world();
+        assert_eq!(world.entity_count(), 3 + 8 * 3);
+        for &bits in &roots {
+            let root = Entity::from_bits(bits);
+            assert!(!world.has::<Parent>(root));
+            assert_eq!(world.get::<Name>(root).map(Name::as_str), Some("enemy"));
+            let children = world.get::<Children>(root).unwrap();
+            assert_eq!(children.len(), 2);
+            for &child in children.as_slice() {
+                assert_eq!(world.get::<Parent>(child).unwrap().get(), root);
+                assert!(!template_children.contains(&child.to_bits()));
+            }
+        }
+    }
+
+    for &bits in &roots {
+        let ptr = goud_component_get(ctx, GoudEntityId::new(bits), HEALTH_TYPE_ID);
+        assert!(
+            !ptr.is_null(),
+            "FFI components are copied to every instance"
+        );
+        // SAFETY: ptr points to a 4-byte slot registered for a u32.
+        assert_eq!(unsafe { std::ptr::read_unaligned(ptr as *const u32) }, 42);
+    }
+
+    goud_context_destroy(ctx);
+}
+
+#[test]
+fn test_instantiate_rejects_bad_arguments() {
+    let ctx = goud_context_create();
+    let (template, _) = spawn_template(ctx);
+    let mut roots = [0u64; 2];
+
+    // SAFETY: roots has capacity for 2 u64 values; the null and invalid
+    // cases return before writing.
+    unsafe {
+        assert_eq!(
+            goud_entity_instantiate(GOUD_INVALID_CONTEXT_ID, template, 2, roots.as_mut_ptr()),
+            0
+        );
+        assert_eq!(
+            goud_entity_instantiate(ctx, template, 2, std::ptr::null_mut()),
+            0
+        );
+        assert_eq!(goud_last_error_code(), ERR_INVALID_STATE);
+        assert_eq!(
+            goud_entity_instantiate(ctx, template, 0, std::ptr::null_mut()),
+            0
+        );
+
+        assert!(goud_entity_despawn(ctx, template).is_ok());
+        assert_eq!(
+            goud_entity_instantiate(ctx, template, 2, roots.as_mut_ptr()),
+            0
+        );
+        assert_eq!(goud_last_error_code(), ERR_ENTITY_NOT_FOUND);
+    }
+
+    goud_context_destroy(ctx);
+}
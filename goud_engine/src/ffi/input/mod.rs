@@ -31,6 +31,7 @@ pub(crate) mod gamepad;
 mod helpers;
 mod keyboard;
 mod mouse;
+mod snapshot;
 mod touch;
 
 // Re-export type aliases and constants so callers see the same public API.
@@ -74,6 +75,10 @@ pub use mouse::{
     goud_input_mouse_button_just_pressed, goud_input_mouse_button_just_released,
     goud_input_mouse_button_pressed,
 };
+pub use snapshot::{
+    goud_input_capture_snapshot, FfiInputSnapshot, GOUD_GAMEPAD_AXIS_COUNT, GOUD_INPUT_KEY_WORDS,
+    GOUD_INPUT_SNAPSHOT_TOUCHES,
+};
 pub use touch::{
     goud_input_touch_active, goud_input_touch_count, goud_input_touch_delta,
     goud_input_touch_just_pressed, goud_input_touch_just_released, goud_input_touch_position,
@@ -0,0 +1,243 @@
+//! Per-frame input snapshot FFI.
+//!
+//! `goud_input_capture_snapshot` copies the whole input state of a frame
+//! into one plain struct, so callers that query many keys or buttons pay
+//! for one FFI call and then test bits in their own memory.  The struct
+//! holds no pointers, which also makes it a cheap unit to record for replays.
+
+use crate::core::error::{set_last_error, GoudError};
+use crate::core::input_manager::MAX_GAMEPAD_SLOTS;
+use crate::core::providers::input_types::{GamepadAxis, MouseButton};
+use crate::ecs::InputManager;
+use crate::ffi::context::{GoudContextId, GOUD_INVALID_CONTEXT_ID};
+
+use super::helpers::with_input;
+
+/// Number of 64-bit words in each keyboard bitset (covers key codes 0-383).
+pub const GOUD_INPUT_KEY_WORDS: usize = 6;
+
+/// Maximum number of touches recorded in an input snapshot.
+pub const GOUD_INPUT_SNAPSHOT_TOUCHES: usize = 10;
+
+/// Number of analog axes recorded per gamepad.
+pub const GOUD_GAMEPAD_AXIS_COUNT: usize = 6;
+
+/// Number of gamepad buttons recorded per gamepad (codes 0-14).
+const GAMEPAD_BUTTON_COUNT: u32 = 15;
+
+/// Number of mouse buttons recorded (codes 0-4).
+const MOUSE_BUTTON_COUNT: u32 = 5;
+
+const GAMEPAD_AXES: [GamepadAxis; GOUD_GAMEPAD_AXIS_COUNT] = [
+    GamepadAxis::LeftStickX,
+    GamepadAxis::LeftStickY,
+    GamepadAxis::RightStickX,
+    GamepadAxis::RightStickY,
+    GamepadAxis::LeftTrigger,
+    GamepadAxis::RightTrigger,
+];
+
+/// FFI-safe copy of one frame's input state.
+///
+/// Key `k` is bit `k % 64` of word `k / 64`; mouse button `b` is bit `b` of
+/// the mouse masks; gamepad button `b` of pad `p` is bit `b` of element `p`.
+/// Gamepad axes are stored pad-major.  Touches are sorted by ID and include
+/// touches that ended this frame; touch slot `i` is bit `i` of the touch
+/// masks.  Consumed keys and buttons read as released, as they do for the
+/// per-key queries.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq)]
+pub struct FfiInputSnapshot {
+    /// Keys held this frame.
+    pub keys_down: [u64; GOUD_INPUT_KEY_WORDS],
+    /// Keys pressed this frame (not held last frame).
+    pub keys_pressed: [u64; GOUD_INPUT_KEY_WORDS],
+    /// Keys released this frame (held last frame).
+    pub keys_released: [u64; GOUD_INPUT_KEY_WORDS],
+    /// Touch ID of each used touch slot.
+    pub touch_ids: [u64; GOUD_INPUT_SNAPSHOT_TOUCHES],
+    /// Mouse buttons held this frame.
+    pub mouse_down: u32,
+    /// Mouse buttons pressed this frame.
+    pub mouse_pressed: u32,
+    /// Mouse buttons released this frame.
+    pub mouse_released: u32,
+    /// Bit `p` is set when gamepad `p` is connected.
+    pub gamepads_connected: u32,
+    /// Mouse cursor X position.
+    pub mouse_x: f32,
+    /// Mouse cursor Y position.
+    pub mouse_y: f32,
+    /// Mouse X movement since last frame.
+    pub mouse_dx: f32,
+    /// Mouse Y movement since last frame.
+    pub mouse_dy: f32,
+    /// Horizontal scroll this frame.
+    pub scroll_x: f32,
+    /// Vertical scroll this frame.
+    pub scroll_y: f32,
+    /// Gamepad buttons held this frame, one mask per gamepad.
+    pub gamepad_down: [u32; MAX_GAMEPAD_SLOTS],
+    /// Gamepad buttons pressed this frame, one mask per gamepad.
+    pub gamepad_pressed: [u32; MAX_GAMEPAD_SLOTS],
+    /// Gamepad buttons released this frame, one mask per gamepad.
+    pub gamepad_released: [u32; MAX_GAMEPAD_SLOTS],
+    /// Axis values after the dead zone, `GOUD_GAMEPAD_AXIS_COUNT` per gamepad.
+    pub gamepad_axes: [f32; MAX_GAMEPAD_SLOTS * GOUD_GAMEPAD_AXIS_COUNT],
+    /// Number of used touch slots.
+    pub touch_count: u32,
+    /// Touch slots that are active this frame.
+    pub touch_active: u32,
+    /// Touch slots that began this frame.
+    pub touch_pressed: u32,
+    /// Touch slots that ended this frame.
+    pub touch_released: u32,
+    /// X position of each touch.
+    pub touch_x: [f32; GOUD_INPUT_SNAPSHOT_TOUCHES],
+    /// Y position of each touch.
+    pub touch_y: [f32; GOUD_INPUT_SNAPSHOT_TOUCHES],
+    /// X movement of each touch since last frame.
+    pub touch_dx: [f32; GOUD_INPUT_SNAPSHOT_TOUCHES],
+    /// Y movement of each touch since last frame.
+    pub touch_dy: [f32; GOUD_INPUT_SNAPSHOT_TOUCHES],
+}
+
+impl FfiInputSnapshot {
+    /// Builds a snapshot of `input`'s current frame.
+    pub fn capture(input: &InputManager) -> Self {
+        let mut snapshot = Self::default();
+
+        for key in input.keys_tracked() {
+            let code = key as usize;
+            if code >= GOUD_INPUT_KEY_WORDS * 64 {
+                continue;
+            }
+            let (word, bit) = (code / 64, 1u64 << (code % 64));
+            if input.key_pressed(key) {
+                snapshot.keys_down[word] |= bit;
+            }
+            if input.key_just_pressed(key) {
+                snapshot.keys_pressed[word] |= bit;
+            }
+            if input.key_just_released(key) {
+                snapshot.keys_released[word] |= bit;
+            }
+        }
+
+        for code in 0..MOUSE_BUTTON_COUNT {
+            let Some(button) = MouseButton::from_u32(code) else {
+                continue;
+            };
+            let bit = 1u32 << code;
+            if input.mouse_button_pressed(button) {
+                snapshot.mouse_down |= bit;
+            }
+            if input.mouse_button_just_pressed(button) {
+                snapshot.mouse_pressed |= bit;
+            }
+            if input.mouse_button_just_released(button) {
+                snapshot.mouse_released |= bit;
+            }
+        }
+        let position = input.mouse_position();
+        let delta = input.mouse_delta();
+        let scroll = input.scroll_delta();
+        snapshot.mouse_x = position.x;
+        snapshot.mouse_y = position.y;
+        snapshot.mouse_dx = delta.x;
+        snapshot.mouse_dy = delta.y;
+        snapshot.scroll_x = scroll.x;
+        snapshot.scroll_y = scroll.y;
+
+        for pad in 0..MAX_GAMEPAD_SLOTS {
+            if input.is_gamepad_connected(pad) {
+                snapshot.gamepads_connected |= 1 << pad;
+            }
+            for button in 0..GAMEPAD_BUTTON_COUNT {
+                let bit = 1u32 << button;
+                if input.gamepad_button_pressed(pad, button) {
+                    snapshot.gamepad_down[pad] |= bit;
+                }
+                if input.gamepad_button_just_pressed(pad, button) {
+                    snapshot.gamepad_pressed[pad] |= bit;
+                }
+                if input.gamepad_button_just_released(pad, button) {
+                    snapshot.gamepad_released[pad] |= bit;
+                }
+            }
+            for (axis_index, axis) in GAMEPAD_AXES.iter().enumerate() {
+                snapshot.gamepad_axes[pad * GOUD_GAMEPAD_AXIS_COUNT + axis_index] =
+                    input.gamepad_axis(pad, *axis);
+            }
+        }
+
+        let mut ids: Vec<u64> = input.touch_ids().collect();
+        ids.sort_unstable();
+        ids.truncate(GOUD_INPUT_SNAPSHOT_TOUCHES);
+        for (slot, &id) in ids.iter().enumerate() {
+            let bit = 1u32 << slot;
+            snapshot.touch_ids[slot] = id;
+            if input.touch_active(id) {
+                snapshot.touch_active |= bit;
+            }
+            if input.touch_just_pressed(id) {
+                snapshot.touch_pressed |= bit;
+            }
+            if input.touch_just_released(id) {
+                snapshot.touch_released |= bit;
+            }
+            if let Some(position) = input.touch_position(id) {
+                snapshot.touch_x[slot] = position.x;
+                snapshot.touch_y[slot] = position.y;
+            }
+            let delta = input.touch_delta(id);
+            snapshot.touch_dx[slot] = delta.x;
+            snapshot.touch_dy[slot] = delta.y;
+        }
+        snapshot.touch_count = ids.len() as u32;
+
+        snapshot
+    }
+}
+
+/// Copies the context's current input state into `out_snapshot`.
+///
+/// Call once per frame after `goud_window_poll_events`; every later query
+/// against the snapshot is a bit test with no FFI call.
+///
+/// # Returns
+///
+/// `true` if the snapshot was written, `false` if the context is invalid,
+/// has no input manager, or `out_snapshot` is null.
+///
+/// # Safety
+///
+/// `out_snapshot` must be a valid, aligned, non-null pointer.
+#[no_mangle]
+pub unsafe extern "C" fn goud_input_capture_snapshot(
+    context_id: GoudContextId,
+    out_snapshot: *mut FfiInputSnapshot,
+) -> bool {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return false;
+    }
+    if out_snapshot.is_null() {
+        set_last_error(GoudError::InvalidState(
+            "out_snapshot pointer is null".to_string(),
+        ));
+        return false;
+    }
+    match with_input(context_id, FfiInputSnapshot::capture) {
+        Some(snapshot) => {
+            // SAFETY: Caller guarantees out_snapshot is valid and aligned.
+            *out_snapshot = snapshot;
+            true
+        }
+        None => false,
+    }
+}
+
+#[cfg(test)]
+#[path = "snapshot_tests.rs"]
+mod tests;
@@ -0,0 +1,86 @@
+//! Tests for the input snapshot FFI.
+
+use super::*;
+use crate::core::math::Vec2;
+use crate::core::providers::input_types::KeyCode as Key;
+use crate::ffi::context::{get_context_registry, goud_context_create, goud_context_destroy};
+
+fn key_bit(words: &[u64; GOUD_INPUT_KEY_WORDS], key: Key) -> bool {
+    let code = key as usize;
+    words[code / 64] & (1 << (code % 64)) != 0
+}
+
+#[test]
+fn capture_records_edges_and_held_state() {
+    let mut input = InputManager::new();
+    input.press_key(Key::W);
+    input.press_key(Key::LeftShift);
+    input.press_mouse_button(MouseButton::Right);
+    input.set_gamepad_connected(1, true);
+    input.press_gamepad_button(1, 3);
+    input.update();
+    input.release_key(Key::LeftShift);
+    input.press_key(Key::Space);
+    input.set_mouse_position(Vec2::new(12.0, 34.0));
+    input.set_gamepad_axis(1, GamepadAxis::RightTrigger, 1.0);
+    input.touch_start(9, Vec2::new(5.0, 6.0));
+    input.touch_start(2, Vec2::new(7.0, 8.0));
+
+    let snapshot = FfiInputSnapshot::capture(&input);
+
+    assert!(key_bit(&snapshot.keys_down, Key::W));
+    assert!(!key_bit(&snapshot.keys_pressed, Key::W));
+    assert!(key_bit(&snapshot.keys_pressed, Key::Space));
+    assert!(key_bit(&snapshot.keys_released, Key::LeftShift));
+    assert!(!key_bit(&snapshot.keys_down, Key::LeftShift));
+    assert_eq!(snapshot.mouse_down, 1 << MouseButton::Right as u32);
+    assert_eq!(snapshot.mouse_pressed, 0);
+    assert_eq!((snapshot.mouse_x, snapshot.mouse_y), (12.0, 34.0));
+    assert_eq!(snapshot.gamepads_connected, 0b10);
+    assert_eq!(snapshot.gamepad_down[1], 1 << 3);
+    assert_eq!(
+        snapshot.gamepad_axes[GOUD_GAMEPAD_AXIS_COUNT + GamepadAxis::RightTrigger as usize],
+        1.0
+    );
+    assert_eq!(snapshot.touch_count, 2);
+    assert_eq!(&snapshot.touch_ids[..2], &[2, 9]);
+    assert_eq!(snapshot.touch_pressed, 0b11);
+    assert_eq!((snapshot.touch_x[1], snapshot.touch_y[1]), (5.0, 6.0));
+}
+
+#[test]
+fn capture_snapshot_rejects_bad_arguments() {
+    let mut snapshot = FfiInputSnapshot::default();
+    // SAFETY: snapshot is a live, aligned FfiInputSnapshot.
+    unsafe {
+        assert!(!goud_input_capture_snapshot(
+            GOUD_INVALID_CONTEXT_ID,
+            &mut snapshot
+        ));
+        let ctx = goud_context_create();
+        assert!(!goud_input_capture_snapshot(ctx, std::ptr::null_mut()));
+        // A context without an input manager has nothing to capture.
+        assert!(!goud_input_capture_snapshot(ctx, &mut snapshot));
+        goud_context_destroy(ctx);
+    }
+}
+
+#[test]
+fn capture_snapshot_copies_context_input() {
+    let ctx = goud_context_create();
+    {
+        let mut registry = get_context_registry().lock().unwrap();
+        let world = registry.get_mut(ctx).unwrap().world_mut();
+        let mut input = InputManager::new();
+        input.press_key(Key::A);
+        world.insert_resource(input);
+    }
+
+    let mut snapshot = FfiInputSnapshot::default();
+    // SAFETY: snapshot is a live, aligned FfiInputSnapshot.
+    assert!(unsafe { goud_input_capture_snapshot(ctx, &mut snapshot) });
+    assert!(key_bit(&snapshot.keys_down, Key::A));
+    assert!(key_bit(&snapshot.keys_pressed, Key::A));
+
+    goud_context_destroy(ctx);
+}
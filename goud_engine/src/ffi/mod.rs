@@ -98,6 +98,8 @@
 pub mod animation;
 pub mod arena;
 #[cfg(feature = "native")]
+pub mod asset_pack;
+#[cfg(feature = "native")]
 pub mod audio;
 pub mod collision;
 pub mod component;
@@ -124,6 +126,7 @@ pub mod renderer;
 pub mod renderer3d;
 pub mod scene;
 pub mod scene_loading;
+pub mod scene_streaming;
 pub mod scene_transition;
 pub mod spatial_grid;
 pub mod spatial_hash;
@@ -131,6 +134,7 @@ pub mod types;
 pub mod ui;
 #[cfg(feature = "native")]
 pub mod window;
+pub mod world_snapshot;
 
 // Re-export core types for convenience
 pub use context::{
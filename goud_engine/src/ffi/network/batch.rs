@@ -0,0 +1,169 @@
+//! Batched receive: drain many buffered messages in one call.
+//!
+//! `goud_network_receive` copies one message per call and truncates it to
+//! the caller's buffer.  At thousands of messages a second the per-call
+//! registry lock dominates, so `goud_network_receive_many` packs as many
+//! queued messages as fit into one caller buffer, back to back, and
+//! describes each with an [`FfiNetworkMessage`].  Messages that do not fit
+//! stay queued for the next call; nothing is truncated.  When the next
+//! message is larger than the whole buffer, `goud_network_peek_size`
+//! reports how large the buffer must grow.
+
+use crate::core::error::{set_last_error, GoudError, ERR_INVALID_STATE};
+use crate::ffi::context::GoudContextId;
+
+use super::registry::with_instance;
+
+/// Location of one received message inside a `goud_network_receive_many`
+/// buffer.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct FfiNetworkMessage {
+    /// Connection the message arrived from.
+    pub peer_id: u64,
+    /// Byte offset of the payload in the output buffer.
+    pub offset: u32,
+    /// Payload length in bytes.
+    pub len: u32,
+}
+
+/// Moves buffered messages (queued by `goud_network_poll`) into `out_buf`.
+///
+/// Payloads are written back to back from the start of `out_buf`, and one
+/// [`FfiNetworkMessage`] per payload is written to `out_messages`.  Stops at
+/// `max_messages`, when the queue is empty, or at the first message that
+/// does not fit in the remaining space; that message stays queued.
+///
+/// # Returns
+///
+/// `0` on success, with the message count in `out_count` (0 if the queue is
+/// empty), or an error code.  Fails with `ERR_INVALID_STATE` when the next
+/// message is larger than `buf_len`, leaving it queued; call
+/// `goud_network_peek_size` for the size it needs.
+///
+/// # Safety
+///
+/// `out_buf` must be valid for `buf_len` writable bytes, `out_messages` for
+/// `max_messages` writable [`FfiNetworkMessage`] values, and `out_count`
+/// must point to a writable `u32`. None are retained.
+#[no_mangle]
+pub unsafe extern "C" fn goud_network_receive_many(
+    _context_id: GoudContextId,
+    handle: i64,
+    out_buf: *mut u8,
+    buf_len: u32,
+    out_messages: *mut FfiNetworkMessage,
+    max_messages: u32,
+    out_count: *mut u32,
+) -> i32 {
+    if out_count.is_null() {
+        set_last_error(GoudError::InvalidState("out_count is null".to_string()));
+        return ERR_INVALID_STATE;
+    }
+    if out_buf.is_null() || out_messages.is_null() || buf_len == 0 || max_messages == 0 {
+        set_last_error(GoudError::InvalidState(
+            "out_buf or out_messages is null or empty".to_string(),
+        ));
+        return ERR_INVALID_STATE;
+    }
+    // SAFETY: Caller guarantees `out_count` points to a writable `u32`.
+    unsafe { *out_count = 0 };
+
+    let result = with_instance(handle, |inst| {
+        // SAFETY: Caller guarantees both buffers are valid for their lengths.
+        let (buf, messages) = unsafe {
+            (
+                std::slice::from_raw_parts_mut(out_buf, buf_len as usize),
+                std::slice::from_raw_parts_mut(out_messages, max_messages as usize),
+            )
+        };
+
+        let mut written = 0usize;
+        let mut offset = 0usize;
+        while written < messages.len() {
+            let Some((_, data)) = inst.recv_queue.front() else {
+                break;
+            };
+            let end = offset + data.len();
+            if end > buf.len() {
+                if written == 0 {
+                    set_last_error(GoudError::InvalidState(format!(
+                        "next message is {} bytes but the buffer holds {}",
+                        data.len(),
+                        buf.len()
+                    )));
+                    return Err(ERR_INVALID_STATE);
+                }
+                break;
+            }
+            let (peer_id, data) = inst.recv_queue.pop_front().unwrap();
+            buf[offset..end].copy_from_slice(&data);
+            messages[written] = FfiNetworkMessage {
+                peer_id,
+                offset: offset as u32,
+                len: data.len() as u32,
+            };
+            written += 1;
+            offset = end;
+        }
+        Ok(written as u32)
+    });
+
+    match result {
+        Ok(count) => {
+            // SAFETY: Caller guarantees `out_count` points to a writable `u32`.
+            unsafe { *out_count = count };
+            0
+        }
+        Err(code) => code,
+    }
+}
+
+/// Reports the sender and size of the next buffered message without
+/// moving it.
+///
+/// Lets a caller whose `goud_network_receive_many` buffer is too small for
+/// the next message grow the buffer and retry, instead of leaving that
+/// message blocking the queue.
+///
+/// # Returns
+///
+/// `0` on success, with the peer in `out_peer_id` and the payload length in
+/// `out_len` (both 0 when the queue is empty), or an error code.
+///
+/// # Safety
+///
+/// `out_peer_id` must point to a writable `u64` and `out_len` to a
+/// writable `u32`. Neither is retained.
+#[no_mangle]
+pub unsafe extern "C" fn goud_network_peek_size(
+    _context_id: GoudContextId,
+    handle: i64,
+    out_peer_id: *mut u64,
+    out_len: *mut u32,
+) -> i32 {
+    if out_peer_id.is_null() || out_len.is_null() {
+        set_last_error(GoudError::InvalidState(
+            "out_peer_id or out_len is null".to_string(),
+        ));
+        return ERR_INVALID_STATE;
+    }
+    let result = with_instance(handle, |inst| {
+        Ok(inst
+            .recv_queue
+            .front()
+            .map_or((0, 0), |(peer_id, data)| (*peer_id, data.len() as u32)))
+    });
+
+    match result {
+        Ok((peer_id, len)) => {
+            // SAFETY: Caller guarantees both pointers are writable.
+            unsafe {
+                *out_peer_id = peer_id;
+                *out_len = len;
+            }
+            0
+        }
+        Err(code) => code,
+    }
+}
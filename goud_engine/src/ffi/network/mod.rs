@@ -6,6 +6,7 @@
 //!
 //! Split across submodules:
 //! - `lifecycle`: host, connect, disconnect, send, receive, poll
+//! - `batch`: receive many buffered messages in one call
 //! - `stats`: FFI-safe aggregate stats types and query functions
 //! - `controls`: overlay-handle selection, peer count, simulation controls
 
@@ -14,6 +15,7 @@ use crate::core::error::ERR_INVALID_STATE;
 #[cfg(test)]
 use crate::ffi::context::GoudContextId;
 
+mod batch;
 mod controls;
 mod lifecycle;
 mod overlay;
@@ -31,6 +33,7 @@ pub(crate) use overlay::{
     network_overlay_snapshot_for_context,
 };
 
+pub use batch::{goud_network_peek_size, goud_network_receive_many, FfiNetworkMessage};
 pub use controls::{
     goud_network_clear_overlay_handle, goud_network_clear_simulation, goud_network_peer_count,
     goud_network_set_overlay_handle, goud_network_set_simulation,
@@ -52,6 +55,7 @@ pub use rpc::{
     goud_rpc_call, goud_rpc_create, goud_rpc_destroy, goud_rpc_drain_one, goud_rpc_poll,
     goud_rpc_process_incoming, goud_rpc_receive_response, goud_rpc_register,
 };
+pub(crate) use stats::network_stats_for_context;
 pub use stats::{goud_network_get_stats, goud_network_get_stats_v2, FfiNetworkStats};
 
 #[cfg(test)]
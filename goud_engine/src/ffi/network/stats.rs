@@ -3,7 +3,7 @@ use crate::core::error::{set_last_error, GoudError, ERR_INVALID_STATE};
 use crate::core::providers::network_types::NetworkStats;
 use crate::ffi::context::GoudContextId;
 
-use super::registry::with_instance;
+use super::registry::{with_instance, with_registry};
 
 /// FFI-safe aggregate network statistics for a provider handle.
 #[derive(Debug, Clone, Copy, Default, PartialEq)]
@@ -48,6 +48,18 @@ impl From<NetworkStats> for FfiNetworkStats {
     }
 }
 
+/// Returns the stats of a context's active network handle, if it has one.
+pub(crate) fn network_stats_for_context(context_id: GoudContextId) -> Option<FfiNetworkStats> {
+    with_registry(|reg| {
+        Ok(reg
+            .active_handle_for_context(context_id)
+            .and_then(|handle| reg.instances.get(&handle))
+            .map(|instance| FfiNetworkStats::from(instance.provider.stats())))
+    })
+    .ok()
+    .flatten()
+}
+
 /// Writes aggregate network statistics into caller-provided pointers.
 /// Returns 0 on success, negative error code on failure.
 ///
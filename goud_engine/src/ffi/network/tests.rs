@@ -14,6 +14,8 @@ use crate::ffi::network::registry::{
     reset_registry_for_tests, with_instance, with_registry, NetInstance, NetRegistryInner,
 };
 
+#[path = "tests_batch.rs"]
+mod batch_tests;
 #[path = "tests_live.rs"]
 mod live_tests;
 #[path = "tests_release.rs"]
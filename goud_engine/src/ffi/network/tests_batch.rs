@@ -0,0 +1,194 @@
+use super::*;
+
+fn queue_messages(handle: i64, messages: &[(u64, &[u8])]) {
+    with_instance(handle, |inst| {
+        for (peer, data) in messages {
+            inst.recv_queue.push_back((*peer, data.to_vec()));
+        }
+        Ok(())
+    })
+    .expect("failed to queue messages");
+}
+
+fn receive_many(
+    handle: i64,
+    buf: &mut [u8],
+    messages: &mut [FfiNetworkMessage],
+) -> (i32, Vec<FfiNetworkMessage>) {
+    let mut count = 0u32;
+    // SAFETY: Both buffers are valid for their lengths and `count` is writable.
+    let rc = unsafe {
+        goud_network_receive_many(
+            GoudContextId::new(310, 1),
+            handle,
+            buf.as_mut_ptr(),
+            buf.len() as u32,
+            messages.as_mut_ptr(),
+            messages.len() as u32,
+            &mut count,
+        )
+    };
+    (rc, messages[..count as usize].to_vec())
+}
+
+#[test]
+fn test_receive_many_packs_messages_back_to_back() {
+    let _registry = RegistryResetGuard::new();
+    let handle = insert_null_provider();
+    queue_messages(handle, &[(1, b"abc"), (2, b""), (1, b"defg")]);
+
+    let mut buf = [0u8; 16];
+    let mut messages = [FfiNetworkMessage::default(); 8];
+    let (rc, received) = receive_many(handle, &mut buf, &mut messages);
+
+    assert_eq!(rc, 0);
+    assert_eq!(
+        received,
+        vec![
+            FfiNetworkMessage {
+                peer_id: 1,
+                offset: 0,
+                len: 3
+            },
+            FfiNetworkMessage {
+                peer_id: 2,
+                offset: 3,
+                len: 0
+            },
+            FfiNetworkMessage {
+                peer_id: 1,
+                offset: 3,
+                len: 4
+            },
+        ]
+    );
+    assert_eq!(&buf[..7], b"abcdefg");
+    assert_eq!(
+        receive_many(handle, &mut buf, &mut messages),
+        (0, Vec::new())
+    );
+}
+
+#[test]
+fn test_receive_many_leaves_messages_that_do_not_fit_queued() {
+    let _registry = RegistryResetGuard::new();
+    let handle = insert_null_provider();
+    queue_messages(handle, &[(1, b"abcd"), (1, b"efgh"), (1, b"ij")]);
+
+    let mut buf = [0u8; 6];
+    let mut messages = [FfiNetworkMessage::default(); 8];
+    let (rc, received) = receive_many(handle, &mut buf, &mut messages);
+    assert_eq!(rc, 0);
+    assert_eq!(received.len(), 1);
+
+    let mut one = [FfiNetworkMessage::default(); 1];
+    let (rc, received) = receive_many(handle, &mut buf, &mut one);
+    assert_eq!(rc, 0);
+    assert_eq!(received.len(), 1);
+    assert_eq!(&buf[..4], b"efgh");
+    assert_eq!(
+        with_instance(handle, |inst| Ok(inst.recv_queue.len())),
+        Ok(1)
+    );
+}
+
+#[test]
+fn test_receive_many_rejects_a_message_larger_than_the_buffer() {
+    let _registry = RegistryResetGuard::new();
+    let handle = insert_null_provider();
+    queue_messages(handle, &[(1, b"too long")]);
+
+    let mut buf = [0u8; 4];
+    let mut messages = [FfiNetworkMessage::default(); 2];
+    let (rc, received) = receive_many(handle, &mut buf, &mut messages);
+    assert_eq!(rc, ERR_INVALID_STATE);
+    assert!(received.is_empty());
+    assert_eq!(
+        with_instance(handle, |inst| Ok(inst.recv_queue.len())),
+        Ok(1)
+    );
+}
+
+fn peek_size(handle: i64) -> (i32, u64, u32) {
+    let (mut peer_id, mut len) = (u64::MAX, u32::MAX);
+    // SAFETY: Both out pointers are writable locals.
+    let rc = unsafe {
+        goud_network_peek_size(GoudContextId::new(312, 1), handle, &mut peer_id, &mut len)
+    };
+    (rc, peer_id, len)
+}
+
+#[test]
+fn test_peek_size_lets_an_oversized_message_through_after_growing() {
+    let _registry = RegistryResetGuard::new();
+    let handle = insert_null_provider();
+    let oversized = [7u8; 40];
+    queue_messages(handle, &[(3, &oversized), (1, b"ab"), (2, b"cd")]);
+
+    let mut buf = vec![0u8; 8];
+    let mut messages = [FfiNetworkMessage::default(); 4];
+    assert_eq!(
+        receive_many(handle, &mut buf, &mut messages),
+        (ERR_INVALID_STATE, Vec::new())
+    );
+    assert_eq!(peek_size(handle), (0, 3, 40));
+
+    buf.resize(40, 0);
+    let (rc, received) = receive_many(handle, &mut buf, &mut messages);
+    assert_eq!(rc, 0);
+    assert_eq!(received.len(), 1);
+    assert_eq!(received[0].peer_id, 3);
+    assert_eq!(&buf[..40], &oversized);
+
+    let (rc, received) = receive_many(handle, &mut buf, &mut messages);
+    assert_eq!(rc, 0);
+    assert_eq!(received.len(), 2);
+    assert_eq!(&buf[..4], b"abcd");
+    assert_eq!(peek_size(handle), (0, 0, 0));
+}
+
+#[test]
+fn test_peek_size_rejects_null_pointers_and_unknown_handles() {
+    let _registry = RegistryResetGuard::new();
+    let handle = insert_null_provider();
+    let mut len = 0u32;
+    // SAFETY: A null peer pointer is the error path under test.
+    let rc = unsafe {
+        goud_network_peek_size(
+            GoudContextId::new(312, 1),
+            handle,
+            std::ptr::null_mut(),
+            &mut len,
+        )
+    };
+    assert_eq!(rc, ERR_INVALID_STATE);
+    assert_eq!(peek_size(999).0, ERR_INVALID_STATE);
+}
+
+#[test]
+fn test_receive_many_rejects_null_buffers_and_unknown_handles() {
+    let _registry = RegistryResetGuard::new();
+    let mut count = 0u32;
+    let mut messages = [FfiNetworkMessage::default(); 1];
+    // SAFETY: Null buffers and an unknown handle are the error paths under test.
+    unsafe {
+        assert_eq!(
+            goud_network_receive_many(
+                GoudContextId::new(311, 1),
+                1,
+                std::ptr::null_mut(),
+                16,
+                messages.as_mut_ptr(),
+                1,
+                &mut count,
+            ),
+            ERR_INVALID_STATE
+        );
+    }
+
+    let mut buf = [0u8; 4];
+    assert_eq!(
+        receive_many(999, &mut buf, &mut messages).0,
+        ERR_INVALID_STATE
+    );
+}
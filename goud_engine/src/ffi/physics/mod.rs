@@ -12,12 +12,18 @@ pub mod physics2d;
 #[cfg(feature = "rapier2d")]
 pub mod physics2d_common;
 #[cfg(feature = "rapier2d")]
+pub mod physics2d_event_buffer;
+#[cfg(feature = "rapier2d")]
 pub mod physics2d_events;
 #[cfg(feature = "rapier2d")]
 pub mod physics2d_ex;
 #[cfg(feature = "rapier2d")]
 pub mod physics2d_material;
 #[cfg(feature = "rapier2d")]
+pub mod physics2d_query_batch;
+#[cfg(feature = "rapier2d")]
+pub mod physics2d_snapshot;
+#[cfg(feature = "rapier2d")]
 pub mod physics2d_state;
 #[cfg(feature = "rapier3d")]
 pub mod physics3d;
@@ -29,11 +35,14 @@ pub use physics2d::{
     goud_physics_add_collider, goud_physics_add_rigid_body, goud_physics_add_rigid_body_ex,
     goud_physics_apply_force, goud_physics_apply_impulse, goud_physics_create,
     goud_physics_create_joint, goud_physics_create_with_backend, goud_physics_destroy,
-    goud_physics_get_position, goud_physics_get_velocity, goud_physics_raycast,
-    goud_physics_remove_body, goud_physics_remove_joint, goud_physics_set_gravity,
-    goud_physics_set_velocity, goud_physics_step,
+    goud_physics_get_bodies, goud_physics_get_position, goud_physics_get_velocity,
+    goud_physics_raycast, goud_physics_remove_body, goud_physics_remove_joint,
+    goud_physics_set_gravity, goud_physics_set_velocities, goud_physics_set_velocity,
+    goud_physics_step,
 };
 #[cfg(feature = "rapier2d")]
+pub use physics2d_event_buffer::{goud_physics_collision_events_copy, FfiCollisionEvent};
+#[cfg(feature = "rapier2d")]
 // Keep both singular and plural collision-event symbols exported for backward compatibility:
 // older SDKs use singular names while newer APIs use pluralized names.
 pub use physics2d_events::{
@@ -51,6 +60,15 @@ pub use physics2d_material::{
     goud_physics_set_collider_restitution, goud_physics_set_timestep,
 };
 #[cfg(feature = "rapier2d")]
+pub use physics2d_query_batch::{
+    goud_physics_overlap_rect_batch, goud_physics_raycast_batch, FfiRay, FfiRaycastHit,
+};
+#[cfg(feature = "rapier2d")]
+pub use physics2d_snapshot::{
+    goud_physics_free_state, goud_physics_load_state, goud_physics_save_state,
+    goud_physics_save_state_into, goud_physics_set_deterministic,
+};
+#[cfg(feature = "rapier2d")]
 pub use physics2d_state::CollisionCallback;
 #[cfg(feature = "rapier3d")]
 pub(crate) use physics3d::debug_shapes_for_context as physics3d_debug_shapes;
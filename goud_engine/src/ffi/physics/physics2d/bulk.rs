@@ -0,0 +1,229 @@
+//! Bulk 2D body state transfer.
+//!
+//! Syncing many bodies with `goud_physics_get_position` and friends costs
+//! one FFI call and one registry lock per body per value.  These exports
+//! move the state of a whole span of bodies under a single lock.
+
+use crate::core::error::{set_last_error, GoudError};
+use crate::core::providers::types::BodyHandle;
+use crate::ffi::context::GoudContextId;
+use crate::ffi::types::FfiVec2;
+
+use super::super::physics2d_common::{with_provider, with_provider_mut};
+
+/// Reads position, velocity, and rotation for `count` bodies.
+///
+/// Element `i` of each output array receives the state of `handles[i]`.
+/// Any output may be null to skip that value.  Slots of handles that do not
+/// name a live body are zeroed, and an `InvalidHandle` error is recorded.
+///
+/// # Safety
+///
+/// `handles` must point to `count` readable `u64` values.  Each non-null
+/// output must point to `count` writable elements.
+///
+/// # Returns
+///
+/// The number of bodies read; 0 on error.
+#[no_mangle]
+pub unsafe extern "C" fn goud_physics_get_bodies(
+    ctx: GoudContextId,
+    handles: *const u64,
+    count: u32,
+    out_positions: *mut FfiVec2,
+    out_velocities: *mut FfiVec2,
+    out_rotations: *mut f32,
+) -> u32 {
+    if count == 0 {
+        return 0;
+    }
+    if handles.is_null() {
+        set_last_error(GoudError::InvalidState("handles is null".to_string()));
+        return 0;
+    }
+
+    with_provider(ctx, |p| {
+        let mut read = 0u32;
+        for i in 0..count as usize {
+            // SAFETY: Caller guarantees handles points to count values.
+            let handle = BodyHandle(*handles.add(i));
+            let state = p
+                .body_position(handle)
+                .and_then(|pos| Ok((pos, p.body_velocity(handle)?, p.body_rotation(handle)?)));
+            let (pos, vel, rot) = match state {
+                Ok(state) => {
+                    read += 1;
+                    state
+                }
+                Err(_) => ([0.0; 2], [0.0; 2], 0.0),
+            };
+            // SAFETY: Caller guarantees each non-null output holds count elements.
+            if !out_positions.is_null() {
+                *out_positions.add(i) = FfiVec2::new(pos[0], pos[1]);
+            }
+            if !out_velocities.is_null() {
+                *out_velocities.add(i) = FfiVec2::new(vel[0], vel[1]);
+            }
+            if !out_rotations.is_null() {
+                *out_rotations.add(i) = rot;
+            }
+        }
+        if read < count {
+            set_last_error(GoudError::InvalidHandle);
+        }
+        BulkCount(read)
+    })
+    .0
+}
+
+/// Sets the linear velocity of `count` bodies.
+///
+/// `velocities[i]` is applied to `handles[i]`.  Handles that do not name a
+/// live body are skipped, and an `InvalidHandle` error is recorded.
+///
+/// # Safety
+///
+/// `handles` and `velocities` must each point to `count` readable elements.
+///
+/// # Returns
+///
+/// The number of bodies updated; 0 on error.
+#[no_mangle]
+pub unsafe extern "C" fn goud_physics_set_velocities(
+    ctx: GoudContextId,
+    handles: *const u64,
+    count: u32,
+    velocities: *const FfiVec2,
+) -> u32 {
+    if count == 0 {
+        return 0;
+    }
+    if handles.is_null() || velocities.is_null() {
+        set_last_error(GoudError::InvalidState(
+            "handles or velocities is null".to_string(),
+        ));
+        return 0;
+    }
+
+    with_provider_mut(ctx, |p| {
+        let mut written = 0u32;
+        for i in 0..count as usize {
+            // SAFETY: Caller guarantees both arrays hold count elements.
+            let handle = BodyHandle(*handles.add(i));
+            let vel = *velocities.add(i);
+            if p.set_body_velocity(handle, [vel.x, vel.y]).is_ok() {
+                written += 1;
+            }
+        }
+        if written < count {
+            set_last_error(GoudError::InvalidHandle);
+        }
+        BulkCount(written)
+    })
+    .0
+}
+
+/// Body count returned from a provider closure; provider errors map to 0.
+struct BulkCount(u32);
+
+impl From<i32> for BulkCount {
+    fn from(_code: i32) -> Self {
+        Self(0)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::core::error::{last_error_code, ERR_INVALID_HANDLE};
+    use crate::ffi::context::{goud_context_create, goud_context_destroy};
+
+    use super::super::{
+        goud_physics_add_rigid_body, goud_physics_create_with_backend, goud_physics_destroy,
+        goud_physics_get_velocity,
+    };
+
+    struct PhysicsGuard(GoudContextId);
+
+    impl PhysicsGuard {
+        fn new() -> Self {
+            let ctx = goud_context_create();
+            assert_eq!(goud_physics_create_with_backend(ctx, 0.0, 0.0, 1), 0);
+            Self(ctx)
+        }
+    }
+
+    impl Drop for PhysicsGuard {
+        fn drop(&mut self) {
+            let _ = goud_physics_destroy(self.0);
+            let _ = goud_context_destroy(self.0);
+        }
+    }
+
+    #[test]
+    fn test_get_bodies_reads_state_and_zeroes_invalid_slots() {
+        let guard = PhysicsGuard::new();
+        let a = goud_physics_add_rigid_body(guard.0, 1, 1.0, 2.0, 0.0);
+        let b = goud_physics_add_rigid_body(guard.0, 1, 3.0, 4.0, 0.0);
+        assert!(a > 0 && b > 0);
+
+        let handles = [a as u64, u64::MAX, b as u64];
+        let mut positions = [FfiVec2::new(9.0, 9.0); 3];
+        let mut rotations = [9.0f32; 3];
+        // SAFETY: Every array holds handles.len() elements.
+        let read = unsafe {
+            goud_physics_get_bodies(
+                guard.0,
+                handles.as_ptr(),
+                handles.len() as u32,
+                positions.as_mut_ptr(),
+                std::ptr::null_mut(),
+                rotations.as_mut_ptr(),
+            )
+        };
+
+        assert_eq!(read, 2);
+        assert_eq!(last_error_code(), ERR_INVALID_HANDLE);
+        assert_eq!((positions[0].x, positions[0].y), (1.0, 2.0));
+        assert_eq!((positions[1].x, positions[1].y), (0.0, 0.0));
+        assert_eq!((positions[2].x, positions[2].y), (3.0, 4.0));
+        assert_eq!(rotations, [0.0; 3]);
+    }
+
+    #[test]
+    fn test_set_velocities_applies_per_handle() {
+        let guard = PhysicsGuard::new();
+        let a = goud_physics_add_rigid_body(guard.0, 1, 0.0, 0.0, 0.0);
+        let b = goud_physics_add_rigid_body(guard.0, 1, 5.0, 0.0, 0.0);
+
+        let handles = [a as u64, b as u64];
+        let velocities = [FfiVec2::new(1.0, 0.0), FfiVec2::new(0.0, -2.0)];
+        // SAFETY: Both arrays hold handles.len() elements.
+        let written = unsafe {
+            goud_physics_set_velocities(guard.0, handles.as_ptr(), 2, velocities.as_ptr())
+        };
+        assert_eq!(written, 2);
+
+        let (mut vx, mut vy) = (0.0f32, 0.0f32);
+        // SAFETY: Both out pointers reference live locals.
+        unsafe { goud_physics_get_velocity(guard.0, b as u64, &mut vx, &mut vy) };
+        assert_eq!((vx, vy), (0.0, -2.0));
+    }
+
+    #[test]
+    fn test_bulk_rejects_null_handles() {
+        let guard = PhysicsGuard::new();
+        // SAFETY: Null inputs are rejected before any dereference.
+        let read = unsafe {
+            goud_physics_get_bodies(
+                guard.0,
+                std::ptr::null(),
+                1,
+                std::ptr::null_mut(),
+                std::ptr::null_mut(),
+                std::ptr::null_mut(),
+            )
+        };
+        assert_eq!(read, 0);
+    }
+}
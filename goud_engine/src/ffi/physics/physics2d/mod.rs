@@ -1,9 +1,11 @@
 //! 2D physics FFI exports.
 //!
 //! Provides C-compatible functions for Rapier2D physics: body creation,
-//! collider attachment, forces, impulses, simulation stepping, and raycasting.
+//! collider attachment, forces, impulses, simulation stepping, raycasting, and
+//! bulk body state transfer.
 
 pub(crate) mod bodies;
+pub(crate) mod bulk;
 pub(crate) mod lifecycle;
 pub(crate) mod simulation;
 
@@ -11,6 +13,7 @@ pub use bodies::{
     goud_physics_add_collider, goud_physics_add_rigid_body, goud_physics_add_rigid_body_ex,
     goud_physics_create_joint, goud_physics_remove_body, goud_physics_remove_joint,
 };
+pub use bulk::{goud_physics_get_bodies, goud_physics_set_velocities};
 pub use lifecycle::{
     goud_physics_create, goud_physics_create_with_backend, goud_physics_destroy,
     goud_physics_set_gravity,
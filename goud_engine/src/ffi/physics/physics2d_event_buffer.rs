@@ -0,0 +1,175 @@
+//! Bulk collision event transfer for 2D physics FFI.
+//!
+//! `goud_physics_collision_events_read` costs one FFI call and one registry
+//! lock per event.  `goud_physics_collision_events_copy` writes the whole
+//! buffered event list of the last step into a caller array in one call,
+//! optionally keeping only events that involve a given collision layer.
+
+use crate::core::error::{set_last_error, GoudError};
+use crate::ffi::context::{GoudContextId, GOUD_INVALID_CONTEXT_ID};
+
+use super::physics2d_events::collision_kind_to_ffi;
+use super::physics2d_state::visit_collision_events;
+
+/// FFI-safe collision event.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct FfiCollisionEvent {
+    /// First body involved in the collision.
+    pub body_a: u64,
+    /// Second body involved in the collision.
+    pub body_b: u64,
+    /// 0 = Enter, 1 = Stay, 2 = Exit.
+    pub kind: u32,
+}
+
+/// Copies collision events captured by the last `goud_physics_step` call
+/// into `out_events`.
+///
+/// Only events where either body has a collider whose layer intersects
+/// `layer_mask` are copied; pass `u32::MAX` to copy every event.  Bodies
+/// added without `goud_physics_add_collider_ex` always match.  At most
+/// `capacity` events are written; a buffer sized by
+/// `goud_physics_collision_events_count` always holds every match.  The
+/// buffered events are not consumed.
+///
+/// # Safety
+///
+/// `out_events` must point to `capacity` writable `FfiCollisionEvent`s.
+///
+/// # Returns
+///
+/// The number of events written; 0 on error.
+#[no_mangle]
+pub unsafe extern "C" fn goud_physics_collision_events_copy(
+    ctx: GoudContextId,
+    layer_mask: u32,
+    out_events: *mut FfiCollisionEvent,
+    capacity: u32,
+) -> u32 {
+    if ctx == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return 0;
+    }
+    if capacity == 0 {
+        return 0;
+    }
+    if out_events.is_null() {
+        set_last_error(GoudError::InvalidState("out_events is null".to_string()));
+        return 0;
+    }
+
+    let mut written = 0u32;
+    visit_collision_events(ctx, layer_mask, |event| {
+        // SAFETY: written < capacity, and the caller guarantees capacity slots.
+        *out_events.add(written as usize) = FfiCollisionEvent {
+            body_a: event.body_a.0,
+            body_b: event.body_b.0,
+            kind: collision_kind_to_ffi(event.kind),
+        };
+        written += 1;
+        written < capacity
+    });
+    written
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::core::providers::types::{BodyHandle, CollisionEvent, CollisionEventKind};
+    use crate::ffi::context::{goud_context_create, goud_context_destroy};
+    use crate::ffi::physics::physics2d_state::{
+        capture_step_collision_events, clear_context, register_collider,
+    };
+
+    fn event(a: u64, b: u64, kind: CollisionEventKind) -> CollisionEvent {
+        CollisionEvent {
+            body_a: BodyHandle(a),
+            body_b: BodyHandle(b),
+            kind,
+        }
+    }
+
+    fn copy(ctx: GoudContextId, layer_mask: u32, capacity: usize) -> Vec<FfiCollisionEvent> {
+        let mut out = vec![FfiCollisionEvent::default(); capacity];
+        // SAFETY: out holds capacity elements.
+        let written = unsafe {
+            goud_physics_collision_events_copy(ctx, layer_mask, out.as_mut_ptr(), capacity as u32)
+        };
+        out.truncate(written as usize);
+        out
+    }
+
+    #[test]
+    fn test_collision_events_copy_writes_buffered_events_in_order() {
+        let ctx = goud_context_create();
+        let _ = capture_step_collision_events(
+            ctx,
+            vec![
+                event(1, 2, CollisionEventKind::Enter),
+                event(3, 4, CollisionEventKind::Stay),
+                event(1, 2, CollisionEventKind::Exit),
+            ],
+        );
+
+        let all = copy(ctx, u32::MAX, 8);
+        assert_eq!(all.len(), 3);
+        assert_eq!(
+            all.iter().map(|e| e.kind).collect::<Vec<_>>(),
+            vec![0, 1, 2]
+        );
+        assert_eq!((all[1].body_a, all[1].body_b), (3, 4));
+
+        assert_eq!(copy(ctx, u32::MAX, 2).len(), 2);
+        assert_eq!(copy(ctx, u32::MAX, 8).len(), 3, "copy must not consume");
+
+        clear_context(ctx);
+        assert!(goud_context_destroy(ctx));
+    }
+
+    #[test]
+    fn test_collision_events_copy_filters_by_layer_mask() {
+        let ctx = goud_context_create();
+        register_collider(ctx, 1, 101, 0b0001, u32::MAX, false);
+        register_collider(ctx, 2, 102, 0b0001, u32::MAX, false);
+        register_collider(ctx, 3, 103, 0b0010, u32::MAX, false);
+        register_collider(ctx, 4, 104, 0b0010, u32::MAX, false);
+        let _ = capture_step_collision_events(
+            ctx,
+            vec![
+                event(1, 2, CollisionEventKind::Enter),
+                event(3, 4, CollisionEventKind::Enter),
+            ],
+        );
+
+        let layer_two = copy(ctx, 0b0010, 8);
+        assert_eq!(layer_two.len(), 1);
+        assert_eq!((layer_two[0].body_a, layer_two[0].body_b), (3, 4));
+        assert!(copy(ctx, 0b0100, 8).is_empty());
+
+        clear_context(ctx);
+        assert!(goud_context_destroy(ctx));
+    }
+
+    #[test]
+    fn test_collision_events_copy_rejects_bad_arguments() {
+        // SAFETY: Invalid arguments are rejected before any write.
+        unsafe {
+            assert_eq!(
+                goud_physics_collision_events_copy(
+                    GOUD_INVALID_CONTEXT_ID,
+                    u32::MAX,
+                    std::ptr::null_mut(),
+                    4
+                ),
+                0
+            );
+            let ctx = goud_context_create();
+            assert_eq!(
+                goud_physics_collision_events_copy(ctx, u32::MAX, std::ptr::null_mut(), 4),
+                0
+            );
+            assert!(goud_context_destroy(ctx));
+        }
+    }
+}
@@ -16,7 +16,7 @@ use super::physics2d_state::{
     set_collision_callback, CollisionCallback,
 };
 
-fn collision_kind_to_ffi(kind: CollisionEventKind) -> u32 {
+pub(super) fn collision_kind_to_ffi(kind: CollisionEventKind) -> u32 {
     match kind {
         CollisionEventKind::Enter => 0,
         CollisionEventKind::Stay => 1,
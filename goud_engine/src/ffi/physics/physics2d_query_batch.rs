@@ -0,0 +1,377 @@
+//! Batched 2D physics queries.
+//!
+//! AI line-of-sight and trigger checks issue thousands of queries per tick.
+//! These exports answer a whole array of rays or boxes under one registry
+//! lock and write the results into caller-owned arrays.  Large batches are
+//! split across the engine's worker threads on native builds.
+//!
+//! Layer filtering is done by the provider against the layer each collider
+//! was created with (see `goud_physics_add_collider_ex`).
+
+use crate::core::error::{set_last_error, GoudError};
+use crate::core::providers::physics::PhysicsProvider;
+use crate::core::types::FfiRect;
+use crate::ffi::context::GoudContextId;
+
+use super::physics2d_common::with_provider;
+
+/// Queries per worker task; smaller batches run on the calling thread.
+#[cfg_attr(not(feature = "native"), allow(dead_code))]
+const PARALLEL_CHUNK: usize = 256;
+
+/// A ray for `goud_physics_raycast_batch`.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq)]
+pub struct FfiRay {
+    /// Ray origin X.
+    pub origin_x: f32,
+    /// Ray origin Y.
+    pub origin_y: f32,
+    /// Ray direction X.
+    pub dir_x: f32,
+    /// Ray direction Y.
+    pub dir_y: f32,
+    /// Maximum distance along the ray.
+    pub max_dist: f32,
+}
+
+/// Result of one ray in `goud_physics_raycast_batch`.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq)]
+pub struct FfiRaycastHit {
+    /// Body that was hit, or 0.
+    pub body: u64,
+    /// Collider that was hit, or 0.
+    pub collider: u64,
+    /// Hit point X.
+    pub point_x: f32,
+    /// Hit point Y.
+    pub point_y: f32,
+    /// Surface normal X.
+    pub normal_x: f32,
+    /// Surface normal Y.
+    pub normal_y: f32,
+    /// Distance from the ray origin to the hit point.
+    pub distance: f32,
+    /// 1 if the ray hit something, 0 otherwise.
+    pub hit: u32,
+}
+
+/// Query count returned from a provider closure; provider errors map to 0.
+struct QueryCount(u32);
+
+impl From<i32> for QueryCount {
+    fn from(_code: i32) -> Self {
+        Self(0)
+    }
+}
+
+fn cast_ray(provider: &dyn PhysicsProvider, ray: &FfiRay, layer_mask: u32) -> FfiRaycastHit {
+    if layer_mask == 0 || !ray.max_dist.is_finite() || ray.max_dist <= 0.0 {
+        return FfiRaycastHit::default();
+    }
+    provider
+        .raycast_with_mask(
+            [ray.origin_x, ray.origin_y],
+            [ray.dir_x, ray.dir_y],
+            ray.max_dist,
+            layer_mask,
+        )
+        .map_or_else(FfiRaycastHit::default, |hit| FfiRaycastHit {
+            body: hit.body.0,
+            collider: hit.collider.0,
+            point_x: hit.point[0],
+            point_y: hit.point[1],
+            normal_x: hit.normal[0],
+            normal_y: hit.normal[1],
+            distance: hit.distance,
+            hit: 1,
+        })
+}
+
+fn overlap_rect(provider: &dyn PhysicsProvider, rect: &FfiRect, layer_mask: u32) -> u64 {
+    if layer_mask == 0 {
+        return 0;
+    }
+    let max = [rect.x + rect.width, rect.y + rect.height];
+    provider
+        .overlap_aabb([rect.x, rect.y], max, layer_mask)
+        .first()
+        .map_or(0, |body| body.0)
+}
+
+/// Runs `query` for every input, in parallel chunks when the batch is large.
+fn run_batch<I: Sync, O: Send>(inputs: &[I], outputs: &mut [O], query: impl Fn(&I) -> O + Sync) {
+    #[cfg(feature = "native")]
+    if inputs.len() > PARALLEL_CHUNK {
+        use rayon::prelude::*;
+        inputs
+            .par_chunks(PARALLEL_CHUNK)
+            .zip(outputs.par_chunks_mut(PARALLEL_CHUNK))
+            .for_each(|(inputs, outputs)| {
+                for (input, output) in inputs.iter().zip(outputs) {
+                    *output = query(input);
+                }
+            });
+        return;
+    }
+    for (input, output) in inputs.iter().zip(outputs) {
+        *output = query(input);
+    }
+}
+
+/// Casts `count` rays and writes the first hit of each into `out_hits`.
+///
+/// `out_hits[i]` receives the result of `rays[i]`; misses are zeroed.  Rays
+/// with a non-positive or non-finite `max_dist` miss.  Only colliders on a
+/// layer in `layer_mask` are hit.
+///
+/// # Safety
+///
+/// `rays` must point to `count` readable `FfiRay`s and `out_hits` to
+/// `count` writable `FfiRaycastHit`s.
+///
+/// # Returns
+///
+/// The number of rays that hit; 0 on error.
+#[no_mangle]
+pub unsafe extern "C" fn goud_physics_raycast_batch(
+    ctx: GoudContextId,
+    rays: *const FfiRay,
+    count: u32,
+    layer_mask: u32,
+    out_hits: *mut FfiRaycastHit,
+) -> u32 {
+    if count == 0 {
+        return 0;
+    }
+    if rays.is_null() || out_hits.is_null() {
+        set_last_error(GoudError::InvalidState(
+            "rays or out_hits is null".to_string(),
+        ));
+        return 0;
+    }
+
+    // SAFETY: Caller guarantees both arrays hold count elements.
+    let rays = std::slice::from_raw_parts(rays, count as usize);
+    let hits = std::slice::from_raw_parts_mut(out_hits, count as usize);
+    with_provider(ctx, |p| {
+        run_batch(rays, hits, |ray| cast_ray(p, ray, layer_mask));
+        QueryCount(hits.iter().filter(|hit| hit.hit != 0).count() as u32)
+    })
+    .0
+}
+
+/// Tests `count` rectangles for overlap with any collider.
+///
+/// `out_bodies[i]` receives a body overlapping `rects[i]`, or 0 if none
+/// does.  Rectangles are given by their minimum corner and size, as in
+/// `FfiRect`.  Only colliders on a layer in `layer_mask` are considered.
+///
+/// # Safety
+///
+/// `rects` must point to `count` readable `FfiRect`s and `out_bodies` to
+/// `count` writable `u64`s.
+///
+/// # Returns
+///
+/// The number of rectangles that overlap a body; 0 on error.
+#[no_mangle]
+pub unsafe extern "C" fn goud_physics_overlap_rect_batch(
+    ctx: GoudContextId,
+    rects: *const FfiRect,
+    count: u32,
+    layer_mask: u32,
+    out_bodies: *mut u64,
+) -> u32 {
+    if count == 0 {
+        return 0;
+    }
+    if rects.is_null() || out_bodies.is_null() {
+        set_last_error(GoudError::InvalidState(
+            "rects or out_bodies is null".to_string(),
+        ));
+        return 0;
+    }
+
+    // SAFETY: Caller guarantees both arrays hold count elements.
+    let rects = std::slice::from_raw_parts(rects, count as usize);
+    let bodies = std::slice::from_raw_parts_mut(out_bodies, count as usize);
+    with_provider(ctx, |p| {
+        run_batch(rects, bodies, |rect| overlap_rect(p, rect, layer_mask));
+        QueryCount(bodies.iter().filter(|&&body| body != 0).count() as u32)
+    })
+    .0
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::ffi::context::{goud_context_create, goud_context_destroy};
+    use crate::ffi::physics::physics2d::{
+        goud_physics_add_rigid_body, goud_physics_create_with_backend, goud_physics_destroy,
+        goud_physics_step,
+    };
+    use crate::ffi::physics::physics2d_ex::goud_physics_add_collider_ex;
+
+    struct PhysicsGuard(GoudContextId);
+
+    impl PhysicsGuard {
+        /// Creates a Rapier world with a static box at (10, 0) on layer 0b01.
+        fn new() -> (Self, u64) {
+            let ctx = goud_context_create();
+            assert_eq!(goud_physics_create_with_backend(ctx, 0.0, 0.0, 1), 0);
+            let body = goud_physics_add_rigid_body(ctx, 0, 10.0, 0.0, 0.0);
+            assert!(body > 0);
+            let collider = goud_physics_add_collider_ex(
+                ctx,
+                body as u64,
+                1,
+                1.0,
+                1.0,
+                0.0,
+                0.5,
+                0.0,
+                false,
+                0b01,
+                u32::MAX,
+            );
+            assert!(collider > 0);
+            assert_eq!(goud_physics_step(ctx, 1.0 / 60.0), 0);
+            (Self(ctx), body as u64)
+        }
+    }
+
+    impl Drop for PhysicsGuard {
+        fn drop(&mut self) {
+            let _ = goud_physics_destroy(self.0);
+            let _ = goud_context_destroy(self.0);
+        }
+    }
+
+    fn ray(dir_x: f32, max_dist: f32) -> FfiRay {
+        FfiRay {
+            origin_x: 0.0,
+            origin_y: 0.0,
+            dir_x,
+            dir_y: 0.0,
+            max_dist,
+        }
+    }
+
+    #[test]
+    fn test_raycast_batch_writes_one_result_per_ray() {
+        let (guard, body) = PhysicsGuard::new();
+        let rays = [
+            ray(1.0, 100.0),
+            ray(-1.0, 100.0),
+            ray(1.0, 5.0),
+            ray(1.0, 0.0),
+        ];
+        let mut hits = [FfiRaycastHit::default(); 4];
+
+        // SAFETY: Both arrays hold rays.len() elements.
+        let count = unsafe {
+            goud_physics_raycast_batch(guard.0, rays.as_ptr(), 4, u32::MAX, hits.as_mut_ptr())
+        };
+
+        assert_eq!(count, 1);
+        assert_eq!((hits[0].hit, hits[0].body), (1, body));
+        assert!((hits[0].distance - 9.0).abs() < 1e-3);
+        assert!(hits[1..].iter().all(|hit| *hit == FfiRaycastHit::default()));
+
+        // SAFETY: Both arrays hold one element.
+        let filtered = unsafe {
+            goud_physics_raycast_batch(guard.0, rays.as_ptr(), 1, 0b10, hits.as_mut_ptr())
+        };
+        assert_eq!(filtered, 0);
+    }
+
+    #[test]
+    fn test_raycast_batch_large_batch_matches_single_rays() {
+        let (guard, body) = PhysicsGuard::new();
+        let rays: Vec<FfiRay> = (0..PARALLEL_CHUNK * 3 + 7)
+            .map(|i| ray(if i % 2 == 0 { 1.0 } else { -1.0 }, 100.0))
+            .collect();
+        let mut hits = vec![FfiRaycastHit::default(); rays.len()];
+
+        // SAFETY: Both vectors hold rays.len() elements.
+        let count = unsafe {
+            goud_physics_raycast_batch(
+                guard.0,
+                rays.as_ptr(),
+                rays.len() as u32,
+                u32::MAX,
+                hits.as_mut_ptr(),
+            )
+        };
+
+        assert_eq!(count as usize, rays.len().div_ceil(2));
+        for (i, hit) in hits.iter().enumerate() {
+            assert_eq!(hit.body, if i % 2 == 0 { body } else { 0 });
+        }
+    }
+
+    #[test]
+    fn test_overlap_rect_batch_reports_first_body() {
+        let (guard, body) = PhysicsGuard::new();
+        let rects = [
+            FfiRect {
+                x: 9.5,
+                y: -0.5,
+                width: 1.0,
+                height: 1.0,
+            },
+            FfiRect {
+                x: -5.0,
+                y: -5.0,
+                width: 1.0,
+                height: 1.0,
+            },
+        ];
+        let mut bodies = [u64::MAX; 2];
+
+        // SAFETY: Both arrays hold rects.len() elements.
+        let count = unsafe {
+            goud_physics_overlap_rect_batch(
+                guard.0,
+                rects.as_ptr(),
+                2,
+                u32::MAX,
+                bodies.as_mut_ptr(),
+            )
+        };
+
+        assert_eq!(count, 1);
+        assert_eq!(bodies, [body, 0]);
+    }
+
+    #[test]
+    fn test_query_batches_reject_null_arrays() {
+        let ctx = goud_context_create();
+        // SAFETY: Null arrays are rejected before any access.
+        unsafe {
+            assert_eq!(
+                goud_physics_raycast_batch(
+                    ctx,
+                    std::ptr::null(),
+                    1,
+                    u32::MAX,
+                    std::ptr::null_mut()
+                ),
+                0
+            );
+            assert_eq!(
+                goud_physics_overlap_rect_batch(
+                    ctx,
+                    std::ptr::null(),
+                    1,
+                    u32::MAX,
+                    std::ptr::null_mut()
+                ),
+                0
+            );
+        }
+        assert!(goud_context_destroy(ctx));
+    }
+}
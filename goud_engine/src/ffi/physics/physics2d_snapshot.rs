@@ -0,0 +1,295 @@
+//! 2D physics rollback FFI exports.
+//!
+//! Saved physics states are held engine-side behind `i64` handles so a
+//! rollback session can keep one per buffered frame without copying the
+//! simulation across the FFI boundary. Pair them with the world snapshots
+//! in `ffi::world_snapshot` to rewind a whole context.
+
+use std::any::Any;
+use std::collections::HashMap;
+use std::sync::Mutex;
+
+use crate::core::error::{set_last_error, GoudError, ERR_INTERNAL_ERROR};
+use crate::ffi::context::GoudContextId;
+
+use super::physics2d_common::{with_provider, with_provider_mut, INVALID_HANDLE};
+use super::physics2d_state::{load_filter_state, save_filter_state, FilterStateSnapshot};
+
+/// A provider snapshot plus the FFI layer's collider filters and buffered
+/// events, which must roll back with the bodies they refer to.
+struct PhysicsState {
+    provider: Box<dyn Any + Send + Sync>,
+    filters: FilterStateSnapshot,
+}
+
+struct PhysicsStateRegistry {
+    states: HashMap<i64, PhysicsState>,
+    next_handle: i64,
+}
+
+static PHYSICS_STATES: Mutex<Option<PhysicsStateRegistry>> = Mutex::new(None);
+
+fn with_states<R>(f: impl FnOnce(&mut PhysicsStateRegistry) -> R) -> Result<R, i32> {
+    let mut guard = PHYSICS_STATES.lock().map_err(|_| {
+        set_last_error(GoudError::InternalError(
+            "Failed to lock physics state registry".to_string(),
+        ));
+        ERR_INTERNAL_ERROR
+    })?;
+    Ok(f(guard.get_or_insert_with(|| PhysicsStateRegistry {
+        states: HashMap::new(),
+        next_handle: 1,
+    })))
+}
+
+fn unknown_state(state: i64) -> i32 {
+    let err = GoudError::InvalidState(format!("Unknown physics state handle {state}"));
+    let code = err.error_code();
+    set_last_error(err);
+    code
+}
+
+/// Captures `ctx`'s whole provider state, or reports why it cannot.
+fn capture(ctx: GoudContextId) -> Result<PhysicsState, i32> {
+    let mut captured = None;
+    let status: i32 = with_provider(ctx, |p| match p.save_state() {
+        Some(provider) => {
+            captured = Some(PhysicsState {
+                provider,
+                filters: save_filter_state(ctx),
+            });
+            0
+        }
+        None => {
+            let err =
+                GoudError::NotImplemented(format!("{} physics has no state snapshots", p.name()));
+            let code = err.error_code();
+            set_last_error(err);
+            code
+        }
+    });
+    captured.ok_or(status)
+}
+
+/// Saves the full 2D physics state of a context.
+///
+/// The state covers bodies, colliders, joints, contacts, solver caches,
+/// collider layers and masks, and undrained collision events. It stays valid until freed with
+/// `goud_physics_free_state` and can be loaded any number of times.
+///
+/// # Returns
+///
+/// A positive state handle, or -1 on failure.
+#[no_mangle]
+pub extern "C" fn goud_physics_save_state(ctx: GoudContextId) -> i64 {
+    let Ok(state) = capture(ctx) else {
+        return INVALID_HANDLE;
+    };
+    with_states(|registry| {
+        let handle = registry.next_handle;
+        registry.next_handle += 1;
+        registry.states.insert(handle, state);
+        handle
+    })
+    .unwrap_or(INVALID_HANDLE)
+}
+
+/// Overwrites an existing state handle with the context's current 2D
+/// physics state, for ring buffers that reuse one handle per frame slot.
+///
+/// # Returns
+///
+/// 0 on success, negative error code on failure.
+#[no_mangle]
+pub extern "C" fn goud_physics_save_state_into(ctx: GoudContextId, state: i64) -> i32 {
+    match with_states(|registry| registry.states.contains_key(&state)) {
+        Ok(true) => {}
+        Ok(false) => return unknown_state(state),
+        Err(code) => return code,
+    }
+    let captured = match capture(ctx) {
+        Ok(captured) => captured,
+        Err(code) => return code,
+    };
+    match with_states(|registry| registry.states.get_mut(&state).map(|s| *s = captured)) {
+        Ok(Some(())) => 0,
+        Ok(None) => unknown_state(state),
+        Err(code) => code,
+    }
+}
+
+/// Restores a context's 2D physics to a saved state.
+///
+/// Bodies created since the save are gone and their handles become
+/// invalid; removed bodies come back with their old handles and collider
+/// filters. Buffered collision events are replaced by the saved ones.
+///
+/// # Returns
+///
+/// 0 on success, negative error code on failure.
+#[no_mangle]
+pub extern "C" fn goud_physics_load_state(ctx: GoudContextId, state: i64) -> i32 {
+    let mut guard = match PHYSICS_STATES.lock() {
+        Ok(guard) => guard,
+        Err(_) => {
+            set_last_error(GoudError::InternalError(
+                "Failed to lock physics state registry".to_string(),
+            ));
+            return ERR_INTERNAL_ERROR;
+        }
+    };
+    let Some(saved) = guard.as_mut().and_then(|r| r.states.get(&state)) else {
+        drop(guard);
+        return unknown_state(state);
+    };
+    with_provider_mut(ctx, |p| match p.load_state(saved.provider.as_ref()) {
+        Ok(()) => {
+            load_filter_state(ctx, &saved.filters);
+            0
+        }
+        Err(err) => {
+            let code = err.error_code();
+            set_last_error(err);
+            code
+        }
+    })
+}
+
+/// Frees a saved 2D physics state.
+///
+/// # Returns
+///
+/// 0 on success, negative error code if the handle is unknown.
+#[no_mangle]
+pub extern "C" fn goud_physics_free_state(state: i64) -> i32 {
+    match with_states(|registry| registry.states.remove(&state).is_some()) {
+        Ok(true) => 0,
+        Ok(false) => unknown_state(state),
+        Err(code) => code,
+    }
+}
+
+/// Switches deterministic stepping on or off for a context's 2D physics.
+///
+/// While on, `goud_physics_step` ignores its `dt` argument and advances by
+/// the `goud_physics_set_timestep` value, and collision events are reported
+/// in a stable order, so peers that feed the same inputs stay in lockstep.
+///
+/// # Returns
+///
+/// 0 on success, negative error code on failure.
+#[no_mangle]
+pub extern "C" fn goud_physics_set_deterministic(ctx: GoudContextId, enabled: bool) -> i32 {
+    with_provider_mut(ctx, |p| match p.set_deterministic(enabled) {
+        Ok(()) => 0,
+        Err(err) => {
+            let code = err.error_code();
+            set_last_error(err);
+            code
+        }
+    })
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::core::providers::types::{BodyHandle, CollisionEvent, CollisionEventKind};
+    use crate::ffi::physics::physics2d_state::{
+        capture_step_collision_events, collider_matches_layer_mask, collision_event_count,
+    };
+    use crate::ffi::physics::{
+        goud_physics_add_collider_ex, goud_physics_add_rigid_body, goud_physics_create,
+        goud_physics_destroy, goud_physics_get_position, goud_physics_remove_body,
+        goud_physics_step,
+    };
+
+    fn position(ctx: GoudContextId, body: u64) -> (f32, f32) {
+        let (mut x, mut y) = (0.0, 0.0);
+        // SAFETY: both out pointers reference live stack values.
+        assert_eq!(
+            unsafe { goud_physics_get_position(ctx, body, &mut x, &mut y) },
+            0
+        );
+        (x, y)
+    }
+
+    #[test]
+    fn save_load_rewinds_the_simulation() {
+        let ctx = GoudContextId::new(9_100, 1);
+        assert_eq!(goud_physics_create(ctx, 0.0, -9.81), 0);
+        assert_eq!(goud_physics_set_deterministic(ctx, true), 0);
+        let body = goud_physics_add_rigid_body(ctx, 1, 0.0, 10.0, 0.0) as u64;
+
+        let state = goud_physics_save_state(ctx);
+        assert!(state > 0);
+        for _ in 0..8 {
+            assert_eq!(goud_physics_step(ctx, 1.0 / 60.0), 0);
+        }
+        let fallen = position(ctx, body);
+        assert!(fallen.1 < 10.0);
+
+        assert_eq!(goud_physics_load_state(ctx, state), 0);
+        assert_eq!(position(ctx, body), (0.0, 10.0));
+        for _ in 0..8 {
+            assert_eq!(goud_physics_step(ctx, 1.0), 0);
+        }
+        assert_eq!(position(ctx, body), fallen);
+
+        assert_eq!(goud_physics_save_state_into(ctx, state), 0);
+        assert_eq!(goud_physics_free_state(state), 0);
+        assert_ne!(goud_physics_free_state(state), 0);
+        assert_ne!(goud_physics_load_state(ctx, state), 0);
+        assert_eq!(goud_physics_destroy(ctx), 0);
+    }
+
+    fn add_box(ctx: GoudContextId, body: u64, layer: u32, mask: u32) -> u64 {
+        let collider =
+            goud_physics_add_collider_ex(ctx, body, 1, 0.5, 0.5, 0.0, 0.5, 0.0, false, layer, mask);
+        assert!(collider > 0);
+        collider as u64
+    }
+
+    #[test]
+    fn load_restores_collider_filters_and_buffered_events() {
+        let ctx = GoudContextId::new(9_102, 1);
+        assert_eq!(goud_physics_create(ctx, 0.0, 0.0), 0);
+        let a = goud_physics_add_rigid_body(ctx, 1, 0.0, 0.0, 0.0) as u64;
+        let b = goud_physics_add_rigid_body(ctx, 1, 0.5, 0.0, 0.0) as u64;
+        add_box(ctx, a, 0b01, 0b01);
+        let b_collider = add_box(ctx, b, 0b10, 0b10);
+        let state = goud_physics_save_state(ctx);
+        assert!(state > 0);
+
+        // Diverge: drop `b`, add a collider to `a` and buffer an event that
+        // only passes the filter because `b` lost its metadata.
+        assert_eq!(goud_physics_remove_body(ctx, b), 0);
+        let late_collider = add_box(ctx, a, 0b100, 0b100);
+        let pair = CollisionEvent {
+            body_a: BodyHandle(a),
+            body_b: BodyHandle(b),
+            kind: CollisionEventKind::Enter,
+        };
+        let (passed, _) = capture_step_collision_events(ctx, vec![pair]);
+        assert_eq!(passed.len(), 1);
+
+        assert_eq!(goud_physics_load_state(ctx, state), 0);
+        // Nothing from the abandoned timeline survives.
+        assert_eq!(collision_event_count(ctx), 0);
+        assert!(collider_matches_layer_mask(ctx, late_collider, 0));
+        // `b` is back on layer 0b10 only, so the a/b pair is filtered again.
+        assert!(!collider_matches_layer_mask(ctx, b_collider, 0b01));
+        assert!(collider_matches_layer_mask(ctx, b_collider, 0b10));
+        let (passed, _) = capture_step_collision_events(ctx, vec![pair]);
+        assert!(passed.is_empty());
+
+        assert_eq!(goud_physics_free_state(state), 0);
+        assert_eq!(goud_physics_destroy(ctx), 0);
+    }
+
+    #[test]
+    fn missing_provider_is_reported() {
+        let ctx = GoudContextId::new(9_101, 1);
+        assert_eq!(goud_physics_save_state(ctx), INVALID_HANDLE);
+        assert_ne!(goud_physics_set_deterministic(ctx, true), 0);
+    }
+}
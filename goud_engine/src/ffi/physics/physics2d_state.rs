@@ -74,6 +74,46 @@ fn event_passes_layer_filter(state: &ContextPhysics2DState, event: &CollisionEve
     })
 }
 
+/// Filter metadata and buffered events saved alongside a provider state,
+/// so a rollback restores them with the bodies they describe.
+#[derive(Clone, Default)]
+pub(super) struct FilterStateSnapshot {
+    collider_filters: HashMap<u64, ColliderFilterMeta>,
+    body_colliders: HashMap<u64, Vec<u64>>,
+    collision_events: Vec<CollisionEvent>,
+}
+
+pub(super) fn save_filter_state(ctx: GoudContextId) -> FilterStateSnapshot {
+    let Ok(guard) = registry().lock() else {
+        return FilterStateSnapshot::default();
+    };
+    guard
+        .contexts
+        .get(&ctx)
+        .map(|state| FilterStateSnapshot {
+            collider_filters: state.collider_filters.clone(),
+            body_colliders: state.body_colliders.clone(),
+            collision_events: state.collision_events.clone(),
+        })
+        .unwrap_or_default()
+}
+
+/// Replaces the context's filter metadata and buffered events, keeping its
+/// callback registration.
+pub(super) fn load_filter_state(ctx: GoudContextId, snapshot: &FilterStateSnapshot) {
+    let Ok(mut guard) = registry().lock() else {
+        return;
+    };
+    let state = guard.contexts.entry(ctx).or_default();
+    state
+        .collider_filters
+        .clone_from(&snapshot.collider_filters);
+    state.body_colliders.clone_from(&snapshot.body_colliders);
+    state
+        .collision_events
+        .clone_from(&snapshot.collision_events);
+}
+
 pub(super) fn clear_context(ctx: GoudContextId) {
     let Ok(mut guard) = registry().lock() else {
         return;
@@ -214,6 +254,46 @@ pub(super) fn collision_event_at(ctx: GoudContextId, index: usize) -> Option<Col
     state.collision_events.get(index).cloned()
 }
 
+fn body_on_layers(state: &ContextPhysics2DState, body_handle: u64, layer_mask: u32) -> bool {
+    let Some(colliders) = state.body_colliders.get(&body_handle) else {
+        return true;
+    };
+    colliders.iter().any(|collider| {
+        state
+            .collider_filters
+            .get(collider)
+            .is_none_or(|meta| (meta.layer & layer_mask) != 0)
+    })
+}
+
+/// Visits buffered events involving a body with a collider on `layer_mask`,
+/// under a single registry lock, until `sink` returns false.
+///
+/// Bodies without filter metadata always match, as in the step filter.
+pub(super) fn visit_collision_events(
+    ctx: GoudContextId,
+    layer_mask: u32,
+    mut sink: impl FnMut(&CollisionEvent) -> bool,
+) {
+    let Ok(guard) = registry().lock() else {
+        return;
+    };
+    let Some(state) = guard.contexts.get(&ctx) else {
+        return;
+    };
+
+    let matching = state.collision_events.iter().filter(|event| {
+        layer_mask == u32::MAX
+            || body_on_layers(state, event.body_a.0, layer_mask)
+            || body_on_layers(state, event.body_b.0, layer_mask)
+    });
+    for event in matching {
+        if !sink(event) {
+            break;
+        }
+    }
+}
+
 #[cfg(test)]
 mod tests {
     use super::{clear_context, collider_matches_layer_mask, register_collider};
@@ -10,8 +10,8 @@ pub mod queries;
 
 pub use lifecycle::{goud_entity_pool_create, goud_entity_pool_destroy};
 pub use operations::{
-    goud_entity_pool_acquire, goud_entity_pool_acquire_batch, goud_entity_pool_release,
-    goud_entity_pool_release_batch,
+    goud_entity_pool_acquire, goud_entity_pool_acquire_batch, goud_entity_pool_acquire_batch_slots,
+    goud_entity_pool_release, goud_entity_pool_release_batch,
 };
 pub use queries::{goud_entity_pool_stats, FfiPoolStats};
 
@@ -119,6 +119,85 @@ pub unsafe extern "C" fn goud_entity_pool_acquire_batch(
     acquired as u32
 }
 
+/// Acquires multiple entities from the pool and reports their slot indices.
+///
+/// Identical to `goud_entity_pool_acquire_batch`, but also writes the slot
+/// index of each acquired entry so callers can release them later with
+/// `goud_entity_pool_release_batch`.
+///
+/// # Arguments
+///
+/// * `handle` - The pool handle.
+/// * `count` - Number of entities to acquire.
+/// * `out_entities` - Optional caller-allocated buffer for entity IDs (u64).
+///   May be null when the caller only needs slot indices.
+/// * `out_slots` - Caller-allocated buffer for slot indices (u32).
+///
+/// # Returns
+///
+/// The number of entries actually acquired (may be less than `count`
+/// if the pool does not have enough available slots).
+///
+/// # Safety
+///
+/// `out_slots` must point to a buffer of at least `count` u32 values, or be
+/// null if `count` is 0. `out_entities` must be null or point to a buffer of
+/// at least `count` u64 values.
+#[no_mangle]
+pub unsafe extern "C" fn goud_entity_pool_acquire_batch_slots(
+    handle: u32,
+    count: u32,
+    out_entities: *mut u64,
+    out_slots: *mut u32,
+) -> u32 {
+    if handle == GOUD_INVALID_POOL_HANDLE {
+        set_last_error(GoudError::InvalidState("invalid pool handle".to_string()));
+        return 0;
+    }
+
+    if count > 0 && out_slots.is_null() {
+        set_last_error(GoudError::InvalidState(
+            "out_slots is null but count > 0".to_string(),
+        ));
+        return 0;
+    }
+
+    let mut reg = match registry::get().lock() {
+        Ok(r) => r,
+        Err(_) => {
+            set_last_error(GoudError::InternalError(
+                "Failed to lock pool registry".to_string(),
+            ));
+            return 0;
+        }
+    };
+
+    let pool = match reg.pools.get_mut(&handle) {
+        Some(p) => p,
+        None => {
+            set_last_error(GoudError::InvalidState("pool handle not found".to_string()));
+            return 0;
+        }
+    };
+
+    let mut acquired = 0usize;
+    while acquired < count as usize {
+        let Some((slot_index, entity_id)) = pool.acquire() else {
+            break;
+        };
+        // SAFETY: Caller guarantees out_slots points to at least `count` u32 values,
+        // and acquired < count.
+        *out_slots.add(acquired) = slot_index as u32;
+        if !out_entities.is_null() {
+            // SAFETY: Non-null out_entities points to at least `count` u64 values.
+            *out_entities.add(acquired) = entity_id;
+        }
+        acquired += 1;
+    }
+
+    acquired as u32
+}
+
 /// Releases an entity back to the pool by slot index.
 ///
 /// # Arguments
@@ -18,7 +18,7 @@ use crate::libs::graphics::backend::{
     BlendFactor, BufferOps, DrawOps, RenderBackend, ShaderLanguage, ShaderOps, StateOps, TextureOps,
 };
 
-use super::super::immediate::get_coordinate_origin;
+use super::super::immediate::{get_coordinate_origin, CoordinateOrigin};
 use super::super::texture::GoudTextureHandle;
 use super::internal::pixel_to_uv;
 
@@ -75,7 +75,7 @@ pub struct FfiSpriteCmd {
 
 #[repr(C)]
 #[derive(Clone, Copy, Debug)]
-struct BatchVertex {
+pub(super) struct BatchVertex {
     position: [f32; 2],
     tex_coords: [f32; 2],
     color: [f32; 4],
@@ -86,7 +86,7 @@ unsafe impl bytemuck::Pod for BatchVertex {}
 // SAFETY: BatchVertex contains only f32 arrays which are valid when zeroed.
 unsafe impl bytemuck::Zeroable for BatchVertex {}
 
-fn batch_vertex_layout() -> VertexLayout {
+pub(super) fn batch_vertex_layout() -> VertexLayout {
     VertexLayout::new(std::mem::size_of::<BatchVertex>() as u32)
         .with_attribute(VertexAttribute::new(
             0,
@@ -113,6 +113,73 @@ use super::batch_shaders::{
     BATCH_VERTEX_SHADER_WGSL,
 };
 
+// ============================================================================
+// Quad building shared with the static layer renderer
+// ============================================================================
+
+/// Converts a packed FFI texture handle into a backend texture handle.
+pub(super) fn texture_handle(texture: GoudTextureHandle) -> TextureHandle {
+    let index = (texture & 0xFFFFFFFF) as u32;
+    let generation = ((texture >> 32) & 0xFFFFFFFF) as u32;
+    TextureHandle::new(index, generation)
+}
+
+/// Appends the four corner vertices of `cmd` to `vertices`.
+pub(super) fn push_sprite_quad<B: TextureOps + ?Sized>(
+    backend: &B,
+    origin: CoordinateOrigin,
+    cmd: &FfiSpriteCmd,
+    vertices: &mut Vec<BatchVertex>,
+) {
+    // Resolve UVs from pixel source rect
+    let (uv_x, uv_y, uv_w, uv_h) = if cmd.src_w == 0.0 && cmd.src_h == 0.0 {
+        (0.0f32, 0.0f32, 1.0f32, 1.0f32)
+    } else {
+        match backend.texture_size(texture_handle(cmd.texture)) {
+            Some((tw, th)) => pixel_to_uv(cmd.src_x, cmd.src_y, cmd.src_w, cmd.src_h, tw, th),
+            None => (0.0, 0.0, 1.0, 1.0),
+        }
+    };
+
+    // Coordinate origin adjustment
+    let (cx, cy) = origin.adjust(cmd.x, cmd.y, cmd.width, cmd.height);
+
+    // Build 4 corner vertices (world-space) with rotation
+    let hw = cmd.width / 2.0;
+    let hh = cmd.height / 2.0;
+    let cos_r = cmd.rotation.cos();
+    let sin_r = cmd.rotation.sin();
+
+    let corners: [(f32, f32, f32, f32); 4] = [
+        (-hw, -hh, uv_x, uv_y),             // top-left
+        (hw, -hh, uv_x + uv_w, uv_y),       // top-right
+        (hw, hh, uv_x + uv_w, uv_y + uv_h), // bottom-right
+        (-hw, hh, uv_x, uv_y + uv_h),       // bottom-left
+    ];
+
+    for (lx, ly, u, v) in &corners {
+        let wx = cx + lx * cos_r - ly * sin_r;
+        let wy = cy + lx * sin_r + ly * cos_r;
+        vertices.push(BatchVertex {
+            position: [wx, wy],
+            tex_coords: [*u, *v],
+            color: [cmd.r, cmd.g, cmd.b, cmd.a],
+        });
+    }
+}
+
+/// Appends the two triangles of the quad starting at `base_index`.
+pub(super) fn push_quad_indices(indices: &mut Vec<u32>, base_index: u32) {
+    indices.extend_from_slice(&[
+        base_index,
+        base_index + 1,
+        base_index + 2,
+        base_index + 2,
+        base_index + 3,
+        base_index,
+    ]);
+}
+
 // ============================================================================
 // Thread-local batch GPU state (one per context, lazily initialized)
 // ============================================================================
@@ -196,70 +263,29 @@ pub unsafe extern "C" fn goud_renderer_draw_sprite_batch(
         let mut current_texture: Option<GoudTextureHandle> = None;
 
         let backend = window_state.backend_mut();
+        let pixel_scale = super::super::texture_streaming::framebuffer_pixel_scale(win_w, fb_w);
+        super::super::texture_streaming::note_sprite_batch(
+            context_id,
+            &*backend,
+            &sorted,
+            pixel_scale,
+        );
 
         for cmd in &sorted {
-            let tex_index = (cmd.texture & 0xFFFFFFFF) as u32;
-            let tex_generation = ((cmd.texture >> 32) & 0xFFFFFFFF) as u32;
-            let tex_handle = TextureHandle::new(tex_index, tex_generation);
-
-            // Resolve UVs from pixel source rect
-            let (uv_x, uv_y, uv_w, uv_h) = if cmd.src_w == 0.0 && cmd.src_h == 0.0 {
-                (0.0f32, 0.0f32, 1.0f32, 1.0f32)
-            } else {
-                match backend.texture_size(tex_handle) {
-                    Some((tw, th)) => {
-                        pixel_to_uv(cmd.src_x, cmd.src_y, cmd.src_w, cmd.src_h, tw, th)
-                    }
-                    None => (0.0, 0.0, 1.0, 1.0),
-                }
-            };
-
-            // Coordinate origin adjustment
-            let (cx, cy) = origin.adjust(cmd.x, cmd.y, cmd.width, cmd.height);
-
-            // Build 4 corner vertices (world-space) with rotation
-            let hw = cmd.width / 2.0;
-            let hh = cmd.height / 2.0;
-            let cos_r = cmd.rotation.cos();
-            let sin_r = cmd.rotation.sin();
-
-            let corners: [(f32, f32, f32, f32); 4] = [
-                (-hw, -hh, uv_x, uv_y),             // top-left
-                (hw, -hh, uv_x + uv_w, uv_y),       // top-right
-                (hw, hh, uv_x + uv_w, uv_y + uv_h), // bottom-right
-                (-hw, hh, uv_x, uv_y + uv_h),       // bottom-left
-            ];
-
             let base_index = vertices.len() as u32;
-            for (lx, ly, u, v) in &corners {
-                let wx = cx + lx * cos_r - ly * sin_r;
-                let wy = cy + lx * sin_r + ly * cos_r;
-                vertices.push(BatchVertex {
-                    position: [wx, wy],
-                    tex_coords: [*u, *v],
-                    color: [cmd.r, cmd.g, cmd.b, cmd.a],
-                });
-            }
+            push_sprite_quad(&*backend, origin, cmd, &mut vertices);
 
             // If texture changed, start a new batch
             if current_texture != Some(cmd.texture) {
                 batches.push(Batch {
-                    texture: tex_handle,
+                    texture: texture_handle(cmd.texture),
                     index_start: indices.len(),
                     index_count: 0,
                 });
                 current_texture = Some(cmd.texture);
             }
 
-            // Quad indices (two triangles)
-            indices.extend_from_slice(&[
-                base_index,
-                base_index + 1,
-                base_index + 2,
-                base_index + 2,
-                base_index + 3,
-                base_index,
-            ]);
+            push_quad_indices(&mut indices, base_index);
             if let Some(last) = batches.last_mut() {
                 last.index_count += 6;
             }
@@ -5,6 +5,7 @@ use crate::ffi::window::with_window_state;
 
 use super::super::immediate::get_coordinate_origin;
 use super::super::texture::GoudTextureHandle;
+use super::super::texture_streaming::note_sprite_draw;
 use super::helpers::{map_draw_result, prepare_draw_state, prepare_textured_draw_state};
 use super::internal::{draw_quad_internal, draw_sprite_internal, draw_sprite_rect_internal};
 
@@ -76,6 +77,7 @@ pub extern "C" fn goud_renderer_draw_sprite(
 
     let ok = map_draw_result(result);
     if ok {
+        note_sprite_draw(context_id, texture, width, height, 1.0, 1.0);
         let _ = debugger::update_render_stats_for_context(context_id, 1, 2, 1, 1);
     }
     ok
@@ -199,6 +201,7 @@ pub extern "C" fn goud_renderer_draw_sprite_rect(
 
     let ok = map_draw_result(result);
     if ok {
+        note_sprite_draw(context_id, texture, width, height, src_w, src_h);
         let _ = debugger::update_render_stats_for_context(context_id, 1, 2, 1, 1);
     }
     ok
@@ -1,7 +1,9 @@
 //! # Draw Command FFI
 //!
 //! Immediate-mode draw calls: sprites, sprite sheet rects, and colored quads.
-//! Also provides `goud_renderer_draw_sprite_batch` for batched GPU rendering.
+//! Also provides `goud_renderer_draw_sprite_batch` for batched GPU rendering
+//! and GPU-resident static sprite layers drawn without per-frame resubmission,
+//! plus chunked tilemaps that bake and cull those layers per chunk.
 
 mod batch;
 mod batch_shaders;
@@ -10,9 +12,23 @@ mod ffi;
 mod helpers;
 mod internal;
 mod network_overlay;
+mod static_layer;
+mod static_layer_ffi;
+mod tilemap;
+mod tilemap_ffi;
 
 pub use batch::{goud_renderer_draw_sprite_batch, FfiSpriteCmd};
 pub use ffi::{goud_renderer_draw_quad, goud_renderer_draw_sprite, goud_renderer_draw_sprite_rect};
+pub use static_layer::{GoudStaticLayerHandle, GOUD_INVALID_STATIC_LAYER};
+pub use static_layer_ffi::{
+    goud_static_layer_create, goud_static_layer_destroy, goud_static_layer_draw,
+    goud_static_layer_update,
+};
+pub use tilemap::{GoudTilemapHandle, GOUD_INVALID_TILEMAP, GOUD_TILEMAP_DEFAULT_CHUNK_SIZE};
+pub use tilemap_ffi::{
+    goud_tilemap_create, goud_tilemap_destroy, goud_tilemap_draw, goud_tilemap_set_tiles,
+};
 
 pub(crate) use debug::render_physics_debug_overlay;
 pub(crate) use network_overlay::render_network_debug_overlay;
+pub(crate) use static_layer::cleanup_static_layer_state;
@@ -0,0 +1,463 @@
+//! # Static Sprite Layers
+//!
+//! A static layer uploads a set of sprite commands once into GPU-resident
+//! vertex and index buffers and draws them with one call per frame.
+//! Backgrounds and tilemaps that never change skip the per-frame vertex
+//! build and upload of `goud_renderer_draw_sprite_batch`.  Changed command
+//! ranges are re-uploaded in place; the whole layer is re-sorted only when
+//! a change moves a sprite to another texture or z-layer.
+//! The per-context store also owns the chunked tilemaps of
+//! [`super::tilemap`], which draw their chunks with the same shader.
+
+use std::cell::RefCell;
+use std::collections::HashMap;
+
+use crate::core::error::{GoudError, GoudResult};
+use crate::ffi::context::GoudContextId;
+use crate::ffi::window::with_window_state;
+use crate::libs::graphics::backend::types::{
+    BufferHandle, BufferType, BufferUsage, PrimitiveTopology, ShaderHandle, TextureHandle,
+    VertexLayout,
+};
+use crate::libs::graphics::backend::{BlendFactor, RenderBackend, ShaderLanguage};
+
+use super::super::immediate::CoordinateOrigin;
+use super::batch::{
+    batch_vertex_layout, push_quad_indices, push_sprite_quad, texture_handle, BatchVertex,
+    FfiSpriteCmd,
+};
+use super::batch_shaders::{
+    BATCH_FRAGMENT_SHADER, STATIC_LAYER_FRAGMENT_SHADER_WGSL, STATIC_LAYER_VERTEX_SHADER,
+    STATIC_LAYER_VERTEX_SHADER_WGSL,
+};
+use super::tilemap::{GoudTilemapHandle, Tilemap, TilemapDrawStats};
+
+// ============================================================================
+// Handle types
+// ============================================================================
+
+/// Opaque static layer handle for FFI.
+pub type GoudStaticLayerHandle = u64;
+
+/// Invalid static layer handle constant.
+pub const GOUD_INVALID_STATIC_LAYER: GoudStaticLayerHandle = u64::MAX;
+
+// ============================================================================
+// Layer geometry
+// ============================================================================
+
+/// A run of quads sharing one texture, drawn with one indexed draw call.
+#[derive(Debug, Clone, Copy, PartialEq)]
+struct LayerBatch {
+    texture: TextureHandle,
+    index_start: usize,
+    index_count: usize,
+}
+
+/// CPU-side description of a layer's quads in draw order.
+struct LayerGeometry {
+    /// Quad slot of each command in draw order, indexed like the commands.
+    slots: Vec<u32>,
+    vertices: Vec<BatchVertex>,
+    indices: Vec<u32>,
+    batches: Vec<LayerBatch>,
+}
+
+/// Returns the draw order of `cmds`: by z-layer, then texture, then input order.
+fn draw_order(cmds: &[FfiSpriteCmd]) -> Vec<u32> {
+    let mut order: Vec<u32> = (0..cmds.len() as u32).collect();
+    order.sort_by(|&a, &b| {
+        let (a, b) = (&cmds[a as usize], &cmds[b as usize]);
+        a.z_layer
+            .cmp(&b.z_layer)
+            .then_with(|| a.texture.cmp(&b.texture))
+    });
+    order
+}
+
+fn build_geometry<B: RenderBackend + ?Sized>(
+    backend: &B,
+    origin: CoordinateOrigin,
+    cmds: &[FfiSpriteCmd],
+) -> LayerGeometry {
+    let order = draw_order(cmds);
+    let mut geometry = LayerGeometry {
+        slots: vec![0; cmds.len()],
+        vertices: Vec::with_capacity(cmds.len() * 4),
+        indices: Vec::with_capacity(cmds.len() * 6),
+        batches: Vec::new(),
+    };
+    let mut current_texture = None;
+    for (slot, &index) in order.iter().enumerate() {
+        let cmd = &cmds[index as usize];
+        geometry.slots[index as usize] = slot as u32;
+        push_sprite_quad(backend, origin, cmd, &mut geometry.vertices);
+        if current_texture != Some(cmd.texture) {
+            geometry.batches.push(LayerBatch {
+                texture: texture_handle(cmd.texture),
+                index_start: geometry.indices.len(),
+                index_count: 0,
+            });
+            current_texture = Some(cmd.texture);
+        }
+        push_quad_indices(&mut geometry.indices, slot as u32 * 4);
+        if let Some(last) = geometry.batches.last_mut() {
+            last.index_count += 6;
+        }
+    }
+    geometry
+}
+
+// ============================================================================
+// Static layer GPU state
+// ============================================================================
+
+pub(super) struct StaticLayer {
+    vertex_buffer: BufferHandle,
+    index_buffer: BufferHandle,
+    cmds: Vec<FfiSpriteCmd>,
+    slots: Vec<u32>,
+    vertices: Vec<BatchVertex>,
+    batches: Vec<LayerBatch>,
+}
+
+impl StaticLayer {
+    /// Builds the layer's geometry and uploads it into new GPU buffers.
+    pub(super) fn create<B: RenderBackend + ?Sized>(
+        backend: &mut B,
+        origin: CoordinateOrigin,
+        cmds: &[FfiSpriteCmd],
+    ) -> GoudResult<Self> {
+        let geometry = build_geometry(&*backend, origin, cmds);
+        let vertex_buffer = backend.create_buffer(
+            BufferType::Vertex,
+            BufferUsage::Static,
+            bytemuck::cast_slice(&geometry.vertices),
+        )?;
+        let index_buffer = match backend.create_buffer(
+            BufferType::Index,
+            BufferUsage::Static,
+            bytemuck::cast_slice(&geometry.indices),
+        ) {
+            Ok(buffer) => buffer,
+            Err(e) => {
+                let _ = backend.destroy_buffer(vertex_buffer);
+                return Err(e);
+            }
+        };
+        Ok(Self {
+            vertex_buffer,
+            index_buffer,
+            cmds: cmds.to_vec(),
+            slots: geometry.slots,
+            vertices: geometry.vertices,
+            batches: geometry.batches,
+        })
+    }
+
+    /// Number of sprites in the layer.
+    pub(super) fn len(&self) -> usize {
+        self.cmds.len()
+    }
+
+    /// Replaces the commands starting at `first` and re-uploads what changed.
+    ///
+    /// Changes that keep every sprite's texture and z-layer rewrite only the
+    /// vertices between the lowest and highest changed draw slots.  Any other
+    /// change re-sorts the layer and re-uploads all of it.  The caller checks
+    /// that the range lies inside the layer.
+    pub(super) fn update<B: RenderBackend + ?Sized>(
+        &mut self,
+        backend: &mut B,
+        origin: CoordinateOrigin,
+        first: usize,
+        cmds: &[FfiSpriteCmd],
+    ) -> GoudResult<()> {
+        let target = &mut self.cmds[first..first + cmds.len()];
+        let reorders = target
+            .iter()
+            .zip(cmds)
+            .any(|(old, new)| old.texture != new.texture || old.z_layer != new.z_layer);
+        target.copy_from_slice(cmds);
+
+        if reorders {
+            // Quads are indexed by draw slot, so the index buffer is unchanged.
+            let geometry = build_geometry(&*backend, origin, &self.cmds);
+            backend.update_buffer(
+                self.vertex_buffer,
+                0,
+                bytemuck::cast_slice(&geometry.vertices),
+            )?;
+            self.slots = geometry.slots;
+            self.vertices = geometry.vertices;
+            self.batches = geometry.batches;
+            return Ok(());
+        }
+
+        let (mut low, mut high) = (usize::MAX, 0);
+        let mut quad = Vec::with_capacity(4);
+        for (offset, cmd) in cmds.iter().enumerate() {
+            let slot = self.slots[first + offset] as usize;
+            quad.clear();
+            push_sprite_quad(&*backend, origin, cmd, &mut quad);
+            self.vertices[slot * 4..slot * 4 + 4].copy_from_slice(&quad);
+            low = low.min(slot);
+            high = high.max(slot);
+        }
+        if low > high {
+            return Ok(());
+        }
+        let dirty = &self.vertices[low * 4..(high + 1) * 4];
+        backend.update_buffer(
+            self.vertex_buffer,
+            low * 4 * std::mem::size_of::<BatchVertex>(),
+            bytemuck::cast_slice(dirty),
+        )
+    }
+
+    /// Draws the layer shifted by `offset`; returns (sprites, draw calls).
+    pub(super) fn draw<B: RenderBackend + ?Sized>(
+        &self,
+        backend: &mut B,
+        shader: &StaticLayerShader,
+        viewport: [f32; 2],
+        offset: [f32; 2],
+    ) -> GoudResult<(u32, u32)> {
+        backend.bind_default_vertex_array();
+        backend.bind_buffer(self.vertex_buffer)?;
+        backend.bind_buffer(self.index_buffer)?;
+        backend.set_vertex_attributes(&shader.vertex_layout);
+        backend.bind_shader(shader.shader)?;
+        backend.set_uniform_vec2(shader.u_viewport, viewport[0], viewport[1]);
+        backend.set_uniform_vec2(shader.u_offset, offset[0], offset[1]);
+        backend.set_uniform_int(shader.u_texture, 0);
+
+        for batch in &self.batches {
+            backend.bind_texture(batch.texture, 0)?;
+            backend.draw_indexed(
+                PrimitiveTopology::Triangles,
+                batch.index_count as u32,
+                batch.index_start * std::mem::size_of::<u32>(),
+            )?;
+        }
+        Ok((self.cmds.len() as u32, self.batches.len() as u32))
+    }
+
+    pub(super) fn destroy<B: RenderBackend + ?Sized>(&self, backend: &mut B) {
+        let _ = backend.destroy_buffer(self.vertex_buffer);
+        let _ = backend.destroy_buffer(self.index_buffer);
+    }
+}
+
+/// Shader shared by every static layer and tilemap of a context.
+pub(super) struct StaticLayerShader {
+    shader: ShaderHandle,
+    vertex_layout: VertexLayout,
+    u_viewport: i32,
+    u_offset: i32,
+    u_texture: i32,
+}
+
+impl StaticLayerShader {
+    pub(super) fn create<B: RenderBackend + ?Sized>(backend: &mut B) -> GoudResult<Self> {
+        let (vert_src, frag_src) = match backend.shader_language() {
+            ShaderLanguage::Wgsl => (
+                STATIC_LAYER_VERTEX_SHADER_WGSL,
+                STATIC_LAYER_FRAGMENT_SHADER_WGSL,
+            ),
+            ShaderLanguage::Glsl => (STATIC_LAYER_VERTEX_SHADER, BATCH_FRAGMENT_SHADER),
+        };
+        let shader = backend.create_shader(vert_src, frag_src)?;
+        Ok(Self {
+            shader,
+            vertex_layout: batch_vertex_layout(),
+            u_viewport: backend
+                .get_uniform_location(shader, "u_viewport")
+                .unwrap_or(-1),
+            u_offset: backend
+                .get_uniform_location(shader, "u_offset")
+                .unwrap_or(-1),
+            u_texture: backend
+                .get_uniform_location(shader, "u_texture")
+                .unwrap_or(-1),
+        })
+    }
+}
+
+// ============================================================================
+// Thread-local layer storage (one store per context)
+// ============================================================================
+
+pub(super) struct StaticLayerStore {
+    layers: HashMap<u64, StaticLayer>,
+    tilemaps: HashMap<u64, Tilemap>,
+    next_id: u64,
+    shader: Option<StaticLayerShader>,
+}
+
+impl StaticLayerStore {
+    pub(super) fn new() -> Self {
+        Self {
+            layers: HashMap::new(),
+            tilemaps: HashMap::new(),
+            next_id: 1,
+            shader: None,
+        }
+    }
+
+    pub(super) fn insert(&mut self, layer: StaticLayer) -> GoudStaticLayerHandle {
+        let id = self.next_id;
+        self.next_id += 1;
+        self.layers.insert(id, layer);
+        id
+    }
+
+    pub(super) fn insert_tilemap(&mut self, tilemap: Tilemap) -> GoudTilemapHandle {
+        let id = self.next_id;
+        self.next_id += 1;
+        self.tilemaps.insert(id, tilemap);
+        id
+    }
+
+    pub(super) fn tilemap_mut(&mut self, handle: GoudTilemapHandle) -> Option<&mut Tilemap> {
+        self.tilemaps.get_mut(&handle)
+    }
+
+    pub(super) fn get_mut(&mut self, handle: GoudStaticLayerHandle) -> Option<&mut StaticLayer> {
+        self.layers.get_mut(&handle)
+    }
+
+    pub(super) fn remove(&mut self, handle: GoudStaticLayerHandle) -> Option<StaticLayer> {
+        self.layers.remove(&handle)
+    }
+
+    /// Draws one layer, creating the shared shader on first use.
+    ///
+    /// Returns `None` for an unknown handle, otherwise (sprites, draw calls).
+    pub(super) fn draw<B: RenderBackend + ?Sized>(
+        &mut self,
+        backend: &mut B,
+        handle: GoudStaticLayerHandle,
+        viewport: [f32; 2],
+        offset: [f32; 2],
+    ) -> Option<GoudResult<(u32, u32)>> {
+        let layer = self.layers.get(&handle)?;
+        let shader = match Self::shader(&mut self.shader, backend) {
+            Ok(shader) => shader,
+            Err(e) => return Some(Err(e)),
+        };
+        Some(layer.draw(backend, shader, viewport, offset))
+    }
+
+    /// Draws the visible chunks of one tilemap, rebuilding dirty ones.
+    ///
+    /// Returns `None` for an unknown handle.
+    pub(super) fn draw_tilemap<B: RenderBackend + ?Sized>(
+        &mut self,
+        backend: &mut B,
+        handle: GoudTilemapHandle,
+        viewport: [f32; 2],
+        offset: [f32; 2],
+    ) -> Option<GoudResult<TilemapDrawStats>> {
+        let tilemap = self.tilemaps.get_mut(&handle)?;
+        let shader = match Self::shader(&mut self.shader, backend) {
+            Ok(shader) => shader,
+            Err(e) => return Some(Err(e)),
+        };
+        Some(tilemap.draw(backend, shader, viewport, offset))
+    }
+
+    /// Creates the shared shader on first use and sets the blend state.
+    fn shader<'a, B: RenderBackend + ?Sized>(
+        slot: &'a mut Option<StaticLayerShader>,
+        backend: &mut B,
+    ) -> GoudResult<&'a StaticLayerShader> {
+        if slot.is_none() {
+            *slot = Some(StaticLayerShader::create(backend)?);
+        }
+        backend.enable_blending();
+        backend.set_blend_func(BlendFactor::SrcAlpha, BlendFactor::OneMinusSrcAlpha);
+        slot.as_ref()
+            .ok_or_else(|| GoudError::InternalError("static layer shader missing".into()))
+    }
+
+    /// Destroys every layer's and tilemap's buffers and the shared shader.
+    fn destroy_all<B: RenderBackend + ?Sized>(&mut self, backend: &mut B) {
+        for (_, layer) in self.layers.drain() {
+            layer.destroy(backend);
+        }
+        for (_, mut tilemap) in self.tilemaps.drain() {
+            tilemap.destroy(backend);
+        }
+        if let Some(shader) = self.shader.take() {
+            let _ = backend.destroy_shader(shader.shader);
+        }
+    }
+
+    pub(super) fn destroy_layer<B: RenderBackend + ?Sized>(
+        &mut self,
+        backend: &mut B,
+        handle: GoudStaticLayerHandle,
+    ) -> bool {
+        match self.remove(handle) {
+            Some(layer) => {
+                layer.destroy(backend);
+                true
+            }
+            None => false,
+        }
+    }
+
+    pub(super) fn destroy_tilemap<B: RenderBackend + ?Sized>(
+        &mut self,
+        backend: &mut B,
+        handle: GoudTilemapHandle,
+    ) -> bool {
+        match self.tilemaps.remove(&handle) {
+            Some(mut tilemap) => {
+                tilemap.destroy(backend);
+                true
+            }
+            None => false,
+        }
+    }
+}
+
+type ContextKey = (u32, u32);
+
+thread_local! {
+    static STATIC_LAYER_STORES: RefCell<HashMap<ContextKey, StaticLayerStore>> =
+        RefCell::new(HashMap::new());
+}
+
+fn context_key(id: GoudContextId) -> ContextKey {
+    (id.index(), id.generation())
+}
+
+pub(super) fn with_store<F, R>(context_id: GoudContextId, f: F) -> R
+where
+    F: FnOnce(&mut StaticLayerStore) -> R,
+{
+    STATIC_LAYER_STORES.with(|cell| {
+        let mut stores = cell.borrow_mut();
+        let store = stores
+            .entry(context_key(context_id))
+            .or_insert_with(StaticLayerStore::new);
+        f(store)
+    })
+}
+
+/// Removes all static layers and tilemaps for a context, destroying their GPU buffers.
+///
+/// Called during `goud_window_destroy` to prevent GPU resource leaks.
+pub(crate) fn cleanup_static_layer_state(context_id: GoudContextId) {
+    let removed =
+        STATIC_LAYER_STORES.with(|cell| cell.borrow_mut().remove(&context_key(context_id)));
+    if let Some(mut store) = removed {
+        with_window_state(context_id, |state| store.destroy_all(state.backend_mut()));
+    }
+}
+
+#[cfg(test)]
+#[path = "static_layer_tests.rs"]
+mod tests;
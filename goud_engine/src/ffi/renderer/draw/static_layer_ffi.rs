@@ -0,0 +1,222 @@
+//! Static sprite layer FFI function implementations.
+
+use crate::core::debugger;
+use crate::core::error::{set_last_error, GoudError};
+use crate::ffi::context::{GoudContextId, GOUD_INVALID_CONTEXT_ID};
+use crate::ffi::window::with_window_state;
+use crate::libs::graphics::backend::StateOps;
+
+use super::super::immediate::get_coordinate_origin;
+use super::batch::FfiSpriteCmd;
+use super::static_layer::{
+    with_store, GoudStaticLayerHandle, StaticLayer, GOUD_INVALID_STATIC_LAYER,
+};
+
+/// Uploads `count` sprite commands into a new static layer.
+///
+/// The commands are sorted by `z_layer` then texture and written once into
+/// GPU buffers; `goud_static_layer_draw` then draws them every frame with no
+/// per-sprite work.  Positions are resolved with the coordinate origin in
+/// effect when the layer is created or updated.
+///
+/// # Returns
+///
+/// A layer handle, or `GOUD_INVALID_STATIC_LAYER` on error.
+///
+/// # Safety
+///
+/// `cmds` must point to `count` valid `FfiSpriteCmd` values for the call duration.
+#[no_mangle]
+pub unsafe extern "C" fn goud_static_layer_create(
+    context_id: GoudContextId,
+    cmds: *const FfiSpriteCmd,
+    count: u32,
+) -> GoudStaticLayerHandle {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return GOUD_INVALID_STATIC_LAYER;
+    }
+    if cmds.is_null() || count == 0 {
+        set_last_error(GoudError::InvalidState(
+            "cmds pointer is null or count is 0".into(),
+        ));
+        return GOUD_INVALID_STATIC_LAYER;
+    }
+
+    // SAFETY: caller guarantees `cmds` points to `count` valid FfiSpriteCmds.
+    let cmds_slice = std::slice::from_raw_parts(cmds, count as usize);
+    let origin = get_coordinate_origin(context_id);
+
+    let result = with_window_state(context_id, |state| {
+        StaticLayer::create(state.backend_mut(), origin, cmds_slice)
+    });
+    match result {
+        Some(Ok(layer)) => with_store(context_id, |store| store.insert(layer)),
+        Some(Err(e)) => {
+            set_last_error(e);
+            GOUD_INVALID_STATIC_LAYER
+        }
+        None => {
+            set_last_error(GoudError::InvalidContext);
+            GOUD_INVALID_STATIC_LAYER
+        }
+    }
+}
+
+/// Replaces `count` commands of a static layer, starting at command `first`.
+///
+/// Command indices follow the order passed to `goud_static_layer_create`.
+/// Changes that keep each sprite's texture and `z_layer` re-upload only the
+/// vertices of the changed sprites; other changes re-sort and re-upload the
+/// whole layer.
+///
+/// # Returns
+///
+/// 0 on success, or the error code on failure.
+///
+/// # Safety
+///
+/// `cmds` must point to `count` valid `FfiSpriteCmd` values for the call duration.
+#[no_mangle]
+pub unsafe extern "C" fn goud_static_layer_update(
+    context_id: GoudContextId,
+    layer: GoudStaticLayerHandle,
+    first: u32,
+    cmds: *const FfiSpriteCmd,
+    count: u32,
+) -> i32 {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return GoudError::InvalidContext.error_code();
+    }
+    if count == 0 {
+        return 0;
+    }
+    if cmds.is_null() {
+        let error = GoudError::InvalidState("cmds pointer is null".into());
+        let code = error.error_code();
+        set_last_error(error);
+        return code;
+    }
+
+    // SAFETY: caller guarantees `cmds` points to `count` valid FfiSpriteCmds.
+    let cmds_slice = std::slice::from_raw_parts(cmds, count as usize);
+    let origin = get_coordinate_origin(context_id);
+
+    let result = with_store(context_id, |store| {
+        let Some(static_layer) = store.get_mut(layer) else {
+            return Err(GoudError::InvalidHandle);
+        };
+        let end = first as usize + cmds_slice.len();
+        if end > static_layer.len() {
+            return Err(GoudError::InvalidState(format!(
+                "update range {first}..{end} exceeds layer of {} sprites",
+                static_layer.len()
+            )));
+        }
+        with_window_state(context_id, |state| {
+            static_layer.update(state.backend_mut(), origin, first as usize, cmds_slice)
+        })
+        .unwrap_or(Err(GoudError::InvalidContext))
+    });
+    match result {
+        Ok(()) => 0,
+        Err(e) => {
+            let code = e.error_code();
+            set_last_error(e);
+            code
+        }
+    }
+}
+
+/// Draws a static layer with every sprite shifted by (`offset_x`, `offset_y`).
+///
+/// Pass the negated camera position as the offset to scroll a background.
+/// Each texture run in the layer costs one indexed draw call and no vertex
+/// upload.
+///
+/// # Returns
+///
+/// Number of sprites drawn (0 on error).
+#[no_mangle]
+pub extern "C" fn goud_static_layer_draw(
+    context_id: GoudContextId,
+    layer: GoudStaticLayerHandle,
+    offset_x: f32,
+    offset_y: f32,
+) -> u32 {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return 0;
+    }
+
+    let result = with_window_state(context_id, |state| {
+        let (win_w, win_h) = state.get_size();
+        let (fb_w, fb_h) = state.get_framebuffer_size();
+        let backend = state.backend_mut();
+        backend.set_viewport(0, 0, fb_w, fb_h);
+        with_store(context_id, |store| {
+            store.draw(
+                backend,
+                layer,
+                [win_w as f32, win_h as f32],
+                [offset_x, offset_y],
+            )
+        })
+    });
+
+    match result {
+        Some(Some(Ok((drawn, draw_calls)))) => {
+            let _ = debugger::update_render_stats_for_context(
+                context_id,
+                draw_calls,
+                drawn * 2,
+                draw_calls,
+                1,
+            );
+            drawn
+        }
+        Some(Some(Err(e))) => {
+            set_last_error(e);
+            0
+        }
+        Some(None) => {
+            set_last_error(GoudError::InvalidHandle);
+            0
+        }
+        None => {
+            set_last_error(GoudError::InvalidContext);
+            0
+        }
+    }
+}
+
+/// Destroys a static layer and frees its GPU buffers.
+///
+/// Returns `true` if the layer existed.
+#[no_mangle]
+pub extern "C" fn goud_static_layer_destroy(
+    context_id: GoudContextId,
+    layer: GoudStaticLayerHandle,
+) -> bool {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return false;
+    }
+    let destroyed = with_window_state(context_id, |state| {
+        with_store(context_id, |store| {
+            store.destroy_layer(state.backend_mut(), layer)
+        })
+    });
+    match destroyed {
+        Some(true) => true,
+        Some(false) => {
+            set_last_error(GoudError::InvalidHandle);
+            false
+        }
+        None => {
+            set_last_error(GoudError::InvalidContext);
+            false
+        }
+    }
+}
@@ -0,0 +1,140 @@
+//! Tests for static sprite layer geometry, partial updates, and drawing.
+
+use super::*;
+use crate::libs::graphics::backend::null::NullBackend;
+use crate::libs::graphics::backend::types::{TextureFilter, TextureFormat, TextureWrap};
+use crate::libs::graphics::backend::TextureOps;
+
+fn cmd(texture: u64, x: f32, z_layer: i32) -> FfiSpriteCmd {
+    FfiSpriteCmd {
+        texture,
+        x,
+        y: 0.0,
+        width: 10.0,
+        height: 10.0,
+        rotation: 0.0,
+        src_x: 0.0,
+        src_y: 0.0,
+        src_w: 0.0,
+        src_h: 0.0,
+        r: 1.0,
+        g: 1.0,
+        b: 1.0,
+        a: 1.0,
+        z_layer,
+        _padding: 0,
+    }
+}
+
+fn texture(backend: &mut NullBackend) -> u64 {
+    backend
+        .create_texture(
+            4,
+            4,
+            TextureFormat::RGBA8,
+            TextureFilter::Linear,
+            TextureWrap::Repeat,
+            &[],
+        )
+        .unwrap()
+        .to_u64()
+}
+
+fn quad_x(layer: &StaticLayer, index: usize) -> f32 {
+    let slot = layer.slots[index] as usize;
+    layer.vertices[slot * 4].position[0]
+}
+
+#[test]
+fn test_draw_order_sorts_by_layer_then_texture_and_keeps_input_order() {
+    let cmds = [
+        cmd(2, 0.0, 1),
+        cmd(1, 1.0, 1),
+        cmd(2, 2.0, 0),
+        cmd(1, 3.0, 1),
+    ];
+    assert_eq!(draw_order(&cmds), vec![2, 1, 3, 0]);
+}
+
+#[test]
+fn test_create_groups_texture_runs_into_batches() {
+    let mut backend = NullBackend::new();
+    let cmds = [cmd(1, 0.0, 0), cmd(2, 10.0, 0), cmd(1, 20.0, 0)];
+    let layer = StaticLayer::create(&mut backend, CoordinateOrigin::TopLeft, &cmds).unwrap();
+
+    assert_eq!(layer.len(), 3);
+    assert_eq!(layer.vertices.len(), 12);
+    assert_eq!(layer.batches.len(), 2);
+    assert_eq!(layer.batches[0].index_count, 12);
+    assert_eq!(layer.batches[1].index_start, 12);
+    assert_eq!(quad_x(&layer, 2), 20.0);
+}
+
+#[test]
+fn test_update_in_place_keeps_draw_order() {
+    let mut backend = NullBackend::new();
+    let cmds = [cmd(1, 0.0, 0), cmd(2, 10.0, 0), cmd(1, 20.0, 0)];
+    let mut layer = StaticLayer::create(&mut backend, CoordinateOrigin::TopLeft, &cmds).unwrap();
+    let slots = layer.slots.clone();
+
+    layer
+        .update(
+            &mut backend,
+            CoordinateOrigin::TopLeft,
+            1,
+            &[cmd(2, 55.0, 0)],
+        )
+        .unwrap();
+    assert_eq!(layer.slots, slots);
+    assert_eq!(quad_x(&layer, 1), 55.0);
+    assert_eq!(quad_x(&layer, 0), 0.0);
+}
+
+#[test]
+fn test_update_that_changes_texture_resorts_layer() {
+    let mut backend = NullBackend::new();
+    let cmds = [cmd(1, 0.0, 0), cmd(2, 10.0, 0), cmd(1, 20.0, 0)];
+    let mut layer = StaticLayer::create(&mut backend, CoordinateOrigin::TopLeft, &cmds).unwrap();
+
+    layer
+        .update(
+            &mut backend,
+            CoordinateOrigin::TopLeft,
+            1,
+            &[cmd(1, 10.0, 0)],
+        )
+        .unwrap();
+    assert_eq!(layer.batches.len(), 1);
+    assert_eq!(layer.batches[0].index_count, 18);
+    assert_eq!(quad_x(&layer, 1), 10.0);
+}
+
+#[test]
+fn test_store_draw_issues_one_call_per_batch() {
+    let mut backend = NullBackend::new();
+    let mut store = StaticLayerStore::new();
+    let (grass, sky) = (texture(&mut backend), texture(&mut backend));
+    let cmds = [cmd(grass, 0.0, 0), cmd(sky, 10.0, 1)];
+    let layer = StaticLayer::create(&mut backend, CoordinateOrigin::TopLeft, &cmds).unwrap();
+    let handle = store.insert(layer);
+
+    let drawn = store
+        .draw(&mut backend, handle, [800.0, 600.0], [-5.0, 0.0])
+        .unwrap()
+        .unwrap();
+    assert_eq!(drawn, (2, 2));
+    assert_eq!(backend.draw_indexed_calls(), 2);
+    assert_eq!(backend.shader_create_calls(), 1);
+
+    store
+        .draw(&mut backend, handle, [800.0, 600.0], [0.0, 0.0])
+        .unwrap()
+        .unwrap();
+    assert_eq!(backend.shader_create_calls(), 1, "the shader is shared");
+
+    assert!(store
+        .draw(&mut backend, handle + 1, [1.0, 1.0], [0.0, 0.0])
+        .is_none());
+    assert!(store.destroy_layer(&mut backend, handle));
+    assert!(!store.destroy_layer(&mut backend, handle));
+}
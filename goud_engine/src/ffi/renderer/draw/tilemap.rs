@@ -0,0 +1,403 @@
+//! # Chunked Tilemaps
+//!
+//! A tilemap stores one tile ID per cell and splits the grid into square
+//! chunks.  Each chunk is baked into its own static layer (see
+//! [`super::static_layer`]) the first time it becomes visible, and only
+//! chunks whose tiles changed are rebuilt.  Because the chunks form a regular
+//! grid, the chunks overlapping the viewport are found by index arithmetic;
+//! chunks outside it are skipped without touching their tiles and count as
+//! culled in the frame's render metrics.  Baked chunks that scroll more than
+//! one chunk out of view release their GPU buffers, so resident memory
+//! follows the viewport rather than the map size.
+
+use crate::core::error::{GoudError, GoudResult};
+use crate::libs::graphics::backend::RenderBackend;
+
+use super::super::immediate::CoordinateOrigin;
+use super::batch::{texture_handle, FfiSpriteCmd};
+use super::static_layer::{StaticLayer, StaticLayerShader};
+
+// ============================================================================
+// Handle types
+// ============================================================================
+
+/// Opaque tilemap handle for FFI.
+pub type GoudTilemapHandle = u64;
+
+/// Invalid tilemap handle constant.
+pub const GOUD_INVALID_TILEMAP: GoudTilemapHandle = u64::MAX;
+
+/// Chunk edge length, in tiles, used when `goud_tilemap_create` is given 0.
+pub const GOUD_TILEMAP_DEFAULT_CHUNK_SIZE: u32 = 32;
+
+/// Largest accepted chunk edge length, in tiles.
+const MAX_CHUNK_SIZE: u32 = 256;
+
+// ============================================================================
+// Tilemap state
+// ============================================================================
+
+/// One chunk of the grid and its baked geometry.
+#[derive(Default)]
+struct TileChunk {
+    layer: Option<StaticLayer>,
+    /// Number of non-empty tiles in the chunk.
+    tiles: u32,
+    /// Tiles changed since the layer was baked.
+    dirty: bool,
+}
+
+/// Per-draw counters returned by [`Tilemap::draw`].
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub(super) struct TilemapDrawStats {
+    /// Tiles in chunks that overlap the viewport.
+    pub(super) tiles_drawn: u32,
+    /// Non-empty tiles skipped because their chunk is out of view.
+    pub(super) tiles_culled: u32,
+    pub(super) draw_calls: u32,
+    /// Chunks baked during the draw.
+    #[cfg_attr(not(test), allow(dead_code))]
+    pub(super) chunks_rebuilt: u32,
+}
+
+pub(super) struct Tilemap {
+    columns: u32,
+    rows: u32,
+    tile_width: u32,
+    tile_height: u32,
+    tileset: u64,
+    chunk_size: u32,
+    chunks_x: u32,
+    chunks_y: u32,
+    /// Row-major tile IDs; 0 is empty, `n` is tileset cell `n - 1`.
+    tiles: Vec<u32>,
+    chunks: Vec<TileChunk>,
+    /// Indices of chunks that currently hold a baked layer.
+    resident: Vec<usize>,
+    /// Non-empty tiles in the whole map.
+    tile_count: u64,
+    scratch: Vec<FfiSpriteCmd>,
+}
+
+impl Tilemap {
+    /// Creates an empty `columns` x `rows` map drawn from `tileset`.
+    ///
+    /// Tileset cells are `tile_width` x `tile_height` pixels, numbered
+    /// row-major from the top-left, and tiles are drawn at that size.
+    pub(super) fn new(
+        tileset: u64,
+        columns: u32,
+        rows: u32,
+        tile_width: u32,
+        tile_height: u32,
+        chunk_size: u32,
+    ) -> GoudResult<Self> {
+        if columns == 0 || rows == 0 || tile_width == 0 || tile_height == 0 {
+            return Err(GoudError::InvalidState(
+                "tilemap size and tile size must be non-zero".into(),
+            ));
+        }
+        let chunk_size = match chunk_size {
+            0 => GOUD_TILEMAP_DEFAULT_CHUNK_SIZE,
+            size if size <= MAX_CHUNK_SIZE => size,
+            size => {
+                return Err(GoudError::InvalidState(format!(
+                    "chunk size {size} exceeds {MAX_CHUNK_SIZE}"
+                )))
+            }
+        };
+        let cells = columns as usize * rows as usize;
+        let mut tiles = Vec::new();
+        tiles.try_reserve_exact(cells).map_err(|_| {
+            GoudError::InternalError(format!("cannot allocate {columns}x{rows} tilemap"))
+        })?;
+        tiles.resize(cells, 0);
+
+        let chunks_x = columns.div_ceil(chunk_size);
+        let chunks_y = rows.div_ceil(chunk_size);
+        let mut chunks = Vec::new();
+        chunks.resize_with(chunks_x as usize * chunks_y as usize, TileChunk::default);
+        Ok(Self {
+            columns,
+            rows,
+            tile_width,
+            tile_height,
+            tileset,
+            chunk_size,
+            chunks_x,
+            chunks_y,
+            tiles,
+            chunks,
+            resident: Vec::new(),
+            tile_count: 0,
+            scratch: Vec::new(),
+        })
+    }
+
+    /// Writes a `width` x `height` block of row-major tile IDs at (`x`, `y`).
+    ///
+    /// Chunks whose tiles change are marked dirty and rebuilt the next time
+    /// they are drawn.
+    pub(super) fn set_tiles(
+        &mut self,
+        x: u32,
+        y: u32,
+        width: u32,
+        height: u32,
+        tiles: &[u32],
+    ) -> GoudResult<()> {
+        let fits_x = x.checked_add(width).is_some_and(|end| end <= self.columns);
+        let fits_y = y.checked_add(height).is_some_and(|end| end <= self.rows);
+        if !fits_x || !fits_y {
+            return Err(GoudError::InvalidState(format!(
+                "tile block {width}x{height} at ({x}, {y}) exceeds {}x{} map",
+                self.columns, self.rows
+            )));
+        }
+        if tiles.len() != width as usize * height as usize {
+            return Err(GoudError::InvalidState(
+                "tile block length does not match its size".into(),
+            ));
+        }
+        if width == 0 {
+            return Ok(());
+        }
+
+        for (row, src) in tiles.chunks_exact(width as usize).enumerate() {
+            let ty = y + row as u32;
+            let start = ty as usize * self.columns as usize + x as usize;
+            let dst = &mut self.tiles[start..start + width as usize];
+            for (column, (old, &new)) in dst.iter_mut().zip(src).enumerate() {
+                if *old == new {
+                    continue;
+                }
+                let chunk = &mut self.chunks
+                    [chunk_index(self.chunks_x, self.chunk_size, x + column as u32, ty)];
+                match (*old == 0, new == 0) {
+                    (true, false) => {
+                        chunk.tiles += 1;
+                        self.tile_count += 1;
+                    }
+                    (false, true) => {
+                        chunk.tiles -= 1;
+                        self.tile_count -= 1;
+                    }
+                    _ => {}
+                }
+                chunk.dirty = true;
+                *old = new;
+            }
+        }
+        Ok(())
+    }
+
+    /// Returns the tile ID at (`x`, `y`), or `None` outside the map.
+    #[cfg(test)]
+    pub(super) fn tile(&self, x: u32, y: u32) -> Option<u32> {
+        if x >= self.columns || y >= self.rows {
+            return None;
+        }
+        Some(self.tiles[y as usize * self.columns as usize + x as usize])
+    }
+
+    /// Number of chunks that currently hold GPU buffers.
+    #[cfg(test)]
+    pub(super) fn resident_chunks(&self) -> usize {
+        self.resident.len()
+    }
+
+    /// Chunk column and row ranges overlapping a `viewport`-sized screen
+    /// when the map's top-left corner is drawn at `offset`.
+    pub(super) fn visible_chunks(
+        &self,
+        viewport: [f32; 2],
+        offset: [f32; 2],
+    ) -> (std::ops::Range<u32>, std::ops::Range<u32>) {
+        let span = |view: f32, offset: f32, chunk_px: f32, chunks: u32| {
+            let low = (-offset / chunk_px).floor().max(0.0);
+            let high = ((view - offset) / chunk_px).ceil().min(chunks as f32);
+            if high <= low {
+                0..0
+            } else {
+                low as u32..high as u32
+            }
+        };
+        (
+            span(
+                viewport[0],
+                offset[0],
+                self.chunk_size as f32 * self.tile_width as f32,
+                self.chunks_x,
+            ),
+            span(
+                viewport[1],
+                offset[1],
+                self.chunk_size as f32 * self.tile_height as f32,
+                self.chunks_y,
+            ),
+        )
+    }
+
+    /// Draws the chunks overlapping the viewport, rebuilding dirty ones.
+    pub(super) fn draw<B: RenderBackend + ?Sized>(
+        &mut self,
+        backend: &mut B,
+        shader: &StaticLayerShader,
+        viewport: [f32; 2],
+        offset: [f32; 2],
+    ) -> GoudResult<TilemapDrawStats> {
+        let (xs, ys) = self.visible_chunks(viewport, offset);
+        let mut stats = TilemapDrawStats::default();
+        for cy in ys.clone() {
+            for cx in xs.clone() {
+                let index = (cy * self.chunks_x + cx) as usize;
+                if self.chunks[index].tiles == 0 {
+                    continue;
+                }
+                if self.chunks[index].dirty || self.chunks[index].layer.is_none() {
+                    self.bake_chunk(backend, cx, cy)?;
+                    stats.chunks_rebuilt += 1;
+                }
+                if let Some(layer) = &self.chunks[index].layer {
+                    let (sprites, draw_calls) = layer.draw(backend, shader, viewport, offset)?;
+                    stats.tiles_drawn += sprites;
+                    stats.draw_calls += draw_calls;
+                }
+            }
+        }
+        self.evict_outside(backend, &xs, &ys);
+        stats.tiles_culled =
+            u32::try_from(self.tile_count - u64::from(stats.tiles_drawn)).unwrap_or(u32::MAX);
+        Ok(stats)
+    }
+
+    /// Rebuilds chunk (`cx`, `cy`) from its tiles.
+    fn bake_chunk<B: RenderBackend + ?Sized>(
+        &mut self,
+        backend: &mut B,
+        cx: u32,
+        cy: u32,
+    ) -> GoudResult<()> {
+        let index = (cy * self.chunks_x + cx) as usize;
+        let mut cmds = std::mem::take(&mut self.scratch);
+        cmds.clear();
+        self.chunk_cmds(&*backend, cx, cy, &mut cmds);
+
+        let chunk = &mut self.chunks[index];
+        let result = match chunk.layer.as_mut() {
+            Some(layer) if layer.len() == cmds.len() => {
+                layer.update(backend, CoordinateOrigin::TopLeft, 0, &cmds)
+            }
+            _ => {
+                if let Some(old) = chunk.layer.take() {
+                    old.destroy(backend);
+                }
+                if cmds.is_empty() {
+                    Ok(())
+                } else {
+                    StaticLayer::create(backend, CoordinateOrigin::TopLeft, &cmds)
+                        .map(|layer| chunk.layer = Some(layer))
+                }
+            }
+        };
+        self.scratch = cmds;
+        result?;
+
+        let chunk = &mut self.chunks[index];
+        chunk.dirty = false;
+        if chunk.layer.is_some() && !self.resident.contains(&index) {
+            self.resident.push(index);
+        }
+        Ok(())
+    }
+
+    /// Appends one sprite command per non-empty tile of chunk (`cx`, `cy`).
+    fn chunk_cmds<B: RenderBackend + ?Sized>(
+        &self,
+        backend: &B,
+        cx: u32,
+        cy: u32,
+        cmds: &mut Vec<FfiSpriteCmd>,
+    ) {
+        let tileset_columns = backend
+            .texture_size(texture_handle(self.tileset))
+            .map_or(1, |(width, _)| (width / self.tile_width).max(1));
+        let (tw, th) = (self.tile_width as f32, self.tile_height as f32);
+        let x_range = cx * self.chunk_size..((cx + 1) * self.chunk_size).min(self.columns);
+        let y_range = cy * self.chunk_size..((cy + 1) * self.chunk_size).min(self.rows);
+        for ty in y_range {
+            let row = ty as usize * self.columns as usize;
+            for tx in x_range.clone() {
+                let id = self.tiles[row + tx as usize];
+                if id == 0 {
+                    continue;
+                }
+                let cell = id - 1;
+                cmds.push(FfiSpriteCmd {
+                    texture: self.tileset,
+                    x: tx as f32 * tw,
+                    y: ty as f32 * th,
+                    width: tw,
+                    height: th,
+                    rotation: 0.0,
+                    src_x: (cell % tileset_columns) as f32 * tw,
+                    src_y: (cell / tileset_columns) as f32 * th,
+                    src_w: tw,
+                    src_h: th,
+                    r: 1.0,
+                    g: 1.0,
+                    b: 1.0,
+                    a: 1.0,
+                    z_layer: 0,
+                    _padding: 0,
+                });
+            }
+        }
+    }
+
+    /// Frees baked chunks more than one chunk outside the visible ranges.
+    fn evict_outside<B: RenderBackend + ?Sized>(
+        &mut self,
+        backend: &mut B,
+        xs: &std::ops::Range<u32>,
+        ys: &std::ops::Range<u32>,
+    ) {
+        let chunks_x = self.chunks_x as usize;
+        let keep = |index: usize| {
+            let (cx, cy) = ((index % chunks_x) as u32, (index / chunks_x) as u32);
+            !xs.is_empty()
+                && !ys.is_empty()
+                && cx + 1 >= xs.start
+                && cx <= xs.end
+                && cy + 1 >= ys.start
+                && cy <= ys.end
+        };
+        let chunks = &mut self.chunks;
+        self.resident.retain(|&index| {
+            if keep(index) {
+                return true;
+            }
+            if let Some(layer) = chunks[index].layer.take() {
+                layer.destroy(backend);
+            }
+            false
+        });
+    }
+
+    /// Frees every baked chunk.
+    pub(super) fn destroy<B: RenderBackend + ?Sized>(&mut self, backend: &mut B) {
+        for index in self.resident.drain(..) {
+            if let Some(layer) = self.chunks[index].layer.take() {
+                layer.destroy(backend);
+            }
+        }
+    }
+}
+
+fn chunk_index(chunks_x: u32, chunk_size: u32, x: u32, y: u32) -> usize {
+    ((y / chunk_size) * chunks_x + x / chunk_size) as usize
+}
+
+#[cfg(test)]
+#[path = "tilemap_tests.rs"]
+mod tests;
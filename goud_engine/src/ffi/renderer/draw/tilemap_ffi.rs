@@ -0,0 +1,201 @@
+//! Chunked tilemap FFI function implementations.
+
+use crate::core::debugger;
+use crate::core::error::{set_last_error, GoudError};
+use crate::ffi::context::{GoudContextId, GOUD_INVALID_CONTEXT_ID};
+use crate::ffi::renderer::texture::GoudTextureHandle;
+use crate::ffi::window::with_window_state;
+use crate::libs::graphics::backend::StateOps;
+
+use super::static_layer::with_store;
+use super::tilemap::{GoudTilemapHandle, Tilemap, GOUD_INVALID_TILEMAP};
+
+/// Creates an empty `columns` x `rows` tilemap drawn from `tileset`.
+///
+/// Tileset cells are `tile_width` x `tile_height` pixels, numbered row-major
+/// from the tileset's top-left corner; tile ID `n` draws cell `n - 1` and ID
+/// 0 is empty.  The map is split into `chunk_size` x `chunk_size` chunks
+/// (0 selects `GOUD_TILEMAP_DEFAULT_CHUNK_SIZE`) that are baked and culled
+/// independently.
+///
+/// # Returns
+///
+/// A tilemap handle, or `GOUD_INVALID_TILEMAP` on error.
+#[no_mangle]
+pub extern "C" fn goud_tilemap_create(
+    context_id: GoudContextId,
+    tileset: GoudTextureHandle,
+    columns: u32,
+    rows: u32,
+    tile_width: u32,
+    tile_height: u32,
+    chunk_size: u32,
+) -> GoudTilemapHandle {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return GOUD_INVALID_TILEMAP;
+    }
+    if with_window_state(context_id, |_| ()).is_none() {
+        set_last_error(GoudError::InvalidContext);
+        return GOUD_INVALID_TILEMAP;
+    }
+
+    match Tilemap::new(tileset, columns, rows, tile_width, tile_height, chunk_size) {
+        Ok(tilemap) => with_store(context_id, |store| store.insert_tilemap(tilemap)),
+        Err(e) => {
+            set_last_error(e);
+            GOUD_INVALID_TILEMAP
+        }
+    }
+}
+
+/// Writes a `width` x `height` block of row-major tile IDs at tile (`x`, `y`).
+///
+/// Chunks whose tiles change are rebuilt the next time they are drawn.
+///
+/// # Returns
+///
+/// 0 on success, or the error code on failure.
+///
+/// # Safety
+///
+/// `tiles` must point to `width * height` valid `u32` values for the call
+/// duration.
+#[no_mangle]
+pub unsafe extern "C" fn goud_tilemap_set_tiles(
+    context_id: GoudContextId,
+    tilemap: GoudTilemapHandle,
+    x: u32,
+    y: u32,
+    width: u32,
+    height: u32,
+    tiles: *const u32,
+) -> i32 {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return GoudError::InvalidContext.error_code();
+    }
+    let count = width as usize * height as usize;
+    if count == 0 {
+        return 0;
+    }
+    if tiles.is_null() {
+        let error = GoudError::InvalidState("tiles pointer is null".into());
+        let code = error.error_code();
+        set_last_error(error);
+        return code;
+    }
+
+    // SAFETY: caller guarantees `tiles` points to `width * height` valid u32s.
+    let tiles_slice = std::slice::from_raw_parts(tiles, count);
+    let result = with_store(context_id, |store| match store.tilemap_mut(tilemap) {
+        Some(map) => map.set_tiles(x, y, width, height, tiles_slice),
+        None => Err(GoudError::InvalidHandle),
+    });
+    match result {
+        Ok(()) => 0,
+        Err(e) => {
+            let code = e.error_code();
+            set_last_error(e);
+            code
+        }
+    }
+}
+
+/// Draws the chunks of a tilemap that overlap the window.
+///
+/// The map's top-left corner is drawn at (`offset_x`, `offset_y`); pass the
+/// negated camera position to scroll.  Non-empty tiles in chunks outside the
+/// window are reported as culled in `goud_renderer_get_frame_metrics`.
+///
+/// # Returns
+///
+/// Number of tiles drawn (0 on error or when nothing is visible).
+#[no_mangle]
+pub extern "C" fn goud_tilemap_draw(
+    context_id: GoudContextId,
+    tilemap: GoudTilemapHandle,
+    offset_x: f32,
+    offset_y: f32,
+) -> u32 {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return 0;
+    }
+
+    let result = with_window_state(context_id, |state| {
+        let (win_w, win_h) = state.get_size();
+        let (fb_w, fb_h) = state.get_framebuffer_size();
+        let backend = state.backend_mut();
+        backend.set_viewport(0, 0, fb_w, fb_h);
+        with_store(context_id, |store| {
+            store.draw_tilemap(
+                backend,
+                tilemap,
+                [win_w as f32, win_h as f32],
+                [offset_x, offset_y],
+            )
+        })
+    });
+
+    match result {
+        Some(Some(Ok(stats))) => {
+            let _ = debugger::update_render_stats_for_context(
+                context_id,
+                stats.draw_calls,
+                stats.tiles_drawn * 2,
+                stats.draw_calls,
+                1,
+            );
+            let _ = debugger::update_sprite_culling_for_context(
+                context_id,
+                stats.tiles_drawn,
+                stats.tiles_culled,
+                stats.draw_calls,
+            );
+            stats.tiles_drawn
+        }
+        Some(Some(Err(e))) => {
+            set_last_error(e);
+            0
+        }
+        Some(None) => {
+            set_last_error(GoudError::InvalidHandle);
+            0
+        }
+        None => {
+            set_last_error(GoudError::InvalidContext);
+            0
+        }
+    }
+}
+
+/// Destroys a tilemap and frees the GPU buffers of its baked chunks.
+///
+/// Returns `true` if the tilemap existed.
+#[no_mangle]
+pub extern "C" fn goud_tilemap_destroy(
+    context_id: GoudContextId,
+    tilemap: GoudTilemapHandle,
+) -> bool {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return false;
+    }
+    let destroyed = with_window_state(context_id, |state| {
+        with_store(context_id, |store| {
+            store.destroy_tilemap(state.backend_mut(), tilemap)
+        })
+    });
+    match destroyed {
+        Some(true) => true,
+        Some(false) => {
+            set_last_error(GoudError::InvalidHandle);
+            false
+        }
+        None => {
+            set_last_error(GoudError::InvalidContext);
+            false
+        }
+    }
+}
@@ -0,0 +1,154 @@
+//! Tests for chunked tilemap storage, culling, rebuilds, and eviction.
+
+use super::super::static_layer::StaticLayerStore;
+use super::*;
+use crate::libs::graphics::backend::null::NullBackend;
+use crate::libs::graphics::backend::types::{TextureFilter, TextureFormat, TextureWrap};
+use crate::libs::graphics::backend::TextureOps;
+
+const VIEWPORT: [f32; 2] = [800.0, 600.0];
+
+/// A 4x1-cell tileset of 16x16 tiles.
+fn tileset(backend: &mut NullBackend) -> u64 {
+    backend
+        .create_texture(
+            64,
+            16,
+            TextureFormat::RGBA8,
+            TextureFilter::Nearest,
+            TextureWrap::ClampToEdge,
+            &[],
+        )
+        .unwrap()
+        .to_u64()
+}
+
+/// A 100x100 map of 16px tiles in 32x32-tile (512px) chunks, fully filled.
+fn filled_map(tileset: u64) -> Tilemap {
+    let mut map = Tilemap::new(tileset, 100, 100, 16, 16, 0).unwrap();
+    map.set_tiles(0, 0, 100, 100, &vec![1; 100 * 100]).unwrap();
+    map
+}
+
+#[test]
+fn test_new_validates_sizes_and_defaults_chunk_size() {
+    assert!(Tilemap::new(1, 0, 10, 16, 16, 0).is_err());
+    assert!(Tilemap::new(1, 10, 10, 0, 16, 0).is_err());
+    assert!(Tilemap::new(1, 10, 10, 16, 16, MAX_CHUNK_SIZE + 1).is_err());
+
+    let map = Tilemap::new(1, 100, 40, 16, 16, 0).unwrap();
+    assert_eq!(map.chunk_size, GOUD_TILEMAP_DEFAULT_CHUNK_SIZE);
+    assert_eq!((map.chunks_x, map.chunks_y), (4, 2));
+}
+
+#[test]
+fn test_set_tiles_checks_bounds_and_tracks_counts() {
+    let mut map = Tilemap::new(1, 64, 64, 16, 16, 32).unwrap();
+    assert!(map.set_tiles(60, 0, 5, 1, &[1; 5]).is_err());
+    assert!(map.set_tiles(0, 0, 2, 2, &[1; 3]).is_err());
+
+    map.set_tiles(31, 31, 2, 2, &[1, 2, 3, 4]).unwrap();
+    assert_eq!(map.tile(32, 32), Some(4));
+    assert_eq!(map.tile(64, 0), None);
+    assert_eq!(map.tile_count, 4);
+    assert!(map
+        .chunks
+        .iter()
+        .all(|chunk| chunk.tiles == 1 && chunk.dirty));
+
+    map.set_tiles(31, 31, 1, 1, &[0]).unwrap();
+    assert_eq!(map.chunks[0].tiles, 0);
+    assert_eq!(map.tile_count, 3);
+}
+
+#[test]
+fn test_visible_chunks_follow_the_offset() {
+    let map = Tilemap::new(1, 100, 100, 16, 16, 32).unwrap();
+    assert_eq!(map.visible_chunks(VIEWPORT, [0.0, 0.0]), (0..2, 0..2));
+    assert_eq!(
+        map.visible_chunks(VIEWPORT, [-1000.0, -100.0]),
+        (1..4, 0..2)
+    );
+    assert_eq!(map.visible_chunks(VIEWPORT, [900.0, 0.0]).0, 0..0);
+    assert_eq!(map.visible_chunks(VIEWPORT, [0.0, -5000.0]).1, 0..0);
+}
+
+#[test]
+fn test_chunk_cmds_map_tile_ids_to_tileset_cells() {
+    let mut backend = NullBackend::new();
+    let texture = tileset(&mut backend);
+    let mut map = Tilemap::new(texture, 64, 64, 16, 16, 32).unwrap();
+    map.set_tiles(33, 1, 2, 1, &[3, 5]).unwrap();
+
+    let mut cmds = Vec::new();
+    map.chunk_cmds(&backend, 1, 0, &mut cmds);
+    assert_eq!(cmds.len(), 2);
+    assert_eq!((cmds[0].x, cmds[0].y), (33.0 * 16.0, 16.0));
+    assert_eq!((cmds[0].src_x, cmds[0].src_y), (32.0, 0.0));
+    assert_eq!((cmds[1].src_x, cmds[1].src_y), (0.0, 16.0));
+}
+
+#[test]
+fn test_draw_culls_offscreen_chunks_and_rebuilds_only_dirty_ones() {
+    let mut backend = NullBackend::new();
+    let texture = tileset(&mut backend);
+    let mut store = StaticLayerStore::new();
+    let handle = store.insert_tilemap(filled_map(texture));
+
+    let stats = store
+        .draw_tilemap(&mut backend, handle, VIEWPORT, [0.0, 0.0])
+        .unwrap()
+        .unwrap();
+    assert_eq!(stats.tiles_drawn, 4 * 32 * 32);
+    assert_eq!(stats.tiles_culled, 100 * 100 - 4 * 32 * 32);
+    assert_eq!(stats.draw_calls, 4);
+    assert_eq!(stats.chunks_rebuilt, 4);
+
+    let stats = store
+        .draw_tilemap(&mut backend, handle, VIEWPORT, [0.0, 0.0])
+        .unwrap()
+        .unwrap();
+    assert_eq!(stats.chunks_rebuilt, 0);
+
+    store
+        .tilemap_mut(handle)
+        .unwrap()
+        .set_tiles(40, 3, 1, 1, &[2])
+        .unwrap();
+    let stats = store
+        .draw_tilemap(&mut backend, handle, VIEWPORT, [0.0, 0.0])
+        .unwrap()
+        .unwrap();
+    assert_eq!(stats.chunks_rebuilt, 1);
+    assert_eq!(stats.tiles_drawn, 4 * 32 * 32);
+
+    assert!(store
+        .draw_tilemap(&mut backend, handle + 1, VIEWPORT, [0.0, 0.0])
+        .is_none());
+    assert!(store.destroy_tilemap(&mut backend, handle));
+    assert!(!store.destroy_tilemap(&mut backend, handle));
+}
+
+#[test]
+fn test_draw_evicts_chunks_far_from_the_viewport() {
+    let mut backend = NullBackend::new();
+    let texture = tileset(&mut backend);
+    let mut map = filled_map(texture);
+    let shader = StaticLayerShader::create(&mut backend).unwrap();
+
+    map.draw(&mut backend, &shader, VIEWPORT, [0.0, 0.0])
+        .unwrap();
+    assert_eq!(map.resident_chunks(), 4);
+
+    // Chunks (1..4, 1..3) are visible; (0, 0) is one chunk away and stays.
+    map.draw(&mut backend, &shader, VIEWPORT, [-1000.0, -600.0])
+        .unwrap();
+    assert_eq!(map.resident_chunks(), 4 + 5);
+
+    let stats = map
+        .draw(&mut backend, &shader, VIEWPORT, [-3000.0, -3000.0])
+        .unwrap();
+    assert_eq!(stats.tiles_drawn, 0);
+    assert_eq!(stats.tiles_culled, 100 * 100);
+    assert_eq!(map.resident_chunks(), 0);
+}
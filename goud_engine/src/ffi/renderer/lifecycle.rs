@@ -116,7 +116,7 @@ pub extern "C" fn goud_renderer_end(context_id: GoudContextId) -> bool {
     });
 
     // End frame on the backend
-    with_window_state(context_id, |state| {
+    let ended = with_window_state(context_id, |state| {
         let end_frame_start = std::time::Instant::now();
         update_network_overlay_for_frame_end(
             context_id,
@@ -138,6 +138,7 @@ pub extern "C" fn goud_renderer_end(context_id: GoudContextId) -> bool {
             set_last_error(e);
             return false;
         }
+        super::texture_streaming::update_texture_streaming(context_id, state.backend_mut());
         crate::libs::graphics::frame_timing::record_phase(
             "end_frame",
             end_frame_start.elapsed().as_micros() as u64,
@@ -147,7 +148,12 @@ pub extern "C" fn goud_renderer_end(context_id: GoudContextId) -> bool {
     .unwrap_or_else(|| {
         set_last_error(GoudError::InvalidContext);
         false
-    })
+    });
+    // Publish outside the window state borrow; the block reads it for FPS.
+    if ended {
+        crate::ffi::debug::publish_metrics_if_enabled(context_id);
+    }
+    ended
 }
 
 /// Sets the viewport for rendering.
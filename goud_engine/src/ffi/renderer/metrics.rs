@@ -3,10 +3,52 @@
 //! Provides a C-compatible function to retrieve per-frame render metrics
 //! from the debugger snapshot for a given context.
 
+use crate::core::debugger::RenderMetricsV1;
 use crate::core::error::{set_last_error, GoudError};
 use crate::ffi::context::{GoudContextId, GOUD_INVALID_CONTEXT_ID};
 use crate::ffi::types::{FfiFramePhaseTimings, FfiRenderMetrics};
 
+impl From<RenderMetricsV1> for FfiRenderMetrics {
+    fn from(rm: RenderMetricsV1) -> Self {
+        Self {
+            draw_call_count: rm.draw_call_count,
+            sprites_submitted: rm.sprites_submitted,
+            sprites_drawn: rm.sprites_drawn,
+            sprites_culled: rm.sprites_culled,
+            batches_submitted: rm.batches_submitted,
+            avg_sprites_per_batch: rm.avg_sprites_per_batch,
+            sprite_render_ms: rm.sprite_render_ms,
+            text_render_ms: rm.text_render_ms,
+            ui_render_ms: rm.ui_render_ms,
+            total_render_ms: rm.total_render_ms,
+            text_draw_calls: rm.text_draw_calls,
+            text_glyph_count: rm.text_glyph_count,
+            ui_draw_calls: rm.ui_draw_calls,
+        }
+    }
+}
+
+/// Returns the calling thread's latest frame phase timings.
+pub(crate) fn latest_phase_timings() -> FfiFramePhaseTimings {
+    let timings = crate::libs::graphics::frame_timing::latest_timings();
+    FfiFramePhaseTimings {
+        begin_frame_us: timings.begin_frame_us,
+        end_frame_us: timings.end_frame_us,
+        surface_acquire_us: timings.surface_acquire_us,
+        shadow_pass_us: timings.shadow_pass_us,
+        shadow_build_us: timings.shadow_build_us,
+        render3d_scene_us: timings.render3d_scene_us,
+        uniform_upload_us: timings.uniform_upload_us,
+        render_pass_us: timings.render_pass_us,
+        gpu_submit_us: timings.gpu_submit_us,
+        readback_stall_us: timings.readback_stall_us,
+        surface_present_us: timings.surface_present_us,
+        anim_eval_us: timings.anim_eval_us,
+        bone_pack_us: timings.bone_pack_us,
+        bone_upload_us: timings.bone_upload_us,
+    }
+}
+
 /// Retrieves per-frame render metrics for a context.
 ///
 /// Reads the render metrics from the debugger snapshot for the given context.
@@ -42,31 +84,10 @@ pub unsafe extern "C" fn goud_renderer_get_frame_metrics(
         return -2;
     }
 
-    // Try to read render metrics from the debugger snapshot.
-    let route_id = crate::core::debugger::route_for_context(context_id);
-    let metrics = route_id.and_then(|rid| {
-        crate::core::debugger::snapshot_for_route(&rid)
-            .map(|snapshot| snapshot.stats.render_metrics)
-    });
-
-    let ffi_metrics = match metrics {
-        Some(rm) => FfiRenderMetrics {
-            draw_call_count: rm.draw_call_count,
-            sprites_submitted: rm.sprites_submitted,
-            sprites_drawn: rm.sprites_drawn,
-            sprites_culled: rm.sprites_culled,
-            batches_submitted: rm.batches_submitted,
-            avg_sprites_per_batch: rm.avg_sprites_per_batch,
-            sprite_render_ms: rm.sprite_render_ms,
-            text_render_ms: rm.text_render_ms,
-            ui_render_ms: rm.ui_render_ms,
-            total_render_ms: rm.total_render_ms,
-            text_draw_calls: rm.text_draw_calls,
-            text_glyph_count: rm.text_glyph_count,
-            ui_draw_calls: rm.ui_draw_calls,
-        },
-        None => FfiRenderMetrics::default(),
-    };
+    // Read render metrics from the debugger route without cloning its snapshot.
+    let ffi_metrics = crate::core::debugger::metrics_counters_for_context(context_id)
+        .map(|counters| FfiRenderMetrics::from(counters.render_metrics))
+        .unwrap_or_default();
 
     // SAFETY: out_metrics is non-null and points to writable storage for one FfiRenderMetrics.
     *out_metrics = ffi_metrics;
@@ -92,23 +113,7 @@ pub unsafe extern "C" fn goud_renderer_get_frame_phase_timings(
         return -1;
     }
 
-    let timings = crate::libs::graphics::frame_timing::latest_timings();
     // SAFETY: out_timings is non-null and points to writable storage for one FfiFramePhaseTimings.
-    *out_timings = FfiFramePhaseTimings {
-        begin_frame_us: timings.begin_frame_us,
-        end_frame_us: timings.end_frame_us,
-        surface_acquire_us: timings.surface_acquire_us,
-        shadow_pass_us: timings.shadow_pass_us,
-        shadow_build_us: timings.shadow_build_us,
-        render3d_scene_us: timings.render3d_scene_us,
-        uniform_upload_us: timings.uniform_upload_us,
-        render_pass_us: timings.render_pass_us,
-        gpu_submit_us: timings.gpu_submit_us,
-        readback_stall_us: timings.readback_stall_us,
-        surface_present_us: timings.surface_present_us,
-        anim_eval_us: timings.anim_eval_us,
-        bone_pack_us: timings.bone_pack_us,
-        bone_upload_us: timings.bone_upload_us,
-    };
+    *out_timings = latest_phase_timings();
     0
 }
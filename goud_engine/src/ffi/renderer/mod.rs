@@ -40,9 +40,11 @@
 //!
 //! - `lifecycle` — Frame begin/end, viewport, blending, depth testing
 //! - `texture` — Texture loading and destruction
+//! - `texture_streaming` — Streamed textures under a GPU residency budget
 //! - `handles` — Opaque handle types and rendering statistics
 //! - `immediate` — Immediate-mode rendering state and shader setup
 //! - `draw` — Draw call FFI functions (sprites, quads)
+//! - `particles` — 2D particle emitters drawn as instanced quads
 
 mod atlas;
 mod draw;
@@ -50,20 +52,28 @@ mod handles;
 mod immediate;
 mod lifecycle;
 pub mod metrics;
+mod particles;
 mod text;
 mod texture;
+mod texture_streaming;
 
 // Re-export all public items to preserve the original flat public API.
 
 pub use draw::{
     goud_renderer_draw_quad, goud_renderer_draw_sprite, goud_renderer_draw_sprite_batch,
-    goud_renderer_draw_sprite_rect, FfiSpriteCmd,
+    goud_renderer_draw_sprite_rect, goud_static_layer_create, goud_static_layer_destroy,
+    goud_static_layer_draw, goud_static_layer_update, goud_tilemap_create, goud_tilemap_destroy,
+    goud_tilemap_draw, goud_tilemap_set_tiles, FfiSpriteCmd, GoudStaticLayerHandle,
+    GoudTilemapHandle, GOUD_INVALID_STATIC_LAYER, GOUD_INVALID_TILEMAP,
+    GOUD_TILEMAP_DEFAULT_CHUNK_SIZE,
 };
 
 #[allow(deprecated)]
 pub use text::{
-    goud_draw_text, goud_font_destroy, goud_font_load, goud_renderer_draw_text,
-    goud_renderer_draw_text_batch, FfiTextCmd, GoudFontHandle, GOUD_INVALID_FONT,
+    goud_draw_text, goud_font_destroy, goud_font_load, goud_font_load_memory,
+    goud_renderer_draw_text, goud_renderer_draw_text_batch, goud_text_layout_cache_clear,
+    goud_text_layout_cache_get_stats, goud_text_layout_cache_set_budget, FfiTextCmd,
+    FfiTextLayoutCacheStats, GoudFontHandle, GOUD_INVALID_FONT,
 };
 
 pub use handles::{
@@ -79,7 +89,20 @@ pub use lifecycle::{
 };
 
 pub use texture::{
-    goud_texture_destroy, goud_texture_load, GoudTextureHandle, GOUD_INVALID_TEXTURE,
+    goud_image_decode_rgba8, goud_image_get_size, goud_texture_create_rgba8, goud_texture_destroy,
+    goud_texture_load, GoudTextureHandle, GOUD_INVALID_TEXTURE,
+};
+
+pub use texture_streaming::{
+    goud_texture_stream_load, goud_texture_stream_load_memory, goud_texture_streaming_get_stats,
+    goud_texture_streaming_set_budget, FfiTextureStreamingStats,
+};
+
+pub use particles::{
+    goud_particle_emitter_burst, goud_particle_emitter_create, goud_particle_emitter_destroy,
+    goud_particle_emitter_draw, goud_particle_emitter_set_position, goud_particle_emitter_set_rate,
+    goud_particles_update, FfiParticleEmitterConfig, GoudParticleEmitterHandle,
+    GOUD_INVALID_PARTICLE_EMITTER, GOUD_PARTICLE_MAX_PER_EMITTER,
 };
 
 pub use atlas::{
@@ -89,4 +112,7 @@ pub use atlas::{
 };
 
 pub(crate) use atlas::cleanup_atlas_state;
+pub(crate) use draw::cleanup_static_layer_state;
+pub(crate) use particles::cleanup_particle_state;
 pub(crate) use text::cleanup_text_state;
+pub(crate) use texture_streaming::cleanup_texture_streaming_state;
@@ -0,0 +1,256 @@
+//! Structure-of-arrays particle simulation for one emitter.
+
+use crate::core::error::{GoudError, GoudResult};
+use crate::libs::graphics::backend::types::BufferHandle;
+use crate::libs::graphics::backend::RenderBackend;
+
+use super::{FfiParticleEmitterConfig, GOUD_PARTICLE_MAX_PER_EMITTER};
+
+/// Seed used when the config leaves `seed` at 0 (xorshift needs a non-zero state).
+const DEFAULT_SEED: u32 = 0x9E37_79B9;
+
+/// Per-particle instance data: centre position and normalised age (0..1).
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default, PartialEq)]
+pub(super) struct ParticleInstance {
+    pub(super) x: f32,
+    pub(super) y: f32,
+    pub(super) t: f32,
+}
+
+// SAFETY: ParticleInstance is a plain-data #[repr(C)] struct of three f32s.
+unsafe impl bytemuck::Pod for ParticleInstance {}
+// SAFETY: ParticleInstance contains only f32 fields which are valid when zeroed.
+unsafe impl bytemuck::Zeroable for ParticleInstance {}
+
+/// Checks that every range and count in `config` is usable.
+pub(super) fn validate_config(config: &FfiParticleEmitterConfig) -> GoudResult<()> {
+    if config.max_particles == 0 || config.max_particles > GOUD_PARTICLE_MAX_PER_EMITTER {
+        return Err(GoudError::InvalidState(format!(
+            "max_particles must be 1..={GOUD_PARTICLE_MAX_PER_EMITTER}"
+        )));
+    }
+    let values = [
+        config.emission_rate,
+        config.lifetime_min,
+        config.lifetime_max,
+        config.velocity_min_x,
+        config.velocity_min_y,
+        config.velocity_max_x,
+        config.velocity_max_y,
+        config.gravity_x,
+        config.gravity_y,
+        config.drag,
+        config.spawn_width,
+        config.spawn_height,
+        config.start_size,
+        config.end_size,
+    ];
+    if values.iter().any(|v| !v.is_finite()) {
+        return Err(GoudError::InvalidState(
+            "particle config values must be finite".into(),
+        ));
+    }
+    if config.emission_rate < 0.0 || config.drag < 0.0 {
+        return Err(GoudError::InvalidState(
+            "emission_rate and drag must not be negative".into(),
+        ));
+    }
+    if config.lifetime_min <= 0.0 || config.lifetime_max < config.lifetime_min {
+        return Err(GoudError::InvalidState(
+            "lifetime range must be positive and ordered".into(),
+        ));
+    }
+    Ok(())
+}
+
+/// One emitter: its config, its live particles, and its instance buffer.
+///
+/// Live particles occupy the first `len()` entries of every column; dead
+/// particles are swap-removed so the columns stay dense.
+pub(super) struct ParticleEmitter {
+    pub(super) config: FfiParticleEmitterConfig,
+    position: [f32; 2],
+    rng: u32,
+    accumulator: f32,
+    pos_x: Vec<f32>,
+    pos_y: Vec<f32>,
+    vel_x: Vec<f32>,
+    vel_y: Vec<f32>,
+    /// Normalised age: 0 at spawn, 1 at death.
+    age: Vec<f32>,
+    /// Normalised age gained per second (1 / lifetime).
+    age_rate: Vec<f32>,
+    instances: Vec<ParticleInstance>,
+    pub(super) instance_buffer: Option<BufferHandle>,
+}
+
+impl ParticleEmitter {
+    /// Validates `config` and reserves every column up front.
+    pub(super) fn new(config: FfiParticleEmitterConfig) -> GoudResult<Self> {
+        validate_config(&config)?;
+        let capacity = config.max_particles as usize;
+        let column = || -> GoudResult<Vec<f32>> {
+            let mut v = Vec::new();
+            v.try_reserve_exact(capacity).map_err(|_| {
+                GoudError::InternalError("particle column allocation failed".into())
+            })?;
+            Ok(v)
+        };
+        let mut instances = Vec::new();
+        instances
+            .try_reserve_exact(capacity)
+            .map_err(|_| GoudError::InternalError("particle instance allocation failed".into()))?;
+        Ok(Self {
+            config,
+            position: [0.0, 0.0],
+            rng: if config.seed == 0 {
+                DEFAULT_SEED
+            } else {
+                config.seed
+            },
+            accumulator: 0.0,
+            pos_x: column()?,
+            pos_y: column()?,
+            vel_x: column()?,
+            vel_y: column()?,
+            age: column()?,
+            age_rate: column()?,
+            instances,
+            instance_buffer: None,
+        })
+    }
+
+    /// Number of live particles.
+    pub(super) fn len(&self) -> usize {
+        self.age.len()
+    }
+
+    /// Moves the emitter; live particles keep their positions.
+    pub(super) fn set_position(&mut self, x: f32, y: f32) {
+        self.position = [x, y];
+    }
+
+    /// Changes the continuous emission rate (0 stops emitting).
+    pub(super) fn set_rate(&mut self, rate: f32) -> GoudResult<()> {
+        if !rate.is_finite() || rate < 0.0 {
+            return Err(GoudError::InvalidState(
+                "emission_rate must be finite and not negative".into(),
+            ));
+        }
+        self.config.emission_rate = rate;
+        if rate == 0.0 {
+            self.accumulator = 0.0;
+        }
+        Ok(())
+    }
+
+    /// Spawns up to `count` particles at once; returns how many fit.
+    pub(super) fn burst(&mut self, count: u32) -> u32 {
+        let free = self.config.max_particles as usize - self.len();
+        let count = (count as usize).min(free);
+        for _ in 0..count {
+            self.spawn_one();
+        }
+        count as u32
+    }
+
+    /// Ages, kills, and integrates live particles, then emits new ones.
+    pub(super) fn update(&mut self, dt: f32) {
+        if !dt.is_finite() || dt <= 0.0 {
+            return;
+        }
+        self.simulate(dt);
+
+        self.accumulator += self.config.emission_rate * dt;
+        let due = self.accumulator.floor();
+        self.accumulator -= due;
+        self.burst(due.min(u32::MAX as f32) as u32);
+    }
+
+    fn simulate(&mut self, dt: f32) {
+        for (age, rate) in self.age.iter_mut().zip(&self.age_rate) {
+            *age += rate * dt;
+        }
+
+        let mut i = 0;
+        while i < self.age.len() {
+            if self.age[i] >= 1.0 {
+                self.pos_x.swap_remove(i);
+                self.pos_y.swap_remove(i);
+                self.vel_x.swap_remove(i);
+                self.vel_y.swap_remove(i);
+                self.age.swap_remove(i);
+                self.age_rate.swap_remove(i);
+            } else {
+                i += 1;
+            }
+        }
+
+        let damping = (1.0 - self.config.drag * dt).max(0.0);
+        let axes = [
+            (&mut self.vel_x, &mut self.pos_x, self.config.gravity_x * dt),
+            (&mut self.vel_y, &mut self.pos_y, self.config.gravity_y * dt),
+        ];
+        for (vel, pos, impulse) in axes {
+            for (v, p) in vel.iter_mut().zip(pos.iter_mut()) {
+                *v = *v * damping + impulse;
+                *p += *v * dt;
+            }
+        }
+    }
+
+    fn spawn_one(&mut self) {
+        let c = self.config;
+        let lifetime = lerp(c.lifetime_min, c.lifetime_max, self.next_unit());
+        let x = self.position[0] + (self.next_unit() - 0.5) * c.spawn_width;
+        let y = self.position[1] + (self.next_unit() - 0.5) * c.spawn_height;
+        let vx = lerp(c.velocity_min_x, c.velocity_max_x, self.next_unit());
+        let vy = lerp(c.velocity_min_y, c.velocity_max_y, self.next_unit());
+        self.pos_x.push(x);
+        self.pos_y.push(y);
+        self.vel_x.push(vx);
+        self.vel_y.push(vy);
+        self.age.push(0.0);
+        self.age_rate.push(1.0 / lifetime);
+    }
+
+    /// Next value of the emitter's xorshift32 sequence, mapped to `[0, 1)`.
+    fn next_unit(&mut self) -> f32 {
+        let mut x = self.rng;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        self.rng = x;
+        (x >> 8) as f32 * (1.0 / 16_777_216.0)
+    }
+
+    /// Interleaves the live particles into the instance upload buffer.
+    pub(super) fn write_instances(&mut self) -> &[ParticleInstance] {
+        self.instances.clear();
+        self.instances.extend(
+            self.pos_x
+                .iter()
+                .zip(&self.pos_y)
+                .zip(&self.age)
+                .map(|((&x, &y), &t)| ParticleInstance { x, y, t }),
+        );
+        &self.instances
+    }
+
+    /// Live particle positions, for tests.
+    #[cfg(test)]
+    pub(super) fn positions(&self) -> impl Iterator<Item = (f32, f32)> + '_ {
+        self.pos_x.iter().copied().zip(self.pos_y.iter().copied())
+    }
+
+    pub(super) fn destroy<B: RenderBackend + ?Sized>(&mut self, backend: &mut B) {
+        if let Some(buffer) = self.instance_buffer.take() {
+            let _ = backend.destroy_buffer(buffer);
+        }
+    }
+}
+
+fn lerp(a: f32, b: f32, t: f32) -> f32 {
+    a + (b - a) * t
+}
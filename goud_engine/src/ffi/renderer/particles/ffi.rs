@@ -0,0 +1,250 @@
+//! Particle emitter FFI function implementations.
+
+use crate::core::debugger;
+use crate::core::error::{set_last_error, GoudError};
+use crate::ffi::context::{GoudContextId, GOUD_INVALID_CONTEXT_ID};
+use crate::ffi::window::with_window_state;
+use crate::libs::graphics::backend::StateOps;
+
+use super::emitter::ParticleEmitter;
+use super::{
+    with_store, FfiParticleEmitterConfig, GoudParticleEmitterHandle, GOUD_INVALID_PARTICLE_EMITTER,
+};
+
+/// Creates a particle emitter at (0, 0) from `config`.
+///
+/// Storage for `config.max_particles` particles is reserved up front, so
+/// neither emission nor simulation allocates afterwards.
+///
+/// # Returns
+///
+/// An emitter handle, or `GOUD_INVALID_PARTICLE_EMITTER` on error.
+///
+/// # Safety
+///
+/// `config` must point to a valid `FfiParticleEmitterConfig` for the call
+/// duration.
+#[no_mangle]
+pub unsafe extern "C" fn goud_particle_emitter_create(
+    context_id: GoudContextId,
+    config: *const FfiParticleEmitterConfig,
+) -> GoudParticleEmitterHandle {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return GOUD_INVALID_PARTICLE_EMITTER;
+    }
+    if config.is_null() {
+        set_last_error(GoudError::InvalidState("config pointer is null".into()));
+        return GOUD_INVALID_PARTICLE_EMITTER;
+    }
+    if with_window_state(context_id, |_| ()).is_none() {
+        set_last_error(GoudError::InvalidContext);
+        return GOUD_INVALID_PARTICLE_EMITTER;
+    }
+
+    // SAFETY: caller guarantees `config` points to a valid config.
+    let config = *config;
+    match ParticleEmitter::new(config) {
+        Ok(emitter) => with_store(context_id, |store| store.insert(emitter)),
+        Err(e) => {
+            set_last_error(e);
+            GOUD_INVALID_PARTICLE_EMITTER
+        }
+    }
+}
+
+/// Moves an emitter; particles already alive keep their positions.
+///
+/// Returns `true` if the emitter exists.
+#[no_mangle]
+pub extern "C" fn goud_particle_emitter_set_position(
+    context_id: GoudContextId,
+    emitter: GoudParticleEmitterHandle,
+    x: f32,
+    y: f32,
+) -> bool {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return false;
+    }
+    let found = with_store(context_id, |store| match store.get_mut(emitter) {
+        Some(e) => {
+            e.set_position(x, y);
+            true
+        }
+        None => false,
+    });
+    if !found {
+        set_last_error(GoudError::InvalidHandle);
+    }
+    found
+}
+
+/// Changes an emitter's continuous emission rate in particles per second.
+///
+/// A rate of 0 stops emission; live particles finish their lives.
+///
+/// # Returns
+///
+/// 0 on success, or the error code on failure.
+#[no_mangle]
+pub extern "C" fn goud_particle_emitter_set_rate(
+    context_id: GoudContextId,
+    emitter: GoudParticleEmitterHandle,
+    rate: f32,
+) -> i32 {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return GoudError::InvalidContext.error_code();
+    }
+    let result = with_store(context_id, |store| match store.get_mut(emitter) {
+        Some(e) => e.set_rate(rate),
+        None => Err(GoudError::InvalidHandle),
+    });
+    match result {
+        Ok(()) => 0,
+        Err(e) => {
+            let code = e.error_code();
+            set_last_error(e);
+            code
+        }
+    }
+}
+
+/// Spawns up to `count` particles from an emitter immediately.
+///
+/// # Returns
+///
+/// Number of particles spawned; fewer than `count` when the emitter is
+/// near `max_particles`, and 0 on error.
+#[no_mangle]
+pub extern "C" fn goud_particle_emitter_burst(
+    context_id: GoudContextId,
+    emitter: GoudParticleEmitterHandle,
+    count: u32,
+) -> u32 {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return 0;
+    }
+    match with_store(context_id, |store| {
+        store.get_mut(emitter).map(|e| e.burst(count))
+    }) {
+        Some(spawned) => spawned,
+        None => {
+            set_last_error(GoudError::InvalidHandle);
+            0
+        }
+    }
+}
+
+/// Advances every emitter of the context by `delta_time` seconds.
+///
+/// Ages and kills particles, applies gravity and drag, moves them, and then
+/// emits new particles at each emitter's rate.  A `delta_time` that is not
+/// positive and finite leaves every emitter unchanged.
+///
+/// # Returns
+///
+/// Total live particles across the context's emitters.
+#[no_mangle]
+pub extern "C" fn goud_particles_update(context_id: GoudContextId, delta_time: f32) -> u32 {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return 0;
+    }
+    with_store(context_id, |store| store.update(delta_time))
+}
+
+/// Draws an emitter's live particles as instanced quads in one draw call.
+///
+/// Particles are drawn shifted by (`offset_x`, `offset_y`); pass the
+/// negated camera position to scroll.
+///
+/// # Returns
+///
+/// Number of particles drawn (0 on error or when none are alive).
+#[no_mangle]
+pub extern "C" fn goud_particle_emitter_draw(
+    context_id: GoudContextId,
+    emitter: GoudParticleEmitterHandle,
+    offset_x: f32,
+    offset_y: f32,
+) -> u32 {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return 0;
+    }
+
+    let result = with_window_state(context_id, |state| {
+        let (win_w, win_h) = state.get_size();
+        let (fb_w, fb_h) = state.get_framebuffer_size();
+        let backend = state.backend_mut();
+        backend.set_viewport(0, 0, fb_w, fb_h);
+        with_store(context_id, |store| {
+            store.draw(
+                backend,
+                emitter,
+                [win_w as f32, win_h as f32],
+                [offset_x, offset_y],
+            )
+        })
+    });
+
+    match result {
+        Some(Some(Ok(drawn))) => {
+            if drawn > 0 {
+                let _ = debugger::update_render_stats_for_context(
+                    context_id,
+                    1,
+                    drawn.saturating_mul(2),
+                    1,
+                    1,
+                );
+            }
+            drawn
+        }
+        Some(Some(Err(e))) => {
+            set_last_error(e);
+            0
+        }
+        Some(None) => {
+            set_last_error(GoudError::InvalidHandle);
+            0
+        }
+        None => {
+            set_last_error(GoudError::InvalidContext);
+            0
+        }
+    }
+}
+
+/// Destroys an emitter, its particles, and its instance buffer.
+///
+/// Returns `true` if the emitter existed.
+#[no_mangle]
+pub extern "C" fn goud_particle_emitter_destroy(
+    context_id: GoudContextId,
+    emitter: GoudParticleEmitterHandle,
+) -> bool {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return false;
+    }
+    let destroyed = with_window_state(context_id, |state| {
+        with_store(context_id, |store| {
+            store.destroy_emitter(state.backend_mut(), emitter)
+        })
+    });
+    match destroyed {
+        Some(true) => true,
+        Some(false) => {
+            set_last_error(GoudError::InvalidHandle);
+            false
+        }
+        None => {
+            set_last_error(GoudError::InvalidContext);
+            false
+        }
+    }
+}
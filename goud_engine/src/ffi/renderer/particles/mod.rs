@@ -0,0 +1,235 @@
+//! # 2D Particle Emitter FFI
+//!
+//! Emitters simulate their particles in the engine and draw them as
+//! instanced quads, one draw call per emitter.  Callers configure an
+//! emitter once, move it or change its rate when needed, and advance every
+//! emitter of a context with a single `goud_particles_update` call, so
+//! spawning, simulation, and drawing never cross the FFI boundary per
+//! particle.
+//!
+//! Particles are stored as structure-of-arrays columns that the simulation
+//! walks in straight-line loops the compiler vectorises.  Colour and size are
+//! interpolated from the emitter's start to end values in the vertex shader,
+//! so each particle uploads only its position and normalised age.
+
+mod emitter;
+mod ffi;
+mod render;
+
+use std::cell::RefCell;
+use std::collections::HashMap;
+
+use crate::core::error::GoudResult;
+use crate::ffi::context::GoudContextId;
+use crate::ffi::renderer::texture::GoudTextureHandle;
+use crate::ffi::window::with_window_state;
+use crate::libs::graphics::backend::RenderBackend;
+
+pub use ffi::{
+    goud_particle_emitter_burst, goud_particle_emitter_create, goud_particle_emitter_destroy,
+    goud_particle_emitter_draw, goud_particle_emitter_set_position, goud_particle_emitter_set_rate,
+    goud_particles_update,
+};
+
+use emitter::ParticleEmitter;
+use render::ParticleRenderer;
+
+// ============================================================================
+// Handle types
+// ============================================================================
+
+/// Opaque particle emitter handle for FFI.
+pub type GoudParticleEmitterHandle = u64;
+
+/// Invalid particle emitter handle constant.
+pub const GOUD_INVALID_PARTICLE_EMITTER: GoudParticleEmitterHandle = u64::MAX;
+
+/// Largest `max_particles` one emitter accepts.
+pub const GOUD_PARTICLE_MAX_PER_EMITTER: u32 = 1 << 20;
+
+// ============================================================================
+// FFI config struct
+// ============================================================================
+
+/// FFI-safe particle emitter configuration.
+///
+/// Each particle picks its lifetime, launch velocity, and spawn offset
+/// uniformly from the given ranges.  Colour and size change linearly from
+/// their start to end values over the particle's life.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, PartialEq)]
+pub struct FfiParticleEmitterConfig {
+    /// Particle texture from `goud_texture_load` (0 = solid white quads).
+    pub texture: GoudTextureHandle,
+    /// Maximum live particles (1 to `GOUD_PARTICLE_MAX_PER_EMITTER`).
+    pub max_particles: u32,
+    /// Seed for the emitter's random ranges (0 picks a fixed default).
+    pub seed: u32,
+    /// Particles spawned per second by `goud_particles_update`.
+    pub emission_rate: f32,
+    /// Shortest particle lifetime in seconds.
+    pub lifetime_min: f32,
+    /// Longest particle lifetime in seconds.
+    pub lifetime_max: f32,
+    /// Minimum launch velocity X in pixels per second.
+    pub velocity_min_x: f32,
+    /// Minimum launch velocity Y in pixels per second.
+    pub velocity_min_y: f32,
+    /// Maximum launch velocity X in pixels per second.
+    pub velocity_max_x: f32,
+    /// Maximum launch velocity Y in pixels per second.
+    pub velocity_max_y: f32,
+    /// Constant acceleration X in pixels per second squared.
+    pub gravity_x: f32,
+    /// Constant acceleration Y in pixels per second squared.
+    pub gravity_y: f32,
+    /// Fraction of velocity lost per second (0 = none).
+    pub drag: f32,
+    /// Width of the spawn rectangle centred on the emitter.
+    pub spawn_width: f32,
+    /// Height of the spawn rectangle centred on the emitter.
+    pub spawn_height: f32,
+    /// Quad edge in pixels when a particle spawns.
+    pub start_size: f32,
+    /// Quad edge in pixels when a particle dies.
+    pub end_size: f32,
+    /// Red component at spawn.
+    pub start_r: f32,
+    /// Green component at spawn.
+    pub start_g: f32,
+    /// Blue component at spawn.
+    pub start_b: f32,
+    /// Alpha component at spawn.
+    pub start_a: f32,
+    /// Red component at death.
+    pub end_r: f32,
+    /// Green component at death.
+    pub end_g: f32,
+    /// Blue component at death.
+    pub end_b: f32,
+    /// Alpha component at death.
+    pub end_a: f32,
+}
+
+// ============================================================================
+// Thread-local emitter storage (one store per context)
+// ============================================================================
+
+pub(super) struct ParticleStore {
+    emitters: HashMap<u64, ParticleEmitter>,
+    next_id: u64,
+    renderer: Option<ParticleRenderer>,
+}
+
+impl ParticleStore {
+    fn new() -> Self {
+        Self {
+            emitters: HashMap::new(),
+            next_id: 1,
+            renderer: None,
+        }
+    }
+
+    fn insert(&mut self, emitter: ParticleEmitter) -> GoudParticleEmitterHandle {
+        let id = self.next_id;
+        self.next_id += 1;
+        self.emitters.insert(id, emitter);
+        id
+    }
+
+    fn get_mut(&mut self, handle: GoudParticleEmitterHandle) -> Option<&mut ParticleEmitter> {
+        self.emitters.get_mut(&handle)
+    }
+
+    /// Advances every emitter by `dt` seconds; returns the live particle total.
+    fn update(&mut self, dt: f32) -> u32 {
+        let mut alive = 0u32;
+        for emitter in self.emitters.values_mut() {
+            emitter.update(dt);
+            alive = alive.saturating_add(emitter.len() as u32);
+        }
+        alive
+    }
+
+    /// Draws one emitter, creating the shared renderer on first use.
+    ///
+    /// Returns `None` for an unknown handle, otherwise the particles drawn.
+    fn draw<B: RenderBackend + ?Sized>(
+        &mut self,
+        backend: &mut B,
+        handle: GoudParticleEmitterHandle,
+        viewport: [f32; 2],
+        offset: [f32; 2],
+    ) -> Option<GoudResult<u32>> {
+        let emitter = self.emitters.get_mut(&handle)?;
+        if self.renderer.is_none() {
+            match ParticleRenderer::create(backend) {
+                Ok(renderer) => self.renderer = Some(renderer),
+                Err(e) => return Some(Err(e)),
+            }
+        }
+        let renderer = self.renderer.as_ref()?;
+        Some(renderer.draw(backend, emitter, viewport, offset))
+    }
+
+    fn destroy_emitter<B: RenderBackend + ?Sized>(
+        &mut self,
+        backend: &mut B,
+        handle: GoudParticleEmitterHandle,
+    ) -> bool {
+        match self.emitters.remove(&handle) {
+            Some(mut emitter) => {
+                emitter.destroy(backend);
+                true
+            }
+            None => false,
+        }
+    }
+
+    /// Destroys every emitter's instance buffer and the shared renderer.
+    fn destroy_all<B: RenderBackend + ?Sized>(&mut self, backend: &mut B) {
+        for (_, mut emitter) in self.emitters.drain() {
+            emitter.destroy(backend);
+        }
+        if let Some(renderer) = self.renderer.take() {
+            renderer.destroy(backend);
+        }
+    }
+}
+
+type ContextKey = (u32, u32);
+
+thread_local! {
+    static PARTICLE_STORES: RefCell<HashMap<ContextKey, ParticleStore>> =
+        RefCell::new(HashMap::new());
+}
+
+fn context_key(id: GoudContextId) -> ContextKey {
+    (id.index(), id.generation())
+}
+
+fn with_store<F, R>(context_id: GoudContextId, f: F) -> R
+where
+    F: FnOnce(&mut ParticleStore) -> R,
+{
+    PARTICLE_STORES.with(|cell| {
+        let mut stores = cell.borrow_mut();
+        let store = stores
+            .entry(context_key(context_id))
+            .or_insert_with(ParticleStore::new);
+        f(store)
+    })
+}
+
+/// Removes all particle emitters for a context, destroying their GPU buffers.
+///
+/// Called during `goud_window_destroy` to prevent GPU resource leaks.
+pub(crate) fn cleanup_particle_state(context_id: GoudContextId) {
+    let removed = PARTICLE_STORES.with(|cell| cell.borrow_mut().remove(&context_key(context_id)));
+    if let Some(mut store) = removed {
+        with_window_state(context_id, |state| store.destroy_all(state.backend_mut()));
+    }
+}
+
+#[cfg(test)]
+mod tests;
@@ -0,0 +1,287 @@
+//! Instanced quad rendering shared by every emitter of a context.
+
+use crate::core::error::GoudResult;
+use crate::libs::graphics::backend::types::{
+    BufferHandle, BufferType, BufferUsage, PrimitiveTopology, ShaderHandle, TextureFilter,
+    TextureFormat, TextureHandle, TextureWrap, VertexAttribute, VertexAttributeType,
+    VertexBufferBinding, VertexLayout,
+};
+use crate::libs::graphics::backend::{BlendFactor, RenderBackend, ShaderLanguage};
+
+use super::emitter::{ParticleEmitter, ParticleInstance};
+
+// ============================================================================
+// Shader sources
+// ============================================================================
+
+const PARTICLE_VERTEX_SHADER: &str = r#"
+#version 330 core
+
+layout(location = 0) in vec2 a_corner;
+layout(location = 1) in vec2 a_texcoord;
+layout(location = 2) in vec3 a_particle;
+
+uniform vec2 u_viewport;
+uniform vec2 u_offset;
+uniform vec4 u_start_color;
+uniform vec4 u_end_color;
+uniform vec2 u_size;
+
+out vec2 v_texcoord;
+out vec4 v_color;
+
+void main() {
+    float t = clamp(a_particle.z, 0.0, 1.0);
+    vec2 safe_viewport = max(u_viewport, vec2(1.0, 1.0));
+    vec2 position = a_particle.xy + a_corner * mix(u_size.x, u_size.y, t) + u_offset;
+    vec2 ndc;
+    ndc.x = (position.x / safe_viewport.x) * 2.0 - 1.0;
+    ndc.y = 1.0 - (position.y / safe_viewport.y) * 2.0;
+    gl_Position = vec4(ndc, 0.0, 1.0);
+    v_texcoord = a_texcoord;
+    v_color = mix(u_start_color, u_end_color, t);
+}
+"#;
+
+const PARTICLE_FRAGMENT_SHADER: &str = r#"
+#version 330 core
+
+in vec2 v_texcoord;
+in vec4 v_color;
+
+uniform sampler2D u_texture;
+
+out vec4 FragColor;
+
+void main() {
+    FragColor = texture(u_texture, v_texcoord) * v_color;
+}
+"#;
+
+const PARTICLE_VERTEX_SHADER_WGSL: &str = r#"
+struct Uniforms {
+    u_viewport: vec2<f32>,
+    u_offset: vec2<f32>,
+    u_start_color: vec4<f32>,
+    u_end_color: vec4<f32>,
+    u_size: vec2<f32>,
+}
+
+@group(0) @binding(0) var<uniform> uniforms: Uniforms;
+
+struct VertexInput {
+    @location(0) a_corner: vec2<f32>,
+    @location(1) a_texcoord: vec2<f32>,
+    @location(2) a_particle: vec3<f32>,
+}
+
+struct VertexOutput {
+    @builtin(position) position: vec4<f32>,
+    @location(0) v_texcoord: vec2<f32>,
+    @location(1) v_color: vec4<f32>,
+}
+
+@vertex
+fn main(in: VertexInput) -> VertexOutput {
+    let t = clamp(in.a_particle.z, 0.0, 1.0);
+    let safe_viewport = max(uniforms.u_viewport, vec2<f32>(1.0, 1.0));
+    let size = mix(uniforms.u_size.x, uniforms.u_size.y, t);
+    let position = in.a_particle.xy + in.a_corner * size + uniforms.u_offset;
+    let ndc_x = (position.x / safe_viewport.x) * 2.0 - 1.0;
+    let ndc_y = 1.0 - (position.y / safe_viewport.y) * 2.0;
+
+    var out: VertexOutput;
+    out.position = vec4<f32>(ndc_x, ndc_y, 0.0, 1.0);
+    out.v_texcoord = in.a_texcoord;
+    out.v_color = mix(uniforms.u_start_color, uniforms.u_end_color, t);
+    return out;
+}
+"#;
+
+const PARTICLE_FRAGMENT_SHADER_WGSL: &str = r#"
+struct Uniforms {
+    u_viewport: vec2<f32>,
+    u_offset: vec2<f32>,
+    u_start_color: vec4<f32>,
+    u_end_color: vec4<f32>,
+    u_size: vec2<f32>,
+}
+
+@group(0) @binding(0) var<uniform> uniforms: Uniforms;
+@group(1) @binding(0) var u_texture: texture_2d<f32>;
+@group(1) @binding(1) var u_sampler: sampler;
+
+@fragment
+fn main(@location(0) v_texcoord: vec2<f32>, @location(1) v_color: vec4<f32>) -> @location(0) vec4<f32> {
+    return textureSample(u_texture, u_sampler, v_texcoord) * v_color;
+}
+"#;
+
+// ============================================================================
+// Geometry
+// ============================================================================
+
+/// Two triangles of a unit quad centred on the particle: corner xy, then uv.
+const QUAD_VERTICES: [f32; 24] = [
+    -0.5, -0.5, 0.0, 0.0, //
+    0.5, -0.5, 1.0, 0.0, //
+    0.5, 0.5, 1.0, 1.0, //
+    -0.5, -0.5, 0.0, 0.0, //
+    0.5, 0.5, 1.0, 1.0, //
+    -0.5, 0.5, 0.0, 1.0, //
+];
+
+fn quad_layout() -> VertexLayout {
+    VertexLayout::new(16)
+        .with_attribute(VertexAttribute::new(
+            0,
+            VertexAttributeType::Float2,
+            0,
+            false,
+        ))
+        .with_attribute(VertexAttribute::new(
+            1,
+            VertexAttributeType::Float2,
+            8,
+            false,
+        ))
+}
+
+fn instance_layout() -> VertexLayout {
+    VertexLayout::new(std::mem::size_of::<ParticleInstance>() as u32).with_attribute(
+        VertexAttribute::new(2, VertexAttributeType::Float3, 0, false),
+    )
+}
+
+// ============================================================================
+// Renderer
+// ============================================================================
+
+/// Shader, quad, and fallback texture shared by a context's emitters.
+pub(super) struct ParticleRenderer {
+    shader: ShaderHandle,
+    quad_buffer: BufferHandle,
+    white_texture: TextureHandle,
+    u_viewport: i32,
+    u_offset: i32,
+    u_start_color: i32,
+    u_end_color: i32,
+    u_size: i32,
+    u_texture: i32,
+}
+
+impl ParticleRenderer {
+    pub(super) fn create<B: RenderBackend + ?Sized>(backend: &mut B) -> GoudResult<Self> {
+        let (vert_src, frag_src) = match backend.shader_language() {
+            ShaderLanguage::Wgsl => (PARTICLE_VERTEX_SHADER_WGSL, PARTICLE_FRAGMENT_SHADER_WGSL),
+            ShaderLanguage::Glsl => (PARTICLE_VERTEX_SHADER, PARTICLE_FRAGMENT_SHADER),
+        };
+        let shader = backend.create_shader(vert_src, frag_src)?;
+        let quad_buffer = match backend.create_buffer(
+            BufferType::Vertex,
+            BufferUsage::Static,
+            bytemuck::cast_slice(&QUAD_VERTICES),
+        ) {
+            Ok(buffer) => buffer,
+            Err(e) => {
+                let _ = backend.destroy_shader(shader);
+                return Err(e);
+            }
+        };
+        let white_texture = match backend.create_texture(
+            1,
+            1,
+            TextureFormat::RGBA8,
+            TextureFilter::Nearest,
+            TextureWrap::ClampToEdge,
+            &[255; 4],
+        ) {
+            Ok(texture) => texture,
+            Err(e) => {
+                let _ = backend.destroy_buffer(quad_buffer);
+                let _ = backend.destroy_shader(shader);
+                return Err(e);
+            }
+        };
+        let location = |name: &str| backend.get_uniform_location(shader, name).unwrap_or(-1);
+        Ok(Self {
+            shader,
+            quad_buffer,
+            white_texture,
+            u_viewport: location("u_viewport"),
+            u_offset: location("u_offset"),
+            u_start_color: location("u_start_color"),
+            u_end_color: location("u_end_color"),
+            u_size: location("u_size"),
+            u_texture: location("u_texture"),
+        })
+    }
+
+    /// Uploads the emitter's live particles and draws them in one instanced call.
+    ///
+    /// The instance buffer is created at full capacity on first draw and
+    /// rewritten in place after that.  Returns the particles drawn.
+    pub(super) fn draw<B: RenderBackend + ?Sized>(
+        &self,
+        backend: &mut B,
+        emitter: &mut ParticleEmitter,
+        viewport: [f32; 2],
+        offset: [f32; 2],
+    ) -> GoudResult<u32> {
+        let count = emitter.len() as u32;
+        if count == 0 {
+            return Ok(0);
+        }
+        let buffer = match emitter.instance_buffer {
+            Some(buffer) => buffer,
+            None => {
+                let zeroed =
+                    vec![ParticleInstance::default(); emitter.config.max_particles as usize];
+                let buffer = backend.create_buffer(
+                    BufferType::Vertex,
+                    BufferUsage::Dynamic,
+                    bytemuck::cast_slice(&zeroed),
+                )?;
+                emitter.instance_buffer = Some(buffer);
+                buffer
+            }
+        };
+        backend.update_buffer(buffer, 0, bytemuck::cast_slice(emitter.write_instances()))?;
+
+        let c = emitter.config;
+        let texture = if c.texture == 0 {
+            self.white_texture
+        } else {
+            TextureHandle::from_u64(c.texture)
+        };
+        backend.enable_blending();
+        backend.set_blend_func(BlendFactor::SrcAlpha, BlendFactor::OneMinusSrcAlpha);
+        backend.bind_shader(self.shader)?;
+        backend.set_uniform_vec2(self.u_viewport, viewport[0], viewport[1]);
+        backend.set_uniform_vec2(self.u_offset, offset[0], offset[1]);
+        backend.set_uniform_vec4(
+            self.u_start_color,
+            c.start_r,
+            c.start_g,
+            c.start_b,
+            c.start_a,
+        );
+        backend.set_uniform_vec4(self.u_end_color, c.end_r, c.end_g, c.end_b, c.end_a);
+        backend.set_uniform_vec2(self.u_size, c.start_size, c.end_size);
+        backend.set_uniform_int(self.u_texture, 0);
+        backend.bind_texture(texture, 0)?;
+        backend.bind_default_vertex_array();
+        backend.set_vertex_bindings(&[
+            VertexBufferBinding::per_vertex(self.quad_buffer, quad_layout()),
+            VertexBufferBinding::per_instance(buffer, instance_layout()),
+        ])?;
+        backend.draw_arrays_instanced(PrimitiveTopology::Triangles, 0, 6, count)?;
+        Ok(count)
+    }
+
+    pub(super) fn destroy<B: RenderBackend + ?Sized>(&self, backend: &mut B) {
+        let _ = backend.destroy_buffer(self.quad_buffer);
+        let _ = backend.destroy_texture(self.white_texture);
+        let _ = backend.destroy_shader(self.shader);
+    }
+}
@@ -0,0 +1,191 @@
+//! Tests for particle emission, simulation, and instanced drawing.
+
+use super::emitter::{validate_config, ParticleEmitter};
+use super::*;
+use crate::libs::graphics::backend::null::NullBackend;
+
+const VIEWPORT: [f32; 2] = [800.0, 600.0];
+
+/// A 1-second, 100-particle emitter with no velocity spread.
+fn config() -> FfiParticleEmitterConfig {
+    FfiParticleEmitterConfig {
+        texture: 0,
+        max_particles: 100,
+        seed: 7,
+        emission_rate: 10.0,
+        lifetime_min: 1.0,
+        lifetime_max: 1.0,
+        velocity_min_x: 0.0,
+        velocity_min_y: 0.0,
+        velocity_max_x: 0.0,
+        velocity_max_y: 0.0,
+        gravity_x: 0.0,
+        gravity_y: 0.0,
+        drag: 0.0,
+        spawn_width: 0.0,
+        spawn_height: 0.0,
+        start_size: 8.0,
+        end_size: 2.0,
+        start_r: 1.0,
+        start_g: 1.0,
+        start_b: 1.0,
+        start_a: 1.0,
+        end_r: 1.0,
+        end_g: 0.0,
+        end_b: 0.0,
+        end_a: 0.0,
+    }
+}
+
+#[test]
+fn test_validate_config_rejects_bad_ranges() {
+    assert!(validate_config(&config()).is_ok());
+    for bad in [
+        FfiParticleEmitterConfig {
+            max_particles: 0,
+            ..config()
+        },
+        FfiParticleEmitterConfig {
+            max_particles: GOUD_PARTICLE_MAX_PER_EMITTER + 1,
+            ..config()
+        },
+        FfiParticleEmitterConfig {
+            lifetime_min: 0.0,
+            ..config()
+        },
+        FfiParticleEmitterConfig {
+            lifetime_max: 0.5,
+            ..config()
+        },
+        FfiParticleEmitterConfig {
+            emission_rate: -1.0,
+            ..config()
+        },
+        FfiParticleEmitterConfig {
+            gravity_y: f32::NAN,
+            ..config()
+        },
+    ] {
+        assert!(validate_config(&bad).is_err());
+    }
+}
+
+#[test]
+fn test_burst_is_capped_by_max_particles() {
+    let mut emitter = ParticleEmitter::new(config()).unwrap();
+    assert_eq!(emitter.burst(60), 60);
+    assert_eq!(emitter.burst(60), 40);
+    assert_eq!(emitter.burst(1), 0);
+    assert_eq!(emitter.len(), 100);
+}
+
+#[test]
+fn test_update_emits_at_rate_and_kills_expired_particles() {
+    let mut emitter = ParticleEmitter::new(config()).unwrap();
+    emitter.update(0.25);
+    assert_eq!(emitter.len(), 2);
+    emitter.update(0.25);
+    assert_eq!(emitter.len(), 5);
+
+    // The first particles reach the end of their 1 s life.
+    emitter.set_rate(0.0).unwrap();
+    emitter.update(0.8);
+    assert_eq!(emitter.len(), 3);
+    emitter.update(0.5);
+    assert_eq!(emitter.len(), 0);
+
+    assert!(emitter.set_rate(-1.0).is_err());
+    emitter.update(-1.0);
+    emitter.update(f32::NAN);
+    assert_eq!(emitter.len(), 0);
+}
+
+#[test]
+fn test_update_applies_velocity_gravity_and_drag() {
+    let mut emitter = ParticleEmitter::new(FfiParticleEmitterConfig {
+        emission_rate: 0.0,
+        velocity_min_x: 100.0,
+        velocity_max_x: 100.0,
+        gravity_y: 50.0,
+        lifetime_max: 10.0,
+        ..config()
+    })
+    .unwrap();
+    emitter.set_position(10.0, 20.0);
+    emitter.burst(1);
+    emitter.update(0.5);
+    let (x, y) = emitter.positions().next().unwrap();
+    assert!((x - 60.0).abs() < 1e-4);
+    assert!((y - 32.5).abs() < 1e-4);
+
+    let mut damped = ParticleEmitter::new(FfiParticleEmitterConfig {
+        emission_rate: 0.0,
+        velocity_min_x: 100.0,
+        velocity_max_x: 100.0,
+        drag: 1.0,
+        ..config()
+    })
+    .unwrap();
+    damped.burst(1);
+    damped.update(0.5);
+    let (x, _) = damped.positions().next().unwrap();
+    assert!((x - 25.0).abs() < 1e-4);
+}
+
+#[test]
+fn test_spawn_ranges_are_seeded_and_bounded() {
+    let spread = FfiParticleEmitterConfig {
+        spawn_width: 20.0,
+        spawn_height: 10.0,
+        ..config()
+    };
+    let mut a = ParticleEmitter::new(spread).unwrap();
+    let mut b = ParticleEmitter::new(spread).unwrap();
+    a.burst(50);
+    b.burst(50);
+    assert!(a.positions().eq(b.positions()));
+    assert!(a
+        .positions()
+        .all(|(x, y)| (-10.0..10.0).contains(&x) && (-5.0..5.0).contains(&y)));
+}
+
+#[test]
+fn test_store_draws_each_emitter_with_one_instanced_call() {
+    let mut backend = NullBackend::new();
+    let mut store = ParticleStore::new();
+    let handle = store.insert(ParticleEmitter::new(config()).unwrap());
+
+    assert_eq!(
+        store
+            .draw(&mut backend, handle, VIEWPORT, [0.0, 0.0])
+            .unwrap()
+            .unwrap(),
+        0
+    );
+    assert_eq!(backend.draw_arrays_instanced_calls(), 0);
+
+    assert_eq!(store.update(0.5), 5);
+    assert_eq!(
+        store
+            .draw(&mut backend, handle, VIEWPORT, [0.0, 0.0])
+            .unwrap()
+            .unwrap(),
+        5
+    );
+    store.get_mut(handle).unwrap().burst(50);
+    assert_eq!(
+        store
+            .draw(&mut backend, handle, VIEWPORT, [0.0, 0.0])
+            .unwrap()
+            .unwrap(),
+        55
+    );
+    assert_eq!(backend.draw_arrays_instanced_calls(), 2);
+
+    assert!(store
+        .draw(&mut backend, handle + 1, VIEWPORT, [0.0, 0.0])
+        .is_none());
+    assert!(store.destroy_emitter(&mut backend, handle));
+    assert!(!store.destroy_emitter(&mut backend, handle));
+    store.destroy_all(&mut backend);
+}
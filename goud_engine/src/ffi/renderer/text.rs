@@ -16,6 +16,7 @@ use crate::rendering::text::{GlyphAtlas, TextBatch, TextLayoutConfig};
 
 mod batch;
 mod draw_impl;
+mod layout_cache;
 mod parse;
 
 #[cfg(test)]
@@ -23,6 +24,10 @@ mod tests;
 
 pub use batch::{goud_renderer_draw_text_batch, FfiTextCmd};
 use draw_impl::draw_text_internal;
+pub use layout_cache::{
+    goud_text_layout_cache_clear, goud_text_layout_cache_get_stats,
+    goud_text_layout_cache_set_budget, FfiTextLayoutCacheStats,
+};
 use parse::{parse_text_alignment, parse_text_direction, read_utf8_cstr};
 
 /// Opaque font handle for native FFI text rendering.
@@ -101,13 +106,54 @@ pub unsafe extern "C" fn goud_font_load(
         }
     };
 
+    register_font(context_id, font_bytes, &path_str)
+}
+
+/// Loads a font from an in-memory TTF/OTF buffer and returns an opaque handle.
+///
+/// The bytes are copied, so the caller may free `data` afterwards.  Reading
+/// the file can happen on any thread; this call must run on the thread that
+/// owns the context.
+///
+/// # Safety
+///
+/// `data` must point to `len` valid bytes.
+#[no_mangle]
+pub unsafe extern "C" fn goud_font_load_memory(
+    context_id: GoudContextId,
+    data: *const u8,
+    len: usize,
+) -> GoudFontHandle {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return GOUD_INVALID_FONT;
+    }
+
+    if data.is_null() || len == 0 {
+        set_last_error(GoudError::InvalidState(
+            "font data is null or empty".to_string(),
+        ));
+        return GOUD_INVALID_FONT;
+    }
+
+    if with_window_state(context_id, |_| ()).is_none() {
+        set_last_error(GoudError::InvalidContext);
+        return GOUD_INVALID_FONT;
+    }
+
+    // SAFETY: caller guarantees data points to len valid bytes
+    let font_bytes = std::slice::from_raw_parts(data, len).to_vec();
+    register_font(context_id, font_bytes, "<memory>")
+}
+
+fn register_font(context_id: GoudContextId, font_bytes: Vec<u8>, label: &str) -> GoudFontHandle {
     let parsed_font =
         match fontdue::Font::from_bytes(font_bytes.as_slice(), fontdue::FontSettings::default()) {
             Ok(font) => font,
             Err(err) => {
                 set_last_error(GoudError::ResourceInvalidFormat(format!(
                     "failed to parse font '{}': {}",
-                    path_str, err
+                    label, err
                 )));
                 return GOUD_INVALID_FONT;
             }
@@ -170,8 +216,15 @@ pub extern "C" fn goud_font_destroy(
                 }
             }
 
-            if state.fonts.is_empty() {
-                states.remove(&context_key);
+            // The state (and its layout cache budget) lives until the
+            // context is destroyed; only this font's layouts go.
+            let layout_cache = state.text_batch.layout_cache_mut();
+            if layout_cache.remove_font(font_handle) > 0 {
+                let _ = debugger::update_memory_category_for_context(
+                    context_id,
+                    "rendering",
+                    layout_cache.bytes() as u64,
+                );
             }
 
             true
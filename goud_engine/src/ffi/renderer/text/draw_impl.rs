@@ -1,3 +1,4 @@
+use crate::core::debugger;
 use crate::core::error::GoudError;
 use crate::core::handle::Handle;
 use crate::core::math::{Color, Vec2};
@@ -7,6 +8,7 @@ use crate::ffi::window::WindowState;
 use crate::libs::graphics::backend::types::TextureHandle;
 use crate::rendering::text::{
     layout_shaped_text, shape_text, GlyphAtlas, TextBatch, TextDirection, TextLayoutConfig,
+    TextLayoutKey,
 };
 
 use super::{FontMarker, GoudFontHandle, FONT_STATES};
@@ -42,9 +44,6 @@ pub(super) fn draw_text_internal(
             .get_mut(typed_handle)
             .ok_or(GoudError::InvalidHandle)?;
 
-        let shaped = shape_text(text, &loaded_font.font_bytes, font_size, direction)
-            .map_err(GoudError::ResourceInvalidFormat)?;
-
         let size_key = font_size.round().max(1.0) as u32;
         if !loaded_font.atlases.contains_key(&size_key) {
             let new_atlas = GlyphAtlas::generate(&loaded_font.font, font_size)
@@ -57,10 +56,28 @@ pub(super) fn draw_text_internal(
             .get_mut(&size_key)
             .expect("atlas inserted above");
 
-        atlas
-            .ensure_glyph_indices(&loaded_font.font, shaped.glyph_indices())
-            .map_err(GoudError::ResourceInvalidFormat)?;
-        let layout = layout_shaped_text(&shaped, atlas, font_size, &config);
+        let key = TextLayoutKey::new(font_handle, font_size, text, &config, direction);
+        let layout_cache = state.text_batch.layout_cache_mut();
+        let layout = match layout_cache.get(&key, atlas.version()) {
+            Some(layout) => layout,
+            None => {
+                let shaped = shape_text(text, &loaded_font.font_bytes, font_size, direction)
+                    .map_err(GoudError::ResourceInvalidFormat)?;
+                atlas
+                    .ensure_glyph_indices(&loaded_font.font, shaped.glyph_indices())
+                    .map_err(GoudError::ResourceInvalidFormat)?;
+                let layout = layout_shaped_text(&shaped, atlas, font_size, &config);
+                let layout = layout_cache.insert(&key, atlas.version(), layout);
+                let cache_bytes = layout_cache.bytes() as u64;
+                let _ = debugger::update_memory_category_for_context(
+                    context_id,
+                    "rendering",
+                    cache_bytes,
+                );
+                layout
+            }
+        };
+
         if layout.glyphs.is_empty() {
             return Ok(());
         }
@@ -0,0 +1,134 @@
+//! # Text Layout Cache FFI
+//!
+//! Controls the per-context cache of shaped text layouts used by
+//! `goud_renderer_draw_text` and `goud_renderer_draw_text_batch`.  Labels
+//! drawn again with the same font, size, string, wrap width, alignment,
+//! line spacing, and direction reuse their layout instead of being reshaped.
+
+use crate::core::debugger;
+use crate::core::error::{set_last_error, GoudError};
+use crate::ffi::context::{GoudContextId, GOUD_INVALID_CONTEXT_ID};
+use crate::ffi::window::with_window_state;
+use crate::rendering::text::{TextLayoutCache, TextLayoutCacheStats};
+
+use super::{ContextFontState, FONT_STATES};
+
+/// FFI-safe text layout cache counters.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default)]
+pub struct FfiTextLayoutCacheStats {
+    /// Draws whose layout came from the cache.
+    pub hits: u64,
+    /// Draws that shaped and laid out their text.
+    pub misses: u64,
+    /// Entries evicted to stay within the byte budget.
+    pub evictions: u64,
+    /// Layouts currently cached.
+    pub entries: u64,
+    /// Estimated bytes held by cached layouts.
+    pub bytes: u64,
+    /// Configured byte budget.
+    pub budget_bytes: u64,
+}
+
+impl From<TextLayoutCacheStats> for FfiTextLayoutCacheStats {
+    fn from(value: TextLayoutCacheStats) -> Self {
+        Self {
+            hits: value.hits,
+            misses: value.misses,
+            evictions: value.evictions,
+            entries: value.entries,
+            bytes: value.bytes,
+            budget_bytes: value.budget_bytes,
+        }
+    }
+}
+
+fn with_layout_cache<R>(
+    context_id: GoudContextId,
+    f: impl FnOnce(&mut TextLayoutCache) -> R,
+) -> Option<R> {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return None;
+    }
+    if with_window_state(context_id, |_| ()).is_none() {
+        set_last_error(GoudError::InvalidContext);
+        return None;
+    }
+
+    let context_key = (context_id.index(), context_id.generation());
+    let result = FONT_STATES.with(|cell| {
+        let mut states = cell.borrow_mut();
+        let state = states
+            .entry(context_key)
+            .or_insert_with(ContextFontState::new);
+        f(state.text_batch.layout_cache_mut())
+    });
+    Some(result)
+}
+
+/// Sets the byte budget of the context's text layout cache.
+///
+/// Least-recently-used layouts are evicted until the cache fits.  A budget
+/// of 0 disables caching.
+#[no_mangle]
+pub extern "C" fn goud_text_layout_cache_set_budget(
+    context_id: GoudContextId,
+    budget_bytes: u64,
+) -> bool {
+    let bytes = with_layout_cache(context_id, |cache| {
+        cache.set_budget(usize::try_from(budget_bytes).unwrap_or(usize::MAX));
+        cache.bytes() as u64
+    });
+    match bytes {
+        Some(bytes) => {
+            let _ = debugger::update_memory_category_for_context(context_id, "rendering", bytes);
+            true
+        }
+        None => false,
+    }
+}
+
+/// Drops every cached text layout for the context.
+///
+/// Counters are kept; see `goud_text_layout_cache_get_stats`.
+#[no_mangle]
+pub extern "C" fn goud_text_layout_cache_clear(context_id: GoudContextId) -> bool {
+    if with_layout_cache(context_id, TextLayoutCache::clear).is_none() {
+        return false;
+    }
+    let _ = debugger::update_memory_category_for_context(context_id, "rendering", 0);
+    true
+}
+
+/// Writes hit, miss, eviction, and occupancy counters for the context's
+/// text layout cache.
+///
+/// The cache's byte estimate is also reported as the `rendering` category
+/// of `goud_debugger_get_memory_summary`.
+///
+/// # Safety
+///
+/// `out_stats` must be a valid pointer to writable memory.
+#[no_mangle]
+pub unsafe extern "C" fn goud_text_layout_cache_get_stats(
+    context_id: GoudContextId,
+    out_stats: *mut FfiTextLayoutCacheStats,
+) -> bool {
+    if out_stats.is_null() {
+        set_last_error(GoudError::InvalidState(
+            "out_stats pointer is null".to_string(),
+        ));
+        return false;
+    }
+
+    match with_layout_cache(context_id, |cache| cache.stats()) {
+        Some(stats) => {
+            // SAFETY: out_stats is non-null and the caller guarantees it is writable.
+            *out_stats = stats.into();
+            true
+        }
+        None => false,
+    }
+}
@@ -1,14 +1,14 @@
 use super::*;
 use crate::core::error::{
-    clear_last_error, last_error_code, ERR_INVALID_HANDLE, ERR_INVALID_STATE,
+    clear_last_error, last_error_code, ERR_INVALID_CONTEXT, ERR_INVALID_HANDLE, ERR_INVALID_STATE,
 };
 use crate::core::math::{Color, Vec2};
 use crate::ecs::components::Transform2D;
 use crate::libs::graphics::backend::null::NullBackend;
 use crate::libs::graphics::backend::types::{TextureFilter, TextureFormat, TextureWrap};
 use crate::libs::graphics::backend::TextureOps;
-use crate::rendering::text::TextBatch;
 use crate::rendering::text::{LayoutGlyph, TextBoundingBox, TextLayoutResult, UvRect};
+use crate::rendering::text::{TextBatch, TextDirection, TextLayoutKey};
 use std::os::raw::c_char;
 
 fn fake_context() -> GoudContextId {
@@ -39,6 +39,15 @@ fn font_load_rejects_null_path() {
     assert_eq!(last_error_code(), ERR_INVALID_STATE);
 }
 
+#[test]
+fn font_load_memory_rejects_null_data() {
+    clear_last_error();
+    // SAFETY: passing a null pointer is explicitly validated by goud_font_load_memory.
+    let handle = unsafe { goud_font_load_memory(fake_context(), std::ptr::null(), 16) };
+    assert_eq!(handle, GOUD_INVALID_FONT);
+    assert_eq!(last_error_code(), ERR_INVALID_STATE);
+}
+
 #[test]
 fn font_destroy_rejects_invalid_handle() {
     clear_last_error();
@@ -47,6 +56,50 @@ fn font_destroy_rejects_invalid_handle() {
     assert_eq!(last_error_code(), ERR_INVALID_HANDLE);
 }
 
+#[test]
+fn layout_cache_exports_reject_invalid_context() {
+    clear_last_error();
+    assert!(!goud_text_layout_cache_set_budget(
+        GOUD_INVALID_CONTEXT_ID,
+        4096
+    ));
+    assert_eq!(last_error_code(), ERR_INVALID_CONTEXT);
+
+    clear_last_error();
+    assert!(!goud_text_layout_cache_clear(fake_context()));
+    assert_eq!(last_error_code(), ERR_INVALID_CONTEXT);
+}
+
+#[test]
+fn layout_cache_get_stats_rejects_null_out_pointer() {
+    clear_last_error();
+    // SAFETY: passing a null pointer is explicitly validated by the export.
+    let ok = unsafe { goud_text_layout_cache_get_stats(fake_context(), std::ptr::null_mut()) };
+    assert!(!ok);
+    assert_eq!(last_error_code(), ERR_INVALID_STATE);
+}
+
+#[test]
+fn context_font_state_layout_cache_survives_frames() {
+    let mut state = ContextFontState::new();
+    let config = TextLayoutConfig::default();
+    let key = TextLayoutKey::new(1, 16.0, "fps", &config, TextDirection::Auto);
+    let layout = TextLayoutResult {
+        glyphs: Vec::new(),
+        bounding_box: TextBoundingBox {
+            width: 0.0,
+            height: 0.0,
+        },
+        line_count: 1,
+    };
+
+    state.text_batch.layout_cache_mut().insert(&key, 3, layout);
+    state.text_batch.begin();
+
+    assert!(state.text_batch.layout_cache_mut().get(&key, 3).is_some());
+    assert_eq!(state.text_batch.layout_cache().stats().hits, 1);
+}
+
 #[test]
 fn draw_text_rejects_null_pointer_before_gl() {
     clear_last_error();
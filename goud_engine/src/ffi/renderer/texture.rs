@@ -69,7 +69,174 @@ pub unsafe extern "C" fn goud_texture_load(
     let height = img.height();
     let data = img.into_raw();
 
-    // Create GPU texture
+    upload_rgba8(context_id, width, height, &data)
+}
+
+/// Creates a texture from tightly packed RGBA8 pixels.
+///
+/// Pair with [`goud_image_decode_rgba8`] to decode images on a worker thread
+/// and keep only the GPU upload on the thread that owns the context.
+///
+/// # Arguments
+///
+/// * `context_id` - The windowed context
+/// * `pixels` - `width * height * 4` bytes of RGBA8 data, row-major
+/// * `width` - Texture width in pixels
+/// * `height` - Texture height in pixels
+///
+/// # Returns
+///
+/// A texture handle on success, or `GOUD_INVALID_TEXTURE` on error.
+///
+/// # Safety
+///
+/// `pixels` must point to at least `width * height * 4` valid bytes.
+#[no_mangle]
+pub unsafe extern "C" fn goud_texture_create_rgba8(
+    context_id: GoudContextId,
+    pixels: *const u8,
+    width: u32,
+    height: u32,
+) -> GoudTextureHandle {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return GOUD_INVALID_TEXTURE;
+    }
+    if pixels.is_null() {
+        set_last_error(GoudError::InvalidState(
+            "pixels pointer is null".to_string(),
+        ));
+        return GOUD_INVALID_TEXTURE;
+    }
+    let Some(byte_count) = rgba8_byte_count(width, height) else {
+        set_last_error(GoudError::InvalidState(
+            "width and height must be > 0 and fit in memory".to_string(),
+        ));
+        return GOUD_INVALID_TEXTURE;
+    };
+
+    // SAFETY: caller guarantees pixels points to at least width * height * 4 bytes
+    let data = std::slice::from_raw_parts(pixels, byte_count);
+    upload_rgba8(context_id, width, height, data)
+}
+
+/// Reads the dimensions of an encoded image (PNG, JPEG, ...) without
+/// decoding its pixels.
+///
+/// Does not touch any context, so it may be called from any thread.
+///
+/// # Returns
+///
+/// `true` on success, `false` if the data is not a supported image.
+///
+/// # Safety
+///
+/// `data` must point to `len` valid bytes; `out_width` and `out_height` must
+/// be valid for writes.
+#[no_mangle]
+pub unsafe extern "C" fn goud_image_get_size(
+    data: *const u8,
+    len: usize,
+    out_width: *mut u32,
+    out_height: *mut u32,
+) -> bool {
+    if data.is_null() || out_width.is_null() || out_height.is_null() {
+        set_last_error(GoudError::InvalidState("null pointer argument".to_string()));
+        return false;
+    }
+
+    // SAFETY: caller guarantees data points to len valid bytes
+    let bytes = std::slice::from_raw_parts(data, len);
+    let dimensions = image::ImageReader::new(std::io::Cursor::new(bytes))
+        .with_guessed_format()
+        .map_err(|e| e.to_string())
+        .and_then(|reader| reader.into_dimensions().map_err(|e| e.to_string()));
+    match dimensions {
+        Ok((width, height)) => {
+            // SAFETY: caller guarantees out_width and out_height are valid for writes
+            *out_width = width;
+            *out_height = height;
+            true
+        }
+        Err(e) => {
+            set_last_error(GoudError::ResourceInvalidFormat(format!(
+                "Failed to read image header: {}",
+                e
+            )));
+            false
+        }
+    }
+}
+
+/// Decodes an encoded image (PNG, JPEG, ...) into tightly packed RGBA8.
+///
+/// Does not touch any context, so it may be called from any thread.  Size
+/// `out_pixels` with [`goud_image_get_size`] first.
+///
+/// # Returns
+///
+/// `true` on success, `false` if the data is not a supported image or
+/// `out_capacity` is smaller than `width * height * 4`.
+///
+/// # Safety
+///
+/// `data` must point to `len` valid bytes and `out_pixels` to `out_capacity`
+/// writable bytes.
+#[no_mangle]
+pub unsafe extern "C" fn goud_image_decode_rgba8(
+    data: *const u8,
+    len: usize,
+    out_pixels: *mut u8,
+    out_capacity: usize,
+) -> bool {
+    if data.is_null() || out_pixels.is_null() {
+        set_last_error(GoudError::InvalidState("null pointer argument".to_string()));
+        return false;
+    }
+
+    // SAFETY: caller guarantees data points to len valid bytes
+    let bytes = std::slice::from_raw_parts(data, len);
+    let img = match image::load_from_memory(bytes) {
+        Ok(i) => i.to_rgba8(),
+        Err(e) => {
+            set_last_error(GoudError::ResourceInvalidFormat(format!(
+                "Failed to decode image: {}",
+                e
+            )));
+            return false;
+        }
+    };
+
+    let raw = img.as_raw();
+    if raw.len() > out_capacity {
+        set_last_error(GoudError::InvalidState(format!(
+            "out_pixels holds {} bytes but the image needs {}",
+            out_capacity,
+            raw.len()
+        )));
+        return false;
+    }
+
+    // SAFETY: caller guarantees out_pixels has out_capacity >= raw.len() writable bytes
+    std::ptr::copy_nonoverlapping(raw.as_ptr(), out_pixels, raw.len());
+    true
+}
+
+fn rgba8_byte_count(width: u32, height: u32) -> Option<usize> {
+    if width == 0 || height == 0 {
+        return None;
+    }
+    (width as usize)
+        .checked_mul(height as usize)
+        .and_then(|n| n.checked_mul(4))
+}
+
+fn upload_rgba8(
+    context_id: GoudContextId,
+    width: u32,
+    height: u32,
+    data: &[u8],
+) -> GoudTextureHandle {
     let result = with_window_state(context_id, |state| {
         use crate::libs::graphics::backend::types::{TextureFilter, TextureFormat, TextureWrap};
         use crate::libs::graphics::backend::TextureOps;
@@ -80,7 +247,7 @@ pub unsafe extern "C" fn goud_texture_load(
             TextureFormat::RGBA8,
             TextureFilter::Linear,
             TextureWrap::ClampToEdge,
-            &data,
+            data,
         ) {
             Ok(handle) => {
                 // Pack index and generation into a u64 handle
@@ -133,6 +300,7 @@ pub extern "C" fn goud_texture_destroy(
         let handle = TextureHandle::new(index, generation);
 
         if state.backend_mut().destroy_texture(handle) {
+            super::texture_streaming::forget_streamed_texture(context_id, handle);
             true
         } else {
             set_last_error(GoudError::InvalidHandle);
@@ -141,3 +309,69 @@ pub extern "C" fn goud_texture_destroy(
     })
     .unwrap_or(false)
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::core::error::{clear_last_error, last_error_code, ERR_INVALID_STATE};
+
+    fn encoded_png(width: u32, height: u32) -> Vec<u8> {
+        let img = image::RgbaImage::from_fn(width, height, |x, y| {
+            image::Rgba([x as u8, y as u8, 7, 255])
+        });
+        let mut bytes = Vec::new();
+        img.write_to(
+            &mut std::io::Cursor::new(&mut bytes),
+            image::ImageFormat::Png,
+        )
+        .unwrap();
+        bytes
+    }
+
+    #[test]
+    fn image_get_size_reads_header() {
+        let png = encoded_png(3, 2);
+        let (mut width, mut height) = (0u32, 0u32);
+        // SAFETY: png is a live buffer and the out pointers are valid locals.
+        let ok = unsafe { goud_image_get_size(png.as_ptr(), png.len(), &mut width, &mut height) };
+        assert!(ok);
+        assert_eq!((width, height), (3, 2));
+    }
+
+    #[test]
+    fn image_decode_writes_rgba8() {
+        let png = encoded_png(3, 2);
+        let mut pixels = vec![0u8; 3 * 2 * 4];
+        // SAFETY: png and pixels are live buffers of the given lengths.
+        let ok = unsafe {
+            goud_image_decode_rgba8(png.as_ptr(), png.len(), pixels.as_mut_ptr(), pixels.len())
+        };
+        assert!(ok);
+        // Pixel (2, 1) is the last one.
+        assert_eq!(&pixels[20..24], &[2, 1, 7, 255]);
+    }
+
+    #[test]
+    fn image_decode_rejects_short_buffer() {
+        clear_last_error();
+        let png = encoded_png(3, 2);
+        let mut pixels = vec![0u8; 8];
+        // SAFETY: png and pixels are live buffers of the given lengths.
+        let ok = unsafe {
+            goud_image_decode_rgba8(png.as_ptr(), png.len(), pixels.as_mut_ptr(), pixels.len())
+        };
+        assert!(!ok);
+        assert_eq!(last_error_code(), ERR_INVALID_STATE);
+    }
+
+    #[test]
+    fn texture_create_rejects_zero_size() {
+        clear_last_error();
+        let pixels = [0u8; 4];
+        // SAFETY: pixels is a live buffer; zero dimensions are validated first.
+        let handle =
+            unsafe { goud_texture_create_rgba8(GoudContextId::new(7, 1), pixels.as_ptr(), 0, 1) };
+        assert_eq!(handle, GOUD_INVALID_TEXTURE);
+        assert_eq!(last_error_code(), ERR_INVALID_STATE);
+    }
+}
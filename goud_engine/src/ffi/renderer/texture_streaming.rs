@@ -0,0 +1,411 @@
+//! # Texture Streaming FFI
+//!
+//! Loads textures through the per-context [`TextureStreamer`], which uploads
+//! a small base tier first and re-uploads finer tiers as sprites using the
+//! texture are drawn larger on screen.  The sprite batch and the immediate
+//! sprite draws report on-screen sizes; `goud_renderer_end` starts decoding
+//! the resulting upgrades on worker threads, uploads the ones that have
+//! finished, and evicts least-recently-drawn textures to stay within the
+//! context's residency budget.
+//!
+//! Streamed textures are ordinary texture handles: they draw, report their
+//! full size, and are destroyed with `goud_texture_destroy`.  Resident bytes
+//! are reported as the `assets` category of
+//! `goud_debugger_get_memory_summary`; `goud_texture_streaming_get_stats`
+//! adds the budget and upgrade/eviction counters.
+
+use std::cell::RefCell;
+use std::collections::HashMap;
+use std::os::raw::c_char;
+use std::sync::Arc;
+
+use crate::core::debugger;
+use crate::core::error::{set_last_error, GoudError};
+use crate::ffi::context::{GoudContextId, GOUD_INVALID_CONTEXT_ID};
+use crate::ffi::window::with_window_state;
+use crate::libs::graphics::backend::types::TextureHandle;
+use crate::libs::graphics::backend::TextureOps;
+use crate::rendering::texture_streaming::{TextureStreamer, TextureStreamingStats};
+
+use super::draw::FfiSpriteCmd;
+use super::texture::{GoudTextureHandle, GOUD_INVALID_TEXTURE};
+
+thread_local! {
+    static STREAMERS: RefCell<HashMap<(u32, u32), TextureStreamer>> = RefCell::new(HashMap::new());
+}
+
+/// FFI-safe texture streaming counters.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default)]
+pub struct FfiTextureStreamingStats {
+    /// Streamed textures currently loaded.
+    pub textures: u64,
+    /// Bytes of texel storage currently resident on the GPU.
+    pub resident_bytes: u64,
+    /// Bytes the same textures would occupy fully resident.
+    pub full_bytes: u64,
+    /// Configured residency budget in bytes.
+    pub budget_bytes: u64,
+    /// Textures uploaded at a finer tier since the context was created.
+    pub upgrades: u64,
+    /// Textures returned to their base tier to stay within the budget.
+    pub evictions: u64,
+}
+
+impl From<TextureStreamingStats> for FfiTextureStreamingStats {
+    fn from(value: TextureStreamingStats) -> Self {
+        Self {
+            textures: value.textures,
+            resident_bytes: value.resident_bytes,
+            full_bytes: value.full_bytes,
+            budget_bytes: value.budget_bytes,
+            upgrades: value.upgrades,
+            evictions: value.evictions,
+        }
+    }
+}
+
+fn context_key(context_id: GoudContextId) -> (u32, u32) {
+    (context_id.index(), context_id.generation())
+}
+
+fn unpack(texture: GoudTextureHandle) -> TextureHandle {
+    TextureHandle::new(
+        (texture & 0xFFFFFFFF) as u32,
+        ((texture >> 32) & 0xFFFFFFFF) as u32,
+    )
+}
+
+fn report_residency(context_id: GoudContextId, streamer: &TextureStreamer) {
+    let _ = debugger::update_memory_category_for_context(
+        context_id,
+        "assets",
+        streamer.resident_bytes() as u64,
+    );
+}
+
+fn load_streamed(context_id: GoudContextId, source: Arc<[u8]>) -> GoudTextureHandle {
+    let result = with_window_state(context_id, |state| {
+        STREAMERS.with(|cell| {
+            let mut streamers = cell.borrow_mut();
+            let streamer = streamers.entry(context_key(context_id)).or_default();
+            let loaded = streamer.load(state.backend_mut(), source);
+            report_residency(context_id, streamer);
+            loaded
+        })
+    });
+    match result {
+        Some(Ok(handle)) => ((handle.generation() as u64) << 32) | (handle.index() as u64),
+        Some(Err(e)) => {
+            set_last_error(e);
+            GOUD_INVALID_TEXTURE
+        }
+        None => {
+            set_last_error(GoudError::InvalidContext);
+            GOUD_INVALID_TEXTURE
+        }
+    }
+}
+
+/// Loads an image file as a streamed texture.
+///
+/// Only the base tier (at most 64 pixels on the longer edge) is uploaded
+/// now; the encoded file stays in system memory for later upgrades.
+///
+/// # Returns
+///
+/// A texture handle on success, or `GOUD_INVALID_TEXTURE` on error.
+///
+/// # Safety
+///
+/// The `path` pointer must be a valid null-terminated C string.
+#[no_mangle]
+pub unsafe extern "C" fn goud_texture_stream_load(
+    context_id: GoudContextId,
+    path: *const c_char,
+) -> GoudTextureHandle {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return GOUD_INVALID_TEXTURE;
+    }
+    if path.is_null() {
+        set_last_error(GoudError::InvalidState("path pointer is null".to_string()));
+        return GOUD_INVALID_TEXTURE;
+    }
+
+    // SAFETY: caller guarantees path is a valid null-terminated C string
+    let Ok(path_str) = std::ffi::CStr::from_ptr(path).to_str() else {
+        set_last_error(GoudError::InternalError(
+            "Invalid UTF-8 in path".to_string(),
+        ));
+        return GOUD_INVALID_TEXTURE;
+    };
+    match std::fs::read(path_str) {
+        Ok(bytes) => load_streamed(context_id, bytes.into()),
+        Err(e) => {
+            set_last_error(GoudError::ResourceLoadFailed(format!(
+                "Failed to load image '{}': {}",
+                path_str, e
+            )));
+            GOUD_INVALID_TEXTURE
+        }
+    }
+}
+
+/// Loads an encoded image (PNG, JPEG, ...) from memory as a streamed texture.
+///
+/// The bytes are copied, so the caller may free them afterwards.
+///
+/// # Returns
+///
+/// A texture handle on success, or `GOUD_INVALID_TEXTURE` on error.
+///
+/// # Safety
+///
+/// `data` must point to `len` valid bytes.
+#[no_mangle]
+pub unsafe extern "C" fn goud_texture_stream_load_memory(
+    context_id: GoudContextId,
+    data: *const u8,
+    len: usize,
+) -> GoudTextureHandle {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return GOUD_INVALID_TEXTURE;
+    }
+    if data.is_null() || len == 0 {
+        set_last_error(GoudError::InvalidState(
+            "data pointer is null or empty".to_string(),
+        ));
+        return GOUD_INVALID_TEXTURE;
+    }
+
+    // SAFETY: caller guarantees data points to len valid bytes
+    let bytes = std::slice::from_raw_parts(data, len);
+    load_streamed(context_id, Arc::from(bytes))
+}
+
+/// Sets the context's texture residency budget in bytes.
+///
+/// The next `goud_renderer_end` returns least-recently-drawn textures to
+/// their base tier until the resident bytes fit.  Base tiers are never
+/// evicted, so a budget below their total is exceeded rather than enforced.
+#[no_mangle]
+pub extern "C" fn goud_texture_streaming_set_budget(
+    context_id: GoudContextId,
+    budget_bytes: u64,
+) -> bool {
+    if context_id == GOUD_INVALID_CONTEXT_ID || with_window_state(context_id, |_| ()).is_none() {
+        set_last_error(GoudError::InvalidContext);
+        return false;
+    }
+    STREAMERS.with(|cell| {
+        let mut streamers = cell.borrow_mut();
+        let streamer = streamers.entry(context_key(context_id)).or_default();
+        streamer.set_budget(usize::try_from(budget_bytes).unwrap_or(usize::MAX));
+    });
+    true
+}
+
+/// Writes residency, budget, and upgrade/eviction counters for the
+/// context's streamed textures.
+///
+/// # Safety
+///
+/// `out_stats` must be a valid pointer to writable memory.
+#[no_mangle]
+pub unsafe extern "C" fn goud_texture_streaming_get_stats(
+    context_id: GoudContextId,
+    out_stats: *mut FfiTextureStreamingStats,
+) -> bool {
+    if out_stats.is_null() {
+        set_last_error(GoudError::InvalidState(
+            "out_stats pointer is null".to_string(),
+        ));
+        return false;
+    }
+    if context_id == GOUD_INVALID_CONTEXT_ID || with_window_state(context_id, |_| ()).is_none() {
+        set_last_error(GoudError::InvalidContext);
+        return false;
+    }
+
+    let stats = STREAMERS.with(|cell| {
+        let mut streamers = cell.borrow_mut();
+        streamers
+            .entry(context_key(context_id))
+            .or_default()
+            .stats()
+    });
+    // SAFETY: out_stats is non-null and the caller guarantees it is writable.
+    *out_stats = stats.into();
+    true
+}
+
+/// Framebuffer pixels per window unit, which both sprite paths apply to
+/// the sizes they note so streaming sees the same size on HiDPI displays.
+pub(super) fn framebuffer_pixel_scale(window_width: u32, framebuffer_width: u32) -> f32 {
+    framebuffer_width as f32 / window_width.max(1) as f32
+}
+
+/// Records on-screen sizes for the streamed textures in a sprite batch.
+///
+/// `pixel_scale` converts the commands' window coordinates to framebuffer
+/// pixels.  Returns immediately when the context streams no textures.
+pub(super) fn note_sprite_batch<B: TextureOps + ?Sized>(
+    context_id: GoudContextId,
+    backend: &B,
+    cmds: &[&FfiSpriteCmd],
+    pixel_scale: f32,
+) {
+    STREAMERS.with(|cell| {
+        let mut streamers = cell.borrow_mut();
+        let Some(streamer) = streamers.get_mut(&context_key(context_id)) else {
+            return;
+        };
+        for cmd in cmds {
+            let handle = unpack(cmd.texture);
+            if !streamer.contains(handle) {
+                continue;
+            }
+            // The source rect spans only part of the texture, so the whole
+            // image would cover proportionally more of the screen.
+            let (mut uv_w, mut uv_h) = (1.0, 1.0);
+            if let Some((tw, th)) = backend.texture_size(handle) {
+                if cmd.src_w > 0.0 && cmd.src_h > 0.0 {
+                    uv_w = cmd.src_w / tw as f32;
+                    uv_h = cmd.src_h / th as f32;
+                }
+            }
+            streamer.note_draw(
+                handle,
+                (cmd.width * pixel_scale / uv_w).abs(),
+                (cmd.height * pixel_scale / uv_h).abs(),
+            );
+        }
+    });
+}
+
+/// Records the on-screen size of one immediate-mode sprite draw.
+///
+/// `uv_w` and `uv_h` are the normalized extent of the source rectangle.
+/// The size is scaled to framebuffer pixels, as in [`note_sprite_batch`].
+pub(super) fn note_sprite_draw(
+    context_id: GoudContextId,
+    texture: GoudTextureHandle,
+    width: f32,
+    height: f32,
+    uv_w: f32,
+    uv_h: f32,
+) {
+    STREAMERS.with(|cell| {
+        if let Some(streamer) = cell.borrow_mut().get_mut(&context_key(context_id)) {
+            let pixel_scale = with_window_state(context_id, |window_state| {
+                framebuffer_pixel_scale(
+                    window_state.get_size().0,
+                    window_state.get_framebuffer_size().0,
+                )
+            })
+            .unwrap_or(1.0);
+            let uv_w = if uv_w > 0.0 { uv_w } else { 1.0 };
+            let uv_h = if uv_h > 0.0 { uv_h } else { 1.0 };
+            streamer.note_draw(
+                unpack(texture),
+                (width * pixel_scale / uv_w).abs(),
+                (height * pixel_scale / uv_h).abs(),
+            );
+        }
+    });
+}
+
+/// Applies pending tier changes at the end of a frame.
+pub(super) fn update_texture_streaming<B: TextureOps + ?Sized>(
+    context_id: GoudContextId,
+    backend: &mut B,
+) {
+    STREAMERS.with(|cell| {
+        if let Some(streamer) = cell.borrow_mut().get_mut(&context_key(context_id)) {
+            if let Err(e) = streamer.update(backend) {
+                set_last_error(e);
+            }
+            report_residency(context_id, streamer);
+        }
+    });
+}
+
+/// Stops streaming a texture that `goud_texture_destroy` is destroying.
+pub(super) fn forget_streamed_texture(context_id: GoudContextId, texture: TextureHandle) {
+    STREAMERS.with(|cell| {
+        if let Some(streamer) = cell.borrow_mut().get_mut(&context_key(context_id)) {
+            if streamer.forget(texture) {
+                report_residency(context_id, streamer);
+            }
+        }
+    });
+}
+
+/// Releases all streamed textures for a destroyed context.
+pub(crate) fn cleanup_texture_streaming_state(context_id: GoudContextId) {
+    let removed = STREAMERS.with(|cell| cell.borrow_mut().remove(&context_key(context_id)));
+    if let Some(mut streamer) = removed {
+        let _ = with_window_state(context_id, |state| streamer.clear(state.backend_mut()));
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::core::error::{clear_last_error, last_error_code, ERR_INVALID_STATE};
+
+    #[test]
+    fn stream_load_memory_rejects_empty_data() {
+        clear_last_error();
+        // SAFETY: a null pointer is rejected before it is read.
+        let handle = unsafe {
+            goud_texture_stream_load_memory(GoudContextId::new(7, 1), std::ptr::null(), 0)
+        };
+        assert_eq!(handle, GOUD_INVALID_TEXTURE);
+        assert_eq!(last_error_code(), ERR_INVALID_STATE);
+    }
+
+    #[test]
+    fn streaming_calls_reject_invalid_context() {
+        assert!(!goud_texture_streaming_set_budget(
+            GOUD_INVALID_CONTEXT_ID,
+            1024
+        ));
+        let mut stats = FfiTextureStreamingStats::default();
+        // SAFETY: stats is a live local.
+        assert!(!unsafe { goud_texture_streaming_get_stats(GOUD_INVALID_CONTEXT_ID, &mut stats) });
+        // SAFETY: a null out pointer is rejected before it is written.
+        assert!(!unsafe {
+            goud_texture_streaming_get_stats(GoudContextId::new(7, 1), std::ptr::null_mut())
+        });
+    }
+
+    #[test]
+    fn stats_layout_is_six_u64() {
+        assert_eq!(std::mem::size_of::<FfiTextureStreamingStats>(), 48);
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::core::error::get_last_error;
+
+    #[test]
+    fn test_pixel_scale_matches_the_framebuffer() {
+        assert_eq!(framebuffer_pixel_scale(800, 1600), 2.0);
+        assert_eq!(framebuffer_pixel_scale(800, 800), 1.0);
+        assert_eq!(framebuffer_pixel_scale(0, 0), 0.0);
+    }
+
+    #[test]
+    fn test_stream_load_reports_a_null_path_as_invalid_state() {
+        // SAFETY: a null path is rejected before it is read.
+        let texture =
+            unsafe { goud_texture_stream_load(GoudContextId::new(1, 1), std::ptr::null()) };
+        assert_eq!(texture, GOUD_INVALID_TEXTURE);
+        assert!(matches!(get_last_error(), Some(GoudError::InvalidState(_))));
+    }
+}
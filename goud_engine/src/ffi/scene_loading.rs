@@ -1,20 +1,22 @@
 //! Scene load/unload FFI functions.
 //!
-//! Provides C-compatible exports for loading a scene from JSON and unloading
+//! Provides C-compatible exports for loading a scene from JSON or packed
+//! binary data, converting JSON scenes to the packed format, and unloading
 //! a scene by name.
 
+use crate::context_registry::scene::{scene_data_to_packed, scene_from_json};
 use crate::core::error::{set_last_error, GoudError, ERR_INTERNAL_ERROR};
 use crate::ffi::context::{get_context_registry, GoudContextId, GOUD_INVALID_CONTEXT_ID};
 use crate::ffi::types::GoudResult;
 
 /// Sentinel value returned when scene loading fails.
-const INVALID_SCENE_ID: u32 = u32::MAX;
+pub(crate) const INVALID_SCENE_ID: u32 = u32::MAX;
 
 /// Validates and decodes a UTF-8 string from an FFI byte pointer.
 ///
 /// On failure, sets last error and returns an error code for callers that
 /// need to produce a `GoudResult`.
-unsafe fn parse_utf8_arg<'a>(
+pub(crate) unsafe fn parse_utf8_arg<'a>(
     ptr: *const u8,
     len: u32,
     null_message: &str,
@@ -113,6 +115,140 @@ pub unsafe extern "C" fn goud_scene_load(
     }
 }
 
+/// Loads a scene from packed binary data.
+///
+/// `data_ptr` holds a packed scene produced by `goud_scene_pack_json` (or
+/// the engine's `scene_to_packed`).  The bytes are only read during the
+/// call, so they may come straight from a memory-mapped file.
+///
+/// # Safety
+///
+/// Caller must ensure `name_ptr` and `data_ptr` are valid for their
+/// respective lengths. Ownership is not transferred.
+///
+/// # Returns
+///
+/// The new scene ID, or `u32::MAX` on failure (see the last error).
+#[no_mangle]
+pub unsafe extern "C" fn goud_scene_load_packed(
+    context_id: GoudContextId,
+    name_ptr: *const u8,
+    name_len: u32,
+    data_ptr: *const u8,
+    data_len: u32,
+) -> u32 {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return INVALID_SCENE_ID;
+    }
+
+    let invalid_state_code = GoudError::InvalidState(String::new()).error_code();
+
+    // SAFETY: FFI caller contract guarantees pointer/length validity.
+    let name = match unsafe {
+        parse_utf8_arg(
+            name_ptr,
+            name_len,
+            "name_ptr is null",
+            "scene name is not valid UTF-8",
+            invalid_state_code,
+        )
+    } {
+        Ok(value) => value,
+        Err(_) => return INVALID_SCENE_ID,
+    };
+
+    if data_ptr.is_null() {
+        set_last_error(GoudError::InvalidState("data_ptr is null".to_string()));
+        return INVALID_SCENE_ID;
+    }
+    // SAFETY: Caller guarantees `data_ptr` is valid for `data_len` bytes.
+    let data = unsafe { std::slice::from_raw_parts(data_ptr, data_len as usize) };
+
+    let mut registry = match get_context_registry().lock() {
+        Ok(r) => r,
+        Err(_) => {
+            set_last_error(GoudError::InternalError(
+                "Failed to lock context registry".to_string(),
+            ));
+            return INVALID_SCENE_ID;
+        }
+    };
+
+    let context = match registry.get_mut(context_id) {
+        Some(ctx) => ctx,
+        None => {
+            set_last_error(GoudError::InvalidContext);
+            return INVALID_SCENE_ID;
+        }
+    };
+
+    match context.load_scene_from_packed(name, data) {
+        Ok(id) => id,
+        Err(err) => {
+            set_last_error(err);
+            INVALID_SCENE_ID
+        }
+    }
+}
+
+/// Converts a JSON scene to the packed binary format.
+///
+/// This is the offline converter behind `goud_scene_load_packed`: the
+/// output loads the same entities and built-in components as passing the
+/// JSON to `goud_scene_load`.  Call with a null `buf` to query the size.
+///
+/// # Safety
+///
+/// `json_ptr` must be valid for `json_len` bytes and `buf`, when non-null,
+/// for `buf_len` writable bytes.
+///
+/// # Returns
+///
+/// The number of bytes written; the negated required size if `buf` is null
+/// or too small; or 0 if the JSON is not a valid scene (see the last error).
+#[no_mangle]
+pub unsafe extern "C" fn goud_scene_pack_json(
+    json_ptr: *const u8,
+    json_len: u32,
+    buf: *mut u8,
+    buf_len: usize,
+) -> i32 {
+    // SAFETY: FFI caller contract guarantees pointer/length validity.
+    let json = match unsafe {
+        parse_utf8_arg(
+            json_ptr,
+            json_len,
+            "json_ptr is null",
+            "scene json is not valid UTF-8",
+            0,
+        )
+    } {
+        Ok(value) => value,
+        Err(_) => return 0,
+    };
+
+    let packed = match scene_from_json(json).and_then(|data| scene_data_to_packed(&data)) {
+        Ok(bytes) => bytes,
+        Err(err) => {
+            set_last_error(err);
+            return 0;
+        }
+    };
+    let Ok(len) = i32::try_from(packed.len()) else {
+        set_last_error(GoudError::InternalError(
+            "packed scene exceeds 2 GiB".to_string(),
+        ));
+        return 0;
+    };
+    if buf.is_null() || buf_len < packed.len() {
+        return -len;
+    }
+    // SAFETY: `buf` holds at least `packed.len()` writable bytes.
+    unsafe { std::ptr::copy_nonoverlapping(packed.as_ptr(), buf, packed.len()) };
+    len
+}
+
 /// Unloads a scene by name.
 ///
 /// # Safety
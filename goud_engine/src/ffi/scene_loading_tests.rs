@@ -190,3 +190,84 @@ fn test_scene_unload_invalid_utf8_name_fails() {
     assert!(result.is_err());
     teardown_context(ctx);
 }
+
+// ----- packed scenes --------------------------------------------------------
+
+#[test]
+fn test_scene_pack_json_then_load_packed() {
+    let ctx = setup_context();
+    let json =
+        br#"{"name":"packed","entities":[{"id":{"index":4,"generation":1},"components":{}}]}"#;
+
+    // SAFETY: `json` is valid UTF-8; a null buffer queries the size.
+    let required =
+        unsafe { goud_scene_pack_json(json.as_ptr(), json.len() as u32, std::ptr::null_mut(), 0) };
+    assert!(required < 0, "size query returns the negated size");
+    let mut packed = vec![0u8; (-required) as usize];
+    // SAFETY: `packed` holds exactly the required number of bytes.
+    let written = unsafe {
+        goud_scene_pack_json(
+            json.as_ptr(),
+            json.len() as u32,
+            packed.as_mut_ptr(),
+            packed.len(),
+        )
+    };
+    assert_eq!(written, -required);
+
+    let name = b"packed_level";
+    // SAFETY: `name` and `packed` are valid for their lengths.
+    let loaded_id = unsafe {
+        goud_scene_load_packed(
+            ctx,
+            name.as_ptr(),
+            name.len() as u32,
+            packed.as_ptr(),
+            packed.len() as u32,
+        )
+    };
+    assert_ne!(loaded_id, u32::MAX, "packed scene load should succeed");
+
+    // Corrupt data fails without leaving a scene behind.
+    let other = b"broken";
+    // SAFETY: `other` and `packed` are valid for their lengths.
+    let broken_id = unsafe {
+        goud_scene_load_packed(
+            ctx,
+            other.as_ptr(),
+            other.len() as u32,
+            packed.as_ptr(),
+            (packed.len() - 1) as u32,
+        )
+    };
+    assert_eq!(broken_id, u32::MAX);
+    // SAFETY: `other` points to valid UTF-8.
+    let missing = unsafe { goud_scene_get_by_name(ctx, other.as_ptr(), other.len() as u32) };
+    assert_eq!(missing, u32::MAX);
+
+    teardown_context(ctx);
+}
+
+#[test]
+fn test_scene_pack_json_rejects_invalid_json() {
+    let json = b"{not json";
+    let mut buf = [0u8; 64];
+    goud_clear_last_error();
+    // SAFETY: `json` and `buf` are valid for their lengths.
+    let written =
+        unsafe { goud_scene_pack_json(json.as_ptr(), json.len() as u32, buf.as_mut_ptr(), 64) };
+    assert_eq!(written, 0);
+    assert_ne!(goud_last_error_code(), SUCCESS);
+
+    // SAFETY: A null data pointer is the error path under test.
+    let id = unsafe {
+        goud_scene_load_packed(
+            GOUD_INVALID_CONTEXT_ID,
+            b"x".as_ptr(),
+            1,
+            std::ptr::null(),
+            0,
+        )
+    };
+    assert_eq!(id, u32::MAX);
+}
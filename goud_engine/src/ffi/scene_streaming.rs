@@ -0,0 +1,206 @@
+//! Streamed scene loading FFI functions.
+//!
+//! Provides C-compatible exports that load a packed scene over several
+//! frames under a per-frame time budget.  Progress uses the same `[0.0, 1.0]`
+//! range and `-1.0` sentinel as `goud_scene_transition_progress`, so a
+//! loading screen can show both; once a load reports `1.0`, start the
+//! transition into it with `goud_scene_transition_to`.
+
+use std::time::Duration;
+
+use crate::core::error::{set_last_error, GoudError, ERR_INTERNAL_ERROR};
+use crate::ffi::context::{get_context_registry, GoudContextId, GOUD_INVALID_CONTEXT_ID};
+use crate::ffi::scene_loading::{parse_utf8_arg, INVALID_SCENE_ID};
+use crate::ffi::types::GoudResult;
+
+/// Starts loading a packed scene over several frames.
+///
+/// The scene is created empty and the data is copied, so the caller's
+/// buffer (or memory map) may be released when this returns.  Advance the
+/// load with [`goud_scene_stream_step`].
+///
+/// # Safety
+///
+/// Caller must ensure `name_ptr` and `data_ptr` are valid for their
+/// respective lengths. Ownership is not transferred.
+///
+/// # Returns
+///
+/// The new scene ID, or `u32::MAX` on failure (see the last error).
+#[no_mangle]
+pub unsafe extern "C" fn goud_scene_stream_begin(
+    context_id: GoudContextId,
+    name_ptr: *const u8,
+    name_len: u32,
+    data_ptr: *const u8,
+    data_len: u32,
+) -> u32 {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return INVALID_SCENE_ID;
+    }
+
+    let invalid_state_code = GoudError::InvalidState(String::new()).error_code();
+
+    // SAFETY: FFI caller contract guarantees pointer/length validity.
+    let name = match unsafe {
+        parse_utf8_arg(
+            name_ptr,
+            name_len,
+            "name_ptr is null",
+            "scene name is not valid UTF-8",
+            invalid_state_code,
+        )
+    } {
+        Ok(value) => value,
+        Err(_) => return INVALID_SCENE_ID,
+    };
+
+    if data_ptr.is_null() {
+        set_last_error(GoudError::InvalidState("data_ptr is null".to_string()));
+        return INVALID_SCENE_ID;
+    }
+    // SAFETY: Caller guarantees `data_ptr` is valid for `data_len` bytes.
+    let data = unsafe { std::slice::from_raw_parts(data_ptr, data_len as usize) }.to_vec();
+
+    let mut registry = match get_context_registry().lock() {
+        Ok(r) => r,
+        Err(_) => {
+            set_last_error(GoudError::InternalError(
+                "Failed to lock context registry".to_string(),
+            ));
+            return INVALID_SCENE_ID;
+        }
+    };
+
+    let context = match registry.get_mut(context_id) {
+        Some(ctx) => ctx,
+        None => {
+            set_last_error(GoudError::InvalidContext);
+            return INVALID_SCENE_ID;
+        }
+    };
+
+    match context.begin_scene_stream(name, data) {
+        Ok(id) => id,
+        Err(err) => {
+            set_last_error(err);
+            INVALID_SCENE_ID
+        }
+    }
+}
+
+/// Advances the streamed load of a scene for up to `budget_us` microseconds.
+///
+/// At least one block of entities is loaded per call, so progress is made
+/// even with a zero budget.  If the load fails, the partially loaded scene
+/// is destroyed.
+///
+/// # Arguments
+///
+/// * `context_id` - The context containing the scene
+/// * `scene_id` - The scene returned by [`goud_scene_stream_begin`]
+/// * `budget_us` - Time budget for this call in microseconds
+///
+/// # Returns
+///
+/// The load progress in `[0.0, 1.0]` (`1.0` once complete, and for scenes
+/// with no load in progress), or `-1.0` on error.
+#[no_mangle]
+pub extern "C" fn goud_scene_stream_step(
+    context_id: GoudContextId,
+    scene_id: u32,
+    budget_us: u32,
+) -> f32 {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return -1.0;
+    }
+
+    let mut registry = match get_context_registry().lock() {
+        Ok(r) => r,
+        Err(_) => {
+            set_last_error(GoudError::InternalError(
+                "Failed to lock context registry".to_string(),
+            ));
+            return -1.0;
+        }
+    };
+    let context = match registry.get_mut(context_id) {
+        Some(ctx) => ctx,
+        None => {
+            set_last_error(GoudError::InvalidContext);
+            return -1.0;
+        }
+    };
+
+    match context.step_scene_stream(scene_id, Duration::from_micros(u64::from(budget_us))) {
+        Ok(progress) => progress,
+        Err(err) => {
+            set_last_error(err);
+            -1.0
+        }
+    }
+}
+
+/// Returns the progress of a scene's streamed load.
+///
+/// # Returns
+///
+/// A value in `[0.0, 1.0]`, or `-1.0` if no load is in progress for the
+/// scene or on error.
+#[no_mangle]
+pub extern "C" fn goud_scene_stream_progress(context_id: GoudContextId, scene_id: u32) -> f32 {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        return -1.0;
+    }
+
+    let registry = match get_context_registry().lock() {
+        Ok(r) => r,
+        Err(_) => return -1.0,
+    };
+    let context = match registry.get(context_id) {
+        Some(ctx) => ctx,
+        None => return -1.0,
+    };
+
+    context.scene_stream_progress(scene_id).unwrap_or(-1.0)
+}
+
+/// Cancels a scene's streamed load and destroys the scene.
+///
+/// # Returns
+///
+/// A `GoudResult` indicating success or failure.
+#[no_mangle]
+pub extern "C" fn goud_scene_stream_cancel(context_id: GoudContextId, scene_id: u32) -> GoudResult {
+    if context_id == GOUD_INVALID_CONTEXT_ID {
+        set_last_error(GoudError::InvalidContext);
+        return GoudResult::err(GoudError::InvalidContext.error_code());
+    }
+
+    let mut registry = match get_context_registry().lock() {
+        Ok(r) => r,
+        Err(_) => return GoudResult::err(ERR_INTERNAL_ERROR),
+    };
+    let context = match registry.get_mut(context_id) {
+        Some(ctx) => ctx,
+        None => {
+            set_last_error(GoudError::InvalidContext);
+            return GoudResult::err(GoudError::InvalidContext.error_code());
+        }
+    };
+
+    match context.cancel_scene_stream(scene_id) {
+        Ok(()) => GoudResult::ok(),
+        Err(err) => {
+            let code = err.error_code();
+            set_last_error(err);
+            GoudResult::err(code)
+        }
+    }
+}
+
+#[cfg(test)]
+#[path = "scene_streaming_tests.rs"]
+mod tests;
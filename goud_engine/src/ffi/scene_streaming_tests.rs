@@ -0,0 +1,97 @@
+use super::*;
+use crate::context_registry::scene::scene_to_packed;
+use crate::core::math::Vec2;
+use crate::ecs::components::Transform2D;
+use crate::ecs::World;
+use crate::ffi::context::{goud_context_create, goud_context_destroy};
+use crate::ffi::scene::goud_scene_get_by_name;
+
+/// Helper: packs a scene of `count` transform-only entities.
+fn packed_scene(count: usize) -> Vec<u8> {
+    let mut world = World::new();
+    world.register_builtin_serializables();
+    for i in 0..count {
+        let entity = world.spawn_empty();
+        world.insert(
+            entity,
+            Transform2D::new(Vec2::new(i as f32, 0.0), 0.0, Vec2::one()),
+        );
+    }
+    scene_to_packed(&world, "streamed").unwrap()
+}
+
+/// Helper: begins a streamed load of `data` as scene `name`.
+fn begin(ctx: GoudContextId, name: &[u8], data: &[u8]) -> u32 {
+    // SAFETY: `name` and `data` are valid for their lengths.
+    unsafe {
+        goud_scene_stream_begin(
+            ctx,
+            name.as_ptr(),
+            name.len() as u32,
+            data.as_ptr(),
+            data.len() as u32,
+        )
+    }
+}
+
+#[test]
+fn test_ffi_stream_steps_to_completion() {
+    let ctx = goud_context_create();
+    let scene = begin(ctx, b"streamed", &packed_scene(3000));
+    assert_ne!(scene, u32::MAX);
+    assert_eq!(goud_scene_stream_progress(ctx, scene), 0.0);
+
+    let mut last = 0.0;
+    while last < 1.0 {
+        let progress = goud_scene_stream_step(ctx, scene, 0);
+        assert!(progress > last, "progress must advance");
+        last = progress;
+    }
+    assert_eq!(
+        goud_scene_stream_progress(ctx, scene),
+        -1.0,
+        "completed loads are dropped"
+    );
+    assert_eq!(goud_scene_stream_step(ctx, scene, 0), 1.0);
+    assert!(goud_scene_stream_cancel(ctx, scene).is_err());
+
+    let registry = get_context_registry().lock().unwrap();
+    let context = registry.get(ctx).unwrap();
+    let world = context.scene_manager().get_scene(scene).unwrap();
+    assert_eq!(world.entity_count(), 3000);
+    drop(registry);
+    goud_context_destroy(ctx);
+}
+
+#[test]
+fn test_ffi_stream_cancel_destroys_the_scene() {
+    let ctx = goud_context_create();
+    let name = b"cancelled";
+    let scene = begin(ctx, name, &packed_scene(10));
+    assert_ne!(scene, u32::MAX);
+    assert!(goud_scene_stream_cancel(ctx, scene).is_ok());
+    // SAFETY: `name` points to valid UTF-8.
+    let found = unsafe { goud_scene_get_by_name(ctx, name.as_ptr(), name.len() as u32) };
+    assert_eq!(found, u32::MAX);
+    assert_eq!(goud_scene_stream_step(ctx, scene, 0), -1.0);
+    goud_context_destroy(ctx);
+}
+
+#[test]
+fn test_ffi_stream_rejects_bad_arguments() {
+    let ctx = goud_context_create();
+    assert_eq!(
+        begin(GOUD_INVALID_CONTEXT_ID, b"x", &packed_scene(1)),
+        u32::MAX
+    );
+    assert_eq!(begin(ctx, b"x", b"not a packed scene"), u32::MAX);
+    // SAFETY: A null data pointer is the error path under test.
+    let id = unsafe { goud_scene_stream_begin(ctx, b"x".as_ptr(), 1, std::ptr::null(), 0) };
+    assert_eq!(id, u32::MAX);
+    assert_eq!(
+        goud_scene_stream_step(GOUD_INVALID_CONTEXT_ID, 0, 100),
+        -1.0
+    );
+    assert_eq!(goud_scene_stream_progress(ctx, 12345), -1.0);
+    goud_context_destroy(ctx);
+}
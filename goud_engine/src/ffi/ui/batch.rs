@@ -0,0 +1,275 @@
+//! Batched UI mutation FFI export.
+//!
+//! Building a screen one `goud_ui_*` call per property costs one boundary
+//! crossing per field.  [`goud_ui_apply_commands`] applies a whole array of
+//! [`FfiUiCommand`] values in one call; layout is still deferred to the next
+//! `goud_ui_manager_update`, which only re-lays-out the nodes the commands
+//! touched.
+//!
+//! A command may name a node created earlier in the same array by passing
+//! `UI_COMMAND_RESULT_REF | index` of that command instead of a node id.
+
+use crate::ui::{UiManager, UiNodeId};
+
+use super::node::{goud_ui_create_node, goud_ui_remove_node, goud_ui_set_parent};
+use super::widget::{
+    goud_ui_set_button_enabled, goud_ui_set_image_texture_path, goud_ui_set_label_text,
+    goud_ui_set_node_position, goud_ui_set_node_visible, goud_ui_set_slider, goud_ui_set_style,
+    goud_ui_set_widget, ERR_NODE_NOT_FOUND, ERR_UNKNOWN_WIDGET,
+};
+use super::{
+    component_from_widget_kind, unpack_node_id, FfiUiStyle, ERR_NULL_MANAGER, ERR_NULL_PTR,
+    INVALID_NODE_U64,
+};
+
+/// Error code for a command with an unknown `kind`.
+const ERR_UNKNOWN_COMMAND: i32 = -6;
+
+/// Node id tag referring to an earlier command's result; OR in the command index.
+pub const UI_COMMAND_RESULT_REF: u64 = 0xFFFF_FFFE_0000_0000;
+
+/// `goud_ui_create_node(widget_kind)`; the new id is the command's result.
+///
+/// Unlike the single call, an unknown `widget_kind` fails the command
+/// instead of creating a node without a component.
+pub const UI_COMMAND_CREATE_NODE: u32 = 0;
+/// `goud_ui_remove_node(node_id)`.
+pub const UI_COMMAND_REMOVE_NODE: u32 = 1;
+/// `goud_ui_set_parent(node_id, parent_id)`.
+pub const UI_COMMAND_SET_PARENT: u32 = 2;
+/// `goud_ui_set_widget(node_id, widget_kind)`.
+pub const UI_COMMAND_SET_WIDGET: u32 = 3;
+/// `goud_ui_set_style(node_id, style)`.
+pub const UI_COMMAND_SET_STYLE: u32 = 4;
+/// `goud_ui_set_label_text(node_id, text_ptr, text_len)`.
+pub const UI_COMMAND_SET_LABEL_TEXT: u32 = 5;
+/// `goud_ui_set_button_enabled(node_id, flag)`.
+pub const UI_COMMAND_SET_BUTTON_ENABLED: u32 = 6;
+/// `goud_ui_set_image_texture_path(node_id, text_ptr, text_len)`.
+pub const UI_COMMAND_SET_IMAGE_TEXTURE_PATH: u32 = 7;
+/// `goud_ui_set_slider(node_id, x = min, y = max, z = value, flag = enabled)`.
+pub const UI_COMMAND_SET_SLIDER: u32 = 8;
+/// `goud_ui_set_node_position(node_id, x, y)`.
+pub const UI_COMMAND_SET_NODE_POSITION: u32 = 9;
+/// `goud_ui_set_node_visible(node_id, flag)`.
+pub const UI_COMMAND_SET_NODE_VISIBLE: u32 = 10;
+/// Sets the node's layout size to `(x, y)`.
+pub const UI_COMMAND_SET_NODE_SIZE: u32 = 11;
+
+/// One queued UI mutation for [`goud_ui_apply_commands`].
+///
+/// Fields a command kind does not use are ignored.
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct FfiUiCommand {
+    /// One of the `UI_COMMAND_*` kinds.
+    pub kind: u32,
+    /// Widget kind for create/set-widget commands (same codes as `goud_ui_create_node`).
+    pub widget_kind: i32,
+    /// Target node id, or a result reference.
+    pub node_id: u64,
+    /// Parent for set-parent (`u64::MAX` detaches), or a result reference.
+    pub parent_id: u64,
+    /// First float argument.
+    pub x: f32,
+    /// Second float argument.
+    pub y: f32,
+    /// Third float argument.
+    pub z: f32,
+    /// Boolean argument.
+    pub flag: bool,
+    /// UTF-8 bytes for label text and texture paths; nullable when `text_len` is 0.
+    pub text_ptr: *const u8,
+    /// Length in bytes for `text_ptr`.
+    pub text_len: usize,
+    /// Style payload for set-style commands.
+    pub style: *const FfiUiStyle,
+}
+
+impl Default for FfiUiCommand {
+    fn default() -> Self {
+        Self {
+            kind: UI_COMMAND_CREATE_NODE,
+            widget_kind: -1,
+            node_id: INVALID_NODE_U64,
+            parent_id: INVALID_NODE_U64,
+            x: 0.0,
+            y: 0.0,
+            z: 0.0,
+            flag: false,
+            text_ptr: std::ptr::null(),
+            text_len: 0,
+            style: std::ptr::null(),
+        }
+    }
+}
+
+fn resolve_node(id: u64, results: &[u64]) -> Result<u64, i32> {
+    if id & (u64::MAX << 32) != UI_COMMAND_RESULT_REF {
+        return Ok(id);
+    }
+    match results.get(id as u32 as usize) {
+        Some(&resolved) if resolved != INVALID_NODE_U64 => Ok(resolved),
+        _ => Err(ERR_NODE_NOT_FOUND),
+    }
+}
+
+/// Applies `count` UI mutations in order.
+///
+/// Each command behaves exactly like the matching single-property
+/// `goud_ui_*` call.  Application stops at the first failing command, whose
+/// error code is returned; the commands before it stay applied.
+///
+/// # Arguments
+///
+/// * `mgr` - Mutable pointer to the [`UiManager`]. Must not be null.
+/// * `commands` - Array of `count` commands; may be null when `count` is 0.
+/// * `count` - Number of commands.
+/// * `out_results` - Optional array of `count` ids.  Receives the new id for
+///   create commands, the resolved target id for the others, and
+///   `u64::MAX` for commands not applied.
+/// * `out_applied` - Optional; receives the number of commands applied.
+///
+/// # Returns
+///
+/// * `0` when every command was applied
+/// * `-1` if `mgr` is null
+/// * `-2` if `commands` is null with a non-zero `count`
+/// * `-3` if a result reference names a command not applied before this one
+/// * `-5` if a create command's widget kind is unknown; nothing is created
+/// * `-6` if a command kind is unknown
+/// * otherwise the failing single-property call's error code
+///
+/// # Safety
+///
+/// `mgr` must be null (handled) or a valid exclusive pointer to `UiManager`.
+/// `commands` must be valid for `count` reads and `out_results`, when
+/// non-null, for `count` writes.  Pointers inside each command follow the
+/// rules of the matching single-property call.
+#[no_mangle]
+pub unsafe extern "C" fn goud_ui_apply_commands(
+    mgr: *mut UiManager,
+    commands: *const FfiUiCommand,
+    count: u32,
+    out_results: *mut u64,
+    out_applied: *mut u32,
+) -> i32 {
+    if !out_applied.is_null() {
+        // SAFETY: Caller guarantees a non-null `out_applied` is writable.
+        unsafe { *out_applied = 0 };
+    }
+    if mgr.is_null() {
+        return ERR_NULL_MANAGER;
+    }
+    if count == 0 {
+        return 0;
+    }
+    if commands.is_null() {
+        return ERR_NULL_PTR;
+    }
+
+    // SAFETY: Caller guarantees `commands` is valid for `count` reads.
+    let commands = unsafe { std::slice::from_raw_parts(commands, count as usize) };
+    let mut results = vec![INVALID_NODE_U64; commands.len()];
+    let mut status = 0;
+    let mut applied = 0u32;
+    for (index, command) in commands.iter().enumerate() {
+        // SAFETY: Caller guarantees `mgr` and the command's pointers are valid.
+        match unsafe { apply_command(mgr, command, &results) } {
+            Ok(id) => {
+                results[index] = id;
+                applied += 1;
+            }
+            Err(code) => {
+                status = code;
+                break;
+            }
+        }
+    }
+
+    if !out_results.is_null() {
+        // SAFETY: Caller guarantees a non-null `out_results` holds `count` ids.
+        unsafe { std::ptr::copy_nonoverlapping(results.as_ptr(), out_results, results.len()) };
+    }
+    if !out_applied.is_null() {
+        // SAFETY: Caller guarantees a non-null `out_applied` is writable.
+        unsafe { *out_applied = applied };
+    }
+    status
+}
+
+/// Applies one command, returning its result id.
+///
+/// # Safety
+///
+/// Same contract as [`goud_ui_apply_commands`] for one command.
+unsafe fn apply_command(
+    mgr: *mut UiManager,
+    command: &FfiUiCommand,
+    results: &[u64],
+) -> Result<u64, i32> {
+    if command.kind == UI_COMMAND_CREATE_NODE {
+        if component_from_widget_kind(command.widget_kind).is_none() {
+            return Err(ERR_UNKNOWN_WIDGET);
+        }
+        // SAFETY: Caller guarantees `mgr` is a valid exclusive pointer.
+        let id = unsafe { goud_ui_create_node(mgr, command.widget_kind) };
+        return if id == INVALID_NODE_U64 {
+            Err(ERR_NULL_MANAGER)
+        } else {
+            Ok(id)
+        };
+    }
+
+    let node = resolve_node(command.node_id, results)?;
+    // SAFETY: Caller guarantees `mgr` and the command's pointers are valid;
+    // each call below checks its own arguments.
+    let code = unsafe {
+        match command.kind {
+            UI_COMMAND_REMOVE_NODE => goud_ui_remove_node(mgr, node),
+            UI_COMMAND_SET_PARENT => {
+                goud_ui_set_parent(mgr, node, resolve_node(command.parent_id, results)?)
+            }
+            UI_COMMAND_SET_WIDGET => goud_ui_set_widget(mgr, node, command.widget_kind),
+            UI_COMMAND_SET_STYLE => goud_ui_set_style(mgr, node, command.style),
+            UI_COMMAND_SET_LABEL_TEXT => {
+                goud_ui_set_label_text(mgr, node, command.text_ptr, command.text_len)
+            }
+            UI_COMMAND_SET_BUTTON_ENABLED => goud_ui_set_button_enabled(mgr, node, command.flag),
+            UI_COMMAND_SET_IMAGE_TEXTURE_PATH => {
+                goud_ui_set_image_texture_path(mgr, node, command.text_ptr, command.text_len)
+            }
+            UI_COMMAND_SET_SLIDER => {
+                goud_ui_set_slider(mgr, node, command.x, command.y, command.z, command.flag)
+            }
+            UI_COMMAND_SET_NODE_POSITION => {
+                goud_ui_set_node_position(mgr, node, command.x, command.y)
+            }
+            UI_COMMAND_SET_NODE_VISIBLE => goud_ui_set_node_visible(mgr, node, command.flag),
+            UI_COMMAND_SET_NODE_SIZE => set_node_size(mgr, unpack_node_id(node), command),
+            _ => ERR_UNKNOWN_COMMAND,
+        }
+    };
+    if code == 0 {
+        Ok(node)
+    } else {
+        Err(code)
+    }
+}
+
+/// # Safety
+///
+/// `mgr` must be a valid exclusive pointer to `UiManager`.
+unsafe fn set_node_size(mgr: *mut UiManager, id: UiNodeId, command: &FfiUiCommand) -> i32 {
+    // SAFETY: Caller guarantees `mgr` is a valid exclusive pointer.
+    let manager = unsafe { &mut *mgr };
+    let Some(node) = manager.get_node_mut(id) else {
+        return ERR_NODE_NOT_FOUND;
+    };
+    node.set_size(crate::core::math::Vec2::new(command.x, command.y));
+    0
+}
+
+#[cfg(test)]
+#[path = "batch_tests.rs"]
+mod tests;
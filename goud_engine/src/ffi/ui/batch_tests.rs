@@ -0,0 +1,173 @@
+use super::*;
+use crate::ffi::ui::manager::{goud_ui_manager_create, goud_ui_manager_destroy};
+use crate::ffi::ui::node::goud_ui_get_parent;
+use crate::ui::UiComponent;
+
+fn create(widget_kind: i32) -> FfiUiCommand {
+    FfiUiCommand {
+        kind: UI_COMMAND_CREATE_NODE,
+        widget_kind,
+        ..FfiUiCommand::default()
+    }
+}
+
+fn command(kind: u32, node_id: u64) -> FfiUiCommand {
+    FfiUiCommand {
+        kind,
+        node_id,
+        ..FfiUiCommand::default()
+    }
+}
+
+#[test]
+fn test_apply_commands_builds_a_tree_with_result_refs() {
+    let mgr = goud_ui_manager_create();
+    let text = "Gold: 12";
+    let commands = [
+        create(0),
+        create(2),
+        FfiUiCommand {
+            parent_id: UI_COMMAND_RESULT_REF,
+            ..command(UI_COMMAND_SET_PARENT, UI_COMMAND_RESULT_REF | 1)
+        },
+        FfiUiCommand {
+            text_ptr: text.as_ptr(),
+            text_len: text.len(),
+            ..command(UI_COMMAND_SET_LABEL_TEXT, UI_COMMAND_RESULT_REF | 1)
+        },
+        FfiUiCommand {
+            x: 120.0,
+            y: 24.0,
+            ..command(UI_COMMAND_SET_NODE_SIZE, UI_COMMAND_RESULT_REF | 1)
+        },
+    ];
+    let mut results = [0u64; 5];
+    let mut applied = 0u32;
+
+    // SAFETY: `mgr` is valid and every buffer matches `commands.len()`.
+    unsafe {
+        assert_eq!(
+            goud_ui_apply_commands(
+                mgr,
+                commands.as_ptr(),
+                commands.len() as u32,
+                results.as_mut_ptr(),
+                &mut applied,
+            ),
+            0
+        );
+        assert_eq!(applied, 5);
+        let (panel, label) = (results[0], results[1]);
+        assert_eq!(results[2..], [label, label, label]);
+        assert_eq!(goud_ui_get_parent(mgr, label), panel);
+
+        let node = (*mgr).get_node(unpack_node_id(label)).unwrap();
+        assert!(matches!(
+            node.component(),
+            Some(UiComponent::Label(l)) if l.text == text
+        ));
+        assert_eq!(node.size(), crate::core::math::Vec2::new(120.0, 24.0));
+        goud_ui_manager_destroy(mgr);
+    }
+}
+
+#[test]
+fn test_apply_commands_stops_at_the_first_failure() {
+    let mgr = goud_ui_manager_create();
+    let commands = [
+        create(0),
+        command(UI_COMMAND_SET_NODE_VISIBLE, UI_COMMAND_RESULT_REF),
+        command(UI_COMMAND_SET_WIDGET, UI_COMMAND_RESULT_REF | 3),
+        create(1),
+    ];
+    let mut results = [0u64; 4];
+    let mut applied = 0u32;
+
+    // SAFETY: `mgr` is valid and every buffer matches `commands.len()`.
+    unsafe {
+        assert_eq!(
+            goud_ui_apply_commands(
+                mgr,
+                commands.as_ptr(),
+                commands.len() as u32,
+                results.as_mut_ptr(),
+                &mut applied,
+            ),
+            ERR_NODE_NOT_FOUND
+        );
+        assert_eq!(applied, 2);
+        assert_eq!(results[2..], [INVALID_NODE_U64, INVALID_NODE_U64]);
+        assert_eq!((*mgr).node_count(), 1);
+        assert!(!(*mgr)
+            .get_node(unpack_node_id(results[0]))
+            .unwrap()
+            .visible());
+        goud_ui_manager_destroy(mgr);
+    }
+}
+
+#[test]
+fn test_apply_commands_fails_a_create_with_an_unknown_widget_kind() {
+    let mgr = goud_ui_manager_create();
+    let commands = [
+        create(99),
+        command(UI_COMMAND_SET_NODE_VISIBLE, UI_COMMAND_RESULT_REF),
+    ];
+    let mut results = [0u64; 2];
+    let mut applied = 7u32;
+
+    // SAFETY: `mgr` is valid and every buffer matches `commands.len()`.
+    unsafe {
+        assert_eq!(
+            goud_ui_apply_commands(
+                mgr,
+                commands.as_ptr(),
+                commands.len() as u32,
+                results.as_mut_ptr(),
+                &mut applied,
+            ),
+            ERR_UNKNOWN_WIDGET
+        );
+        assert_eq!(applied, 0);
+        assert_eq!(results, [INVALID_NODE_U64, INVALID_NODE_U64]);
+        assert_eq!((*mgr).node_count(), 0);
+        goud_ui_manager_destroy(mgr);
+    }
+}
+
+#[test]
+fn test_apply_commands_rejects_bad_arguments() {
+    let mgr = goud_ui_manager_create();
+    let mut applied = 7u32;
+    let unknown = [command(99, 0)];
+
+    // SAFETY: Null pointers are the error paths under test; `unknown` is valid.
+    unsafe {
+        assert_eq!(
+            goud_ui_apply_commands(
+                std::ptr::null_mut(),
+                unknown.as_ptr(),
+                1,
+                std::ptr::null_mut(),
+                &mut applied,
+            ),
+            ERR_NULL_MANAGER
+        );
+        assert_eq!(applied, 0);
+        assert_eq!(
+            goud_ui_apply_commands(mgr, std::ptr::null(), 1, std::ptr::null_mut(), &mut applied),
+            ERR_NULL_PTR
+        );
+        assert_eq!(
+            goud_ui_apply_commands(mgr, std::ptr::null(), 0, std::ptr::null_mut(), &mut applied),
+            0
+        );
+        let node = goud_ui_create_node(mgr, 0);
+        let unknown = [command(99, node)];
+        assert_eq!(
+            goud_ui_apply_commands(mgr, unknown.as_ptr(), 1, std::ptr::null_mut(), &mut applied),
+            ERR_UNKNOWN_COMMAND
+        );
+        goud_ui_manager_destroy(mgr);
+    }
+}
@@ -187,6 +187,41 @@ pub unsafe extern "C" fn goud_ui_events_read(
     unsafe { goud_ui_event_read(mgr, index, out_event) }
 }
 
+/// Copies the UI events captured in the latest FFI UI update tick into
+/// `out_events` in one call.
+///
+/// At most `capacity` events are written, in capture order; a buffer sized
+/// by `goud_ui_event_count` always holds every event.  The captured events
+/// are not consumed.
+///
+/// # Returns
+/// The number of events written; 0 if `mgr` or `out_events` is null.
+///
+/// # Safety
+/// `out_events` must point to `capacity` writable `FfiUiEvent`s.
+#[no_mangle]
+pub unsafe extern "C" fn goud_ui_events_copy(
+    mgr: *const UiManager,
+    out_events: *mut FfiUiEvent,
+    capacity: u32,
+) -> u32 {
+    if mgr.is_null() || out_events.is_null() || capacity == 0 {
+        return 0;
+    }
+
+    let key = mgr as usize;
+    let Ok(snapshots) = event_snapshots().lock() else {
+        return 0;
+    };
+    let Some(events) = snapshots.get(&key) else {
+        return 0;
+    };
+    let written = events.len().min(capacity as usize);
+    // SAFETY: Caller guarantees `out_events` holds `capacity` >= `written` events.
+    unsafe { std::ptr::copy_nonoverlapping(events.as_ptr(), out_events, written) };
+    written as u32
+}
+
 #[cfg(test)]
 mod tests {
     use super::*;
@@ -250,6 +285,11 @@ mod tests {
             assert_eq!(goud_ui_event_read(mgr, 0, &mut event), 1);
             assert_eq!(event, callback_events[0]);
 
+            let mut copied = vec![FfiUiEvent::default(); callback_events.len() + 1];
+            let written = goud_ui_events_copy(mgr, copied.as_mut_ptr(), copied.len() as u32);
+            assert_eq!(written, goud_ui_event_count(mgr));
+            assert_eq!(copied[..written as usize], callback_events[..]);
+
             assert_eq!(
                 goud_ui_set_event_callback(mgr, None, std::ptr::null_mut()),
                 0
@@ -257,4 +297,36 @@ mod tests {
             goud_ui_manager_destroy(mgr);
         }
     }
+
+    #[test]
+    fn test_ui_events_copy_writes_the_snapshot_in_order() {
+        let mgr = goud_ui_manager_create();
+        let key = mgr as usize;
+        let snapshot: Vec<FfiUiEvent> = (0..3)
+            .map(|i| FfiUiEvent {
+                event_kind: i,
+                node_id: u64::from(i) + 10,
+                ..FfiUiEvent::default()
+            })
+            .collect();
+        event_snapshots()
+            .lock()
+            .unwrap()
+            .insert(key, snapshot.clone());
+
+        let mut out = [FfiUiEvent::default(); 4];
+        // SAFETY: `mgr` is valid and `out` holds the capacities passed below.
+        unsafe {
+            assert_eq!(goud_ui_events_copy(mgr, out.as_mut_ptr(), 4), 3);
+            assert_eq!(out[..3], snapshot[..]);
+            assert_eq!(goud_ui_events_copy(mgr, out.as_mut_ptr(), 2), 2);
+            assert_eq!(goud_ui_events_copy(mgr, out.as_mut_ptr(), 4), 3);
+            assert_eq!(goud_ui_events_copy(mgr, std::ptr::null_mut(), 4), 0);
+            assert_eq!(
+                goud_ui_events_copy(std::ptr::null(), out.as_mut_ptr(), 4),
+                0
+            );
+            goud_ui_manager_destroy(mgr);
+        }
+    }
 }
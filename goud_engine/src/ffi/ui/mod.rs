@@ -17,6 +17,7 @@
 //!
 //! The sentinel value `u64::MAX` represents "no node" / invalid.
 
+pub mod batch;
 pub mod events;
 pub mod manager;
 pub mod node;
@@ -5,9 +5,9 @@ use crate::ui::{UiButton, UiComponent, UiImage, UiLabel, UiManager, UiSlider, Ui
 use super::{
     component_from_widget_kind, unpack_node_id, FfiUiStyle, ERR_NULL_MANAGER, ERR_NULL_PTR,
 };
-const ERR_NODE_NOT_FOUND: i32 = -3;
+pub(super) const ERR_NODE_NOT_FOUND: i32 = -3;
 const ERR_INVALID_UTF8: i32 = -4;
-const ERR_UNKNOWN_WIDGET: i32 = -5;
+pub(super) const ERR_UNKNOWN_WIDGET: i32 = -5;
 
 fn read_utf8_bytes(ptr: *const u8, len: usize) -> Result<String, i32> {
     if len == 0 {
@@ -293,7 +293,6 @@ pub unsafe extern "C" fn goud_ui_set_node_position(
         return ERR_NODE_NOT_FOUND;
     };
     node.set_position(x, y);
-    manager.mark_layout_dirty();
     0
 }
 
@@ -322,7 +321,6 @@ pub unsafe extern "C" fn goud_ui_set_node_visible(
         return ERR_NODE_NOT_FOUND;
     };
     node.set_visible(visible);
-    manager.mark_layout_dirty();
     0
 }
 
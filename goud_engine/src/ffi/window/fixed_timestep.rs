@@ -26,7 +26,7 @@ pub extern "C" fn goud_fixed_timestep_begin(context_id: GoudContextId) -> bool {
 
     WINDOW_STATES.with(|cell| {
         let mut states = cell.borrow_mut();
-        let index = context_id.index() as usize;
+        let index = context_id.slot() as usize;
         if let Some(Some(state)) = states.get_mut(index) {
             if state.fixed_timestep <= 0.0 {
                 return false;
@@ -57,7 +57,7 @@ pub extern "C" fn goud_fixed_timestep_step(context_id: GoudContextId) -> bool {
 
     WINDOW_STATES.with(|cell| {
         let mut states = cell.borrow_mut();
-        let index = context_id.index() as usize;
+        let index = context_id.slot() as usize;
         if let Some(Some(state)) = states.get_mut(index) {
             if state.fixed_timestep <= 0.0 {
                 return false;
@@ -92,7 +92,7 @@ pub extern "C" fn goud_fixed_timestep_alpha(context_id: GoudContextId) -> f32 {
 
     WINDOW_STATES.with(|cell| {
         let states = cell.borrow();
-        let index = context_id.index() as usize;
+        let index = context_id.slot() as usize;
         states
             .get(index)
             .and_then(|opt| opt.as_ref())
@@ -113,7 +113,7 @@ pub extern "C" fn goud_fixed_timestep_dt(context_id: GoudContextId) -> f32 {
 
     WINDOW_STATES.with(|cell| {
         let states = cell.borrow();
-        let index = context_id.index() as usize;
+        let index = context_id.slot() as usize;
         states
             .get(index)
             .and_then(|opt| opt.as_ref())
@@ -134,7 +134,7 @@ pub extern "C" fn goud_fixed_timestep_set(context_id: GoudContextId, step: f32)
 
     WINDOW_STATES.with(|cell| {
         let mut states = cell.borrow_mut();
-        let index = context_id.index() as usize;
+        let index = context_id.slot() as usize;
         if let Some(Some(state)) = states.get_mut(index) {
             state.fixed_timestep = step.max(0.0);
             true
@@ -154,7 +154,7 @@ pub extern "C" fn goud_fixed_timestep_set_max_steps(context_id: GoudContextId, m
 
     WINDOW_STATES.with(|cell| {
         let mut states = cell.borrow_mut();
-        let index = context_id.index() as usize;
+        let index = context_id.slot() as usize;
         if let Some(Some(state)) = states.get_mut(index) {
             state.max_fixed_steps = max.max(1);
             true
@@ -154,6 +154,10 @@ pub extern "C" fn goud_window_destroy(context_id: GoudContextId) -> bool {
 
     crate::ffi::renderer::cleanup_text_state(context_id);
     crate::ffi::renderer::cleanup_atlas_state(context_id);
+    crate::ffi::renderer::cleanup_static_layer_state(context_id);
+    crate::ffi::renderer::cleanup_particle_state(context_id);
+    crate::ffi::renderer::cleanup_texture_streaming_state(context_id);
+    crate::ffi::debug::cleanup_metrics_state(context_id);
 
     remove_window_state(context_id);
 
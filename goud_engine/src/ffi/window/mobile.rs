@@ -22,7 +22,7 @@ pub extern "C" fn goud_get_scale_factor(context_id: GoudContextId) -> f32 {
 
     WINDOW_STATES.with(|cell| {
         let states = cell.borrow();
-        let index = context_id.index() as usize;
+        let index = context_id.slot() as usize;
         states
             .get(index)
             .and_then(|opt| opt.as_ref())
@@ -73,7 +73,7 @@ pub unsafe extern "C" fn goud_get_safe_area_insets(
 
     WINDOW_STATES.with(|cell| {
         let states = cell.borrow();
-        let index = context_id.index() as usize;
+        let index = context_id.slot() as usize;
         if let Some(Some(state)) = states.get(index) {
             let insets = state.platform.get_safe_area_insets();
             // SAFETY: Caller guarantees all pointers are valid and writable.
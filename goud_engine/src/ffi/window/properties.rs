@@ -28,7 +28,7 @@ pub extern "C" fn goud_window_should_close(context_id: GoudContextId) -> bool {
 
     WINDOW_STATES.with(|cell| {
         let states = cell.borrow();
-        let index = context_id.index() as usize;
+        let index = context_id.slot() as usize;
         states
             .get(index)
             .and_then(|opt| opt.as_ref())
@@ -100,7 +100,7 @@ pub extern "C" fn goud_window_poll_events(context_id: GoudContextId) -> f32 {
 
     WINDOW_STATES.with(|cell| {
         let mut states = cell.borrow_mut();
-        let index = context_id.index() as usize;
+        let index = context_id.slot() as usize;
 
         match states.get_mut(index).and_then(|opt| opt.as_mut()) {
             Some(window_state) => {
@@ -134,7 +134,7 @@ pub extern "C" fn goud_window_swap_buffers(context_id: GoudContextId) {
 
     WINDOW_STATES.with(|cell| {
         let mut states = cell.borrow_mut();
-        let index = context_id.index() as usize;
+        let index = context_id.slot() as usize;
         if let Some(Some(state)) = states.get_mut(index) {
             state.swap_buffers();
         }
@@ -175,7 +175,7 @@ pub unsafe extern "C" fn goud_window_get_size(
 
     WINDOW_STATES.with(|cell| {
         let states = cell.borrow();
-        let index = context_id.index() as usize;
+        let index = context_id.slot() as usize;
         if let Some(Some(state)) = states.get(index) {
             let (w, h) = state.get_size();
             // SAFETY: Caller guarantees pointers are valid.
@@ -200,7 +200,7 @@ pub extern "C" fn goud_window_set_size(context_id: GoudContextId, width: u32, he
 
     WINDOW_STATES.with(|cell| {
         let mut states = cell.borrow_mut();
-        let index = context_id.index() as usize;
+        let index = context_id.slot() as usize;
         match states.get_mut(index).and_then(|opt| opt.as_mut()) {
             Some(state) => {
                 if state.platform.request_size(width, height) {
@@ -235,7 +235,7 @@ pub extern "C" fn goud_window_set_should_close(context_id: GoudContextId, should
 
     WINDOW_STATES.with(|cell| {
         let mut states = cell.borrow_mut();
-        let index = context_id.index() as usize;
+        let index = context_id.slot() as usize;
         if let Some(Some(state)) = states.get_mut(index) {
             state.set_should_close(should_close);
         }
@@ -260,7 +260,7 @@ pub extern "C" fn goud_window_get_delta_time(context_id: GoudContextId) -> f32 {
 
     WINDOW_STATES.with(|cell| {
         let states = cell.borrow();
-        let index = context_id.index() as usize;
+        let index = context_id.slot() as usize;
         states
             .get(index)
             .and_then(|opt| opt.as_ref())
@@ -293,7 +293,7 @@ pub unsafe extern "C" fn goud_window_get_framebuffer_size(
 
     WINDOW_STATES.with(|cell| {
         let states = cell.borrow();
-        let index = context_id.index() as usize;
+        let index = context_id.slot() as usize;
         if let Some(Some(state)) = states.get(index) {
             let (w, h) = state.get_framebuffer_size();
             // SAFETY: Caller guarantees pointers are valid.
@@ -335,7 +335,7 @@ pub extern "C" fn goud_window_set_fullscreen(context_id: GoudContextId, mode: u3
 
     WINDOW_STATES.with(|cell| {
         let mut states = cell.borrow_mut();
-        let index = context_id.index() as usize;
+        let index = context_id.slot() as usize;
         match states.get_mut(index).and_then(|opt| opt.as_mut()) {
             Some(state) => {
                 if state.platform.set_fullscreen(fullscreen_mode) {
@@ -369,7 +369,7 @@ pub extern "C" fn goud_window_get_fullscreen(context_id: GoudContextId) -> u32 {
 
     WINDOW_STATES.with(|cell| {
         let states = cell.borrow();
-        let index = context_id.index() as usize;
+        let index = context_id.slot() as usize;
         states
             .get(index)
             .and_then(|opt| opt.as_ref())
@@ -392,7 +392,7 @@ pub extern "C" fn goud_window_toggle_fullscreen(context_id: GoudContextId) -> i3
 
     WINDOW_STATES.with(|cell| {
         let mut states = cell.borrow_mut();
-        let index = context_id.index() as usize;
+        let index = context_id.slot() as usize;
         match states.get_mut(index).and_then(|opt| opt.as_mut()) {
             Some(state) => {
                 let current = state.platform.get_fullscreen();
@@ -485,7 +485,7 @@ pub extern "C" fn goud_window_clear(context_id: GoudContextId, r: f32, g: f32, b
 
     WINDOW_STATES.with(|cell| {
         let mut states = cell.borrow_mut();
-        let index = context_id.index() as usize;
+        let index = context_id.slot() as usize;
         if let Some(Some(state)) = states.get_mut(index) {
             state.backend.set_clear_color(r, g, b, a);
             state.backend.clear_color();
@@ -312,7 +312,7 @@ pub fn set_window_state(
 ) -> Result<(), GoudError> {
     WINDOW_STATES.with(|cell| {
         let mut states = cell.borrow_mut();
-        let index = context_id.index() as usize;
+        let index = context_id.slot() as usize;
 
         while states.len() <= index {
             states.push(None);
@@ -342,7 +342,7 @@ pub fn set_window_state(
 pub fn remove_window_state(context_id: GoudContextId) {
     WINDOW_STATES.with(|cell| {
         let mut states = cell.borrow_mut();
-        let index = context_id.index() as usize;
+        let index = context_id.slot() as usize;
         if index < states.len() {
             if let Some(previous) = states[index].take() {
                 if let Some(route_id) = previous.debugger_route.as_ref() {
@@ -364,7 +364,7 @@ where
 {
     WINDOW_STATES.with(|cell| {
         let mut states = cell.borrow_mut();
-        let index = context_id.index() as usize;
+        let index = context_id.slot() as usize;
         let state = states.get_mut(index).and_then(|opt| opt.as_mut())?;
         let route_id = state.debugger_route.clone();
         Some(debugger::scoped_route(route_id, || f(state)))
@@ -0,0 +1,303 @@
+//! # World Snapshot FFI
+//!
+//! Binary save/restore of a context's entities and components for rollback
+//! netcode. A snapshot holds the context's ECS world (see
+//! [`World::save_snapshot`](crate::ecs::World::save_snapshot)) and packed
+//! copies of its `goud_component_*` storages, all engine-side behind an
+//! `i64` handle; nothing crosses the FFI boundary or goes through JSON.
+//!
+//! Typed ECS storages are copy-on-write: one untouched since the previous
+//! save or restore is shared rather than copied, so a ring of per-frame
+//! snapshots pays only for what changed. Raw component bytes can be written
+//! through `goud_component_get_mut` pointers at any time, so they are always
+//! copied, as one packed memcpy per component type.
+//!
+//! Physics is saved separately with `goud_physics_save_state`; resources,
+//! renderer, audio and window state are not captured.
+
+use std::collections::HashMap;
+use std::sync::Mutex;
+
+use crate::component_ops::RawComponentSnapshot;
+use crate::core::error::{set_last_error, GoudError, ERR_INTERNAL_ERROR};
+use crate::ecs::WorldSnapshot;
+use crate::ffi::context::{get_context_registry, GoudContextId};
+
+/// Error sentinel for handle-returning functions.
+const INVALID_HANDLE: i64 = -1;
+
+/// Counts describing one world snapshot.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default)]
+pub struct FfiWorldSnapshotStats {
+    /// Entities alive when the snapshot was saved.
+    pub entity_count: u32,
+    /// Typed ECS component storages saved.
+    pub column_count: u32,
+    /// Typed storages shared with an earlier snapshot instead of copied.
+    pub shared_column_count: u32,
+    /// Raw (`goud_component_*`) component storages saved.
+    pub raw_column_count: u32,
+    /// Bytes of raw component data held.
+    pub raw_bytes: u64,
+}
+
+/// Everything saved for one context.
+#[derive(Default)]
+struct ContextSnapshot {
+    world: WorldSnapshot,
+    components: RawComponentSnapshot,
+    sdk_components: RawComponentSnapshot,
+}
+
+struct SnapshotRegistry {
+    snapshots: HashMap<i64, ContextSnapshot>,
+    next_handle: i64,
+}
+
+static SNAPSHOTS: Mutex<Option<SnapshotRegistry>> = Mutex::new(None);
+
+fn report(err: GoudError) -> i32 {
+    let code = err.error_code();
+    set_last_error(err);
+    code
+}
+
+fn with_snapshots<R>(f: impl FnOnce(&mut SnapshotRegistry) -> R) -> Result<R, i32> {
+    let mut guard = SNAPSHOTS.lock().map_err(|_| {
+        report(GoudError::InternalError(
+            "Failed to lock world snapshot registry".to_string(),
+        ))
+    })?;
+    Ok(f(guard.get_or_insert_with(|| SnapshotRegistry {
+        snapshots: HashMap::new(),
+        next_handle: 1,
+    })))
+}
+
+fn unknown_snapshot(handle: i64) -> i32 {
+    report(GoudError::InvalidState(format!(
+        "Unknown world snapshot handle {handle}"
+    )))
+}
+
+/// Saves `context_id`'s world and raw components into `snapshot`.
+///
+/// Leaves `snapshot` untouched when the world cannot be saved.
+fn save_into(context_id: GoudContextId, snapshot: &mut ContextSnapshot) -> Result<(), i32> {
+    {
+        let mut registry = get_context_registry().lock().map_err(|_| {
+            report(GoudError::InternalError(
+                "Failed to lock context registry".to_string(),
+            ))
+        })?;
+        let context = registry
+            .get_mut(context_id)
+            .ok_or_else(|| report(GoudError::InvalidContext))?;
+        let world = context.world_mut();
+        world.register_builtin_cloneables();
+        if !world.save_snapshot_into(&mut snapshot.world) {
+            return Err(report(GoudError::InvalidState(
+                "world holds components that are not registered as cloneable".to_string(),
+            )));
+        }
+    }
+
+    if !crate::ffi::component::save_context_components(context_id, &mut snapshot.components) {
+        return Err(ERR_INTERNAL_ERROR);
+    }
+    crate::component_ops::save_context_components(
+        crate::component_ops::context_key(context_id),
+        &mut snapshot.sdk_components,
+    );
+    Ok(())
+}
+
+/// Saves a context's entities and components into a new snapshot.
+///
+/// Every typed ECS component in the world must be of a cloneable type; the
+/// built-in engine components are registered automatically.
+///
+/// # Returns
+///
+/// A positive snapshot handle, or -1 on failure. Free it with
+/// `goud_world_snapshot_destroy`.
+#[no_mangle]
+pub extern "C" fn goud_world_snapshot_save(context_id: GoudContextId) -> i64 {
+    let mut snapshot = ContextSnapshot::default();
+    if save_into(context_id, &mut snapshot).is_err() {
+        return INVALID_HANDLE;
+    }
+    with_snapshots(|registry| {
+        let handle = registry.next_handle;
+        registry.next_handle += 1;
+        registry.snapshots.insert(handle, snapshot);
+        handle
+    })
+    .unwrap_or(INVALID_HANDLE)
+}
+
+/// Overwrites an existing snapshot with the context's current state.
+///
+/// This is the per-frame call for a rollback ring buffer: the snapshot's
+/// buffers are reused, and typed storages that have not changed since the
+/// last save or restore are shared instead of copied.
+///
+/// # Returns
+///
+/// 0 on success, negative error code on failure. On failure the snapshot
+/// keeps its previous contents.
+#[no_mangle]
+pub extern "C" fn goud_world_snapshot_save_into(context_id: GoudContextId, handle: i64) -> i32 {
+    // Take the snapshot out so the registry lock is not held while the
+    // context and component locks are.
+    let mut snapshot = match with_snapshots(|registry| registry.snapshots.remove(&handle)) {
+        Ok(Some(snapshot)) => snapshot,
+        Ok(None) => return unknown_snapshot(handle),
+        Err(code) => return code,
+    };
+    let result = save_into(context_id, &mut snapshot);
+    if let Err(code) = with_snapshots(|registry| registry.snapshots.insert(handle, snapshot)) {
+        return code;
+    }
+    match result {
+        Ok(()) => 0,
+        Err(code) => code,
+    }
+}
+
+/// Rolls a context's entities and components back to a snapshot.
+///
+/// Entities spawned since the save are gone and despawned ones are alive
+/// again with their old IDs. Raw component pointers obtained earlier stay
+/// valid for component types whose set of entities did not change.
+///
+/// Every part of the snapshot is checked against the context before any of
+/// it is applied, so a restore that fails leaves the context as it was.
+///
+/// # Returns
+///
+/// 0 on success, negative error code on failure.
+#[no_mangle]
+pub extern "C" fn goud_world_snapshot_restore(context_id: GoudContextId, handle: i64) -> i32 {
+    let guard = match SNAPSHOTS.lock() {
+        Ok(guard) => guard,
+        Err(_) => {
+            return report(GoudError::InternalError(
+                "Failed to lock world snapshot registry".to_string(),
+            ))
+        }
+    };
+    let Some(snapshot) = guard.as_ref().and_then(|r| r.snapshots.get(&handle)) else {
+        drop(guard);
+        return unknown_snapshot(handle);
+    };
+
+    // Check the component storages before the world is touched; the world
+    // checks its own storages before changing anything. The registry and
+    // storage locks are never nested (lock order: registry -> storage).
+    let sdk_key = crate::component_ops::context_key(context_id);
+    let components_match =
+        crate::ffi::component::can_restore_context_components(context_id, &snapshot.components)
+            && crate::component_ops::can_restore_context_components(
+                sdk_key,
+                &snapshot.sdk_components,
+            );
+    if !components_match {
+        return report(GoudError::InvalidState(
+            "component layouts changed since the snapshot was saved".to_string(),
+        ));
+    }
+
+    {
+        let mut registry = match get_context_registry().lock() {
+            Ok(registry) => registry,
+            Err(_) => {
+                return report(GoudError::InternalError(
+                    "Failed to lock context registry".to_string(),
+                ))
+            }
+        };
+        let Some(context) = registry.get_mut(context_id) else {
+            return report(GoudError::InvalidContext);
+        };
+        if !context.world_mut().restore_snapshot(&snapshot.world) {
+            return report(GoudError::InvalidState(
+                "snapshot does not match this context's world".to_string(),
+            ));
+        }
+    }
+
+    // Both layouts were checked above, so these only fail if an allocation
+    // fails while a storage is rebuilt.
+    let components_restored =
+        crate::ffi::component::restore_context_components(context_id, &snapshot.components)
+            && crate::component_ops::restore_context_components(sdk_key, &snapshot.sdk_components);
+    if !components_restored {
+        return report(GoudError::InternalError(
+            "failed to rebuild component storage from the snapshot".to_string(),
+        ));
+    }
+    0
+}
+
+/// Frees a world snapshot.
+///
+/// # Returns
+///
+/// 0 on success, negative error code if the handle is unknown.
+#[no_mangle]
+pub extern "C" fn goud_world_snapshot_destroy(handle: i64) -> i32 {
+    match with_snapshots(|registry| registry.snapshots.remove(&handle).is_some()) {
+        Ok(true) => 0,
+        Ok(false) => unknown_snapshot(handle),
+        Err(code) => code,
+    }
+}
+
+/// Writes the counts describing a snapshot into `out_stats`.
+///
+/// # Returns
+///
+/// 0 on success, negative error code on failure.
+///
+/// # Safety
+///
+/// `out_stats` must point to writable storage for one `FfiWorldSnapshotStats`.
+#[no_mangle]
+pub unsafe extern "C" fn goud_world_snapshot_get_stats(
+    handle: i64,
+    out_stats: *mut FfiWorldSnapshotStats,
+) -> i32 {
+    if out_stats.is_null() {
+        return report(GoudError::InvalidState(
+            "out_stats pointer is null".to_string(),
+        ));
+    }
+    let stats = with_snapshots(|registry| {
+        registry
+            .snapshots
+            .get(&handle)
+            .map(|s| FfiWorldSnapshotStats {
+                entity_count: s.world.entity_count() as u32,
+                column_count: s.world.column_count() as u32,
+                shared_column_count: s.world.shared_column_count() as u32,
+                raw_column_count: (s.components.columns.len() + s.sdk_components.columns.len())
+                    as u32,
+                raw_bytes: (s.components.byte_len() + s.sdk_components.byte_len()) as u64,
+            })
+    });
+    match stats {
+        Ok(Some(stats)) => {
+            // SAFETY: out_stats is non-null and the caller guarantees it is writable.
+            *out_stats = stats;
+            0
+        }
+        Ok(None) => unknown_snapshot(handle),
+        Err(code) => code,
+    }
+}
+
+#[cfg(test)]
+#[path = "world_snapshot_tests.rs"]
+mod tests;
@@ -0,0 +1,165 @@
+use super::*;
+use crate::core::math::Vec2;
+use crate::ecs::components::Transform2D;
+use crate::ecs::Entity;
+use crate::ffi::component::{goud_component_add, goud_component_get, goud_component_register_type};
+use crate::ffi::context::{goud_context_create, goud_context_destroy};
+use crate::ffi::entity::{goud_entity_despawn, goud_entity_is_alive, goud_entity_spawn_empty};
+
+const HEALTH_TYPE_ID: u64 = 0x5a5a_0040_0000_0001;
+
+fn register_health() {
+    let name = b"SnapshotHealth";
+    // SAFETY: `name` is valid for its length; u32 size and align are given.
+    unsafe { goud_component_register_type(HEALTH_TYPE_ID, name.as_ptr(), name.len(), 4, 4) };
+}
+
+fn set_health(ctx: GoudContextId, entity: u64, value: u32) {
+    let bytes = value.to_ne_bytes();
+    // SAFETY: `bytes` holds the 4 bytes of a registered u32 component.
+    let result =
+        unsafe { goud_component_add(ctx, entity.into(), HEALTH_TYPE_ID, bytes.as_ptr(), 4) };
+    assert!(result.is_ok());
+}
+
+fn health(ctx: GoudContextId, entity: u64) -> Option<u32> {
+    let ptr = goud_component_get(ctx, entity.into(), HEALTH_TYPE_ID);
+    // SAFETY: non-null pointers reference 4 initialized bytes.
+    (!ptr.is_null()).then(|| unsafe { (ptr as *const u32).read_unaligned() })
+}
+
+fn set_x(ctx: GoudContextId, entity: u64, x: f32) {
+    let mut registry = get_context_registry().lock().unwrap();
+    registry.get_mut(ctx).unwrap().world_mut().insert(
+        Entity::from_bits(entity),
+        Transform2D::new(Vec2::new(x, 0.0), 0.0, Vec2::one()),
+    );
+}
+
+fn x(ctx: GoudContextId, entity: u64) -> Option<f32> {
+    let registry = get_context_registry().lock().unwrap();
+    let world = registry.get(ctx).unwrap().world();
+    world
+        .get::<Transform2D>(Entity::from_bits(entity))
+        .map(|t| t.position.x)
+}
+
+fn stats(handle: i64) -> FfiWorldSnapshotStats {
+    let mut stats = FfiWorldSnapshotStats::default();
+    // SAFETY: `stats` is a live stack value.
+    assert_eq!(
+        unsafe { goud_world_snapshot_get_stats(handle, &mut stats) },
+        0
+    );
+    stats
+}
+
+#[test]
+fn restore_rewinds_world_and_raw_components() {
+    register_health();
+    let ctx = goud_context_create();
+    let kept = goud_entity_spawn_empty(ctx);
+    let doomed = goud_entity_spawn_empty(ctx);
+    set_x(ctx, kept, 1.0);
+    set_health(ctx, kept, 100);
+    set_health(ctx, doomed, 50);
+
+    let handle = goud_world_snapshot_save(ctx);
+    assert!(handle > 0);
+    let saved = stats(handle);
+    assert_eq!(saved.entity_count, 2);
+    assert_eq!(saved.raw_bytes, 8);
+
+    set_x(ctx, kept, 9.0);
+    set_health(ctx, kept, 1);
+    assert!(goud_entity_despawn(ctx, doomed).is_ok());
+    let spawned = goud_entity_spawn_empty(ctx);
+    set_health(ctx, spawned, 7);
+
+    assert_eq!(goud_world_snapshot_restore(ctx, handle), 0);
+    assert_eq!(x(ctx, kept), Some(1.0));
+    assert_eq!(health(ctx, kept), Some(100));
+    assert!(goud_entity_is_alive(ctx, doomed));
+    assert_eq!(health(ctx, doomed), Some(50));
+    assert!(!goud_entity_is_alive(ctx, spawned));
+    assert_eq!(health(ctx, spawned), None);
+
+    assert_eq!(goud_world_snapshot_destroy(handle), 0);
+    goud_context_destroy(ctx);
+}
+
+#[test]
+fn failed_restore_leaves_the_context_untouched() {
+    register_health();
+    let ctx = goud_context_create();
+    let entity = goud_entity_spawn_empty(ctx);
+    set_x(ctx, entity, 1.0);
+    set_health(ctx, entity, 100);
+    let handle = goud_world_snapshot_save(ctx);
+    assert!(handle > 0);
+
+    // A raw column whose layout no longer matches its storage fails the
+    // restore after the world's own checks would have passed.
+    with_snapshots(|registry| {
+        let snapshot = registry.snapshots.get_mut(&handle).unwrap();
+        snapshot.components.columns[0].component_size = 8;
+    })
+    .unwrap();
+    set_x(ctx, entity, 9.0);
+    set_health(ctx, entity, 1);
+    let spawned = goud_entity_spawn_empty(ctx);
+
+    assert_ne!(goud_world_snapshot_restore(ctx, handle), 0);
+    assert_eq!(x(ctx, entity), Some(9.0));
+    assert_eq!(health(ctx, entity), Some(1));
+    assert!(goud_entity_is_alive(ctx, spawned));
+
+    assert_eq!(goud_world_snapshot_destroy(handle), 0);
+    goud_context_destroy(ctx);
+}
+
+#[test]
+fn save_into_shares_unchanged_storages() {
+    let ctx = goud_context_create();
+    let entity = goud_entity_spawn_empty(ctx);
+    set_x(ctx, entity, 3.0);
+
+    let first = goud_world_snapshot_save(ctx);
+    let second = goud_world_snapshot_save(ctx);
+    assert!(first > 0 && second > 0);
+    assert_eq!(
+        stats(second).shared_column_count,
+        stats(second).column_count
+    );
+
+    set_x(ctx, entity, 4.0);
+    assert_eq!(goud_world_snapshot_save_into(ctx, second), 0);
+    let refreshed = stats(second);
+    assert_eq!(refreshed.shared_column_count + 1, refreshed.column_count);
+
+    assert_eq!(goud_world_snapshot_restore(ctx, first), 0);
+    assert_eq!(x(ctx, entity), Some(3.0));
+
+    assert_eq!(goud_world_snapshot_destroy(first), 0);
+    assert_eq!(goud_world_snapshot_destroy(second), 0);
+    goud_context_destroy(ctx);
+}
+
+#[test]
+fn unknown_handles_and_contexts_are_rejected() {
+    let ctx = goud_context_create();
+    let handle = goud_world_snapshot_save(ctx);
+    assert!(handle > 0);
+    assert_eq!(goud_world_snapshot_destroy(handle), 0);
+
+    assert_ne!(goud_world_snapshot_destroy(handle), 0);
+    assert_ne!(goud_world_snapshot_restore(ctx, handle), 0);
+    assert_ne!(goud_world_snapshot_save_into(ctx, handle), 0);
+    // SAFETY: a null output pointer is rejected before use.
+    assert_ne!(
+        unsafe { goud_world_snapshot_get_stats(handle, std::ptr::null_mut()) },
+        0
+    );
+    goud_context_destroy(ctx);
+    assert_eq!(goud_world_snapshot_save(ctx), INVALID_HANDLE);
+}
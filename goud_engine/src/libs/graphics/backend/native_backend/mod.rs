@@ -12,10 +12,10 @@ use std::sync::{Arc, Mutex, MutexGuard};
 use crate::libs::error::GoudResult;
 
 use super::capabilities::BackendInfo;
+use super::null::NullBackend;
 #[cfg(feature = "legacy-glfw-opengl")]
 use super::opengl::OpenGLBackend;
 use super::render_backend::RenderBackend;
-#[cfg(feature = "legacy-glfw-opengl")]
 use super::render_backend::StateOps;
 #[cfg(any(
     all(feature = "native", feature = "wgpu-backend"),
@@ -38,6 +38,8 @@ pub enum NativeRenderBackend {
     ))]
     /// Default wgpu backend used by the native runtime.
     Wgpu(Box<WgpuBackend>),
+    /// GPU-free recorder used by the headless runtime; draws are counted, not rasterized.
+    Null(Box<NullBackend>),
 }
 
 impl NativeRenderBackend {
@@ -52,6 +54,7 @@ impl NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.info(),
+            Self::Null(backend) => backend.info(),
         }
     }
 
@@ -70,6 +73,8 @@ impl NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.bind_texture_by_index(index, unit),
+            // The null backend keeps no texture table to index into.
+            Self::Null(_) => Ok(()),
         }
     }
 
@@ -84,10 +89,11 @@ impl NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.resize(width, height),
+            Self::Null(backend) => backend.set_viewport(0, 0, width, height),
         }
     }
 
-    /// Drops the GPU surface for mobile suspend. No-op on OpenGL.
+    /// Drops the GPU surface for mobile suspend. No-op on OpenGL and null.
     pub(crate) fn drop_surface(&mut self) {
         match self {
             #[cfg(feature = "legacy-glfw-opengl")]
@@ -99,10 +105,11 @@ impl NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.drop_surface(),
+            Self::Null(_) => {}
         }
     }
 
-    /// Recreates the GPU surface after mobile resume. No-op on OpenGL.
+    /// Recreates the GPU surface after mobile resume. No-op on OpenGL and null.
     pub(crate) fn recreate_surface(&mut self) -> GoudResult<()> {
         match self {
             #[cfg(feature = "legacy-glfw-opengl")]
@@ -114,6 +121,7 @@ impl NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.recreate_surface(),
+            Self::Null(_) => Ok(()),
         }
     }
 }
@@ -16,6 +16,7 @@ impl DrawOps for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.set_vertex_attributes(layout),
+            Self::Null(backend) => backend.set_vertex_attributes(layout),
         }
     }
 
@@ -30,6 +31,7 @@ impl DrawOps for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.set_vertex_bindings(bindings),
+            Self::Null(backend) => backend.set_vertex_bindings(bindings),
         }
     }
 
@@ -49,6 +51,7 @@ impl DrawOps for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.draw_arrays(topology, first, count),
+            Self::Null(backend) => backend.draw_arrays(topology, first, count),
         }
     }
 
@@ -68,6 +71,7 @@ impl DrawOps for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.draw_indexed(topology, count, offset),
+            Self::Null(backend) => backend.draw_indexed(topology, count, offset),
         }
     }
 
@@ -87,6 +91,7 @@ impl DrawOps for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.draw_indexed_u16(topology, count, offset),
+            Self::Null(backend) => backend.draw_indexed_u16(topology, count, offset),
         }
     }
 
@@ -111,6 +116,9 @@ impl DrawOps for NativeRenderBackend {
             Self::Wgpu(backend) => {
                 backend.draw_arrays_instanced(topology, first, count, instance_count)
             }
+            Self::Null(backend) => {
+                backend.draw_arrays_instanced(topology, first, count, instance_count)
+            }
         }
     }
 
@@ -135,6 +143,9 @@ impl DrawOps for NativeRenderBackend {
             Self::Wgpu(backend) => {
                 backend.draw_indexed_instanced(topology, count, offset, instance_count)
             }
+            Self::Null(backend) => {
+                backend.draw_indexed_instanced(topology, count, offset, instance_count)
+            }
         }
     }
 }
@@ -19,6 +19,7 @@ impl RenderBackend for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.bind_default_vertex_array(),
+            Self::Null(backend) => backend.bind_default_vertex_array(),
         }
     }
 
@@ -33,6 +34,7 @@ impl RenderBackend for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.validate_text_draw_state(),
+            Self::Null(backend) => backend.validate_text_draw_state(),
         }
     }
 
@@ -51,6 +53,7 @@ impl RenderBackend for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.read_default_framebuffer_rgba8(width, height),
+            Self::Null(backend) => backend.read_default_framebuffer_rgba8(width, height),
         }
     }
 
@@ -65,6 +68,7 @@ impl RenderBackend for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.ensure_shadow_resources(size),
+            Self::Null(backend) => backend.ensure_shadow_resources(size),
         }
     }
 
@@ -79,6 +83,7 @@ impl RenderBackend for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.begin_shadow_recording(),
+            Self::Null(backend) => backend.begin_shadow_recording(),
         }
     }
 
@@ -93,6 +98,7 @@ impl RenderBackend for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.end_shadow_recording(),
+            Self::Null(backend) => backend.end_shadow_recording(),
         }
     }
 
@@ -107,6 +113,7 @@ impl RenderBackend for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.request_readback(),
+            Self::Null(backend) => backend.request_readback(),
         }
     }
 }
@@ -123,6 +130,7 @@ impl FrameOps for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.begin_frame(),
+            Self::Null(backend) => backend.begin_frame(),
         }
     }
 
@@ -137,6 +145,7 @@ impl FrameOps for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.end_frame(),
+            Self::Null(backend) => backend.end_frame(),
         }
     }
 }
@@ -153,6 +162,7 @@ impl ClearOps for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.set_clear_color(r, g, b, a),
+            Self::Null(backend) => backend.set_clear_color(r, g, b, a),
         }
     }
 
@@ -167,6 +177,7 @@ impl ClearOps for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.clear_color(),
+            Self::Null(backend) => backend.clear_color(),
         }
     }
 
@@ -181,6 +192,7 @@ impl ClearOps for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.clear_depth(),
+            Self::Null(backend) => backend.clear_depth(),
         }
     }
 }
@@ -197,6 +209,7 @@ impl StateOps for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.set_viewport(x, y, width, height),
+            Self::Null(backend) => backend.set_viewport(x, y, width, height),
         }
     }
 
@@ -211,6 +224,7 @@ impl StateOps for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.enable_depth_test(),
+            Self::Null(backend) => backend.enable_depth_test(),
         }
     }
 
@@ -225,6 +239,7 @@ impl StateOps for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.disable_depth_test(),
+            Self::Null(backend) => backend.disable_depth_test(),
         }
     }
 
@@ -239,6 +254,7 @@ impl StateOps for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.enable_blending(),
+            Self::Null(backend) => backend.enable_blending(),
         }
     }
 
@@ -253,6 +269,7 @@ impl StateOps for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.disable_blending(),
+            Self::Null(backend) => backend.disable_blending(),
         }
     }
 
@@ -271,6 +288,7 @@ impl StateOps for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.set_blend_func(src, dst),
+            Self::Null(backend) => backend.set_blend_func(src, dst),
         }
     }
 
@@ -285,6 +303,7 @@ impl StateOps for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.enable_culling(),
+            Self::Null(backend) => backend.enable_culling(),
         }
     }
 
@@ -299,6 +318,7 @@ impl StateOps for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.disable_culling(),
+            Self::Null(backend) => backend.disable_culling(),
         }
     }
 
@@ -313,6 +333,7 @@ impl StateOps for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.set_cull_face(face),
+            Self::Null(backend) => backend.set_cull_face(face),
         }
     }
 
@@ -327,6 +348,7 @@ impl StateOps for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.set_depth_func(func),
+            Self::Null(backend) => backend.set_depth_func(func),
         }
     }
 
@@ -341,6 +363,7 @@ impl StateOps for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.set_front_face(face),
+            Self::Null(backend) => backend.set_front_face(face),
         }
     }
 
@@ -355,6 +378,7 @@ impl StateOps for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.set_depth_mask(enabled),
+            Self::Null(backend) => backend.set_depth_mask(enabled),
         }
     }
 
@@ -369,6 +393,7 @@ impl StateOps for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.set_multisampling_enabled(enabled),
+            Self::Null(backend) => backend.set_multisampling_enabled(enabled),
         }
     }
 
@@ -383,6 +408,7 @@ impl StateOps for NativeRenderBackend {
                 feature = "switch-vulkan"
             ))]
             Self::Wgpu(backend) => backend.set_line_width(width),
+            Self::Null(backend) => backend.set_line_width(width),
         }
     }
 }
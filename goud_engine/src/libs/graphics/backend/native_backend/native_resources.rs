@@ -17,6 +17,7 @@ macro_rules! dispatch {
             Self::OpenGlLegacy(b) => b.$method($($arg),*),
             #[cfg(any(all(feature = "native", feature = "wgpu-backend"), feature = "xbox-gdk", feature = "sdl-window", feature = "switch-vulkan"))]
             Self::Wgpu(b) => b.$method($($arg),*),
+            Self::Null(b) => b.$method($($arg),*),
         }
     };
 }
@@ -120,6 +121,25 @@ impl TextureOps for NativeRenderBackend {
         dispatch!(self, update_texture, handle, x, y, width, height, data)
     }
 
+    fn resize_texture_storage(
+        &mut self,
+        handle: TextureHandle,
+        width: u32,
+        height: u32,
+        data: &[u8],
+    ) -> GoudResult<()> {
+        dispatch!(self, resize_texture_storage, handle, width, height, data)
+    }
+
+    fn set_texture_logical_size(
+        &mut self,
+        handle: TextureHandle,
+        width: u32,
+        height: u32,
+    ) -> GoudResult<()> {
+        dispatch!(self, set_texture_logical_size, handle, width, height)
+    }
+
     fn destroy_texture(&mut self, handle: TextureHandle) -> bool {
         dispatch!(self, destroy_texture, handle)
     }
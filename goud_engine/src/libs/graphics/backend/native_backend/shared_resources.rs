@@ -101,6 +101,26 @@ impl TextureOps for SharedNativeRenderBackend {
             .update_texture(handle, x, y, width, height, data)
     }
 
+    fn resize_texture_storage(
+        &mut self,
+        handle: TextureHandle,
+        width: u32,
+        height: u32,
+        data: &[u8],
+    ) -> GoudResult<()> {
+        self.lock()
+            .resize_texture_storage(handle, width, height, data)
+    }
+
+    fn set_texture_logical_size(
+        &mut self,
+        handle: TextureHandle,
+        width: u32,
+        height: u32,
+    ) -> GoudResult<()> {
+        self.lock().set_texture_logical_size(handle, width, height)
+    }
+
     fn destroy_texture(&mut self, handle: TextureHandle) -> bool {
         self.lock().destroy_texture(handle)
     }
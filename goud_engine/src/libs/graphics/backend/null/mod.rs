@@ -3,6 +3,7 @@
 mod backend;
 #[cfg(test)]
 mod tests;
+mod texture_ops;
 mod trait_impl;
 
 pub use backend::NullBackend;
@@ -0,0 +1,114 @@
+//! `TextureOps` implementation for `NullBackend`.
+
+use crate::libs::error::{GoudError, GoudResult};
+use crate::libs::graphics::backend::render_backend::TextureOps;
+use crate::libs::graphics::backend::types::{
+    TextureFilter, TextureFormat, TextureHandle, TextureWrap,
+};
+
+use super::backend::NullTextureMeta;
+use super::NullBackend;
+
+impl TextureOps for NullBackend {
+    fn create_texture(
+        &mut self,
+        width: u32,
+        height: u32,
+        _format: TextureFormat,
+        _filter: TextureFilter,
+        _wrap: TextureWrap,
+        _data: &[u8],
+    ) -> GoudResult<TextureHandle> {
+        let handle = self.texture_allocator.allocate();
+        self.textures
+            .insert(handle, NullTextureMeta { width, height });
+        Ok(handle)
+    }
+
+    fn update_texture(
+        &mut self,
+        handle: TextureHandle,
+        _x: u32,
+        _y: u32,
+        _width: u32,
+        _height: u32,
+        _data: &[u8],
+    ) -> GoudResult<()> {
+        if self.texture_allocator.is_alive(handle) {
+            Ok(())
+        } else {
+            Err(GoudError::InvalidHandle)
+        }
+    }
+
+    fn resize_texture_storage(
+        &mut self,
+        handle: TextureHandle,
+        width: u32,
+        height: u32,
+        _data: &[u8],
+    ) -> GoudResult<()> {
+        if width > 0 && height > 0 && self.texture_allocator.is_alive(handle) {
+            Ok(())
+        } else {
+            Err(GoudError::InvalidHandle)
+        }
+    }
+
+    fn set_texture_logical_size(
+        &mut self,
+        handle: TextureHandle,
+        width: u32,
+        height: u32,
+    ) -> GoudResult<()> {
+        let meta = self
+            .textures
+            .get_mut(&handle)
+            .ok_or(GoudError::InvalidHandle)?;
+        (meta.width, meta.height) = (width, height);
+        Ok(())
+    }
+
+    fn destroy_texture(&mut self, handle: TextureHandle) -> bool {
+        if self.texture_allocator.deallocate(handle) {
+            self.textures.remove(&handle);
+            true
+        } else {
+            false
+        }
+    }
+
+    fn is_texture_valid(&self, handle: TextureHandle) -> bool {
+        self.texture_allocator.is_alive(handle)
+    }
+
+    fn texture_size(&self, handle: TextureHandle) -> Option<(u32, u32)> {
+        self.textures.get(&handle).map(|m| (m.width, m.height))
+    }
+
+    fn bind_texture(&mut self, handle: TextureHandle, _unit: u32) -> GoudResult<()> {
+        if self.texture_allocator.is_alive(handle) {
+            Ok(())
+        } else {
+            Err(GoudError::InvalidHandle)
+        }
+    }
+
+    fn unbind_texture(&mut self, _unit: u32) {
+        // no-op
+    }
+
+    fn create_compressed_texture(
+        &mut self,
+        width: u32,
+        height: u32,
+        _format: TextureFormat,
+        _data: &[u8],
+        _mip_levels: u32,
+    ) -> GoudResult<TextureHandle> {
+        let handle = self.texture_allocator.allocate();
+        self.textures
+            .insert(handle, NullTextureMeta { width, height });
+        Ok(handle)
+    }
+}
@@ -9,11 +9,11 @@ use crate::libs::graphics::backend::render_backend::{
 };
 use crate::libs::graphics::backend::types::{
     BufferHandle, BufferType, BufferUsage, DepthFunc, FrontFace, PrimitiveTopology,
-    RenderTargetDesc, RenderTargetHandle, ShaderHandle, TextureFilter, TextureFormat,
-    TextureHandle, TextureWrap, VertexBufferBinding, VertexLayout,
+    RenderTargetDesc, RenderTargetHandle, ShaderHandle, TextureFilter, TextureHandle, TextureWrap,
+    VertexBufferBinding, VertexLayout,
 };
 
-use super::backend::{NullBufferMeta, NullRenderTargetMeta, NullTextureMeta};
+use super::backend::{NullBufferMeta, NullRenderTargetMeta};
 use super::NullBackend;
 
 // ========================================================================
@@ -196,86 +196,6 @@ impl BufferOps for NullBackend {
     }
 }
 
-// ========================================================================
-// TextureOps
-// ========================================================================
-
-impl TextureOps for NullBackend {
-    fn create_texture(
-        &mut self,
-        width: u32,
-        height: u32,
-        _format: TextureFormat,
-        _filter: TextureFilter,
-        _wrap: TextureWrap,
-        _data: &[u8],
-    ) -> GoudResult<TextureHandle> {
-        let handle = self.texture_allocator.allocate();
-        self.textures
-            .insert(handle, NullTextureMeta { width, height });
-        Ok(handle)
-    }
-
-    fn update_texture(
-        &mut self,
-        handle: TextureHandle,
-        _x: u32,
-        _y: u32,
-        _width: u32,
-        _height: u32,
-        _data: &[u8],
-    ) -> GoudResult<()> {
-        if self.texture_allocator.is_alive(handle) {
-            Ok(())
-        } else {
-            Err(GoudError::InvalidHandle)
-        }
-    }
-
-    fn destroy_texture(&mut self, handle: TextureHandle) -> bool {
-        if self.texture_allocator.deallocate(handle) {
-            self.textures.remove(&handle);
-            true
-        } else {
-            false
-        }
-    }
-
-    fn is_texture_valid(&self, handle: TextureHandle) -> bool {
-        self.texture_allocator.is_alive(handle)
-    }
-
-    fn texture_size(&self, handle: TextureHandle) -> Option<(u32, u32)> {
-        self.textures.get(&handle).map(|m| (m.width, m.height))
-    }
-
-    fn bind_texture(&mut self, handle: TextureHandle, _unit: u32) -> GoudResult<()> {
-        if self.texture_allocator.is_alive(handle) {
-            Ok(())
-        } else {
-            Err(GoudError::InvalidHandle)
-        }
-    }
-
-    fn unbind_texture(&mut self, _unit: u32) {
-        // no-op
-    }
-
-    fn create_compressed_texture(
-        &mut self,
-        width: u32,
-        height: u32,
-        _format: TextureFormat,
-        _data: &[u8],
-        _mip_levels: u32,
-    ) -> GoudResult<TextureHandle> {
-        let handle = self.texture_allocator.allocate();
-        self.textures
-            .insert(handle, NullTextureMeta { width, height });
-        Ok(handle)
-    }
-}
-
 // ========================================================================
 // RenderTargetOps
 // ========================================================================
@@ -56,6 +56,10 @@ struct TextureMetadata {
     width: u32,
     /// Texture height in pixels
     height: u32,
+    /// Width of the uploaded image; differs from `width` once streamed
+    storage_width: u32,
+    /// Height of the uploaded image; differs from `height` once streamed
+    storage_height: u32,
     /// Pixel format
     format: super::types::TextureFormat,
     /// Filtering mode — reserved for future texture parameter queries
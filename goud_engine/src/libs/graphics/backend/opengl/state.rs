@@ -8,7 +8,7 @@ use super::{
     conversions, gl_check_debug,
 };
 use crate::libs::error::GoudResult;
-use crate::libs::graphics::backend::types::{DepthFunc, FrontFace};
+use crate::libs::graphics::backend::types::{DepthFunc, FrontFace, TextureHandle};
 
 mod readback;
 #[cfg(test)]
@@ -364,13 +364,13 @@ impl TextureOps for OpenGLBackend {
         filter: crate::libs::graphics::backend::types::TextureFilter,
         wrap: crate::libs::graphics::backend::types::TextureWrap,
         data: &[u8],
-    ) -> GoudResult<crate::libs::graphics::backend::types::TextureHandle> {
+    ) -> GoudResult<TextureHandle> {
         super::texture_ops::create_texture(self, width, height, format, filter, wrap, data)
     }
 
     fn update_texture(
         &mut self,
-        handle: crate::libs::graphics::backend::types::TextureHandle,
+        handle: TextureHandle,
         x: u32,
         y: u32,
         width: u32,
@@ -380,32 +380,38 @@ impl TextureOps for OpenGLBackend {
         super::texture_ops::update_texture(self, handle, x, y, width, height, data)
     }
 
-    fn destroy_texture(
-        &mut self,
-        handle: crate::libs::graphics::backend::types::TextureHandle,
-    ) -> bool {
+    fn destroy_texture(&mut self, handle: TextureHandle) -> bool {
         super::texture_ops::destroy_texture(self, handle)
     }
 
-    fn is_texture_valid(
-        &self,
-        handle: crate::libs::graphics::backend::types::TextureHandle,
-    ) -> bool {
+    fn is_texture_valid(&self, handle: TextureHandle) -> bool {
         super::texture_ops::is_texture_valid(self, handle)
     }
 
-    fn texture_size(
-        &self,
-        handle: crate::libs::graphics::backend::types::TextureHandle,
-    ) -> Option<(u32, u32)> {
-        super::texture_ops::texture_size(self, handle)
+    fn resize_texture_storage(
+        &mut self,
+        handle: TextureHandle,
+        width: u32,
+        height: u32,
+        data: &[u8],
+    ) -> GoudResult<()> {
+        super::texture_ops::resize_texture_storage(self, handle, width, height, data)
     }
 
-    fn bind_texture(
+    fn set_texture_logical_size(
         &mut self,
-        handle: crate::libs::graphics::backend::types::TextureHandle,
-        unit: u32,
+        handle: TextureHandle,
+        width: u32,
+        height: u32,
     ) -> GoudResult<()> {
+        super::texture_ops::set_texture_logical_size(self, handle, width, height)
+    }
+
+    fn texture_size(&self, handle: TextureHandle) -> Option<(u32, u32)> {
+        super::texture_ops::texture_size(self, handle)
+    }
+
+    fn bind_texture(&mut self, handle: TextureHandle, unit: u32) -> GoudResult<()> {
         super::texture_ops::bind_texture(self, handle, unit)
     }
 
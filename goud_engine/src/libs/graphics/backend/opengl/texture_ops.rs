@@ -96,6 +96,8 @@ pub(super) fn create_texture(
         gl_id,
         width,
         height,
+        storage_width: width,
+        storage_height: height,
         format,
         _filter: filter,
         _wrap: wrap,
@@ -128,10 +130,10 @@ pub(super) fn update_texture(
         .ok_or(GoudError::InvalidHandle)?;
 
     // Validate region bounds
-    if x + width > metadata.width || y + height > metadata.height {
+    if x + width > metadata.storage_width || y + height > metadata.storage_height {
         return Err(GoudError::TextureCreationFailed(format!(
             "Update region ({}x{} at {},{}) exceeds texture bounds ({}x{})",
-            width, height, x, y, metadata.width, metadata.height
+            width, height, x, y, metadata.storage_width, metadata.storage_height
         )));
     }
 
@@ -184,6 +186,88 @@ pub(super) fn update_texture(
     Ok(())
 }
 
+/// Re-uploads a texture's level 0 at a new size, keeping its handle.
+pub(super) fn resize_texture_storage(
+    backend: &mut OpenGLBackend,
+    handle: TextureHandle,
+    width: u32,
+    height: u32,
+    data: &[u8],
+) -> GoudResult<()> {
+    if width == 0 || height == 0 {
+        return Err(GoudError::TextureCreationFailed(
+            "Texture dimensions must be greater than 0".to_string(),
+        ));
+    }
+    let metadata = backend
+        .textures
+        .get_mut(&handle)
+        .ok_or(GoudError::InvalidHandle)?;
+    let expected_size = (width * height) as usize * bytes_per_pixel(metadata.format);
+    if data.len() != expected_size {
+        return Err(GoudError::TextureCreationFailed(format!(
+            "Data size mismatch: expected {} bytes, got {}",
+            expected_size,
+            data.len()
+        )));
+    }
+
+    let (internal_format, pixel_format, pixel_type) = texture_format_to_gl(metadata.format);
+
+    // SAFETY: Valid GL context is guaranteed by the renderer initialization.
+    // gl_id is a live texture object from the backend and the data size was
+    // validated above against the stored format.
+    unsafe {
+        gl::BindTexture(gl::TEXTURE_2D, metadata.gl_id);
+        gl::TexImage2D(
+            gl::TEXTURE_2D,
+            0, // mip level
+            internal_format as i32,
+            width as i32,
+            height as i32,
+            0, // border (must be 0)
+            pixel_format,
+            pixel_type,
+            data.as_ptr() as *const std::ffi::c_void,
+        );
+
+        let error = gl::GetError();
+        gl::BindTexture(gl::TEXTURE_2D, 0);
+        if error != gl::NO_ERROR {
+            return Err(GoudError::TextureCreationFailed(format!(
+                "OpenGL error during texture resize: 0x{:X}",
+                error
+            )));
+        }
+    }
+
+    metadata.storage_width = width;
+    metadata.storage_height = height;
+    let gl_id = metadata.gl_id;
+    for bound in backend.bound_textures.iter_mut() {
+        if *bound == Some(gl_id) {
+            *bound = None;
+        }
+    }
+    Ok(())
+}
+
+/// Sets the size reported by `texture_size`, leaving the storage untouched.
+pub(super) fn set_texture_logical_size(
+    backend: &mut OpenGLBackend,
+    handle: TextureHandle,
+    width: u32,
+    height: u32,
+) -> GoudResult<()> {
+    let metadata = backend
+        .textures
+        .get_mut(&handle)
+        .ok_or(GoudError::InvalidHandle)?;
+    metadata.width = width;
+    metadata.height = height;
+    Ok(())
+}
+
 /// Destroys a texture and frees GPU memory.
 pub(super) fn destroy_texture(backend: &mut OpenGLBackend, handle: TextureHandle) -> bool {
     if let Some(metadata) = backend.textures.remove(&handle) {
@@ -50,6 +50,64 @@ pub trait TextureOps {
         data: &[u8],
     ) -> GoudResult<()>;
 
+    /// Replaces a texture's pixel storage with an image of a different size.
+    ///
+    /// The handle, format, filter, and wrap mode are kept, and
+    /// [`texture_size`](Self::texture_size) keeps reporting the texture's
+    /// logical size, so UVs derived from pixel-space source
+    /// rectangles stay correct while sampling reads the new image. Texture
+    /// streaming uses this to swap a texture between resolutions without
+    /// invalidating handles held by callers. Later
+    /// [`update_texture`](Self::update_texture) calls address the new storage.
+    ///
+    /// # Arguments
+    /// * `handle` - Handle to the texture to resize
+    /// * `width` - New storage width in pixels (must be > 0)
+    /// * `height` - New storage height in pixels (must be > 0)
+    /// * `data` - Pixel data for the new storage, in the texture's format
+    ///
+    /// # Default
+    /// Returns `GoudError::BackendNotSupported`.
+    fn resize_texture_storage(
+        &mut self,
+        handle: TextureHandle,
+        width: u32,
+        height: u32,
+        data: &[u8],
+    ) -> GoudResult<()> {
+        let _ = (handle, width, height, data);
+        Err(GoudError::BackendNotSupported(
+            "Texture storage resizing not supported by this backend".to_string(),
+        ))
+    }
+
+    /// Sets the size [`texture_size`](Self::texture_size) reports, leaving
+    /// the storage untouched.
+    ///
+    /// Texture streaming creates a texture directly at a small tier and
+    /// then records the full image size here, so pixel-space source
+    /// rectangles resolve against the full image without full-size storage
+    /// ever being allocated.
+    ///
+    /// # Arguments
+    /// * `handle` - Handle to the texture
+    /// * `width` - Logical width in pixels
+    /// * `height` - Logical height in pixels
+    ///
+    /// # Default
+    /// Returns `GoudError::BackendNotSupported`.
+    fn set_texture_logical_size(
+        &mut self,
+        handle: TextureHandle,
+        width: u32,
+        height: u32,
+    ) -> GoudResult<()> {
+        let _ = (handle, width, height);
+        Err(GoudError::BackendNotSupported(
+            "Logical texture sizes not supported by this backend".to_string(),
+        ))
+    }
+
     /// Destroys a texture and frees GPU memory.
     ///
     /// # Returns
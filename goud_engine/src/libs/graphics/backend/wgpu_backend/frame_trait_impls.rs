@@ -37,6 +37,25 @@ impl TextureOps for WgpuBackend {
         self.update_texture_impl(handle, x, y, width, height, data)
     }
 
+    fn resize_texture_storage(
+        &mut self,
+        handle: TextureHandle,
+        width: u32,
+        height: u32,
+        data: &[u8],
+    ) -> GoudResult<()> {
+        self.resize_texture_storage_impl(handle, width, height, data)
+    }
+
+    fn set_texture_logical_size(
+        &mut self,
+        handle: TextureHandle,
+        width: u32,
+        height: u32,
+    ) -> GoudResult<()> {
+        self.set_texture_logical_size_impl(handle, width, height)
+    }
+
     fn destroy_texture(&mut self, handle: TextureHandle) -> bool {
         self.destroy_texture_impl(handle)
     }
@@ -5,6 +5,7 @@
 //! module tree.
 
 use super::{
+    super::types::{TextureFilter, TextureFormat, TextureWrap},
     BlendFactor, BufferHandle, BufferType, CullFace, DepthFunc, FrontFace, PrimitiveTopology,
     ShaderHandle, TextureHandle, VertexBufferBinding,
 };
@@ -29,6 +30,13 @@ pub(super) struct WgpuTextureMeta {
     pub(super) _sampler: wgpu::Sampler,
     pub(super) width: u32,
     pub(super) height: u32,
+    /// Size of the uploaded image; differs from `width`/`height` once streamed.
+    pub(super) storage_width: u32,
+    pub(super) storage_height: u32,
+    /// Creation parameters, kept so the storage can be rebuilt at a new size.
+    pub(super) format: TextureFormat,
+    pub(super) filter: TextureFilter,
+    pub(super) wrap: TextureWrap,
     /// Cached bind group for this texture (view + sampler). Created once at
     /// texture creation time and reused every frame instead of being recreated
     /// per draw command.
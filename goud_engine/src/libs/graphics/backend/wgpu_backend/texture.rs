@@ -140,6 +140,11 @@ impl WgpuBackend {
                 _sampler: sampler,
                 width,
                 height,
+                storage_width: width,
+                storage_height: height,
+                format,
+                filter,
+                wrap,
                 bind_group,
             },
         );
@@ -156,7 +161,7 @@ impl WgpuBackend {
         data: &[u8],
     ) -> GoudResult<()> {
         let meta = self.textures.get(&handle).ok_or(GoudError::InvalidHandle)?;
-        if x + width > meta.width || y + height > meta.height {
+        if x + width > meta.storage_width || y + height > meta.storage_height {
             return Err(GoudError::InvalidState(
                 "Texture update out of bounds".into(),
             ));
@@ -183,6 +188,46 @@ impl WgpuBackend {
         Ok(())
     }
 
+    pub(super) fn resize_texture_storage_impl(
+        &mut self,
+        handle: TextureHandle,
+        width: u32,
+        height: u32,
+        data: &[u8],
+    ) -> GoudResult<()> {
+        let meta = self.textures.get(&handle).ok_or(GoudError::InvalidHandle)?;
+        let (logical_width, logical_height) = (meta.width, meta.height);
+        let (format, filter, wrap) = (meta.format, meta.filter, meta.wrap);
+
+        // Build the new storage under a scratch handle, then move it into the
+        // caller's slot so existing handles and bindings keep working.
+        let scratch = self.create_texture_impl(width, height, format, filter, wrap, data)?;
+        let mut rebuilt = self
+            .textures
+            .remove(&scratch)
+            .ok_or(GoudError::InvalidHandle)?;
+        self.texture_allocator.deallocate(scratch);
+        rebuilt.width = logical_width;
+        rebuilt.height = logical_height;
+        self.textures.insert(handle, rebuilt);
+        Ok(())
+    }
+
+    pub(super) fn set_texture_logical_size_impl(
+        &mut self,
+        handle: TextureHandle,
+        width: u32,
+        height: u32,
+    ) -> GoudResult<()> {
+        let meta = self
+            .textures
+            .get_mut(&handle)
+            .ok_or(GoudError::InvalidHandle)?;
+        meta.width = width;
+        meta.height = height;
+        Ok(())
+    }
+
     pub(super) fn destroy_texture_impl(&mut self, handle: TextureHandle) -> bool {
         if self.textures.remove(&handle).is_some() {
             self.texture_allocator.deallocate(handle);
@@ -0,0 +1,126 @@
+//! Windowless platform backend for servers, CI, and benchmarks.
+//!
+//! [`HeadlessPlatform`] implements [`PlatformBackend`] without touching any
+//! windowing system: it reports the configured size as both the logical and
+//! framebuffer size, never produces input events, and only closes when asked
+//! to. Paired with the null render backend it lets the full engine tick run
+//! on machines with no display or GPU.
+
+use std::time::Instant;
+
+use crate::core::input_manager::InputManager;
+
+use super::{FullscreenMode, PlatformBackend, WindowConfig};
+
+/// Platform backend with no window, no display, and no input devices.
+pub struct HeadlessPlatform {
+    should_close: bool,
+    width: u32,
+    height: u32,
+    last_frame: Instant,
+}
+
+impl HeadlessPlatform {
+    /// Creates a headless platform sized from `config`.
+    ///
+    /// A zero dimension is clamped to 1 so renderers never see an empty
+    /// viewport. This never fails.
+    pub fn new(config: &WindowConfig) -> Self {
+        Self {
+            should_close: false,
+            width: config.width.max(1),
+            height: config.height.max(1),
+            last_frame: Instant::now(),
+        }
+    }
+}
+
+impl PlatformBackend for HeadlessPlatform {
+    fn should_close(&self) -> bool {
+        self.should_close
+    }
+
+    fn set_should_close(&mut self, should_close: bool) {
+        self.should_close = should_close;
+    }
+
+    fn poll_events(&mut self, input: &mut InputManager) -> f32 {
+        // Advance input so "just pressed" state injected by tests or netcode
+        // expires one frame later, exactly as on a windowed backend.
+        input.update();
+
+        let now = Instant::now();
+        let dt = now.duration_since(self.last_frame).as_secs_f32();
+        self.last_frame = now;
+        dt
+    }
+
+    fn swap_buffers(&mut self) {
+        // No-op: there is nothing to present.
+    }
+
+    fn get_size(&self) -> (u32, u32) {
+        (self.width, self.height)
+    }
+
+    fn request_size(&mut self, width: u32, height: u32) -> bool {
+        if width == 0 || height == 0 {
+            return false;
+        }
+        self.width = width;
+        self.height = height;
+        true
+    }
+
+    fn get_framebuffer_size(&self) -> (u32, u32) {
+        // No display means no HiDPI scaling; logical == physical.
+        (self.width, self.height)
+    }
+
+    fn set_fullscreen(&mut self, _mode: FullscreenMode) -> bool {
+        false
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn reports_configured_size_for_window_and_framebuffer() {
+        let platform = HeadlessPlatform::new(&WindowConfig {
+            width: 320,
+            height: 180,
+            ..Default::default()
+        });
+        assert_eq!(platform.get_size(), (320, 180));
+        assert_eq!(platform.get_framebuffer_size(), (320, 180));
+        assert!(!platform.should_close());
+    }
+
+    #[test]
+    fn zero_size_is_clamped_and_resize_rejects_zero() {
+        let mut platform = HeadlessPlatform::new(&WindowConfig {
+            width: 0,
+            height: 0,
+            ..Default::default()
+        });
+        assert_eq!(platform.get_size(), (1, 1));
+        assert!(platform.request_size(640, 360));
+        assert_eq!(platform.get_framebuffer_size(), (640, 360));
+        assert!(!platform.request_size(0, 360));
+        assert_eq!(platform.get_size(), (640, 360));
+    }
+
+    #[test]
+    fn closes_only_when_requested() {
+        let mut platform = HeadlessPlatform::new(&WindowConfig::default());
+        let mut input = InputManager::new();
+        let dt = platform.poll_events(&mut input);
+        assert!(dt >= 0.0);
+        assert!(!platform.should_close());
+        platform.set_should_close(true);
+        assert!(platform.should_close());
+        assert!(!platform.set_fullscreen(FullscreenMode::Borderless));
+    }
+}
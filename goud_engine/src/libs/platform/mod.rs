@@ -40,6 +40,13 @@ pub mod glfw_platform;
     feature = "sdl-window",
     feature = "switch-vulkan"
 ))]
+pub mod headless_platform;
+#[cfg(any(
+    feature = "native",
+    feature = "xbox-gdk",
+    feature = "sdl-window",
+    feature = "switch-vulkan"
+))]
 pub mod native_runtime;
 #[cfg(feature = "sdl-window")]
 pub mod sdl_platform;
@@ -123,6 +130,8 @@ pub enum RenderBackendKind {
     OpenGlLegacy = 1,
     /// Auto-detect the best available backend at runtime.
     Auto = 2,
+    /// GPU-free recorder for headless runs; pairs with [`WindowBackendKind::Headless`].
+    Null = 3,
 }
 
 impl RenderBackendKind {
@@ -132,6 +141,7 @@ impl RenderBackendKind {
             0 => Some(Self::Wgpu),
             1 => Some(Self::OpenGlLegacy),
             2 => Some(Self::Auto),
+            3 => Some(Self::Null),
             _ => None,
         }
     }
@@ -155,6 +165,9 @@ pub enum WindowBackendKind {
     /// Nintendo Switch Vulkan path (PoC).
     #[cfg(feature = "switch-vulkan")]
     SwitchVulkan = 4,
+    /// Windowless path for servers, CI, and benchmarks; pairs with
+    /// [`RenderBackendKind::Null`].
+    Headless = 5,
 }
 
 impl WindowBackendKind {
@@ -169,6 +182,7 @@ impl WindowBackendKind {
             3 => Some(Self::SdlWindow),
             #[cfg(feature = "switch-vulkan")]
             4 => Some(Self::SwitchVulkan),
+            5 => Some(Self::Headless),
             _ => None,
         }
     }
@@ -374,6 +388,19 @@ mod tests {
         );
     }
 
+    #[test]
+    fn headless_and_null_backend_round_trip() {
+        assert_eq!(
+            WindowBackendKind::from_u32(5),
+            Some(WindowBackendKind::Headless)
+        );
+        assert_eq!(
+            RenderBackendKind::from_u32(3),
+            Some(RenderBackendKind::Null)
+        );
+        assert_eq!(RenderBackendKind::from_u32(4), None);
+    }
+
     #[cfg(feature = "xbox-gdk")]
     #[test]
     fn xbox_gdk_window_backend_round_trip() {
@@ -1,15 +1,9 @@
 //! Native runtime factory for valid window/render backend pairs.
 
 use crate::core::error::{GoudError, GoudResult};
-#[cfg(any(
-    target_os = "linux",
-    target_os = "macos",
-    target_os = "windows",
-    target_os = "android",
-    target_os = "ios"
-))]
 use crate::libs::graphics::backend::native_backend::NativeRenderBackend;
 use crate::libs::graphics::backend::native_backend::SharedNativeRenderBackend;
+use crate::libs::graphics::backend::null::NullBackend;
 
 use super::{PlatformBackend, RenderBackendKind, WindowBackendKind, WindowConfig};
 
@@ -26,7 +20,7 @@ fn invalid_pair_error(
     render_backend: RenderBackendKind,
 ) -> GoudError {
     GoudError::InitializationFailed(format!(
-        "invalid native backend pair: window={window_backend:?} render={render_backend:?}; supported pairs are Winit+Wgpu, GlfwLegacy+OpenGlLegacy, XboxGdk+Wgpu, SdlWindow+Wgpu, and SwitchVulkan+Wgpu"
+        "invalid native backend pair: window={window_backend:?} render={render_backend:?}; supported pairs are Winit+Wgpu, GlfwLegacy+OpenGlLegacy, XboxGdk+Wgpu, SdlWindow+Wgpu, SwitchVulkan+Wgpu, and Headless+Null"
     ))
 }
 
@@ -93,6 +87,7 @@ pub fn validate_native_backend_pair(
         (WindowBackendKind::SdlWindow, RenderBackendKind::Wgpu) => Ok(()),
         #[cfg(feature = "switch-vulkan")]
         (WindowBackendKind::SwitchVulkan, RenderBackendKind::Wgpu) => Ok(()),
+        (WindowBackendKind::Headless, RenderBackendKind::Null) => Ok(()),
         (_, RenderBackendKind::Auto) => Ok(()), // Auto is resolved before validation
         _ => Err(invalid_pair_error(window_backend, render_backend)),
     }
@@ -235,6 +230,20 @@ pub fn create_native_runtime(
                 )),
             })
         }
+        (WindowBackendKind::Headless, RenderBackendKind::Null) => {
+            use crate::libs::graphics::backend::StateOps;
+
+            let platform = super::headless_platform::HeadlessPlatform::new(window_config);
+            let (w, h) = platform.get_framebuffer_size();
+            let mut backend = NullBackend::new();
+            backend.set_viewport(0, 0, w, h);
+            Ok(NativeRuntime {
+                platform: Box::new(platform),
+                render_backend: SharedNativeRenderBackend::new(NativeRenderBackend::Null(
+                    Box::new(backend),
+                )),
+            })
+        }
         _ => Err(invalid_pair_error(window_backend, render_backend)),
     }
 }
@@ -285,6 +294,40 @@ mod tests {
         );
     }
 
+    #[test]
+    fn accepts_headless_null_pair_only_together() {
+        assert!(
+            validate_native_backend_pair(WindowBackendKind::Headless, RenderBackendKind::Null)
+                .is_ok()
+        );
+        assert!(
+            validate_native_backend_pair(WindowBackendKind::Headless, RenderBackendKind::Wgpu)
+                .is_err()
+        );
+        assert!(
+            validate_native_backend_pair(WindowBackendKind::Winit, RenderBackendKind::Null)
+                .is_err()
+        );
+    }
+
+    #[test]
+    fn creates_headless_runtime_without_a_display() {
+        let config = WindowConfig {
+            width: 640,
+            height: 360,
+            ..Default::default()
+        };
+        let runtime = create_native_runtime(
+            &config,
+            WindowBackendKind::Headless,
+            RenderBackendKind::Null,
+        )
+        .expect("headless runtime needs no window system");
+
+        assert_eq!(runtime.platform.get_framebuffer_size(), (640, 360));
+        assert!(!runtime.platform.should_close());
+    }
+
     #[cfg(feature = "xbox-gdk")]
     #[test]
     fn accepts_xbox_gdk_pair() {
@@ -17,6 +17,27 @@ impl Rapier2DPhysicsProvider {
         id
     }
 
+    /// Queue a Stay event for every active pair not in `entered`.
+    ///
+    /// Pairs come out of a `HashSet`, so in deterministic mode they are
+    /// sorted first to give every peer the same event order.
+    pub(super) fn emit_stay_events(&mut self, entered: &HashSet<(u64, u64)>) {
+        let start = self.collision_events.len();
+        for &(a, b) in &self.active_collision_pairs {
+            if entered.contains(&(a, b)) {
+                continue;
+            }
+            self.collision_events.push(EngineCollisionEvent {
+                body_a: BodyHandle(a),
+                body_b: BodyHandle(b),
+                kind: CollisionEventKind::Stay,
+            });
+        }
+        if self.deterministic {
+            self.collision_events[start..].sort_unstable_by_key(|e| (e.body_a.0, e.body_b.0));
+        }
+    }
+
     /// Drain rapier collision events from the channel and update pair state.
     ///
     /// Returns the set of pairs that entered this drain cycle.
@@ -6,6 +6,7 @@
 pub mod conversions;
 mod helpers;
 mod queries;
+mod snapshot;
 #[cfg(test)]
 mod tests;
 
@@ -19,8 +20,8 @@ use crate::core::providers::physics::PhysicsProvider;
 use crate::core::providers::types::ColliderHandle as EngineColliderHandle;
 use crate::core::providers::types::CollisionEvent as EngineCollisionEvent;
 use crate::core::providers::types::{
-    BodyDesc, BodyHandle, ColliderDesc, CollisionEventKind, ContactPair, DebugShape, JointDesc,
-    JointHandle, PhysicsCapabilities, RaycastHit,
+    BodyDesc, BodyHandle, ColliderDesc, ContactPair, DebugShape, JointDesc, JointHandle,
+    PhysicsCapabilities, RaycastHit,
 };
 use crate::core::providers::{Provider, ProviderLifecycle};
 
@@ -61,6 +62,11 @@ pub struct Rapier2DPhysicsProvider {
     _contact_recv: Receiver<ContactForceEvent>,
     event_handler: ChannelEventCollector,
 
+    // Fixed dt and ordered Stay events, see `set_deterministic`.
+    deterministic: bool,
+    // Last `set_timestep` value; variable steps overwrite the integration dt.
+    fixed_timestep: f32,
+
     capabilities: PhysicsCapabilities,
 }
 
@@ -97,6 +103,8 @@ impl Rapier2DPhysicsProvider {
             collision_recv,
             _contact_recv: contact_recv,
             event_handler,
+            deterministic: false,
+            fixed_timestep: IntegrationParameters::default().dt,
             capabilities: PhysicsCapabilities {
                 supports_continuous_collision: true,
                 supports_joints: true,
@@ -138,7 +146,11 @@ impl PhysicsProvider for Rapier2DPhysicsProvider {
     }
 
     fn step(&mut self, delta: f32) -> GoudResult<()> {
-        self.integration_parameters.dt = delta;
+        self.integration_parameters.dt = if self.deterministic {
+            self.fixed_timestep
+        } else {
+            delta
+        };
 
         // Drain any pending events from prior steps before advancing.
         let mut entered_this_step = self.drain_rapier_collision_events();
@@ -164,16 +176,7 @@ impl PhysicsProvider for Rapier2DPhysicsProvider {
 
         // Emit one Stay event per currently overlapping pair each step
         // (excluding pairs that just entered this step).
-        for &(a, b) in &self.active_collision_pairs {
-            if entered_this_step.contains(&(a, b)) {
-                continue;
-            }
-            self.collision_events.push(EngineCollisionEvent {
-                body_a: BodyHandle(a),
-                body_b: BodyHandle(b),
-                kind: CollisionEventKind::Stay,
-            });
-        }
+        self.emit_stay_events(&entered_this_step);
 
         self.query_pipeline.update(&self.collider_set);
 
@@ -189,6 +192,7 @@ impl PhysicsProvider for Rapier2DPhysicsProvider {
     }
 
     fn set_timestep(&mut self, dt: f32) {
+        self.fixed_timestep = dt;
         self.integration_parameters.dt = dt;
     }
 
@@ -266,6 +270,15 @@ impl PhysicsProvider for Rapier2DPhysicsProvider {
         Ok([v.x, v.y])
     }
 
+    fn body_rotation(&self, handle: BodyHandle) -> GoudResult<f32> {
+        let rh = self.get_rapier_body(handle)?;
+        let body = self
+            .rigid_body_set
+            .get(rh)
+            .ok_or(GoudError::InvalidHandle)?;
+        Ok(body.rotation().angle())
+    }
+
     fn set_body_velocity(&mut self, handle: BodyHandle, vel: [f32; 2]) -> GoudResult<()> {
         let rh = self.get_rapier_body(handle)?;
         self.rigid_body_set
@@ -412,6 +425,10 @@ impl PhysicsProvider for Rapier2DPhysicsProvider {
         self.query_overlap_circle(center, radius)
     }
 
+    fn overlap_aabb(&self, min: [f32; 2], max: [f32; 2], layer_mask: u32) -> Vec<BodyHandle> {
+        self.query_overlap_aabb(min, max, layer_mask)
+    }
+
     fn drain_collision_events(&mut self) -> Vec<EngineCollisionEvent> {
         let _ = self.drain_rapier_collision_events();
         std::mem::take(&mut self.collision_events)
@@ -455,4 +472,21 @@ impl PhysicsProvider for Rapier2DPhysicsProvider {
             timestep: self.integration_parameters.dt,
         }
     }
+
+    fn save_state(&self) -> Option<Box<dyn std::any::Any + Send + Sync>> {
+        Some(Box::new(self.capture_state()))
+    }
+
+    fn load_state(&mut self, state: &(dyn std::any::Any + Send + Sync)) -> GoudResult<()> {
+        let state = state
+            .downcast_ref::<snapshot::Rapier2DState>()
+            .ok_or_else(|| GoudError::InvalidState("not a rapier2d physics state".to_string()))?;
+        self.apply_state(state);
+        Ok(())
+    }
+
+    fn set_deterministic(&mut self, enabled: bool) -> GoudResult<()> {
+        self.deterministic = enabled;
+        Ok(())
+    }
 }
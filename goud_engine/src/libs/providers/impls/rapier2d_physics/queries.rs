@@ -82,6 +82,43 @@ impl Rapier2DPhysicsProvider {
         results
     }
 
+    /// Find all bodies with a collider on `layer_mask` overlapping a box.
+    pub(crate) fn query_overlap_aabb(
+        &self,
+        min: [f32; 2],
+        max: [f32; 2],
+        layer_mask: u32,
+    ) -> Vec<BodyHandle> {
+        let half = [(max[0] - min[0]) * 0.5, (max[1] - min[1]) * 0.5];
+        if !(half[0] >= 0.0 && half[1] >= 0.0) {
+            return Vec::new();
+        }
+        let shape = Cuboid::new(vector![half[0], half[1]]);
+        let shape_pos = Isometry::translation(min[0] + half[0], min[1] + half[1]);
+        let mut results = Vec::new();
+
+        self.query_pipeline.intersections_with_shape(
+            &self.rigid_body_set,
+            &self.collider_set,
+            &shape_pos,
+            &shape,
+            super::conversions::raycast_query_filter(layer_mask),
+            |collider_handle| {
+                let engine_id = self
+                    .collider_set
+                    .get(collider_handle)
+                    .and_then(|collider| collider.parent())
+                    .and_then(|parent| self.body_handles_rev.get(&parent));
+                if let Some(&engine_id) = engine_id {
+                    results.push(BodyHandle(engine_id));
+                }
+                true
+            },
+        );
+
+        results
+    }
+
     /// Collect active contact pairs from the narrow phase.
     pub(crate) fn query_contact_pairs(&self) -> Vec<ContactPair> {
         let mut pairs = Vec::new();
@@ -0,0 +1,107 @@
+//! Rollback state capture for the Rapier2D provider.
+//!
+//! Rapier's sets, contact graph, broad phase and solver caches are all
+//! `Clone`, so a saved state is a plain copy of them plus the engine handle
+//! maps. Restoring copies it back; stepping the restored provider with the
+//! same inputs reproduces the same results, warm-start caches included.
+
+use std::collections::{HashMap, HashSet};
+
+use rapier2d::prelude::*;
+
+use rapier2d::prelude::ColliderHandle as RapierColliderHandle;
+
+use super::Rapier2DPhysicsProvider;
+use crate::core::providers::types::CollisionEvent as EngineCollisionEvent;
+
+/// Everything [`Rapier2DPhysicsProvider::step`] reads or writes.
+///
+/// The pipeline only holds scratch buffers and counters, so it is not saved.
+#[derive(Clone)]
+pub(super) struct Rapier2DState {
+    integration_parameters: IntegrationParameters,
+    island_manager: IslandManager,
+    broad_phase: DefaultBroadPhase,
+    narrow_phase: NarrowPhase,
+    rigid_body_set: RigidBodySet,
+    collider_set: ColliderSet,
+    impulse_joint_set: ImpulseJointSet,
+    multibody_joint_set: MultibodyJointSet,
+    ccd_solver: CCDSolver,
+    query_pipeline: QueryPipeline,
+    gravity: Vector<f32>,
+    body_handles: HashMap<u64, RigidBodyHandle>,
+    body_handles_rev: HashMap<RigidBodyHandle, u64>,
+    collider_handles: HashMap<u64, RapierColliderHandle>,
+    collider_handles_rev: HashMap<RapierColliderHandle, u64>,
+    joint_handles: HashMap<u64, ImpulseJointHandle>,
+    joint_handles_rev: HashMap<ImpulseJointHandle, u64>,
+    next_id: u64,
+    collision_events: Vec<EngineCollisionEvent>,
+    active_collision_pairs: HashSet<(u64, u64)>,
+    active_collision_collider_pairs:
+        HashMap<(u64, u64), HashSet<(RapierColliderHandle, RapierColliderHandle)>>,
+}
+
+impl Rapier2DPhysicsProvider {
+    /// Copies the simulation into a new saved state.
+    pub(super) fn capture_state(&self) -> Rapier2DState {
+        Rapier2DState {
+            integration_parameters: self.integration_parameters,
+            island_manager: self.island_manager.clone(),
+            broad_phase: self.broad_phase.clone(),
+            narrow_phase: self.narrow_phase.clone(),
+            rigid_body_set: self.rigid_body_set.clone(),
+            collider_set: self.collider_set.clone(),
+            impulse_joint_set: self.impulse_joint_set.clone(),
+            multibody_joint_set: self.multibody_joint_set.clone(),
+            ccd_solver: self.ccd_solver.clone(),
+            query_pipeline: self.query_pipeline.clone(),
+            gravity: self.gravity,
+            body_handles: self.body_handles.clone(),
+            body_handles_rev: self.body_handles_rev.clone(),
+            collider_handles: self.collider_handles.clone(),
+            collider_handles_rev: self.collider_handles_rev.clone(),
+            joint_handles: self.joint_handles.clone(),
+            joint_handles_rev: self.joint_handles_rev.clone(),
+            next_id: self.next_id,
+            collision_events: self.collision_events.clone(),
+            active_collision_pairs: self.active_collision_pairs.clone(),
+            active_collision_collider_pairs: self.active_collision_collider_pairs.clone(),
+        }
+    }
+
+    /// Overwrites the simulation with a saved state.
+    ///
+    /// Rapier events still queued from the abandoned timeline are dropped so
+    /// they cannot surface after the rollback.
+    pub(super) fn apply_state(&mut self, state: &Rapier2DState) {
+        while self.collision_recv.try_recv().is_ok() {}
+
+        self.integration_parameters = state.integration_parameters;
+        self.island_manager.clone_from(&state.island_manager);
+        self.broad_phase.clone_from(&state.broad_phase);
+        self.narrow_phase.clone_from(&state.narrow_phase);
+        self.rigid_body_set.clone_from(&state.rigid_body_set);
+        self.collider_set.clone_from(&state.collider_set);
+        self.impulse_joint_set.clone_from(&state.impulse_joint_set);
+        self.multibody_joint_set
+            .clone_from(&state.multibody_joint_set);
+        self.ccd_solver.clone_from(&state.ccd_solver);
+        self.query_pipeline.clone_from(&state.query_pipeline);
+        self.gravity = state.gravity;
+        self.body_handles.clone_from(&state.body_handles);
+        self.body_handles_rev.clone_from(&state.body_handles_rev);
+        self.collider_handles.clone_from(&state.collider_handles);
+        self.collider_handles_rev
+            .clone_from(&state.collider_handles_rev);
+        self.joint_handles.clone_from(&state.joint_handles);
+        self.joint_handles_rev.clone_from(&state.joint_handles_rev);
+        self.next_id = state.next_id;
+        self.collision_events.clone_from(&state.collision_events);
+        self.active_collision_pairs
+            .clone_from(&state.active_collision_pairs);
+        self.active_collision_collider_pairs
+            .clone_from(&state.active_collision_collider_pairs);
+    }
+}
@@ -2,6 +2,7 @@
 
 mod basic;
 mod dynamics;
+mod snapshot;
 
 #[path = "../tests_gravity.rs"]
 mod gravity_tests;
@@ -0,0 +1,116 @@
+//! Rollback state and deterministic stepping tests.
+
+use crate::core::providers::physics::PhysicsProvider;
+use crate::core::providers::types::*;
+use crate::libs::providers::impls::rapier2d_physics::Rapier2DPhysicsProvider;
+
+fn ball(provider: &mut Rapier2DPhysicsProvider, x: f32, y: f32) -> BodyHandle {
+    let body = provider
+        .create_body(&BodyDesc {
+            position: [x, y],
+            body_type: 1,
+            ..Default::default()
+        })
+        .unwrap();
+    provider
+        .create_collider(
+            body,
+            &ColliderDesc {
+                shape: 0,
+                radius: 0.5,
+                ..Default::default()
+            },
+        )
+        .unwrap();
+    body
+}
+
+#[test]
+fn test_load_state_replays_identically() {
+    let mut provider = Rapier2DPhysicsProvider::new([0.0, -9.81]);
+    let a = ball(&mut provider, 0.0, 2.0);
+    let b = ball(&mut provider, 0.4, 0.0);
+    provider.step(1.0 / 60.0).unwrap();
+
+    let state = provider.save_state().unwrap();
+    for _ in 0..8 {
+        provider.step(1.0 / 60.0).unwrap();
+    }
+    let first = (
+        provider.body_position(a).unwrap(),
+        provider.body_position(b).unwrap(),
+        provider.drain_collision_events().len(),
+    );
+
+    provider.load_state(state.as_ref()).unwrap();
+    for _ in 0..8 {
+        provider.step(1.0 / 60.0).unwrap();
+    }
+    let second = (
+        provider.body_position(a).unwrap(),
+        provider.body_position(b).unwrap(),
+        provider.drain_collision_events().len(),
+    );
+    assert_eq!(first, second);
+}
+
+#[test]
+fn test_load_state_forgets_later_bodies() {
+    let mut provider = Rapier2DPhysicsProvider::new([0.0, 0.0]);
+    let state = provider.save_state().unwrap();
+    let body = ball(&mut provider, 0.0, 0.0);
+
+    provider.load_state(state.as_ref()).unwrap();
+    assert!(provider.body_position(body).is_err());
+    assert_eq!(provider.physics_diagnostics().body_count, 0);
+}
+
+#[test]
+fn test_load_state_rejects_foreign_state() {
+    let mut provider = Rapier2DPhysicsProvider::new([0.0, 0.0]);
+    assert!(provider.load_state(&42_u32).is_err());
+}
+
+#[test]
+fn test_deterministic_mode_uses_fixed_timestep() {
+    let mut provider = Rapier2DPhysicsProvider::new([0.0, 0.0]);
+    provider.set_timestep(1.0 / 60.0);
+    provider.set_deterministic(true).unwrap();
+    provider.step(0.25).unwrap();
+    assert_eq!(provider.timestep(), 1.0 / 60.0);
+
+    provider.set_deterministic(false).unwrap();
+    provider.step(0.25).unwrap();
+    assert_eq!(provider.timestep(), 0.25);
+}
+
+#[test]
+fn test_deterministic_mode_ignores_earlier_variable_steps() {
+    let mut provider = Rapier2DPhysicsProvider::new([0.0, 0.0]);
+    provider.set_timestep(1.0 / 120.0);
+    provider.step(0.25).unwrap();
+    provider.set_deterministic(true).unwrap();
+    provider.step(0.5).unwrap();
+    assert_eq!(provider.timestep(), 1.0 / 120.0);
+}
+
+#[test]
+fn test_deterministic_stay_events_are_sorted() {
+    let mut provider = Rapier2DPhysicsProvider::new([0.0, 0.0]);
+    provider.set_deterministic(true).unwrap();
+    for i in 0..6 {
+        ball(&mut provider, i as f32 * 0.1, 0.0);
+    }
+    provider.step(1.0 / 60.0).unwrap();
+    provider.drain_collision_events();
+    provider.step(1.0 / 60.0).unwrap();
+
+    let stay: Vec<(u64, u64)> = provider
+        .drain_collision_events()
+        .into_iter()
+        .filter(|event| event.kind == CollisionEventKind::Stay)
+        .map(|event| (event.body_a.0, event.body_b.0))
+        .collect();
+    assert!(!stay.is_empty());
+    assert!(stay.windows(2).all(|pair| pair[0] < pair[1]));
+}
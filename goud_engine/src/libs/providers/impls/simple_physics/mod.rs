@@ -16,7 +16,7 @@ mod geometry;
 #[cfg(test)]
 mod tests;
 
-use geometry::{circle_overlaps_aabb, collider_half_extents, raycast_aabb};
+use geometry::{circle_overlaps_aabb, collider_half_extents, overlap, raycast_aabb};
 
 #[derive(Debug, Clone)]
 struct SimpleBody {
@@ -369,6 +369,18 @@ impl PhysicsProvider for SimplePhysicsProvider {
             .collect()
     }
 
+    fn overlap_aabb(&self, min: [f32; 2], max: [f32; 2], layer_mask: u32) -> Vec<BodyHandle> {
+        let query = Aabb { min, max };
+        self.colliders
+            .values()
+            .filter(|collider| collider.desc.layer & layer_mask != 0)
+            .filter_map(|collider| {
+                let aabb = self.body_aabb(collider).ok()?;
+                overlap(query, aabb).map(|_| collider.body)
+            })
+            .collect()
+    }
+
     fn drain_collision_events(&mut self) -> Vec<CollisionEvent> {
         std::mem::take(&mut self.collision_events)
     }
@@ -53,6 +53,30 @@ fn overlapping_dynamic_and_static_boxes_are_separated() {
     assert!(!provider.contact_pairs().is_empty());
 }
 
+#[test]
+fn overlap_aabb_reports_bodies_on_matching_layers() {
+    let mut provider = SimplePhysicsProvider::default();
+    let near = provider.create_body(&dynamic_body([1.0, 1.0])).unwrap();
+    let far = provider.create_body(&dynamic_body([10.0, 0.0])).unwrap();
+    provider
+        .create_collider(near, &box_collider([0.5, 0.5]))
+        .unwrap();
+    provider
+        .create_collider(far, &box_collider([0.5, 0.5]))
+        .unwrap();
+
+    assert_eq!(
+        provider.overlap_aabb([0.0, 0.0], [2.0, 2.0], u32::MAX),
+        vec![near]
+    );
+    assert!(provider
+        .overlap_aabb([0.0, 0.0], [2.0, 2.0], 0b0010)
+        .is_empty());
+    assert!(provider
+        .overlap_aabb([3.0, 3.0], [4.0, 4.0], u32::MAX)
+        .is_empty());
+}
+
 #[test]
 fn raycast_hits_nearest_box() {
     let mut provider = SimplePhysicsProvider::default();
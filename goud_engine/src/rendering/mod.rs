@@ -7,6 +7,7 @@ mod render_system;
 pub mod sprite_batch;
 pub mod text;
 pub mod texture_atlas;
+pub mod texture_streaming;
 mod ui_render_system;
 pub mod viewport;
 
@@ -4,6 +4,7 @@
 //! new glyph indices discovered at runtime (Unicode/CJK/RTL shaping paths).
 
 use std::collections::{BTreeSet, HashMap};
+use std::sync::atomic::{AtomicU64, Ordering};
 
 use crate::libs::graphics::backend::render_backend::RenderBackend;
 use crate::libs::graphics::backend::types::{
@@ -57,7 +58,7 @@ pub struct GlyphAtlas {
     gpu_texture: Option<TextureHandle>,
     /// True when CPU atlas data changed and GPU texture must be synced.
     dirty: bool,
-    /// Incremented whenever packed atlas pixels are rebuilt.
+    /// Changes whenever packed atlas pixels are rebuilt; unique across atlases.
     version: u64,
 }
 
@@ -74,6 +75,14 @@ const INITIAL_ATLAS_SIZE: u32 = 256;
 /// Maximum atlas dimension to prevent runaway allocation.
 const MAX_ATLAS_SIZE: u32 = 4096;
 
+/// Source of atlas versions.  Process-wide so a regenerated atlas never
+/// reuses a version that cached layouts were built against.
+static NEXT_ATLAS_VERSION: AtomicU64 = AtomicU64::new(1);
+
+fn next_atlas_version() -> u64 {
+    NEXT_ATLAS_VERSION.fetch_add(1, Ordering::Relaxed)
+}
+
 impl GlyphAtlas {
     /// Generates an atlas for printable ASCII (32..=126) at the given size.
     pub fn generate(font: &fontdue::Font, size_px: f32) -> Result<Self, String> {
@@ -133,7 +142,7 @@ impl GlyphAtlas {
             rasterized_glyphs,
             gpu_texture: None,
             dirty: true,
-            version: 1,
+            version: next_atlas_version(),
         };
         atlas.rebuild_char_cache();
         Ok(atlas)
@@ -325,7 +334,7 @@ impl GlyphAtlas {
         self.glyphs_by_index = glyphs_by_index;
         self.rebuild_char_cache();
         self.dirty = true;
-        self.version = self.version.saturating_add(1);
+        self.version = next_atlas_version();
         Ok(())
     }
 
@@ -0,0 +1,395 @@
+//! LRU cache of shaped text layouts.
+//!
+//! Shaping and line-wrapping dominate the cost of drawing a label, yet most
+//! UI text is identical from one frame to the next.  [`TextLayoutCache`]
+//! keeps finished [`TextLayoutResult`]s keyed by everything that affects
+//! layout — font, size, string, wrap width, alignment, line spacing, and
+//! direction — so an unchanged label skips straight to quad emission.
+//!
+//! Layouts embed atlas UVs, so every entry records the version of the atlas
+//! it was built against; a repacked or regenerated atlas turns the entry
+//! into a miss.  Entries are evicted least-recently-used first once their
+//! estimated footprint exceeds the byte budget.
+
+use std::hash::{Hash, Hasher};
+use std::sync::Arc;
+
+use rustc_hash::{FxHashMap, FxHasher};
+
+use super::direction::TextDirection;
+use super::layout::{LayoutGlyph, TextAlignment, TextLayoutConfig, TextLayoutResult};
+
+/// Default byte budget: roughly 25k cached glyphs.
+pub const DEFAULT_LAYOUT_CACHE_BUDGET: usize = 1024 * 1024;
+
+const NIL: u32 = u32::MAX;
+
+/// Everything that determines a text layout.
+#[derive(Debug, Clone, Copy)]
+pub struct TextLayoutKey<'a> {
+    /// Caller-chosen font identity (FFI font handle or asset handle bits).
+    pub font: u64,
+    /// Font size in pixels.
+    pub font_size: f32,
+    /// UTF-8 text being laid out.
+    pub text: &'a str,
+    /// Wrap width; `None` disables wrapping.
+    pub max_width: Option<f32>,
+    /// Line spacing multiplier.
+    pub line_spacing: f32,
+    /// Horizontal alignment.
+    pub alignment: TextAlignment,
+    /// Shaping direction.
+    pub direction: TextDirection,
+}
+
+impl<'a> TextLayoutKey<'a> {
+    /// Builds a key from a layout config.
+    pub fn new(
+        font: u64,
+        font_size: f32,
+        text: &'a str,
+        config: &TextLayoutConfig,
+        direction: TextDirection,
+    ) -> Self {
+        Self {
+            font,
+            font_size,
+            text,
+            max_width: config.max_width,
+            line_spacing: config.line_spacing,
+            alignment: config.alignment,
+            direction,
+        }
+    }
+
+    fn params(&self) -> KeyParams {
+        KeyParams {
+            font: self.font,
+            font_size: self.font_size.to_bits(),
+            max_width: self.max_width.map_or(u32::MAX, f32::to_bits),
+            line_spacing: self.line_spacing.to_bits(),
+            alignment: self.alignment as u8,
+            direction: self.direction as u8,
+        }
+    }
+
+    fn hash_value(&self) -> u64 {
+        let mut hasher = FxHasher::default();
+        self.params().hash(&mut hasher);
+        self.text.hash(&mut hasher);
+        hasher.finish()
+    }
+}
+
+/// Bit-exact copy of the non-string key fields.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+struct KeyParams {
+    font: u64,
+    font_size: u32,
+    max_width: u32,
+    line_spacing: u32,
+    alignment: u8,
+    direction: u8,
+}
+
+/// Counters describing cache effectiveness.
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct TextLayoutCacheStats {
+    /// Lookups answered from the cache.
+    pub hits: u64,
+    /// Lookups that had to shape and lay out the text.
+    pub misses: u64,
+    /// Entries dropped to stay within the byte budget.
+    pub evictions: u64,
+    /// Entries currently cached.
+    pub entries: u64,
+    /// Estimated bytes held by cached entries.
+    pub bytes: u64,
+    /// Configured byte budget.
+    pub budget_bytes: u64,
+}
+
+struct Entry {
+    hash: u64,
+    params: KeyParams,
+    text: Box<str>,
+    atlas_version: u64,
+    layout: Arc<TextLayoutResult>,
+    bytes: usize,
+    prev: u32,
+    next: u32,
+}
+
+/// Byte-budgeted LRU cache of text layouts.
+pub struct TextLayoutCache {
+    index: FxHashMap<u64, u32>,
+    slots: Vec<Option<Entry>>,
+    free: Vec<u32>,
+    /// Most recently used slot.
+    head: u32,
+    /// Least recently used slot.
+    tail: u32,
+    bytes: usize,
+    budget: usize,
+    hits: u64,
+    misses: u64,
+    evictions: u64,
+}
+
+impl TextLayoutCache {
+    /// Creates an empty cache with [`DEFAULT_LAYOUT_CACHE_BUDGET`].
+    pub fn new() -> Self {
+        Self::with_budget(DEFAULT_LAYOUT_CACHE_BUDGET)
+    }
+
+    /// Creates an empty cache holding at most `budget` bytes.
+    ///
+    /// A budget of 0 disables caching.
+    pub fn with_budget(budget: usize) -> Self {
+        Self {
+            index: FxHashMap::default(),
+            slots: Vec::new(),
+            free: Vec::new(),
+            head: NIL,
+            tail: NIL,
+            bytes: 0,
+            budget,
+            hits: 0,
+            misses: 0,
+            evictions: 0,
+        }
+    }
+
+    /// Returns the cached layout for `key` if it was built against
+    /// `atlas_version`, counting a hit or a miss.
+    ///
+    /// An entry built against a different atlas version is dropped.
+    pub fn get(
+        &mut self,
+        key: &TextLayoutKey<'_>,
+        atlas_version: u64,
+    ) -> Option<Arc<TextLayoutResult>> {
+        let hash = key.hash_value();
+        let Some(&slot) = self.index.get(&hash) else {
+            self.misses += 1;
+            return None;
+        };
+        let entry = self.slots[slot as usize]
+            .as_ref()
+            .expect("indexed slot is live");
+        let matches = entry.params == key.params() && *entry.text == *key.text;
+        let layout =
+            (matches && entry.atlas_version == atlas_version).then(|| Arc::clone(&entry.layout));
+        let Some(layout) = layout else {
+            if matches {
+                self.remove_slot(slot);
+            }
+            self.misses += 1;
+            return None;
+        };
+        self.unlink(slot);
+        self.push_front(slot);
+        self.hits += 1;
+        Some(layout)
+    }
+
+    /// Caches `layout` for `key` and returns a shared handle to it.
+    ///
+    /// Older entries are evicted until the new one fits.  A layout larger
+    /// than the whole budget is returned without being cached.
+    pub fn insert(
+        &mut self,
+        key: &TextLayoutKey<'_>,
+        atlas_version: u64,
+        layout: TextLayoutResult,
+    ) -> Arc<TextLayoutResult> {
+        let layout = Arc::new(layout);
+        let bytes = entry_bytes(key.text, &layout);
+        let hash = key.hash_value();
+        if let Some(&slot) = self.index.get(&hash) {
+            self.remove_slot(slot);
+        }
+        if bytes > self.budget {
+            return layout;
+        }
+        while self.bytes + bytes > self.budget && self.tail != NIL {
+            self.remove_slot(self.tail);
+            self.evictions += 1;
+        }
+
+        let entry = Entry {
+            hash,
+            params: key.params(),
+            text: key.text.into(),
+            atlas_version,
+            layout: Arc::clone(&layout),
+            bytes,
+            prev: NIL,
+            next: NIL,
+        };
+        let slot = match self.free.pop() {
+            Some(slot) => {
+                self.slots[slot as usize] = Some(entry);
+                slot
+            }
+            None => {
+                self.slots.push(Some(entry));
+                (self.slots.len() - 1) as u32
+            }
+        };
+        self.index.insert(hash, slot);
+        self.push_front(slot);
+        self.bytes += bytes;
+        layout
+    }
+
+    /// Drops every entry laid out with `font`.  Returns the number removed.
+    pub fn remove_font(&mut self, font: u64) -> usize {
+        let doomed: Vec<u32> = self
+            .slots
+            .iter()
+            .enumerate()
+            .filter_map(|(slot, entry)| match entry {
+                Some(entry) if entry.params.font == font => Some(slot as u32),
+                _ => None,
+            })
+            .collect();
+        for &slot in &doomed {
+            self.remove_slot(slot);
+        }
+        doomed.len()
+    }
+
+    /// Drops every entry, keeping the counters.
+    pub fn clear(&mut self) {
+        self.index.clear();
+        self.slots.clear();
+        self.free.clear();
+        self.head = NIL;
+        self.tail = NIL;
+        self.bytes = 0;
+    }
+
+    /// Changes the byte budget, evicting entries that no longer fit.
+    pub fn set_budget(&mut self, budget: usize) {
+        self.budget = budget;
+        while self.bytes > self.budget && self.tail != NIL {
+            self.remove_slot(self.tail);
+            self.evictions += 1;
+        }
+    }
+
+    /// Returns the byte budget.
+    pub fn budget(&self) -> usize {
+        self.budget
+    }
+
+    /// Returns the estimated bytes held by cached entries.
+    pub fn bytes(&self) -> usize {
+        self.bytes
+    }
+
+    /// Returns the number of cached entries.
+    pub fn len(&self) -> usize {
+        self.index.len()
+    }
+
+    /// Returns true when nothing is cached.
+    pub fn is_empty(&self) -> bool {
+        self.index.is_empty()
+    }
+
+    /// Returns hit, miss, eviction, and occupancy counters.
+    pub fn stats(&self) -> TextLayoutCacheStats {
+        TextLayoutCacheStats {
+            hits: self.hits,
+            misses: self.misses,
+            evictions: self.evictions,
+            entries: self.index.len() as u64,
+            bytes: self.bytes as u64,
+            budget_bytes: self.budget as u64,
+        }
+    }
+
+    /// Resets the hit, miss, and eviction counters.
+    pub fn reset_stats(&mut self) {
+        self.hits = 0;
+        self.misses = 0;
+        self.evictions = 0;
+    }
+
+    fn remove_slot(&mut self, slot: u32) {
+        self.unlink(slot);
+        let entry = self.slots[slot as usize]
+            .take()
+            .expect("removed slot is live");
+        self.index.remove(&entry.hash);
+        self.bytes -= entry.bytes;
+        self.free.push(slot);
+    }
+
+    fn entry_mut(&mut self, slot: u32) -> &mut Entry {
+        self.slots[slot as usize]
+            .as_mut()
+            .expect("linked slot is live")
+    }
+
+    fn unlink(&mut self, slot: u32) {
+        let (prev, next) = {
+            let entry = self.entry_mut(slot);
+            let links = (entry.prev, entry.next);
+            entry.prev = NIL;
+            entry.next = NIL;
+            links
+        };
+        if prev == NIL {
+            self.head = next;
+        } else {
+            self.entry_mut(prev).next = next;
+        }
+        if next == NIL {
+            self.tail = prev;
+        } else {
+            self.entry_mut(next).prev = prev;
+        }
+    }
+
+    fn push_front(&mut self, slot: u32) {
+        let old_head = self.head;
+        self.entry_mut(slot).next = old_head;
+        if old_head == NIL {
+            self.tail = slot;
+        } else {
+            self.entry_mut(old_head).prev = slot;
+        }
+        self.head = slot;
+    }
+}
+
+impl Default for TextLayoutCache {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl std::fmt::Debug for TextLayoutCache {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        f.debug_struct("TextLayoutCache")
+            .field("entries", &self.len())
+            .field("bytes", &self.bytes)
+            .field("budget", &self.budget)
+            .finish()
+    }
+}
+
+fn entry_bytes(text: &str, layout: &TextLayoutResult) -> usize {
+    std::mem::size_of::<Entry>()
+        + std::mem::size_of::<TextLayoutResult>()
+        + text.len()
+        + layout.glyphs.capacity() * std::mem::size_of::<LayoutGlyph>()
+}
+
+#[cfg(test)]
+#[path = "layout_cache_tests.rs"]
+mod tests;
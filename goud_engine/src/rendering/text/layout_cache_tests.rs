@@ -0,0 +1,147 @@
+use super::*;
+use crate::rendering::text::glyph_atlas::UvRect;
+use crate::rendering::text::layout::TextBoundingBox;
+
+fn layout_with_glyphs(count: usize) -> TextLayoutResult {
+    let glyph = LayoutGlyph {
+        x: 0.0,
+        y: 0.0,
+        character: 'a',
+        uv_rect: UvRect {
+            u_min: 0.0,
+            v_min: 0.0,
+            u_max: 1.0,
+            v_max: 1.0,
+        },
+        size_x: 8.0,
+        size_y: 8.0,
+    };
+    TextLayoutResult {
+        glyphs: vec![glyph; count],
+        bounding_box: TextBoundingBox {
+            width: 8.0 * count as f32,
+            height: 8.0,
+        },
+        line_count: 1,
+    }
+}
+
+fn key(text: &str) -> TextLayoutKey<'_> {
+    TextLayoutKey::new(
+        7,
+        16.0,
+        text,
+        &TextLayoutConfig::default(),
+        TextDirection::Auto,
+    )
+}
+
+#[test]
+fn test_layout_cache_miss_then_hit() {
+    let mut cache = TextLayoutCache::new();
+    assert!(cache.get(&key("score"), 1).is_none());
+    cache.insert(&key("score"), 1, layout_with_glyphs(5));
+
+    let hit = cache.get(&key("score"), 1).expect("cached layout");
+    assert_eq!(hit.glyphs.len(), 5);
+    let stats = cache.stats();
+    assert_eq!((stats.hits, stats.misses, stats.entries), (1, 1, 1));
+    assert_eq!(stats.bytes, cache.bytes() as u64);
+}
+
+#[test]
+fn test_layout_cache_distinguishes_layout_parameters() {
+    let mut cache = TextLayoutCache::new();
+    cache.insert(&key("label"), 1, layout_with_glyphs(5));
+
+    let mut wrapped = key("label");
+    wrapped.max_width = Some(32.0);
+    let mut centered = key("label");
+    centered.alignment = TextAlignment::Center;
+    let mut spaced = key("label");
+    spaced.line_spacing = 1.5;
+    let mut other_font = key("label");
+    other_font.font = 8;
+    let mut rtl = key("label");
+    rtl.direction = TextDirection::RightToLeft;
+
+    for variant in [wrapped, centered, spaced, other_font, rtl] {
+        assert!(cache.get(&variant, 1).is_none());
+    }
+    assert!(cache.get(&key("labels"), 1).is_none());
+    assert!(cache.get(&key("label"), 1).is_some());
+}
+
+#[test]
+fn test_layout_cache_drops_entry_on_atlas_version_change() {
+    let mut cache = TextLayoutCache::new();
+    cache.insert(&key("hp"), 1, layout_with_glyphs(2));
+
+    assert!(cache.get(&key("hp"), 2).is_none());
+    assert!(cache.is_empty());
+    assert_eq!(cache.bytes(), 0);
+}
+
+#[test]
+fn test_layout_cache_evicts_least_recently_used() {
+    let one = entry_bytes("a", &layout_with_glyphs(4));
+    let mut cache = TextLayoutCache::with_budget(one * 2);
+    cache.insert(&key("a"), 1, layout_with_glyphs(4));
+    cache.insert(&key("b"), 1, layout_with_glyphs(4));
+    assert!(cache.get(&key("a"), 1).is_some());
+
+    cache.insert(&key("c"), 1, layout_with_glyphs(4));
+
+    assert!(cache.get(&key("b"), 1).is_none());
+    assert!(cache.get(&key("a"), 1).is_some());
+    assert!(cache.get(&key("c"), 1).is_some());
+    assert_eq!(cache.stats().evictions, 1);
+    assert!(cache.bytes() <= cache.budget());
+}
+
+#[test]
+fn test_layout_cache_skips_layouts_larger_than_budget() {
+    let mut cache = TextLayoutCache::with_budget(64);
+    let layout = cache.insert(&key("big"), 1, layout_with_glyphs(100));
+
+    assert_eq!(layout.glyphs.len(), 100);
+    assert!(cache.is_empty());
+}
+
+#[test]
+fn test_layout_cache_zero_budget_disables_caching() {
+    let mut cache = TextLayoutCache::new();
+    cache.insert(&key("a"), 1, layout_with_glyphs(1));
+    cache.set_budget(0);
+
+    assert!(cache.is_empty());
+    cache.insert(&key("a"), 1, layout_with_glyphs(1));
+    assert!(cache.is_empty());
+}
+
+#[test]
+fn test_layout_cache_reinsert_replaces_entry() {
+    let mut cache = TextLayoutCache::new();
+    cache.insert(&key("a"), 1, layout_with_glyphs(1));
+    cache.insert(&key("a"), 2, layout_with_glyphs(3));
+
+    assert_eq!(cache.len(), 1);
+    assert_eq!(cache.get(&key("a"), 2).expect("entry").glyphs.len(), 3);
+}
+
+#[test]
+fn test_layout_cache_remove_font() {
+    let mut cache = TextLayoutCache::new();
+    cache.insert(&key("a"), 1, layout_with_glyphs(1));
+    let mut other = key("b");
+    other.font = 9;
+    cache.insert(&other, 1, layout_with_glyphs(1));
+
+    assert_eq!(cache.remove_font(7), 1);
+    assert_eq!(cache.len(), 1);
+    assert!(cache.get(&other, 1).is_some());
+
+    cache.clear();
+    assert!(cache.is_empty());
+    assert_eq!(cache.bytes(), 0);
+}
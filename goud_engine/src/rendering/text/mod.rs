@@ -11,6 +11,8 @@
 //!    RGBA8 texture atlas with UV lookup.
 //! 3. **Atlas Cache** (`atlas_cache`) - caches generated atlases by
 //!    (font handle, pixel size) to avoid repeated rasterization.
+//! 4. **Layout Cache** (`layout_cache`) - keeps shaped layouts across frames
+//!    so unchanged labels skip shaping and line-wrapping.
 
 pub mod atlas_cache;
 pub mod bitmap_atlas;
@@ -18,6 +20,7 @@ pub mod direction;
 pub mod glyph_atlas;
 pub mod glyph_provider;
 pub mod layout;
+pub mod layout_cache;
 pub mod layout_shaped;
 pub mod rasterizer;
 pub(crate) mod shader;
@@ -33,6 +36,9 @@ pub use glyph_provider::GlyphInfoProvider;
 pub use layout::{
     layout_text, LayoutGlyph, TextAlignment, TextBoundingBox, TextLayoutConfig, TextLayoutResult,
 };
+pub use layout_cache::{
+    TextLayoutCache, TextLayoutCacheStats, TextLayoutKey, DEFAULT_LAYOUT_CACHE_BUDGET,
+};
 pub use layout_shaped::{
     layout_shaped_text, layout_text_shaped, shape_text, ShapedLine, ShapedText,
 };
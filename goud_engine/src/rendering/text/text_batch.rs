@@ -4,7 +4,7 @@
 //! text layout engine, and renders them as textured quads grouped by
 //! atlas texture to minimise draw calls.
 
-use crate::assets::{loaders::BitmapFontAsset, loaders::FontAsset, AssetServer};
+use crate::assets::{loaders::BitmapFontAsset, AssetServer};
 use crate::core::math::{Color, Vec2};
 use crate::ecs::components::{Text, Transform2D};
 use crate::ecs::query::Query;
@@ -19,10 +19,12 @@ use super::atlas_cache::GlyphAtlasCache;
 use super::bitmap_atlas::BitmapGlyphAtlas;
 use super::glyph_atlas::UvRect;
 use super::layout::{layout_text, TextLayoutConfig};
+use super::layout_cache::TextLayoutCache;
 use super::shader;
-use super::{layout_shaped_text, shape_text, TextDirection};
 pub use crate::rendering::text::text_batch_requests::DirectTextDrawRequest;
 
+#[path = "text_batch_truetype.rs"]
+mod truetype;
 #[path = "text_batch_upload.rs"]
 mod upload;
 
@@ -58,6 +60,8 @@ pub struct TextRenderStats {
 pub struct TextBatch {
     /// Cached TrueType glyph atlases keyed by (font_handle, size).
     atlas_cache: GlyphAtlasCache,
+    /// Shaped TrueType layouts reused across frames.
+    layout_cache: TextLayoutCache,
     /// Cached bitmap font atlases keyed by asset handle index.
     ///
     /// Unlike `atlas_cache` (TrueType), bitmap atlases do not yet support
@@ -89,6 +93,7 @@ impl TextBatch {
     pub fn new() -> Self {
         Self {
             atlas_cache: GlyphAtlasCache::new(),
+            layout_cache: TextLayoutCache::new(),
             bitmap_atlas_cache: std::collections::HashMap::new(),
             vertices: Vec::with_capacity(1024),
             indices: Vec::with_capacity(1536),
@@ -160,34 +165,30 @@ impl TextBatch {
             alignment: text.alignment,
         };
 
-        let (layout, gpu_texture) = if let Some(bitmap_handle) = text.bitmap_font_handle.as_ref() {
-            self.resolve_bitmap_font(
+        if let Some(bitmap_handle) = text.bitmap_font_handle.as_ref() {
+            let (layout, gpu_texture) = self.resolve_bitmap_font(
                 &text.content,
                 text.font_size,
                 &config,
                 bitmap_handle,
                 asset_server,
                 backend,
-            )?
-        } else {
-            match self.resolve_truetype_font(
-                &text.content,
-                text.font_size,
-                &config,
-                &text.font_handle,
-                asset_server,
-                backend,
-            )? {
-                Some(result) => result,
-                None => return Ok(()),
+            )?;
+            if !layout.glyphs.is_empty() {
+                self.append_glyph_batch(&layout, text.color, transform, gpu_texture);
+            }
+        } else if let Some((layout, gpu_texture)) = self.resolve_truetype_font(
+            &text.content,
+            text.font_size,
+            &config,
+            &text.font_handle,
+            asset_server,
+            backend,
+        )? {
+            if !layout.glyphs.is_empty() {
+                self.append_glyph_batch(&layout, text.color, transform, gpu_texture);
             }
-        };
-
-        if layout.glyphs.is_empty() {
-            return Ok(());
         }
-
-        self.append_glyph_batch(&layout, text.color, transform, gpu_texture);
         Ok(())
     }
 
@@ -231,38 +232,6 @@ impl TextBatch {
         Ok((layout, tex))
     }
 
-    /// Resolves a TrueType font, builds/caches its atlas, and returns layout
-    /// and GPU texture handle. Returns `None` if the font handle is invalid.
-    pub(crate) fn resolve_truetype_font(
-        &mut self,
-        content: &str,
-        font_size: f32,
-        config: &TextLayoutConfig,
-        font_handle: &crate::assets::AssetHandle<FontAsset>,
-        asset_server: &AssetServer,
-        backend: &mut dyn RenderBackend,
-    ) -> Result<Option<(super::layout::TextLayoutResult, TextureHandle)>, String> {
-        if !font_handle.is_valid() {
-            return Ok(None);
-        }
-
-        let font_asset = asset_server
-            .get::<FontAsset>(font_handle)
-            .ok_or_else(|| format!("font asset not found for handle {:?}", font_handle))?;
-
-        let parsed_font = font_asset.parse()?;
-        let atlas = self
-            .atlas_cache
-            .get_or_create_mut(font_asset, *font_handle, font_size)?;
-
-        let shaped = shape_text(content, font_asset.data(), font_size, TextDirection::Auto)?;
-        atlas.ensure_glyph_indices(&parsed_font, shaped.glyph_indices())?;
-
-        let layout = layout_shaped_text(&shaped, atlas, font_size, config);
-        let tex = atlas.ensure_gpu_texture(backend)?;
-        Ok(Some((layout, tex)))
-    }
-
     /// Emits glyph quads for a layout and appends or merges a draw batch.
     pub(crate) fn append_glyph_batch(
         &mut self,
@@ -417,6 +386,16 @@ impl TextBatch {
         &self.atlas_cache
     }
 
+    /// Returns the shaped layout cache.
+    pub fn layout_cache(&self) -> &TextLayoutCache {
+        &self.layout_cache
+    }
+
+    /// Returns the shaped layout cache for budget changes and invalidation.
+    pub fn layout_cache_mut(&mut self) -> &mut TextLayoutCache {
+        &mut self.layout_cache
+    }
+
     /// Removes all cached bitmap font atlases.
     ///
     /// This is the manual invalidation path for bitmap fonts. Unlike the
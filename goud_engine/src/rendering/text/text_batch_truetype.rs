@@ -0,0 +1,60 @@
+use std::sync::Arc;
+
+use crate::assets::{loaders::FontAsset, AssetHandle, AssetServer};
+use crate::libs::graphics::backend::render_backend::RenderBackend;
+use crate::libs::graphics::backend::types::TextureHandle;
+use crate::rendering::text::layout::{TextLayoutConfig, TextLayoutResult};
+use crate::rendering::text::layout_cache::TextLayoutKey;
+use crate::rendering::text::{layout_shaped_text, shape_text, TextDirection};
+
+use super::TextBatch;
+
+impl TextBatch {
+    /// Resolves a TrueType font, builds/caches its atlas, and returns layout
+    /// and GPU texture handle. Returns `None` if the font handle is invalid.
+    ///
+    /// Layouts come from the layout cache when the same text was laid out
+    /// with the same parameters against the current atlas.
+    pub(crate) fn resolve_truetype_font(
+        &mut self,
+        content: &str,
+        font_size: f32,
+        config: &TextLayoutConfig,
+        font_handle: &AssetHandle<FontAsset>,
+        asset_server: &AssetServer,
+        backend: &mut dyn RenderBackend,
+    ) -> Result<Option<(Arc<TextLayoutResult>, TextureHandle)>, String> {
+        if !font_handle.is_valid() {
+            return Ok(None);
+        }
+
+        let font_asset = asset_server
+            .get::<FontAsset>(font_handle)
+            .ok_or_else(|| format!("font asset not found for handle {:?}", font_handle))?;
+
+        let atlas = self
+            .atlas_cache
+            .get_or_create_mut(font_asset, *font_handle, font_size)?;
+        let key = TextLayoutKey::new(
+            font_handle.to_u64(),
+            font_size,
+            content,
+            config,
+            TextDirection::Auto,
+        );
+
+        let layout = match self.layout_cache.get(&key, atlas.version()) {
+            Some(layout) => layout,
+            None => {
+                let parsed_font = font_asset.parse()?;
+                let shaped =
+                    shape_text(content, font_asset.data(), font_size, TextDirection::Auto)?;
+                atlas.ensure_glyph_indices(&parsed_font, shaped.glyph_indices())?;
+                let layout = layout_shaped_text(&shaped, atlas, font_size, config);
+                self.layout_cache.insert(&key, atlas.version(), layout)
+            }
+        };
+        let tex = atlas.ensure_gpu_texture(backend)?;
+        Ok(Some((layout, tex)))
+    }
+}
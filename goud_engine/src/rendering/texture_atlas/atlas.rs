@@ -10,7 +10,7 @@ use crate::libs::graphics::backend::types::{
     TextureFilter, TextureFormat, TextureHandle, TextureWrap,
 };
 
-use super::packer::{PackedRect, ShelfPacker};
+use super::packer::{PackedRect, SkylinePacker};
 use super::stats::AtlasStats;
 
 /// 1-pixel padding between packed textures to prevent bleeding.
@@ -63,8 +63,8 @@ pub struct TextureAtlas {
     height: u32,
     /// Category label (e.g. "terrain", "entities").
     category: String,
-    /// Shelf packer for incremental rectangle placement.
-    packer: ShelfPacker,
+    /// Skyline packer for incremental rectangle placement.
+    packer: SkylinePacker,
     /// Per-texture metadata, keyed by string identifier.
     entries: HashMap<String, PackedTextureInfo>,
     /// Cached GPU texture handle, lazily uploaded.
@@ -99,7 +99,7 @@ impl TextureAtlas {
             width: w,
             height: h,
             category: category.to_string(),
-            packer: ShelfPacker::new(w, h, ATLAS_PADDING),
+            packer: SkylinePacker::new(w, h, ATLAS_PADDING),
             entries: HashMap::new(),
             gpu_texture: None,
             dirty: false,
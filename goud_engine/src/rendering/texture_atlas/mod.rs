@@ -8,5 +8,5 @@ mod packer;
 mod stats;
 
 pub use atlas::{AtlasUvRect, PackedTextureInfo, TextureAtlas, DEFAULT_MAX_ATLAS_SIZE};
-pub use packer::{PackedRect, ShelfPacker};
+pub use packer::{PackedRect, ShelfPacker, SkylinePacker};
 pub use stats::AtlasStats;
@@ -1,8 +1,10 @@
-//! Shelf-based rectangle packing algorithm for texture atlases.
+//! Rectangle packing algorithms for texture atlases.
 //!
-//! Packs rectangles into rows (shelves). Each shelf is as tall as its
-//! tallest member. For best results, sort inputs by height (tallest first)
-//! before packing.
+//! [`ShelfPacker`] packs rectangles into rows (shelves); each shelf is as
+//! tall as its tallest member. [`SkylinePacker`] tracks the top edge of the
+//! packed area and drops each rectangle at the lowest position it fits,
+//! which wastes far less space when heights vary. For best results with
+//! either packer, sort inputs by height (tallest first) before packing.
 
 /// A rectangle placement result within the atlas.
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
@@ -116,6 +118,163 @@ impl ShelfPacker {
     }
 }
 
+/// One horizontal segment of the skyline: the packed area's top edge.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+struct SkylineNode {
+    x: u32,
+    y: u32,
+    width: u32,
+}
+
+/// Bottom-left skyline rectangle packer.
+///
+/// Keeps the packed area's top edge as a list of segments ordered by x and
+/// places each rectangle where its top ends lowest, breaking ties by the
+/// smaller wasted width. Gaps left under overhangs are not reused.
+#[derive(Debug, Clone)]
+pub struct SkylinePacker {
+    atlas_width: u32,
+    atlas_height: u32,
+    /// Padding between packed rectangles (pixels).
+    padding: u32,
+    /// Skyline segments, sorted by x and covering the full atlas width.
+    nodes: Vec<SkylineNode>,
+    /// Cumulative pixel area consumed by packed rectangles (excluding padding).
+    used_area: u64,
+}
+
+impl SkylinePacker {
+    /// Creates a new packer for an atlas of the given dimensions.
+    pub fn new(width: u32, height: u32, padding: u32) -> Self {
+        Self {
+            atlas_width: width,
+            atlas_height: height,
+            padding,
+            nodes: vec![SkylineNode { x: 0, y: 0, width }],
+            used_area: 0,
+        }
+    }
+
+    /// Attempts to pack a rectangle of `width x height` pixels.
+    ///
+    /// Returns the placement if successful, or `None` if the rectangle
+    /// does not fit in the remaining atlas space.
+    pub fn pack(&mut self, width: u32, height: u32) -> Option<PackedRect> {
+        if width == 0 || height == 0 {
+            return None;
+        }
+        if width > self.atlas_width || height > self.atlas_height {
+            return None;
+        }
+
+        // (node index, y, top edge, segment width) of the best candidate.
+        let mut best: Option<(usize, u32, u32, u32)> = None;
+        for index in 0..self.nodes.len() {
+            let Some(y) = self.fit(index, width, height) else {
+                continue;
+            };
+            let top = y + height;
+            let node_width = self.nodes[index].width;
+            let better = match best {
+                None => true,
+                Some((_, _, best_top, best_width)) => {
+                    top < best_top || (top == best_top && node_width < best_width)
+                }
+            };
+            if better {
+                best = Some((index, y, top, node_width));
+            }
+        }
+
+        let (index, y, _, _) = best?;
+        let x = self.nodes[index].x;
+        self.insert(index, x, y, width, height);
+        self.used_area += u64::from(width) * u64::from(height);
+
+        Some(PackedRect {
+            x,
+            y,
+            width,
+            height,
+        })
+    }
+
+    /// Total pixel area consumed by packed rectangles (excludes padding).
+    pub fn used_area(&self) -> u64 {
+        self.used_area
+    }
+
+    /// Total pixel area of the atlas.
+    pub fn total_area(&self) -> u64 {
+        u64::from(self.atlas_width) * u64::from(self.atlas_height)
+    }
+
+    /// Returns the y at which a rectangle starting at node `index` would
+    /// rest, or `None` if it would cross the atlas's right or bottom edge.
+    fn fit(&self, index: usize, width: u32, height: u32) -> Option<u32> {
+        let x = self.nodes[index].x;
+        if x + width > self.atlas_width {
+            return None;
+        }
+
+        let mut y = 0;
+        let mut remaining = width;
+        for node in &self.nodes[index..] {
+            y = y.max(node.y);
+            if y + height > self.atlas_height {
+                return None;
+            }
+            if node.width >= remaining {
+                return Some(y);
+            }
+            remaining -= node.width;
+        }
+        None
+    }
+
+    /// Raises the skyline over a rectangle placed at (`x`, `y`) on node
+    /// `index`. The padding is added to the raised segment so neighbours
+    /// keep their distance, clamped to the atlas edge.
+    fn insert(&mut self, index: usize, x: u32, y: u32, width: u32, height: u32) {
+        let padded_width = (width + self.padding).min(self.atlas_width - x);
+        let raised = SkylineNode {
+            x,
+            y: y + height + self.padding,
+            width: padded_width,
+        };
+        self.nodes.insert(index, raised);
+
+        // Trim or drop the segments now covered by the raised one.
+        let right = x + padded_width;
+        let next = index + 1;
+        while next < self.nodes.len() {
+            let node = self.nodes[next];
+            if node.x >= right {
+                break;
+            }
+            let node_right = node.x + node.width;
+            if node_right <= right {
+                self.nodes.remove(next);
+            } else {
+                self.nodes[next].x = right;
+                self.nodes[next].width = node_right - right;
+                break;
+            }
+        }
+
+        // Merge neighbouring segments that ended up at the same height.
+        let mut i = 0;
+        while i + 1 < self.nodes.len() {
+            if self.nodes[i].y == self.nodes[i + 1].y {
+                self.nodes[i].width += self.nodes[i + 1].width;
+                self.nodes.remove(i + 1);
+            } else {
+                i += 1;
+            }
+        }
+    }
+}
+
 #[cfg(test)]
 mod tests {
     use super::*;
@@ -215,4 +374,98 @@ mod tests {
         let c = p.pack(128, 10).unwrap();
         assert_eq!(c.y, 21);
     }
+
+    #[test]
+    fn test_skyline_single_rect_fits() {
+        let mut p = SkylinePacker::new(128, 128, 1);
+        let r = p.pack(32, 32).unwrap();
+        assert_eq!(
+            r,
+            PackedRect {
+                x: 0,
+                y: 0,
+                width: 32,
+                height: 32
+            }
+        );
+    }
+
+    #[test]
+    fn test_skyline_two_rects_same_row() {
+        let mut p = SkylinePacker::new(128, 128, 1);
+        let a = p.pack(32, 32).unwrap();
+        let b = p.pack(32, 32).unwrap();
+        assert_eq!((a.x, a.y), (0, 0));
+        assert_eq!((b.x, b.y), (33, 0));
+    }
+
+    #[test]
+    fn test_skyline_exact_fit() {
+        let mut p = SkylinePacker::new(64, 64, 0);
+        assert!(p.pack(64, 64).is_some());
+        assert!(p.pack(1, 1).is_none());
+    }
+
+    #[test]
+    fn test_skyline_rejects_oversized_and_empty() {
+        let mut p = SkylinePacker::new(64, 64, 0);
+        assert!(p.pack(65, 32).is_none());
+        assert!(p.pack(32, 65).is_none());
+        assert!(p.pack(0, 32).is_none());
+        assert!(p.pack(32, 0).is_none());
+    }
+
+    #[test]
+    fn test_skyline_fills_gap_beside_short_rect() {
+        // A shelf packer would start a new row at y = 40 for the third
+        // rect; the skyline drops it onto the short rect instead.
+        let mut p = SkylinePacker::new(64, 128, 0);
+        p.pack(32, 40).unwrap();
+        p.pack(32, 10).unwrap();
+        let c = p.pack(32, 20).unwrap();
+        assert_eq!((c.x, c.y), (32, 10));
+    }
+
+    #[test]
+    fn test_skyline_packs_more_than_shelf() {
+        // Mixed heights: one tall column followed by many short tiles.
+        let mut shelf = ShelfPacker::new(64, 64, 0);
+        let mut skyline = SkylinePacker::new(64, 64, 0);
+        let sizes = [(16, 64), (16, 16), (16, 16), (16, 16), (16, 16)];
+        let mut shelf_count = 0;
+        let mut skyline_count = 0;
+        for _ in 0..4 {
+            for &(w, h) in &sizes {
+                shelf_count += usize::from(shelf.pack(w, h).is_some());
+                skyline_count += usize::from(skyline.pack(w, h).is_some());
+            }
+        }
+        assert!(skyline_count > shelf_count);
+    }
+
+    #[test]
+    fn test_skyline_rects_do_not_overlap() {
+        let mut p = SkylinePacker::new(256, 256, 1);
+        let mut placed: Vec<PackedRect> = Vec::new();
+        for i in 0..200u32 {
+            let w = 4 + (i * 7) % 29;
+            let h = 4 + (i * 13) % 23;
+            if let Some(r) = p.pack(w, h) {
+                assert!(r.x + r.width <= 256 && r.y + r.height <= 256);
+                for other in &placed {
+                    let apart = r.x + r.width <= other.x
+                        || other.x + other.width <= r.x
+                        || r.y + r.height <= other.y
+                        || other.y + other.height <= r.y;
+                    assert!(apart, "{r:?} overlaps {other:?}");
+                }
+                placed.push(r);
+            }
+        }
+        let area: u64 = placed
+            .iter()
+            .map(|r| u64::from(r.width) * u64::from(r.height))
+            .sum();
+        assert_eq!(p.used_area(), area);
+    }
 }
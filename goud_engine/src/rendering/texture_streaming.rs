@@ -0,0 +1,486 @@
+//! GPU texture streaming under a residency budget.
+//!
+//! Loading a texture normally uploads every pixel at once and keeps it
+//! resident until the texture is destroyed.  [`TextureStreamer`] instead
+//! uploads a small base tier first (at most [`STREAMING_BASE_SIZE`] pixels on
+//! the longer edge) and keeps only the encoded image in system memory.  Draw
+//! paths report how many screen pixels each streamed texture covers through
+//! [`TextureStreamer::note_draw`]; once per frame [`TextureStreamer::update`]
+//! starts decoding a finer tier of the textures that are drawn larger than
+//! their resident one, uploads the tiers whose decode has finished, and
+//! returns least-recently-drawn textures to their base tier whenever the
+//! resident bytes would exceed the budget.  Decoding runs on the rayon pool,
+//! so the frame calling `update` only pays for the uploads.
+//!
+//! Tier `n` halves each dimension `n` times, like a mip level.  A streamed
+//! texture is created at its base tier with its full size recorded through
+//! [`TextureOps::set_texture_logical_size`], and tiers are swapped with
+//! [`TextureOps::resize_texture_storage`], so it keeps its handle and reports
+//! its full size from `texture_size`; pixel-space source rectangles and UVs
+//! never change as tiers do.
+
+use std::sync::mpsc::{self, Receiver, Sender};
+use std::sync::Arc;
+
+use rustc_hash::FxHashMap;
+
+use crate::core::error::GoudResult;
+use crate::libs::graphics::backend::types::{
+    TextureFilter, TextureFormat, TextureHandle, TextureWrap,
+};
+use crate::libs::graphics::backend::TextureOps;
+
+#[path = "texture_streaming_decode.rs"]
+mod decode;
+
+use decode::{decode, downscale, spawn_decode, DecodedTier};
+
+/// Default residency budget: 256 MiB of RGBA8 texels.
+pub const DEFAULT_STREAMING_BUDGET: usize = 256 * 1024 * 1024;
+
+/// Longest edge, in pixels, of the tier uploaded when a texture is loaded.
+pub const STREAMING_BASE_SIZE: u32 = 64;
+
+/// Tier decodes in flight at once, which also bounds the uploads any single
+/// [`TextureStreamer::update`] performs.
+pub const MAX_UPGRADES_PER_UPDATE: usize = 4;
+
+/// Counters describing streaming residency.
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct TextureStreamingStats {
+    /// Streamed textures currently loaded.
+    pub textures: u64,
+    /// Bytes of texel storage currently resident on the GPU.
+    pub resident_bytes: u64,
+    /// Bytes the same textures would occupy fully resident.
+    pub full_bytes: u64,
+    /// Configured residency budget in bytes.
+    pub budget_bytes: u64,
+    /// Textures uploaded at a finer tier since creation.
+    pub upgrades: u64,
+    /// Textures returned to their base tier to stay within the budget.
+    pub evictions: u64,
+}
+
+struct StreamedTexture {
+    /// Encoded image (PNG, JPEG, ...), decoded again for every upgrade.
+    source: Arc<[u8]>,
+    width: u32,
+    height: u32,
+    base_level: u32,
+    /// RGBA8 pixels of the base tier, kept so eviction never decodes.
+    base_pixels: Vec<u8>,
+    resident_level: u32,
+    /// Finest tier requested since the last update.
+    wanted_level: u32,
+    /// Tier being decoded, whose extra bytes are reserved in the budget.
+    pending_level: Option<u32>,
+    last_used: u64,
+}
+
+fn level_size(width: u32, height: u32, level: u32) -> (u32, u32) {
+    ((width >> level).max(1), (height >> level).max(1))
+}
+
+fn level_bytes(width: u32, height: u32, level: u32) -> usize {
+    let (w, h) = level_size(width, height, level);
+    w as usize * h as usize * 4
+}
+
+impl StreamedTexture {
+    fn level_size(&self, level: u32) -> (u32, u32) {
+        level_size(self.width, self.height, level)
+    }
+
+    fn level_bytes(&self, level: u32) -> usize {
+        level_bytes(self.width, self.height, level)
+    }
+
+    fn resident_bytes(&self) -> usize {
+        self.level_bytes(self.resident_level)
+    }
+
+    /// Bytes the pending tier adds on top of the resident one.
+    fn reserved_bytes(&self) -> usize {
+        self.pending_level.map_or(0, |level| {
+            self.level_bytes(level)
+                .saturating_sub(self.resident_bytes())
+        })
+    }
+
+    fn level_for_coverage(&self, screen_width: f32, screen_height: f32) -> u32 {
+        let scale = (screen_width / self.width as f32).max(screen_height / self.height as f32);
+        if !scale.is_finite() || scale >= 1.0 {
+            return 0;
+        }
+        if scale <= 0.0 {
+            return self.base_level;
+        }
+        ((1.0 / scale).log2().floor() as u32).min(self.base_level)
+    }
+}
+
+fn base_level(width: u32, height: u32) -> u32 {
+    let mut level = 0;
+    while (width.max(height) >> level) > STREAMING_BASE_SIZE {
+        level += 1;
+    }
+    level
+}
+
+/// Streams textures between resolution tiers under a GPU byte budget.
+pub struct TextureStreamer {
+    entries: FxHashMap<TextureHandle, StreamedTexture>,
+    budget: usize,
+    resident_bytes: usize,
+    /// Bytes reserved for tiers still being decoded.
+    reserved_bytes: usize,
+    in_flight: usize,
+    decoded_tx: Sender<DecodedTier>,
+    decoded_rx: Receiver<DecodedTier>,
+    frame: u64,
+    upgrades: u64,
+    evictions: u64,
+}
+
+impl Default for TextureStreamer {
+    fn default() -> Self {
+        Self::new(DEFAULT_STREAMING_BUDGET)
+    }
+}
+
+impl TextureStreamer {
+    /// Creates a streamer that keeps resident texels within `budget` bytes.
+    pub fn new(budget: usize) -> Self {
+        let (decoded_tx, decoded_rx) = mpsc::channel();
+        Self {
+            entries: FxHashMap::default(),
+            budget,
+            resident_bytes: 0,
+            reserved_bytes: 0,
+            in_flight: 0,
+            decoded_tx,
+            decoded_rx,
+            frame: 0,
+            upgrades: 0,
+            evictions: 0,
+        }
+    }
+
+    /// Sets the residency budget; the next [`update`](Self::update) evicts
+    /// until the resident bytes fit.
+    pub fn set_budget(&mut self, budget: usize) {
+        self.budget = budget;
+    }
+
+    /// Returns the number of resident texel bytes.
+    pub fn resident_bytes(&self) -> usize {
+        self.resident_bytes
+    }
+
+    /// Returns the number of tier decodes not yet uploaded.
+    pub fn upgrades_in_flight(&self) -> usize {
+        self.in_flight
+    }
+
+    /// Returns `true` if `handle` was loaded through this streamer.
+    pub fn contains(&self, handle: TextureHandle) -> bool {
+        self.entries.contains_key(&handle)
+    }
+
+    /// Returns the storage size currently resident for `handle`.
+    pub fn resident_size(&self, handle: TextureHandle) -> Option<(u32, u32)> {
+        self.entries
+            .get(&handle)
+            .map(|entry| entry.level_size(entry.resident_level))
+    }
+
+    /// Decodes an encoded image and uploads its base tier.
+    ///
+    /// The texture is created at the base tier's size and its full size is
+    /// recorded as the logical size, so `texture_size` reports the full size
+    /// from the start without full-size storage ever being allocated.
+    pub fn load<B: TextureOps + ?Sized>(
+        &mut self,
+        backend: &mut B,
+        source: Arc<[u8]>,
+    ) -> GoudResult<TextureHandle> {
+        let image = decode(&source)?;
+        let (width, height) = image.dimensions();
+        let base_level = base_level(width, height);
+        let mut entry = StreamedTexture {
+            source,
+            width,
+            height,
+            base_level,
+            base_pixels: Vec::new(),
+            resident_level: base_level,
+            wanted_level: base_level,
+            pending_level: None,
+            last_used: self.frame,
+        };
+        let (base_width, base_height) = entry.level_size(base_level);
+        entry.base_pixels = downscale(&image, base_width, base_height);
+        drop(image);
+
+        let handle = backend.create_texture(
+            base_width,
+            base_height,
+            TextureFormat::RGBA8,
+            TextureFilter::Linear,
+            TextureWrap::ClampToEdge,
+            &entry.base_pixels,
+        )?;
+        if let Err(e) = backend.set_texture_logical_size(handle, width, height) {
+            backend.destroy_texture(handle);
+            return Err(e);
+        }
+        self.resident_bytes += entry.resident_bytes();
+        self.entries.insert(handle, entry);
+        Ok(handle)
+    }
+
+    /// Records that `handle` was drawn covering `screen_width` by
+    /// `screen_height` pixels with its full image.
+    ///
+    /// Callers drawing a sub-rectangle scale the coverage up by the fraction
+    /// of the texture the rectangle spans.  Handles that were not streamed
+    /// are ignored.
+    pub fn note_draw(&mut self, handle: TextureHandle, screen_width: f32, screen_height: f32) {
+        let frame = self.frame;
+        if let Some(entry) = self.entries.get_mut(&handle) {
+            let level = entry.level_for_coverage(screen_width, screen_height);
+            entry.wanted_level = entry.wanted_level.min(level);
+            entry.last_used = frame;
+        }
+    }
+
+    /// Applies the tier changes requested since the last call and advances
+    /// the streamer's frame counter.
+    ///
+    /// The most recently drawn textures that want a finer tier start
+    /// decoding the finest one that fits the budget after evicting textures
+    /// not drawn this frame, up to [`MAX_UPGRADES_PER_UPDATE`] decodes in
+    /// flight.  Tiers whose decode has finished are then uploaded; the rest
+    /// are uploaded by a later call.  A texture whose image fails to decode
+    /// stays at its current tier and the first such error is returned once
+    /// the remaining work is done.
+    pub fn update<B: TextureOps + ?Sized>(&mut self, backend: &mut B) -> GoudResult<()> {
+        while self.committed_bytes() > self.budget {
+            if !self.evict_lru(backend, None, None) {
+                break;
+            }
+        }
+
+        let mut candidates: Vec<(TextureHandle, u64)> = self
+            .entries
+            .iter()
+            .filter(|(_, e)| e.wanted_level < e.resident_level && e.pending_level.is_none())
+            .map(|(handle, e)| (*handle, e.last_used))
+            .collect();
+        candidates.sort_unstable_by(|a, b| b.1.cmp(&a.1));
+        let slots = MAX_UPGRADES_PER_UPDATE.saturating_sub(self.in_flight);
+        for (handle, _) in candidates.into_iter().take(slots) {
+            self.request_upgrade(backend, handle);
+        }
+
+        let mut result = Ok(());
+        while let Ok(tier) = self.decoded_rx.try_recv() {
+            if let Err(e) = self.apply_tier(backend, tier) {
+                if result.is_ok() {
+                    result = Err(e);
+                }
+            }
+        }
+
+        for entry in self.entries.values_mut() {
+            entry.wanted_level = entry.base_level;
+        }
+        self.frame += 1;
+        result
+    }
+
+    /// Blocks until every tier being decoded has finished and uploads them.
+    ///
+    /// Returns the first decode or upload error, like [`update`](Self::update).
+    pub fn flush<B: TextureOps + ?Sized>(&mut self, backend: &mut B) -> GoudResult<()> {
+        let mut result = Ok(());
+        while self.in_flight > 0 {
+            // The streamer holds a sender, so the channel never disconnects.
+            let Ok(tier) = self.decoded_rx.recv() else {
+                break;
+            };
+            if let Err(e) = self.apply_tier(backend, tier) {
+                if result.is_ok() {
+                    result = Err(e);
+                }
+            }
+        }
+        result
+    }
+
+    /// Resident bytes plus the bytes reserved for pending tiers.
+    fn committed_bytes(&self) -> usize {
+        self.resident_bytes + self.reserved_bytes
+    }
+
+    /// Reserves budget for the finest wanted tier of `handle` that fits and
+    /// starts decoding it.
+    fn request_upgrade<B: TextureOps + ?Sized>(&mut self, backend: &mut B, handle: TextureHandle) {
+        let Some(entry) = self.entries.get(&handle) else {
+            return;
+        };
+        let (width, height) = (entry.width, entry.height);
+        let (resident_level, wanted) = (entry.resident_level, entry.wanted_level);
+        let current_bytes = entry.resident_bytes();
+        let budget = self.budget;
+        let fits = |committed: usize, level: u32| {
+            committed - current_bytes + level_bytes(width, height, level) <= budget
+        };
+
+        // Make room for the wanted tier by evicting textures not drawn this
+        // frame, then settle for the finest tier that fits.
+        while !fits(self.committed_bytes(), wanted)
+            && self.evict_lru(backend, Some(self.frame), Some(handle))
+        {}
+        let mut level = wanted;
+        while level < resident_level && !fits(self.committed_bytes(), level) {
+            level += 1;
+        }
+        if level >= resident_level {
+            return;
+        }
+
+        let entry = self.entries.get_mut(&handle).expect("entry exists");
+        entry.pending_level = Some(level);
+        self.reserved_bytes += entry.reserved_bytes();
+        self.in_flight += 1;
+        spawn_decode(
+            self.decoded_tx.clone(),
+            Arc::clone(&entry.source),
+            handle,
+            level,
+            level_size(width, height, level),
+        );
+    }
+
+    /// Uploads a decoded tier and releases its reservation.
+    ///
+    /// Tiers of textures forgotten since the request are dropped, and so are
+    /// tiers that no longer fit a budget lowered in the meantime.
+    fn apply_tier<B: TextureOps + ?Sized>(
+        &mut self,
+        backend: &mut B,
+        tier: DecodedTier,
+    ) -> GoudResult<()> {
+        self.in_flight -= 1;
+        let Some(entry) = self.entries.get(&tier.handle) else {
+            return Ok(());
+        };
+        if entry.pending_level != Some(tier.level) {
+            return Ok(());
+        }
+        let reserved = entry.reserved_bytes();
+        while self.committed_bytes() > self.budget
+            && self.evict_lru(backend, Some(self.frame), Some(tier.handle))
+        {}
+        let fits = self.committed_bytes() <= self.budget;
+
+        let entry = self.entries.get_mut(&tier.handle).expect("entry exists");
+        entry.pending_level = None;
+        self.reserved_bytes -= reserved;
+        if !fits {
+            return Ok(());
+        }
+        let pixels = tier.pixels?;
+        backend.resize_texture_storage(tier.handle, tier.width, tier.height, &pixels)?;
+
+        entry.resident_level = tier.level;
+        self.resident_bytes += reserved;
+        self.upgrades += 1;
+        Ok(())
+    }
+
+    /// Returns the least-recently-drawn upgraded texture to its base tier.
+    ///
+    /// Textures drawn on frame `protect_frame` and `skip` itself are left
+    /// alone, and so are textures with a tier being decoded.  Returns
+    /// `false` when nothing could be evicted.
+    fn evict_lru<B: TextureOps + ?Sized>(
+        &mut self,
+        backend: &mut B,
+        protect_frame: Option<u64>,
+        skip: Option<TextureHandle>,
+    ) -> bool {
+        let victim = self
+            .entries
+            .iter()
+            .filter(|(handle, e)| {
+                e.resident_level < e.base_level
+                    && e.pending_level.is_none()
+                    && Some(**handle) != skip
+                    && protect_frame.map_or(true, |frame| e.last_used < frame)
+            })
+            .min_by_key(|(_, e)| e.last_used)
+            .map(|(handle, _)| *handle);
+        let Some(handle) = victim else {
+            return false;
+        };
+
+        let entry = self.entries.get_mut(&handle).expect("victim exists");
+        let (width, height) = entry.level_size(entry.base_level);
+        if backend
+            .resize_texture_storage(handle, width, height, &entry.base_pixels)
+            .is_err()
+        {
+            // The backend lost the texture; stop tracking it.
+            let entry = self.entries.remove(&handle).expect("victim exists");
+            self.resident_bytes -= entry.resident_bytes();
+            return true;
+        }
+        self.resident_bytes =
+            self.resident_bytes - entry.resident_bytes() + entry.level_bytes(entry.base_level);
+        entry.resident_level = entry.base_level;
+        self.evictions += 1;
+        true
+    }
+
+    /// Stops tracking `handle` without touching the GPU texture.
+    ///
+    /// Returns `true` if the handle was streamed.
+    pub fn forget(&mut self, handle: TextureHandle) -> bool {
+        match self.entries.remove(&handle) {
+            Some(entry) => {
+                self.resident_bytes -= entry.resident_bytes();
+                self.reserved_bytes -= entry.reserved_bytes();
+                true
+            }
+            None => false,
+        }
+    }
+
+    /// Destroys every streamed texture.
+    pub fn clear<B: TextureOps + ?Sized>(&mut self, backend: &mut B) {
+        for (handle, _) in self.entries.drain() {
+            backend.destroy_texture(handle);
+        }
+        self.resident_bytes = 0;
+        self.reserved_bytes = 0;
+    }
+
+    /// Returns residency counters.
+    pub fn stats(&self) -> TextureStreamingStats {
+        TextureStreamingStats {
+            textures: self.entries.len() as u64,
+            resident_bytes: self.resident_bytes as u64,
+            full_bytes: self.entries.values().map(|e| e.level_bytes(0) as u64).sum(),
+            budget_bytes: self.budget as u64,
+            upgrades: self.upgrades,
+            evictions: self.evictions,
+        }
+    }
+}
+
+#[cfg(test)]
+#[path = "texture_streaming_tests.rs"]
+mod tests;
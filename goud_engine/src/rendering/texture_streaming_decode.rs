@@ -0,0 +1,64 @@
+//! Tier decoding for [`TextureStreamer`](super::TextureStreamer).
+//!
+//! Decoding an encoded image and resampling it to a tier is the expensive
+//! half of an upgrade, so it runs on the rayon pool and hands the pixels
+//! back over an `mpsc` channel; the streamer uploads them on the render
+//! thread during a later `update`.
+
+use std::sync::mpsc::Sender;
+use std::sync::Arc;
+
+use image::imageops::FilterType;
+use image::RgbaImage;
+
+use crate::core::error::{GoudError, GoudResult};
+use crate::libs::graphics::backend::types::TextureHandle;
+
+/// RGBA8 pixels of one tier, decoded off the render thread.
+pub(super) struct DecodedTier {
+    pub(super) handle: TextureHandle,
+    pub(super) level: u32,
+    pub(super) width: u32,
+    pub(super) height: u32,
+    pub(super) pixels: GoudResult<Vec<u8>>,
+}
+
+pub(super) fn decode(source: &[u8]) -> GoudResult<RgbaImage> {
+    image::load_from_memory(source)
+        .map(|img| img.to_rgba8())
+        .map_err(|e| GoudError::ResourceInvalidFormat(format!("Failed to decode image: {}", e)))
+}
+
+pub(super) fn downscale(image: &RgbaImage, width: u32, height: u32) -> Vec<u8> {
+    if image.dimensions() == (width, height) {
+        return image.as_raw().clone();
+    }
+    image::imageops::resize(image, width, height, FilterType::Triangle).into_raw()
+}
+
+/// Decodes `source` at `width` x `height` and sends the result to `sender`.
+///
+/// Runs on the rayon pool on native builds and inline elsewhere; either way
+/// the result arrives through the channel.
+pub(super) fn spawn_decode(
+    sender: Sender<DecodedTier>,
+    source: Arc<[u8]>,
+    handle: TextureHandle,
+    level: u32,
+    (width, height): (u32, u32),
+) {
+    let job = move || {
+        let pixels = decode(&source).map(|image| downscale(&image, width, height));
+        let _ = sender.send(DecodedTier {
+            handle,
+            level,
+            width,
+            height,
+            pixels,
+        });
+    };
+    #[cfg(feature = "native")]
+    rayon::spawn(job);
+    #[cfg(not(feature = "native"))]
+    job();
+}
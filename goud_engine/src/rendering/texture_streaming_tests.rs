@@ -0,0 +1,192 @@
+use super::*;
+use crate::libs::graphics::backend::null::NullBackend;
+
+fn encoded_png(width: u32, height: u32) -> Arc<[u8]> {
+    let img = image::RgbaImage::from_fn(width, height, |x, y| {
+        image::Rgba([x as u8, y as u8, 7, 255])
+    });
+    let mut bytes = Vec::new();
+    img.write_to(
+        &mut std::io::Cursor::new(&mut bytes),
+        image::ImageFormat::Png,
+    )
+    .unwrap();
+    bytes.into()
+}
+
+fn bytes(width: u32, height: u32) -> usize {
+    width as usize * height as usize * 4
+}
+
+#[test]
+fn test_load_uploads_base_tier_and_keeps_full_size() {
+    let mut backend = NullBackend::new();
+    let mut streamer = TextureStreamer::default();
+    let handle = streamer.load(&mut backend, encoded_png(256, 128)).unwrap();
+
+    assert_eq!(streamer.resident_size(handle), Some((64, 32)));
+    assert_eq!(backend.texture_size(handle), Some((256, 128)));
+    let stats = streamer.stats();
+    assert_eq!(stats.textures, 1);
+    assert_eq!(stats.resident_bytes, bytes(64, 32) as u64);
+    assert_eq!(stats.full_bytes, bytes(256, 128) as u64);
+}
+
+#[test]
+fn test_small_textures_load_fully_resident() {
+    let mut backend = NullBackend::new();
+    let mut streamer = TextureStreamer::default();
+    let handle = streamer.load(&mut backend, encoded_png(48, 16)).unwrap();
+    assert_eq!(streamer.resident_size(handle), Some((48, 16)));
+}
+
+#[test]
+fn test_draw_coverage_selects_tier() {
+    let mut backend = NullBackend::new();
+    let mut streamer = TextureStreamer::default();
+    let handle = streamer.load(&mut backend, encoded_png(256, 128)).unwrap();
+
+    streamer.note_draw(handle, 100.0, 50.0);
+    streamer.update(&mut backend).unwrap();
+    streamer.flush(&mut backend).unwrap();
+    assert_eq!(streamer.resident_size(handle), Some((128, 64)));
+
+    streamer.note_draw(handle, 512.0, 256.0);
+    streamer.update(&mut backend).unwrap();
+    streamer.flush(&mut backend).unwrap();
+    assert_eq!(streamer.resident_size(handle), Some((256, 128)));
+    assert_eq!(streamer.stats().upgrades, 2);
+    assert_eq!(streamer.resident_bytes(), bytes(256, 128));
+}
+
+#[test]
+fn test_undrawn_textures_stay_resident_until_evicted() {
+    let mut backend = NullBackend::new();
+    let mut streamer = TextureStreamer::default();
+    let handle = streamer.load(&mut backend, encoded_png(256, 128)).unwrap();
+
+    streamer.note_draw(handle, 256.0, 128.0);
+    streamer.update(&mut backend).unwrap();
+    streamer.flush(&mut backend).unwrap();
+    streamer.update(&mut backend).unwrap();
+    streamer.flush(&mut backend).unwrap();
+    assert_eq!(streamer.resident_size(handle), Some((256, 128)));
+    assert_eq!(streamer.stats().evictions, 0);
+}
+
+#[test]
+fn test_budget_evicts_least_recently_drawn() {
+    let mut backend = NullBackend::new();
+    let budget = bytes(256, 256) + 2 * bytes(64, 64);
+    let mut streamer = TextureStreamer::new(budget);
+    let first = streamer.load(&mut backend, encoded_png(256, 256)).unwrap();
+    let second = streamer.load(&mut backend, encoded_png(256, 256)).unwrap();
+
+    streamer.note_draw(first, 256.0, 256.0);
+    streamer.update(&mut backend).unwrap();
+    streamer.flush(&mut backend).unwrap();
+    assert_eq!(streamer.resident_size(first), Some((256, 256)));
+
+    streamer.note_draw(second, 256.0, 256.0);
+    streamer.update(&mut backend).unwrap();
+    streamer.flush(&mut backend).unwrap();
+    assert_eq!(streamer.resident_size(first), Some((64, 64)));
+    assert_eq!(streamer.resident_size(second), Some((256, 256)));
+    assert_eq!(streamer.stats().evictions, 1);
+    assert!(streamer.resident_bytes() <= budget);
+}
+
+#[test]
+fn test_textures_drawn_this_frame_are_not_evicted() {
+    let mut backend = NullBackend::new();
+    let budget = bytes(256, 256) + 2 * bytes(64, 64);
+    let mut streamer = TextureStreamer::new(budget);
+    let first = streamer.load(&mut backend, encoded_png(256, 256)).unwrap();
+    let second = streamer.load(&mut backend, encoded_png(256, 256)).unwrap();
+
+    streamer.note_draw(first, 256.0, 256.0);
+    streamer.update(&mut backend).unwrap();
+    streamer.flush(&mut backend).unwrap();
+
+    // Both drawn large: the resident one keeps its tier and the other gets
+    // the finest tier left in the budget.
+    streamer.note_draw(first, 256.0, 256.0);
+    streamer.note_draw(second, 256.0, 256.0);
+    streamer.update(&mut backend).unwrap();
+    streamer.flush(&mut backend).unwrap();
+    assert_eq!(streamer.resident_size(first), Some((256, 256)));
+    assert_eq!(streamer.resident_size(second), Some((64, 64)));
+    assert_eq!(streamer.stats().evictions, 0);
+}
+
+#[test]
+fn test_lowering_budget_evicts_on_update() {
+    let mut backend = NullBackend::new();
+    let mut streamer = TextureStreamer::default();
+    let handle = streamer.load(&mut backend, encoded_png(256, 256)).unwrap();
+    streamer.note_draw(handle, 256.0, 256.0);
+    streamer.update(&mut backend).unwrap();
+    streamer.flush(&mut backend).unwrap();
+
+    streamer.set_budget(bytes(64, 64));
+    streamer.update(&mut backend).unwrap();
+    streamer.flush(&mut backend).unwrap();
+    assert_eq!(streamer.resident_size(handle), Some((64, 64)));
+    assert_eq!(streamer.stats().budget_bytes, bytes(64, 64) as u64);
+}
+
+#[test]
+fn test_forget_and_clear_release_residency() {
+    let mut backend = NullBackend::new();
+    let mut streamer = TextureStreamer::default();
+    let first = streamer.load(&mut backend, encoded_png(128, 128)).unwrap();
+    let second = streamer.load(&mut backend, encoded_png(128, 128)).unwrap();
+
+    assert!(streamer.forget(first));
+    assert!(!streamer.forget(first));
+    assert!(backend.is_texture_valid(first));
+    assert_eq!(streamer.resident_bytes(), bytes(64, 64));
+
+    streamer.clear(&mut backend);
+    assert!(!backend.is_texture_valid(second));
+    assert_eq!(
+        streamer.stats(),
+        TextureStreamingStats {
+            budget_bytes: DEFAULT_STREAMING_BUDGET as u64,
+            ..Default::default()
+        }
+    );
+}
+
+#[test]
+fn test_forgetting_a_texture_mid_decode() {
+    let mut backend = NullBackend::new();
+    let mut streamer = TextureStreamer::default();
+    let first = streamer.load(&mut backend, encoded_png(256, 128)).unwrap();
+    let second = streamer.load(&mut backend, encoded_png(256, 128)).unwrap();
+
+    streamer.note_draw(first, 256.0, 128.0);
+    streamer.note_draw(second, 256.0, 128.0);
+    streamer.update(&mut backend).unwrap();
+
+    // Whether or not its tier has been uploaded yet, forgetting a texture
+    // releases its residency and any reservation for the pending tier.
+    assert!(streamer.forget(first));
+    streamer.flush(&mut backend).unwrap();
+    assert_eq!(streamer.upgrades_in_flight(), 0);
+    assert_eq!(streamer.resident_size(second), Some((256, 128)));
+    assert_eq!(streamer.resident_bytes(), bytes(256, 128));
+}
+
+#[test]
+fn test_invalid_images_and_unknown_handles() {
+    let mut backend = NullBackend::new();
+    let mut streamer = TextureStreamer::default();
+    let junk: Arc<[u8]> = Arc::from(&b"not an image"[..]);
+    assert!(streamer.load(&mut backend, junk).is_err());
+
+    let unknown = TextureHandle::new(42, 1);
+    streamer.note_draw(unknown, 1024.0, 1024.0);
+    assert!(streamer.update(&mut backend).is_ok());
+    assert_eq!(streamer.stats().textures, 0);
+}
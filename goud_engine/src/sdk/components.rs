@@ -89,6 +89,7 @@ pub use crate::ecs::components::BoneTransform;
 pub use crate::ecs::components::BoneWeight;
 pub use crate::ecs::components::SkeletalAnimation;
 pub use crate::ecs::components::SkeletalAnimator;
+pub use crate::ecs::components::SkeletalLayer;
 pub use crate::ecs::components::SkeletalMesh2D;
 pub use crate::ecs::components::SkeletalVertex;
 pub use crate::ecs::components::Skeleton2D;
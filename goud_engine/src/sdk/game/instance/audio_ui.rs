@@ -4,6 +4,18 @@ use crate::ui::UiManager;
 use super::GoudGame;
 
 impl GoudGame {
+    /// Opens the default audio device, or a null sink for headless games.
+    #[cfg(feature = "native")]
+    pub(crate) fn open_audio_manager(
+        config: &crate::sdk::game_config::GameConfig,
+    ) -> Option<crate::assets::AudioManager> {
+        if config.window_backend == crate::libs::platform::WindowBackendKind::Headless {
+            crate::assets::AudioManager::new_null().ok()
+        } else {
+            crate::assets::AudioManager::new().ok()
+        }
+    }
+
     /// Returns a reference to the audio manager, if available.
     #[cfg(feature = "native")]
     #[inline]
@@ -17,6 +17,16 @@ impl GoudGame {
         GoudContextId::new(NEXT_ID.fetch_add(1, Ordering::Relaxed), 1)
     }
 
+    /// Debugger surface kind for a game built from `config`.
+    #[cfg(feature = "native")]
+    pub(crate) fn runtime_surface_kind(config: &GameConfig) -> RuntimeSurfaceKind {
+        if config.window_backend == crate::libs::platform::WindowBackendKind::Headless {
+            RuntimeSurfaceKind::HeadlessContext
+        } else {
+            RuntimeSurfaceKind::WindowedGame
+        }
+    }
+
     pub(crate) fn register_debugger_route(
         config: &GameConfig,
         surface: RuntimeSurfaceKind,
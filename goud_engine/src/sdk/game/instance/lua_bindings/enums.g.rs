@@ -165,11 +165,13 @@ pub(crate) fn register_enum_constants(lua: &Lua) -> LuaResult<()> {
     let tbl = lua.create_table()?;
     tbl.set("wgpu", 0_i64)?;
     tbl.set("open_gl_legacy", 1_i64)?;
+    tbl.set("null", 3_i64)?;
     globals.set("render_backend_kind", tbl)?;
     // WindowBackendKind
     let tbl = lua.create_table()?;
     tbl.set("winit", 0_i64)?;
     tbl.set("glfw_legacy", 1_i64)?;
+    tbl.set("headless", 5_i64)?;
     globals.set("window_backend_kind", tbl)?;
     // EasingType
     let tbl = lua.create_table()?;
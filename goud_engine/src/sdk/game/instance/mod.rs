@@ -351,9 +351,9 @@ impl GoudGame {
             compute_render_viewport(framebuffer_size, window_size, ViewportScaleMode::Stretch);
         render_viewport.scale_factor = platform_scale;
 
-        let audio_manager = crate::assets::AudioManager::new().ok();
+        let audio_manager = Self::open_audio_manager(&config);
         let debugger_route =
-            Self::register_debugger_route(&config, RuntimeSurfaceKind::WindowedGame);
+            Self::register_debugger_route(&config, Self::runtime_surface_kind(&config));
         // TODO: pass actual context ID once context registry supports it
         #[cfg(feature = "lua")]
         let lua_runtime = LuaRuntime::new(0)?;
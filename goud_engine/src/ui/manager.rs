@@ -2,13 +2,18 @@
 //!
 //! [`UiManager`] owns UI nodes, computes deterministic layout, and processes UI
 //! input semantics (hover, focus, and button activation/click dispatch).
+//!
+//! Layout is recomputed lazily.  Structural changes (creating, removing, or
+//! reparenting nodes, viewport or theme changes) dirty the whole tree, while
+//! [`UiManager::get_node_mut`] only dirties the touched node, so the next
+//! [`UiManager::update`] re-lays-out just the affected sibling groups.
 
 #[cfg(feature = "native")]
 mod input;
 mod layout;
 mod render;
 
-use std::collections::HashMap;
+use std::collections::{HashMap, HashSet};
 
 use crate::core::error::{GoudError, GoudResult};
 use crate::core::math::Rect;
@@ -44,6 +49,7 @@ pub struct UiManager {
     allocator: UiNodeAllocator,
     nodes: HashMap<UiNodeId, UiNode>,
     layout_dirty: bool,
+    dirty_nodes: HashSet<UiNodeId>,
     layout_epoch: u64,
     viewport_size: (u32, u32),
     hovered_node: Option<UiNodeId>,
@@ -60,6 +66,7 @@ impl UiManager {
             allocator: UiNodeAllocator::new(),
             nodes: HashMap::new(),
             layout_dirty: true,
+            dirty_nodes: HashSet::new(),
             layout_epoch: 0,
             viewport_size: (0, 0),
             hovered_node: None,
@@ -164,11 +171,17 @@ impl UiManager {
         self.nodes.get(&id)
     }
 
-    /// Returns a mutable reference to a node, marking layout dirty conservatively.
+    /// Returns a mutable reference to a node, marking only that node's layout dirty.
+    ///
+    /// Use [`UiManager::set_parent`] rather than the node's own hierarchy
+    /// setters to reparent, so the change is seen by the layout pass.
     #[inline]
     pub fn get_node_mut(&mut self, id: UiNodeId) -> Option<&mut UiNode> {
-        self.mark_layout_dirty();
-        self.nodes.get_mut(&id)
+        let node = self.nodes.get_mut(&id)?;
+        if !self.layout_dirty {
+            self.dirty_nodes.insert(id);
+        }
+        Some(node)
     }
 
     /// Returns IDs of all root nodes (deterministic order).
@@ -276,9 +289,26 @@ impl UiManager {
         UiInteractionState::Normal
     }
 
-    /// Marks the layout as needing recomputation on the next update.
+    /// Marks the whole layout as needing recomputation on the next update.
     pub fn mark_layout_dirty(&mut self) {
         self.layout_dirty = true;
+        self.dirty_nodes.clear();
+    }
+
+    /// Marks one node as needing layout on the next update.
+    ///
+    /// Only the node's sibling group (its parent's children, or the node
+    /// itself for a root) is laid out again.
+    pub fn mark_node_layout_dirty(&mut self, id: UiNodeId) {
+        if !self.layout_dirty && self.nodes.contains_key(&id) {
+            self.dirty_nodes.insert(id);
+        }
+    }
+
+    /// Returns true when the next update will recompute any layout.
+    #[inline]
+    pub fn needs_layout(&self) -> bool {
+        self.layout_dirty || !self.dirty_nodes.is_empty()
     }
 
     fn node_focusable(&self, node_id: UiNodeId) -> bool {
@@ -1,6 +1,8 @@
+use std::collections::HashSet;
+
 use crate::core::math::{Rect, Vec2};
 
-use super::UiManager;
+use super::{sort_node_ids, UiManager};
 use crate::ui::layout::{
     PositionMode, UiAlign, UiAnchor, UiEdges, UiFlexDirection, UiJustify, UiLayout,
 };
@@ -14,27 +16,121 @@ impl UiManager {
     }
 
     pub(super) fn recompute_layout_if_needed(&mut self) {
-        if !self.layout_dirty {
+        if !self.layout_dirty && self.dirty_nodes.is_empty() {
             return;
         }
 
-        let viewport_rect = Rect::new(
-            0.0,
-            0.0,
-            self.viewport_size.0 as f32,
-            self.viewport_size.1 as f32,
-        );
-
-        let roots = self.root_nodes();
-        for root in roots {
-            self.layout_node(root, viewport_rect);
+        // Past half the tree, one full pass is cheaper than the ancestor walks.
+        if self.layout_dirty || self.dirty_nodes.len() * 2 >= self.nodes.len() {
+            let viewport_rect = self.viewport_rect();
+            let roots = self.root_nodes();
+            for root in roots {
+                self.layout_node(root, viewport_rect);
+            }
+        } else {
+            self.layout_dirty_nodes();
         }
 
         self.layout_dirty = false;
+        self.dirty_nodes.clear();
         self.layout_epoch = self.layout_epoch.saturating_add(1);
         self.clear_stale_ui_state();
     }
 
+    /// Re-lays-out only the sibling groups that contain a dirty node.
+    ///
+    /// A node's rect depends on its parent's content rect and, under flex
+    /// layout, on its siblings, so each dirty node re-lays-out its parent's
+    /// children (or itself, for a root) from the parent's stored rect.
+    /// Groups nested inside another dirty group are skipped, as are groups
+    /// the full pass would not reach.
+    fn layout_dirty_nodes(&mut self) {
+        let mut dirty_roots = Vec::new();
+        let mut dirty_parents = HashSet::new();
+        for &id in &self.dirty_nodes {
+            match self.nodes.get(&id).map(UiNode::parent) {
+                Some(Some(parent)) => {
+                    dirty_parents.insert(parent);
+                }
+                Some(None) => dirty_roots.push(id),
+                None => {}
+            }
+        }
+        sort_node_ids(&mut dirty_roots);
+        let mut parents: Vec<_> = dirty_parents
+            .iter()
+            .copied()
+            .filter(|&id| {
+                !self.has_dirty_ancestor(id, &dirty_parents, &dirty_roots)
+                    && self.layout_reached(id)
+            })
+            .collect();
+        sort_node_ids(&mut parents);
+
+        let viewport_rect = self.viewport_rect();
+        for root in dirty_roots {
+            self.layout_node(root, viewport_rect);
+        }
+        for parent_id in parents {
+            let Some(parent) = self.nodes.get(&parent_id) else {
+                continue;
+            };
+            let content_rect = inset_rect(parent.computed_rect(), parent.padding());
+            let layout = parent.layout();
+            let children = parent.children().to_vec();
+            self.layout_children(layout, children, content_rect);
+        }
+    }
+
+    fn has_dirty_ancestor(
+        &self,
+        id: UiNodeId,
+        dirty_parents: &HashSet<UiNodeId>,
+        dirty_roots: &[UiNodeId],
+    ) -> bool {
+        let mut current = id;
+        while let Some(parent) = self.nodes.get(&current).and_then(UiNode::parent) {
+            if dirty_parents.contains(&parent) {
+                return true;
+            }
+            current = parent;
+        }
+        // `current` is the tree's root; a dirty root lays out its whole subtree.
+        dirty_roots.contains(&current)
+    }
+
+    /// Returns true when a full pass would assign `id` a rect.
+    fn layout_reached(&self, id: UiNodeId) -> bool {
+        let mut current = id;
+        loop {
+            let Some(node) = self.nodes.get(&current) else {
+                return false;
+            };
+            if !node.layout_enabled() {
+                return false;
+            }
+            let Some(parent_id) = node.parent() else {
+                return true;
+            };
+            let Some(parent) = self.nodes.get(&parent_id) else {
+                return false;
+            };
+            if matches!(parent.layout(), UiLayout::Flex(_)) && !node.visible() {
+                return false;
+            }
+            current = parent_id;
+        }
+    }
+
+    fn viewport_rect(&self) -> Rect {
+        Rect::new(
+            0.0,
+            0.0,
+            self.viewport_size.0 as f32,
+            self.viewport_size.1 as f32,
+        )
+    }
+
     fn layout_node(&mut self, node_id: UiNodeId, parent_content_rect: Rect) {
         let (node_rect, content_rect, layout, children) = {
             let node = match self.nodes.get(&node_id) {
@@ -60,6 +156,10 @@ impl UiManager {
             node_mut.set_computed_rect(node_rect);
         }
 
+        self.layout_children(layout, children, content_rect);
+    }
+
+    fn layout_children(&mut self, layout: UiLayout, children: Vec<UiNodeId>, content_rect: Rect) {
         match layout {
             UiLayout::None => {
                 for child_id in children {
@@ -190,23 +290,7 @@ impl UiManager {
                 .map(|n| n.children().to_vec())
                 .unwrap_or_default();
 
-            match child_layout {
-                UiLayout::None => {
-                    for child in child_children {
-                        self.layout_node(child, child_content);
-                    }
-                }
-                UiLayout::Flex(flex) => {
-                    self.layout_flex_children(
-                        child_children,
-                        child_content,
-                        flex.direction,
-                        flex.justify,
-                        flex.align_items,
-                        flex.spacing,
-                    );
-                }
-            }
+            self.layout_children(child_layout, child_children, child_content);
 
             cursor += axis_main_margin_before(direction, item.margin)
                 + main_size
@@ -1,4 +1,5 @@
 use super::*;
+use crate::ui::{UiLabel, UiNodeId};
 
 #[test]
 fn layout_resolves_anchor_margin_padding_and_stretch() {
@@ -261,3 +262,145 @@ fn layout_recomputes_on_tree_changes_and_window_resize() {
         Rect::new(290.0, 180.0, 10.0, 20.0),
     );
 }
+
+fn build_inventory(ui: &mut UiManager, slots: usize) -> (UiNodeId, Vec<(UiNodeId, UiNodeId)>) {
+    let root = ui.create_node(Some(UiComponent::Panel));
+    {
+        let node = ui.get_node_mut(root).unwrap();
+        node.set_anchor(UiAnchor::Stretch);
+        node.set_padding(UiEdges::all(4.0));
+        node.set_layout(UiLayout::Flex(UiFlexLayout {
+            direction: UiFlexDirection::Row,
+            justify: UiJustify::Start,
+            align_items: UiAlign::Start,
+            spacing: 2.0,
+        }));
+    }
+
+    let mut items = Vec::new();
+    for _ in 0..slots {
+        let slot = ui.create_node(Some(UiComponent::Panel));
+        let label = ui.create_node(Some(UiComponent::Label(UiLabel::new("0"))));
+        ui.set_parent(slot, Some(root)).unwrap();
+        ui.set_parent(label, Some(slot)).unwrap();
+        ui.get_node_mut(slot)
+            .unwrap()
+            .set_size(Vec2::new(32.0, 32.0));
+        {
+            let node = ui.get_node_mut(label).unwrap();
+            node.set_anchor(UiAnchor::Center);
+            node.set_size(Vec2::new(16.0, 8.0));
+        }
+        items.push((slot, label));
+    }
+    ui.set_viewport_size(800, 600);
+    ui.update();
+    (root, items)
+}
+
+fn assert_matches_full_layout(ui: &mut UiManager) {
+    let ids: Vec<_> = ui
+        .root_nodes()
+        .into_iter()
+        .flat_map(|root| {
+            let mut stack = vec![root];
+            let mut out = Vec::new();
+            while let Some(id) = stack.pop() {
+                out.push(id);
+                stack.extend_from_slice(ui.get_node(id).unwrap().children());
+            }
+            out
+        })
+        .collect();
+    let partial: Vec<_> = ids
+        .iter()
+        .map(|&id| ui.computed_rect(id).unwrap())
+        .collect();
+    ui.mark_layout_dirty();
+    ui.update();
+    for (id, rect) in ids.iter().zip(partial) {
+        assert_rect_eq(rect, ui.computed_rect(*id).unwrap());
+    }
+}
+
+#[test]
+fn layout_node_mutation_only_dirties_that_node() {
+    let mut ui = UiManager::new();
+    let (_, items) = build_inventory(&mut ui, 8);
+    assert!(!ui.needs_layout());
+    let epoch = ui.layout_epoch();
+
+    let label = items[3].1;
+    ui.get_node_mut(label)
+        .unwrap()
+        .set_component(Some(UiComponent::Label(UiLabel::new("12"))));
+    assert!(ui.needs_layout());
+    ui.update();
+    assert!(!ui.needs_layout());
+    assert_eq!(ui.layout_epoch(), epoch + 1);
+
+    ui.update();
+    assert_eq!(ui.layout_epoch(), epoch + 1);
+}
+
+#[test]
+fn layout_partial_pass_matches_full_pass() {
+    let mut ui = UiManager::new();
+    let (root, items) = build_inventory(&mut ui, 8);
+
+    // Growing one slot shifts its later siblings and recenters its label.
+    ui.get_node_mut(items[2].0)
+        .unwrap()
+        .set_size(Vec2::new(64.0, 48.0));
+    ui.get_node_mut(items[6].1)
+        .unwrap()
+        .set_size(Vec2::new(20.0, 10.0));
+    ui.update();
+    assert_rect_eq(
+        ui.computed_rect(items[3].0).unwrap(),
+        Rect::new(4.0 + 32.0 * 2.0 + 64.0 + 2.0 * 3.0, 4.0, 32.0, 32.0),
+    );
+    assert_matches_full_layout(&mut ui);
+
+    // Hiding a flex item closes its gap; showing it again restores it.
+    ui.get_node_mut(items[0].0).unwrap().set_visible(false);
+    ui.update();
+    assert_rect_eq(
+        ui.computed_rect(items[1].0).unwrap(),
+        Rect::new(4.0, 4.0, 32.0, 32.0),
+    );
+    assert_matches_full_layout(&mut ui);
+    ui.get_node_mut(items[0].0).unwrap().set_visible(true);
+    ui.update();
+    assert_matches_full_layout(&mut ui);
+
+    // Dirtying the root and a nested node at once lays the tree out once.
+    ui.get_node_mut(root)
+        .unwrap()
+        .set_padding(UiEdges::all(10.0));
+    ui.get_node_mut(items[5].1)
+        .unwrap()
+        .set_anchor(UiAnchor::TopLeft);
+    ui.update();
+    assert_rect_eq(
+        ui.computed_rect(items[0].0).unwrap(),
+        Rect::new(10.0, 10.0, 32.0, 32.0),
+    );
+    assert_matches_full_layout(&mut ui);
+}
+
+#[test]
+fn layout_structural_changes_dirty_the_whole_tree() {
+    let mut ui = UiManager::new();
+    let (root, items) = build_inventory(&mut ui, 4);
+
+    ui.remove_node(items[0].0);
+    let extra = ui.create_node(Some(UiComponent::Panel));
+    ui.set_parent(extra, Some(root)).unwrap();
+    ui.update();
+    assert_rect_eq(
+        ui.computed_rect(items[1].0).unwrap(),
+        Rect::new(4.0, 4.0, 32.0, 32.0),
+    );
+    assert_matches_full_layout(&mut ui);
+}
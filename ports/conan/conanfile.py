@@ -47,9 +47,12 @@ class GoudEngineConan(ConanFile):
         copy(self, "*.hpp", src=os.path.join(src, "include"), dst=os.path.join(self.package_folder, "include"), keep_path=True)
         copy(self, lib_name, src=os.path.join(src, "lib"), dst=os.path.join(self.package_folder, "lib"))
         copy(self, "*.cmake", src=os.path.join(src, "cmake"), dst=os.path.join(self.package_folder, "cmake"))
+        copy(self, "goud_pack*", src=os.path.join(src, "bin"), dst=os.path.join(self.package_folder, "bin"))
         copy(self, "LICENSE", src=src, dst=os.path.join(self.package_folder, "licenses"), keep_path=False)
 
     def package_info(self):
         self.cpp_info.libs = ["goud_engine"]
+        # goud_pack, the asset pack builder, is put on PATH for build steps.
+        self.cpp_info.bindirs = ["bin"]
         self.cpp_info.set_property("cmake_file_name", "GoudEngine")
         self.cpp_info.set_property("cmake_target_name", "GoudEngine::GoudEngine")
@@ -1,7 +1,8 @@
 # portfile.cmake — vcpkg overlay port for GoudEngine C/C++ SDK
 #
 # Downloads a pre-built native tarball from GitHub Releases and installs
-# headers, the native library, and CMake config files.
+# headers, the native library, CMake config files, and the goud_pack
+# asset pack builder.
 
 vcpkg_check_linkage(ONLY_DYNAMIC_LIBRARY)
 
@@ -53,5 +54,10 @@ endif()
 # Install CMake config
 file(INSTALL "${EXTRACTED_DIR}/cmake/" DESTINATION "${CURRENT_PACKAGES_DIR}/share/${PORT}")
 
+# Install the asset pack builder as a host tool
+file(GLOB PACK_TOOL "${EXTRACTED_DIR}/bin/goud_pack*")
+file(INSTALL ${PACK_TOOL} DESTINATION "${CURRENT_PACKAGES_DIR}/tools/${PORT}"
+    FILE_PERMISSIONS OWNER_READ OWNER_WRITE OWNER_EXECUTE GROUP_READ GROUP_EXECUTE WORLD_READ WORLD_EXECUTE)
+
 # Install copyright
 vcpkg_install_copyright(FILE_LIST "${CURRENT_PORT_DIR}/../../LICENSE")
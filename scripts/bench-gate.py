@@ -48,6 +48,16 @@ Then gate or (re)save the baseline::
     python3 scripts/bench-gate.py --quick         # gate, 15% ratio tolerance
     python3 scripts/bench-gate.py --save-baseline # rewrite the baseline
 
+C++ SDK benches
+---------------
+``sdks/cpp/benchmarks`` (Google Benchmark) measures what C++ callers pay at
+the FFI boundary. Its JSON output is gated the same way, against its own
+baseline and reference bench (``cpp_ecs/spawn_destroy_batch_1k``)::
+
+    cmake --build build --target goud_cpp_benchmarks_json
+    python3 scripts/bench-gate.py --benchmark-json build/cpp_sdk_benchmarks.json
+    python3 scripts/bench-gate.py --benchmark-json build/cpp_sdk_benchmarks.json --save-baseline
+
 Exit codes: 0 = pass, 1 = regression / coverage mismatch / missing data.
 
 Pure standard library, no third-party dependencies.
@@ -67,6 +77,10 @@ DEFAULT_BASELINE = (
     REPO_ROOT / "goud_engine" / "benches" / "baselines" / "criterion_baseline.json"
 )
 DEFAULT_REFERENCE = "engine_tick/tick_10k"
+DEFAULT_CPP_BASELINE = (
+    REPO_ROOT / "goud_engine" / "benches" / "baselines" / "cpp_sdk_baseline.json"
+)
+DEFAULT_CPP_REFERENCE = "cpp_ecs/spawn_destroy_batch_1k"
 
 # Benchmark groups this gate tracks. A "bench name" is "<group>/<function>".
 # Groups are also read from an existing baseline so the two stay in sync.
@@ -79,6 +93,17 @@ DEFAULT_GROUPS = [
     "shadow_record",
 ]
 
+# Groups emitted by the C++ SDK benchmark binary.
+DEFAULT_CPP_GROUPS = [
+    "cpp_render",
+    "cpp_ecs",
+    "cpp_component",
+    "cpp_error",
+]
+
+# Google Benchmark time_unit -> nanoseconds.
+TIME_UNIT_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
 DEFAULT_THRESHOLD = 0.10  # 10%
 QUICK_THRESHOLD = 0.15  # 15%
 
@@ -113,14 +138,65 @@ def discover_run_benches(criterion_dir: Path, groups: list[str]) -> set[str]:
     return found
 
 
+def read_benchmark_json(path: Path) -> dict[str, float] | None:
+    """Return {name: mean_ns} from Google Benchmark JSON, or None on error.
+
+    Uses the "mean" aggregate when the run had repetitions, otherwise the
+    single iteration entry. Skipped (errored) benchmarks are left out.
+    """
+    try:
+        with path.open(encoding="utf-8") as fh:
+            data = json.load(fh)
+    except (OSError, ValueError) as exc:
+        print(f"error: failed to parse {path}: {exc}", file=sys.stderr)
+        return None
+
+    iterations: dict[str, float] = {}
+    means: dict[str, float] = {}
+    for bench in data.get("benchmarks", []):
+        if bench.get("error_occurred") or bench.get("skipped"):
+            continue
+        try:
+            name = bench.get("run_name", bench["name"])
+            mean_ns = float(bench["real_time"]) * TIME_UNIT_NS[bench.get("time_unit", "ns")]
+        except (KeyError, TypeError, ValueError) as exc:
+            print(f"error: bad benchmark entry in {path}: {exc}", file=sys.stderr)
+            return None
+        if bench.get("run_type") == "aggregate":
+            if bench.get("aggregate_name") == "mean":
+                means[name] = mean_ns
+        else:
+            iterations.setdefault(name, mean_ns)
+    iterations.update(means)
+    return iterations
+
+
+def load_run(args: argparse.Namespace, groups: list[str]) -> dict[str, float] | None:
+    """Return {name: mean_ns} for every tracked bench in the current run."""
+    if args.benchmark_json is not None:
+        means = read_benchmark_json(args.benchmark_json)
+        if means is None:
+            return None
+        return {
+            name: mean for name, mean in means.items() if name.partition("/")[0] in groups
+        }
+
+    run: dict[str, float] = {}
+    for name in discover_run_benches(args.criterion_dir, groups):
+        mean_ns = read_mean_ns(args.criterion_dir, name)
+        if mean_ns is not None:
+            run[name] = mean_ns
+    return run
+
+
 def collect_run(
-    criterion_dir: Path, bench_names: set[str], reference: str
+    run: dict[str, float], bench_names: set[str], reference: str
 ) -> dict[str, dict[str, float]] | None:
     """Build {name: {mean_ns, ratio}} for the current run. None on hard error."""
-    ref_mean = read_mean_ns(criterion_dir, reference)
+    ref_mean = run.get(reference)
     if ref_mean is None:
         print(
-            f"error: reference bench '{reference}' not found under {criterion_dir}.\n"
+            f"error: reference bench '{reference}' not found in this run.\n"
             f"       Run its bench (e.g. `cargo bench --bench engine_tick_benchmarks`) first.",
             file=sys.stderr,
         )
@@ -131,7 +207,7 @@ def collect_run(
 
     entries: dict[str, dict[str, float]] = {}
     for name in sorted(bench_names):
-        mean_ns = read_mean_ns(criterion_dir, name)
+        mean_ns = run.get(name)
         if mean_ns is None:
             continue  # coverage checked by the caller
         entries[name] = {"mean_ns": mean_ns, "ratio": mean_ns / ref_mean}
@@ -143,9 +219,11 @@ def load_baseline(path: Path) -> dict:
         return json.load(fh)
 
 
-def tracked_groups(baseline_path: Path, extra_groups: list[str]) -> list[str]:
-    """Groups to scan: DEFAULT_GROUPS + any groups from an existing baseline."""
-    groups = set(DEFAULT_GROUPS)
+def tracked_groups(
+    baseline_path: Path, extra_groups: list[str], defaults: list[str]
+) -> list[str]:
+    """Groups to scan: the default groups + any groups from an existing baseline."""
+    groups = set(defaults)
     groups.update(extra_groups)
     if baseline_path.is_file():
         try:
@@ -158,11 +236,14 @@ def tracked_groups(baseline_path: Path, extra_groups: list[str]) -> list[str]:
 
 
 def save_baseline(args: argparse.Namespace) -> int:
-    groups = tracked_groups(args.baseline, args.group)
-    run_benches = discover_run_benches(args.criterion_dir, groups)
+    groups = tracked_groups(args.baseline, args.group, args.default_groups)
+    run = load_run(args, groups)
+    if run is None:
+        return 1
+    run_benches = set(run)
     if not run_benches:
         print(
-            f"error: no benchmarks found under {args.criterion_dir} for groups {groups}.\n"
+            f"error: no benchmarks found in this run for groups {groups}.\n"
             f"       Run the benches before --save-baseline.",
             file=sys.stderr,
         )
@@ -174,7 +255,7 @@ def save_baseline(args: argparse.Namespace) -> int:
         )
         return 1
 
-    entries = collect_run(args.criterion_dir, run_benches, args.reference)
+    entries = collect_run(run, run_benches, args.reference)
     if entries is None:
         return 1
 
@@ -208,8 +289,11 @@ def gate(args: argparse.Namespace) -> int:
         return 1
 
     threshold = QUICK_THRESHOLD if args.quick else DEFAULT_THRESHOLD
-    groups = tracked_groups(args.baseline, args.group)
-    run_benches = discover_run_benches(args.criterion_dir, groups)
+    groups = tracked_groups(args.baseline, args.group, args.default_groups)
+    run = load_run(args, groups)
+    if run is None:
+        return 1
+    run_benches = set(run)
 
     baseline_names = set(baseline_entries)
     failures: list[str] = []
@@ -222,7 +306,7 @@ def gate(args: argparse.Namespace) -> int:
     for name in extra_in_run:
         failures.append(f"bench '{name}' ran but is missing from the baseline")
 
-    run_entries = collect_run(args.criterion_dir, run_benches & baseline_names, reference)
+    run_entries = collect_run(run, run_benches & baseline_names, reference)
     if run_entries is None:
         return 1
 
@@ -279,13 +363,16 @@ def parse_args(argv: list[str]) -> argparse.Namespace:
     )
     parser.add_argument(
         "--reference",
-        default=DEFAULT_REFERENCE,
-        help=f"reference bench for ratio normalization (default: {DEFAULT_REFERENCE})",
+        default=None,
+        help=(
+            f"reference bench for ratio normalization (default: {DEFAULT_REFERENCE}, "
+            f"or {DEFAULT_CPP_REFERENCE} with --benchmark-json)"
+        ),
     )
     parser.add_argument(
         "--baseline",
         type=Path,
-        default=DEFAULT_BASELINE,
+        default=None,
         help="path to the checked-in baseline JSON",
     )
     parser.add_argument(
@@ -294,13 +381,26 @@ def parse_args(argv: list[str]) -> argparse.Namespace:
         default=DEFAULT_CRITERION_DIR,
         help="path to target/criterion",
     )
+    parser.add_argument(
+        "--benchmark-json",
+        type=Path,
+        default=None,
+        help="read a Google Benchmark JSON file (C++ SDK benches) instead of criterion output",
+    )
     parser.add_argument(
         "--group",
         action="append",
         default=[],
         help="additional bench group to track (repeatable)",
     )
-    return parser.parse_args(argv)
+    args = parser.parse_args(argv)
+    cpp = args.benchmark_json is not None
+    if args.reference is None:
+        args.reference = DEFAULT_CPP_REFERENCE if cpp else DEFAULT_REFERENCE
+    if args.baseline is None:
+        args.baseline = DEFAULT_CPP_BASELINE if cpp else DEFAULT_BASELINE
+    args.default_groups = DEFAULT_CPP_GROUPS if cpp else DEFAULT_GROUPS
+    return args
 
 
 def main(argv: list[str]) -> int:
@@ -0,0 +1,472 @@
+#ifndef GOUD_C_COLLISION_BATCH_H
+#define GOUD_C_COLLISION_BATCH_H
+
+/** @file collision_batch.h
+ *  @brief Header-only batch collision tests over structure-of-arrays data.
+ *
+ *  One-vs-many and many-vs-many forms of goud_collision_aabb_overlap(),
+ *  goud_collision_circle_overlap(), goud_collision_point_in_rect() and
+ *  goud_collision_distance_squared().  Everything inlines into the caller;
+ *  no call crosses the FFI boundary, and the engine library is not needed.
+ *
+ *  The kernels use AVX2 when the translation unit is compiled with it
+ *  (@c -mavx2), SSE2 on other x86 targets, NEON on AArch64, and plain C
+ *  elsewhere.  Define @c GOUD_COLLISION_BATCH_SCALAR before including this
+ *  header to force the plain C path.  Every path evaluates the same IEEE
+ *  single-precision operations in the same order as the engine helpers, so
+ *  results are bit-identical; floating-point contraction is switched off
+ *  around the kernels so FMA-enabled builds do not fuse them.
+ *
+ *  One-vs-many tests write a bitmask: bit @c i of word @c i/32 is set when
+ *  element @c i hits.  Size masks with GOUD_COLLISION_MASK_WORDS() and
+ *  convert them to index lists with goud_collision_mask_indices().
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#if !defined(GOUD_COLLISION_BATCH_SCALAR)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define GOUD_COLLISION_BATCH_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GOUD_COLLISION_BATCH_SSE2 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define GOUD_COLLISION_BATCH_NEON 1
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================= */
+/** @defgroup collision_batch Batch Collision
+ *  Inline SIMD collision kernels over SoA float arrays.
+ *  @{ */
+/* ========================================================================= */
+
+/** @brief Number of 32-bit words in a mask covering @p count elements. */
+#define GOUD_COLLISION_MASK_WORDS(count) (((uint32_t)(count) + 31u) / 32u)
+
+/** @brief Axis-aligned boxes as four parallel arrays of corners. */
+typedef struct goud_aabb_soa {
+    const float *min_x; /**< Minimum corner X of each box. */
+    const float *min_y; /**< Minimum corner Y of each box. */
+    const float *max_x; /**< Maximum corner X of each box. */
+    const float *max_y; /**< Maximum corner Y of each box. */
+} goud_aabb_soa;
+
+/** @brief Circles as three parallel arrays. */
+typedef struct goud_circle_soa {
+    const float *x;      /**< Centre X of each circle. */
+    const float *y;      /**< Centre Y of each circle. */
+    const float *radius; /**< Radius of each circle. */
+} goud_circle_soa;
+
+/** @brief Indices of one overlapping pair from a many-vs-many test. */
+typedef struct goud_index_pair {
+    uint32_t a; /**< Index into the first set. */
+    uint32_t b; /**< Index into the second set. */
+} goud_index_pair;
+
+/* Keep every multiply and add separately rounded, as in the engine, even
+ * when the includer lets the compiler contract them into FMAs (GCC does by
+ * default in GNU modes once FMA is enabled). */
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC push_options
+#pragma GCC optimize("fp-contract=off")
+#elif !defined(_MSC_VER)
+#pragma STDC FP_CONTRACT OFF
+#endif
+
+/** @cond GOUD_INTERNAL */
+
+/* Thin vector layer: each kernel below is written once against these. */
+#if defined(GOUD_COLLISION_BATCH_AVX2)
+#define GOUD__LANES 8u
+typedef __m256 goud__vf;
+typedef __m256 goud__vm;
+#define goud__load(p) _mm256_loadu_ps(p)
+#define goud__splat(x) _mm256_set1_ps(x)
+#define goud__store(p, v) _mm256_storeu_ps((p), (v))
+#define goud__add(a, b) _mm256_add_ps((a), (b))
+#define goud__sub(a, b) _mm256_sub_ps((a), (b))
+#define goud__mul(a, b) _mm256_mul_ps((a), (b))
+#define goud__ge(a, b) _mm256_cmp_ps((a), (b), _CMP_GE_OQ)
+#define goud__le(a, b) _mm256_cmp_ps((a), (b), _CMP_LE_OQ)
+#define goud__and(a, b) _mm256_and_ps((a), (b))
+#define goud__bits(m) ((uint32_t)_mm256_movemask_ps(m))
+#elif defined(GOUD_COLLISION_BATCH_SSE2)
+#define GOUD__LANES 4u
+typedef __m128 goud__vf;
+typedef __m128 goud__vm;
+#define goud__load(p) _mm_loadu_ps(p)
+#define goud__splat(x) _mm_set1_ps(x)
+#define goud__store(p, v) _mm_storeu_ps((p), (v))
+#define goud__add(a, b) _mm_add_ps((a), (b))
+#define goud__sub(a, b) _mm_sub_ps((a), (b))
+#define goud__mul(a, b) _mm_mul_ps((a), (b))
+#define goud__ge(a, b) _mm_cmpge_ps((a), (b))
+#define goud__le(a, b) _mm_cmple_ps((a), (b))
+#define goud__and(a, b) _mm_and_ps((a), (b))
+#define goud__bits(m) ((uint32_t)_mm_movemask_ps(m))
+#elif defined(GOUD_COLLISION_BATCH_NEON)
+#define GOUD__LANES 4u
+typedef float32x4_t goud__vf;
+typedef uint32x4_t goud__vm;
+#define goud__load(p) vld1q_f32(p)
+#define goud__splat(x) vdupq_n_f32(x)
+#define goud__store(p, v) vst1q_f32((p), (v))
+#define goud__add(a, b) vaddq_f32((a), (b))
+#define goud__sub(a, b) vsubq_f32((a), (b))
+#define goud__mul(a, b) vmulq_f32((a), (b))
+#define goud__ge(a, b) vcgeq_f32((a), (b))
+#define goud__le(a, b) vcleq_f32((a), (b))
+#define goud__and(a, b) vandq_u32((a), (b))
+static inline uint32_t goud__bits(uint32x4_t m) {
+    static const uint32_t weights[4] = {1u, 2u, 4u, 8u};
+    return vaddvq_u32(vandq_u32(m, vld1q_u32(weights)));
+}
+#else
+#define GOUD__LANES 1u
+typedef float goud__vf;
+typedef uint32_t goud__vm;
+#define goud__load(p) (*(p))
+#define goud__splat(x) (x)
+#define goud__store(p, v) (*(p) = (v))
+#define goud__add(a, b) ((a) + (b))
+#define goud__sub(a, b) ((a) - (b))
+#define goud__mul(a, b) ((a) * (b))
+#define goud__ge(a, b) ((uint32_t)((a) >= (b)))
+#define goud__le(a, b) ((uint32_t)((a) <= (b)))
+#define goud__and(a, b) ((a) & (b))
+#define goud__bits(m) (m)
+#endif
+
+/* Lane masks of GOUD__LANES consecutive elements starting at i.  The operand
+ * order matches the engine's scalar helpers in goud_engine/src/ffi/collision.rs. */
+
+static inline goud__vm goud__aabb_lanes(goud__vf min_x, goud__vf min_y,
+                                        goud__vf max_x, goud__vf max_y,
+                                        goud_aabb_soa boxes, uint32_t i) {
+    goud__vm x = goud__and(goud__ge(max_x, goud__load(boxes.min_x + i)),
+                           goud__le(min_x, goud__load(boxes.max_x + i)));
+    goud__vm y = goud__and(goud__ge(max_y, goud__load(boxes.min_y + i)),
+                           goud__le(min_y, goud__load(boxes.max_y + i)));
+    return goud__and(x, y);
+}
+
+static inline goud__vm goud__circle_lanes(goud__vf x, goud__vf y, goud__vf radius,
+                                          goud_circle_soa circles, uint32_t i) {
+    goud__vf dx = goud__sub(goud__load(circles.x + i), x);
+    goud__vf dy = goud__sub(goud__load(circles.y + i), y);
+    goud__vf combined = goud__add(radius, goud__load(circles.radius + i));
+    goud__vf dist_sq = goud__add(goud__mul(dx, dx), goud__mul(dy, dy));
+    return goud__le(dist_sq, goud__mul(combined, combined));
+}
+
+static inline goud__vm goud__point_lanes(goud__vf min_x, goud__vf min_y,
+                                         goud__vf max_x, goud__vf max_y,
+                                         const float *xs, const float *ys, uint32_t i) {
+    goud__vf px = goud__load(xs + i);
+    goud__vf py = goud__load(ys + i);
+    goud__vm x = goud__and(goud__ge(px, min_x), goud__le(px, max_x));
+    goud__vm y = goud__and(goud__ge(py, min_y), goud__le(py, max_y));
+    return goud__and(x, y);
+}
+
+/* Scalar forms used for tails shorter than GOUD__LANES. */
+
+static inline uint32_t goud__aabb_one(float min_x, float min_y, float max_x, float max_y,
+                                      goud_aabb_soa boxes, uint32_t i) {
+    return max_x >= boxes.min_x[i] && min_x <= boxes.max_x[i] &&
+           max_y >= boxes.min_y[i] && min_y <= boxes.max_y[i];
+}
+
+static inline uint32_t goud__circle_one(float x, float y, float radius,
+                                        goud_circle_soa circles, uint32_t i) {
+    float dx = circles.x[i] - x;
+    float dy = circles.y[i] - y;
+    float combined = radius + circles.radius[i];
+    return (dx * dx + dy * dy) <= (combined * combined);
+}
+
+static inline uint32_t goud__point_one(float min_x, float min_y, float max_x, float max_y,
+                                       const float *xs, const float *ys, uint32_t i) {
+    return xs[i] >= min_x && xs[i] <= max_x && ys[i] >= min_y && ys[i] <= max_y;
+}
+
+static inline uint32_t goud__popcount(uint32_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t)__builtin_popcount(bits);
+#else
+    uint32_t n = 0;
+    while (bits != 0) {
+        bits &= bits - 1u;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+static inline uint32_t goud__lowest_bit(uint32_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t)__builtin_ctz(bits);
+#else
+    uint32_t n = 0;
+    while ((bits & 1u) == 0) {
+        bits >>= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+/* Append the pairs (a, base + lane) for each set lane bit.  Returns the new
+ * total; pairs past capacity are counted but not written. */
+static inline uint32_t goud__emit_pairs(uint32_t bits, uint32_t a, uint32_t base,
+                                        goud_index_pair *out_pairs, uint32_t capacity,
+                                        uint32_t total) {
+    while (bits != 0) {
+        if (total < capacity) {
+            out_pairs[total].a = a;
+            out_pairs[total].b = base + goud__lowest_bit(bits);
+        }
+        ++total;
+        bits &= bits - 1u;
+    }
+    return total;
+}
+
+/** @endcond */
+
+/** @brief Test one box against @p count boxes.
+ *
+ *  Matches goud_collision_aabb_overlap() per element; touching edges overlap.
+ *
+ *  @param min_x, min_y, max_x, max_y  Corners of the query box.
+ *  @param boxes          Boxes to test, each array holding @p count floats.
+ *  @param count          Number of boxes.
+ *  @param[out] out_mask  GOUD_COLLISION_MASK_WORDS(@p count) words; overwritten.
+ *  @return Number of overlapping boxes.
+ */
+static inline uint32_t goud_collision_aabb_overlap_many(
+    float min_x, float min_y, float max_x, float max_y,
+    goud_aabb_soa boxes, uint32_t count, uint32_t *out_mask
+) {
+    goud__vf vmin_x = goud__splat(min_x), vmin_y = goud__splat(min_y);
+    goud__vf vmax_x = goud__splat(max_x), vmax_y = goud__splat(max_y);
+    uint32_t hits = 0, i = 0;
+
+    memset(out_mask, 0, GOUD_COLLISION_MASK_WORDS(count) * sizeof(uint32_t));
+    for (; i + GOUD__LANES <= count; i += GOUD__LANES) {
+        uint32_t bits = goud__bits(goud__aabb_lanes(vmin_x, vmin_y, vmax_x, vmax_y, boxes, i));
+        out_mask[i >> 5] |= bits << (i & 31u);
+        hits += goud__popcount(bits);
+    }
+    for (; i < count; ++i) {
+        uint32_t bit = goud__aabb_one(min_x, min_y, max_x, max_y, boxes, i);
+        out_mask[i >> 5] |= bit << (i & 31u);
+        hits += bit;
+    }
+    return hits;
+}
+
+/** @brief Test one circle against @p count circles.
+ *
+ *  Matches goud_collision_circle_overlap() per element; touching circles overlap.
+ *
+ *  @param x, y, radius   The query circle.
+ *  @param circles        Circles to test, each array holding @p count floats.
+ *  @param count          Number of circles.
+ *  @param[out] out_mask  GOUD_COLLISION_MASK_WORDS(@p count) words; overwritten.
+ *  @return Number of overlapping circles.
+ */
+static inline uint32_t goud_collision_circle_overlap_many(
+    float x, float y, float radius,
+    goud_circle_soa circles, uint32_t count, uint32_t *out_mask
+) {
+    goud__vf vx = goud__splat(x), vy = goud__splat(y), vr = goud__splat(radius);
+    uint32_t hits = 0, i = 0;
+
+    memset(out_mask, 0, GOUD_COLLISION_MASK_WORDS(count) * sizeof(uint32_t));
+    for (; i + GOUD__LANES <= count; i += GOUD__LANES) {
+        uint32_t bits = goud__bits(goud__circle_lanes(vx, vy, vr, circles, i));
+        out_mask[i >> 5] |= bits << (i & 31u);
+        hits += goud__popcount(bits);
+    }
+    for (; i < count; ++i) {
+        uint32_t bit = goud__circle_one(x, y, radius, circles, i);
+        out_mask[i >> 5] |= bit << (i & 31u);
+        hits += bit;
+    }
+    return hits;
+}
+
+/** @brief Test @p count points against one rectangle.
+ *
+ *  Matches goud_collision_point_in_rect() per element; edges are inside.
+ *
+ *  @param rect_x, rect_y  Minimum corner of the rectangle.
+ *  @param rect_w, rect_h  Size of the rectangle.
+ *  @param xs, ys          Point coordinates, each holding @p count floats.
+ *  @param count           Number of points.
+ *  @param[out] out_mask   GOUD_COLLISION_MASK_WORDS(@p count) words; overwritten.
+ *  @return Number of points inside the rectangle.
+ */
+static inline uint32_t goud_collision_point_in_rect_many(
+    float rect_x, float rect_y, float rect_w, float rect_h,
+    const float *xs, const float *ys, uint32_t count, uint32_t *out_mask
+) {
+    float max_x = rect_x + rect_w, max_y = rect_y + rect_h;
+    goud__vf vmin_x = goud__splat(rect_x), vmin_y = goud__splat(rect_y);
+    goud__vf vmax_x = goud__splat(max_x), vmax_y = goud__splat(max_y);
+    uint32_t hits = 0, i = 0;
+
+    memset(out_mask, 0, GOUD_COLLISION_MASK_WORDS(count) * sizeof(uint32_t));
+    for (; i + GOUD__LANES <= count; i += GOUD__LANES) {
+        uint32_t bits = goud__bits(goud__point_lanes(vmin_x, vmin_y, vmax_x, vmax_y, xs, ys, i));
+        out_mask[i >> 5] |= bits << (i & 31u);
+        hits += goud__popcount(bits);
+    }
+    for (; i < count; ++i) {
+        uint32_t bit = goud__point_one(rect_x, rect_y, max_x, max_y, xs, ys, i);
+        out_mask[i >> 5] |= bit << (i & 31u);
+        hits += bit;
+    }
+    return hits;
+}
+
+/** @brief Squared distance from one point to each of @p count points.
+ *
+ *  Matches goud_collision_distance_squared() per element.
+ *
+ *  @param x, y          The query point.
+ *  @param xs, ys        Point coordinates, each holding @p count floats.
+ *  @param count         Number of points.
+ *  @param[out] out_dist_sq  Receives @p count squared distances.
+ */
+static inline void goud_collision_distance_squared_many(
+    float x, float y, const float *xs, const float *ys, uint32_t count, float *out_dist_sq
+) {
+    goud__vf vx = goud__splat(x), vy = goud__splat(y);
+    uint32_t i = 0;
+
+    for (; i + GOUD__LANES <= count; i += GOUD__LANES) {
+        goud__vf dx = goud__sub(goud__load(xs + i), vx);
+        goud__vf dy = goud__sub(goud__load(ys + i), vy);
+        goud__store(out_dist_sq + i, goud__add(goud__mul(dx, dx), goud__mul(dy, dy)));
+    }
+    for (; i < count; ++i) {
+        float dx = xs[i] - x;
+        float dy = ys[i] - y;
+        out_dist_sq[i] = dx * dx + dy * dy;
+    }
+}
+
+/** @brief Find every overlapping pair between two sets of boxes.
+ *
+ *  Pairs are reported in order of @c a, then @c b.  At most @p capacity
+ *  pairs are written; the return value counts all of them, so a return
+ *  greater than @p capacity means the buffer was too small.
+ *
+ *  @param a, count_a       First set of boxes.
+ *  @param b, count_b       Second set of boxes.
+ *  @param[out] out_pairs   Buffer of @p capacity pairs; may be NULL if @p capacity is 0.
+ *  @param capacity         Number of pairs @p out_pairs can hold.
+ *  @return Total number of overlapping pairs.
+ */
+static inline uint32_t goud_collision_aabb_pairs(
+    goud_aabb_soa a, uint32_t count_a, goud_aabb_soa b, uint32_t count_b,
+    goud_index_pair *out_pairs, uint32_t capacity
+) {
+    uint32_t total = 0, ia;
+
+    for (ia = 0; ia < count_a; ++ia) {
+        float min_x = a.min_x[ia], min_y = a.min_y[ia], max_x = a.max_x[ia], max_y = a.max_y[ia];
+        goud__vf vmin_x = goud__splat(min_x), vmin_y = goud__splat(min_y);
+        goud__vf vmax_x = goud__splat(max_x), vmax_y = goud__splat(max_y);
+        uint32_t ib = 0;
+        for (; ib + GOUD__LANES <= count_b; ib += GOUD__LANES) {
+            uint32_t bits = goud__bits(goud__aabb_lanes(vmin_x, vmin_y, vmax_x, vmax_y, b, ib));
+            total = goud__emit_pairs(bits, ia, ib, out_pairs, capacity, total);
+        }
+        for (; ib < count_b; ++ib) {
+            total = goud__emit_pairs(goud__aabb_one(min_x, min_y, max_x, max_y, b, ib),
+                                     ia, ib, out_pairs, capacity, total);
+        }
+    }
+    return total;
+}
+
+/** @brief Find every overlapping pair between two sets of circles.
+ *
+ *  Same ordering and capacity rules as goud_collision_aabb_pairs().
+ *
+ *  @param a, count_a       First set of circles.
+ *  @param b, count_b       Second set of circles.
+ *  @param[out] out_pairs   Buffer of @p capacity pairs; may be NULL if @p capacity is 0.
+ *  @param capacity         Number of pairs @p out_pairs can hold.
+ *  @return Total number of overlapping pairs.
+ */
+static inline uint32_t goud_collision_circle_pairs(
+    goud_circle_soa a, uint32_t count_a, goud_circle_soa b, uint32_t count_b,
+    goud_index_pair *out_pairs, uint32_t capacity
+) {
+    uint32_t total = 0, ia;
+
+    for (ia = 0; ia < count_a; ++ia) {
+        float x = a.x[ia], y = a.y[ia], radius = a.radius[ia];
+        goud__vf vx = goud__splat(x), vy = goud__splat(y), vr = goud__splat(radius);
+        uint32_t ib = 0;
+        for (; ib + GOUD__LANES <= count_b; ib += GOUD__LANES) {
+            uint32_t bits = goud__bits(goud__circle_lanes(vx, vy, vr, b, ib));
+            total = goud__emit_pairs(bits, ia, ib, out_pairs, capacity, total);
+        }
+        for (; ib < count_b; ++ib) {
+            total = goud__emit_pairs(goud__circle_one(x, y, radius, b, ib),
+                                     ia, ib, out_pairs, capacity, total);
+        }
+    }
+    return total;
+}
+
+/** @brief Convert a mask from a one-vs-many test into an index list.
+ *
+ *  @param mask              GOUD_COLLISION_MASK_WORDS(@p count) words.
+ *  @param count             Number of elements the mask covers.
+ *  @param[out] out_indices  Receives the set indices in ascending order; must
+ *                           hold as many entries as the test returned.
+ *  @return Number of indices written.
+ */
+static inline uint32_t goud_collision_mask_indices(
+    const uint32_t *mask, uint32_t count, uint32_t *out_indices
+) {
+    uint32_t written = 0, word;
+
+    for (word = 0; word < GOUD_COLLISION_MASK_WORDS(count); ++word) {
+        uint32_t bits = mask[word];
+        while (bits != 0) {
+            out_indices[written++] = word * 32u + goud__lowest_bit(bits);
+            bits &= bits - 1u;
+        }
+    }
+    return written;
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC pop_options
+#elif !defined(_MSC_VER)
+#pragma STDC FP_CONTRACT DEFAULT
+#endif
+
+/** @} */ /* end collision_batch */
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+
+#endif
@@ -41,12 +41,27 @@ typedef GoudFontHandle goud_font;
 /** @brief Audio player identifier. Negative values indicate invalid state. */
 typedef int64_t goud_audio_player;
 
+/** @brief Decoded audio clip handle.  GOUD_INVALID_AUDIO_CLIP when invalid. */
+typedef uint64_t goud_audio_clip;
+
+/** @brief Audio clip cache counters. */
+typedef FfiAudioClipCacheStats goud_audio_clip_stats;
+
+/** @brief Streamed audio counters. */
+typedef FfiAudioStreamStats goud_audio_stream_stats;
+
+/** @brief One emitter's position and attenuation for goud_audio_spatial_update_batch(). */
+typedef FfiSpatialSourceUpdate goud_spatial_source_update;
+
 /** @brief Keyboard key code. */
 typedef GoudKeyCode goud_key;
 
 /** @brief Mouse button identifier. */
 typedef GoudMouseButton goud_mouse_button;
 
+/** @brief Copy of one frame's keyboard, mouse, gamepad and touch state. */
+typedef FfiInputSnapshot goud_input_snapshot;
+
 /** @brief RGBA colour (each channel 0.0 -- 1.0). */
 typedef FfiColor goud_color;
 
@@ -56,6 +71,91 @@ typedef FfiVec2 goud_vec2;
 /** @brief Per-frame rendering statistics. */
 typedef GoudRenderStats goud_render_stats;
 
+/** @brief Per-phase timings of the last rendered frame, in microseconds. */
+typedef FfiFramePhaseTimings goud_frame_phase_timings;
+
+/** @brief One sprite command for batched submission. */
+typedef FfiSpriteCmd goud_sprite_cmd;
+
+/** @brief Emission, motion, and colour/size ranges of one particle emitter. */
+typedef FfiParticleEmitterConfig goud_particle_config;
+
+/** @brief One text label for batched submission. */
+typedef FfiTextCmd goud_text_cmd;
+
+/** @brief Text layout cache counters. */
+typedef FfiTextLayoutCacheStats goud_text_cache_stats;
+typedef FfiTextureStreamingStats goud_texture_stream_stats;
+
+/** @brief Entity pool handle.  GOUD_INVALID_POOL_HANDLE when invalid. */
+typedef uint32_t goud_entity_pool;
+
+/** @brief Entity pool diagnostic counters. */
+typedef FfiPoolStats goud_pool_stats;
+
+/** @brief Frame arena diagnostic counters. */
+typedef FfiArenaStats goud_arena_stats;
+
+/** @brief Texture atlas handle.  GOUD_INVALID_ATLAS when invalid. */
+typedef GoudAtlasHandle goud_atlas;
+
+/** @brief Placement of one packed image within a texture atlas. */
+typedef FfiAtlasEntry goud_atlas_entry;
+
+/** @brief GPU-resident static sprite layer handle.  GOUD_INVALID_STATIC_LAYER when invalid. */
+typedef GoudStaticLayerHandle goud_static_layer;
+
+/** @brief Chunked tilemap handle.  GOUD_INVALID_TILEMAP when invalid. */
+typedef GoudTilemapHandle goud_tilemap;
+
+/** @brief 2D particle emitter handle.  GOUD_INVALID_PARTICLE_EMITTER when invalid. */
+typedef GoudParticleEmitterHandle goud_particle_emitter;
+
+/** @brief Memory-mapped asset pack handle.  GOUD_INVALID_ASSET_PACK when invalid. */
+typedef GoudAssetPackHandle goud_asset_pack;
+
+/** @brief 2D physics body handle. */
+typedef uint64_t goud_physics_body;
+
+/** @brief Saved 2D physics state handle.  Negative values indicate invalid state. */
+typedef int64_t goud_physics_state;
+
+/** @brief Saved world snapshot handle.  Negative values indicate invalid state. */
+typedef int64_t goud_world_snapshot;
+
+/** @brief Counts describing one world snapshot. */
+typedef FfiWorldSnapshotStats goud_world_snapshot_stats;
+
+/** @brief Collision between two 2D physics bodies. */
+typedef FfiCollisionEvent goud_collision_event;
+
+/** @brief Fired animation event; its strings borrow the engine's event buffer. */
+typedef FfiAnimationEvent goud_animation_event;
+
+/** @brief Ray for batched raycasts. */
+typedef FfiRay goud_ray;
+
+/** @brief Result of one ray in a batched raycast. */
+typedef FfiRaycastHit goud_raycast_hit;
+
+/** @brief Axis-aligned rectangle: minimum corner and size. */
+typedef FfiRect goud_rect;
+
+/** @brief Network provider handle.  Values <= 0 are invalid. */
+typedef int64_t goud_network;
+
+/** @brief Aggregate network counters for one provider handle. */
+typedef FfiNetworkStats goud_network_stats;
+
+/** @brief Location of one message in a goud_network_receive_batch() buffer. */
+typedef FfiNetworkMessage goud_network_message;
+
+/** @brief One frame of engine counters in a fixed binary layout. */
+typedef GoudMetricsBlock goud_metrics_block;
+
+/** @brief Double-buffered metrics blocks a context publishes into. */
+typedef GoudMetricsBuffer goud_metrics_double_buffer;
+
 /** @} */ /* end types */
 
 /* ========================================================================= */
@@ -133,6 +233,10 @@ static inline void goud_error_info_clear(goud_error_info *out_error) {
 }
 
 /** @brief Populate @p out_error with the last engine error.
+ *
+ *  The strings are only copied when an error is set.  Each is
+ *  null-terminated; bytes past the terminator are left unspecified.
+ *
  *  @param[out] out_error  Destination struct.
  *  @return The error code stored in @p out_error.
  *  @retval ERR_INVALID_STATE  @p out_error is NULL.
@@ -142,8 +246,15 @@ static inline int goud_get_last_error(goud_error_info *out_error) {
         return ERR_INVALID_STATE;
     }
 
-    goud_error_info_clear(out_error);
     out_error->code = goud_last_error_code();
+    out_error->message[0] = '\0';
+    out_error->subsystem[0] = '\0';
+    out_error->operation[0] = '\0';
+    if (out_error->code == SUCCESS) {
+        out_error->recovery_class = 0;
+        return SUCCESS;
+    }
+
     out_error->recovery_class = goud_error_recovery_class(out_error->code);
     (void)goud_last_error_message((uint8_t *)out_error->message, sizeof(out_error->message));
     (void)goud_last_error_subsystem((uint8_t *)out_error->subsystem, sizeof(out_error->subsystem));
@@ -216,6 +327,34 @@ static inline int goud_context_dispose(goud_context *context) {
     return status;
 }
 
+/** @brief Give the calling thread a private context registry.
+ *
+ *  Contexts the thread creates afterwards are looked up in that registry
+ *  instead of the process-wide one, so N isolated threads can look up N
+ *  contexts without contending.  Their handles are only valid on this
+ *  thread.  Physics, spatial, pool, networking and component storage
+ *  registries stay process-wide and still lock per call.  Call before
+ *  creating any context on the thread; calling it twice does nothing.
+ *
+ *  @return SUCCESS on success.
+ */
+static inline int goud_context_thread_isolate(void) {
+    int32_t code = goud_context_isolate_thread();
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Return the calling thread to the process-wide context registry.
+ *
+ *  A thread that exits while isolated is released automatically.
+ *
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  Contexts created since isolating are still alive.
+ */
+static inline int goud_context_thread_release(void) {
+    int32_t code = goud_context_release_thread();
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
 /** @brief Allocate a new engine configuration.
  *  @param[out] out_config  Receives the new config handle.
  *  @return SUCCESS on success.
@@ -383,6 +522,25 @@ static inline int goud_engine_config_set_window_backend_value(goud_engine_config
     return goud_status_from_bool(goud_engine_config_set_window_backend(config, backend));
 }
 
+/** @brief Select the headless runtime for servers, CI, and benchmarks.
+ *
+ *  Sets the window backend to GOUD_WINDOW_BACKEND_HEADLESS and the render
+ *  backend to GOUD_RENDER_BACKEND_NULL.  The engine created from @p config
+ *  opens no window and no GPU device: frames still tick, audio mixes into a
+ *  null sink, and draw calls are counted but not rasterized.
+ *
+ *  @param config  Valid config handle.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p config is NULL.
+ */
+static inline int goud_engine_config_set_headless(goud_engine_config config) {
+    int status = goud_engine_config_set_window_backend_value(config, GOUD_WINDOW_BACKEND_HEADLESS);
+    if (status != SUCCESS) {
+        return status;
+    }
+    return goud_engine_config_set_render_backend_value(config, GOUD_RENDER_BACKEND_NULL);
+}
+
 /** @brief Attach a debugger configuration to the engine config.
  *  @param config    Valid config handle.
  *  @param debugger  Pointer to debugger configuration.
@@ -426,7 +584,7 @@ static inline int goud_engine_create_checked(goud_engine_config *config, goud_co
 
 /* ========================================================================= */
 /** @defgroup ecs Entity Component System
- *  Spawn, destroy, and query entities.
+ *  Spawn, destroy, and query entities and their components.
  *  @{ */
 /* ========================================================================= */
 
@@ -466,364 +624,3314 @@ static inline bool goud_entity_alive(goud_context context, goud_entity entity) {
     return goud_entity_is_alive(context, entity);
 }
 
-/** @} */ /* end ecs */
-
-/* ========================================================================= */
-/** @defgroup assets Assets
- *  Load and destroy texture and font assets.
- *  @{ */
-/* ========================================================================= */
-
-/** @brief Load a texture from a file path.
- *  @param context              Valid engine context.
- *  @param path                 Null-terminated file path.
- *  @param[out] out_texture     Receives the texture handle.
- *  @return SUCCESS on success.
- *  @retval ERR_INVALID_STATE   @p out_texture is NULL.
+/** @brief Spawn @p count empty entities in one call.
+ *  @param context            Valid engine context.
+ *  @param count              Number of entities to spawn.
+ *  @param[out] out_entities  Receives @p count entity handles.
+ *  @param[out] out_spawned   Optional; receives the number actually spawned.
+ *  @return SUCCESS when every entity was spawned (including @p count == 0).
+ *  @retval ERR_INVALID_STATE  @p out_entities is NULL with a non-zero @p count.
  */
-static inline int goud_texture_load_path(goud_context context, const char *path, goud_texture *out_texture) {
-    goud_texture texture;
+static inline int goud_entity_spawn_many(
+    goud_context context,
+    uint32_t count,
+    goud_entity *out_entities,
+    uint32_t *out_spawned
+) {
+    uint32_t spawned;
 
-    if (out_texture == NULL) {
+    if (out_spawned != NULL) {
+        *out_spawned = 0;
+    }
+    if (count == 0) {
+        return SUCCESS;
+    }
+    if (out_entities == NULL) {
         return ERR_INVALID_STATE;
     }
 
-    texture = goud_texture_load(context, path);
-    *out_texture = texture;
-    return goud_status_from_handle(texture, UINT64_MAX);
+    spawned = goud_entity_spawn_batch(context, count, out_entities);
+    if (out_spawned != NULL) {
+        *out_spawned = spawned;
+    }
+    return spawned == count ? SUCCESS : goud_status_last_error_or(ERR_INTERNAL_ERROR);
 }
 
-/** @brief Destroy a texture.
- *  @param context  Valid engine context.
- *  @param texture  Texture handle to destroy.
- *  @return SUCCESS on success.
+/** @brief Clone the hierarchy rooted at @p prefab @p count times in one call.
+ *
+ *  Each instance is a deep copy, as with goud_entity_clone_recursive():
+ *  instance roots have no parent and cloned children are parented under
+ *  the matching cloned parent.
+ *
+ *  @param context            Valid engine context.
+ *  @param prefab             Root entity of the template hierarchy.
+ *  @param count              Number of instances to create.
+ *  @param[out] out_entities  Receives the @p count instance root handles.
+ *  @param[out] out_spawned   Optional; receives the number of instances created.
+ *  @return SUCCESS when every instance was created (including @p count == 0).
+ *  @retval ERR_INVALID_STATE  @p out_entities is NULL with a non-zero @p count.
  */
-static inline int goud_texture_dispose(goud_context context, goud_texture texture) {
-    return goud_status_from_bool(goud_texture_destroy(context, texture));
+static inline int goud_entity_instantiate_many(
+    goud_context context,
+    goud_entity prefab,
+    uint32_t count,
+    goud_entity *out_entities,
+    uint32_t *out_spawned
+) {
+    uint32_t spawned;
+
+    if (out_spawned != NULL) {
+        *out_spawned = 0;
+    }
+    if (count == 0) {
+        return SUCCESS;
+    }
+    if (out_entities == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    spawned = goud_entity_instantiate(context, prefab, count, out_entities);
+    if (out_spawned != NULL) {
+        *out_spawned = spawned;
+    }
+    return spawned == count ? SUCCESS : goud_status_last_error_or(ERR_INTERNAL_ERROR);
 }
 
-/** @brief Load a font from a file path.
- *  @param context          Valid engine context.
- *  @param path             Null-terminated file path.
- *  @param[out] out_font    Receives the font handle.
- *  @return SUCCESS on success.
- *  @retval ERR_INVALID_STATE  @p out_font is NULL.
+/** @brief Despawn @p count entities in one call.
+ *
+ *  Entities that are already dead or invalid are skipped.
+ *
+ *  @param context             Valid engine context.
+ *  @param entities            Array of @p count entity handles.
+ *  @param count               Number of entities.
+ *  @param[out] out_removed    Optional; receives the number actually despawned.
+ *  @return SUCCESS on success (including @p count == 0).
+ *  @retval ERR_INVALID_STATE  @p entities is NULL with a non-zero @p count.
  */
-static inline int goud_font_load_path(goud_context context, const char *path, goud_font *out_font) {
-    goud_font font;
+static inline int goud_entity_remove_many(
+    goud_context context,
+    const goud_entity *entities,
+    uint32_t count,
+    uint32_t *out_removed
+) {
+    uint32_t removed;
 
-    if (out_font == NULL) {
+    if (out_removed != NULL) {
+        *out_removed = 0;
+    }
+    if (count == 0) {
+        return SUCCESS;
+    }
+    if (entities == NULL) {
         return ERR_INVALID_STATE;
     }
 
-    font = goud_font_load(context, path);
-    *out_font = font;
-    return goud_status_from_handle(font, UINT64_MAX);
+    goud_clear_last_error();
+    removed = goud_entity_despawn_batch(context, entities, count);
+    if (out_removed != NULL) {
+        *out_removed = removed;
+    }
+    return removed == 0 ? goud_status_last_error_or(SUCCESS) : SUCCESS;
 }
 
-/** @brief Destroy a font.
- *  @param context  Valid engine context.
- *  @param font     Font handle to destroy.
- *  @return SUCCESS on success.
+/** @brief Check whether each of @p count entities is alive.
+ *  @param context           Valid engine context.
+ *  @param entities          Array of @p count entity handles.
+ *  @param count             Number of entities.
+ *  @param[out] out_alive    Receives one byte per entity: 1 if alive, else 0.
+ *  @return SUCCESS on success (including @p count == 0).
+ *  @retval ERR_INVALID_STATE  @p entities or @p out_alive is NULL with a non-zero @p count.
  */
-static inline int goud_font_dispose(goud_context context, goud_font font) {
-    return goud_status_from_bool(goud_font_destroy(context, font));
+static inline int goud_entity_alive_many(
+    goud_context context,
+    const goud_entity *entities,
+    uint32_t count,
+    uint8_t *out_alive
+) {
+    if (count == 0) {
+        return SUCCESS;
+    }
+    if (entities == NULL || out_alive == NULL) {
+        return ERR_INVALID_STATE;
+    }
+    if (goud_entity_is_alive_batch(context, entities, count, out_alive) == count) {
+        return SUCCESS;
+    }
+    memset(out_alive, 0, count);
+    return goud_status_last_error_or(ERR_INTERNAL_ERROR);
 }
 
-/** @} */ /* end assets */
-
-/* ========================================================================= */
-/** @defgroup renderer Renderer
- *  Frame management, clear, and draw calls.
- *  @{ */
-/* ========================================================================= */
-
-/** @brief Begin a new render frame.
- *  @param context  Valid engine context.
+/** @brief Register a component type so it can be stored on entities.
+ *
+ *  Registering a type that is already registered succeeds.
+ *
+ *  @param type_id_hash  Stable 64-bit identifier for the type.
+ *  @param name          Null-terminated UTF-8 type name (debugging only).
+ *  @param size          sizeof the component.
+ *  @param align         Alignment of the component.
  *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p name is NULL.
  */
-static inline int goud_renderer_begin_frame(goud_context context) {
-    return goud_status_from_bool(goud_renderer_begin(context));
+static inline int goud_component_register(uint64_t type_id_hash, const char *name, size_t size, size_t align) {
+    if (name == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    /* false means either "already registered" or an error; only the latter sets one. */
+    goud_clear_last_error();
+    if (goud_component_register_type(type_id_hash, (const uint8_t *)name, strlen(name), size, align)) {
+        return SUCCESS;
+    }
+    return goud_status_last_error_or(SUCCESS);
 }
 
-/** @brief End the current render frame.
- *  @param context  Valid engine context.
+/** @brief Add (or replace) a component on an entity.
+ *  @param context       Valid engine context.
+ *  @param entity        Target entity.
+ *  @param type_id_hash  Registered component type.
+ *  @param data          Pointer to @p size bytes of component data.
+ *  @param size          Component size in bytes.
  *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p data is NULL.
  */
-static inline int goud_renderer_end_frame(goud_context context) {
-    return goud_status_from_bool(goud_renderer_end(context));
+static inline int goud_component_set(
+    goud_context context,
+    goud_entity entity,
+    uint64_t type_id_hash,
+    const void *data,
+    size_t size
+) {
+    if (data == NULL) {
+        return ERR_INVALID_STATE;
+    }
+    return goud_status_from_result(goud_component_add(context, entity, type_id_hash, (const uint8_t *)data, size));
 }
 
-/** @brief Clear the framebuffer with a solid colour.
- *  @param context  Valid engine context.
- *  @param color    Clear colour.
+/** @brief Add (or replace) one component on each of @p count entities.
+ *  @param context       Valid engine context.
+ *  @param entities      Array of @p count entities.
+ *  @param count         Number of entities.
+ *  @param type_id_hash  Registered component type.
+ *  @param data          Tightly packed array of @p count components.
+ *  @param size          Size of one component in bytes.
+ *  @param[out] out_added  Optional; receives the number of components added.
+ *  @return SUCCESS when every component was added (including @p count == 0).
+ *  @retval ERR_INVALID_STATE  @p entities or @p data is NULL with a non-zero @p count.
  */
-static inline void goud_renderer_clear_color(goud_context context, goud_color color) {
-    goud_window_clear(context, color.r, color.g, color.b, color.a);
+static inline int goud_component_set_batch(
+    goud_context context,
+    const goud_entity *entities,
+    uint32_t count,
+    uint64_t type_id_hash,
+    const void *data,
+    size_t size,
+    uint32_t *out_added
+) {
+    uint32_t added;
+
+    if (out_added != NULL) {
+        *out_added = 0;
+    }
+    if (count == 0) {
+        return SUCCESS;
+    }
+    if (entities == NULL || data == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    added = goud_component_add_batch(context, entities, count, type_id_hash, (const uint8_t *)data, size);
+    if (out_added != NULL) {
+        *out_added = added;
+    }
+    return added == count ? SUCCESS : goud_status_last_error_or(ERR_COMPONENT_NOT_FOUND);
 }
 
-/** @brief Draw a textured sprite.
- *  @param context   Valid engine context.
- *  @param texture   Texture handle.
- *  @param x         X position.
- *  @param y         Y position.
- *  @param width     Sprite width.
- *  @param height    Sprite height.
- *  @param rotation  Rotation in radians.
- *  @param color     Tint colour.
+/** @brief Remove a component from an entity.
+ *  @param context       Valid engine context.
+ *  @param entity        Target entity.
+ *  @param type_id_hash  Registered component type.
  *  @return SUCCESS on success.
  */
-static inline int goud_renderer_draw_sprite_color(
-    goud_context context,
-    goud_texture texture,
-    float x,
-    float y,
-    float width,
-    float height,
-    float rotation,
-    goud_color color
-) {
-    return goud_status_from_bool(
-        goud_renderer_draw_sprite(
-            context,
-            texture,
-            x,
-            y,
-            width,
-            height,
-            rotation,
-            color.r,
-            color.g,
-            color.b,
-            color.a
-        )
-    );
+static inline int goud_component_unset(goud_context context, goud_entity entity, uint64_t type_id_hash) {
+    return goud_status_from_result(goud_component_remove(context, entity, type_id_hash));
 }
 
-/** @brief Draw a solid-colour quad.
- *  @param context  Valid engine context.
- *  @param x        X position.
- *  @param y        Y position.
- *  @param width    Quad width.
- *  @param height   Quad height.
- *  @param color    Fill colour.
+/** @brief Create an entity pool with @p capacity pre-allocated slots.
+ *  @param capacity        Number of slots.
+ *  @param[out] out_pool   Receives the pool handle.
  *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_pool is NULL.
  */
-static inline int goud_renderer_draw_quad_color(
-    goud_context context,
-    float x,
-    float y,
-    float width,
-    float height,
-    goud_color color
-) {
-    return goud_status_from_bool(
-        goud_renderer_draw_quad(context, x, y, width, height, color.r, color.g, color.b, color.a)
-    );
+static inline int goud_entity_pool_init(uint32_t capacity, goud_entity_pool *out_pool) {
+    if (out_pool == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    *out_pool = goud_entity_pool_create(capacity);
+    return *out_pool == GOUD_INVALID_POOL_HANDLE ? goud_status_last_error_or(ERR_INTERNAL_ERROR) : SUCCESS;
 }
 
-/** @brief Retrieve per-frame render statistics.
- *  @param context            Valid engine context.
- *  @param[out] out_stats     Receives the stats struct.
+/** @brief Destroy an entity pool and reset the handle to invalid.
+ *  @param[in,out] pool  Pointer to the pool handle.  Set to invalid on success.
  *  @return SUCCESS on success.
- *  @retval ERR_INVALID_STATE  @p out_stats is NULL.
+ *  @retval ERR_INVALID_STATE  @p pool is NULL.
  */
-static inline int goud_renderer_stats(goud_context context, goud_render_stats *out_stats) {
-    if (out_stats == NULL) {
+static inline int goud_entity_pool_dispose(goud_entity_pool *pool) {
+    if (pool == NULL) {
         return ERR_INVALID_STATE;
     }
-    return goud_status_from_bool(goud_renderer_get_stats(context, out_stats));
-}
+    if (*pool == GOUD_INVALID_POOL_HANDLE) {
+        return SUCCESS;
+    }
 
-/** @} */ /* end renderer */
+    int32_t code = goud_entity_pool_destroy(*pool);
+    if (code != 0) {
+        return goud_status_last_error_or((int)code);
+    }
+    *pool = GOUD_INVALID_POOL_HANDLE;
+    return SUCCESS;
+}
 
-/* ========================================================================= */
-/** @defgroup input Input
- *  Keyboard and mouse state queries.
- *  @{ */
-/* ========================================================================= */
+/** @brief Acquire up to @p count slots from a pool.
+ *  @param pool               Valid pool handle.
+ *  @param count              Number of slots to acquire.
+ *  @param[out] out_slots     Receives the acquired slot indices.
+ *  @param[out] out_acquired  Optional; receives the number of slots acquired.
+ *  @return SUCCESS when all @p count slots were acquired (including @p count == 0).
+ *  @retval ERR_INVALID_STATE  @p out_slots is NULL, or the pool ran out of slots.
+ */
+static inline int goud_entity_pool_acquire_slots(
+    goud_entity_pool pool,
+    uint32_t count,
+    uint32_t *out_slots,
+    uint32_t *out_acquired
+) {
+    uint32_t acquired;
 
-/** @brief Test whether a key is currently held down.
- *  @param context  Valid engine context.
- *  @param key      Key code.
- *  @return true if the key is pressed.
- */
-static inline bool goud_input_key_down(goud_context context, goud_key key) {
-    return goud_input_key_pressed(context, key);
+    if (out_acquired != NULL) {
+        *out_acquired = 0;
+    }
+    if (count == 0) {
+        return SUCCESS;
+    }
+    if (out_slots == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    goud_clear_last_error();
+    acquired = goud_entity_pool_acquire_batch_slots(pool, count, NULL, out_slots);
+    if (out_acquired != NULL) {
+        *out_acquired = acquired;
+    }
+    return acquired == count ? SUCCESS : goud_status_last_error_or(ERR_INVALID_STATE);
 }
 
-/** @brief Test whether a key was pressed this frame (edge trigger).
- *  @param context  Valid engine context.
- *  @param key      Key code.
- *  @return true if the key was just pressed.
+/** @brief Return slots to a pool.
+ *  @param pool               Valid pool handle.
+ *  @param slots              Array of @p count slot indices.
+ *  @param count              Number of slots.
+ *  @param[out] out_released  Optional; receives the number of slots released.
+ *  @return SUCCESS when every slot was released (including @p count == 0).
+ *  @retval ERR_INVALID_STATE  @p slots is NULL, or a slot was out of range or already free.
  */
-static inline bool goud_input_key_pressed_once(goud_context context, goud_key key) {
-    return goud_input_key_just_pressed(context, key);
+static inline int goud_entity_pool_release_slots(
+    goud_entity_pool pool,
+    const uint32_t *slots,
+    uint32_t count,
+    uint32_t *out_released
+) {
+    uint32_t released;
+
+    if (out_released != NULL) {
+        *out_released = 0;
+    }
+    if (count == 0) {
+        return SUCCESS;
+    }
+    if (slots == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    goud_clear_last_error();
+    released = goud_entity_pool_release_batch(pool, slots, count);
+    if (out_released != NULL) {
+        *out_released = released;
+    }
+    return released == count ? SUCCESS : goud_status_last_error_or(ERR_INVALID_STATE);
 }
 
-/** @brief Test whether a mouse button is currently held down.
- *  @param context  Valid engine context.
- *  @param button   Mouse button.
- *  @return true if the button is pressed.
+/** @brief Read an entity pool's diagnostic counters.
+ *  @param pool            Valid pool handle.
+ *  @param[out] out_stats  Receives the counters.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_stats is NULL.
  */
-static inline bool goud_input_mouse_down(goud_context context, goud_mouse_button button) {
-    return goud_input_mouse_button_pressed(context, button);
+static inline int goud_entity_pool_get_stats(goud_entity_pool pool, goud_pool_stats *out_stats) {
+    if (out_stats == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    int32_t code = goud_entity_pool_stats(pool, out_stats);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
 }
 
-/** @brief Get the current mouse cursor position.
- *  @param context              Valid engine context.
- *  @param[out] out_position    Receives the (x, y) position.
+/** @brief Save a context's entities and components for rollback.
+ *
+ *  Saves typed ECS components (built-in engine components and types
+ *  registered as cloneable) and every goud_component_add() component.
+ *  Physics is saved separately with goud_physics_state_capture().
+ *
+ *  @param context            Valid engine context.
+ *  @param[out] out_snapshot  Receives the snapshot handle.
  *  @return SUCCESS on success.
- *  @retval ERR_INVALID_STATE   @p out_position is NULL.
+ *  @retval ERR_INVALID_STATE  @p out_snapshot is NULL, or the world holds
+ *                             components that cannot be cloned.
  */
-static inline int goud_input_mouse_position(goud_context context, goud_vec2 *out_position) {
-    if (out_position == NULL) {
+static inline int goud_world_snapshot_take(goud_context context, goud_world_snapshot *out_snapshot) {
+    goud_world_snapshot snapshot;
+
+    if (out_snapshot == NULL) {
         return ERR_INVALID_STATE;
     }
-    return goud_status_from_bool(goud_input_get_mouse_position(context, &out_position->x, &out_position->y));
+
+    snapshot = goud_world_snapshot_save(context);
+    *out_snapshot = snapshot;
+    return snapshot >= 0 ? SUCCESS : goud_status_last_error_or(ERR_INTERNAL_ERROR);
 }
 
-/** @brief Get the mouse scroll delta for this frame.
- *  @param context          Valid engine context.
- *  @param[out] out_delta   Receives the (x, y) scroll delta.
+/** @brief Overwrite a snapshot with the context's current state.
+ *
+ *  The per-frame call for a rollback ring: buffers are reused and component
+ *  types unchanged since the last save or restore are shared, not copied.
+ *
+ *  @param context   Valid engine context.
+ *  @param snapshot  Snapshot handle from goud_world_snapshot_take().
+ *  @return SUCCESS on success; the snapshot is unchanged on failure.
+ */
+static inline int goud_world_snapshot_update(goud_context context, goud_world_snapshot snapshot) {
+    int32_t code = goud_world_snapshot_save_into(context, snapshot);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Roll a context's entities and components back to a snapshot.
+ *  @param context   Valid engine context.
+ *  @param snapshot  Snapshot handle.
  *  @return SUCCESS on success.
- *  @retval ERR_INVALID_STATE  @p out_delta is NULL.
  */
-static inline int goud_input_scroll_delta(goud_context context, goud_vec2 *out_delta) {
-    if (out_delta == NULL) {
+static inline int goud_world_snapshot_rollback(goud_context context, goud_world_snapshot snapshot) {
+    int32_t code = goud_world_snapshot_restore(context, snapshot);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Free a world snapshot.
+ *  @param snapshot  Snapshot handle.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_world_snapshot_free(goud_world_snapshot snapshot) {
+    int32_t code = goud_world_snapshot_destroy(snapshot);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Read a snapshot's entity, column and byte counts.
+ *  @param snapshot        Snapshot handle.
+ *  @param[out] out_stats  Receives the counts.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_stats is NULL.
+ */
+static inline int goud_world_snapshot_stats_get(goud_world_snapshot snapshot, goud_world_snapshot_stats *out_stats) {
+    if (out_stats == NULL) {
         return ERR_INVALID_STATE;
     }
-    return goud_status_from_bool(goud_input_get_scroll_delta(context, &out_delta->x, &out_delta->y));
+
+    int32_t code = goud_world_snapshot_get_stats(snapshot, out_stats);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
 }
 
-/** @} */ /* end input */
+/** @} */ /* end ecs */
 
 /* ========================================================================= */
-/** @defgroup window Window / Game Loop
- *  Window lifecycle, event polling, and frame timing.
+/** @defgroup memory Frame Memory
+ *  Bump arenas for memory that lives for one frame: one per process, plus
+ *  one per context for worlds ticked on their own threads.
  *  @{ */
 /* ========================================================================= */
 
-/** @brief Check whether the window close has been requested.
- *  @param context  Valid engine context.
- *  @return true if the window should close.  Returns true for invalid contexts.
+/** @brief Allocate from the frame arena.
+ *
+ *  The memory is uninitialised, must not be freed individually, and stays
+ *  valid until the next goud_frame_arena_clear().
+ *
+ *  @param size          Number of bytes.
+ *  @param align         Alignment in bytes; a power of two.
+ *  @param[out] out_ptr  Receives the allocation.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_ptr is NULL or @p align is not a power of two.
  */
-static inline bool goud_window_should_close_checked(goud_context context) {
-    if (!goud_context_valid(context)) {
-        return true;
+static inline int goud_frame_arena_allocate(size_t size, size_t align, void **out_ptr) {
+    uint8_t *ptr;
+
+    if (out_ptr == NULL) {
+        return ERR_INVALID_STATE;
     }
-    return goud_window_should_close(context);
+
+    ptr = goud_frame_arena_alloc(size, align);
+    *out_ptr = ptr;
+    return ptr != NULL ? SUCCESS : goud_status_last_error_or(ERR_INTERNAL_ERROR);
 }
 
-/** @brief Poll window events and return the frame delta time.
- *  @param context  Valid engine context.
- *  @return Delta time in seconds.  Returns 0 for invalid contexts.
+/** @brief Free every frame arena allocation at once.
+ *
+ *  Call once per frame, after the last use of that frame's allocations.
+ *
+ *  @return SUCCESS on success.
  */
-static inline float goud_window_poll_events_checked(goud_context context) {
-    if (!goud_context_valid(context)) {
-        return 0.0f;
-    }
-    return goud_window_poll_events(context);
+static inline int goud_frame_arena_clear(void) {
+    int32_t code = goud_frame_arena_reset();
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
 }
 
-/** @brief Swap the front and back framebuffers.
- *  @param context  Valid engine context.  No-op for invalid contexts.
+/** @brief Read the frame arena's counters.
+ *  @param[out] out_stats  Receives bytes allocated, capacity, and reset count.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_stats is NULL.
  */
-static inline void goud_window_swap_buffers_checked(goud_context context) {
-    if (!goud_context_valid(context)) {
-        return;
+static inline int goud_frame_arena_get_stats(goud_arena_stats *out_stats) {
+    int32_t code;
+
+    if (out_stats == NULL) {
+        return ERR_INVALID_STATE;
     }
-    goud_window_swap_buffers(context);
+
+    code = goud_frame_arena_stats(out_stats);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
 }
 
-/** @brief Enable alpha blending for the renderer.
- *  @param context  Valid engine context.  No-op for invalid contexts.
+/** @brief Allocate from a context's own frame arena.
+ *
+ *  Same contract as goud_frame_arena_allocate(), but the memory belongs to
+ *  @p context and stays valid until goud_context_frame_arena_clear() or the
+ *  context's destruction.
+ *
+ *  @param context       Valid engine context.
+ *  @param size          Number of bytes.
+ *  @param align         Alignment in bytes; a power of two.
+ *  @param[out] out_ptr  Receives the allocation.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_ptr is NULL or @p align is not a power of two.
  */
-static inline void goud_renderer_enable_blending_checked(goud_context context) {
-    if (!goud_context_valid(context)) {
-        return;
+static inline int goud_context_frame_arena_allocate(goud_context context, size_t size, size_t align, void **out_ptr) {
+    uint8_t *ptr;
+
+    if (out_ptr == NULL) {
+        return ERR_INVALID_STATE;
     }
-    goud_renderer_enable_blending(context);
+
+    ptr = goud_context_frame_arena_alloc(context, size, align);
+    *out_ptr = ptr;
+    return ptr != NULL ? SUCCESS : goud_status_last_error_or(ERR_INTERNAL_ERROR);
 }
 
-/** @brief Get the delta time for the current frame.
+/** @brief Free every allocation in a context's frame arena at once.
  *  @param context  Valid engine context.
- *  @return Delta time in seconds.  Returns 0 for invalid contexts.
+ *  @return SUCCESS on success.
  */
-static inline float goud_window_delta_time(goud_context context) {
-    if (!goud_context_valid(context)) {
-        return 0.0f;
+static inline int goud_context_frame_arena_clear(goud_context context) {
+    int32_t code = goud_context_frame_arena_reset(context);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Read a context's frame arena counters.
+ *  @param context         Valid engine context.
+ *  @param[out] out_stats  Receives bytes allocated, capacity, and reset count.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_stats is NULL.
+ */
+static inline int goud_context_frame_arena_get_stats(goud_context context, goud_arena_stats *out_stats) {
+    int32_t code;
+
+    if (out_stats == NULL) {
+        return ERR_INVALID_STATE;
     }
-    return goud_window_get_delta_time(context);
+
+    code = goud_context_frame_arena_stats(context, out_stats);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
 }
 
-/** @} */ /* end window */
+/** @} */ /* end memory */
 
 /* ========================================================================= */
-/** @defgroup audio Audio
- *  Audio playback and volume control.
+/** @defgroup assets Assets
+ *  Load and destroy texture and font assets, and read them from asset packs.
  *  @{ */
 /* ========================================================================= */
 
-/** @brief Activate the audio subsystem.
- *  @param context  Valid engine context.
- *  @return Non-negative value on success, negative error code on failure.
+/** @brief Load a texture from a file path.
+ *  @param context              Valid engine context.
+ *  @param path                 Null-terminated file path.
+ *  @param[out] out_texture     Receives the texture handle.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE   @p out_texture is NULL.
  */
-static inline int goud_audio_activate_checked(goud_context context) {
-    int status = goud_audio_activate(context);
-    return status >= 0 ? status : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+static inline int goud_texture_load_path(goud_context context, const char *path, goud_texture *out_texture) {
+    goud_texture texture;
+
+    if (out_texture == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    texture = goud_texture_load(context, path);
+    *out_texture = texture;
+    return goud_status_from_handle(texture, UINT64_MAX);
 }
 
-/** @brief Play audio from an in-memory buffer.
+/** @brief Create a texture from tightly packed RGBA8 pixels.
+ *
+ *  Pair with goud_image_decode() to decode on a worker thread and upload
+ *  on the thread that owns @p context.
+ *
  *  @param context              Valid engine context.
- *  @param asset_data           Pointer to audio data.
- *  @param asset_len            Length of @p asset_data in bytes.
- *  @param[out] out_player      Receives the player handle.
+ *  @param pixels               @p width * @p height * 4 bytes, row-major.
+ *  @param width                Width in pixels.
+ *  @param height               Height in pixels.
+ *  @param[out] out_texture     Receives the texture handle.
  *  @return SUCCESS on success.
- *  @retval ERR_INVALID_STATE   @p asset_data or @p out_player is NULL.
+ *  @retval ERR_INVALID_STATE   @p pixels or @p out_texture is NULL.
  */
-static inline int goud_audio_play_memory(
+static inline int goud_texture_upload_rgba8(
     goud_context context,
-    const void *asset_data,
-    size_t asset_len,
-    goud_audio_player *out_player
+    const uint8_t *pixels,
+    uint32_t width,
+    uint32_t height,
+    goud_texture *out_texture
 ) {
-    goud_audio_player player;
+    goud_texture texture;
 
-    if (asset_data == NULL || out_player == NULL) {
+    if (pixels == NULL || out_texture == NULL) {
         return ERR_INVALID_STATE;
     }
 
-    player = goud_audio_play(context, (const uint8_t *)asset_data, asset_len);
-    *out_player = player;
-    return player >= 0 ? SUCCESS : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+    texture = goud_texture_create_rgba8(context, pixels, width, height);
+    *out_texture = texture;
+    return goud_status_from_handle(texture, UINT64_MAX);
 }
 
-/** @brief Stop an active audio player.
- *  @param context    Valid engine context.
- *  @param player_id  Player handle returned by goud_audio_play_memory().
- *  @return Non-negative value on success, negative error code on failure.
- *  @retval ERR_INVALID_STATE  @p player_id is negative.
+/** @brief Read the dimensions of an encoded image without decoding it.
+ *
+ *  Context-free; safe to call from any thread.
+ *
+ *  @param data             Encoded image bytes (PNG, JPEG, ...).
+ *  @param len              Length of @p data in bytes.
+ *  @param[out] out_width   Receives the width in pixels.
+ *  @param[out] out_height  Receives the height in pixels.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  A pointer argument is NULL.
  */
-static inline int goud_audio_stop_checked(goud_context context, goud_audio_player player_id) {
-    if (player_id < 0) {
+static inline int goud_image_size(const void *data, size_t len, uint32_t *out_width, uint32_t *out_height) {
+    if (data == NULL || out_width == NULL || out_height == NULL) {
         return ERR_INVALID_STATE;
     }
-    int status = goud_audio_stop(context, (uint64_t)player_id);
-    return status >= 0 ? status : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+    return goud_status_from_bool(goud_image_get_size((const uint8_t *)data, len, out_width, out_height));
 }
 
-/** @brief Set the global audio volume.
+/** @brief Decode an encoded image into tightly packed RGBA8.
+ *
+ *  Context-free; safe to call from any thread.  Size @p out_pixels with
+ *  goud_image_size() first.
+ *
+ *  @param data              Encoded image bytes (PNG, JPEG, ...).
+ *  @param len               Length of @p data in bytes.
+ *  @param[out] out_pixels   Receives width * height * 4 bytes.
+ *  @param out_capacity      Size of @p out_pixels in bytes.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  A pointer is NULL or @p out_capacity is too small.
+ */
+static inline int goud_image_decode(const void *data, size_t len, uint8_t *out_pixels, size_t out_capacity) {
+    if (data == NULL || out_pixels == NULL) {
+        return ERR_INVALID_STATE;
+    }
+    return goud_status_from_bool(goud_image_decode_rgba8((const uint8_t *)data, len, out_pixels, out_capacity));
+}
+
+/** @brief Destroy a texture.
  *  @param context  Valid engine context.
- *  @param volume   Volume level (0.0 = mute, 1.0 = full).
- *  @return Non-negative value on success, negative error code on failure.
+ *  @param texture  Texture handle to destroy.
+ *  @return SUCCESS on success.
  */
-static inline int goud_audio_set_global_volume_checked(goud_context context, float volume) {
-    int status = goud_audio_set_global_volume(context, volume);
-    return status >= 0 ? status : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+static inline int goud_texture_dispose(goud_context context, goud_texture texture) {
+    return goud_status_from_bool(goud_texture_destroy(context, texture));
 }
 
-/** @} */ /* end audio */
+/** @brief Load an image file as a streamed texture.
+ *
+ *  Only a base tier of at most 64 pixels on the longer edge is uploaded
+ *  now.  Sprite draws report how large the texture appears on screen, and
+ *  goud_renderer_end() uploads finer tiers as needed, returning
+ *  least-recently-drawn textures to their base tier to stay within the
+ *  budget set by goud_texture_streaming_budget().  The handle reports the
+ *  full image size and is destroyed with goud_texture_dispose().
+ *
+ *  @param context           Valid engine context.
+ *  @param path              Null-terminated file path.
+ *  @param[out] out_texture  Receives the texture handle.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p path or @p out_texture is NULL.
+ */
+static inline int goud_texture_stream_path(goud_context context, const char *path, goud_texture *out_texture) {
+    goud_texture texture;
+
+    if (out_texture == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    texture = goud_texture_stream_load(context, path);
+    *out_texture = texture;
+    return goud_status_from_handle(texture, GOUD_INVALID_TEXTURE);
+}
+
+/** @brief Load an encoded image from memory as a streamed texture.
+ *
+ *  The bytes are copied.  See goud_texture_stream_path().
+ *
+ *  @param context           Valid engine context.
+ *  @param data              Encoded image bytes (PNG, JPEG, ...).
+ *  @param len               Length of @p data in bytes.
+ *  @param[out] out_texture  Receives the texture handle.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p data or @p out_texture is NULL.
+ */
+static inline int goud_texture_stream_bytes(
+    goud_context context,
+    const void *data,
+    size_t len,
+    goud_texture *out_texture
+) {
+    goud_texture texture;
+
+    if (data == NULL || out_texture == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    texture = goud_texture_stream_load_memory(context, (const uint8_t *)data, len);
+    *out_texture = texture;
+    return goud_status_from_handle(texture, GOUD_INVALID_TEXTURE);
+}
+
+/** @brief Set the GPU residency budget for the context's streamed textures.
+ *
+ *  Base tiers are never evicted, so a budget below their total is exceeded
+ *  rather than enforced.
+ *
+ *  @param context       Valid engine context.
+ *  @param budget_bytes  Budget for resident texel bytes.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_texture_streaming_budget(goud_context context, uint64_t budget_bytes) {
+    return goud_status_from_bool(goud_texture_streaming_set_budget(context, budget_bytes));
+}
+
+/** @brief Retrieve texture streaming residency and eviction counters.
+ *
+ *  Resident bytes are also reported as the assets category of
+ *  goud_debugger_get_memory_summary().
+ *
+ *  @param context          Valid engine context.
+ *  @param[out] out_stats   Receives the counters.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_stats is NULL.
+ */
+static inline int goud_texture_streaming_stats(goud_context context, goud_texture_stream_stats *out_stats) {
+    if (out_stats == NULL) {
+        return ERR_INVALID_STATE;
+    }
+    return goud_status_from_bool(goud_texture_streaming_get_stats(context, out_stats));
+}
+
+/** @brief Load a font from a file path.
+ *  @param context          Valid engine context.
+ *  @param path             Null-terminated file path.
+ *  @param[out] out_font    Receives the font handle.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_font is NULL.
+ */
+static inline int goud_font_load_path(goud_context context, const char *path, goud_font *out_font) {
+    goud_font font;
+
+    if (out_font == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    font = goud_font_load(context, path);
+    *out_font = font;
+    return goud_status_from_handle(font, UINT64_MAX);
+}
+
+/** @brief Load a font from an in-memory TTF/OTF buffer.
+ *  @param context          Valid engine context.
+ *  @param data             Font file bytes (copied by the engine).
+ *  @param len              Length of @p data in bytes.
+ *  @param[out] out_font    Receives the font handle.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p data or @p out_font is NULL.
+ */
+static inline int goud_font_load_bytes(goud_context context, const void *data, size_t len, goud_font *out_font) {
+    goud_font font;
+
+    if (data == NULL || out_font == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    font = goud_font_load_memory(context, (const uint8_t *)data, len);
+    *out_font = font;
+    return goud_status_from_handle(font, UINT64_MAX);
+}
+
+/** @brief Destroy a font.
+ *  @param context  Valid engine context.
+ *  @param font     Font handle to destroy.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_font_dispose(goud_context context, goud_font font) {
+    return goud_status_from_bool(goud_font_destroy(context, font));
+}
+
+/** @brief Create an empty texture atlas page.
+ *  @param context          Valid engine context.
+ *  @param category         Null-terminated label (e.g. "ui", "sprites").
+ *  @param max_width        Page width in pixels (0 = 2048, at most 8192).
+ *  @param max_height       Page height in pixels (0 = 2048, at most 8192).
+ *  @param[out] out_atlas   Receives the atlas handle.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p category or @p out_atlas is NULL.
+ */
+static inline int goud_atlas_init(
+    goud_context context,
+    const char *category,
+    uint32_t max_width,
+    uint32_t max_height,
+    goud_atlas *out_atlas
+) {
+    goud_atlas atlas;
+
+    if (category == NULL || out_atlas == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    atlas = goud_atlas_create(context, category, max_width, max_height);
+    *out_atlas = atlas;
+    return goud_status_from_handle(atlas, GOUD_INVALID_ATLAS);
+}
+
+/** @brief Pack tightly packed RGBA8 pixels into an atlas under @p key.
+ *
+ *  Fails when @p key is already used or the image does not fit in the
+ *  space left on the page.
+ *
+ *  @param context  Valid engine context.
+ *  @param atlas    Atlas handle.
+ *  @param key      Null-terminated key used with goud_atlas_lookup().
+ *  @param pixels   @p width * @p height * 4 bytes, row-major.
+ *  @param width    Width in pixels.
+ *  @param height   Height in pixels.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p key or @p pixels is NULL.
+ */
+static inline int goud_atlas_pack_pixels(
+    goud_context context,
+    goud_atlas atlas,
+    const char *key,
+    const uint8_t *pixels,
+    uint32_t width,
+    uint32_t height
+) {
+    if (key == NULL || pixels == NULL) {
+        return ERR_INVALID_STATE;
+    }
+    return goud_status_from_bool(goud_atlas_add_pixels(context, atlas, key, pixels, width, height));
+}
+
+/** @brief Upload an atlas page to the GPU.
+ *
+ *  The texture is owned by the atlas and destroyed with it.
+ *
+ *  @param context              Valid engine context.
+ *  @param atlas                Atlas handle.
+ *  @param[out] out_texture     Receives the page texture.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE   @p out_texture is NULL.
+ */
+static inline int goud_atlas_upload(goud_context context, goud_atlas atlas, goud_texture *out_texture) {
+    goud_texture texture;
+
+    if (out_texture == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    texture = goud_atlas_finalize(context, atlas);
+    *out_texture = texture;
+    return goud_status_from_handle(texture, UINT64_MAX);
+}
+
+/** @brief Look up where @p key was packed.
+ *  @param context          Valid engine context.
+ *  @param atlas            Atlas handle.
+ *  @param key              Null-terminated key passed to goud_atlas_pack_pixels().
+ *  @param[out] out_entry   Receives the UV and pixel rectangles.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p key or @p out_entry is NULL.
+ */
+static inline int goud_atlas_lookup(
+    goud_context context,
+    goud_atlas atlas,
+    const char *key,
+    goud_atlas_entry *out_entry
+) {
+    if (key == NULL || out_entry == NULL) {
+        return ERR_INVALID_STATE;
+    }
+    return goud_status_from_bool(goud_atlas_get_entry(context, atlas, key, out_entry));
+}
+
+/** @brief Destroy an atlas and its page texture.
+ *  @param context  Valid engine context.
+ *  @param atlas    Atlas handle.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_atlas_dispose(goud_context context, goud_atlas atlas) {
+    return goud_status_from_bool(goud_atlas_destroy(context, atlas));
+}
+
+/** @brief Compute the name hash that identifies an entry in an asset pack.
+ *
+ *  Same 64-bit FNV-1a as goud_asset_pack_hash(), inline so hashes of
+ *  constant names can be folded by the compiler.
+ *
+ *  @param name  Null-terminated entry name: a path relative to the packed
+ *               directory, with forward slashes.
+ *  @return The entry's name hash.
+ */
+static inline uint64_t goud_asset_pack_name_hash(const char *name) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+
+    if (name == NULL) {
+        return hash;
+    }
+    while (*name != '\0') {
+        hash ^= (uint8_t)*name++;
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+/** @brief Memory-map an asset pack built with the goud_pack tool.
+ *
+ *  The file must not be modified while the pack is open.
+ *
+ *  @param path           Null-terminated path to the pack file.
+ *  @param[out] out_pack  Receives the pack handle.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p path or @p out_pack is NULL.
+ */
+static inline int goud_asset_pack_load(const char *path, goud_asset_pack *out_pack) {
+    goud_asset_pack pack;
+
+    if (path == NULL || out_pack == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    pack = goud_asset_pack_open(path);
+    *out_pack = pack;
+    return goud_status_from_handle(pack, GOUD_INVALID_ASSET_PACK);
+}
+
+/** @brief Open an asset pack from an in-memory buffer.
+ *  @param data           Pack file bytes (copied by the engine).
+ *  @param len            Length of @p data in bytes.
+ *  @param[out] out_pack  Receives the pack handle.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p data or @p out_pack is NULL.
+ */
+static inline int goud_asset_pack_load_bytes(const void *data, size_t len, goud_asset_pack *out_pack) {
+    goud_asset_pack pack;
+
+    if (data == NULL || out_pack == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    pack = goud_asset_pack_open_memory((const uint8_t *)data, len);
+    *out_pack = pack;
+    return goud_status_from_handle(pack, GOUD_INVALID_ASSET_PACK);
+}
+
+/** @brief Close an asset pack.
+ *
+ *  Views from goud_asset_pack_view() are invalid afterwards; assets already
+ *  loaded from the pack are unaffected.
+ *
+ *  @param pack  Pack handle.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_asset_pack_release(goud_asset_pack pack) {
+    int32_t code = goud_asset_pack_close(pack);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Get the decompressed size of a pack entry.
+ *  @param pack           Pack handle.
+ *  @param name_hash      Entry hash from goud_asset_pack_name_hash().
+ *  @param[out] out_size  Receives the size in bytes.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_size is NULL.
+ */
+static inline int goud_asset_pack_size(goud_asset_pack pack, uint64_t name_hash, uint64_t *out_size) {
+    int32_t code;
+
+    if (out_size == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    code = goud_asset_pack_entry_size(pack, name_hash, out_size);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Borrow an uncompressed pack entry's bytes in place.
+ *
+ *  No copy is made: @p out_data points into the pack's memory mapping and
+ *  stays valid until goud_asset_pack_release().  Compressed entries cannot
+ *  be borrowed; use goud_asset_pack_copy() for those.
+ *
+ *  @param pack           Pack handle.
+ *  @param name_hash      Entry hash from goud_asset_pack_name_hash().
+ *  @param[out] out_data  Receives a read-only pointer to the entry bytes.
+ *  @param[out] out_len   Receives the entry length in bytes.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  An out pointer is NULL or the entry is compressed.
+ */
+static inline int goud_asset_pack_view(
+    goud_asset_pack pack,
+    uint64_t name_hash,
+    const void **out_data,
+    size_t *out_len
+) {
+    const uint8_t *data = NULL;
+    int32_t code;
+
+    if (out_data == NULL || out_len == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    code = goud_asset_pack_entry_data(pack, name_hash, &data, out_len);
+    *out_data = data;
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Copy a pack entry's decompressed bytes into a caller buffer.
+ *
+ *  Size @p out_buf with goud_asset_pack_size() first.
+ *
+ *  @param pack          Pack handle.
+ *  @param name_hash     Entry hash from goud_asset_pack_name_hash().
+ *  @param[out] out_buf  Receives the entry bytes.
+ *  @param capacity      Size of @p out_buf in bytes.
+ *  @param[out] out_len  Receives the entry length, even when @p capacity is too small.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  A pointer is NULL or @p capacity is too small.
+ */
+static inline int goud_asset_pack_copy(
+    goud_asset_pack pack,
+    uint64_t name_hash,
+    void *out_buf,
+    size_t capacity,
+    size_t *out_len
+) {
+    int32_t code;
+
+    if (out_buf == NULL || out_len == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    code = goud_asset_pack_read(pack, name_hash, (uint8_t *)out_buf, capacity, out_len);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Load a texture from an encoded image in an asset pack.
+ *  @param context           Valid engine context.
+ *  @param pack              Pack handle.
+ *  @param name_hash         Entry hash from goud_asset_pack_name_hash().
+ *  @param[out] out_texture  Receives the texture handle.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_texture is NULL.
+ */
+static inline int goud_texture_load_pack(
+    goud_context context,
+    goud_asset_pack pack,
+    uint64_t name_hash,
+    goud_texture *out_texture
+) {
+    goud_texture texture;
+
+    if (out_texture == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    texture = goud_texture_load_from_pack(context, pack, name_hash);
+    *out_texture = texture;
+    return goud_status_from_handle(texture, GOUD_INVALID_TEXTURE);
+}
+
+/** @brief Load an encoded image entry as a streamed texture.
+ *
+ *  See goud_texture_stream_path().
+ *
+ *  @param context           Valid engine context.
+ *  @param pack              Pack handle.
+ *  @param name_hash         Entry hash from goud_asset_pack_name_hash().
+ *  @param[out] out_texture  Receives the texture handle.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_texture is NULL.
+ */
+static inline int goud_texture_stream_pack(
+    goud_context context,
+    goud_asset_pack pack,
+    uint64_t name_hash,
+    goud_texture *out_texture
+) {
+    goud_texture texture;
+
+    if (out_texture == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    texture = goud_texture_stream_load_from_pack(context, pack, name_hash);
+    *out_texture = texture;
+    return goud_status_from_handle(texture, GOUD_INVALID_TEXTURE);
+}
+
+/** @brief Load a TTF/OTF font from an asset pack.
+ *  @param context        Valid engine context.
+ *  @param pack           Pack handle.
+ *  @param name_hash      Entry hash from goud_asset_pack_name_hash().
+ *  @param[out] out_font  Receives the font handle.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_font is NULL.
+ */
+static inline int goud_font_load_pack(
+    goud_context context,
+    goud_asset_pack pack,
+    uint64_t name_hash,
+    goud_font *out_font
+) {
+    goud_font font;
+
+    if (out_font == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    font = goud_font_load_from_pack(context, pack, name_hash);
+    *out_font = font;
+    return goud_status_from_handle(font, GOUD_INVALID_FONT);
+}
+
+/** @brief Play encoded audio from an asset pack on the SFX channel.
+ *  @param context          Valid engine context.
+ *  @param pack             Pack handle.
+ *  @param name_hash        Entry hash from goud_asset_pack_name_hash().
+ *  @param[out] out_player  Receives the player handle.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_player is NULL.
+ */
+static inline int goud_audio_play_pack(
+    goud_context context,
+    goud_asset_pack pack,
+    uint64_t name_hash,
+    goud_audio_player *out_player
+) {
+    goud_audio_player player;
+
+    if (out_player == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    player = goud_audio_play_from_pack(context, pack, name_hash);
+    *out_player = player;
+    return player >= 0 ? SUCCESS : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+}
+
+/** @brief Load a JSON or packed binary scene from an asset pack.
+ *  @param context         Valid engine context.
+ *  @param pack            Pack handle.
+ *  @param name_hash       Entry hash from goud_asset_pack_name_hash().
+ *  @param name            Null-terminated name to register the scene under.
+ *  @param[out] out_scene  Receives the scene ID.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p name or @p out_scene is NULL.
+ */
+static inline int goud_scene_load_pack(
+    goud_context context,
+    goud_asset_pack pack,
+    uint64_t name_hash,
+    const char *name,
+    uint32_t *out_scene
+) {
+    uint32_t scene;
+
+    if (name == NULL || out_scene == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    scene = goud_scene_load_from_pack(context, pack, name_hash, (const uint8_t *)name, (uint32_t)strlen(name));
+    *out_scene = scene;
+    return scene != UINT32_MAX ? SUCCESS : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+}
+
+/** @} */ /* end assets */
+
+/* ========================================================================= */
+/** @defgroup renderer Renderer
+ *  Frame management, clear, and draw calls.
+ *  @{ */
+/* ========================================================================= */
+
+/** @brief Begin a new render frame.
+ *  @param context  Valid engine context.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_renderer_begin_frame(goud_context context) {
+    return goud_status_from_bool(goud_renderer_begin(context));
+}
+
+/** @brief End the current render frame.
+ *  @param context  Valid engine context.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_renderer_end_frame(goud_context context) {
+    return goud_status_from_bool(goud_renderer_end(context));
+}
+
+/** @brief Clear the framebuffer with a solid colour.
+ *  @param context  Valid engine context.
+ *  @param color    Clear colour.
+ */
+static inline void goud_renderer_clear_color(goud_context context, goud_color color) {
+    goud_window_clear(context, color.r, color.g, color.b, color.a);
+}
+
+/** @brief Draw a textured sprite.
+ *  @param context   Valid engine context.
+ *  @param texture   Texture handle.
+ *  @param x         X position.
+ *  @param y         Y position.
+ *  @param width     Sprite width.
+ *  @param height    Sprite height.
+ *  @param rotation  Rotation in radians.
+ *  @param color     Tint colour.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_renderer_draw_sprite_color(
+    goud_context context,
+    goud_texture texture,
+    float x,
+    float y,
+    float width,
+    float height,
+    float rotation,
+    goud_color color
+) {
+    return goud_status_from_bool(
+        goud_renderer_draw_sprite(
+            context,
+            texture,
+            x,
+            y,
+            width,
+            height,
+            rotation,
+            color.r,
+            color.g,
+            color.b,
+            color.a
+        )
+    );
+}
+
+/** @brief Draw a sub-rectangle of a texture, such as an atlas region.
+ *  @param context   Valid engine context.
+ *  @param texture   Texture handle.
+ *  @param x         X position.
+ *  @param y         Y position.
+ *  @param width     Sprite width.
+ *  @param height    Sprite height.
+ *  @param rotation  Rotation in radians.
+ *  @param src_x     Source rectangle left edge, in texture pixels.
+ *  @param src_y     Source rectangle top edge, in texture pixels.
+ *  @param src_w     Source rectangle width, in texture pixels.
+ *  @param src_h     Source rectangle height, in texture pixels.
+ *  @param color     Tint colour.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_renderer_draw_sprite_src(
+    goud_context context,
+    goud_texture texture,
+    float x,
+    float y,
+    float width,
+    float height,
+    float rotation,
+    float src_x,
+    float src_y,
+    float src_w,
+    float src_h,
+    goud_color color
+) {
+    return goud_status_from_bool(
+        goud_renderer_draw_sprite_rect(
+            context,
+            texture,
+            x,
+            y,
+            width,
+            height,
+            rotation,
+            src_x,
+            src_y,
+            src_w,
+            src_h,
+            1u,
+            color.r,
+            color.g,
+            color.b,
+            color.a
+        )
+    );
+}
+
+/** @brief Draw a solid-colour quad.
+ *  @param context  Valid engine context.
+ *  @param x        X position.
+ *  @param y        Y position.
+ *  @param width    Quad width.
+ *  @param height   Quad height.
+ *  @param color    Fill colour.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_renderer_draw_quad_color(
+    goud_context context,
+    float x,
+    float y,
+    float width,
+    float height,
+    goud_color color
+) {
+    return goud_status_from_bool(
+        goud_renderer_draw_quad(context, x, y, width, height, color.r, color.g, color.b, color.a)
+    );
+}
+
+/** @brief Draw a batch of sprites in a single FFI call.
+ *
+ *  The engine sorts @p cmds by (z_layer, texture) before drawing; give each
+ *  command a distinct, increasing z_layer to keep submission order.
+ *
+ *  @param context          Valid engine context.
+ *  @param cmds             Array of @p count sprite commands (may be NULL when @p count is 0).
+ *  @param count            Number of commands in @p cmds.
+ *  @param[out] out_drawn   Optional; receives the number of sprites drawn.
+ *  @return SUCCESS on success, including when @p count is 0.
+ *  @retval ERR_INVALID_STATE  @p cmds is NULL and @p count is non-zero.
+ */
+static inline int goud_renderer_draw_sprite_cmds(
+    goud_context context,
+    const goud_sprite_cmd *cmds,
+    uint32_t count,
+    uint32_t *out_drawn
+) {
+    uint32_t drawn;
+
+    if (out_drawn != NULL) {
+        *out_drawn = 0;
+    }
+    if (count == 0) {
+        return SUCCESS;
+    }
+    if (cmds == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    drawn = goud_renderer_draw_sprite_batch(context, cmds, count);
+    if (out_drawn != NULL) {
+        *out_drawn = drawn;
+    }
+    return drawn > 0 ? SUCCESS : goud_status_last_error_or(ERR_DRAW_CALL_FAILED);
+}
+
+/** @brief Upload sprite commands once into a GPU-resident static layer.
+ *
+ *  Backgrounds and tilemaps that rarely change can be drawn every frame
+ *  with goud_static_layer_render() instead of re-submitting their commands.
+ *  The layer is sorted by (z_layer, texture) like a sprite batch.
+ *
+ *  @param context          Valid engine context.
+ *  @param cmds             Array of @p count sprite commands.
+ *  @param count            Number of commands in @p cmds (at least 1).
+ *  @param[out] out_layer   Receives the layer handle.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p cmds or @p out_layer is NULL, or @p count is 0.
+ */
+static inline int goud_static_layer_init(
+    goud_context context,
+    const goud_sprite_cmd *cmds,
+    uint32_t count,
+    goud_static_layer *out_layer
+) {
+    goud_static_layer layer;
+
+    if (cmds == NULL || count == 0 || out_layer == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    layer = goud_static_layer_create(context, cmds, count);
+    *out_layer = layer;
+    return goud_status_from_handle(layer, GOUD_INVALID_STATIC_LAYER);
+}
+
+/** @brief Replace @p count commands of a static layer, starting at @p first.
+ *
+ *  Indices follow the order passed to goud_static_layer_init().  Only the
+ *  changed sprites are re-uploaded unless a change moves a sprite to
+ *  another texture or z_layer.
+ *
+ *  @param context  Valid engine context.
+ *  @param layer    Layer handle.
+ *  @param first    Index of the first command to replace.
+ *  @param cmds     Array of @p count sprite commands (may be NULL when @p count is 0).
+ *  @param count    Number of commands in @p cmds.
+ *  @return SUCCESS on success, including when @p count is 0.
+ *  @retval ERR_INVALID_STATE   @p cmds is NULL, or the range runs past the layer.
+ *  @retval ERR_INVALID_HANDLE  @p layer is unknown.
+ */
+static inline int goud_static_layer_write(
+    goud_context context,
+    goud_static_layer layer,
+    uint32_t first,
+    const goud_sprite_cmd *cmds,
+    uint32_t count
+) {
+    int32_t code;
+
+    if (count == 0) {
+        return SUCCESS;
+    }
+    if (cmds == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    code = goud_static_layer_update(context, layer, first, cmds, count);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Draw a static layer shifted by (@p offset_x, @p offset_y).
+ *
+ *  Pass the negated camera position to scroll the layer.  Costs one draw
+ *  call per texture run and no vertex upload.
+ *
+ *  @param context          Valid engine context.
+ *  @param layer            Layer handle.
+ *  @param offset_x         Horizontal offset in pixels.
+ *  @param offset_y         Vertical offset in pixels.
+ *  @param[out] out_drawn   Optional; receives the number of sprites drawn.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_static_layer_render(
+    goud_context context,
+    goud_static_layer layer,
+    float offset_x,
+    float offset_y,
+    uint32_t *out_drawn
+) {
+    uint32_t drawn = goud_static_layer_draw(context, layer, offset_x, offset_y);
+
+    if (out_drawn != NULL) {
+        *out_drawn = drawn;
+    }
+    return drawn > 0 ? SUCCESS : goud_status_last_error_or(ERR_DRAW_CALL_FAILED);
+}
+
+/** @brief Destroy a static layer and free its GPU buffers.
+ *  @param context  Valid engine context.
+ *  @param layer    Layer handle.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_static_layer_dispose(goud_context context, goud_static_layer layer) {
+    return goud_status_from_bool(goud_static_layer_destroy(context, layer));
+}
+
+/** @brief Create an empty chunked tilemap.
+ *
+ *  Tile ID @c n draws tileset cell @c n-1, counted row-major from the
+ *  tileset's top-left corner; ID 0 is empty.  Chunks are baked into GPU
+ *  buffers when they first become visible, rebuilt only after their tiles
+ *  change, and skipped when out of view.
+ *
+ *  @param context          Valid engine context.
+ *  @param tileset          Tileset texture.
+ *  @param columns          Map width in tiles.
+ *  @param rows             Map height in tiles.
+ *  @param tile_width       Tile width in pixels, in the tileset and on screen.
+ *  @param tile_height      Tile height in pixels, in the tileset and on screen.
+ *  @param chunk_size       Chunk edge in tiles (0 = GOUD_TILEMAP_DEFAULT_CHUNK_SIZE, at most 256).
+ *  @param[out] out_tilemap Receives the tilemap handle.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_tilemap is NULL.
+ */
+static inline int goud_tilemap_init(
+    goud_context context,
+    goud_texture tileset,
+    uint32_t columns,
+    uint32_t rows,
+    uint32_t tile_width,
+    uint32_t tile_height,
+    uint32_t chunk_size,
+    goud_tilemap *out_tilemap
+) {
+    goud_tilemap tilemap;
+
+    if (out_tilemap == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    tilemap = goud_tilemap_create(context, tileset, columns, rows, tile_width, tile_height, chunk_size);
+    *out_tilemap = tilemap;
+    return goud_status_from_handle(tilemap, GOUD_INVALID_TILEMAP);
+}
+
+/** @brief Write a @p width x @p height block of row-major tile IDs at tile (@p x, @p y).
+ *  @param context  Valid engine context.
+ *  @param tilemap  Tilemap handle.
+ *  @param x        Left column of the block.
+ *  @param y        Top row of the block.
+ *  @param width    Block width in tiles.
+ *  @param height   Block height in tiles.
+ *  @param tiles    @p width * @p height tile IDs (may be NULL when the block is empty).
+ *  @return SUCCESS on success, including for an empty block.
+ *  @retval ERR_INVALID_STATE   @p tiles is NULL, or the block runs past the map.
+ *  @retval ERR_INVALID_HANDLE  @p tilemap is unknown.
+ */
+static inline int goud_tilemap_write(
+    goud_context context,
+    goud_tilemap tilemap,
+    uint32_t x,
+    uint32_t y,
+    uint32_t width,
+    uint32_t height,
+    const uint32_t *tiles
+) {
+    int32_t code;
+
+    if (width == 0 || height == 0) {
+        return SUCCESS;
+    }
+    if (tiles == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    code = goud_tilemap_set_tiles(context, tilemap, x, y, width, height, tiles);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Draw the visible chunks of a tilemap.
+ *
+ *  The map's top-left corner is drawn at (@p offset_x, @p offset_y); pass
+ *  the negated camera position to scroll.  Tiles in chunks outside the
+ *  window count as culled in goud_renderer_get_frame_metrics().
+ *
+ *  @param context          Valid engine context.
+ *  @param tilemap          Tilemap handle.
+ *  @param offset_x         Horizontal offset in pixels.
+ *  @param offset_y         Vertical offset in pixels.
+ *  @param[out] out_drawn   Optional; receives the number of tiles drawn.
+ *  @return SUCCESS on success, including when no tile is visible.
+ */
+static inline int goud_tilemap_render(
+    goud_context context,
+    goud_tilemap tilemap,
+    float offset_x,
+    float offset_y,
+    uint32_t *out_drawn
+) {
+    uint32_t drawn;
+
+    goud_clear_last_error();
+    drawn = goud_tilemap_draw(context, tilemap, offset_x, offset_y);
+    if (out_drawn != NULL) {
+        *out_drawn = drawn;
+    }
+    return drawn == 0 ? goud_status_last_error_or(SUCCESS) : SUCCESS;
+}
+
+/** @brief Destroy a tilemap and free its baked chunks.
+ *  @param context  Valid engine context.
+ *  @param tilemap  Tilemap handle.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_tilemap_dispose(goud_context context, goud_tilemap tilemap) {
+    return goud_status_from_bool(goud_tilemap_destroy(context, tilemap));
+}
+
+/** @brief Create a particle emitter at (0, 0).
+ *
+ *  Storage for @c config->max_particles particles is reserved up front.
+ *  Particles are simulated by goud_particles_step() and drawn with one
+ *  instanced draw call per emitter, so no per-particle data crosses the
+ *  FFI boundary.
+ *
+ *  @param context          Valid engine context.
+ *  @param config           Emitter configuration (copied).
+ *  @param[out] out_emitter Receives the emitter handle.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p config or @p out_emitter is NULL, or a range in @p config is invalid.
+ */
+static inline int goud_particle_emitter_init(
+    goud_context context,
+    const goud_particle_config *config,
+    goud_particle_emitter *out_emitter
+) {
+    goud_particle_emitter emitter;
+
+    if (config == NULL || out_emitter == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    emitter = goud_particle_emitter_create(context, config);
+    *out_emitter = emitter;
+    return goud_status_from_handle(emitter, GOUD_INVALID_PARTICLE_EMITTER);
+}
+
+/** @brief Move an emitter; live particles keep their positions.
+ *  @param context  Valid engine context.
+ *  @param emitter  Emitter handle.
+ *  @param x        New X position in pixels.
+ *  @param y        New Y position in pixels.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_particle_emitter_move(
+    goud_context context,
+    goud_particle_emitter emitter,
+    float x,
+    float y
+) {
+    return goud_status_from_bool(goud_particle_emitter_set_position(context, emitter, x, y));
+}
+
+/** @brief Change an emitter's emission rate in particles per second (0 stops it).
+ *  @param context  Valid engine context.
+ *  @param emitter  Emitter handle.
+ *  @param rate     Non-negative rate.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE   @p rate is negative or not finite.
+ *  @retval ERR_INVALID_HANDLE  @p emitter is unknown.
+ */
+static inline int goud_particle_emitter_rate(
+    goud_context context,
+    goud_particle_emitter emitter,
+    float rate
+) {
+    int32_t code = goud_particle_emitter_set_rate(context, emitter, rate);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Spawn up to @p count particles at once.
+ *  @param context            Valid engine context.
+ *  @param emitter            Emitter handle.
+ *  @param count              Particles to spawn.
+ *  @param[out] out_spawned   Optional; receives the number spawned, which
+ *                            is lower than @p count near max_particles.
+ *  @return SUCCESS on success, including when the emitter is full.
+ */
+static inline int goud_particle_emitter_spawn(
+    goud_context context,
+    goud_particle_emitter emitter,
+    uint32_t count,
+    uint32_t *out_spawned
+) {
+    uint32_t spawned;
+
+    goud_clear_last_error();
+    spawned = goud_particle_emitter_burst(context, emitter, count);
+    if (out_spawned != NULL) {
+        *out_spawned = spawned;
+    }
+    return spawned == 0 ? goud_status_last_error_or(SUCCESS) : SUCCESS;
+}
+
+/** @brief Advance every particle emitter of a context by @p delta_time seconds.
+ *  @param context          Valid engine context.
+ *  @param delta_time       Frame time in seconds; non-positive values change nothing.
+ *  @param[out] out_alive   Optional; receives the live particle total.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_particles_step(goud_context context, float delta_time, uint32_t *out_alive) {
+    uint32_t alive;
+
+    goud_clear_last_error();
+    alive = goud_particles_update(context, delta_time);
+    if (out_alive != NULL) {
+        *out_alive = alive;
+    }
+    return alive == 0 ? goud_status_last_error_or(SUCCESS) : SUCCESS;
+}
+
+/** @brief Draw an emitter's live particles in one instanced draw call.
+ *  @param context          Valid engine context.
+ *  @param emitter          Emitter handle.
+ *  @param offset_x         Horizontal offset in pixels.
+ *  @param offset_y         Vertical offset in pixels.
+ *  @param[out] out_drawn   Optional; receives the number of particles drawn.
+ *  @return SUCCESS on success, including when no particle is alive.
+ */
+static inline int goud_particle_emitter_render(
+    goud_context context,
+    goud_particle_emitter emitter,
+    float offset_x,
+    float offset_y,
+    uint32_t *out_drawn
+) {
+    uint32_t drawn;
+
+    goud_clear_last_error();
+    drawn = goud_particle_emitter_draw(context, emitter, offset_x, offset_y);
+    if (out_drawn != NULL) {
+        *out_drawn = drawn;
+    }
+    return drawn == 0 ? goud_status_last_error_or(SUCCESS) : SUCCESS;
+}
+
+/** @brief Destroy a particle emitter and its instance buffer.
+ *  @param context  Valid engine context.
+ *  @param emitter  Emitter handle.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_particle_emitter_dispose(goud_context context, goud_particle_emitter emitter) {
+    return goud_status_from_bool(goud_particle_emitter_destroy(context, emitter));
+}
+
+/** @brief Draw a batch of text labels in a single FFI call.
+ *
+ *  Labels are drawn in array order.  The engine skips, without counting,
+ *  labels with a NULL or empty string, a non-positive size or line
+ *  spacing, or an unknown alignment or direction.
+ *
+ *  @param context          Valid engine context.
+ *  @param cmds             Array of @p count text commands (may be NULL when @p count is 0).
+ *  @param count            Number of commands in @p cmds.
+ *  @param[out] out_drawn   Optional; receives the number of labels drawn.
+ *  @return SUCCESS when at least one label was drawn, or when @p count is 0.
+ *  @retval ERR_INVALID_STATE  @p cmds is NULL and @p count is non-zero.
+ */
+static inline int goud_renderer_draw_text_cmds(
+    goud_context context,
+    const goud_text_cmd *cmds,
+    uint32_t count,
+    uint32_t *out_drawn
+) {
+    uint32_t drawn;
+
+    if (out_drawn != NULL) {
+        *out_drawn = 0;
+    }
+    if (count == 0) {
+        return SUCCESS;
+    }
+    if (cmds == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    drawn = goud_renderer_draw_text_batch(context, cmds, count);
+    if (out_drawn != NULL) {
+        *out_drawn = drawn;
+    }
+    return drawn > 0 ? SUCCESS : goud_status_last_error_or(ERR_DRAW_CALL_FAILED);
+}
+
+/** @brief Set the byte budget of the context's text layout cache.
+ *
+ *  Text drawn through goud_renderer_draw_text_cmds() reuses the shaped
+ *  layout of a label drawn before with the same font, size, string, and
+ *  layout settings.  Least-recently-used layouts are evicted once the
+ *  cache exceeds @p budget_bytes; 0 disables caching.
+ *
+ *  @param context       Valid engine context.
+ *  @param budget_bytes  Byte budget for cached layouts.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_renderer_text_cache_budget(goud_context context, uint64_t budget_bytes) {
+    return goud_status_from_bool(goud_text_layout_cache_set_budget(context, budget_bytes));
+}
+
+/** @brief Drop every cached text layout for the context.
+ *  @param context  Valid engine context.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_renderer_text_cache_clear(goud_context context) {
+    return goud_status_from_bool(goud_text_layout_cache_clear(context));
+}
+
+/** @brief Retrieve text layout cache hit, miss, and occupancy counters.
+ *
+ *  The cache's byte estimate is also reported as the rendering category
+ *  of goud_debugger_get_memory_summary().
+ *
+ *  @param context           Valid engine context.
+ *  @param[out] out_stats    Receives the counters.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_stats is NULL.
+ */
+static inline int goud_renderer_text_cache_stats(goud_context context, goud_text_cache_stats *out_stats) {
+    if (out_stats == NULL) {
+        return ERR_INVALID_STATE;
+    }
+    return goud_status_from_bool(goud_text_layout_cache_get_stats(context, out_stats));
+}
+
+/** @brief Retrieve per-frame render statistics.
+ *  @param context            Valid engine context.
+ *  @param[out] out_stats     Receives the stats struct.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_stats is NULL.
+ */
+static inline int goud_renderer_stats(goud_context context, goud_render_stats *out_stats) {
+    if (out_stats == NULL) {
+        return ERR_INVALID_STATE;
+    }
+    return goud_status_from_bool(goud_renderer_get_stats(context, out_stats));
+}
+
+/** @brief Retrieve the phase timings of the last frame rendered on this thread.
+ *  @param[out] out_timings   Receives the timings.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_timings is NULL.
+ */
+static inline int goud_renderer_phase_timings(goud_frame_phase_timings *out_timings) {
+    int32_t code;
+
+    if (out_timings == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    code = goud_renderer_get_frame_phase_timings(out_timings);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @} */ /* end renderer */
+
+/* ========================================================================= */
+/** @defgroup input Input
+ *  Keyboard and mouse state queries.
+ *  @{ */
+/* ========================================================================= */
+
+/** @brief Test whether a key is currently held down.
+ *  @param context  Valid engine context.
+ *  @param key      Key code.
+ *  @return true if the key is pressed.
+ */
+static inline bool goud_input_key_down(goud_context context, goud_key key) {
+    return goud_input_key_pressed(context, key);
+}
+
+/** @brief Test whether a key was pressed this frame (edge trigger).
+ *  @param context  Valid engine context.
+ *  @param key      Key code.
+ *  @return true if the key was just pressed.
+ */
+static inline bool goud_input_key_pressed_once(goud_context context, goud_key key) {
+    return goud_input_key_just_pressed(context, key);
+}
+
+/** @brief Test whether a mouse button is currently held down.
+ *  @param context  Valid engine context.
+ *  @param button   Mouse button.
+ *  @return true if the button is pressed.
+ */
+static inline bool goud_input_mouse_down(goud_context context, goud_mouse_button button) {
+    return goud_input_mouse_button_pressed(context, button);
+}
+
+/** @brief Get the current mouse cursor position.
+ *  @param context              Valid engine context.
+ *  @param[out] out_position    Receives the (x, y) position.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE   @p out_position is NULL.
+ */
+static inline int goud_input_mouse_position(goud_context context, goud_vec2 *out_position) {
+    if (out_position == NULL) {
+        return ERR_INVALID_STATE;
+    }
+    return goud_status_from_bool(goud_input_get_mouse_position(context, &out_position->x, &out_position->y));
+}
+
+/** @brief Get the mouse scroll delta for this frame.
+ *  @param context          Valid engine context.
+ *  @param[out] out_delta   Receives the (x, y) scroll delta.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_delta is NULL.
+ */
+static inline int goud_input_scroll_delta(goud_context context, goud_vec2 *out_delta) {
+    if (out_delta == NULL) {
+        return ERR_INVALID_STATE;
+    }
+    return goud_status_from_bool(goud_input_get_scroll_delta(context, &out_delta->x, &out_delta->y));
+}
+
+/** @brief Copy the whole input state of the current frame in one call.
+ *
+ *  Capture once after polling events; queries against the snapshot are bit
+ *  tests with no engine call.  The struct holds no pointers, so it can be
+ *  stored as-is to record input for replays.
+ *
+ *  @param context            Valid engine context.
+ *  @param[out] out_snapshot  Receives the snapshot.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_snapshot is NULL.
+ */
+static inline int goud_input_snapshot_capture(goud_context context, goud_input_snapshot *out_snapshot) {
+    if (out_snapshot == NULL) {
+        return ERR_INVALID_STATE;
+    }
+    return goud_status_from_bool(goud_input_capture_snapshot(context, out_snapshot));
+}
+
+/** @brief Test a key in one of a snapshot's keyboard bitsets.
+ *  @param words  keys_down, keys_pressed or keys_released of a snapshot.
+ *  @param key    Key code.
+ *  @return true if the key's bit is set; false for codes outside the bitset.
+ */
+static inline bool goud_input_snapshot_key_bit(const uint64_t *words, goud_key key) {
+    if (key < 0 || key >= GOUD_INPUT_KEY_WORDS * 64) {
+        return false;
+    }
+    return (words[key / 64] >> (key % 64)) & 1u;
+}
+
+/** @} */ /* end input */
+
+/* ========================================================================= */
+/** @defgroup window Window / Game Loop
+ *  Window lifecycle, event polling, and frame timing.
+ *  @{ */
+/* ========================================================================= */
+
+/** @brief Check whether the window close has been requested.
+ *  @param context  Valid engine context.
+ *  @return true if the window should close.  Returns true for invalid contexts.
+ */
+static inline bool goud_window_should_close_checked(goud_context context) {
+    if (!goud_context_valid(context)) {
+        return true;
+    }
+    return goud_window_should_close(context);
+}
+
+/** @brief Poll window events and return the frame delta time.
+ *  @param context  Valid engine context.
+ *  @return Delta time in seconds.  Returns 0 for invalid contexts.
+ */
+static inline float goud_window_poll_events_checked(goud_context context) {
+    if (!goud_context_valid(context)) {
+        return 0.0f;
+    }
+    return goud_window_poll_events(context);
+}
+
+/** @brief Swap the front and back framebuffers.
+ *  @param context  Valid engine context.  No-op for invalid contexts.
+ */
+static inline void goud_window_swap_buffers_checked(goud_context context) {
+    if (!goud_context_valid(context)) {
+        return;
+    }
+    goud_window_swap_buffers(context);
+}
+
+/** @brief Enable alpha blending for the renderer.
+ *  @param context  Valid engine context.  No-op for invalid contexts.
+ */
+static inline void goud_renderer_enable_blending_checked(goud_context context) {
+    if (!goud_context_valid(context)) {
+        return;
+    }
+    goud_renderer_enable_blending(context);
+}
+
+/** @brief Get the delta time for the current frame.
+ *  @param context  Valid engine context.
+ *  @return Delta time in seconds.  Returns 0 for invalid contexts.
+ */
+static inline float goud_window_delta_time(goud_context context) {
+    if (!goud_context_valid(context)) {
+        return 0.0f;
+    }
+    return goud_window_get_delta_time(context);
+}
+
+/** @} */ /* end window */
+
+/* ========================================================================= */
+/** @defgroup audio Audio
+ *  Audio playback and volume control.
+ *  @{ */
+/* ========================================================================= */
+
+/** @brief Activate the audio subsystem.
+ *  @param context  Valid engine context.
+ *  @return Non-negative value on success, negative error code on failure.
+ */
+static inline int goud_audio_activate_checked(goud_context context) {
+    int status = goud_audio_activate(context);
+    return status >= 0 ? status : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+}
+
+/** @brief Play audio from an in-memory buffer.
+ *  @param context              Valid engine context.
+ *  @param asset_data           Pointer to audio data.
+ *  @param asset_len            Length of @p asset_data in bytes.
+ *  @param[out] out_player      Receives the player handle.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE   @p asset_data or @p out_player is NULL.
+ */
+static inline int goud_audio_play_memory(
+    goud_context context,
+    const void *asset_data,
+    size_t asset_len,
+    goud_audio_player *out_player
+) {
+    goud_audio_player player;
+
+    if (asset_data == NULL || out_player == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    player = goud_audio_play(context, (const uint8_t *)asset_data, asset_len);
+    *out_player = player;
+    return player >= 0 ? SUCCESS : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+}
+
+/** @brief Decode audio once and keep it as a clip for repeated playback.
+ *
+ *  goud_audio_play_memory() decodes its bytes on every call.  A clip is
+ *  decoded here once; goud_audio_clip_play_ex() and
+ *  goud_audio_clip_play_spatial() then start players from the decoded
+ *  samples.  The bytes are copied, so @p asset_data may be freed afterwards.
+ *
+ *  @param context         Valid engine context.
+ *  @param asset_data      Pointer to encoded audio data (WAV/OGG/MP3/FLAC).
+ *  @param asset_len       Length of @p asset_data in bytes.
+ *  @param[out] out_clip   Receives the clip handle, or GOUD_INVALID_AUDIO_CLIP on failure.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p asset_data or @p out_clip is NULL.
+ */
+static inline int goud_audio_clip_load_memory(
+    goud_context context,
+    const void *asset_data,
+    size_t asset_len,
+    goud_audio_clip *out_clip
+) {
+    int64_t clip;
+
+    if (asset_data == NULL || out_clip == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    clip = goud_audio_clip_load(context, (const uint8_t *)asset_data, asset_len);
+    *out_clip = clip > 0 ? (goud_audio_clip)clip : GOUD_INVALID_AUDIO_CLIP;
+    return clip > 0 ? SUCCESS : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+}
+
+/** @brief Unload a clip.  Players already started from it keep playing.
+ *  @param context  Valid engine context.
+ *  @param clip     Clip handle returned by goud_audio_clip_load_memory().
+ *  @return SUCCESS on success.
+ */
+static inline int goud_audio_clip_unload_checked(goud_context context, goud_audio_clip clip) {
+    int status = goud_audio_clip_unload(context, clip);
+    return status >= 0 ? SUCCESS : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+}
+
+/** @brief Play a clip with volume, speed, looping, and channel control.
+ *  @param context          Valid engine context.
+ *  @param clip             Clip handle returned by goud_audio_clip_load_memory().
+ *  @param volume           Individual volume (0.0 -- 1.0, clamped).
+ *  @param speed            Playback speed (0.1 -- 10.0, affects pitch).
+ *  @param looping          Non-zero to loop until stopped.
+ *  @param channel          0 = Music, 1 = SFX, 2 = Voice, 3 = Ambience, 4 = UI.
+ *  @param[out] out_player  Receives the player handle.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_player is NULL.
+ */
+static inline int goud_audio_clip_play_ex(
+    goud_context context,
+    goud_audio_clip clip,
+    float volume,
+    float speed,
+    bool looping,
+    uint8_t channel,
+    goud_audio_player *out_player
+) {
+    goud_audio_player player;
+
+    if (out_player == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    player = goud_audio_clip_play(context, clip, volume, speed, looping, channel);
+    *out_player = player;
+    return player >= 0 ? SUCCESS : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+}
+
+/** @brief Play a clip on the SFX channel with 3D distance attenuation.
+ *  @param context          Valid engine context.
+ *  @param clip             Clip handle returned by goud_audio_clip_load_memory().
+ *  @param source           Source position (x, y, z).
+ *  @param listener         Listener position (x, y, z).
+ *  @param max_distance     Distance at which the source becomes silent.
+ *  @param rolloff          Attenuation curve exponent.
+ *  @param[out] out_player  Receives the player handle.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p source, @p listener, or @p out_player is NULL.
+ */
+static inline int goud_audio_clip_play_spatial(
+    goud_context context,
+    goud_audio_clip clip,
+    const float source[3],
+    const float listener[3],
+    float max_distance,
+    float rolloff,
+    goud_audio_player *out_player
+) {
+    goud_audio_player player;
+
+    if (source == NULL || listener == NULL || out_player == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    player = goud_audio_clip_play_spatial_3d(context, clip,
+                                             source[0], source[1], source[2],
+                                             listener[0], listener[1], listener[2],
+                                             max_distance, rolloff);
+    *out_player = player;
+    return player >= 0 ? SUCCESS : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+}
+
+/** @brief Set the byte budget for decoded clip samples.
+ *
+ *  Least-recently-played clips lose their decoded samples first once the
+ *  cache exceeds @p budget_bytes; they stay loaded and are decoded again
+ *  on their next play.
+ *
+ *  @param context       Valid engine context.
+ *  @param budget_bytes  Byte budget for decoded samples.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_audio_clip_cache_budget(goud_context context, uint64_t budget_bytes) {
+    int status = goud_audio_clip_cache_set_budget(context, budget_bytes);
+    return status >= 0 ? SUCCESS : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+}
+
+/** @brief Retrieve clip cache occupancy, hit, and eviction counters.
+ *
+ *  The cache's footprint is also reported as the audio category of
+ *  goud_debugger_get_memory_summary().
+ *
+ *  @param context         Valid engine context.
+ *  @param[out] out_stats  Receives the counters.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_stats is NULL.
+ */
+static inline int goud_audio_clip_cache_stats(goud_context context, goud_audio_clip_stats *out_stats) {
+    int status;
+
+    if (out_stats == NULL) {
+        return ERR_INVALID_STATE;
+    }
+    status = goud_audio_clip_cache_get_stats(context, out_stats);
+    return status >= 0 ? SUCCESS : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+}
+
+/** @brief Stream an audio file from disk instead of loading it.
+ *
+ *  The file is read and decoded on a background thread as it plays, and
+ *  only a few hundred milliseconds of decoded audio are buffered, so a long
+ *  music track costs no more memory than a short one.  The player works
+ *  with every player control, goud_audio_crossfade_to(), and
+ *  goud_audio_mix_with().
+ *
+ *  @param context          Valid engine context.
+ *  @param path             Path to a WAV/OGG/MP3/FLAC file.
+ *  @param volume           Individual volume (0.0 -- 1.0, clamped).
+ *  @param looping          Non-zero to restart from the beginning at the end.
+ *  @param channel          0 = Music, 1 = SFX, 2 = Voice, 3 = Ambience, 4 = UI.
+ *  @param[out] out_player  Receives the player handle.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p path or @p out_player is NULL.
+ */
+static inline int goud_audio_stream_play_file(
+    goud_context context,
+    const char *path,
+    float volume,
+    bool looping,
+    uint8_t channel,
+    goud_audio_player *out_player
+) {
+    goud_audio_player player;
+
+    if (path == NULL || out_player == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    player = goud_audio_stream_play(context, path, volume, looping, channel);
+    *out_player = player;
+    return player >= 0 ? SUCCESS : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+}
+
+/** @brief Crossfade from an active player to a newly streamed file.
+ *
+ *  Advance the crossfade with goud_audio_update_crossfades(), as for
+ *  goud_audio_crossfade_to().
+ *
+ *  @param context          Valid engine context.
+ *  @param from_player      Player to fade out; stopped when the fade completes.
+ *  @param path             Path to a WAV/OGG/MP3/FLAC file.
+ *  @param duration_sec     Fade duration; 0 switches immediately.
+ *  @param looping          Non-zero to loop the new track.
+ *  @param channel          Channel of the new track.
+ *  @param[out] out_player  Receives the new track's player handle.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p from_player is negative, or @p path or @p out_player is NULL.
+ */
+static inline int goud_audio_stream_crossfade_to_file(
+    goud_context context,
+    goud_audio_player from_player,
+    const char *path,
+    float duration_sec,
+    bool looping,
+    uint8_t channel,
+    goud_audio_player *out_player
+) {
+    goud_audio_player player;
+
+    if (from_player < 0 || path == NULL || out_player == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    player = goud_audio_stream_crossfade_to(context, (uint64_t)from_player, path,
+                                            duration_sec, looping, channel);
+    *out_player = player;
+    return player >= 0 ? SUCCESS : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+}
+
+/** @brief Layer a streamed file on top of an active player.
+ *  @param context           Valid engine context.
+ *  @param primary_player    Player that keeps playing underneath.
+ *  @param path              Path to a WAV/OGG/MP3/FLAC file.
+ *  @param secondary_volume  Volume of the layer (0.0 -- 1.0, clamped).
+ *  @param looping           Non-zero to loop the layer.
+ *  @param channel           Channel of the layer.
+ *  @param[out] out_player   Receives the layer's player handle.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p primary_player is negative, or @p path or @p out_player is NULL.
+ */
+static inline int goud_audio_stream_mix_with_file(
+    goud_context context,
+    goud_audio_player primary_player,
+    const char *path,
+    float secondary_volume,
+    bool looping,
+    uint8_t channel,
+    goud_audio_player *out_player
+) {
+    goud_audio_player player;
+
+    if (primary_player < 0 || path == NULL || out_player == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    player = goud_audio_stream_mix_with(context, (uint64_t)primary_player, path,
+                                        secondary_volume, looping, channel);
+    *out_player = player;
+    return player >= 0 ? SUCCESS : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+}
+
+/** @brief Retrieve active stream, buffer footprint, and underrun counters.
+ *  @param context         Valid engine context.
+ *  @param[out] out_stats  Receives the counters.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_stats is NULL.
+ */
+static inline int goud_audio_stream_stats_get(goud_context context, goud_audio_stream_stats *out_stats) {
+    int status;
+
+    if (out_stats == NULL) {
+        return ERR_INVALID_STATE;
+    }
+    status = goud_audio_stream_get_stats(context, out_stats);
+    return status >= 0 ? SUCCESS : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+}
+
+/** @brief Move the listener and every spatial emitter in one call.
+ *
+ *  Replaces a goud_audio_set_source_position() call per emitter plus
+ *  goud_audio_set_listener_position(): all updates are applied in one
+ *  pass.  Emitters beyond their @c max_distance are paused so the mixer
+ *  skips them, and resume once back in range; they still report as
+ *  playing.  Updates for players that are no longer active are skipped.
+ *
+ *  @param context            Valid engine context.
+ *  @param listener           Listener position (x, y, z).
+ *  @param updates            Array of @p count emitter updates.
+ *  @param count              Number of updates.
+ *  @param[out] out_applied   Optional; receives the number of updates applied.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p listener is NULL, or @p updates is NULL with a non-zero @p count.
+ */
+static inline int goud_audio_spatial_update_batch(
+    goud_context context,
+    const float listener[3],
+    const goud_spatial_source_update *updates,
+    uint32_t count,
+    uint32_t *out_applied
+) {
+    int32_t applied;
+
+    if (out_applied != NULL) {
+        *out_applied = 0;
+    }
+    if (listener == NULL || (updates == NULL && count != 0)) {
+        return ERR_INVALID_STATE;
+    }
+
+    applied = goud_audio_update_spatial_sources(context, listener[0], listener[1], listener[2],
+                                                updates, count);
+    if (applied < 0) {
+        return goud_status_last_error_or(ERR_INTERNAL_ERROR);
+    }
+    if (out_applied != NULL) {
+        *out_applied = (uint32_t)applied;
+    }
+    return SUCCESS;
+}
+
+/** @brief Stop an active audio player.
+ *  @param context    Valid engine context.
+ *  @param player_id  Player handle returned by goud_audio_play_memory().
+ *  @return Non-negative value on success, negative error code on failure.
+ *  @retval ERR_INVALID_STATE  @p player_id is negative.
+ */
+static inline int goud_audio_stop_checked(goud_context context, goud_audio_player player_id) {
+    if (player_id < 0) {
+        return ERR_INVALID_STATE;
+    }
+    int status = goud_audio_stop(context, (uint64_t)player_id);
+    return status >= 0 ? status : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+}
+
+/** @brief Set the global audio volume.
+ *  @param context  Valid engine context.
+ *  @param volume   Volume level (0.0 = mute, 1.0 = full).
+ *  @return Non-negative value on success, negative error code on failure.
+ */
+static inline int goud_audio_set_global_volume_checked(goud_context context, float volume) {
+    int status = goud_audio_set_global_volume(context, volume);
+    return status >= 0 ? status : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+}
+
+/** @} */ /* end audio */
+
+/* ========================================================================= */
+/** @defgroup animation Animation
+ *  Batched animator updates, bulk transfer of the animation events fired
+ *  during the last update, and 2D skeletons evaluated in batches into one
+ *  bone palette for GPU skinning.
+ *  @{ */
+/* ========================================================================= */
+
+/** @brief Count the animation events fired during the last update.
+ *  @param context         Valid engine context.
+ *  @param[out] out_count  Receives the number of events.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_count is NULL.
+ */
+static inline int goud_animation_event_total(goud_context context, uint32_t *out_count) {
+    int32_t count;
+
+    if (out_count == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    count = goud_animation_events_count(context);
+    *out_count = count > 0 ? (uint32_t)count : 0;
+    return count >= 0 ? SUCCESS : goud_status_last_error_or((int)-count);
+}
+
+/** @brief Copy the animation events fired during the last update in one call.
+ *
+ *  A buffer sized by goud_animation_event_total() holds every event.  The
+ *  name and string payload pointers of each event stay valid until the
+ *  engine's next event update.
+ *
+ *  @param context            Valid engine context.
+ *  @param[out] out_events    Buffer of @p capacity events.
+ *  @param capacity           Number of events @p out_events can hold.
+ *  @param[out] out_written   Optional; receives the number of events copied.
+ *  @return SUCCESS on success (including no events).
+ *  @retval ERR_INVALID_STATE  @p out_events is NULL with a non-zero @p capacity.
+ */
+static inline int goud_animation_copy_events(
+    goud_context context,
+    goud_animation_event *out_events,
+    uint32_t capacity,
+    uint32_t *out_written
+) {
+    uint32_t written;
+
+    if (out_written != NULL) {
+        *out_written = 0;
+    }
+    if (capacity == 0) {
+        return SUCCESS;
+    }
+    if (out_events == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    goud_clear_last_error();
+    written = goud_animation_events_copy(context, out_events, capacity);
+    if (out_written != NULL) {
+        *out_written = written;
+    }
+    return written == 0 ? goud_status_last_error_or(SUCCESS) : SUCCESS;
+}
+
+/** @brief Step the animation of many entities and write their frames into sprite commands.
+ *
+ *  Runs the animation controller and sprite animator of each entity under
+ *  one registry lock.  When @p out_cmds is not NULL, the source rect of
+ *  @p out_cmds[i] receives the current frame of @p entities[i]; commands of
+ *  entities without a sprite animator are left untouched.
+ *
+ *  @param context            Valid engine context.
+ *  @param entities           Array of @p count distinct entities.
+ *  @param count              Number of entities.
+ *  @param dt                 Seconds to advance.
+ *  @param[out] out_cmds      Optional; @p count commands, e.g. for goud_renderer_draw_sprite_cmds().
+ *  @param[out] out_updated   Optional; receives the number of entities with a sprite animator.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p entities is NULL with a non-zero @p count, or names an entity twice.
+ */
+static inline int goud_animation_update_animators(
+    goud_context context,
+    const goud_entity *entities,
+    uint32_t count,
+    float dt,
+    goud_sprite_cmd *out_cmds,
+    uint32_t *out_updated
+) {
+    int32_t updated;
+
+    if (out_updated != NULL) {
+        *out_updated = 0;
+    }
+    if (count == 0) {
+        return SUCCESS;
+    }
+    if (entities == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    updated = goud_animation_update_batch(context, entities, count, dt, out_cmds);
+    if (updated < 0) {
+        return goud_status_last_error_or((int)-updated);
+    }
+    if (out_updated != NULL) {
+        *out_updated = (uint32_t)updated;
+    }
+    return SUCCESS;
+}
+
+/** @brief Attach an empty skeleton to an entity, replacing any existing one.
+ *  @param context  Valid engine context.
+ *  @param entity   Live entity.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_skeleton_attach(goud_context context, goud_entity entity) {
+    int32_t code = goud_skeleton_create(context, entity);
+    return code < 0 ? goud_status_last_error_or((int)-code) : SUCCESS;
+}
+
+/** @brief Append a bone to an entity's skeleton.
+ *
+ *  Bones are numbered in the order they are added; a parent must be added
+ *  before its children.
+ *
+ *  @param context        Valid engine context.
+ *  @param entity         Entity with a skeleton.
+ *  @param name           Bone name.
+ *  @param parent         Parent bone index, or -1 for a root bone.
+ *  @param x              Local position X relative to the parent.
+ *  @param y              Local position Y relative to the parent.
+ *  @param rotation       Local rotation in radians.
+ *  @param[out] out_bone  Optional; receives the new bone's index.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p name is NULL.
+ */
+static inline int goud_skeleton_bone_add(
+    goud_context context,
+    goud_entity entity,
+    const char *name,
+    int32_t parent,
+    float x,
+    float y,
+    float rotation,
+    int32_t *out_bone
+) {
+    int32_t bone;
+
+    if (name == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    bone = goud_skeleton_add_bone(context, entity, (const uint8_t *)name, (int32_t)strlen(name),
+                                  parent, x, y, rotation);
+    if (bone < 0) {
+        return goud_status_last_error_or((int)-bone);
+    }
+    if (out_bone != NULL) {
+        *out_bone = bone;
+    }
+    return SUCCESS;
+}
+
+/** @brief Set a bone's local position and rotation, keeping its scale.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_skeleton_bone_set(
+    goud_context context,
+    goud_entity entity,
+    int32_t bone,
+    float x,
+    float y,
+    float rotation
+) {
+    int32_t code = goud_skeleton_set_bone_transform(context, entity, bone, x, y, rotation);
+    return code < 0 ? goud_status_last_error_or((int)-code) : SUCCESS;
+}
+
+/** @brief Start a new, empty base clip on an entity's skeleton.
+ *
+ *  Replaces the entity's skeletal animator, discarding its clips and
+ *  layers.  The clip lasts one second until keyframes extend it.
+ *
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p clip is NULL.
+ */
+static inline int goud_skeleton_play(goud_context context, goud_entity entity, const char *clip, bool looping) {
+    int32_t code;
+
+    if (clip == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    code = goud_skeleton_play_clip(context, entity, (const uint8_t *)clip, (int32_t)strlen(clip), looping);
+    return code < 0 ? goud_status_last_error_or((int)-code) : SUCCESS;
+}
+
+/** @brief Key a bone's local transform in one of an entity's skeletal clips.
+ *
+ *  A keyframe at the time of an existing one on that bone replaces it;
+ *  one past the clip's end extends the clip.
+ *
+ *  @param context   Valid engine context.
+ *  @param entity    Entity with a playing skeletal clip.
+ *  @param layer     0 for the base clip, or a layer from goud_skeleton_layer_push().
+ *  @param bone      Bone index.
+ *  @param time      Seconds from the start of the clip (>= 0).
+ *  @return SUCCESS on success.
+ */
+static inline int goud_skeleton_keyframe(
+    goud_context context,
+    goud_entity entity,
+    int32_t layer,
+    int32_t bone,
+    float time,
+    float x,
+    float y,
+    float rotation,
+    float scale_x,
+    float scale_y
+) {
+    int32_t code = goud_skeleton_add_keyframe(context, entity, layer, bone, time, x, y, rotation,
+                                              scale_x, scale_y);
+    return code < 0 ? goud_status_last_error_or((int)-code) : SUCCESS;
+}
+
+/** @brief Add a clip blended over an entity's base skeletal clip.
+ *
+ *  Override layers blend toward their pose by their weight; additive
+ *  layers add their weighted offset from the rest pose.  While the entity
+ *  has an animation layer (goud_animation_layer_add()) of the same name,
+ *  that layer's weight and blend mode apply instead.
+ *
+ *  @param context         Valid engine context.
+ *  @param entity          Entity with a playing skeletal clip.
+ *  @param name            Layer name.
+ *  @param blend_mode      0 = override, 1 = additive.
+ *  @param looping         Whether the layer's clip loops.
+ *  @param[out] out_layer  Optional; receives the layer index (>= 1).
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p name is NULL.
+ */
+static inline int goud_skeleton_layer_push(
+    goud_context context,
+    goud_entity entity,
+    const char *name,
+    uint32_t blend_mode,
+    bool looping,
+    int32_t *out_layer
+) {
+    int32_t layer;
+
+    if (name == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    layer = goud_skeleton_layer_add(context, entity, (const uint8_t *)name, (int32_t)strlen(name),
+                                    blend_mode, looping);
+    if (layer < 0) {
+        return goud_status_last_error_or((int)-layer);
+    }
+    if (out_layer != NULL) {
+        *out_layer = layer;
+    }
+    return SUCCESS;
+}
+
+/** @brief Set a skeletal layer's blend weight, clamped to [0, 1].
+ *  @return SUCCESS on success.
+ */
+static inline int goud_skeleton_layer_weight(goud_context context, goud_entity entity, int32_t layer, float weight) {
+    int32_t code = goud_skeleton_layer_set_weight(context, entity, layer, weight);
+    return code < 0 ? goud_status_last_error_or((int)-code) : SUCCESS;
+}
+
+/** @brief Advance many skeletons and write all their skinning matrices into one palette.
+ *
+ *  Each bone takes GOUD_BONE_PALETTE_FLOATS floats: the first two rows of
+ *  its skinning matrix, each padded to a vec4, skeletons back to back in
+ *  array order, so the palette uploads as one std140 buffer.  Pass NULL
+ *  for @p out_palette to only size the palette: offsets and the bone total
+ *  are reported and nothing is advanced.
+ *
+ *  @param context            Valid engine context.
+ *  @param entities           Array of @p count distinct entities.
+ *  @param count              Number of entities.
+ *  @param dt                 Seconds to advance.
+ *  @param[out] out_palette   Optional; @p palette_len floats.
+ *  @param palette_len        Number of floats @p out_palette holds.
+ *  @param[out] out_offsets   Optional; @p count + 1 values, the first bone of each entity then the total.
+ *  @param[out] out_bones     Optional; receives the total number of bones.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p entities is NULL with a non-zero @p count, names an entity
+ *                             twice, or @p out_palette is too short.
+ */
+static inline int goud_skeleton_update_palettes(
+    goud_context context,
+    const goud_entity *entities,
+    uint32_t count,
+    float dt,
+    float *out_palette,
+    uint32_t palette_len,
+    uint32_t *out_offsets,
+    uint32_t *out_bones
+) {
+    int32_t bones;
+
+    if (out_bones != NULL) {
+        *out_bones = 0;
+    }
+    if (count > 0 && entities == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    bones = goud_skeleton_update_batch(context, entities, count, dt, out_palette, palette_len,
+                                       out_offsets);
+    if (bones < 0) {
+        return goud_status_last_error_or((int)-bones);
+    }
+    if (out_bones != NULL) {
+        *out_bones = (uint32_t)bones;
+    }
+    return SUCCESS;
+}
+
+/** @} */ /* end animation */
+
+/* ========================================================================= */
+/** @defgroup physics Physics
+ *  2D physics world lifecycle, bodies, and bulk body state transfer.
+ *  @{ */
+/* ========================================================================= */
+
+/** @brief Create the context's 2D physics world.
+ *
+ *  Call goud_physics_world_destroy() before destroying the context.
+ *
+ *  @param context  Valid engine context.
+ *  @param gravity  Gravity vector.
+ *  @param backend  0 = default, 1 = Rapier2D, 2 = simple.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_physics_world_create(goud_context context, goud_vec2 gravity, uint32_t backend) {
+    int32_t code = goud_physics_create_with_backend(context, gravity.x, gravity.y, backend);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Destroy the context's 2D physics world.
+ *  @param context  Valid engine context.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_physics_world_destroy(goud_context context) {
+    int32_t code = goud_physics_destroy(context);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Advance the simulation.
+ *  @param context  Valid engine context.
+ *  @param dt       Step length in seconds.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_physics_world_step(goud_context context, float dt) {
+    int32_t code = goud_physics_step(context, dt);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Add a rigid body.
+ *  @param context        Valid engine context.
+ *  @param body_type      0 = static, 1 = dynamic, 2 = kinematic.
+ *  @param position       Initial position.
+ *  @param gravity_scale  Multiplier applied to world gravity.
+ *  @param[out] out_body  Receives the body handle.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_body is NULL.
+ */
+static inline int goud_physics_body_add(
+    goud_context context,
+    uint32_t body_type,
+    goud_vec2 position,
+    float gravity_scale,
+    goud_physics_body *out_body
+) {
+    int64_t handle;
+
+    if (out_body == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    handle = goud_physics_add_rigid_body(context, body_type, position.x, position.y, gravity_scale);
+    *out_body = handle >= 0 ? (goud_physics_body)handle : 0;
+    return handle >= 0 ? SUCCESS : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+}
+
+/** @brief Attach a collider to a body.
+ *  @param context      Valid engine context.
+ *  @param body         Body returned by goud_physics_body_add().
+ *  @param shape_type   0 = circle, 1 = box, 2 = capsule.
+ *  @param size         Box width and height.
+ *  @param radius       Circle or capsule radius.
+ *  @param friction     Friction coefficient.
+ *  @param restitution  Bounciness.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_physics_collider_add(
+    goud_context context,
+    goud_physics_body body,
+    uint32_t shape_type,
+    goud_vec2 size,
+    float radius,
+    float friction,
+    float restitution
+) {
+    int64_t handle = goud_physics_add_collider(
+        context, body, shape_type, size.x, size.y, radius, friction, restitution);
+    return handle >= 0 ? SUCCESS : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+}
+
+/** @brief Remove a body and its colliders.
+ *  @param context  Valid engine context.
+ *  @param body     Body to remove.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_physics_body_remove(goud_context context, goud_physics_body body) {
+    int32_t code = goud_physics_remove_body(context, body);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Read the state of many bodies in one call.
+ *
+ *  Element @c i of each output receives the state of @p bodies[i].  Any
+ *  output may be NULL to skip it.  Slots of stale handles are zeroed.
+ *
+ *  @param context             Valid engine context.
+ *  @param bodies              Body handles.
+ *  @param count               Number of handles.
+ *  @param[out] out_positions  Optional; receives @p count positions.
+ *  @param[out] out_velocities Optional; receives @p count linear velocities.
+ *  @param[out] out_rotations  Optional; receives @p count angles in radians.
+ *  @return SUCCESS when every body was read.
+ *  @retval ERR_INVALID_STATE   @p bodies is NULL and @p count is non-zero.
+ *  @retval ERR_INVALID_HANDLE  At least one handle was stale.
+ */
+static inline int goud_physics_read_bodies(
+    goud_context context,
+    const goud_physics_body *bodies,
+    uint32_t count,
+    goud_vec2 *out_positions,
+    goud_vec2 *out_velocities,
+    float *out_rotations
+) {
+    if (count == 0) {
+        return SUCCESS;
+    }
+    if (bodies == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    return goud_physics_get_bodies(
+               context, bodies, count, out_positions, out_velocities, out_rotations) == count
+               ? SUCCESS
+               : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+}
+
+/** @brief Set the linear velocity of many bodies in one call.
+ *  @param context     Valid engine context.
+ *  @param bodies      Body handles.
+ *  @param velocities  One velocity per handle.
+ *  @param count       Number of handles.
+ *  @return SUCCESS when every body was updated.
+ *  @retval ERR_INVALID_STATE   @p bodies or @p velocities is NULL and @p count is non-zero.
+ *  @retval ERR_INVALID_HANDLE  At least one handle was stale.
+ */
+static inline int goud_physics_write_velocities(
+    goud_context context,
+    const goud_physics_body *bodies,
+    const goud_vec2 *velocities,
+    uint32_t count
+) {
+    if (count == 0) {
+        return SUCCESS;
+    }
+    if (bodies == NULL || velocities == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    return goud_physics_set_velocities(context, bodies, count, velocities) == count
+               ? SUCCESS
+               : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+}
+
+/** @brief Count the collision events buffered by the last step.
+ *  @param context         Valid engine context.
+ *  @param[out] out_count  Receives the number of events.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_count is NULL.
+ */
+static inline int goud_physics_collision_event_total(goud_context context, uint32_t *out_count) {
+    int32_t count;
+
+    if (out_count == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    goud_clear_last_error();
+    count = goud_physics_collision_events_count(context);
+    *out_count = goud_last_error_code() == SUCCESS && count > 0 ? (uint32_t)count : 0;
+    return goud_status_last_error_or(SUCCESS);
+}
+
+/** @brief Copy the collision events buffered by the last step in one call.
+ *
+ *  Only events where either body has a collider on a layer in
+ *  @p layer_mask are copied; pass UINT32_MAX to copy all of them.  A
+ *  buffer sized by goud_physics_collision_event_total() holds every match.
+ *
+ *  @param context            Valid engine context.
+ *  @param layer_mask         Collision layers to keep.
+ *  @param[out] out_events    Buffer of @p capacity events.
+ *  @param capacity           Number of events @p out_events can hold.
+ *  @param[out] out_written   Optional; receives the number of events copied.
+ *  @return SUCCESS on success (including no events).
+ *  @retval ERR_INVALID_STATE  @p out_events is NULL with a non-zero @p capacity.
+ */
+static inline int goud_physics_copy_collision_events(
+    goud_context context,
+    uint32_t layer_mask,
+    goud_collision_event *out_events,
+    uint32_t capacity,
+    uint32_t *out_written
+) {
+    uint32_t written;
+
+    if (out_written != NULL) {
+        *out_written = 0;
+    }
+    if (capacity == 0) {
+        return SUCCESS;
+    }
+    if (out_events == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    goud_clear_last_error();
+    written = goud_physics_collision_events_copy(context, layer_mask, out_events, capacity);
+    if (out_written != NULL) {
+        *out_written = written;
+    }
+    return written == 0 ? goud_status_last_error_or(SUCCESS) : SUCCESS;
+}
+
+/** @brief Cast many rays in one call.
+ *
+ *  @p out_hits[i] receives the first hit of @p rays[i]; misses have
+ *  @c hit == 0.  Only colliders on a layer in @p layer_mask are hit.
+ *
+ *  @param context              Valid engine context.
+ *  @param rays                 Array of @p count rays.
+ *  @param count                Number of rays.
+ *  @param layer_mask           Collision layers to test.
+ *  @param[out] out_hits        Buffer of @p count results.
+ *  @param[out] out_hit_count   Optional; receives the number of rays that hit.
+ *  @return SUCCESS on success (including no hits).
+ *  @retval ERR_INVALID_STATE  @p rays or @p out_hits is NULL with a non-zero @p count.
+ */
+static inline int goud_physics_raycast_many(
+    goud_context context,
+    const goud_ray *rays,
+    uint32_t count,
+    uint32_t layer_mask,
+    goud_raycast_hit *out_hits,
+    uint32_t *out_hit_count
+) {
+    uint32_t hits;
+
+    if (out_hit_count != NULL) {
+        *out_hit_count = 0;
+    }
+    if (count == 0) {
+        return SUCCESS;
+    }
+    if (rays == NULL || out_hits == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    goud_clear_last_error();
+    hits = goud_physics_raycast_batch(context, rays, count, layer_mask, out_hits);
+    if (out_hit_count != NULL) {
+        *out_hit_count = hits;
+    }
+    return hits == 0 ? goud_status_last_error_or(SUCCESS) : SUCCESS;
+}
+
+/** @brief Test many rectangles for overlap with colliders in one call.
+ *
+ *  @p out_bodies[i] receives a body overlapping @p rects[i], or 0.
+ *
+ *  @param context             Valid engine context.
+ *  @param rects               Array of @p count rectangles.
+ *  @param count               Number of rectangles.
+ *  @param layer_mask          Collision layers to test.
+ *  @param[out] out_bodies     Buffer of @p count body handles.
+ *  @param[out] out_overlaps   Optional; receives the number of overlapping rectangles.
+ *  @return SUCCESS on success (including no overlaps).
+ *  @retval ERR_INVALID_STATE  @p rects or @p out_bodies is NULL with a non-zero @p count.
+ */
+static inline int goud_physics_overlap_rects(
+    goud_context context,
+    const goud_rect *rects,
+    uint32_t count,
+    uint32_t layer_mask,
+    goud_physics_body *out_bodies,
+    uint32_t *out_overlaps
+) {
+    uint32_t overlaps;
+
+    if (out_overlaps != NULL) {
+        *out_overlaps = 0;
+    }
+    if (count == 0) {
+        return SUCCESS;
+    }
+    if (rects == NULL || out_bodies == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    goud_clear_last_error();
+    overlaps = goud_physics_overlap_rect_batch(context, rects, count, layer_mask, out_bodies);
+    if (out_overlaps != NULL) {
+        *out_overlaps = overlaps;
+    }
+    return overlaps == 0 ? goud_status_last_error_or(SUCCESS) : SUCCESS;
+}
+
+/** @brief Save the context's whole 2D physics state for rollback.
+ *  @param context         Valid engine context with a 2D physics world.
+ *  @param[out] out_state  Receives the state handle.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_state is NULL.
+ */
+static inline int goud_physics_state_capture(goud_context context, goud_physics_state *out_state) {
+    goud_physics_state state;
+
+    if (out_state == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    state = goud_physics_save_state(context);
+    *out_state = state;
+    return state >= 0 ? SUCCESS : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+}
+
+/** @brief Overwrite a saved state with the context's current 2D physics.
+ *  @param context  Valid engine context.
+ *  @param state    State handle from goud_physics_state_capture().
+ *  @return SUCCESS on success.
+ */
+static inline int goud_physics_state_update(goud_context context, goud_physics_state state) {
+    int32_t code = goud_physics_save_state_into(context, state);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Restore the context's 2D physics to a saved state.
+ *  @param context  Valid engine context.
+ *  @param state    State handle.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_physics_state_apply(goud_context context, goud_physics_state state) {
+    int32_t code = goud_physics_load_state(context, state);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Free a saved 2D physics state.
+ *  @param state  State handle.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_physics_state_release(goud_physics_state state) {
+    int32_t code = goud_physics_free_state(state);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Enable or disable deterministic 2D stepping.
+ *
+ *  While enabled, steps advance by the fixed timestep regardless of @p dt
+ *  and collision events arrive in a stable order.
+ *
+ *  @param context  Valid engine context.
+ *  @param enabled  true to enable.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_physics_world_set_deterministic(goud_context context, bool enabled) {
+    int32_t code = goud_physics_set_deterministic(context, enabled);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @} */ /* end physics */
+
+/* ========================================================================= */
+/** @defgroup network Network
+ *  Host and client connections, message send, and batched receive.
+ *  @{ */
+/* ========================================================================= */
+
+/** @brief Start hosting on @p port.
+ *  @param context            Valid engine context.
+ *  @param protocol           0 = UDP, 1 = WebSocket, 2 = TCP.
+ *  @param port               Port to listen on.
+ *  @param[out] out_network   Receives the network handle, or 0 on failure.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_network is NULL.
+ */
+static inline int goud_network_open_host(
+    goud_context context,
+    int32_t protocol,
+    uint16_t port,
+    goud_network *out_network
+) {
+    int64_t handle;
+
+    if (out_network == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    handle = goud_network_host(context, protocol, port);
+    *out_network = handle > 0 ? handle : 0;
+    return handle > 0 ? SUCCESS : goud_status_last_error_or(ERR_INTERNAL_ERROR);
+}
+
+/** @brief Connect to a remote host.
+ *  @param context            Valid engine context.
+ *  @param protocol           0 = UDP, 1 = WebSocket, 2 = TCP.
+ *  @param address            Null-terminated host name or IP, optionally with ":port".
+ *  @param port               Port used when @p address has none.
+ *  @param[out] out_network   Receives the network handle, or 0 on failure.
+ *  @param[out] out_peer_id   Optional; receives the server's peer ID.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p address or @p out_network is NULL.
+ */
+static inline int goud_network_open_client(
+    goud_context context,
+    int32_t protocol,
+    const char *address,
+    uint16_t port,
+    goud_network *out_network,
+    uint64_t *out_peer_id
+) {
+    int64_t handle = 0;
+    uint64_t peer_id = 0;
+    int32_t code;
+
+    if (out_network == NULL) {
+        return ERR_INVALID_STATE;
+    }
+    *out_network = 0;
+    if (address == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    code = goud_network_connect_with_peer(context, protocol, (const uint8_t *)address,
+                                          (int32_t)strlen(address), port, &handle, &peer_id);
+    if (code != 0) {
+        return goud_status_last_error_or((int)code);
+    }
+    *out_network = handle;
+    if (out_peer_id != NULL) {
+        *out_peer_id = peer_id;
+    }
+    return SUCCESS;
+}
+
+/** @brief Disconnect every peer and destroy the network handle.
+ *  @param context  Valid engine context.
+ *  @param network  Handle from goud_network_open_host() or goud_network_open_client().
+ *  @return SUCCESS on success.
+ */
+static inline int goud_network_close(goud_context context, goud_network network) {
+    int32_t code = goud_network_disconnect(context, network);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Send one message to @p peer_id.
+ *  @param context  Valid engine context.
+ *  @param network  Network handle.
+ *  @param peer_id  Destination peer.
+ *  @param data     Message bytes.
+ *  @param size     Message size in bytes.
+ *  @param channel  0 = reliable-ordered, 1+ = unreliable (UDP).
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p data is NULL with a non-zero @p size, or @p size exceeds INT32_MAX.
+ */
+static inline int goud_network_send_bytes(
+    goud_context context,
+    goud_network network,
+    uint64_t peer_id,
+    const void *data,
+    size_t size,
+    uint8_t channel
+) {
+    static const uint8_t empty = 0;
+    int32_t code;
+
+    if ((data == NULL && size != 0) || size > (size_t)INT32_MAX) {
+        return ERR_INVALID_STATE;
+    }
+
+    code = goud_network_send(context, network, peer_id,
+                             data != NULL ? (const uint8_t *)data : &empty, (int32_t)size, channel);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Pump the transport and queue received messages.
+ *  @param context  Valid engine context.
+ *  @param network  Network handle.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_network_update(goud_context context, goud_network network) {
+    int32_t code = goud_network_poll(context, network);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Move many queued messages into @p buffer in one call.
+ *
+ *  Payloads are packed back to back; @p out_messages[i] gives the peer,
+ *  offset, and length of the @c i-th.  Messages that do not fit stay queued
+ *  for the next call.
+ *
+ *  @param context            Valid engine context.
+ *  @param network            Network handle.
+ *  @param buffer             Receives the payloads.
+ *  @param buffer_size        Size of @p buffer in bytes.
+ *  @param[out] out_messages  Buffer of @p max_messages descriptors.
+ *  @param max_messages       Capacity of @p out_messages.
+ *  @param[out] out_count     Receives the number of messages moved (0 when none are queued).
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  A pointer is NULL, a capacity is 0, or the next message is
+ *                             larger than @p buffer_size; goud_network_next_message_size()
+ *                             reports the size it needs.
+ */
+static inline int goud_network_receive_batch(
+    goud_context context,
+    goud_network network,
+    uint8_t *buffer,
+    uint32_t buffer_size,
+    goud_network_message *out_messages,
+    uint32_t max_messages,
+    uint32_t *out_count
+) {
+    int32_t code;
+
+    if (out_count == NULL) {
+        return ERR_INVALID_STATE;
+    }
+    *out_count = 0;
+    if (buffer == NULL || out_messages == NULL || buffer_size == 0 || max_messages == 0) {
+        return ERR_INVALID_STATE;
+    }
+
+    code = goud_network_receive_many(context, network, buffer, buffer_size, out_messages, max_messages,
+                                     out_count);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Report the sender and size of the next queued message without moving it.
+ *
+ *  Use it to grow a goud_network_receive_batch() buffer that is too small
+ *  for the next message.
+ *
+ *  @param context           Valid engine context.
+ *  @param network           Network handle.
+ *  @param[out] out_peer_id  Receives the sender (0 when nothing is queued).
+ *  @param[out] out_size     Receives the payload size in bytes (0 when nothing is queued).
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  A pointer is NULL.
+ */
+static inline int goud_network_next_message_size(
+    goud_context context,
+    goud_network network,
+    uint64_t *out_peer_id,
+    uint32_t *out_size
+) {
+    int32_t code;
+
+    if (out_peer_id == NULL || out_size == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    code = goud_network_peek_size(context, network, out_peer_id, out_size);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Read aggregate traffic counters.
+ *  @param context          Valid engine context.
+ *  @param network          Network handle.
+ *  @param[out] out_stats   Receives the counters.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_stats is NULL.
+ */
+static inline int goud_network_stats_get(goud_context context, goud_network network, goud_network_stats *out_stats) {
+    int32_t code;
+
+    if (out_stats == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    code = goud_network_get_stats_v2(context, network, out_stats);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @} */ /* end network */
+
+/* ========================================================================= */
+/** @defgroup metrics Metrics
+ *  Binary counters for monitoring: render metrics, frame phase timings,
+ *  frame arena, FPS, entity count, memory and network totals, published
+ *  once per frame into a double buffer that any thread copies lock-free.
+ *  @{ */
+/* ========================================================================= */
+
+/** @brief Get the buffer @p context publishes its metrics into.
+ *
+ *  The first call enables publishing at the end of every rendered frame.
+ *  The buffer stays valid until the context is destroyed and may be read
+ *  from any thread with goud_metrics_copy().
+ *
+ *  @param context          Valid engine context; call from its thread.
+ *  @param[out] out_buffer  Receives the buffer.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p out_buffer is NULL.
+ */
+static inline int goud_metrics_get_buffer(goud_context context, const goud_metrics_double_buffer **out_buffer) {
+    if (out_buffer == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    *out_buffer = goud_metrics_buffer(context);
+    return *out_buffer != NULL ? SUCCESS : goud_status_last_error_or(ERR_INVALID_CONTEXT);
+}
+
+/** @brief Publish @p context's metrics into caller-owned storage.
+ *
+ *  Point @p buffer into a shared-memory mapping to let another process read
+ *  the metrics.  The engine initialises it; it must stay valid until it is
+ *  detached by passing NULL or the context is destroyed.
+ *
+ *  @param context  Valid engine context; call from its thread.
+ *  @param buffer   8-byte aligned storage, or NULL to detach.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_metrics_share(goud_context context, goud_metrics_double_buffer *buffer) {
+    int32_t code = goud_metrics_attach_buffer(context, buffer);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Gather and publish @p context's metrics now.
+ *
+ *  Headless contexts, which never call goud_renderer_end(), publish with
+ *  this once per tick.
+ *
+ *  @param context  Valid engine context; call from its thread.
+ *  @return SUCCESS on success.
+ */
+static inline int goud_metrics_publish_now(goud_context context) {
+    int32_t code = goud_metrics_publish(context);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @brief Copy the latest block out of @p buffer without locking.
+ *
+ *  Callable from any thread.  Before the first publish the block is zeroed
+ *  and its publish_index is 0.
+ *
+ *  @param buffer          Buffer from goud_metrics_get_buffer() or goud_metrics_share().
+ *  @param[out] out_block  Receives the block.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  A pointer is NULL or the buffer layout does not match.
+ */
+static inline int goud_metrics_copy(const goud_metrics_double_buffer *buffer, goud_metrics_block *out_block) {
+    int32_t code;
+
+    if (buffer == NULL || out_block == NULL) {
+        return ERR_INVALID_STATE;
+    }
+
+    code = goud_metrics_read(buffer, out_block);
+    return code == 0 ? SUCCESS : goud_status_last_error_or((int)code);
+}
+
+/** @} */ /* end metrics */
 
 #ifdef __cplusplus
 }  /* extern "C" */
@@ -0,0 +1,142 @@
+/* Test the header-only batch collision kernels against per-pair references.
+ * The references repeat the engine helpers in goud_engine/src/ffi/collision.rs,
+ * so the SIMD and scalar paths must agree with them bit for bit. */
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <goud/collision_batch.h>
+
+/* The references must round like the engine too, including in the FMA build. */
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC optimize("fp-contract=off")
+#else
+#pragma STDC FP_CONTRACT OFF
+#endif
+
+#define N 37u
+
+static int ref_aabb(float min_a_x, float min_a_y, float max_a_x, float max_a_y,
+                    float min_b_x, float min_b_y, float max_b_x, float max_b_y) {
+    return max_a_x >= min_b_x && min_a_x <= max_b_x && max_a_y >= min_b_y && min_a_y <= max_b_y;
+}
+
+static int ref_circle(float x1, float y1, float r1, float x2, float y2, float r2) {
+    float dx = x2 - x1;
+    float dy = y2 - y1;
+    float combined_radius = r1 + r2;
+    return (dx * dx + dy * dy) <= (combined_radius * combined_radius);
+}
+
+static int ref_point_in_rect(float px, float py, float rx, float ry, float rw, float rh) {
+    return px >= rx && px <= rx + rw && py >= ry && py <= ry + rh;
+}
+
+static int mask_bit(const uint32_t *mask, uint32_t i) {
+    return (int)((mask[i >> 5] >> (i & 31u)) & 1u);
+}
+
+/* Deterministic values on a coarse grid so exact edge contacts occur. */
+static float grid(uint32_t i, uint32_t salt) {
+    return (float)((i * 7u + salt * 13u) % 11u) * 0.5f - 2.5f;
+}
+
+int main(void) {
+    float min_x[N], min_y[N], max_x[N], max_y[N], cx[N], cy[N], cr[N];
+    float dist_sq[N];
+    uint32_t mask[GOUD_COLLISION_MASK_WORDS(N)];
+    uint32_t indices[N];
+    goud_index_pair pairs[N * N];
+    goud_aabb_soa boxes = {min_x, min_y, max_x, max_y};
+    goud_circle_soa circles = {cx, cy, cr};
+    uint32_t i, count, hits, expected, total;
+
+    for (i = 0; i < N; ++i) {
+        min_x[i] = grid(i, 1);
+        min_y[i] = grid(i, 2);
+        max_x[i] = min_x[i] + 0.5f + (float)(i % 3u);
+        max_y[i] = min_y[i] + 0.5f + (float)(i % 2u);
+        cx[i] = grid(i, 3) * 1.1f;
+        cy[i] = grid(i, 4) * 0.7f;
+        cr[i] = 0.25f + (float)(i % 4u) * 0.3f;
+    }
+    cx[5] = NAN;
+    min_x[6] = NAN;
+
+    /* Every length exercises the vector body and the scalar tail. */
+    for (count = 0; count <= N; ++count) {
+        hits = goud_collision_aabb_overlap_many(-1.0f, -1.0f, 1.0f, 1.0f, boxes, count, mask);
+        expected = 0;
+        for (i = 0; i < count; ++i) {
+            int ref = ref_aabb(-1.0f, -1.0f, 1.0f, 1.0f, min_x[i], min_y[i], max_x[i], max_y[i]);
+            assert(mask_bit(mask, i) == ref);
+            expected += (uint32_t)ref;
+        }
+        assert(hits == expected);
+        assert(goud_collision_mask_indices(mask, count, indices) == hits);
+
+        hits = goud_collision_circle_overlap_many(0.3f, -0.2f, 1.0f, circles, count, mask);
+        expected = 0;
+        for (i = 0; i < count; ++i) {
+            int ref = ref_circle(0.3f, -0.2f, 1.0f, cx[i], cy[i], cr[i]);
+            assert(mask_bit(mask, i) == ref);
+            expected += (uint32_t)ref;
+        }
+        assert(hits == expected);
+
+        hits = goud_collision_point_in_rect_many(-1.0f, -0.5f, 2.0f, 1.5f, cx, cy, count, mask);
+        expected = 0;
+        for (i = 0; i < count; ++i) {
+            int ref = ref_point_in_rect(cx[i], cy[i], -1.0f, -0.5f, 2.0f, 1.5f);
+            assert(mask_bit(mask, i) == ref);
+            expected += (uint32_t)ref;
+        }
+        assert(hits == expected);
+
+        goud_collision_distance_squared_many(0.1f, 0.2f, cx, cy, count, dist_sq);
+        for (i = 0; i < count; ++i) {
+            float dx = cx[i] - 0.1f;
+            float dy = cy[i] - 0.2f;
+            float ref = dx * dx + dy * dy;
+            assert(memcmp(&dist_sq[i], &ref, sizeof ref) == 0);
+        }
+    }
+
+    /* Index lists come out ascending. */
+    hits = goud_collision_aabb_overlap_many(-1.0f, -1.0f, 1.0f, 1.0f, boxes, N, mask);
+    assert(goud_collision_mask_indices(mask, N, indices) == hits);
+    for (i = 1; i < hits; ++i) {
+        assert(indices[i - 1] < indices[i]);
+    }
+
+    /* Many-vs-many matches a brute-force pass, in a-then-b order. */
+    total = goud_collision_aabb_pairs(boxes, N, boxes, N, pairs, N * N);
+    expected = 0;
+    for (i = 0; i < N * N; ++i) {
+        uint32_t a = i / N, b = i % N;
+        if (ref_aabb(min_x[a], min_y[a], max_x[a], max_y[a], min_x[b], min_y[b], max_x[b], max_y[b])) {
+            assert(pairs[expected].a == a && pairs[expected].b == b);
+            ++expected;
+        }
+    }
+    assert(total == expected);
+
+    total = goud_collision_circle_pairs(circles, N, circles, N, pairs, N * N);
+    expected = 0;
+    for (i = 0; i < N * N; ++i) {
+        uint32_t a = i / N, b = i % N;
+        if (ref_circle(cx[a], cy[a], cr[a], cx[b], cy[b], cr[b])) {
+            assert(pairs[expected].a == a && pairs[expected].b == b);
+            ++expected;
+        }
+    }
+    assert(total == expected);
+
+    /* A short buffer still reports the full pair count. */
+    assert(goud_collision_circle_pairs(circles, N, circles, N, pairs, 3) == total);
+    assert(goud_collision_circle_pairs(circles, N, circles, N, NULL, 0) == total);
+
+    printf("test_collision_batch: all assertions passed\n");
+    return 0;
+}
@@ -0,0 +1,129 @@
+#include <benchmark/benchmark.h>
+#include <goud/component_view.hpp>
+
+#include <cstdint>
+#include <vector>
+
+// Entity spawn one call per entity versus goud_entity_spawn_many, and
+// component reads through goud_component_get versus one goud_component_get_all.
+
+namespace {
+
+constexpr std::uint32_t kEntities = 1000;
+
+struct Position {
+    float x;
+    float y;
+};
+
+goud::Context &context() {
+    static goud::Context ctx = goud::Context::create();
+    return ctx;
+}
+
+void BM_SpawnDestroySingle(benchmark::State &state) {
+    goud::Context &ctx = context();
+    if (!ctx.valid()) {
+        state.SkipWithError("context creation failed");
+        return;
+    }
+    std::vector<std::uint64_t> entities(kEntities);
+
+    for (auto _ : state) {
+        for (std::uint64_t &entity : entities) {
+            ctx.spawnEntity(entity);
+        }
+        for (std::uint64_t entity : entities) {
+            ctx.destroyEntity(entity);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kEntities);
+}
+
+void BM_SpawnDestroyBatch(benchmark::State &state) {
+    goud::Context &ctx = context();
+    if (!ctx.valid()) {
+        state.SkipWithError("context creation failed");
+        return;
+    }
+    std::vector<std::uint64_t> entities(kEntities);
+
+    for (auto _ : state) {
+        ctx.spawnEntities(kEntities, entities.data());
+        ctx.destroyEntities(entities.data(), kEntities);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kEntities);
+}
+
+struct ComponentFixture {
+    std::vector<goud_entity> entities;
+    bool ready = false;
+
+    ComponentFixture() {
+        goud::Context &ctx = context();
+        if (!ctx.valid() || goud::ComponentView<Position>::registerType() != SUCCESS) {
+            return;
+        }
+        if (ctx.spawnEntities(kEntities, entities) != SUCCESS) {
+            return;
+        }
+        std::vector<Position> positions(kEntities);
+        for (std::uint32_t i = 0; i < kEntities; ++i) {
+            positions[i] = Position{ static_cast<float>(i), 0.0f };
+        }
+        goud::ComponentView<Position> view(ctx);
+        ready = view.addBatch(entities.data(), kEntities, positions.data()) == SUCCESS;
+    }
+};
+
+ComponentFixture &components() {
+    static ComponentFixture fixture;
+    return fixture;
+}
+
+void BM_ComponentGet(benchmark::State &state) {
+    ComponentFixture &fixture = components();
+    if (!fixture.ready) {
+        state.SkipWithError("component setup failed");
+        return;
+    }
+    goud::ComponentView<Position> view(context());
+
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (goud_entity entity : fixture.entities) {
+            const Position *position = view.get(entity);
+            sum += position != nullptr ? position->x : 0.0f;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * kEntities);
+}
+
+void BM_ComponentGetAll(benchmark::State &state) {
+    ComponentFixture &fixture = components();
+    if (!fixture.ready) {
+        state.SkipWithError("component setup failed");
+        return;
+    }
+    goud::ComponentView<Position> view(context());
+
+    for (auto _ : state) {
+        view.refresh();
+        float sum = 0.0f;
+        for (auto item : view) {
+            sum += item.component.x;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * kEntities);
+}
+
+}  // namespace
+
+BENCHMARK(BM_SpawnDestroySingle)->Name("cpp_ecs/spawn_destroy_single_1k");
+BENCHMARK(BM_SpawnDestroyBatch)->Name("cpp_ecs/spawn_destroy_batch_1k");
+BENCHMARK(BM_ComponentGet)->Name("cpp_component/get_1k");
+BENCHMARK(BM_ComponentGetAll)->Name("cpp_component/get_all_1k");
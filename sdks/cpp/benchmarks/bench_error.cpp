@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+#include <goud/goud.hpp>
+
+// Cost of reading the last error: Error::last() captures the code and
+// recovery class, message() then copies the text into the Error's inline
+// buffers, and Error::lastCode() reads the code alone.
+
+namespace {
+
+void raiseError() {
+    goud_entity entity = 0;
+    (void)goud_entity_spawn(goud_context_invalid(), &entity);
+}
+
+void BM_ErrorLastClear(benchmark::State &state) {
+    goud_clear_last_error();
+    for (auto _ : state) {
+        goud::Error error = goud::Error::last();
+        benchmark::DoNotOptimize(error);
+    }
+}
+
+void BM_ErrorLastSet(benchmark::State &state) {
+    raiseError();
+    for (auto _ : state) {
+        goud::Error error = goud::Error::last();
+        benchmark::DoNotOptimize(error);
+    }
+    goud_clear_last_error();
+}
+
+void BM_ErrorLastMessage(benchmark::State &state) {
+    raiseError();
+    for (auto _ : state) {
+        goud::Error error = goud::Error::last();
+        benchmark::DoNotOptimize(error.message().data());
+    }
+    goud_clear_last_error();
+}
+
+void BM_ErrorLastCode(benchmark::State &state) {
+    raiseError();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(goud::Error::lastCode());
+    }
+    goud_clear_last_error();
+}
+
+}  // namespace
+
+BENCHMARK(BM_ErrorLastClear)->Name("cpp_error/last_clear");
+BENCHMARK(BM_ErrorLastSet)->Name("cpp_error/last_set");
+BENCHMARK(BM_ErrorLastMessage)->Name("cpp_error/last_message");
+BENCHMARK(BM_ErrorLastCode)->Name("cpp_error/last_code");
@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+#include <goud/goud.hpp>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Per-call cost of drawSprite() sent straight to the engine versus recorded
+// into the SpriteBatch and submitted with one goud_renderer_draw_sprite_batch.
+// Needs a window and GL context; the benchmarks are skipped without one.
+
+namespace {
+
+constexpr int kSprites = 1000;
+constexpr goud_color kWhite{ 1.0f, 1.0f, 1.0f, 1.0f };
+
+struct RenderFixture {
+    goud::Engine engine;
+    goud_texture texture = UINT64_MAX;
+
+    RenderFixture() {
+        int status = ERR_INTERNAL_ERROR;
+        auto config = goud::EngineConfig::create(&status);
+        if (status != SUCCESS) {
+            return;
+        }
+        config.setTitle("goud_cpp_benchmarks");
+        config.setSize(320, 240);
+        config.setVsync(false);
+        engine = goud::Engine::create(std::move(config), &status);
+        if (status != SUCCESS) {
+            return;
+        }
+        const std::vector<std::uint8_t> pixels(16 * 16 * 4, 0xFF);
+        (void)goud_texture_upload_rgba8(engine.raw(), pixels.data(), 16, 16, &texture);
+    }
+
+    bool valid() const noexcept {
+        return engine.valid() && texture != UINT64_MAX;
+    }
+};
+
+RenderFixture &fixture() {
+    static RenderFixture render;
+    return render;
+}
+
+void drawFrame(benchmark::State &state, bool batching) {
+    RenderFixture &render = fixture();
+    if (!render.valid()) {
+        state.SkipWithError("no window or GL context");
+        return;
+    }
+    goud::Context &ctx = render.engine.context();
+    ctx.setSpriteBatching(batching);
+
+    for (auto _ : state) {
+        ctx.beginFrame();
+        for (int i = 0; i < kSprites; ++i) {
+            float x = static_cast<float>(i % 40) * 8.0f;
+            float y = static_cast<float>(i / 40) * 8.0f;
+            ctx.drawSprite(render.texture, x, y, 8.0f, 8.0f, 0.0f, kWhite);
+        }
+        benchmark::DoNotOptimize(ctx.endFrame());
+    }
+    state.SetItemsProcessed(state.iterations() * kSprites);
+    ctx.setSpriteBatching(true);
+}
+
+void BM_DrawSpriteDirect(benchmark::State &state) {
+    drawFrame(state, false);
+}
+
+void BM_DrawSpriteBatched(benchmark::State &state) {
+    drawFrame(state, true);
+}
+
+}  // namespace
+
+BENCHMARK(BM_DrawSpriteDirect)->Name("cpp_render/draw_sprite_direct_1k");
+BENCHMARK(BM_DrawSpriteBatched)->Name("cpp_render/draw_sprite_batched_1k");
@@ -133,11 +133,15 @@ if(GoudEngine_FOUND)
     # Imported target
     # -----------------------------------------------------------------------
     if(NOT TARGET GoudEngine::GoudEngine)
+        # goud::AssetLoader runs worker threads.
+        find_package(Threads REQUIRED)
+
         add_library(GoudEngine::GoudEngine SHARED IMPORTED)
 
         set_target_properties(GoudEngine::GoudEngine PROPERTIES
             IMPORTED_LOCATION "${GoudEngine_LIBRARY}"
             INTERFACE_INCLUDE_DIRECTORIES "${GoudEngine_INCLUDE_DIRS}"
+            INTERFACE_LINK_LIBRARIES Threads::Threads
         )
 
         # On Windows the .dll is the runtime artifact; the .lib is the
@@ -0,0 +1,389 @@
+#ifndef GOUD_CPP_ASSET_LOADER_HPP
+#define GOUD_CPP_ASSET_LOADER_HPP
+
+/** @file asset_loader.hpp
+ *  @brief Background texture and font loading with per-frame upload budgets.
+ *
+ *  AssetLoader reads files and decodes images on worker threads.  Only the
+ *  final GPU upload (or font registration) runs on the thread that owns the
+ *  context, inside pumpUploads(), which stops once its time budget is spent.
+ *  goud::Context owns one lazily; see Context::loadTextureAsync().
+ */
+
+#include <goud/goud.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace goud {
+
+namespace detail {
+
+/** Shared state between an AssetFuture and the loader that fulfils it. */
+struct AssetRequest {
+    enum class Kind { Texture, Font };
+
+    Kind kind = Kind::Texture;
+    std::string path;
+
+    // Written by the worker before the request moves to the upload queue.
+    std::vector<std::uint8_t> bytes;  // RGBA8 pixels, or raw font file bytes
+    std::uint32_t width = 0;
+    std::uint32_t height = 0;
+    int decode_status = SUCCESS;
+
+    // Published by the upload thread.
+    std::atomic<std::uint64_t> handle{ UINT64_MAX };
+    std::atomic<int> status{ SUCCESS };
+    std::atomic<bool> done{ false };
+};
+
+/** Read a whole file into @p out.  Thread-safe. */
+inline int readFile(const std::string &path, std::vector<std::uint8_t> &out) noexcept {
+    std::ifstream stream(path, std::ios::binary | std::ios::ate);
+    if (!stream) {
+        return ERR_RESOURCE_NOT_FOUND;
+    }
+    std::streamoff size = stream.tellg();
+    if (size <= 0) {
+        return ERR_RESOURCE_INVALID_FORMAT;
+    }
+    try {
+        out.resize(static_cast<std::size_t>(size));
+    } catch (const std::bad_alloc &) {
+        return ERR_INTERNAL_ERROR;
+    }
+    stream.seekg(0);
+    if (!stream.read(reinterpret_cast<char *>(out.data()), size)) {
+        return ERR_RESOURCE_LOAD_FAILED;
+    }
+    return SUCCESS;
+}
+
+/** Read an image file and decode it to tightly packed RGBA8.  Thread-safe. */
+inline int decodeImageFile(const std::string &path,
+                           std::vector<std::uint8_t> &out_pixels,
+                           std::uint32_t &out_width,
+                           std::uint32_t &out_height) noexcept {
+    std::vector<std::uint8_t> file;
+    int status = readFile(path, file);
+    if (status != SUCCESS) {
+        return status;
+    }
+    status = ::goud_image_size(file.data(), file.size(), &out_width, &out_height);
+    if (status != SUCCESS) {
+        return status;
+    }
+    try {
+        out_pixels.resize(static_cast<std::size_t>(out_width) * out_height * 4u);
+    } catch (const std::bad_alloc &) {
+        return ERR_INTERNAL_ERROR;
+    }
+    return ::goud_image_decode(file.data(), file.size(), out_pixels.data(), out_pixels.size());
+}
+
+}  // namespace detail
+
+/** @brief Handle to an asset that is still loading.
+ *
+ *  Cheap to copy.  ready() turns true on the thread that calls
+ *  pumpUploads(); get() returns the invalid handle until then.
+ *
+ *  @tparam T  Asset handle type (::goud_texture or ::goud_font).
+ */
+template <typename T>
+class AssetFuture {
+public:
+    /** @brief Construct an empty future (valid() is false). */
+    AssetFuture() noexcept = default;
+
+    /** @brief Construct from shared request state. */
+    explicit AssetFuture(std::shared_ptr<detail::AssetRequest> request) noexcept
+        : request_(std::move(request)) {}
+
+    /** @brief True when the future refers to a request. */
+    bool valid() const noexcept {
+        return request_ != nullptr;
+    }
+
+    /** @brief True once the asset was uploaded or failed to load. */
+    bool ready() const noexcept {
+        return request_ == nullptr || request_->done.load(std::memory_order_acquire);
+    }
+
+    /** @brief Load status; SUCCESS until ready() and on success.
+     *  @return ERR_INTERNAL_ERROR for an empty future.
+     */
+    int status() const noexcept {
+        if (request_ == nullptr) {
+            return ERR_INTERNAL_ERROR;
+        }
+        return request_->status.load(std::memory_order_acquire);
+    }
+
+    /** @brief Loaded handle, or UINT64_MAX until ready() or on failure. */
+    T get() const noexcept {
+        if (request_ == nullptr) {
+            return static_cast<T>(UINT64_MAX);
+        }
+        return static_cast<T>(request_->handle.load(std::memory_order_acquire));
+    }
+
+private:
+    std::shared_ptr<detail::AssetRequest> request_;
+};
+
+/** @brief Worker pool that loads textures and fonts in the background.
+ *
+ *  Non-copyable and non-movable; hold it by value or through a pointer.
+ *  All methods except the destructor are noexcept.  If worker threads
+ *  cannot be started the loader falls back to reading and decoding inside
+ *  pumpUploads().  Requests still pending at destruction complete with
+ *  ERR_INVALID_STATE.
+ */
+class AssetLoader {
+public:
+    /** @brief Default number of worker threads (hardware threads - 1, 1 to 4). */
+    static unsigned defaultWorkerCount() noexcept {
+        unsigned hardware = std::thread::hardware_concurrency();
+        unsigned workers = hardware > 1 ? hardware - 1 : 1;
+        return workers > 4 ? 4 : workers;
+    }
+
+    /** @brief Create a loader for @p context.
+     *  @param context       Context that receives the uploads; it must outlive the loader.
+     *  @param worker_count  Number of worker threads (0 decodes inside pumpUploads()).
+     */
+    explicit AssetLoader(::goud_context context, unsigned worker_count = defaultWorkerCount()) noexcept
+        : context_(context) {
+        try {
+            workers_.reserve(worker_count);
+            for (unsigned i = 0; i < worker_count; ++i) {
+                workers_.emplace_back([this] { workerLoop(); });
+            }
+        } catch (...) {
+            // Keep whichever workers started; zero workers is still correct.
+        }
+    }
+
+    /** @brief Stop the workers and fail every pending request. */
+    ~AssetLoader() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        work_ready_.notify_all();
+        for (std::thread &worker : workers_) {
+            worker.join();
+        }
+        for (auto &request : decode_queue_) {
+            complete(*request, UINT64_MAX, ERR_INVALID_STATE);
+        }
+        for (auto &request : upload_queue_) {
+            complete(*request, UINT64_MAX, ERR_INVALID_STATE);
+        }
+    }
+
+    AssetLoader(const AssetLoader &) = delete;
+    AssetLoader &operator=(const AssetLoader &) = delete;
+
+    /** @brief Queue a texture load.
+     *  @param path  Null-terminated file path.
+     *  @return Future for the texture; ready with an error if queueing failed.
+     */
+    AssetFuture<::goud_texture> loadTexture(const char *path) noexcept {
+        return AssetFuture<::goud_texture>(enqueue(detail::AssetRequest::Kind::Texture, path));
+    }
+
+    /** @brief Queue a font load.
+     *  @param path  Null-terminated file path.
+     *  @return Future for the font; ready with an error if queueing failed.
+     */
+    AssetFuture<::goud_font> loadFont(const char *path) noexcept {
+        return AssetFuture<::goud_font>(enqueue(detail::AssetRequest::Kind::Font, path));
+    }
+
+    /** @brief Upload decoded assets until @p budget_us microseconds have passed.
+     *
+     *  Call once per frame from the thread that owns the context.  At least
+     *  one asset is processed per call when one is waiting, so a small
+     *  budget still makes progress.
+     *
+     *  @param budget_us  Time budget in microseconds.
+     *  @return Number of requests completed by this call.
+     */
+    std::size_t pumpUploads(std::uint64_t budget_us) noexcept {
+        const auto start = std::chrono::steady_clock::now();
+        std::size_t completed = 0;
+        for (;;) {
+            std::shared_ptr<detail::AssetRequest> request;
+            bool needs_decode = false;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!upload_queue_.empty()) {
+                    request = std::move(upload_queue_.front());
+                    upload_queue_.pop_front();
+                } else if (workers_.empty() && !decode_queue_.empty()) {
+                    request = std::move(decode_queue_.front());
+                    decode_queue_.pop_front();
+                    needs_decode = true;
+                } else {
+                    break;
+                }
+            }
+            if (needs_decode) {
+                decode(*request);
+            }
+            upload(*request);
+            ++completed;
+            pending_.fetch_sub(1, std::memory_order_acq_rel);
+
+            auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start);
+            if (static_cast<std::uint64_t>(elapsed.count()) >= budget_us) {
+                break;
+            }
+        }
+        return completed;
+    }
+
+    /** @brief Block until every queued request has completed.
+     *
+     *  Must be called from the thread that owns the context.
+     *
+     *  @return Number of requests completed by this call.
+     */
+    std::size_t finish() noexcept {
+        std::size_t completed = 0;
+        while (pending() > 0) {
+            completed += pumpUploads(UINT64_MAX);
+            std::unique_lock<std::mutex> lock(mutex_);
+            upload_ready_.wait(lock, [this] {
+                return !upload_queue_.empty() || pending() == 0 || workers_.empty();
+            });
+        }
+        return completed;
+    }
+
+    /** @brief Number of requests that have not completed yet. */
+    std::size_t pending() const noexcept {
+        return pending_.load(std::memory_order_acquire);
+    }
+
+    /** @brief Number of running worker threads. */
+    std::size_t workerCount() const noexcept {
+        return workers_.size();
+    }
+
+private:
+    std::shared_ptr<detail::AssetRequest> enqueue(detail::AssetRequest::Kind kind, const char *path) noexcept {
+        std::shared_ptr<detail::AssetRequest> request;
+        try {
+            request = std::make_shared<detail::AssetRequest>();
+        } catch (const std::bad_alloc &) {
+            return nullptr;
+        }
+        if (path == nullptr) {
+            complete(*request, UINT64_MAX, ERR_INVALID_STATE);
+            return request;
+        }
+        try {
+            request->kind = kind;
+            request->path = path;
+            std::lock_guard<std::mutex> lock(mutex_);
+            decode_queue_.push_back(request);
+            pending_.fetch_add(1, std::memory_order_acq_rel);
+        } catch (const std::bad_alloc &) {
+            complete(*request, UINT64_MAX, ERR_INTERNAL_ERROR);
+            return request;
+        }
+        work_ready_.notify_one();
+        return request;
+    }
+
+    void workerLoop() noexcept {
+        for (;;) {
+            std::shared_ptr<detail::AssetRequest> request;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                work_ready_.wait(lock, [this] { return stopping_ || !decode_queue_.empty(); });
+                if (stopping_) {
+                    return;
+                }
+                request = std::move(decode_queue_.front());
+                decode_queue_.pop_front();
+            }
+            decode(*request);
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                try {
+                    upload_queue_.push_back(request);
+                } catch (const std::bad_alloc &) {
+                    complete(*request, UINT64_MAX, ERR_INTERNAL_ERROR);
+                    pending_.fetch_sub(1, std::memory_order_acq_rel);
+                }
+            }
+            upload_ready_.notify_all();
+        }
+    }
+
+    /** Read the file and, for textures, decode it to RGBA8.  Thread-safe. */
+    static void decode(detail::AssetRequest &request) noexcept {
+        if (request.kind == detail::AssetRequest::Kind::Font) {
+            request.decode_status = detail::readFile(request.path, request.bytes);
+            return;
+        }
+        request.decode_status = detail::decodeImageFile(request.path, request.bytes, request.width, request.height);
+    }
+
+    void upload(detail::AssetRequest &request) noexcept {
+        if (request.decode_status != SUCCESS) {
+            complete(request, UINT64_MAX, request.decode_status);
+            return;
+        }
+        std::uint64_t handle = UINT64_MAX;
+        int status;
+        if (request.kind == detail::AssetRequest::Kind::Font) {
+            ::goud_font font = UINT64_MAX;
+            status = ::goud_font_load_bytes(context_, request.bytes.data(), request.bytes.size(), &font);
+            handle = font;
+        } else {
+            ::goud_texture texture = UINT64_MAX;
+            status = ::goud_texture_upload_rgba8(context_, request.bytes.data(), request.width, request.height, &texture);
+            handle = texture;
+        }
+        std::vector<std::uint8_t>().swap(request.bytes);
+        complete(request, handle, status);
+    }
+
+    static void complete(detail::AssetRequest &request, std::uint64_t handle, int status) noexcept {
+        request.handle.store(status == SUCCESS ? handle : UINT64_MAX, std::memory_order_release);
+        request.status.store(status, std::memory_order_release);
+        request.done.store(true, std::memory_order_release);
+    }
+
+    ::goud_context context_;
+    std::mutex mutex_;
+    std::condition_variable work_ready_;
+    std::condition_variable upload_ready_;
+    std::deque<std::shared_ptr<detail::AssetRequest>> decode_queue_;
+    std::deque<std::shared_ptr<detail::AssetRequest>> upload_queue_;
+    std::atomic<std::size_t> pending_{ 0 };
+    bool stopping_ = false;
+    std::vector<std::thread> workers_;
+};
+
+}  // namespace goud
+
+#endif
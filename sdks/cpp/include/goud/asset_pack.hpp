@@ -0,0 +1,213 @@
+#ifndef GOUD_CPP_ASSET_PACK_HPP
+#define GOUD_CPP_ASSET_PACK_HPP
+
+/** @file asset_pack.hpp
+ *  @brief RAII wrapper for memory-mapped asset packs.
+ *
+ *  Build a pack from an asset directory with the goud_pack tool, open it
+ *  once at startup, and load textures, fonts, audio and scenes from it by
+ *  name hash.  Opening maps the file rather than reading it, and loaders
+ *  decode straight from the mapping, so an uncompressed entry is never
+ *  copied into an intermediate buffer.  AssetPack::hash() is constexpr, so
+ *  entry names can be hashed at compile time:
+ *
+ *  @code
+ *  constexpr std::uint64_t kPlayer = goud::AssetPack::hash("sprites/player.png");
+ *  goud::AssetPack pack = goud::AssetPack::open("game.goud");
+ *  goud_texture player = GOUD_INVALID_TEXTURE;
+ *  pack.loadTexture(context, kPlayer, player);
+ *  @endcode
+ */
+
+#include <goud/goud.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace goud {
+
+/** @brief RAII wrapper for an open asset pack.
+ *
+ *  Move-only.  The pack is closed on destruction; assets already loaded
+ *  from it are unaffected.
+ */
+class AssetPack {
+public:
+    /** @brief Construct an invalid pack. */
+    AssetPack() noexcept = default;
+
+    /** @brief Close the pack. */
+    ~AssetPack() noexcept {
+        reset();
+    }
+
+    AssetPack(const AssetPack &) = delete;
+    AssetPack &operator=(const AssetPack &) = delete;
+
+    /** @brief Move-construct from another pack. */
+    AssetPack(AssetPack &&other) noexcept
+        : handle_(other.release()) {}
+
+    /** @brief Move-assign from another pack. */
+    AssetPack &operator=(AssetPack &&other) noexcept {
+        if (this != &other) {
+            reset();
+            handle_ = other.release();
+        }
+        return *this;
+    }
+
+    /** @brief Hash an entry name the way packs index it.
+     *  @param name  Path relative to the packed directory, with forward slashes.
+     *  @return The 64-bit FNV-1a hash of @p name.
+     */
+    static constexpr std::uint64_t hash(const char *name) noexcept {
+        std::uint64_t value = 0xcbf29ce484222325ULL;
+        for (; name != nullptr && *name != '\0'; ++name) {
+            value ^= static_cast<std::uint8_t>(*name);
+            value *= 0x100000001b3ULL;
+        }
+        return value;
+    }
+
+    /** @brief Memory-map the pack file at @p path.
+     *  @param path             Path to a pack built with goud_pack.
+     *  @param[out] out_status  Optional pointer to receive the status code.
+     *  @return A valid AssetPack on success.
+     */
+    static AssetPack open(const char *path, int *out_status = nullptr) noexcept {
+        AssetPack pack;
+        int status = ::goud_asset_pack_load(path, &pack.handle_);
+        if (status != SUCCESS) {
+            pack.handle_ = GOUD_INVALID_ASSET_PACK;
+        }
+        if (out_status != nullptr) {
+            *out_status = status;
+        }
+        return pack;
+    }
+
+    /** @brief Open a pack from bytes already in memory.
+     *  @param data             Pack file bytes; copied, so they may be freed afterwards.
+     *  @param len              Length of @p data in bytes.
+     *  @param[out] out_status  Optional pointer to receive the status code.
+     *  @return A valid AssetPack on success.
+     */
+    static AssetPack fromMemory(const void *data, std::size_t len, int *out_status = nullptr) noexcept {
+        AssetPack pack;
+        int status = ::goud_asset_pack_load_bytes(data, len, &pack.handle_);
+        if (status != SUCCESS) {
+            pack.handle_ = GOUD_INVALID_ASSET_PACK;
+        }
+        if (out_status != nullptr) {
+            *out_status = status;
+        }
+        return pack;
+    }
+
+    /** @brief Check whether the pack is open. */
+    bool valid() const noexcept {
+        return handle_ != GOUD_INVALID_ASSET_PACK;
+    }
+
+    /** @brief Number of entries in the pack, or -1 if it is not open. */
+    std::int64_t entryCount() const noexcept {
+        return ::goud_asset_pack_entry_count(handle_);
+    }
+
+    /** @brief Get an entry's decompressed size.
+     *  @param[out] out_size  Receives the size in bytes.
+     *  @return SUCCESS on success.
+     */
+    int size(std::uint64_t name_hash, std::uint64_t &out_size) const noexcept {
+        return ::goud_asset_pack_size(handle_, name_hash, &out_size);
+    }
+
+    /** @brief Borrow an uncompressed entry's bytes in place.
+     *
+     *  The bytes live in the pack's mapping and stay valid until the pack
+     *  is closed.  Fails for compressed entries; use copy() for those.
+     *
+     *  @return SUCCESS on success.
+     */
+    int view(std::uint64_t name_hash, const void *&out_data, std::size_t &out_len) const noexcept {
+        return ::goud_asset_pack_view(handle_, name_hash, &out_data, &out_len);
+    }
+
+    /** @brief Copy an entry's decompressed bytes into @p out_buf.
+     *  @param[out] out_len  Receives the entry length, even when @p capacity is too small.
+     *  @return SUCCESS on success.
+     */
+    int copy(std::uint64_t name_hash, void *out_buf, std::size_t capacity, std::size_t &out_len) const noexcept {
+        return ::goud_asset_pack_copy(handle_, name_hash, out_buf, capacity, &out_len);
+    }
+
+    /** @brief Load a texture from an encoded image entry.
+     *  @return SUCCESS on success.
+     */
+    int loadTexture(const Context &context, std::uint64_t name_hash, ::goud_texture &out_texture) const noexcept {
+        return ::goud_texture_load_pack(context.raw(), handle_, name_hash, &out_texture);
+    }
+
+    /** @brief Load an encoded image entry as a streamed texture.
+     *  @return SUCCESS on success.
+     */
+    int streamTexture(const Context &context, std::uint64_t name_hash, ::goud_texture &out_texture) const noexcept {
+        return ::goud_texture_stream_pack(context.raw(), handle_, name_hash, &out_texture);
+    }
+
+    /** @brief Load a TTF/OTF font entry.
+     *  @return SUCCESS on success.
+     */
+    int loadFont(const Context &context, std::uint64_t name_hash, ::goud_font &out_font) const noexcept {
+        return ::goud_font_load_pack(context.raw(), handle_, name_hash, &out_font);
+    }
+
+    /** @brief Play an encoded audio entry on the SFX channel.
+     *  @return SUCCESS on success.
+     */
+    int playAudio(const Context &context, std::uint64_t name_hash, ::goud_audio_player &out_player) const noexcept {
+        return ::goud_audio_play_pack(context.raw(), handle_, name_hash, &out_player);
+    }
+
+    /** @brief Load a JSON or packed binary scene entry under @p name.
+     *  @return SUCCESS on success.
+     */
+    int loadScene(const Context &context,
+                  std::uint64_t name_hash,
+                  const char *name,
+                  std::uint32_t &out_scene) const noexcept {
+        return ::goud_scene_load_pack(context.raw(), handle_, name_hash, name, &out_scene);
+    }
+
+    /** @brief Access the raw FFI pack handle. */
+    ::goud_asset_pack raw() const noexcept {
+        return handle_;
+    }
+
+    /** @brief Release ownership of the raw handle.
+     *  @return The underlying handle.  The pack is left invalid.
+     */
+    ::goud_asset_pack release() noexcept {
+        ::goud_asset_pack handle = handle_;
+        handle_ = GOUD_INVALID_ASSET_PACK;
+        return handle;
+    }
+
+    /** @brief Close the underlying pack and reset to invalid.
+     *  @return SUCCESS on success or if already invalid.
+     */
+    int reset() noexcept {
+        if (!valid()) {
+            return SUCCESS;
+        }
+        return ::goud_asset_pack_release(release());
+    }
+
+private:
+    ::goud_asset_pack handle_ = GOUD_INVALID_ASSET_PACK;
+};
+
+} // namespace goud
+
+#endif
@@ -0,0 +1,409 @@
+#ifndef GOUD_CPP_ATLAS_BUILDER_HPP
+#define GOUD_CPP_ATLAS_BUILDER_HPP
+
+/** @file atlas_builder.hpp
+ *  @brief Load-time packing of small images into shared atlas pages.
+ *
+ *  AtlasBuilder collects image files (or raw RGBA8 pixels), packs them
+ *  tallest-first into as few engine atlas pages as possible, and hands back
+ *  a TextureRegion per image.  Drawing those regions through
+ *  Context::drawSprite() lets dozens of small sprites share one texture, so
+ *  the sprite batch draws them without a texture change between them.
+ */
+
+#include <goud/goud.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace goud {
+
+/** @brief Packs images into atlas pages and maps each to a TextureRegion.
+ *
+ *  Usage: add() every image, call build() once, then read region().
+ *  Move-only.  The atlas pages (and their textures) are destroyed with the
+ *  builder, so it must not outlive its Context.
+ *
+ *  Images larger than the page size get a page of their own, up to the
+ *  engine limit of 8192 x 8192.
+ */
+class AtlasBuilder {
+public:
+    /** @brief Default page width and height in pixels. */
+    static constexpr std::uint32_t kDefaultPageSize = 2048;
+
+    /** @brief Largest page the engine will allocate. */
+    static constexpr std::uint32_t kMaxPageSize = 8192;
+
+    /** @brief Construct a builder with no context (build() fails). */
+    AtlasBuilder() noexcept = default;
+
+    /** @brief Construct a builder for @p context.
+     *  @param context    Context the atlas pages are created in.
+     *  @param page_size  Page width and height in pixels (clamped to kMaxPageSize).
+     */
+    explicit AtlasBuilder(const Context &context, std::uint32_t page_size = kDefaultPageSize) noexcept
+        : AtlasBuilder(context.raw(), page_size) {}
+
+    /** @brief Construct a builder for a raw context handle.
+     *  @param context    Raw context handle.
+     *  @param page_size  Page width and height in pixels (clamped to kMaxPageSize).
+     */
+    explicit AtlasBuilder(::goud_context context, std::uint32_t page_size = kDefaultPageSize) noexcept
+        : context_(context),
+          page_size_(std::min(page_size == 0 ? kDefaultPageSize : page_size, kMaxPageSize)) {}
+
+    /** @brief Destroy every atlas page. */
+    ~AtlasBuilder() noexcept {
+        reset();
+    }
+
+    AtlasBuilder(const AtlasBuilder &) = delete;
+    AtlasBuilder &operator=(const AtlasBuilder &) = delete;
+
+    /** @brief Move-construct from another builder. */
+    AtlasBuilder(AtlasBuilder &&other) noexcept
+        : images_(std::move(other.images_)),
+          pages_(std::move(other.pages_)),
+          context_(other.context_),
+          page_size_(other.page_size_),
+          built_(other.built_) {
+        other.images_.clear();
+        other.pages_.clear();
+        other.built_ = false;
+    }
+
+    /** @brief Move-assign from another builder. */
+    AtlasBuilder &operator=(AtlasBuilder &&other) noexcept {
+        if (this != &other) {
+            reset();
+            images_ = std::move(other.images_);
+            pages_ = std::move(other.pages_);
+            context_ = other.context_;
+            page_size_ = other.page_size_;
+            built_ = other.built_;
+            other.images_.clear();
+            other.pages_.clear();
+            other.built_ = false;
+        }
+        return *this;
+    }
+
+    /** @brief Queue an image file.  It is read and decoded by build().
+     *
+     *  Adding the same path twice returns the first image's ID.
+     *
+     *  @param path         Image file path.
+     *  @param[out] out_id  Optional; receives the ID passed to region().
+     *  @return SUCCESS on success.
+     *  @retval ERR_INVALID_STATE  @p path is NULL or build() already ran.
+     */
+    int add(const char *path, std::uint32_t *out_id = nullptr) noexcept {
+        if (path == nullptr || built_) {
+            return ERR_INVALID_STATE;
+        }
+        for (std::size_t i = 0; i < images_.size(); ++i) {
+            if (!images_[i].path.empty() && images_[i].path == path) {
+                if (out_id != nullptr) {
+                    *out_id = static_cast<std::uint32_t>(i);
+                }
+                return SUCCESS;
+            }
+        }
+        try {
+            Image image;
+            image.path = path;
+            images_.push_back(std::move(image));
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+        if (out_id != nullptr) {
+            *out_id = static_cast<std::uint32_t>(images_.size() - 1);
+        }
+        return SUCCESS;
+    }
+
+    /** @brief Queue tightly packed RGBA8 pixels.  The pixels are copied.
+     *  @param pixels       @p width * @p height * 4 bytes, row-major.
+     *  @param width        Width in pixels.
+     *  @param height       Height in pixels.
+     *  @param[out] out_id  Optional; receives the ID passed to region().
+     *  @return SUCCESS on success.
+     *  @retval ERR_INVALID_STATE  @p pixels is NULL, a dimension is 0, or build() already ran.
+     */
+    int addPixels(const std::uint8_t *pixels,
+                  std::uint32_t width,
+                  std::uint32_t height,
+                  std::uint32_t *out_id = nullptr) noexcept {
+        if (pixels == nullptr || width == 0 || height == 0 || built_) {
+            return ERR_INVALID_STATE;
+        }
+        try {
+            Image image;
+            image.pixels.assign(pixels, pixels + static_cast<std::size_t>(width) * height * 4u);
+            image.width = width;
+            image.height = height;
+            images_.push_back(std::move(image));
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+        if (out_id != nullptr) {
+            *out_id = static_cast<std::uint32_t>(images_.size() - 1);
+        }
+        return SUCCESS;
+    }
+
+    /** @brief Decode, pack, and upload every queued image.
+     *
+     *  Images are packed tallest first.  Each image goes on the first page
+     *  with room for it, and a new page is opened only when none has.  On
+     *  failure every page is destroyed and the queue is kept, so build()
+     *  can be retried after fixing the cause.
+     *
+     *  @param[out] out_pages  Optional; receives the number of pages created.
+     *  @return SUCCESS on success (including an empty queue).
+     *  @retval ERR_INVALID_STATE  build() already ran, or an image exceeds kMaxPageSize.
+     */
+    int build(std::uint32_t *out_pages = nullptr) noexcept {
+        if (out_pages != nullptr) {
+            *out_pages = 0;
+        }
+        if (built_) {
+            return ERR_INVALID_STATE;
+        }
+
+        int status = pack();
+        if (status != SUCCESS) {
+            (void)destroyPages();
+            return status;
+        }
+        for (Image &image : images_) {
+            std::vector<std::uint8_t>().swap(image.pixels);
+        }
+        built_ = true;
+        if (out_pages != nullptr) {
+            *out_pages = static_cast<std::uint32_t>(pages_.size());
+        }
+        return SUCCESS;
+    }
+
+    /** @brief True once build() has succeeded. */
+    bool built() const noexcept {
+        return built_;
+    }
+
+    /** @brief Number of queued images. */
+    std::size_t size() const noexcept {
+        return images_.size();
+    }
+
+    /** @brief Region of image @p id; all zero before build() or for an unknown ID. */
+    TextureRegion region(std::uint32_t id) const noexcept {
+        return built_ && id < images_.size() ? images_[id].region : TextureRegion{};
+    }
+
+    /** @brief Look up the region of an image added by path.
+     *  @param path         Path passed to add().
+     *  @param[out] out     Receives the region.
+     *  @return SUCCESS on success.
+     *  @retval ERR_INVALID_STATE  @p path is NULL, unknown, or build() has not run.
+     */
+    int find(const char *path, TextureRegion &out) const noexcept {
+        if (path == nullptr || !built_) {
+            return ERR_INVALID_STATE;
+        }
+        for (const Image &image : images_) {
+            if (!image.path.empty() && image.path == path) {
+                out = image.region;
+                return SUCCESS;
+            }
+        }
+        return ERR_INVALID_STATE;
+    }
+
+    /** @brief Number of atlas pages created by build(). */
+    std::size_t pageCount() const noexcept {
+        return pages_.size();
+    }
+
+    /** @brief Texture of page @p index, or UINT64_MAX if out of range. */
+    ::goud_texture pageTexture(std::size_t index) const noexcept {
+        return index < pages_.size() ? pages_[index].texture : static_cast<::goud_texture>(UINT64_MAX);
+    }
+
+    /** @brief Page width and height in pixels. */
+    std::uint32_t pageSize() const noexcept {
+        return page_size_;
+    }
+
+    /** @brief Destroy every page and forget every image.
+     *  @return SUCCESS, or the first error reported while destroying pages.
+     */
+    int reset() noexcept {
+        int status = destroyPages();
+        images_.clear();
+        built_ = false;
+        return status;
+    }
+
+private:
+    struct Image {
+        std::string path;                 // empty for addPixels() images
+        std::vector<std::uint8_t> pixels; // RGBA8, freed once packed
+        std::uint32_t width = 0;
+        std::uint32_t height = 0;
+        TextureRegion region;
+    };
+
+    struct Page {
+        ::goud_atlas atlas = GOUD_INVALID_ATLAS;
+        ::goud_texture texture = static_cast<::goud_texture>(UINT64_MAX);
+        std::uint32_t width_limit = 0;  // page width; oversized pages hold one image
+    };
+
+    int pack() noexcept {
+        std::vector<std::uint32_t> order;
+        std::vector<std::uint32_t> image_page;
+        try {
+            order.resize(images_.size());
+            image_page.resize(images_.size());
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+
+        for (std::size_t i = 0; i < images_.size(); ++i) {
+            Image &image = images_[i];
+            if (!image.path.empty() && image.pixels.empty()) {
+                int status = detail::decodeImageFile(image.path, image.pixels, image.width, image.height);
+                if (status != SUCCESS) {
+                    return status;
+                }
+            }
+            if (image.width > kMaxPageSize || image.height > kMaxPageSize) {
+                return ERR_INVALID_STATE;
+            }
+            order[i] = static_cast<std::uint32_t>(i);
+        }
+
+        // Tallest first (then widest) is the input order both shelf and
+        // skyline packers fill most densely.
+        std::stable_sort(order.begin(), order.end(), [this](std::uint32_t a, std::uint32_t b) {
+            const Image &lhs = images_[a];
+            const Image &rhs = images_[b];
+            if (lhs.height != rhs.height) {
+                return lhs.height > rhs.height;
+            }
+            return lhs.width > rhs.width;
+        });
+
+        for (std::uint32_t id : order) {
+            int status = place(id, image_page[id]);
+            if (status != SUCCESS) {
+                return status;
+            }
+        }
+
+        for (Page &page : pages_) {
+            int status = ::goud_atlas_upload(context_, page.atlas, &page.texture);
+            if (status != SUCCESS) {
+                return status;
+            }
+        }
+
+        for (std::size_t i = 0; i < images_.size(); ++i) {
+            const Page &page = pages_[image_page[i]];
+            ::goud_atlas_entry entry{};
+            int status = ::goud_atlas_lookup(context_, page.atlas, imageKey(static_cast<std::uint32_t>(i)).data(), &entry);
+            if (status != SUCCESS) {
+                return status;
+            }
+            TextureRegion &region = images_[i].region;
+            region.texture = page.texture;
+            region.src_x = static_cast<float>(entry.pixel_x);
+            region.src_y = static_cast<float>(entry.pixel_y);
+            region.src_w = static_cast<float>(entry.pixel_w);
+            region.src_h = static_cast<float>(entry.pixel_h);
+        }
+        return SUCCESS;
+    }
+
+    /** Pack image @p id on the first page with room, opening one if needed. */
+    int place(std::uint32_t id, std::uint32_t &out_page) noexcept {
+        const Image &image = images_[id];
+        Key key = imageKey(id);
+
+        bool oversized = image.width > page_size_ || image.height > page_size_;
+        if (!oversized) {
+            for (std::size_t p = 0; p < pages_.size(); ++p) {
+                if (pages_[p].width_limit != page_size_) {
+                    continue;
+                }
+                if (::goud_atlas_pack_pixels(context_, pages_[p].atlas, key.data(), image.pixels.data(),
+                                             image.width, image.height) == SUCCESS) {
+                    out_page = static_cast<std::uint32_t>(p);
+                    return SUCCESS;
+                }
+            }
+            ::goud_clear_last_error();
+        }
+
+        Page page;
+        std::uint32_t width = oversized ? image.width : page_size_;
+        std::uint32_t height = oversized ? image.height : page_size_;
+        page.width_limit = width;
+        int status = ::goud_atlas_init(context_, "goud_atlas_builder", width, height, &page.atlas);
+        if (status != SUCCESS) {
+            return status;
+        }
+        try {
+            pages_.push_back(page);
+        } catch (const std::bad_alloc &) {
+            (void)::goud_atlas_dispose(context_, page.atlas);
+            return ERR_INTERNAL_ERROR;
+        }
+        out_page = static_cast<std::uint32_t>(pages_.size() - 1);
+        return ::goud_atlas_pack_pixels(context_, page.atlas, key.data(), image.pixels.data(),
+                                        image.width, image.height);
+    }
+
+    int destroyPages() noexcept {
+        int status = SUCCESS;
+        for (Page &page : pages_) {
+            int destroyed = ::goud_atlas_dispose(context_, page.atlas);
+            if (status == SUCCESS) {
+                status = destroyed;
+            }
+        }
+        pages_.clear();
+        for (Image &image : images_) {
+            image.region = TextureRegion{};
+        }
+        return status;
+    }
+
+    using Key = std::array<char, 12>;
+
+    /** Engine-side key of image @p id; unique within the builder. */
+    static Key imageKey(std::uint32_t id) noexcept {
+        Key key{};
+        std::snprintf(key.data(), key.size(), "%u", static_cast<unsigned>(id));
+        return key;
+    }
+
+    std::vector<Image> images_;
+    std::vector<Page> pages_;
+    ::goud_context context_ = ::goud_context_invalid();
+    std::uint32_t page_size_ = kDefaultPageSize;
+    bool built_ = false;
+};
+
+}  // namespace goud
+
+#endif
@@ -0,0 +1,157 @@
+#ifndef GOUD_CPP_AUDIO_CLIP_HPP
+#define GOUD_CPP_AUDIO_CLIP_HPP
+
+/** @file audio_clip.hpp
+ *  @brief RAII handle for a decoded, cached audio clip.
+ *
+ *  Context::playAudio() hands the encoded file to the engine, which decodes
+ *  it again on every play.  An AudioClip is decoded once at load and every
+ *  play() starts from the decoded samples, which keeps sound effects that
+ *  fire many times a second cheap.  Decoded samples count against the
+ *  context's clip budget (Context::setAudioClipBudget()); when it is
+ *  exceeded, the least-recently-played clips drop their samples and decode
+ *  again on their next play.
+ */
+
+#include <goud/goud.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace goud {
+
+/** @brief Clip cache counters: clips, resident_clips, pcm_bytes, encoded_bytes,
+ *         budget_bytes, hits, misses, evictions.
+ */
+using AudioClipStats = ::goud_audio_clip_stats;
+
+/** @brief Audio channel a clip plays on. */
+enum class AudioChannel : std::uint8_t { Music = 0, Sfx = 1, Voice = 2, Ambience = 3, Ui = 4 };
+
+/** @brief RAII handle for a decoded audio clip.
+ *
+ *  Move-only.  The clip is unloaded on destruction, so an AudioClip must
+ *  not outlive the Context it was loaded into.  Players already started
+ *  from a clip keep playing after it is unloaded.
+ */
+class AudioClip {
+public:
+    /** @brief Construct an invalid clip. */
+    AudioClip() noexcept = default;
+
+    /** @brief Unload the clip. */
+    ~AudioClip() noexcept {
+        reset();
+    }
+
+    AudioClip(const AudioClip &) = delete;
+    AudioClip &operator=(const AudioClip &) = delete;
+
+    /** @brief Move-construct from another clip. */
+    AudioClip(AudioClip &&other) noexcept
+        : context_(other.context_),
+          clip_(other.release()) {}
+
+    /** @brief Move-assign from another clip. */
+    AudioClip &operator=(AudioClip &&other) noexcept {
+        if (this != &other) {
+            reset();
+            context_ = other.context_;
+            clip_ = other.release();
+        }
+        return *this;
+    }
+
+    /** @brief Decode @p asset_data once and keep it in @p context.
+     *  @param context          Context that owns the clip.
+     *  @param asset_data       Encoded audio (WAV/OGG/MP3/FLAC); copied, so it may be freed afterwards.
+     *  @param asset_len        Length of @p asset_data in bytes.
+     *  @param[out] out_status  Optional pointer to receive the status code.
+     *  @return A valid AudioClip on success.
+     */
+    static AudioClip load(const Context &context,
+                          const void *asset_data,
+                          std::size_t asset_len,
+                          int *out_status = nullptr) noexcept {
+        AudioClip clip;
+        int status = ::goud_audio_clip_load_memory(context.raw(), asset_data, asset_len, &clip.clip_);
+        if (status == SUCCESS) {
+            clip.context_ = context.raw();
+        }
+        if (out_status != nullptr) {
+            *out_status = status;
+        }
+        return clip;
+    }
+
+    /** @brief Check whether the clip is loaded. */
+    bool valid() const noexcept {
+        return clip_ != GOUD_INVALID_AUDIO_CLIP;
+    }
+
+    /** @brief Start a player from the clip.
+     *  @param[out] out_player  Receives the player handle.
+     *  @param volume           Individual volume (0.0 -- 1.0, clamped).
+     *  @param speed            Playback speed (0.1 -- 10.0, affects pitch).
+     *  @param looping          true to loop until stopped.
+     *  @param channel          Channel whose volume also applies.
+     *  @return SUCCESS on success.
+     */
+    int play(::goud_audio_player &out_player,
+             float volume = 1.0f,
+             float speed = 1.0f,
+             bool looping = false,
+             AudioChannel channel = AudioChannel::Sfx) const noexcept {
+        return ::goud_audio_clip_play_ex(context_, clip_, volume, speed, looping,
+                                         static_cast<std::uint8_t>(channel), &out_player);
+    }
+
+    /** @brief Start a player on the SFX channel attenuated by distance.
+     *  @param source           Source position (x, y, z).
+     *  @param listener         Listener position (x, y, z).
+     *  @param max_distance     Distance at which the source becomes silent.
+     *  @param rolloff          Attenuation curve exponent.
+     *  @param[out] out_player  Receives the player handle.
+     *  @return SUCCESS on success.
+     */
+    int playSpatial(const float (&source)[3],
+                    const float (&listener)[3],
+                    float max_distance,
+                    float rolloff,
+                    ::goud_audio_player &out_player) const noexcept {
+        return ::goud_audio_clip_play_spatial(
+            context_, clip_, source, listener, max_distance, rolloff, &out_player);
+    }
+
+    /** @brief Access the raw clip handle. */
+    ::goud_audio_clip raw() const noexcept {
+        return clip_;
+    }
+
+    /** @brief Release ownership of the clip without unloading it.
+     *  @return The clip handle.  The wrapper is left invalid.
+     */
+    ::goud_audio_clip release() noexcept {
+        ::goud_audio_clip clip = clip_;
+        clip_ = GOUD_INVALID_AUDIO_CLIP;
+        return clip;
+    }
+
+    /** @brief Unload the clip and reset to invalid.
+     *  @return SUCCESS on success, or if the clip was already invalid.
+     */
+    int reset() noexcept {
+        if (!valid()) {
+            return SUCCESS;
+        }
+        return ::goud_audio_clip_unload_checked(context_, release());
+    }
+
+private:
+    ::goud_context context_ = ::goud_context_invalid();
+    ::goud_audio_clip clip_ = GOUD_INVALID_AUDIO_CLIP;
+};
+
+}  // namespace goud
+
+#endif
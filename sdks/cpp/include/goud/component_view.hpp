@@ -0,0 +1,314 @@
+#ifndef GOUD_CPP_COMPONENT_VIEW_HPP
+#define GOUD_CPP_COMPONENT_VIEW_HPP
+
+/** @file component_view.hpp
+ *  @brief Typed, zero-copy views over ECS component storage.
+ *
+ *  ComponentView<T> fetches every (entity, component) pair of one type with a
+ *  single goud_component_get_all() call and exposes the engine-owned bytes as
+ *  `const T&` without copying them.  Per-entity get/add/remove helpers and a
+ *  batched add are provided so game code does not handle raw byte pointers.
+ */
+
+#include <goud/goud.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace goud {
+
+namespace detail {
+
+/** Unqualified-as-written name of @p T, parsed from the compiler's function
+ *  signature string. */
+template <typename T>
+constexpr std::string_view typeName() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+    std::string_view signature = __FUNCSIG__;
+    std::string_view prefix = "typeName<";
+    std::string_view suffix = ">(void) noexcept";
+#else
+    std::string_view signature = __PRETTY_FUNCTION__;
+    std::string_view prefix = "T = ";
+    std::string_view suffix = "]";
+#endif
+    std::size_t start = signature.find(prefix);
+    if (start == std::string_view::npos) {
+        return signature;
+    }
+    start += prefix.size();
+    std::size_t end = signature.find(';', start);
+    if (end == std::string_view::npos) {
+        end = signature.rfind(suffix);
+    }
+    if (end == std::string_view::npos || end < start) {
+        return signature.substr(start);
+    }
+    return signature.substr(start, end - start);
+}
+
+/** 64-bit FNV-1a hash. */
+constexpr std::uint64_t fnv1a64(std::string_view text) noexcept {
+    std::uint64_t hash = 0xcbf29ce484222325ull;
+    for (char c : text) {
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+}  // namespace detail
+
+/** @brief Name and type ID used to register @p T with the engine.
+ *
+ *  The default ID is an FNV-1a hash of the compiler's spelling of the type,
+ *  which is stable for one toolchain.  Specialize this template when the ID
+ *  must match a component registered from another SDK.
+ */
+template <typename T>
+struct ComponentTraits {
+    /** @brief Type name passed to goud_component_register(). */
+    static constexpr std::string_view name() noexcept {
+        return detail::typeName<T>();
+    }
+
+    /** @brief 64-bit type ID used for every component call. */
+    static constexpr std::uint64_t typeId() noexcept {
+        return detail::fnv1a64(name());
+    }
+};
+
+/** @brief Read-mostly, zero-copy view of every component of type @p T.
+ *
+ *  refresh() fills the view with one FFI call; operator[] and iteration then
+ *  read the engine's storage directly.  The pointers are only valid until
+ *  the next mutable World operation (spawn, despawn, add, remove, getMut, or
+ *  an engine update), after which refresh() must be called again.
+ *
+ *  The entity and pointer buffers are reused across refreshes, so a
+ *  steady-state frame does not allocate.
+ *
+ *  @tparam T  Trivially copyable component type laid out as the engine stores it.
+ */
+template <typename T>
+class ComponentView {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "ComponentView<T> requires a trivially copyable component type");
+
+public:
+    /** @brief One (entity, component) pair produced by iteration. */
+    struct Item {
+        ::goud_entity entity;  /**< Owning entity. */
+        const T &component;    /**< Component stored on the entity. */
+    };
+
+    /** @brief Forward iterator over the view. */
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Item;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Item;
+
+        Iterator(const ComponentView *view, std::size_t index) noexcept
+            : view_(view), index_(index) {}
+
+        Item operator*() const noexcept {
+            return Item{ view_->entity(index_), (*view_)[index_] };
+        }
+
+        Iterator &operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept {
+            Iterator previous = *this;
+            ++index_;
+            return previous;
+        }
+
+        bool operator==(const Iterator &other) const noexcept {
+            return index_ == other.index_;
+        }
+
+        bool operator!=(const Iterator &other) const noexcept {
+            return index_ != other.index_;
+        }
+
+    private:
+        const ComponentView *view_;
+        std::size_t index_;
+    };
+
+    /** @brief Construct an empty view bound to @p context.
+     *  @param context  Context that owns the World; it must outlive the view.
+     */
+    explicit ComponentView(const Context &context) noexcept
+        : context_(context.raw()) {}
+
+    /** @brief Construct an empty view bound to a raw context handle.
+     *  @param context  Raw context handle.
+     */
+    explicit ComponentView(::goud_context context) noexcept
+        : context_(context) {}
+
+    /** @brief Register @p T with the engine (idempotent).
+     *  @return SUCCESS on success, including when already registered.
+     */
+    static int registerType() noexcept {
+        std::string_view name = ComponentTraits<T>::name();
+        ::goud_clear_last_error();
+        if (::goud_component_register_type(typeId(),
+                                           reinterpret_cast<const std::uint8_t *>(name.data()),
+                                           name.size(),
+                                           sizeof(T),
+                                           alignof(T))) {
+            return SUCCESS;
+        }
+        return ::goud_status_last_error_or(SUCCESS);
+    }
+
+    /** @brief Type ID used for @p T. */
+    static constexpr std::uint64_t typeId() noexcept {
+        return ComponentTraits<T>::typeId();
+    }
+
+    /** @brief Re-query every entity that has a @p T component.
+     *
+     *  On failure the view is left empty.
+     *
+     *  @return SUCCESS on success (including zero matches).
+     */
+    int refresh() noexcept {
+        entities_.clear();
+        data_.clear();
+
+        ::goud_clear_last_error();
+        std::uint32_t count = ::goud_component_count(context_, typeId());
+        if (count == 0) {
+            return ::goud_status_last_error_or(SUCCESS);
+        }
+        try {
+            entities_.resize(count);
+            data_.resize(count);
+        } catch (const std::bad_alloc &) {
+            entities_.clear();
+            data_.clear();
+            return ERR_INTERNAL_ERROR;
+        }
+
+        std::uint32_t filled = ::goud_component_get_all(
+            context_, typeId(), entities_.data(), data_.data(), count);
+        entities_.resize(filled);
+        data_.resize(filled);
+        return filled == 0 ? ::goud_status_last_error_or(SUCCESS) : SUCCESS;
+    }
+
+    /** @brief Number of components in the view. */
+    std::size_t size() const noexcept {
+        return entities_.size();
+    }
+
+    /** @brief True when the view holds no components. */
+    bool empty() const noexcept {
+        return entities_.empty();
+    }
+
+    /** @brief Entity at position @p index. */
+    ::goud_entity entity(std::size_t index) const noexcept {
+        return entities_[index];
+    }
+
+    /** @brief Component at position @p index, read in place from engine storage. */
+    const T &operator[](std::size_t index) const noexcept {
+        return *reinterpret_cast<const T *>(data_[index]);
+    }
+
+    /** @brief Entities in the view, parallel to operator[]. */
+    const std::vector<::goud_entity> &entities() const noexcept {
+        return entities_;
+    }
+
+    /** @brief Iterator to the first (entity, component) pair. */
+    Iterator begin() const noexcept {
+        return Iterator(this, 0);
+    }
+
+    /** @brief Iterator past the last (entity, component) pair. */
+    Iterator end() const noexcept {
+        return Iterator(this, size());
+    }
+
+    /** @brief Read one entity's component.
+     *  @param entity  Entity to query.
+     *  @return Pointer into engine storage, or nullptr if the entity has none.
+     */
+    const T *get(::goud_entity entity) const noexcept {
+        return reinterpret_cast<const T *>(::goud_component_get(context_, entity, typeId()));
+    }
+
+    /** @brief Get a mutable pointer to one entity's component.
+     *
+     *  This is a mutable World operation: pointers held by the view are
+     *  invalidated.
+     *
+     *  @param entity  Entity to query.
+     *  @return Pointer into engine storage, or nullptr if the entity has none.
+     */
+    T *getMut(::goud_entity entity) const noexcept {
+        return reinterpret_cast<T *>(::goud_component_get_mut(context_, entity, typeId()));
+    }
+
+    /** @brief Check whether @p entity has a @p T component. */
+    bool has(::goud_entity entity) const noexcept {
+        return ::goud_component_has(context_, entity, typeId());
+    }
+
+    /** @brief Add or replace @p entity's component.
+     *  @param entity     Target entity.
+     *  @param component  Value to store.
+     *  @return SUCCESS on success.
+     */
+    int add(::goud_entity entity, const T &component) const noexcept {
+        return ::goud_component_set(context_, entity, typeId(), &component, sizeof(T));
+    }
+
+    /** @brief Add or replace the component on each of @p count entities.
+     *  @param entities    Array of @p count entities.
+     *  @param count       Number of entities.
+     *  @param components  Array of @p count components.
+     *  @param[out] out_added  Optional; receives the number of components added.
+     *  @return SUCCESS when every component was added.
+     */
+    int addBatch(const ::goud_entity *entities,
+                 std::uint32_t count,
+                 const T *components,
+                 std::uint32_t *out_added = nullptr) const noexcept {
+        return ::goud_component_set_batch(
+            context_, entities, count, typeId(), components, sizeof(T), out_added);
+    }
+
+    /** @brief Remove @p entity's component.
+     *  @param entity  Target entity.
+     *  @return SUCCESS on success.
+     */
+    int remove(::goud_entity entity) const noexcept {
+        return ::goud_component_unset(context_, entity, typeId());
+    }
+
+private:
+    ::goud_context context_;
+    std::vector<::goud_entity> entities_;
+    std::vector<const std::uint8_t *> data_;
+};
+
+}  // namespace goud
+
+#endif
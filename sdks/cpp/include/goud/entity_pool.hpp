@@ -0,0 +1,262 @@
+#ifndef GOUD_CPP_ENTITY_POOL_HPP
+#define GOUD_CPP_ENTITY_POOL_HPP
+
+/** @file entity_pool.hpp
+ *  @brief RAII wrapper for engine entity pools.
+ *
+ *  An EntityPool hands out pre-allocated slots in O(1) with no allocation,
+ *  so short-lived objects such as projectiles and particles can be recycled
+ *  instead of spawned and despawned every frame.
+ */
+
+#include <goud/goud.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace goud {
+
+/** @brief RAII wrapper for an engine entity pool.
+ *
+ *  Move-only.  The pool is destroyed on destruction.  A pool created with a
+ *  Context spawns one entity per slot up front, so acquireEntities() can
+ *  report the entity behind each slot; a pool created without one only
+ *  tracks slot indices.  The pool owns the entities it spawned: reset()
+ *  and the destructor despawn them through the owning context, whereas
+ *  release() hands them to the caller.  The context must outlive the pool.
+ */
+class EntityPool {
+public:
+    /** @brief Construct an invalid pool. */
+    EntityPool() noexcept = default;
+
+    /** @brief Destroy the pool. */
+    ~EntityPool() noexcept {
+        reset();
+    }
+
+    EntityPool(const EntityPool &) = delete;
+    EntityPool &operator=(const EntityPool &) = delete;
+
+    /** @brief Move-construct from another pool. */
+    EntityPool(EntityPool &&other) noexcept
+        : entities_(std::move(other.entities_)),
+          requested_(other.requested_),
+          context_(other.context_),
+          handle_(other.release()) {}
+
+    /** @brief Move-assign from another pool. */
+    EntityPool &operator=(EntityPool &&other) noexcept {
+        if (this != &other) {
+            reset();
+            entities_ = std::move(other.entities_);
+            requested_ = other.requested_;
+            context_ = other.context_;
+            handle_ = other.release();
+        }
+        return *this;
+    }
+
+    /** @brief Create a pool of @p capacity slots.
+     *  @param capacity         Number of slots.
+     *  @param[out] out_status  Optional pointer to receive the status code.
+     *  @return A valid EntityPool on success.
+     */
+    static EntityPool create(std::uint32_t capacity, int *out_status = nullptr) noexcept {
+        EntityPool pool;
+        int status = ::goud_entity_pool_init(capacity, &pool.handle_);
+        if (out_status != nullptr) {
+            *out_status = status;
+        }
+        return pool;
+    }
+
+    /** @brief Create a pool of @p capacity slots backed by entities in @p context.
+     *
+     *  All @p capacity entities are spawned in one FFI call, typically at
+     *  level load, so acquiring from the pool later never spawns.
+     *
+     *  @param context          Context to spawn the pooled entities in.
+     *  @param capacity         Number of slots.
+     *  @param[out] out_status  Optional pointer to receive the status code.
+     *  @return A valid EntityPool on success.
+     */
+    static EntityPool create(const Context &context, std::uint32_t capacity, int *out_status = nullptr) noexcept {
+        EntityPool pool;
+        int status = pool.initWithEntities(context, capacity);
+        if (status != SUCCESS) {
+            pool.reset();
+        }
+        if (out_status != nullptr) {
+            *out_status = status;
+        }
+        return pool;
+    }
+
+    /** @brief Check whether the pool handle is valid. */
+    bool valid() const noexcept {
+        return handle_ != GOUD_INVALID_POOL_HANDLE;
+    }
+
+    /** @brief Acquire @p count slots into a caller buffer.
+     *  @param count              Number of slots to acquire.
+     *  @param[out] out_slots     Buffer of at least @p count slot indices.
+     *  @param[out] out_acquired  Optional; receives the number of slots acquired.
+     *  @return SUCCESS when all @p count slots were acquired.
+     *  @retval ERR_INVALID_STATE  The pool ran out of slots.
+     */
+    int acquireBatch(std::uint32_t count,
+                     std::uint32_t *out_slots,
+                     std::uint32_t *out_acquired = nullptr) noexcept {
+        requested_ += count;
+        return ::goud_entity_pool_acquire_slots(handle_, count, out_slots, out_acquired);
+    }
+
+    /** @brief Acquire @p count slots and the entities behind them.
+     *
+     *  Entities are only known for pools created with a Context; otherwise
+     *  GOUD_INVALID_ENTITY_ID is written.
+     *
+     *  @param count              Number of slots to acquire.
+     *  @param[out] out_entities  Buffer of at least @p count entity handles.
+     *  @param[out] out_slots     Buffer of at least @p count slot indices.
+     *  @param[out] out_acquired  Optional; receives the number of slots acquired.
+     *  @return SUCCESS when all @p count slots were acquired.
+     *  @retval ERR_INVALID_STATE  @p out_entities is NULL, or the pool ran out of slots.
+     */
+    int acquireEntities(std::uint32_t count,
+                        std::uint64_t *out_entities,
+                        std::uint32_t *out_slots,
+                        std::uint32_t *out_acquired = nullptr) noexcept {
+        if (count > 0 && out_entities == nullptr) {
+            if (out_acquired != nullptr) {
+                *out_acquired = 0;
+            }
+            return ERR_INVALID_STATE;
+        }
+        std::uint32_t acquired = 0;
+        int status = acquireBatch(count, out_slots, &acquired);
+        for (std::uint32_t i = 0; i < acquired; ++i) {
+            out_entities[i] = entity(out_slots[i]);
+        }
+        if (out_acquired != nullptr) {
+            *out_acquired = acquired;
+        }
+        return status;
+    }
+
+    /** @brief Return @p count slots to the pool.
+     *  @param slots              Array of @p count slot indices.
+     *  @param count              Number of slots.
+     *  @param[out] out_released  Optional; receives the number of slots released.
+     *  @return SUCCESS when every slot was released.
+     *  @retval ERR_INVALID_STATE  A slot was out of range or already free.
+     */
+    int releaseBatch(const std::uint32_t *slots,
+                     std::uint32_t count,
+                     std::uint32_t *out_released = nullptr) noexcept {
+        return ::goud_entity_pool_release_slots(handle_, slots, count, out_released);
+    }
+
+    /** @brief Entity behind @p slot, or GOUD_INVALID_ENTITY_ID if unknown. */
+    std::uint64_t entity(std::uint32_t slot) const noexcept {
+        return slot < entities_.size() ? entities_[slot] : GOUD_INVALID_ENTITY_ID;
+    }
+
+    /** @brief Entities behind every slot, indexed by slot (empty without a Context). */
+    const std::vector<std::uint64_t> &entities() const noexcept {
+        return entities_;
+    }
+
+    /** @brief Read the engine's pool counters (capacity, active, high-water mark, ...).
+     *  @param[out] out_stats  Receives the counters.
+     *  @return SUCCESS on success.
+     */
+    int stats(::goud_pool_stats &out_stats) const noexcept {
+        return ::goud_entity_pool_get_stats(handle_, &out_stats);
+    }
+
+    /** @brief Peak number of slots in use at once, or 0 if the pool is invalid. */
+    std::uint32_t highWaterMark() const noexcept {
+        ::goud_pool_stats pool_stats{};
+        return stats(pool_stats) == SUCCESS ? pool_stats.high_water_mark : 0;
+    }
+
+    /** @brief Fraction of requested slots that were granted.
+     *  @return A value in [0, 1]; 1 when nothing has been requested yet.
+     */
+    double hitRate() const noexcept {
+        ::goud_pool_stats pool_stats{};
+        if (requested_ == 0 || stats(pool_stats) != SUCCESS) {
+            return 1.0;
+        }
+        return static_cast<double>(pool_stats.total_acquires) / static_cast<double>(requested_);
+    }
+
+    /** @brief Access the raw FFI pool handle. */
+    ::goud_entity_pool raw() const noexcept {
+        return handle_;
+    }
+
+    /** @brief Release ownership of the raw handle.
+     *
+     *  Pooled entities are not despawned; the caller takes ownership of them.
+     *
+     *  @return The underlying handle.  The pool is left invalid.
+     */
+    ::goud_entity_pool release() noexcept {
+        ::goud_entity_pool handle = handle_;
+        handle_ = GOUD_INVALID_POOL_HANDLE;
+        entities_.clear();
+        requested_ = 0;
+        return handle;
+    }
+
+    /** @brief Despawn the pooled entities, destroy the pool and reset to invalid.
+     *
+     *  Pooled entities that are already dead are skipped.
+     *
+     *  @return SUCCESS on success.
+     */
+    int reset() noexcept {
+        int status = SUCCESS;
+        if (!entities_.empty()) {
+            status = ::goud_entity_remove_many(context_, entities_.data(),
+                                               static_cast<std::uint32_t>(entities_.size()), nullptr);
+            entities_.clear();
+        }
+        requested_ = 0;
+        int dispose_status = ::goud_entity_pool_dispose(&handle_);
+        return status != SUCCESS ? status : dispose_status;
+    }
+
+private:
+    int initWithEntities(const Context &context, std::uint32_t capacity) noexcept {
+        try {
+            entities_.resize(capacity);
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+        std::uint32_t spawned = 0;
+        int status = context.spawnEntities(capacity, entities_.data(), &spawned);
+        if (status != SUCCESS) {
+            (void)context.destroyEntities(entities_.data(), spawned);
+            entities_.clear();
+            return status;
+        }
+        context_ = context.raw();
+        return ::goud_entity_pool_init(capacity, &handle_);
+    }
+
+    std::vector<std::uint64_t> entities_;
+    std::uint64_t requested_ = 0;
+    ::goud_context context_ = ::goud_context_invalid();
+    ::goud_entity_pool handle_ = GOUD_INVALID_POOL_HANDLE;
+};
+
+}  // namespace goud
+
+#endif
@@ -0,0 +1,235 @@
+#ifndef GOUD_CPP_EVENT_QUEUE_HPP
+#define GOUD_CPP_EVENT_QUEUE_HPP
+
+/** @file event_queue.hpp
+ *  @brief Per-frame event drains with one bulk copy per source.
+ *
+ *  Reading UI or animation events through the count/read exports costs one
+ *  FFI crossing (and, for animation, one registry lock) per event.
+ *  EventQueue<T> sizes its vector with one count call and fills it with one
+ *  bulk copy: goud_ui_events_copy(), goud_animation_events_copy(), or
+ *  goud_physics_collision_events_copy().  The vector is reused, so a queue
+ *  drained every frame stops allocating once it has grown to the busiest
+ *  frame.
+ */
+
+#include <goud/goud.h>
+#include <goud/physics_world.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string_view>
+#include <vector>
+
+namespace goud {
+
+/** @brief UI event: event_kind, node_id, previous_node_id, current_node_id. */
+using UiEvent = ::FfiUiEvent;
+
+/** @brief Fired animation event; its strings borrow the engine's event buffer. */
+using AnimationEvent = ::goud_animation_event;
+
+/** @brief Name of @p event; valid until the engine's next event update. */
+inline std::string_view eventName(const AnimationEvent &event) noexcept {
+    if (event.name_ptr == nullptr) {
+        return {};
+    }
+    return {reinterpret_cast<const char *>(event.name_ptr), event.name_len};
+}
+
+/** @brief String payload of @p event, or empty when it is not a string payload. */
+inline std::string_view payloadString(const AnimationEvent &event) noexcept {
+    if (event.payload_str_ptr == nullptr) {
+        return {};
+    }
+    return {reinterpret_cast<const char *>(event.payload_str_ptr), event.payload_str_len};
+}
+
+/** @brief Where an EventQueue<T> reads its events from.
+ *
+ *  Each specialization counts the buffered events and bulk-copies them.
+ */
+template <typename T>
+struct EventSource;
+
+/** @brief UI events captured by the latest goud_ui_manager_update() of @c manager. */
+template <>
+struct EventSource<UiEvent> {
+    const ::UiManager *manager = nullptr; /**< Manager to read, e.g. UiTree::raw(). */
+
+    /** @brief Count the buffered events. */
+    int count(std::uint32_t *out_count) const noexcept {
+        if (manager == nullptr) {
+            *out_count = 0;
+            return ERR_INVALID_STATE;
+        }
+        *out_count = ::goud_ui_event_count(manager);
+        return SUCCESS;
+    }
+
+    /** @brief Copy up to @p capacity events into @p out_events. */
+    int copy(UiEvent *out_events, std::uint32_t capacity, std::uint32_t *out_written) const noexcept {
+        *out_written = capacity == 0 ? 0 : ::goud_ui_events_copy(manager, out_events, capacity);
+        return SUCCESS;
+    }
+};
+
+/** @brief Animation events fired during the last update of @c context. */
+template <>
+struct EventSource<AnimationEvent> {
+    ::goud_context context = ::goud_context_invalid(); /**< Context to read. */
+
+    /** @brief Count the buffered events. */
+    int count(std::uint32_t *out_count) const noexcept {
+        return ::goud_animation_event_total(context, out_count);
+    }
+
+    /** @brief Copy up to @p capacity events into @p out_events. */
+    int copy(AnimationEvent *out_events,
+             std::uint32_t capacity,
+             std::uint32_t *out_written) const noexcept {
+        return ::goud_animation_copy_events(context, out_events, capacity, out_written);
+    }
+};
+
+/** @brief Collision events of the last physics step of @c context.
+ *
+ *  Only events where either body has a collider on a layer in
+ *  @c layer_mask are kept.
+ */
+template <>
+struct EventSource<CollisionEvent> {
+    ::goud_context context = ::goud_context_invalid(); /**< Context to read. */
+    std::uint32_t layer_mask = UINT32_MAX;               /**< Collision layers to keep. */
+
+    /** @brief Count the buffered events (before layer filtering). */
+    int count(std::uint32_t *out_count) const noexcept {
+        return ::goud_physics_collision_event_total(context, out_count);
+    }
+
+    /** @brief Copy up to @p capacity matching events into @p out_events. */
+    int copy(CollisionEvent *out_events,
+             std::uint32_t capacity,
+             std::uint32_t *out_written) const noexcept {
+        return ::goud_physics_copy_collision_events(
+            context, layer_mask, out_events, capacity, out_written);
+    }
+};
+
+/** @brief Reusable buffer holding one frame's events from an EventSource<T>.
+ *
+ *  @code
+ *  goud::UiEventQueue ui_events({tree.raw()});
+ *  goud::AnimationEventQueue anim_events({context.raw()});
+ *  // each frame, after the engine update:
+ *  ui_events.drain();
+ *  for (const goud::UiEvent &event : ui_events) { ... }
+ *  @endcode
+ *
+ *  drain() replaces the previous frame's events.
+ *
+ *  @tparam T  UiEvent, AnimationEvent, or CollisionEvent.
+ */
+template <typename T>
+class EventQueue {
+public:
+    /** @brief Where this queue reads from. */
+    using Source = EventSource<T>;
+
+    /** @brief Queue with a default (invalid) source. */
+    EventQueue() noexcept = default;
+
+    /** @brief Queue reading from @p source. */
+    explicit EventQueue(Source source) noexcept : source_(source) {}
+
+    /** @brief Source the next drain() reads from. */
+    const Source &source() const noexcept {
+        return source_;
+    }
+
+    /** @brief Read from @p source from the next drain() on. */
+    void setSource(Source source) noexcept {
+        source_ = source;
+    }
+
+    /** @brief Replace the held events with the source's buffered events.
+     *
+     *  Costs two FFI calls however many events are buffered.  The engine's
+     *  buffer is not consumed.
+     *
+     *  @return SUCCESS on success (including no events).
+     *  @retval ERR_INVALID_STATE   The source is invalid.
+     *  @retval ERR_INTERNAL_ERROR  The buffer could not grow; the queue is left empty.
+     */
+    int drain() noexcept {
+        std::uint32_t count = 0;
+        int status = source_.count(&count);
+        if (status != SUCCESS) {
+            events_.clear();
+            return status;
+        }
+        try {
+            events_.resize(count);
+        } catch (const std::bad_alloc &) {
+            events_.clear();
+            return ERR_INTERNAL_ERROR;
+        }
+        std::uint32_t written = 0;
+        status = source_.copy(events_.data(), count, &written);
+        events_.resize(written);
+        return status;
+    }
+
+    /** @brief Drop the held events, keeping the capacity. */
+    void clear() noexcept {
+        events_.clear();
+    }
+
+    /** @brief Events from the last drain(), in engine order. */
+    const std::vector<T> &events() const noexcept {
+        return events_;
+    }
+
+    /** @brief Number of events from the last drain(). */
+    std::size_t size() const noexcept {
+        return events_.size();
+    }
+
+    /** @brief Check whether the last drain() found no events. */
+    bool empty() const noexcept {
+        return events_.empty();
+    }
+
+    /** @brief Event @p index from the last drain(). */
+    const T &operator[](std::size_t index) const noexcept {
+        return events_[index];
+    }
+
+    /** @brief Iterator to the first event. */
+    typename std::vector<T>::const_iterator begin() const noexcept {
+        return events_.begin();
+    }
+
+    /** @brief Iterator past the last event. */
+    typename std::vector<T>::const_iterator end() const noexcept {
+        return events_.end();
+    }
+
+private:
+    Source source_{};
+    std::vector<T> events_;
+};
+
+/** @brief Queue of UI events from one UiManager. */
+using UiEventQueue = EventQueue<UiEvent>;
+
+/** @brief Queue of fired animation events from one context. */
+using AnimationEventQueue = EventQueue<AnimationEvent>;
+
+/** @brief Queue of collision events from one context's physics world. */
+using CollisionEventQueue = EventQueue<CollisionEvent>;
+
+}  // namespace goud
+
+#endif
@@ -0,0 +1,159 @@
+#ifndef GOUD_CPP_FIXED_TIMESTEP_HPP
+#define GOUD_CPP_FIXED_TIMESTEP_HPP
+
+/** @file fixed_timestep.hpp
+ *  @brief Fixed-timestep accumulator and frame pacer for game loops.
+ *
+ *  Engine::run() drives its loop with these; they are also usable on their
+ *  own by loops that need a different shape.  Neither touches the engine.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+
+namespace goud {
+
+/** @brief Accumulates frame time and hands it out in fixed steps.
+ *
+ *  advance() caps the steps run per frame.  When the cap is hit, the
+ *  whole steps that did not fit are dropped instead of carried into the
+ *  next frame, so a slow frame slows the simulation down rather than
+ *  making every later frame run the cap (the "spiral of death").
+ */
+class FixedTimestep {
+public:
+    /** @brief Construct with a step size and a per-frame step cap.
+     *  @param dt         Step size in seconds; non-positive values select 1/60.
+     *  @param max_steps  Most steps advance() returns; 0 is treated as 1.
+     */
+    explicit FixedTimestep(float dt = 1.0f / 60.0f, std::uint32_t max_steps = 8) noexcept
+        : dt_(dt > 0.0f ? dt : 1.0f / 60.0f),
+          max_steps_(max_steps > 0 ? max_steps : 1) {}
+
+    /** @brief Add @p frame_seconds of elapsed time.
+     *  @param frame_seconds  Time since the previous call; negative or
+     *                        non-finite values add nothing.
+     *  @return Number of fixed steps to run this frame.
+     */
+    std::uint32_t advance(double frame_seconds) noexcept {
+        if (std::isfinite(frame_seconds) && frame_seconds > 0.0) {
+            accumulator_ += frame_seconds;
+        }
+        std::uint32_t steps = 0;
+        while (accumulator_ >= dt_ && steps < max_steps_) {
+            accumulator_ -= dt_;
+            ++steps;
+        }
+        clamped_ = accumulator_ >= dt_;
+        if (clamped_) {
+            accumulator_ = std::fmod(accumulator_, static_cast<double>(dt_));
+        }
+        return steps;
+    }
+
+    /** @brief Fraction of a step left in the accumulator, in [0, 1).
+     *
+     *  Render state interpolated this far from the previous step to the
+     *  latest one matches the wall clock.
+     */
+    float alpha() const noexcept {
+        return static_cast<float>(accumulator_ / dt_);
+    }
+
+    /** @brief Step size in seconds. */
+    float dt() const noexcept {
+        return dt_;
+    }
+
+    /** @brief Per-frame step cap. */
+    std::uint32_t maxSteps() const noexcept {
+        return max_steps_;
+    }
+
+    /** @brief Whether the last advance() hit the cap and dropped time. */
+    bool clamped() const noexcept {
+        return clamped_;
+    }
+
+    /** @brief Discard accumulated time, e.g. after a loading screen. */
+    void reset() noexcept {
+        accumulator_ = 0.0;
+        clamped_ = false;
+    }
+
+private:
+    float dt_;
+    std::uint32_t max_steps_;
+    double accumulator_ = 0.0;
+    bool clamped_ = false;
+};
+
+/** @brief Holds a loop to a target frame rate.
+ *
+ *  wait() sleeps until shortly before the next frame deadline and spins
+ *  the rest of the way, which keeps frame-to-frame jitter well below the
+ *  OS sleep granularity.  A larger spin margin costs CPU but absorbs
+ *  coarser sleeps; a zero margin only sleeps.  When a frame overruns by
+ *  more than a whole period the schedule restarts from now instead of
+ *  rushing to catch up.
+ */
+class FramePacer {
+public:
+    /** @brief Clock used for deadlines. */
+    using Clock = std::chrono::steady_clock;
+
+    /** @brief Construct a pacer.
+     *  @param target_fps   Frames per second; 0 disables pacing.
+     *  @param spin_margin  Time before each deadline spent spinning instead of sleeping.
+     */
+    explicit FramePacer(std::uint32_t target_fps = 0,
+                        std::chrono::microseconds spin_margin = std::chrono::microseconds(1000)) noexcept
+        : spin_margin_(spin_margin) {
+        setTargetFps(target_fps);
+    }
+
+    /** @brief Change the target frame rate; 0 disables pacing. */
+    void setTargetFps(std::uint32_t target_fps) noexcept {
+        period_ = target_fps > 0 ? Clock::duration(std::chrono::seconds(1)) / target_fps
+                                 : Clock::duration::zero();
+        deadline_ = Clock::time_point();
+    }
+
+    /** @brief Time between frames; zero when pacing is disabled. */
+    Clock::duration period() const noexcept {
+        return period_;
+    }
+
+    /** @brief Block until the next frame deadline. */
+    void wait() noexcept {
+        if (period_ == Clock::duration::zero()) {
+            return;
+        }
+        Clock::time_point now = Clock::now();
+        if (deadline_ == Clock::time_point()) {
+            deadline_ = now;
+        }
+        deadline_ += period_;
+        if (deadline_ + period_ < now) {
+            deadline_ = now;
+            return;
+        }
+        if (deadline_ - now > spin_margin_) {
+            std::this_thread::sleep_until(deadline_ - spin_margin_);
+        }
+        while (Clock::now() < deadline_) {
+            std::this_thread::yield();
+        }
+    }
+
+private:
+    Clock::duration period_ = Clock::duration::zero();
+    Clock::duration spin_margin_;
+    Clock::time_point deadline_;
+};
+
+}  // namespace goud
+
+#endif
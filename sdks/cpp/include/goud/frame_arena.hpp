@@ -0,0 +1,217 @@
+#ifndef GOUD_CPP_FRAME_ARENA_HPP
+#define GOUD_CPP_FRAME_ARENA_HPP
+
+/** @file frame_arena.hpp
+ *  @brief Per-frame bump allocation for C++ game code.
+ *
+ *  FrameArena hands out memory from the engine's process-wide frame arena
+ *  and frees all of it at once on reset().  frame_allocator<T> plugs it into
+ *  standard containers, so a frame's temporary vectors cost a pointer bump
+ *  per allocation and nothing to free.
+ */
+
+#include <goud/goud.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <vector>
+
+namespace goud {
+
+/** @brief Accessor for the engine's frame arena.
+ *
+ *  Each thread carves its allocations out of kChunkSize chunks taken from
+ *  the engine arena, so most allocations never cross the FFI boundary.
+ *  Requests larger than a quarter chunk are taken from the engine directly.
+ *
+ *  Memory is valid until the next reset().  Call reset() once per frame,
+ *  after the last frame-scoped container is gone and while no other thread
+ *  is allocating from the arena.
+ */
+class FrameArena {
+public:
+    /** @brief Bytes fetched from the engine per chunk. */
+    static constexpr std::size_t kChunkSize = 64 * 1024;
+
+    /** @brief The process-wide arena. */
+    static FrameArena &instance() noexcept {
+        static FrameArena arena;
+        return arena;
+    }
+
+    FrameArena(const FrameArena &) = delete;
+    FrameArena &operator=(const FrameArena &) = delete;
+
+    /** @brief Allocate @p size bytes aligned to @p align.
+     *  @param size   Number of bytes.
+     *  @param align  Alignment; a power of two.
+     *  @return Pointer valid until reset(), or nullptr on failure.
+     */
+    void *allocate(std::size_t size, std::size_t align = alignof(std::max_align_t)) noexcept {
+        if (align == 0 || (align & (align - 1)) != 0) {
+            return nullptr;
+        }
+        if (size == 0) {
+            size = 1;
+        }
+
+        Cursor &cursor = threadCursor();
+        std::uint64_t generation = generation_.load(std::memory_order_acquire);
+        if (cursor.generation != generation) {
+            cursor = Cursor{ 0, 0, generation };
+        }
+
+        void *ptr = bump(cursor, size, align);
+        if (ptr == nullptr) {
+            if (size > kChunkSize / 4 || align > kChunkSize / 4) {
+                ptr = fetch(size, align);
+            } else if (refill(cursor)) {
+                ptr = bump(cursor, size, align);
+            }
+        }
+        if (ptr != nullptr) {
+            used_.fetch_add(size, std::memory_order_relaxed);
+        }
+        return ptr;
+    }
+
+    /** @brief Free every allocation made since the last reset.
+     *  @return SUCCESS on success.
+     */
+    int reset() noexcept {
+        generation_.fetch_add(1, std::memory_order_acq_rel);
+        used_.store(0, std::memory_order_relaxed);
+        return ::goud_frame_arena_clear();
+    }
+
+    /** @brief Read the engine arena's counters.
+     *
+     *  bytes_allocated includes whole chunks, so it runs ahead of bytesUsed().
+     *
+     *  @param[out] out_stats  Receives bytes allocated, capacity, and reset count.
+     *  @return SUCCESS on success.
+     */
+    int stats(::goud_arena_stats &out_stats) const noexcept {
+        return ::goud_frame_arena_get_stats(&out_stats);
+    }
+
+    /** @brief Bytes the engine arena has allocated this frame, or 0 on error. */
+    std::uint64_t bytesAllocated() const noexcept {
+        ::goud_arena_stats arena_stats{};
+        return stats(arena_stats) == SUCCESS ? arena_stats.bytes_allocated : 0;
+    }
+
+    /** @brief Capacity of the engine arena's backing storage, or 0 on error. */
+    std::uint64_t bytesCapacity() const noexcept {
+        ::goud_arena_stats arena_stats{};
+        return stats(arena_stats) == SUCCESS ? arena_stats.bytes_capacity : 0;
+    }
+
+    /** @brief Bytes requested through allocate() since the last reset. */
+    std::uint64_t bytesUsed() const noexcept {
+        return used_.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Cursor {
+        std::uintptr_t next;
+        std::uintptr_t end;
+        std::uint64_t generation;
+    };
+
+    FrameArena() noexcept = default;
+
+    static Cursor &threadCursor() noexcept {
+        thread_local Cursor cursor{ 0, 0, 0 };
+        return cursor;
+    }
+
+    static void *bump(Cursor &cursor, std::size_t size, std::size_t align) noexcept {
+        if (cursor.next == 0) {
+            return nullptr;
+        }
+        std::uintptr_t start = (cursor.next + (align - 1)) & ~static_cast<std::uintptr_t>(align - 1);
+        if (start < cursor.next || start > cursor.end || cursor.end - start < size) {
+            return nullptr;
+        }
+        cursor.next = start + size;
+        return reinterpret_cast<void *>(start);
+    }
+
+    static bool refill(Cursor &cursor) noexcept {
+        void *chunk = fetch(kChunkSize, alignof(std::max_align_t));
+        if (chunk == nullptr) {
+            return false;
+        }
+        cursor.next = reinterpret_cast<std::uintptr_t>(chunk);
+        cursor.end = cursor.next + kChunkSize;
+        return true;
+    }
+
+    static void *fetch(std::size_t size, std::size_t align) noexcept {
+        void *ptr = nullptr;
+        return ::goud_frame_arena_allocate(size, align, &ptr) == SUCCESS ? ptr : nullptr;
+    }
+
+    // Starts at 1 so a fresh thread cursor (generation 0) is always stale.
+    std::atomic<std::uint64_t> generation_{ 1 };
+    std::atomic<std::uint64_t> used_{ 0 };
+};
+
+/** @brief STL allocator that takes memory from FrameArena.
+ *
+ *  deallocate() is a no-op; memory comes back in bulk on
+ *  FrameArena::reset().  A container using it must be destroyed (or
+ *  cleared and shrunk) before that reset.  Reserve up front where possible:
+ *  each reallocation leaves the old buffer in the arena until the reset.
+ *
+ *  @tparam T  Element type.
+ */
+template <typename T>
+class frame_allocator {
+public:
+    using value_type = T;
+
+    frame_allocator() noexcept = default;
+
+    template <typename U>
+    frame_allocator(const frame_allocator<U> &) noexcept {}
+
+    /** @brief Allocate room for @p count elements.
+     *  @throws std::bad_alloc if the arena cannot satisfy the request.
+     */
+    T *allocate(std::size_t count) {
+        if (count > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        void *ptr = FrameArena::instance().allocate(count * sizeof(T), alignof(T));
+        if (ptr == nullptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T *>(ptr);
+    }
+
+    /** @brief No-op; the memory is released by FrameArena::reset(). */
+    void deallocate(T *, std::size_t) noexcept {}
+
+    template <typename U>
+    bool operator==(const frame_allocator<U> &) const noexcept {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const frame_allocator<U> &) const noexcept {
+        return false;
+    }
+};
+
+/** @brief std::vector whose storage comes from FrameArena. */
+template <typename T>
+using frame_vector = std::vector<T, frame_allocator<T>>;
+
+}  // namespace goud
+
+#endif
@@ -9,7 +9,7 @@
  *
  *  Provides move-only wrappers around the C SDK handles.
  *  Most methods are noexcept and return integer status codes (0 = success).
- *  Methods that allocate (Error::last, createUnique, createShared) may throw.
+ *  Methods that allocate (createUnique, createShared) may throw.
  */
 
 #include <goud/goud.h>
@@ -18,6 +18,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 
 namespace goud {
@@ -192,12 +193,14 @@ enum class PhysicsBackend2D : std::uint32_t {
 enum class RenderBackendKind : std::uint32_t {
     Wgpu = 0,
     OpenGlLegacy = 1,
+    Null = 3,
 };
 
 /** @brief Native window backend selection */
 enum class WindowBackendKind : std::uint32_t {
     Winit = 0,
     GlfwLegacy = 1,
+    Headless = 5,
 };
 
 /** @brief Easing function for tweens */
@@ -261,64 +264,95 @@ enum class RpcDirection : std::int32_t {
  *
  *  Retrieve the most recent error with Error::last().  An Error is falsy
  *  when no error has occurred (code == SUCCESS).
+ *
+ *  Only the code and recovery class are captured up front.  The message,
+ *  subsystem, and operation are copied into fixed inline buffers the first
+ *  time one of them is read, so checking an Error never allocates.
  */
 class Error {
 public:
     /** @brief Construct an empty (no-error) instance. */
-    Error() noexcept = default;
+    Error() noexcept
+        : Error(SUCCESS) {}
 
     /** @brief Capture the last error from the engine thread-local state.
-     *  @return An Error populated with code, message, subsystem, and operation.
+     *  @return An Error holding the current error code and recovery class.
+     */
+    static Error last() noexcept {
+        return Error(::goud_last_error_code());
+    }
+
+    /** @brief Read only the last error code: a single goud_last_error_code() call.
+     *  @return The current error code (SUCCESS when no error is set).
      */
-    static Error last() {
-        ::goud_error_info info;
-        ::goud_get_last_error(&info);
-        return Error(info);
+    static ::GoudErrorCode lastCode() noexcept {
+        return ::goud_last_error_code();
     }
 
     /** @brief True when an error is present (code != SUCCESS). */
     explicit operator bool() const noexcept {
-        return code_ != SUCCESS;
+        return info_.code != SUCCESS;
     }
 
     /** @brief Numeric error code. */
     ::GoudErrorCode code() const noexcept {
-        return code_;
+        return info_.code;
     }
 
     /** @brief Recovery class hint (0 = unrecoverable). */
     int recoveryClass() const noexcept {
-        return recovery_class_;
+        return info_.recovery_class;
     }
 
-    /** @brief Human-readable error description. */
-    const std::string &message() const noexcept {
-        return message_;
+    /** @brief Human-readable error description.
+     *
+     *  The text is fetched on first access, so read it on the thread that
+     *  called last() before that thread makes another engine call.  It is
+     *  empty if the thread's error has changed in between.  The view is
+     *  null-terminated and valid for the lifetime of this Error.
+     */
+    std::string_view message() const noexcept {
+        fetchText();
+        return info_.message;
     }
 
-    /** @brief Engine subsystem that raised the error. */
-    const std::string &subsystem() const noexcept {
-        return subsystem_;
+    /** @brief Engine subsystem that raised the error (fetched like message()). */
+    std::string_view subsystem() const noexcept {
+        fetchText();
+        return info_.subsystem;
     }
 
-    /** @brief Operation that failed. */
-    const std::string &operation() const noexcept {
-        return operation_;
+    /** @brief Operation that failed (fetched like message()). */
+    std::string_view operation() const noexcept {
+        fetchText();
+        return info_.operation;
     }
 
 private:
-    explicit Error(const ::goud_error_info &info)
-        : code_(info.code),
-          recovery_class_(info.recovery_class),
-          message_(info.message),
-          subsystem_(info.subsystem),
-          operation_(info.operation) {}
-
-    ::GoudErrorCode code_ = SUCCESS;
-    int recovery_class_ = 0;
-    std::string message_;
-    std::string subsystem_;
-    std::string operation_;
+    explicit Error(::GoudErrorCode code) noexcept {
+        info_.code = code;
+        info_.recovery_class = code == SUCCESS ? 0 : ::goud_error_recovery_class(code);
+        info_.message[0] = '\0';
+        info_.subsystem[0] = '\0';
+        info_.operation[0] = '\0';
+    }
+
+    void fetchText() const noexcept {
+        if (fetched_) {
+            return;
+        }
+        fetched_ = true;
+        if (info_.code == SUCCESS || ::goud_last_error_code() != info_.code) {
+            return;
+        }
+        (void)::goud_last_error_message(reinterpret_cast<std::uint8_t *>(info_.message), sizeof(info_.message));
+        (void)::goud_last_error_subsystem(reinterpret_cast<std::uint8_t *>(info_.subsystem), sizeof(info_.subsystem));
+        (void)::goud_last_error_operation(reinterpret_cast<std::uint8_t *>(info_.operation), sizeof(info_.operation));
+    }
+
+    // Text bytes past each terminator are left uninitialized until fetched.
+    mutable ::goud_error_info info_;
+    mutable bool fetched_ = false;
 };
 
 /** @brief RAII wrapper for an engine configuration handle.
@@ -6,16 +6,28 @@
  *
  *  Provides move-only wrappers around the C SDK handles.
  *  Most methods are noexcept and return integer status codes (0 = success).
- *  Methods that allocate (Error::last, createUnique, createShared) may throw.
+ *  Methods that allocate (createUnique, createShared) may throw.
  */
 
 #include <goud/goud.h>
-
+#include <goud/asset_loader.hpp>
+#include <goud/fixed_timestep.hpp>
+#include <goud/input_snapshot.hpp>
+#include <goud/particles.hpp>
+#include <goud/sprite_batch.hpp>
+#include <goud/static_layer.hpp>
+#include <goud/text_batch.hpp>
+#include <goud/tilemap.hpp>
+
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
-#include <string>
+#include <new>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 namespace goud {
 
@@ -23,64 +35,95 @@ namespace goud {
  *
  *  Retrieve the most recent error with Error::last().  An Error is falsy
  *  when no error has occurred (code == SUCCESS).
+ *
+ *  Only the code and recovery class are captured up front.  The message,
+ *  subsystem, and operation are copied into fixed inline buffers the first
+ *  time one of them is read, so checking an Error never allocates.
  */
 class Error {
 public:
     /** @brief Construct an empty (no-error) instance. */
-    Error() noexcept = default;
+    Error() noexcept
+        : Error(SUCCESS) {}
 
     /** @brief Capture the last error from the engine thread-local state.
-     *  @return An Error populated with code, message, subsystem, and operation.
+     *  @return An Error holding the current error code and recovery class.
+     */
+    static Error last() noexcept {
+        return Error(::goud_last_error_code());
+    }
+
+    /** @brief Read only the last error code: a single goud_last_error_code() call.
+     *  @return The current error code (SUCCESS when no error is set).
      */
-    static Error last() {
-        ::goud_error_info info;
-        ::goud_get_last_error(&info);
-        return Error(info);
+    static ::GoudErrorCode lastCode() noexcept {
+        return ::goud_last_error_code();
     }
 
     /** @brief True when an error is present (code != SUCCESS). */
     explicit operator bool() const noexcept {
-        return code_ != SUCCESS;
+        return info_.code != SUCCESS;
     }
 
     /** @brief Numeric error code. */
     ::GoudErrorCode code() const noexcept {
-        return code_;
+        return info_.code;
     }
 
     /** @brief Recovery class hint (0 = unrecoverable). */
     int recoveryClass() const noexcept {
-        return recovery_class_;
+        return info_.recovery_class;
     }
 
-    /** @brief Human-readable error description. */
-    const std::string &message() const noexcept {
-        return message_;
+    /** @brief Human-readable error description.
+     *
+     *  The text is fetched on first access, so read it on the thread that
+     *  called last() before that thread makes another engine call.  It is
+     *  empty if the thread's error has changed in between.  The view is
+     *  null-terminated and valid for the lifetime of this Error.
+     */
+    std::string_view message() const noexcept {
+        fetchText();
+        return info_.message;
     }
 
-    /** @brief Engine subsystem that raised the error. */
-    const std::string &subsystem() const noexcept {
-        return subsystem_;
+    /** @brief Engine subsystem that raised the error (fetched like message()). */
+    std::string_view subsystem() const noexcept {
+        fetchText();
+        return info_.subsystem;
     }
 
-    /** @brief Operation that failed. */
-    const std::string &operation() const noexcept {
-        return operation_;
+    /** @brief Operation that failed (fetched like message()). */
+    std::string_view operation() const noexcept {
+        fetchText();
+        return info_.operation;
     }
 
 private:
-    explicit Error(const ::goud_error_info &info)
-        : code_(info.code),
-          recovery_class_(info.recovery_class),
-          message_(info.message),
-          subsystem_(info.subsystem),
-          operation_(info.operation) {}
-
-    ::GoudErrorCode code_ = SUCCESS;
-    int recovery_class_ = 0;
-    std::string message_;
-    std::string subsystem_;
-    std::string operation_;
+    explicit Error(::GoudErrorCode code) noexcept {
+        info_.code = code;
+        info_.recovery_class = code == SUCCESS ? 0 : ::goud_error_recovery_class(code);
+        info_.message[0] = '\0';
+        info_.subsystem[0] = '\0';
+        info_.operation[0] = '\0';
+    }
+
+    void fetchText() const noexcept {
+        if (fetched_) {
+            return;
+        }
+        fetched_ = true;
+        if (info_.code == SUCCESS || ::goud_last_error_code() != info_.code) {
+            return;
+        }
+        (void)::goud_last_error_message(reinterpret_cast<std::uint8_t *>(info_.message), sizeof(info_.message));
+        (void)::goud_last_error_subsystem(reinterpret_cast<std::uint8_t *>(info_.subsystem), sizeof(info_.subsystem));
+        (void)::goud_last_error_operation(reinterpret_cast<std::uint8_t *>(info_.operation), sizeof(info_.operation));
+    }
+
+    // Text bytes past each terminator are left uninitialized until fetched.
+    mutable ::goud_error_info info_;
+    mutable bool fetched_ = false;
 };
 
 /** @brief RAII wrapper for an engine configuration handle.
@@ -206,6 +249,17 @@ public:
         return ::goud_engine_config_set_window_backend_value(handle_, backend);
     }
 
+    /** @brief Select the headless runtime: no window, no GPU, audio to a null sink.
+     *
+     *  Engine::create() then succeeds on machines with no display, so servers
+     *  and benchmarks run the real frame loop.
+     *
+     *  @return SUCCESS on success.
+     */
+    int setHeadless() noexcept {
+        return ::goud_engine_config_set_headless(handle_);
+    }
+
     /** @brief Access the raw FFI config handle.
      *  @return The underlying handle (may be NULL).
      */
@@ -237,6 +291,14 @@ private:
  *
  *  Move-only.  Provides methods for ECS, assets, rendering, input, and
  *  window management.  The context is destroyed on destruction.
+ *
+ *  drawSprite() records into an owned SpriteBatch that is flushed in one
+ *  FFI call by endFrame(), or earlier by any immediate-mode draw or clear so
+ *  that draw order is preserved.  drawText() records into an owned
+ *  TextBatch that is flushed at the same points, after the sprites.
+ *
+ *  loadTextureAsync() and loadFontAsync() use an AssetLoader created on
+ *  first use; pumpAssetUploads() finishes their uploads on this thread.
  */
 class Context {
 public:
@@ -260,12 +322,20 @@ public:
 
     /** @brief Move-construct from another context. */
     Context(Context &&other) noexcept
-        : handle_(other.release()) {}
+        : assets_(std::move(other.assets_)),
+          sprites_(std::move(other.sprites_)),
+          text_(std::move(other.text_)),
+          batching_(other.batching_),
+          handle_(other.release()) {}
 
     /** @brief Move-assign from another context. */
     Context &operator=(Context &&other) noexcept {
         if (this != &other) {
             reset();
+            assets_ = std::move(other.assets_);
+            sprites_ = std::move(other.sprites_);
+            text_ = std::move(other.text_);
+            batching_ = other.batching_;
             handle_ = other.release();
         }
         return *this;
@@ -315,6 +385,9 @@ public:
      *  @return SUCCESS on success.
      */
     int reset() noexcept {
+        assets_.reset();
+        sprites_.clear();
+        text_.clear();
         return ::goud_context_dispose(&handle_);
     }
 
@@ -351,6 +424,110 @@ public:
         return ::goud_entity_alive(handle_, entity);
     }
 
+    /** @brief Spawn @p count empty entities in one FFI call.
+     *  @param count              Number of entities to spawn.
+     *  @param[out] out_entities  Caller buffer holding at least @p count handles.
+     *  @param[out] out_spawned   Optional; receives the number actually spawned.
+     *  @return SUCCESS when every entity was spawned.
+     */
+    int spawnEntities(std::uint32_t count,
+                      std::uint64_t *out_entities,
+                      std::uint32_t *out_spawned = nullptr) const noexcept {
+        return ::goud_entity_spawn_many(handle_, count, out_entities, out_spawned);
+    }
+
+    /** @brief Spawn @p count empty entities, replacing the contents of @p out_entities.
+     *
+     *  The vector keeps its capacity, so reusing one across frames does not
+     *  allocate.  On partial failure it holds only the entities spawned.
+     *
+     *  @param count              Number of entities to spawn.
+     *  @param[out] out_entities  Receives the new entity handles.
+     *  @return SUCCESS when every entity was spawned.
+     */
+    int spawnEntities(std::uint32_t count, std::vector<std::uint64_t> &out_entities) const noexcept {
+        try {
+            out_entities.resize(count);
+        } catch (const std::bad_alloc &) {
+            out_entities.clear();
+            return ERR_INTERNAL_ERROR;
+        }
+        std::uint32_t spawned = 0;
+        int status = spawnEntities(count, out_entities.data(), &spawned);
+        out_entities.resize(spawned);
+        return status;
+    }
+
+    /** @brief Clone the hierarchy rooted at @p prefab @p count times in one FFI call.
+     *  @param prefab             Root entity of the template hierarchy.
+     *  @param count              Number of instances to create.
+     *  @param[out] out_entities  Caller buffer holding at least @p count instance roots.
+     *  @param[out] out_spawned   Optional; receives the number of instances created.
+     *  @return SUCCESS when every instance was created.
+     */
+    int instantiate(std::uint64_t prefab,
+                    std::uint32_t count,
+                    std::uint64_t *out_entities,
+                    std::uint32_t *out_spawned = nullptr) const noexcept {
+        return ::goud_entity_instantiate_many(handle_, prefab, count, out_entities, out_spawned);
+    }
+
+    /** @brief Destroy @p count entities in one FFI call.
+     *
+     *  Entities that are already dead are skipped.
+     *
+     *  @param entities            Array of @p count entity handles.
+     *  @param count               Number of entities.
+     *  @param[out] out_destroyed  Optional; receives the number actually destroyed.
+     *  @return SUCCESS on success.
+     */
+    int destroyEntities(const std::uint64_t *entities,
+                        std::uint32_t count,
+                        std::uint32_t *out_destroyed = nullptr) const noexcept {
+        return ::goud_entity_remove_many(handle_, entities, count, out_destroyed);
+    }
+
+    /** @brief Destroy every entity in @p entities in one FFI call.
+     *  @param entities            Entity handles.
+     *  @param[out] out_destroyed  Optional; receives the number actually destroyed.
+     *  @return SUCCESS on success.
+     */
+    int destroyEntities(const std::vector<std::uint64_t> &entities,
+                        std::uint32_t *out_destroyed = nullptr) const noexcept {
+        if (entities.size() > kMaxBatch) {
+            return ERR_INVALID_STATE;
+        }
+        return destroyEntities(entities.data(), static_cast<std::uint32_t>(entities.size()), out_destroyed);
+    }
+
+    /** @brief Check whether each of @p count entities is alive in one FFI call.
+     *  @param entities        Array of @p count entity handles.
+     *  @param count           Number of entities.
+     *  @param[out] out_alive  Receives one byte per entity: 1 if alive, else 0.
+     *  @return SUCCESS on success.
+     */
+    int aliveMask(const std::uint64_t *entities, std::uint32_t count, std::uint8_t *out_alive) const noexcept {
+        return ::goud_entity_alive_many(handle_, entities, count, out_alive);
+    }
+
+    /** @brief Check whether each entity in @p entities is alive.
+     *  @param entities        Entity handles.
+     *  @param[out] out_alive  Resized to match @p entities; 1 if alive, else 0.
+     *  @return SUCCESS on success.
+     */
+    int aliveMask(const std::vector<std::uint64_t> &entities, std::vector<std::uint8_t> &out_alive) const noexcept {
+        if (entities.size() > kMaxBatch) {
+            return ERR_INVALID_STATE;
+        }
+        try {
+            out_alive.resize(entities.size());
+        } catch (const std::bad_alloc &) {
+            out_alive.clear();
+            return ERR_INTERNAL_ERROR;
+        }
+        return aliveMask(entities.data(), static_cast<std::uint32_t>(entities.size()), out_alive.data());
+    }
+
     /** @brief Load a texture from a file path.
      *  @param path              Null-terminated file path.
      *  @param[out] out_texture  Receives the texture handle.
@@ -360,6 +537,79 @@ public:
         return ::goud_texture_load_path(handle_, path, &out_texture);
     }
 
+    /** @brief Load a texture that streams its resolution on demand.
+     *
+     *  Only a small base tier is uploaded now; finer tiers follow once
+     *  sprites draw the texture larger, within the streaming budget.
+     *
+     *  @param path              Null-terminated file path.
+     *  @param[out] out_texture  Receives the texture handle.
+     *  @return SUCCESS on success.
+     */
+    int streamTexture(const char *path, ::goud_texture &out_texture) const noexcept {
+        return ::goud_texture_stream_path(handle_, path, &out_texture);
+    }
+
+    /** @brief Load an encoded image from memory as a streamed texture.
+     *  @param data              Encoded image bytes; copied.
+     *  @param len               Length of @p data in bytes.
+     *  @param[out] out_texture  Receives the texture handle.
+     *  @return SUCCESS on success.
+     */
+    int streamTexture(const void *data, std::size_t len, ::goud_texture &out_texture) const noexcept {
+        return ::goud_texture_stream_bytes(handle_, data, len, &out_texture);
+    }
+
+    /** @brief Queue a texture load on the background AssetLoader.
+     *
+     *  The file is read and decoded on a worker thread; the GPU upload
+     *  happens in pumpAssetUploads().
+     *
+     *  @param path  Null-terminated file path.
+     *  @return Future that becomes ready after the upload.
+     */
+    AssetFuture<::goud_texture> loadTextureAsync(const char *path) const noexcept {
+        AssetLoader *loader = assetLoader();
+        return loader != nullptr ? loader->loadTexture(path) : AssetFuture<::goud_texture>();
+    }
+
+    /** @brief Queue a font load on the background AssetLoader.
+     *  @param path  Null-terminated file path.
+     *  @return Future that becomes ready once the font is registered.
+     */
+    AssetFuture<::goud_font> loadFontAsync(const char *path) const noexcept {
+        AssetLoader *loader = assetLoader();
+        return loader != nullptr ? loader->loadFont(path) : AssetFuture<::goud_font>();
+    }
+
+    /** @brief Upload loaded assets until @p budget_us microseconds have passed.
+     *
+     *  Call once per frame; does nothing if no async load was ever queued.
+     *
+     *  @param budget_us  Time budget in microseconds.
+     *  @return Number of asset loads completed by this call.
+     */
+    std::size_t pumpAssetUploads(std::uint64_t budget_us) const noexcept {
+        return assets_ != nullptr ? assets_->pumpUploads(budget_us) : 0;
+    }
+
+    /** @brief Block until every queued async load has completed.
+     *  @return Number of asset loads completed by this call.
+     */
+    std::size_t finishAssetLoads() const noexcept {
+        return assets_ != nullptr ? assets_->finish() : 0;
+    }
+
+    /** @brief Background loader used by the async load calls, created on first use.
+     *  @return The loader, or nullptr if it could not be allocated.
+     */
+    AssetLoader *assetLoader() const noexcept {
+        if (assets_ == nullptr) {
+            assets_.reset(new (std::nothrow) AssetLoader(handle_));
+        }
+        return assets_.get();
+    }
+
     /** @brief Begin a new render frame.
      *  @return SUCCESS on success.
      */
@@ -367,21 +617,33 @@ public:
         return ::goud_renderer_begin_frame(handle_);
     }
 
-    /** @brief End the current render frame.
-     *  @return SUCCESS on success.
+    /** @brief Flush recorded sprites and text, then end the current render frame.
+     *  @return SUCCESS on success; otherwise the first error encountered.
      */
     int endFrame() const noexcept {
-        return ::goud_renderer_end_frame(handle_);
+        int flushed = flushBatches();
+        int status = ::goud_renderer_end_frame(handle_);
+        return flushed != SUCCESS ? flushed : status;
     }
 
     /** @brief Clear the framebuffer with a solid colour.
+     *
+     *  Sprites and text recorded before the clear are flushed first.
+     *
      *  @param color  Clear colour.
      */
     void clear(::goud_color color) const noexcept {
+        (void)flushBatches();
         ::goud_renderer_clear_color(handle_, color);
     }
 
     /** @brief Draw a textured sprite.
+     *
+     *  With batching enabled (the default) the sprite is recorded and drawn
+     *  on the next flush; errors are then reported by endFrame() or
+     *  flushSprites().  If the batch cannot grow, pending sprites are flushed
+     *  and this sprite is drawn immediately.
+     *
      *  @param texture   Texture handle.
      *  @param x         X position.
      *  @param y         Y position.
@@ -400,9 +662,157 @@ public:
         float rotation,
         ::goud_color color
     ) const noexcept {
+        if (batching_ && sprites_.add(texture, x, y, width, height, rotation, color) == SUCCESS) {
+            return SUCCESS;
+        }
+        (void)flushSprites();
         return ::goud_renderer_draw_sprite_color(handle_, texture, x, y, width, height, rotation, color);
     }
 
+    /** @brief Draw a texture region, such as an image packed by AtlasBuilder.
+     *
+     *  Batched like drawSprite(), so regions that share an atlas page are
+     *  drawn together.
+     *
+     *  @param region    Texture and source rectangle to draw.
+     *  @param x         X position.
+     *  @param y         Y position.
+     *  @param width     Sprite width.
+     *  @param height    Sprite height.
+     *  @param rotation  Rotation in radians.
+     *  @param color     Tint colour.
+     *  @return SUCCESS on success.
+     */
+    int drawSprite(
+        const TextureRegion &region,
+        float x,
+        float y,
+        float width,
+        float height,
+        float rotation,
+        ::goud_color color
+    ) const noexcept {
+        if (batching_ && sprites_.add(region, x, y, width, height, rotation, color) == SUCCESS) {
+            return SUCCESS;
+        }
+        (void)flushSprites();
+        return ::goud_renderer_draw_sprite_src(handle_, region.texture, x, y, width, height, rotation,
+                                               region.src_x, region.src_y, region.src_w, region.src_h,
+                                               color);
+    }
+
+    /** @brief Submit all recorded sprites in one goud_renderer_draw_sprite_batch call.
+     *  @param[out] out_drawn  Optional; receives the number of sprites drawn.
+     *  @return SUCCESS on success (including when nothing was recorded).
+     */
+    int flushSprites(std::uint32_t *out_drawn = nullptr) const noexcept {
+        return sprites_.flush(handle_, out_drawn);
+    }
+
+    /** @brief Enable or disable drawSprite() batching.
+     *
+     *  Pending sprites are flushed before the mode changes.
+     *
+     *  @param enabled  false to send every drawSprite() straight to the engine.
+     */
+    void setSpriteBatching(bool enabled) noexcept {
+        (void)flushSprites();
+        batching_ = enabled;
+    }
+
+    /** @brief Whether drawSprite() records into the sprite batch. */
+    bool spriteBatching() const noexcept {
+        return batching_;
+    }
+
+    /** @brief Access the sprite batch that drawSprite() records into.
+     *  @return Reference to the owned batch.
+     */
+    SpriteBatch &spriteBatch() const noexcept {
+        return sprites_;
+    }
+
+    /** @brief Draw a text label.
+     *
+     *  The text is copied into the owned TextBatch and drawn on the next
+     *  flush, after any recorded sprites; errors are then reported by
+     *  endFrame() or flushText().
+     *
+     *  @param style  Font, size, colour, and layout.
+     *  @param x      X position in screen-space pixels.
+     *  @param y      Y position in screen-space pixels.
+     *  @param text   UTF-8 text.
+     *  @return SUCCESS, or ERR_INTERNAL_ERROR if the batch could not grow.
+     */
+    int drawText(const TextStyle &style, float x, float y, std::string_view text) const noexcept {
+        return text_.add(style, x, y, text);
+    }
+
+    /** @brief Submit all recorded text in one goud_renderer_draw_text_batch call.
+     *  @param[out] out_drawn  Optional; receives the number of labels drawn.
+     *  @return SUCCESS on success (including when nothing was recorded).
+     */
+    int flushText(std::uint32_t *out_drawn = nullptr) const noexcept {
+        return text_.flush(handle_, out_drawn);
+    }
+
+    /** @brief Access the text batch that drawText() records into.
+     *
+     *  Use it directly for addBorrowed() and addFormat().
+     *
+     *  @return Reference to the owned batch.
+     */
+    TextBatch &textBatch() const noexcept {
+        return text_;
+    }
+
+    /** @brief Set the byte budget of the engine's text layout cache.
+     *
+     *  Labels drawn again with the same style and string skip shaping;
+     *  0 disables the cache.
+     *
+     *  @param budget_bytes  Byte budget for cached layouts.
+     *  @return SUCCESS on success.
+     */
+    int setTextCacheBudget(std::uint64_t budget_bytes) const noexcept {
+        return ::goud_renderer_text_cache_budget(handle_, budget_bytes);
+    }
+
+    /** @brief Read the text layout cache's hit, miss, and occupancy counters.
+     *  @param[out] out_stats  Receives the counters.
+     *  @return SUCCESS on success.
+     */
+    int textCacheStats(::goud_text_cache_stats &out_stats) const noexcept {
+        return ::goud_renderer_text_cache_stats(handle_, &out_stats);
+    }
+
+    /** @brief Drop every cached text layout.
+     *  @return SUCCESS on success.
+     */
+    int clearTextCache() const noexcept {
+        return ::goud_renderer_text_cache_clear(handle_);
+    }
+
+    /** @brief Set the GPU residency budget for streamed textures.
+     *
+     *  Least-recently-drawn textures drop back to their base tier at the
+     *  end of a frame until resident bytes fit.
+     *
+     *  @param budget_bytes  Budget for resident texel bytes.
+     *  @return SUCCESS on success.
+     */
+    int setTextureStreamingBudget(std::uint64_t budget_bytes) const noexcept {
+        return ::goud_texture_streaming_budget(handle_, budget_bytes);
+    }
+
+    /** @brief Read streamed-texture residency and eviction counters.
+     *  @param[out] out_stats  Receives the counters.
+     *  @return SUCCESS on success.
+     */
+    int textureStreamingStats(::goud_texture_stream_stats &out_stats) const noexcept {
+        return ::goud_texture_streaming_stats(handle_, &out_stats);
+    }
+
     /** @brief Test whether a key is currently held down.
      *  @param key  Key code.
      *  @return true if pressed.
@@ -466,6 +876,30 @@ public:
         return ::goud_input_key_pressed_once(handle_, key);
     }
 
+    /** @brief Copy this frame's whole input state in one engine call.
+     *  @param[out] out_snapshot  Receives the snapshot; left empty on failure.
+     *  @return SUCCESS on success.
+     */
+    int captureInput(InputSnapshot &out_snapshot) const noexcept {
+        int status = ::goud_input_snapshot_capture(handle_, &out_snapshot.raw());
+        if (status != SUCCESS) {
+            out_snapshot = InputSnapshot();
+        }
+        return status;
+    }
+
+    /** @brief Copy this frame's whole input state in one engine call.
+     *
+     *  Call once after pollEvents(); queries on the result are bit tests.
+     *
+     *  @return The snapshot, or an empty snapshot on failure.
+     */
+    InputSnapshot captureInput() const noexcept {
+        InputSnapshot snapshot;
+        (void)captureInput(snapshot);
+        return snapshot;
+    }
+
     /** @brief Draw a solid-colour quad.
      *  @param x       X position.
      *  @param y       Y position.
@@ -475,6 +909,7 @@ public:
      *  @return SUCCESS on success.
      */
     int drawQuad(float x, float y, float width, float height, ::goud_color color) const noexcept {
+        (void)flushBatches();
         return ::goud_renderer_draw_quad_color(handle_, x, y, width, height, color);
     }
 
@@ -495,6 +930,10 @@ public:
     }
 
     /** @brief Play audio from an in-memory buffer.
+     *
+     *  The engine decodes @p asset_data on every call; sounds played often
+     *  are cheaper as an AudioClip (audio_clip.hpp).
+     *
      *  @param asset_data       Pointer to audio data.
      *  @param asset_len        Length of @p asset_data in bytes.
      *  @param[out] out_player  Receives the player handle.
@@ -504,14 +943,154 @@ public:
         return ::goud_audio_play_memory(handle_, asset_data, asset_len, &out_player);
     }
 
+    /** @brief Set the byte budget for decoded AudioClip samples.
+     *
+     *  Least-recently-played clips drop their samples first and decode
+     *  again on their next play.
+     *
+     *  @param budget_bytes  Byte budget for decoded samples.
+     *  @return SUCCESS on success.
+     */
+    int setAudioClipBudget(std::uint64_t budget_bytes) const noexcept {
+        return ::goud_audio_clip_cache_budget(handle_, budget_bytes);
+    }
+
+    /** @brief Read the audio clip cache's occupancy, hit, and eviction counters.
+     *  @param[out] out_stats  Receives the counters.
+     *  @return SUCCESS on success.
+     */
+    int audioClipStats(::goud_audio_clip_stats &out_stats) const noexcept {
+        return ::goud_audio_clip_cache_stats(handle_, &out_stats);
+    }
+
+    /** @brief Stream an audio file from disk, decoding it in the background.
+     *
+     *  Only a few hundred milliseconds of decoded audio are buffered, so
+     *  long music tracks are cheaper streamed than passed to playAudio().
+     *
+     *  @param path             Null-terminated file path.
+     *  @param[out] out_player  Receives the player handle.
+     *  @param volume           Individual volume (0.0 -- 1.0, clamped).
+     *  @param looping          true to restart from the beginning at the end.
+     *  @param channel          0 = Music, 1 = SFX, 2 = Voice, 3 = Ambience, 4 = UI.
+     *  @return SUCCESS on success.
+     */
+    int playAudioStream(const char *path,
+                        ::goud_audio_player &out_player,
+                        float volume = 1.0f,
+                        bool looping = true,
+                        std::uint8_t channel = 0) const noexcept {
+        return ::goud_audio_stream_play_file(handle_, path, volume, looping, channel, &out_player);
+    }
+
+    /** @brief Crossfade from an active player to a newly streamed file.
+     *
+     *  Advance the fade with goud_audio_update_crossfades().
+     *
+     *  @param from_player      Player to fade out.
+     *  @param path             Null-terminated file path.
+     *  @param duration_sec     Fade duration; 0 switches immediately.
+     *  @param[out] out_player  Receives the new track's player handle.
+     *  @param looping          true to loop the new track.
+     *  @param channel          Channel of the new track.
+     *  @return SUCCESS on success.
+     */
+    int crossfadeToAudioStream(::goud_audio_player from_player,
+                               const char *path,
+                               float duration_sec,
+                               ::goud_audio_player &out_player,
+                               bool looping = true,
+                               std::uint8_t channel = 0) const noexcept {
+        return ::goud_audio_stream_crossfade_to_file(
+            handle_, from_player, path, duration_sec, looping, channel, &out_player);
+    }
+
+    /** @brief Layer a streamed file on top of an active player.
+     *  @param primary_player    Player that keeps playing underneath.
+     *  @param path              Null-terminated file path.
+     *  @param secondary_volume  Volume of the layer (0.0 -- 1.0, clamped).
+     *  @param[out] out_player   Receives the layer's player handle.
+     *  @param looping           true to loop the layer.
+     *  @param channel           Channel of the layer.
+     *  @return SUCCESS on success.
+     */
+    int mixWithAudioStream(::goud_audio_player primary_player,
+                           const char *path,
+                           float secondary_volume,
+                           ::goud_audio_player &out_player,
+                           bool looping = true,
+                           std::uint8_t channel = 0) const noexcept {
+        return ::goud_audio_stream_mix_with_file(
+            handle_, primary_player, path, secondary_volume, looping, channel, &out_player);
+    }
+
+    /** @brief Read the active stream, buffer footprint, and underrun counters.
+     *  @param[out] out_stats  Receives the counters.
+     *  @return SUCCESS on success.
+     */
+    int audioStreamStats(::goud_audio_stream_stats &out_stats) const noexcept {
+        return ::goud_audio_stream_stats_get(handle_, &out_stats);
+    }
+
+    /** @brief Move the listener and every spatial emitter in one call.
+     *
+     *  Emitters beyond their @c max_distance are paused so the mixer skips
+     *  them, and resume once back in range.
+     *
+     *  @param listener          Listener position (x, y, z).
+     *  @param updates           Array of @p count emitter updates.
+     *  @param count             Number of updates.
+     *  @param[out] out_applied  Optional; receives the number of updates applied.
+     *  @return SUCCESS on success.
+     */
+    int updateSpatialSources(const float (&listener)[3],
+                             const ::goud_spatial_source_update *updates,
+                             std::size_t count,
+                             std::size_t *out_applied = nullptr) const noexcept {
+        if (out_applied != nullptr) {
+            *out_applied = 0;
+        }
+        if (count > std::numeric_limits<std::uint32_t>::max()) {
+            return ERR_INVALID_STATE;
+        }
+        std::uint32_t applied = 0;
+        int status = ::goud_audio_spatial_update_batch(
+            handle_, listener, updates, static_cast<std::uint32_t>(count), &applied);
+        if (out_applied != nullptr) {
+            *out_applied = applied;
+        }
+        return status;
+    }
+
 private:
+    static constexpr std::size_t kMaxBatch = std::numeric_limits<std::uint32_t>::max();
+
+    int flushBatches() const noexcept {
+        int sprites = flushSprites();
+        int text = flushText();
+        return sprites != SUCCESS ? sprites : text;
+    }
+
+    mutable std::unique_ptr<AssetLoader> assets_;
+    mutable SpriteBatch sprites_;
+    mutable TextBatch text_;
+    bool batching_ = true;
     ::goud_context handle_;
 };
 
+/** @brief Loop settings for Engine::run(). */
+struct RunOptions {
+    float fixed_dt = 0.0f;                  /**< Step size in seconds; 0 uses the context's fixed timestep, or 1/60. */
+    std::uint32_t max_fixed_steps = 8;      /**< Most fixed updates run per frame. */
+    std::uint32_t target_fps = 0;           /**< Frame rate to pace to; 0 leaves pacing to vsync. */
+    std::chrono::microseconds spin_margin{ 1000 };  /**< Time spun, not slept, before each frame deadline. */
+};
+
 /** @brief High-level engine wrapper that owns a Context.
  *
  *  Created from an EngineConfig via Engine::create().  Delegates window
- *  and rendering operations to the owned Context.
+ *  and rendering operations to the owned Context.  run() drives a
+ *  fixed-timestep game loop until the window closes or stop() is called.
  */
 class Engine {
 public:
@@ -618,8 +1197,56 @@ public:
         return context_.deltaTime();
     }
 
+    /** @brief Run the game loop until the window closes or stop() is called.
+     *
+     *  Each frame polls events, calls @p fixed_update(dt) once per fixed
+     *  step owed (at most @c max_fixed_steps; see FixedTimestep), calls
+     *  @p render(alpha) with the interpolation alpha, swaps buffers, and
+     *  then waits for the next frame when @c target_fps is set.  @p render
+     *  is responsible for beginFrame() and endFrame().
+     *
+     *  @param fixed_update  Callable as @c fixed_update(float dt).
+     *  @param render        Callable as @c render(float alpha).
+     *  @param options       Step size, step cap, and pacing.
+     *  @return SUCCESS when the loop ends normally.
+     *  @retval ERR_INVALID_CONTEXT  The engine is invalid.
+     */
+    template <typename FixedUpdateFn, typename RenderFn>
+    int run(FixedUpdateFn &&fixed_update, RenderFn &&render, const RunOptions &options = RunOptions{}) {
+        if (!valid()) {
+            return ERR_INVALID_CONTEXT;
+        }
+        float dt = options.fixed_dt > 0.0f ? options.fixed_dt : ::goud_fixed_timestep_dt(raw());
+        FixedTimestep timestep(dt, options.max_fixed_steps);
+        FramePacer pacer(options.target_fps, options.spin_margin);
+        FramePacer::Clock::time_point last = FramePacer::Clock::now();
+
+        running_ = true;
+        while (running_ && !shouldClose()) {
+            (void)pollEvents();
+            FramePacer::Clock::time_point now = FramePacer::Clock::now();
+            std::uint32_t steps =
+                timestep.advance(std::chrono::duration<double>(now - last).count());
+            last = now;
+            for (std::uint32_t i = 0; i < steps && running_; ++i) {
+                fixed_update(timestep.dt());
+            }
+            render(timestep.alpha());
+            swapBuffers();
+            pacer.wait();
+        }
+        running_ = false;
+        return SUCCESS;
+    }
+
+    /** @brief Make run() return after the current frame. */
+    void stop() noexcept {
+        running_ = false;
+    }
+
 private:
     Context context_;
+    bool running_ = false;
 };
 
 }  // namespace goud
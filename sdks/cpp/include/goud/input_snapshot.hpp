@@ -0,0 +1,194 @@
+#ifndef GOUD_CPP_INPUT_SNAPSHOT_HPP
+#define GOUD_CPP_INPUT_SNAPSHOT_HPP
+
+/** @file input_snapshot.hpp
+ *  @brief One frame's input state copied out of the engine in one call.
+ *
+ *  goud::Context::captureInput() fills an InputSnapshot through
+ *  goud_input_capture_snapshot(), so a frame that checks dozens of keys and
+ *  buttons pays for one FFI call and answers every query with a bit test.
+ *  The snapshot is trivially copyable and holds no pointers, so recording
+ *  one per frame is enough to replay a session's input.
+ */
+
+#include <goud/goud.h>
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace goud {
+
+/** @brief Keyboard, mouse, gamepad and touch state of one frame.
+ *
+ *  Out-of-range keys, buttons, gamepads and touch slots read as released
+ *  and zero.  A default-constructed snapshot has nothing pressed.
+ */
+class InputSnapshot {
+public:
+    /** @brief Construct an empty snapshot. */
+    InputSnapshot() noexcept = default;
+
+    /** @brief Wrap a snapshot filled by goud_input_snapshot_capture(). */
+    explicit InputSnapshot(const ::goud_input_snapshot &raw) noexcept
+        : raw_(raw) {}
+
+    /** @brief Test whether a key is held. */
+    bool keyDown(::goud_key key) const noexcept {
+        return ::goud_input_snapshot_key_bit(raw_.keys_down, key);
+    }
+
+    /** @brief Test whether a key was pressed this frame. */
+    bool keyPressed(::goud_key key) const noexcept {
+        return ::goud_input_snapshot_key_bit(raw_.keys_pressed, key);
+    }
+
+    /** @brief Test whether a key was released this frame. */
+    bool keyReleased(::goud_key key) const noexcept {
+        return ::goud_input_snapshot_key_bit(raw_.keys_released, key);
+    }
+
+    /** @brief Test whether a mouse button is held. */
+    bool mouseDown(::goud_mouse_button button) const noexcept {
+        return bit(raw_.mouse_down, button);
+    }
+
+    /** @brief Test whether a mouse button was pressed this frame. */
+    bool mousePressed(::goud_mouse_button button) const noexcept {
+        return bit(raw_.mouse_pressed, button);
+    }
+
+    /** @brief Test whether a mouse button was released this frame. */
+    bool mouseReleased(::goud_mouse_button button) const noexcept {
+        return bit(raw_.mouse_released, button);
+    }
+
+    /** @brief Mouse cursor position. */
+    ::goud_vec2 mousePosition() const noexcept {
+        return ::goud_vec2{ raw_.mouse_x, raw_.mouse_y };
+    }
+
+    /** @brief Mouse movement since last frame. */
+    ::goud_vec2 mouseDelta() const noexcept {
+        return ::goud_vec2{ raw_.mouse_dx, raw_.mouse_dy };
+    }
+
+    /** @brief Scroll wheel movement this frame. */
+    ::goud_vec2 scrollDelta() const noexcept {
+        return ::goud_vec2{ raw_.scroll_x, raw_.scroll_y };
+    }
+
+    /** @brief Test whether gamepad @p pad is connected. */
+    bool gamepadConnected(std::uint32_t pad) const noexcept {
+        return pad < MAX_GAMEPAD_SLOTS && bit(raw_.gamepads_connected, pad);
+    }
+
+    /** @brief Test whether a gamepad button is held.
+     *  @param pad     Gamepad index (0-3).
+     *  @param button  Button code (see GAMEPAD_BUTTON_* constants).
+     */
+    bool gamepadDown(std::uint32_t pad, std::uint32_t button) const noexcept {
+        return pad < MAX_GAMEPAD_SLOTS && bit(raw_.gamepad_down[pad], button);
+    }
+
+    /** @brief Test whether a gamepad button was pressed this frame. */
+    bool gamepadPressed(std::uint32_t pad, std::uint32_t button) const noexcept {
+        return pad < MAX_GAMEPAD_SLOTS && bit(raw_.gamepad_pressed[pad], button);
+    }
+
+    /** @brief Test whether a gamepad button was released this frame. */
+    bool gamepadReleased(std::uint32_t pad, std::uint32_t button) const noexcept {
+        return pad < MAX_GAMEPAD_SLOTS && bit(raw_.gamepad_released[pad], button);
+    }
+
+    /** @brief Gamepad axis value after the dead zone.
+     *  @param pad   Gamepad index (0-3).
+     *  @param axis  Axis code (see GAMEPAD_AXIS_* constants).
+     *  @return The value, or 0 for unknown pads and axes.
+     */
+    float gamepadAxis(std::uint32_t pad, std::uint32_t axis) const noexcept {
+        if (pad >= MAX_GAMEPAD_SLOTS || axis >= GOUD_GAMEPAD_AXIS_COUNT) {
+            return 0.0f;
+        }
+        return raw_.gamepad_axes[pad * GOUD_GAMEPAD_AXIS_COUNT + axis];
+    }
+
+    /** @brief Number of touch slots in use, sorted by touch ID.
+     *
+     *  Includes touches that ended this frame, so touchReleased() can be
+     *  tested for each slot.
+     */
+    std::uint32_t touchCount() const noexcept {
+        return raw_.touch_count;
+    }
+
+    /** @brief Touch ID of slot @p slot. */
+    std::uint64_t touchId(std::uint32_t slot) const noexcept {
+        return slot < raw_.touch_count ? raw_.touch_ids[slot] : 0;
+    }
+
+    /** @brief Test whether the touch in @p slot is active. */
+    bool touchActive(std::uint32_t slot) const noexcept {
+        return slot < raw_.touch_count && bit(raw_.touch_active, slot);
+    }
+
+    /** @brief Test whether the touch in @p slot began this frame. */
+    bool touchPressed(std::uint32_t slot) const noexcept {
+        return slot < raw_.touch_count && bit(raw_.touch_pressed, slot);
+    }
+
+    /** @brief Test whether the touch in @p slot ended this frame. */
+    bool touchReleased(std::uint32_t slot) const noexcept {
+        return slot < raw_.touch_count && bit(raw_.touch_released, slot);
+    }
+
+    /** @brief Position of the touch in @p slot. */
+    ::goud_vec2 touchPosition(std::uint32_t slot) const noexcept {
+        if (slot >= raw_.touch_count) {
+            return ::goud_vec2{ 0.0f, 0.0f };
+        }
+        return ::goud_vec2{ raw_.touch_x[slot], raw_.touch_y[slot] };
+    }
+
+    /** @brief Movement of the touch in @p slot since last frame. */
+    ::goud_vec2 touchDelta(std::uint32_t slot) const noexcept {
+        if (slot >= raw_.touch_count) {
+            return ::goud_vec2{ 0.0f, 0.0f };
+        }
+        return ::goud_vec2{ raw_.touch_dx[slot], raw_.touch_dy[slot] };
+    }
+
+    /** @brief The underlying C struct, e.g. for writing to a replay file. */
+    const ::goud_input_snapshot &raw() const noexcept {
+        return raw_;
+    }
+
+    /** @brief Mutable access to the underlying C struct, e.g. for capture or replay playback. */
+    ::goud_input_snapshot &raw() noexcept {
+        return raw_;
+    }
+
+    /** @brief Compare two snapshots byte for byte. */
+    friend bool operator==(const InputSnapshot &a, const InputSnapshot &b) noexcept {
+        return std::memcmp(&a.raw_, &b.raw_, sizeof(a.raw_)) == 0;
+    }
+
+    /** @brief Compare two snapshots byte for byte. */
+    friend bool operator!=(const InputSnapshot &a, const InputSnapshot &b) noexcept {
+        return !(a == b);
+    }
+
+private:
+    static bool bit(std::uint32_t mask, std::int64_t index) noexcept {
+        return index >= 0 && index < 32 && ((mask >> index) & 1u) != 0;
+    }
+
+    ::goud_input_snapshot raw_{};
+};
+
+static_assert(std::is_trivially_copyable<InputSnapshot>::value,
+              "InputSnapshot must stay trivially copyable for replay recording");
+
+}  // namespace goud
+
+#endif
@@ -0,0 +1,449 @@
+#ifndef GOUD_CPP_JOB_SYSTEM_HPP
+#define GOUD_CPP_JOB_SYSTEM_HPP
+
+/** @file job_system.hpp
+ *  @brief Work-stealing job pool for fanning gameplay updates across cores.
+ *
+ *  JobSystem runs closures on a fixed set of worker threads.  schedule()
+ *  queues a job that starts once the jobs it depends on have finished;
+ *  parallelFor() and forEach() split an index range or a ComponentView
+ *  into chunks and block until every chunk has run, with the calling
+ *  thread working alongside the pool.
+ *
+ *  @par Engine calls from jobs
+ *  Only these engine calls may be made from a job:
+ *  - reading a ComponentView (or pointers from it) that was refreshed
+ *    before the jobs started, while no thread makes a mutable World call;
+ *  - the pure helpers goud_collision_*() and those in collision_batch.h;
+ *  - 2D and 3D physics, spatial hash, spatial grid, and pool calls, which
+ *    take an engine-wide lock and so run one at a time;
+ *  - goud_last_error_code() and the other last-error calls, which are
+ *    per thread.
+ *  Window, input, renderer, text, audio, animation, and entity or
+ *  component mutation must stay on the thread that owns the context.
+ *  Jobs typically write results into arrays the caller owns, and the
+ *  render thread applies them after the jobs finish.
+ */
+
+#include <goud/goud.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace goud {
+
+class JobSystem;
+
+namespace detail {
+
+/** A scheduled job and the jobs waiting on it. */
+struct Job {
+    virtual ~Job() = default;
+
+    /** Call the job's callable once, then destroy it. */
+    virtual void run() noexcept = 0;
+
+    std::atomic<std::uint32_t> blockers{ 1 };  // unfinished dependencies + 1 until scheduled
+    std::atomic<bool> done{ false };
+    std::mutex mutex;                          // guards dependents and the done transition
+    std::vector<std::shared_ptr<Job>> dependents;
+};
+
+/** A job holding its callable inline, so the callable is only moved in
+ *  once the job's memory has been allocated. */
+template <typename Fn>
+struct CallableJob final : Job {
+    template <typename Arg>
+    explicit CallableJob(Arg &&arg)
+        : fn(std::in_place, std::forward<Arg>(arg)) {}
+
+    void run() noexcept override {
+        (*fn)();
+        fn.reset();
+    }
+
+    std::optional<Fn> fn;
+};
+
+/** One worker's deque.  The owner pushes and pops at the back; thieves
+ *  take from the front, so they get the oldest, usually largest, work. */
+struct JobQueue {
+    std::mutex mutex;
+    std::deque<std::shared_ptr<Job>> jobs;
+};
+
+}  // namespace detail
+
+/** @brief Handle to a scheduled job.
+ *
+ *  Cheap to copy.  A default-constructed handle counts as finished, so it
+ *  can be passed as a dependency unconditionally.
+ */
+class JobHandle {
+public:
+    /** @brief Construct a finished handle. */
+    JobHandle() noexcept = default;
+
+    /** @brief Whether the job has finished running. */
+    bool done() const noexcept {
+        return job_ == nullptr || job_->done.load(std::memory_order_acquire);
+    }
+
+private:
+    friend class JobSystem;
+
+    explicit JobHandle(std::shared_ptr<detail::Job> job) noexcept
+        : job_(std::move(job)) {}
+
+    std::shared_ptr<detail::Job> job_;
+};
+
+/** @brief Pool of worker threads with per-worker, work-stealing queues.
+ *
+ *  Non-copyable and non-movable; hold it by value or through a pointer.
+ *  Job functions must not throw.  The destructor waits for every queued
+ *  job to finish.
+ *
+ *  @par Zero workers
+ *  With zero workers nothing is queued: a job runs inline on the thread
+ *  whose call makes it ready, which is schedule() itself when it has no
+ *  unfinished dependencies, or the call that finishes its last one.  Its
+ *  handle is therefore usually done by the time schedule() returns, and
+ *  parallelFor() runs the whole range on the calling thread.  This keeps
+ *  single-core builds correct without a thread to hand work to.
+ */
+class JobSystem {
+public:
+    /** @brief Default number of worker threads (hardware threads - 1, at least 1). */
+    static unsigned defaultWorkerCount() noexcept {
+        unsigned hardware = std::thread::hardware_concurrency();
+        return hardware > 1 ? hardware - 1 : 1;
+    }
+
+    /** @brief Start @p worker_count worker threads.
+     *  @param worker_count  Number of worker threads; 0 runs jobs inline, see above.
+     */
+    explicit JobSystem(unsigned worker_count = defaultWorkerCount()) noexcept {
+        try {
+            queues_.reserve(worker_count);
+            for (unsigned i = 0; i < worker_count; ++i) {
+                queues_.push_back(std::make_unique<detail::JobQueue>());
+            }
+            workers_.reserve(worker_count);
+            for (unsigned i = 0; i < worker_count; ++i) {
+                workers_.emplace_back([this, i] { workerLoop(i); });
+            }
+        } catch (...) {
+            // Keep whichever workers started; the rest of the queues are
+            // still drained by stealing and by wait().
+        }
+    }
+
+    /** @brief Finish every queued job and stop the workers. */
+    ~JobSystem() {
+        while (runOne()) {
+        }
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        for (std::thread &worker : workers_) {
+            worker.join();
+        }
+    }
+
+    JobSystem(const JobSystem &) = delete;
+    JobSystem &operator=(const JobSystem &) = delete;
+
+    /** @brief Queue @p fn to run once every job in @p dependencies has finished.
+     *
+     *  If the job cannot be allocated, @p fn, which has not been moved
+     *  from, runs on the calling thread after its dependencies, and the
+     *  returned handle is already finished.
+     *
+     *  @param fn            Callable as @c fn().
+     *  @param dependencies  Jobs that must finish first.
+     *  @return Handle to the job.
+     */
+    template <typename Fn>
+    JobHandle schedule(Fn &&fn, std::initializer_list<JobHandle> dependencies = {}) noexcept {
+        return schedule(std::forward<Fn>(fn), dependencies.begin(), dependencies.size());
+    }
+
+    /** @brief Queue @p fn after @p count jobs starting at @p dependencies.
+     *  @see schedule(Fn &&, std::initializer_list<JobHandle>)
+     */
+    template <typename Fn>
+    JobHandle schedule(Fn &&fn, const JobHandle *dependencies, std::size_t count) noexcept {
+        std::shared_ptr<detail::Job> job;
+        try {
+            // make_shared allocates before it constructs the job, so @p fn
+            // is only moved from once the allocation has succeeded.
+            job = std::make_shared<detail::CallableJob<std::decay_t<Fn>>>(std::forward<Fn>(fn));
+        } catch (...) {
+            for (std::size_t i = 0; i < count; ++i) {
+                wait(dependencies[i]);
+            }
+            fn();
+            return JobHandle();
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::shared_ptr<detail::Job> &dependency = dependencies[i].job_;
+            if (dependency == nullptr) {
+                continue;
+            }
+            bool recorded = true;
+            {
+                std::lock_guard<std::mutex> lock(dependency->mutex);
+                if (dependency->done.load(std::memory_order_relaxed)) {
+                    continue;
+                }
+                try {
+                    dependency->dependents.push_back(job);
+                    job->blockers.fetch_add(1, std::memory_order_relaxed);
+                } catch (...) {
+                    recorded = false;
+                }
+            }
+            if (!recorded) {
+                // Out of memory recording the edge: honour it by waiting now.
+                wait(dependencies[i]);
+            }
+        }
+        release(job);
+        return JobHandle(std::move(job));
+    }
+
+    /** @brief Block until @p job has finished, running other jobs meanwhile. */
+    void wait(const JobHandle &job) noexcept {
+        while (!job.done()) {
+            if (!runOne()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    /** @brief Block until every job in @p jobs has finished. */
+    void wait(std::initializer_list<JobHandle> jobs) noexcept {
+        for (const JobHandle &job : jobs) {
+            wait(job);
+        }
+    }
+
+    /** @brief Call @p fn(chunk_begin, chunk_end) over [@p begin, @p end) in parallel.
+     *
+     *  The range is cut into chunks of @p grain indices (the last one may be
+     *  shorter) that run on the workers and the calling thread.  Returns
+     *  once every chunk has run.  Chunks may run concurrently, so @p fn must
+     *  only write state that belongs to its own indices.
+     *
+     *  @param begin  First index.
+     *  @param end    One past the last index.
+     *  @param grain  Indices per chunk; 0 picks about four chunks per thread.
+     *  @param fn     Callable as @c fn(std::size_t chunk_begin, std::size_t chunk_end).
+     */
+    template <typename Fn>
+    void parallelFor(std::size_t begin, std::size_t end, std::size_t grain, Fn &&fn) noexcept {
+        if (end <= begin) {
+            return;
+        }
+        std::size_t count = end - begin;
+        std::size_t threads = workers_.size() + 1;
+        if (grain == 0) {
+            grain = std::max<std::size_t>(1, count / (threads * 4));
+        }
+        std::size_t chunks = (count + grain - 1) / grain;
+        if (chunks == 1 || workers_.empty()) {
+            fn(begin, end);
+            return;
+        }
+
+        struct Range {
+            std::atomic<std::size_t> next{ 0 };
+            std::atomic<std::size_t> finished{ 0 };
+        };
+        std::shared_ptr<Range> range;
+        try {
+            range = std::make_shared<Range>();
+        } catch (...) {
+            fn(begin, end);
+            return;
+        }
+
+        // Helpers hold the range alive; one that starts after the work is
+        // gone claims nothing and never touches fn.
+        auto run_chunks = [range, begin, end, grain, chunks, &fn]() noexcept {
+            for (;;) {
+                std::size_t chunk = range->next.fetch_add(1, std::memory_order_relaxed);
+                if (chunk >= chunks) {
+                    return;
+                }
+                std::size_t chunk_begin = begin + chunk * grain;
+                fn(chunk_begin, std::min(end, chunk_begin + grain));
+                range->finished.fetch_add(1, std::memory_order_acq_rel);
+            }
+        };
+        std::size_t helpers = std::min(workers_.size(), chunks - 1);
+        for (std::size_t i = 0; i < helpers; ++i) {
+            (void)schedule(run_chunks);
+        }
+        run_chunks();
+        while (range->finished.load(std::memory_order_acquire) < chunks) {
+            if (!runOne()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    /** @brief Call @p fn(entity, component) for every item of @p view in parallel.
+     *
+     *  @p view is any view with size(), entity(i), and operator[](i), such as
+     *  a refreshed ComponentView<T>.  No thread may make a mutable World call
+     *  until this returns.
+     *
+     *  @param view   View to iterate.
+     *  @param grain  Items per chunk; 0 picks automatically.
+     *  @param fn     Callable as @c fn(goud_entity, const T &).
+     */
+    template <typename View, typename Fn>
+    void forEach(const View &view, std::size_t grain, Fn &&fn) noexcept {
+        parallelFor(0, view.size(), grain, [&view, &fn](std::size_t chunk_begin, std::size_t chunk_end) {
+            for (std::size_t i = chunk_begin; i < chunk_end; ++i) {
+                fn(view.entity(i), view[i]);
+            }
+        });
+    }
+
+    /** @brief Number of running worker threads. */
+    std::size_t workerCount() const noexcept {
+        return workers_.size();
+    }
+
+private:
+    /** Drop the scheduling guard (or one finished dependency) and queue the
+     *  job once nothing blocks it. */
+    void release(const std::shared_ptr<detail::Job> &job) noexcept {
+        if (job->blockers.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            enqueue(job);
+        }
+    }
+
+    void enqueue(const std::shared_ptr<detail::Job> &job) noexcept {
+        std::size_t target = current_owner_ == this
+                                 ? current_index_
+                                 : next_queue_.fetch_add(1, std::memory_order_relaxed);
+        bool queued = false;
+        if (!queues_.empty()) {
+            detail::JobQueue &queue = *queues_[target % queues_.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            try {
+                queue.jobs.push_back(job);
+                queued = true;
+            } catch (...) {
+            }
+        }
+        if (!queued) {
+            execute(job);
+            return;
+        }
+        queued_.fetch_add(1, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+        }
+        wake_.notify_one();
+    }
+
+    /** Take one job: the back of this worker's queue first, then the
+     *  front of every other queue. */
+    std::shared_ptr<detail::Job> take() noexcept {
+        if (queued_.load(std::memory_order_acquire) == 0 || queues_.empty()) {
+            return nullptr;
+        }
+        std::size_t home = current_owner_ == this ? current_index_ : 0;
+        for (std::size_t i = 0; i < queues_.size(); ++i) {
+            detail::JobQueue &queue = *queues_[(home + i) % queues_.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.jobs.empty()) {
+                continue;
+            }
+            std::shared_ptr<detail::Job> job;
+            if (i == 0 && current_owner_ == this) {
+                job = std::move(queue.jobs.back());
+                queue.jobs.pop_back();
+            } else {
+                job = std::move(queue.jobs.front());
+                queue.jobs.pop_front();
+            }
+            queued_.fetch_sub(1, std::memory_order_acq_rel);
+            return job;
+        }
+        return nullptr;
+    }
+
+    bool runOne() noexcept {
+        std::shared_ptr<detail::Job> job = take();
+        if (job == nullptr) {
+            return false;
+        }
+        execute(job);
+        return true;
+    }
+
+    void execute(const std::shared_ptr<detail::Job> &job) noexcept {
+        job->run();
+        std::vector<std::shared_ptr<detail::Job>> dependents;
+        {
+            std::lock_guard<std::mutex> lock(job->mutex);
+            job->done.store(true, std::memory_order_release);
+            dependents.swap(job->dependents);
+        }
+        for (const std::shared_ptr<detail::Job> &dependent : dependents) {
+            release(dependent);
+        }
+    }
+
+    void workerLoop(std::size_t index) noexcept {
+        current_owner_ = this;
+        current_index_ = index;
+        for (;;) {
+            if (runOne()) {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            wake_.wait(lock, [this] {
+                return stopping_ || queued_.load(std::memory_order_acquire) > 0;
+            });
+            if (stopping_ && queued_.load(std::memory_order_acquire) == 0) {
+                return;
+            }
+        }
+    }
+
+    static inline thread_local const JobSystem *current_owner_ = nullptr;
+    static inline thread_local std::size_t current_index_ = 0;
+
+    std::vector<std::unique_ptr<detail::JobQueue>> queues_;
+    std::vector<std::thread> workers_;
+    std::atomic<std::size_t> queued_{ 0 };
+    std::atomic<std::size_t> next_queue_{ 0 };
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_;
+    bool stopping_ = false;
+};
+
+}  // namespace goud
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef GOUD_CPP_METRICS_HPP
+#define GOUD_CPP_METRICS_HPP
+
+/** @file metrics.hpp
+ *  @brief Lock-free polling of a context's binary metrics block.
+ *
+ *  A context publishes render metrics, frame phase timings, frame arena,
+ *  FPS, entity count, memory and network totals into a double buffer at
+ *  the end of every rendered frame.  Metrics::read() copies the latest
+ *  block from any thread without locking or formatting anything, so a
+ *  monitoring thread can poll as often as it likes:
+ *
+ *  @code
+ *  goud::Metrics metrics = goud::Metrics::forContext(context);
+ *  // On the monitoring thread:
+ *  goud_metrics_block block{};
+ *  if (metrics.read(block) == SUCCESS && block.publish_index != last_seen) {
+ *      last_seen = block.publish_index;
+ *      report(block.fps.avg_fps, block.render.draw_call_count, block.entity_count);
+ *  }
+ *  @endcode
+ */
+
+#include <goud/goud.hpp>
+
+namespace goud {
+
+/** @brief Non-owning view of a context's metrics double buffer.
+ *
+ *  Cheap to copy and safe to hand to other threads.  The buffer belongs to
+ *  the context (or to whoever attached it with share()) and must outlive
+ *  every Metrics that views it.
+ */
+class Metrics {
+public:
+    /** @brief Construct an invalid view. */
+    Metrics() noexcept = default;
+
+    /** @brief View a buffer obtained elsewhere, e.g. a shared-memory mapping. */
+    explicit Metrics(const ::goud_metrics_double_buffer *buffer) noexcept
+        : buffer_(buffer) {}
+
+    /** @brief View @p context's buffer, enabling per-frame publishing.
+     *
+     *  Call from the context's thread.
+     *
+     *  @param[out] out_status  Optional pointer to receive the status code.
+     *  @return A valid Metrics on success.
+     */
+    static Metrics forContext(const Context &context, int *out_status = nullptr) noexcept {
+        const ::goud_metrics_double_buffer *buffer = nullptr;
+        int status = ::goud_metrics_get_buffer(context.raw(), &buffer);
+        if (out_status != nullptr) {
+            *out_status = status;
+        }
+        return Metrics(status == SUCCESS ? buffer : nullptr);
+    }
+
+    /** @brief Publish @p context's metrics into caller-owned storage.
+     *
+     *  @p buffer is initialised by the engine and must stay valid until it
+     *  is detached by passing nullptr or the context is destroyed.
+     *
+     *  @return SUCCESS on success.
+     */
+    static int share(const Context &context, ::goud_metrics_double_buffer *buffer) noexcept {
+        return ::goud_metrics_share(context.raw(), buffer);
+    }
+
+    /** @brief Gather and publish @p context's metrics now.
+     *
+     *  Only needed for headless contexts; rendered ones publish in
+     *  Context::endFrame().
+     *
+     *  @return SUCCESS on success.
+     */
+    static int publish(const Context &context) noexcept {
+        return ::goud_metrics_publish_now(context.raw());
+    }
+
+    /** @brief Check whether the view refers to a buffer. */
+    bool valid() const noexcept {
+        return buffer_ != nullptr;
+    }
+
+    /** @brief Copy the latest block.  Lock-free; callable from any thread.
+     *  @param[out] out_block  Receives the block; publish_index is 0 before the first publish.
+     *  @return SUCCESS on success.
+     */
+    int read(::goud_metrics_block &out_block) const noexcept {
+        return ::goud_metrics_copy(buffer_, &out_block);
+    }
+
+    /** @brief Access the viewed buffer. */
+    const ::goud_metrics_double_buffer *raw() const noexcept {
+        return buffer_;
+    }
+
+private:
+    const ::goud_metrics_double_buffer *buffer_ = nullptr;
+};
+
+} // namespace goud
+
+#endif
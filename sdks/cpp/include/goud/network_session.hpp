@@ -0,0 +1,563 @@
+#ifndef GOUD_CPP_NETWORK_SESSION_HPP
+#define GOUD_CPP_NETWORK_SESSION_HPP
+
+/** @file network_session.hpp
+ *  @brief RAII network session with batched receive and coalesced sends.
+ *
+ *  goud_network_receive() copies one message per call and goud_network_send()
+ *  sends one datagram per message, which at tens of thousands of messages a
+ *  second is mostly call and packet overhead.  NetworkSession drains every
+ *  queued message into one reused receive buffer per call and hands out
+ *  views into it, and coalesces the messages queued with sendBatch() into
+ *  one datagram per peer each poll().  Messages sent with send() use the
+ *  same framing as a one-message datagram, so the receiver never mistakes
+ *  a payload for a coalesced datagram.
+ */
+
+#include <goud/goud.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace goud {
+
+/** @brief Aggregate transport counters for a network handle. */
+using NetworkStats = ::goud_network_stats;
+
+/** @brief Application messages and payload bytes exchanged with one peer. */
+struct PeerTraffic {
+    std::uint64_t bytes_sent = 0;         /**< Payload bytes sent. */
+    std::uint64_t bytes_received = 0;     /**< Payload bytes received. */
+    std::uint64_t messages_sent = 0;      /**< Messages sent. */
+    std::uint64_t messages_received = 0;  /**< Messages received. */
+};
+
+/** @brief One message for NetworkSession::sendBatch(). */
+struct OutgoingMessage {
+    std::uint64_t peer_id = 0;    /**< Destination peer. */
+    const void *data = nullptr;   /**< Message bytes; copied by sendBatch(). */
+    std::size_t size = 0;         /**< Message size in bytes. */
+};
+
+/** @brief Buffer sizes for a NetworkSession. */
+struct NetworkSessionOptions {
+    /** Initial receive buffer size; drain() grows it to fit larger messages. */
+    std::size_t receive_buffer_bytes = 256 * 1024;
+    /** Messages moved per goud_network_receive_batch() call. */
+    std::uint32_t receive_batch_messages = 1024;
+    /** Coalesced datagrams are sent early rather than grow past this size. */
+    std::size_t max_datagram_bytes = 1200;
+};
+
+namespace detail {
+
+/** @brief First bytes of a coalesced datagram.
+ *
+ *  A coalesced datagram is this marker followed, per message, by its
+ *  length as a little-endian uint16 and its bytes.
+ */
+inline constexpr std::uint8_t kNetworkBatchMagic[4] = {'G', 'N', 'B', '1'};
+inline constexpr std::size_t kNetworkBatchHeaderBytes = sizeof(kNetworkBatchMagic);
+inline constexpr std::size_t kNetworkRecordHeaderBytes = 2;
+
+/** @brief Check that @p data is a well-formed coalesced datagram. */
+inline bool isNetworkBatch(const std::uint8_t *data, std::size_t size) noexcept {
+    if (size < kNetworkBatchHeaderBytes ||
+        std::memcmp(data, kNetworkBatchMagic, kNetworkBatchHeaderBytes) != 0) {
+        return false;
+    }
+    std::size_t offset = kNetworkBatchHeaderBytes;
+    while (offset < size) {
+        if (size - offset < kNetworkRecordHeaderBytes) {
+            return false;
+        }
+        std::size_t len = static_cast<std::size_t>(data[offset]) |
+                          static_cast<std::size_t>(data[offset + 1]) << 8;
+        offset += kNetworkRecordHeaderBytes;
+        if (size - offset < len) {
+            return false;
+        }
+        offset += len;
+    }
+    return true;
+}
+
+/** @brief Append one message record to @p datagram, adding the marker if it is empty.
+ *
+ *  @p size must not exceed 0xFFFF.  Throws std::bad_alloc.
+ */
+inline void appendNetworkRecord(std::vector<std::uint8_t> &datagram, const void *data, std::size_t size) {
+    if (datagram.empty()) {
+        datagram.insert(datagram.end(), std::begin(kNetworkBatchMagic), std::end(kNetworkBatchMagic));
+    }
+    datagram.push_back(static_cast<std::uint8_t>(size & 0xFF));
+    datagram.push_back(static_cast<std::uint8_t>(size >> 8));
+    const auto *bytes = static_cast<const std::uint8_t *>(data);
+    datagram.insert(datagram.end(), bytes, bytes + size);
+}
+
+/** @brief Invoke @p callback(data, size) for each message of a coalesced datagram.
+ *
+ *  @p data must satisfy isNetworkBatch().
+ *
+ *  @return The number of messages.
+ */
+template <typename Callback>
+std::size_t forEachNetworkRecord(const std::uint8_t *data, std::size_t size, Callback &&callback) {
+    std::size_t count = 0;
+    std::size_t offset = kNetworkBatchHeaderBytes;
+    while (offset < size) {
+        std::size_t len = static_cast<std::size_t>(data[offset]) |
+                          static_cast<std::size_t>(data[offset + 1]) << 8;
+        offset += kNetworkRecordHeaderBytes;
+        callback(data + offset, len);
+        offset += len;
+        ++count;
+    }
+    return count;
+}
+
+}  // namespace detail
+
+/** @brief RAII wrapper for a hosted or connected network handle.
+ *
+ *  Move-only.  The handle is closed on destruction, disconnecting every
+ *  peer.  Messages sent with sendBatch() are coalesced, so both ends should
+ *  use NetworkSession; drain() delivers datagrams from other senders whole.
+ *  Not thread-safe.
+ */
+class NetworkSession {
+public:
+    /** @brief Transport selection. */
+    enum class Protocol : std::int32_t { Udp = 0, WebSocket = 1, Tcp = 2 };
+
+    /** @brief Largest message sendBatch() accepts. */
+    static constexpr std::size_t kMaxBatchedMessageBytes = 0xFFFF;
+
+    /** @brief Construct an invalid session. */
+    NetworkSession() noexcept = default;
+
+    /** @brief Close the session. */
+    ~NetworkSession() noexcept {
+        reset();
+    }
+
+    NetworkSession(const NetworkSession &) = delete;
+    NetworkSession &operator=(const NetworkSession &) = delete;
+
+    /** @brief Move-construct from another session. */
+    NetworkSession(NetworkSession &&other) noexcept
+        : context_(other.context_),
+          network_(std::exchange(other.network_, 0)),
+          server_peer_(other.server_peer_),
+          options_(other.options_),
+          receive_buffer_(std::move(other.receive_buffer_)),
+          messages_(std::move(other.messages_)),
+          pending_(std::move(other.pending_)),
+          send_buffer_(std::move(other.send_buffer_)),
+          peers_(std::move(other.peers_)) {}
+
+    /** @brief Move-assign from another session. */
+    NetworkSession &operator=(NetworkSession &&other) noexcept {
+        if (this != &other) {
+            reset();
+            context_ = other.context_;
+            network_ = std::exchange(other.network_, 0);
+            server_peer_ = other.server_peer_;
+            options_ = other.options_;
+            receive_buffer_ = std::move(other.receive_buffer_);
+            messages_ = std::move(other.messages_);
+            pending_ = std::move(other.pending_);
+            send_buffer_ = std::move(other.send_buffer_);
+            peers_ = std::move(other.peers_);
+        }
+        return *this;
+    }
+
+    /** @brief Start hosting on @p port.
+     *  @param context          Context that owns the session.
+     *  @param protocol         Transport to listen on.
+     *  @param port             Port to listen on.
+     *  @param[out] out_status  Optional pointer to receive the status code.
+     *  @param options          Buffer sizes.
+     *  @return A valid NetworkSession on success.
+     */
+    static NetworkSession host(const Context &context,
+                               Protocol protocol,
+                               std::uint16_t port,
+                               int *out_status = nullptr,
+                               const NetworkSessionOptions &options = {}) noexcept {
+        NetworkSession session;
+        session.context_ = context.raw();
+        session.options_ = options;
+        int status = ::goud_network_open_host(
+            context.raw(), static_cast<std::int32_t>(protocol), port, &session.network_);
+        if (out_status != nullptr) {
+            *out_status = status;
+        }
+        return session;
+    }
+
+    /** @brief Connect to a remote host.
+     *  @param context          Context that owns the session.
+     *  @param protocol         Transport to connect with.
+     *  @param address          Host name or IP, optionally with ":port".
+     *  @param port             Port used when @p address has none.
+     *  @param[out] out_status  Optional pointer to receive the status code.
+     *  @param options          Buffer sizes.
+     *  @return A valid NetworkSession on success; serverPeer() names the host.
+     */
+    static NetworkSession connect(const Context &context,
+                                  Protocol protocol,
+                                  const char *address,
+                                  std::uint16_t port,
+                                  int *out_status = nullptr,
+                                  const NetworkSessionOptions &options = {}) noexcept {
+        NetworkSession session;
+        session.context_ = context.raw();
+        session.options_ = options;
+        int status = ::goud_network_open_client(context.raw(),
+                                                static_cast<std::int32_t>(protocol),
+                                                address,
+                                                port,
+                                                &session.network_,
+                                                &session.server_peer_);
+        if (out_status != nullptr) {
+            *out_status = status;
+        }
+        return session;
+    }
+
+    /** @brief Check whether the session holds a network handle. */
+    bool valid() const noexcept {
+        return network_ > 0;
+    }
+
+    /** @brief Underlying network handle. */
+    ::goud_network raw() const noexcept {
+        return network_;
+    }
+
+    /** @brief Peer ID of the host, for sessions created with connect(). */
+    std::uint64_t serverPeer() const noexcept {
+        return server_peer_;
+    }
+
+    /** @brief Send one message now, uncoalesced.
+     *
+     *  The message travels as a one-message coalesced datagram, so it
+     *  arrives unchanged whatever its bytes look like.
+     *
+     *  @return SUCCESS on success.
+     *  @retval ERR_INVALID_STATE  @p data is NULL with a non-zero @p size, or @p size is
+     *                             larger than kMaxBatchedMessageBytes.
+     */
+    int send(std::uint64_t peer_id, const void *data, std::size_t size, std::uint8_t channel = 0) noexcept {
+        if ((data == nullptr && size != 0) || size > kMaxBatchedMessageBytes) {
+            return ERR_INVALID_STATE;
+        }
+        try {
+            send_buffer_.clear();
+            detail::appendNetworkRecord(send_buffer_, data, size);
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+        int status = ::goud_network_send_bytes(
+            context_, network_, peer_id, send_buffer_.data(), send_buffer_.size(), channel);
+        if (status == SUCCESS) {
+            status = countSent(peer_id, size, 1);
+        }
+        return status;
+    }
+
+    /** @brief Queue messages to be coalesced into one datagram per peer.
+     *
+     *  The bytes are copied, so @p messages may be reused on return.  The
+     *  datagrams go out on the next flush() or poll(); a peer's datagram is
+     *  sent early instead of growing past
+     *  NetworkSessionOptions::max_datagram_bytes.
+     *
+     *  @param messages  Array of @p count messages.
+     *  @param count     Number of messages.
+     *  @param channel   0 = reliable-ordered, 1+ = unreliable (UDP).
+     *  @return SUCCESS on success (including @p count == 0).
+     *  @retval ERR_INVALID_STATE  @p messages is NULL with a non-zero @p count, or a message
+     *                             is NULL with a non-zero size or larger than
+     *                             kMaxBatchedMessageBytes.  Nothing is queued.
+     */
+    int sendBatch(const OutgoingMessage *messages, std::size_t count, std::uint8_t channel = 0) noexcept {
+        if (count == 0) {
+            return SUCCESS;
+        }
+        if (messages == nullptr || !valid()) {
+            return ERR_INVALID_STATE;
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            if ((messages[i].data == nullptr && messages[i].size != 0) ||
+                messages[i].size > kMaxBatchedMessageBytes) {
+                return ERR_INVALID_STATE;
+            }
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            const OutgoingMessage &message = messages[i];
+            PendingDatagram *pending = pendingFor(message.peer_id, channel);
+            if (pending == nullptr) {
+                return ERR_INTERNAL_ERROR;
+            }
+            std::size_t record = detail::kNetworkRecordHeaderBytes + message.size;
+            if (pending->bytes.size() > detail::kNetworkBatchHeaderBytes &&
+                pending->bytes.size() + record > options_.max_datagram_bytes) {
+                int status = sendPending(*pending);
+                if (status != SUCCESS) {
+                    return status;
+                }
+            }
+            int status = appendRecord(*pending, message);
+            if (status != SUCCESS) {
+                return status;
+            }
+        }
+        return SUCCESS;
+    }
+
+    /** @brief Send every datagram queued by sendBatch().
+     *  @return SUCCESS, or the first failing send's status (the rest are still sent).
+     */
+    int flush() noexcept {
+        int result = SUCCESS;
+        for (PendingDatagram &pending : pending_) {
+            if (pending.bytes.size() > detail::kNetworkBatchHeaderBytes) {
+                int status = sendPending(pending);
+                if (result == SUCCESS) {
+                    result = status;
+                }
+            }
+        }
+        return result;
+    }
+
+    /** @brief flush(), then pump the transport and queue received messages.
+     *  @return SUCCESS on success.
+     */
+    int poll() noexcept {
+        int flushed = flush();
+        int status = ::goud_network_update(context_, network_);
+        return flushed != SUCCESS ? flushed : status;
+    }
+
+    /** @brief Deliver every message queued by poll() to @p callback.
+     *
+     *  @p callback is invoked as
+     *  <tt>callback(std::uint64_t peer_id, const std::uint8_t *data, std::size_t size)</tt>
+     *  with a view into the session's receive buffer, valid only for that
+     *  call.  Coalesced datagrams are split into their messages; datagrams
+     *  from senders other than a NetworkSession are delivered whole.  Exceptions
+     *  thrown by @p callback propagate, dropping the rest of the current
+     *  batch of up to NetworkSessionOptions::receive_batch_messages datagrams.
+     *
+     *  A datagram larger than the receive buffer grows the buffer to fit
+     *  it, so one oversized message never holds up the ones queued behind it.
+     *
+     *  @param callback            Invoked once per message.
+     *  @param[out] out_delivered  Optional; receives the number of messages delivered.
+     *  @return SUCCESS on success.
+     *  @retval ERR_INTERNAL_ERROR  The receive buffer could not grow to fit the next
+     *                              datagram; it stays queued.
+     */
+    template <typename Callback>
+    int drain(Callback &&callback, std::size_t *out_delivered = nullptr) {
+        if (out_delivered != nullptr) {
+            *out_delivered = 0;
+        }
+        int status = reserveReceiveBuffers();
+        if (status != SUCCESS) {
+            return status;
+        }
+
+        for (;;) {
+            std::uint32_t count = 0;
+            status = ::goud_network_receive_batch(context_,
+                                                  network_,
+                                                  receive_buffer_.data(),
+                                                  static_cast<std::uint32_t>(receive_buffer_.size()),
+                                                  messages_.data(),
+                                                  static_cast<std::uint32_t>(messages_.size()),
+                                                  &count);
+            if (status == ERR_INVALID_STATE) {
+                status = growReceiveBuffer();
+                if (status == SUCCESS) {
+                    continue;
+                }
+            }
+            if (status != SUCCESS || count == 0) {
+                return status;
+            }
+            for (std::uint32_t i = 0; i < count; ++i) {
+                const ::goud_network_message &message = messages_[i];
+                const std::uint8_t *data = receive_buffer_.data() + message.offset;
+                std::size_t delivered = deliver(message.peer_id, data, message.len, callback);
+                if (out_delivered != nullptr) {
+                    *out_delivered += delivered;
+                }
+            }
+        }
+    }
+
+    /** @brief Traffic exchanged with @p peer_id through this session (zeros if none). */
+    PeerTraffic peerTraffic(std::uint64_t peer_id) const noexcept {
+        auto it = peers_.find(peer_id);
+        return it != peers_.end() ? it->second : PeerTraffic{};
+    }
+
+    /** @brief Read the transport's aggregate counters, including framing and protocol overhead.
+     *  @return SUCCESS on success.
+     */
+    int stats(NetworkStats &out_stats) const noexcept {
+        return ::goud_network_stats_get(context_, network_, &out_stats);
+    }
+
+private:
+    struct PendingDatagram {
+        std::uint64_t peer_id = 0;
+        std::uint8_t channel = 0;
+        std::uint32_t messages = 0;
+        std::uint64_t payload_bytes = 0;
+        std::vector<std::uint8_t> bytes;
+    };
+
+    void reset() noexcept {
+        if (valid()) {
+            (void)flush();
+            (void)::goud_network_close(context_, network_);
+        }
+        network_ = 0;
+        pending_.clear();
+        peers_.clear();
+    }
+
+    int countSent(std::uint64_t peer_id, std::uint64_t bytes, std::uint64_t messages) noexcept {
+        try {
+            PeerTraffic &traffic = peers_[peer_id];
+            traffic.bytes_sent += bytes;
+            traffic.messages_sent += messages;
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+        return SUCCESS;
+    }
+
+    PendingDatagram *pendingFor(std::uint64_t peer_id, std::uint8_t channel) noexcept {
+        for (PendingDatagram &pending : pending_) {
+            if (pending.peer_id == peer_id && pending.channel == channel) {
+                return &pending;
+            }
+        }
+        try {
+            pending_.emplace_back();
+        } catch (const std::bad_alloc &) {
+            return nullptr;
+        }
+        pending_.back().peer_id = peer_id;
+        pending_.back().channel = channel;
+        return &pending_.back();
+    }
+
+    static int appendRecord(PendingDatagram &pending, const OutgoingMessage &message) noexcept {
+        try {
+            detail::appendNetworkRecord(pending.bytes, message.data, message.size);
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+        pending.messages += 1;
+        pending.payload_bytes += message.size;
+        return SUCCESS;
+    }
+
+    int sendPending(PendingDatagram &pending) noexcept {
+        int status = ::goud_network_send_bytes(
+            context_, network_, pending.peer_id, pending.bytes.data(), pending.bytes.size(), pending.channel);
+        if (status == SUCCESS) {
+            status = countSent(pending.peer_id, pending.payload_bytes, pending.messages);
+        }
+        pending.bytes.clear();
+        pending.messages = 0;
+        pending.payload_bytes = 0;
+        return status;
+    }
+
+    int reserveReceiveBuffers() noexcept {
+        std::size_t buffer_bytes = options_.receive_buffer_bytes;
+        if (buffer_bytes == 0 || buffer_bytes > std::numeric_limits<std::uint32_t>::max() ||
+            options_.receive_batch_messages == 0) {
+            return ERR_INVALID_STATE;
+        }
+        try {
+            if (receive_buffer_.size() < buffer_bytes) {
+                receive_buffer_.resize(buffer_bytes);
+            }
+            messages_.resize(options_.receive_batch_messages);
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+        return SUCCESS;
+    }
+
+    // Called when a receive fails: grows the buffer if the next datagram
+    // is what did not fit, and otherwise reports ERR_INVALID_STATE.
+    int growReceiveBuffer() noexcept {
+        std::uint64_t peer_id = 0;
+        std::uint32_t size = 0;
+        int status = ::goud_network_next_message_size(context_, network_, &peer_id, &size);
+        if (status != SUCCESS) {
+            return status;
+        }
+        if (size <= receive_buffer_.size()) {
+            return ERR_INVALID_STATE;
+        }
+        try {
+            receive_buffer_.resize(size);
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+        return SUCCESS;
+    }
+
+    template <typename Callback>
+    std::size_t deliver(std::uint64_t peer_id, const std::uint8_t *data, std::size_t size, Callback &callback) {
+        PeerTraffic &traffic = peers_[peer_id];
+        if (!detail::isNetworkBatch(data, size)) {
+            traffic.bytes_received += size;
+            traffic.messages_received += 1;
+            callback(peer_id, data, size);
+            return 1;
+        }
+
+        return detail::forEachNetworkRecord(data, size, [&](const std::uint8_t *record, std::size_t len) {
+            traffic.bytes_received += len;
+            traffic.messages_received += 1;
+            callback(peer_id, record, len);
+        });
+    }
+
+    ::goud_context context_ = ::goud_context_invalid();
+    ::goud_network network_ = 0;
+    std::uint64_t server_peer_ = 0;
+    NetworkSessionOptions options_;
+    std::vector<std::uint8_t> receive_buffer_;
+    std::vector<::goud_network_message> messages_;
+    std::vector<PendingDatagram> pending_;
+    std::vector<std::uint8_t> send_buffer_;
+    std::unordered_map<std::uint64_t, PeerTraffic> peers_;
+};
+
+}  // namespace goud
+
+#endif
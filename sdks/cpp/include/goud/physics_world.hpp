@@ -0,0 +1,344 @@
+#ifndef GOUD_CPP_PHYSICS_WORLD_HPP
+#define GOUD_CPP_PHYSICS_WORLD_HPP
+
+/** @file physics_world.hpp
+ *  @brief RAII wrapper for a context's 2D physics world.
+ *
+ *  Syncing rendered sprites with physics one body at a time costs several
+ *  FFI calls per body per tick.  PhysicsWorld reads positions, velocities,
+ *  and rotations for a whole span of bodies, and writes velocities back, in
+ *  one call each, and copies a step's collision events in one more.
+ *  Batched raycasts and box overlaps answer thousands of queries in one
+ *  call, spread across the engine's worker threads.
+ */
+
+#include <goud/goud.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+namespace goud {
+
+/** @brief Collision between two bodies: body_a, body_b, kind (0 = Enter, 1 = Stay, 2 = Exit). */
+using CollisionEvent = ::goud_collision_event;
+
+/** @brief Ray for PhysicsWorld::raycastBatch(). */
+using Ray = ::goud_ray;
+
+/** @brief Result of one ray; @c hit is 0 for a miss. */
+using RayHit = ::goud_raycast_hit;
+
+/** @brief Structure-of-arrays body state filled by PhysicsWorld::readBodies().
+ *
+ *  Element @c i of each array belongs to the @c i-th requested body.  The
+ *  vectors keep their capacity between reads, so a BodyStates reused every
+ *  tick stops allocating once it has grown to the largest span.
+ */
+struct BodyStates {
+    std::vector<::goud_vec2> positions;   /**< World positions. */
+    std::vector<::goud_vec2> velocities;  /**< Linear velocities. */
+    std::vector<float> rotations;         /**< Angles in radians. */
+};
+
+/** @brief RAII wrapper for a context's 2D physics world.
+ *
+ *  Move-only.  The world is destroyed on destruction, so a PhysicsWorld
+ *  must not outlive the Context it was created in.  Body type codes are
+ *  0 = static, 1 = dynamic, 2 = kinematic; shape codes are 0 = circle,
+ *  1 = box, 2 = capsule.
+ */
+class PhysicsWorld {
+public:
+    /** @brief Physics backend selection. */
+    enum class Backend : std::uint32_t { Default = 0, Rapier = 1, Simple = 2 };
+
+    /** @brief Construct an invalid world. */
+    PhysicsWorld() noexcept = default;
+
+    /** @brief Destroy the world. */
+    ~PhysicsWorld() noexcept {
+        reset();
+    }
+
+    PhysicsWorld(const PhysicsWorld &) = delete;
+    PhysicsWorld &operator=(const PhysicsWorld &) = delete;
+
+    /** @brief Move-construct from another world. */
+    PhysicsWorld(PhysicsWorld &&other) noexcept
+        : context_(other.release()) {}
+
+    /** @brief Move-assign from another world. */
+    PhysicsWorld &operator=(PhysicsWorld &&other) noexcept {
+        if (this != &other) {
+            reset();
+            context_ = other.release();
+        }
+        return *this;
+    }
+
+    /** @brief Create the physics world of @p context.
+     *  @param context          Context that owns the world.
+     *  @param gravity          Gravity vector.
+     *  @param backend          Physics backend to use.
+     *  @param[out] out_status  Optional pointer to receive the status code.
+     *  @return A valid PhysicsWorld on success.
+     */
+    static PhysicsWorld create(const Context &context,
+                               ::goud_vec2 gravity,
+                               Backend backend = Backend::Default,
+                               int *out_status = nullptr) noexcept {
+        PhysicsWorld world;
+        int status = ::goud_physics_world_create(
+            context.raw(), gravity, static_cast<std::uint32_t>(backend));
+        if (status == SUCCESS) {
+            world.context_ = context.raw();
+        }
+        if (out_status != nullptr) {
+            *out_status = status;
+        }
+        return world;
+    }
+
+    /** @brief Check whether the world exists. */
+    bool valid() const noexcept {
+        return ::goud_context_valid(context_);
+    }
+
+    /** @brief Advance the simulation by @p dt seconds.
+     *  @return SUCCESS on success.
+     */
+    int step(float dt) noexcept {
+        return ::goud_physics_world_step(context_, dt);
+    }
+
+    /** @brief Enable or disable deterministic stepping for rollback.
+     *
+     *  While enabled, step() advances by the fixed timestep whatever @p dt
+     *  it is given, and collision events are reported in a stable order.
+     *
+     *  @return SUCCESS on success.
+     */
+    int setDeterministic(bool enabled) noexcept {
+        return ::goud_physics_world_set_deterministic(context_, enabled);
+    }
+
+    /** @brief Add a rigid body.
+     *  @param body_type      0 = static, 1 = dynamic, 2 = kinematic.
+     *  @param position       Initial position.
+     *  @param[out] out_body  Receives the body handle.
+     *  @param gravity_scale  Multiplier applied to world gravity.
+     *  @return SUCCESS on success.
+     */
+    int addBody(std::uint32_t body_type,
+                ::goud_vec2 position,
+                ::goud_physics_body &out_body,
+                float gravity_scale = 1.0f) noexcept {
+        return ::goud_physics_body_add(context_, body_type, position, gravity_scale, &out_body);
+    }
+
+    /** @brief Attach a collider to @p body.
+     *  @param body         Body returned by addBody().
+     *  @param shape_type   0 = circle, 1 = box, 2 = capsule.
+     *  @param size         Box width and height.
+     *  @param radius       Circle or capsule radius.
+     *  @param friction     Friction coefficient.
+     *  @param restitution  Bounciness.
+     *  @return SUCCESS on success.
+     */
+    int addCollider(::goud_physics_body body,
+                    std::uint32_t shape_type,
+                    ::goud_vec2 size,
+                    float radius,
+                    float friction = 0.5f,
+                    float restitution = 0.0f) noexcept {
+        return ::goud_physics_collider_add(
+            context_, body, shape_type, size, radius, friction, restitution);
+    }
+
+    /** @brief Remove @p body and its colliders.
+     *  @return SUCCESS on success.
+     */
+    int removeBody(::goud_physics_body body) noexcept {
+        return ::goud_physics_body_remove(context_, body);
+    }
+
+    /** @brief Read the state of @p count bodies in one FFI call.
+     *
+     *  Any output may be nullptr to skip it.  Slots of stale handles are
+     *  zeroed.
+     *
+     *  @param bodies               Array of @p count body handles.
+     *  @param count                Number of bodies.
+     *  @param[out] out_positions   Optional; receives @p count positions.
+     *  @param[out] out_velocities  Optional; receives @p count velocities.
+     *  @param[out] out_rotations   Optional; receives @p count angles in radians.
+     *  @return SUCCESS when every body was read.
+     *  @retval ERR_INVALID_HANDLE  At least one handle was stale.
+     */
+    int readBodies(const ::goud_physics_body *bodies,
+                   std::uint32_t count,
+                   ::goud_vec2 *out_positions,
+                   ::goud_vec2 *out_velocities = nullptr,
+                   float *out_rotations = nullptr) const noexcept {
+        return ::goud_physics_read_bodies(
+            context_, bodies, count, out_positions, out_velocities, out_rotations);
+    }
+
+    /** @brief Read the state of @p count bodies into @p out_states.
+     *
+     *  Each array of @p out_states is resized to @p count.
+     *
+     *  @param bodies           Array of @p count body handles.
+     *  @param count            Number of bodies.
+     *  @param[out] out_states  Receives positions, velocities, and rotations.
+     *  @return SUCCESS when every body was read.
+     *  @retval ERR_INTERNAL_ERROR  The arrays could not be resized.
+     */
+    int readBodies(const ::goud_physics_body *bodies,
+                   std::uint32_t count,
+                   BodyStates &out_states) const noexcept {
+        try {
+            out_states.positions.resize(count);
+            out_states.velocities.resize(count);
+            out_states.rotations.resize(count);
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+        return readBodies(bodies,
+                          count,
+                          out_states.positions.data(),
+                          out_states.velocities.data(),
+                          out_states.rotations.data());
+    }
+
+    /** @brief Set the linear velocity of @p count bodies in one FFI call.
+     *  @param bodies      Array of @p count body handles.
+     *  @param velocities  One velocity per body.
+     *  @param count       Number of bodies.
+     *  @return SUCCESS when every body was updated.
+     *  @retval ERR_INVALID_HANDLE  At least one handle was stale.
+     */
+    int setVelocities(const ::goud_physics_body *bodies,
+                      const ::goud_vec2 *velocities,
+                      std::uint32_t count) noexcept {
+        return ::goud_physics_write_velocities(context_, bodies, velocities, count);
+    }
+
+    /** @brief Copy the collision events of the last step into @p out_events.
+     *
+     *  @p out_events is overwritten; reusing one vector every tick avoids
+     *  allocating once it has grown.  Only events where either body has a
+     *  collider on a layer in @p layer_mask are kept, using the layers given
+     *  to goud_physics_add_collider_ex().  Events stay readable until the
+     *  next step.
+     *
+     *  @param[out] out_events  Receives the events in step order.
+     *  @param layer_mask       Collision layers to keep.
+     *  @return SUCCESS on success.
+     *  @retval ERR_INTERNAL_ERROR  @p out_events could not be resized.
+     */
+    int drainCollisionEvents(std::vector<CollisionEvent> &out_events,
+                             std::uint32_t layer_mask = UINT32_MAX) const noexcept {
+        std::uint32_t count = 0;
+        int status = ::goud_physics_collision_event_total(context_, &count);
+        if (status != SUCCESS) {
+            out_events.clear();
+            return status;
+        }
+        try {
+            out_events.resize(count);
+        } catch (const std::bad_alloc &) {
+            out_events.clear();
+            return ERR_INTERNAL_ERROR;
+        }
+        std::uint32_t written = 0;
+        status = ::goud_physics_copy_collision_events(
+            context_, layer_mask, out_events.data(), count, &written);
+        out_events.resize(written);
+        return status;
+    }
+
+    /** @brief Cast @p count rays in one FFI call.
+     *  @param rays              Array of @p count rays.
+     *  @param count             Number of rays.
+     *  @param layer_mask        Collision layers to test.
+     *  @param[out] out_hits     Buffer of @p count results; misses have @c hit == 0.
+     *  @param[out] out_hit_count  Optional; receives the number of rays that hit.
+     *  @return SUCCESS on success.
+     *  @retval ERR_INVALID_STATE  A buffer is NULL, or @p count exceeds UINT32_MAX.
+     */
+    int raycastBatch(const Ray *rays,
+                     std::size_t count,
+                     std::uint32_t layer_mask,
+                     RayHit *out_hits,
+                     std::uint32_t *out_hit_count = nullptr) const noexcept {
+        if (count > UINT32_MAX) {
+            return ERR_INVALID_STATE;
+        }
+        return ::goud_physics_raycast_many(context_,
+                                           rays,
+                                           static_cast<std::uint32_t>(count),
+                                           layer_mask,
+                                           out_hits,
+                                           out_hit_count);
+    }
+
+    /** @brief Test @p count rectangles for overlap in one FFI call.
+     *  @param rects              Array of @p count rectangles (minimum corner and size).
+     *  @param count              Number of rectangles.
+     *  @param layer_mask         Collision layers to test.
+     *  @param[out] out_bodies    Buffer of @p count bodies; 0 where nothing overlaps.
+     *  @param[out] out_overlaps  Optional; receives the number of overlapping rectangles.
+     *  @return SUCCESS on success.
+     *  @retval ERR_INVALID_STATE  A buffer is NULL, or @p count exceeds UINT32_MAX.
+     */
+    int overlapBatch(const ::goud_rect *rects,
+                     std::size_t count,
+                     std::uint32_t layer_mask,
+                     ::goud_physics_body *out_bodies,
+                     std::uint32_t *out_overlaps = nullptr) const noexcept {
+        if (count > UINT32_MAX) {
+            return ERR_INVALID_STATE;
+        }
+        return ::goud_physics_overlap_rects(context_,
+                                            rects,
+                                            static_cast<std::uint32_t>(count),
+                                            layer_mask,
+                                            out_bodies,
+                                            out_overlaps);
+    }
+
+    /** @brief Access the context that owns the world. */
+    ::goud_context raw() const noexcept {
+        return context_;
+    }
+
+    /** @brief Release ownership of the world without destroying it.
+     *  @return The owning context.  The wrapper is left invalid.
+     */
+    ::goud_context release() noexcept {
+        ::goud_context context = context_;
+        context_ = ::goud_context_invalid();
+        return context;
+    }
+
+    /** @brief Destroy the world and reset to invalid.
+     *  @return SUCCESS on success, or if the world was already invalid.
+     */
+    int reset() noexcept {
+        if (!valid()) {
+            context_ = ::goud_context_invalid();
+            return SUCCESS;
+        }
+        return ::goud_physics_world_destroy(release());
+    }
+
+private:
+    ::goud_context context_ = ::goud_context_invalid();
+};
+
+}  // namespace goud
+
+#endif
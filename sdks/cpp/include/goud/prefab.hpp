@@ -0,0 +1,113 @@
+#ifndef GOUD_CPP_PREFAB_HPP
+#define GOUD_CPP_PREFAB_HPP
+
+/** @file prefab.hpp
+ *  @brief Batched prefab instantiation from a template entity hierarchy.
+ *
+ *  A Prefab clones a template hierarchy many times in one engine call, so a
+ *  wave spawner creating hundreds of enemies pays for one FFI call instead
+ *  of one goud_entity_clone_recursive() per enemy.
+ */
+
+#include <goud/goud.hpp>
+
+#include <cstdint>
+#include <new>
+#include <vector>
+
+namespace goud {
+
+/** @brief A template entity hierarchy that can be instantiated in bulk.
+ *
+ *  The template is an ordinary entity in the World, usually spawned once at
+ *  level load and kept out of gameplay systems.  Every instance copies the
+ *  template's cloneable built-in components and FFI components down the
+ *  whole hierarchy; instance roots have no parent.  The Prefab does not own
+ *  the template or its instances, and the Context must outlive it.
+ */
+class Prefab {
+public:
+    /** @brief Construct an invalid prefab. */
+    Prefab() noexcept = default;
+
+    /** @brief Bind the hierarchy rooted at @p root in @p context.
+     *  @param context  Context that owns the World.
+     *  @param root     Root entity of the template hierarchy.
+     */
+    Prefab(const Context &context, std::uint64_t root) noexcept
+        : Prefab(context.raw(), root) {}
+
+    /** @brief Bind the hierarchy rooted at @p root in a raw context handle.
+     *  @param context  Raw context handle.
+     *  @param root     Root entity of the template hierarchy.
+     */
+    Prefab(::goud_context context, std::uint64_t root) noexcept
+        : context_(context),
+          root_(root) {}
+
+    /** @brief Check whether the context is valid and the template root is alive. */
+    bool valid() const noexcept {
+        return root_ != GOUD_INVALID_ENTITY_ID && ::goud_context_valid(context_) &&
+               ::goud_entity_alive(context_, root_);
+    }
+
+    /** @brief Root entity of the template hierarchy. */
+    std::uint64_t root() const noexcept {
+        return root_;
+    }
+
+    /** @brief Create @p count instances into a caller buffer.
+     *  @param count              Number of instances to create.
+     *  @param[out] out_entities  Buffer of at least @p count instance roots.
+     *  @param[out] out_spawned   Optional; receives the number of instances created.
+     *  @return SUCCESS when every instance was created.
+     *  @retval ERR_INVALID_STATE  @p out_entities is NULL with a non-zero @p count.
+     */
+    int instantiate(std::uint32_t count,
+                    std::uint64_t *out_entities,
+                    std::uint32_t *out_spawned = nullptr) noexcept {
+        std::uint32_t spawned = 0;
+        int status = ::goud_entity_instantiate_many(context_, root_, count, out_entities, &spawned);
+        instantiated_ += spawned;
+        if (out_spawned != nullptr) {
+            *out_spawned = spawned;
+        }
+        return status;
+    }
+
+    /** @brief Create @p count instances, replacing the contents of @p out_entities.
+     *
+     *  The vector keeps its capacity, so reusing one across waves does not
+     *  allocate.  On failure it holds only the instances created.
+     *
+     *  @param count              Number of instances to create.
+     *  @param[out] out_entities  Receives the instance roots.
+     *  @return SUCCESS when every instance was created.
+     */
+    int instantiate(std::uint32_t count, std::vector<std::uint64_t> &out_entities) noexcept {
+        try {
+            out_entities.resize(count);
+        } catch (const std::bad_alloc &) {
+            out_entities.clear();
+            return ERR_INTERNAL_ERROR;
+        }
+        std::uint32_t spawned = 0;
+        int status = instantiate(count, out_entities.data(), &spawned);
+        out_entities.resize(spawned);
+        return status;
+    }
+
+    /** @brief Total number of instances created through this prefab. */
+    std::uint64_t instantiated() const noexcept {
+        return instantiated_;
+    }
+
+private:
+    ::goud_context context_ = ::goud_context_invalid();
+    std::uint64_t root_ = GOUD_INVALID_ENTITY_ID;
+    std::uint64_t instantiated_ = 0;
+};
+
+}  // namespace goud
+
+#endif
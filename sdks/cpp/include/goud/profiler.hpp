@@ -0,0 +1,439 @@
+#ifndef GOUD_CPP_PROFILER_HPP
+#define GOUD_CPP_PROFILER_HPP
+
+/** @file profiler.hpp
+ *  @brief Gameplay profiling scopes merged with the engine's frame phases.
+ *
+ *  GOUD_PROFILE_SCOPE("ai.update") times the enclosing block into a
+ *  lock-free ring buffer owned by the calling thread.  Profiler::endFrame()
+ *  drains every thread's buffer, attaches the engine's
+ *  goud_frame_phase_timings for the frame, and keeps a short history that
+ *  writeChromeTrace() exports for chrome://tracing or ui.perfetto.dev.
+ *
+ *  Profiling is compiled in only when GOUD_PROFILING is defined to 1 (the
+ *  GOUD_PROFILING CMake option).  Otherwise GOUD_PROFILE_SCOPE expands to
+ *  nothing and every Profiler method returns immediately.
+ */
+
+#include <goud/goud.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <vector>
+
+#ifndef GOUD_PROFILING
+#define GOUD_PROFILING 0
+#endif
+
+namespace goud {
+
+/** @brief One completed profiling scope. */
+struct ProfileEvent {
+    const char *name = nullptr;  /**< Scope name (a string with static lifetime). */
+    std::uint64_t begin_ns = 0;  /**< Start, in Profiler::now() nanoseconds. */
+    std::uint64_t end_ns = 0;    /**< End, in Profiler::now() nanoseconds. */
+    std::uint32_t thread = 0;    /**< Profiler thread index (0 is the first thread seen). */
+};
+
+/** @brief Everything recorded for one frame. */
+struct ProfileFrame {
+    std::uint64_t index = 0;                  /**< Frame number, starting at 0. */
+    std::uint64_t begin_ns = 0;               /**< Frame start (previous endFrame() or beginFrame()). */
+    std::uint64_t end_ns = 0;                 /**< Time endFrame() ran. */
+    std::vector<ProfileEvent> events;         /**< Scopes that ended during the frame. */
+    ::goud_frame_phase_timings phases{};      /**< Engine phase timings for the frame. */
+    bool has_phases = false;                  /**< True when @ref phases was read successfully. */
+    std::uint64_t dropped = 0;                /**< Scopes lost to full ring buffers. */
+};
+
+/** @brief Collects GOUD_PROFILE_SCOPE timings from every thread.
+ *
+ *  Each thread writes into its own single-producer ring buffer, so
+ *  recording a scope takes no lock.  endFrame() is the single consumer and
+ *  must be called from one thread, normally the one running the game loop.
+ *  When a ring fills before endFrame() drains it, new scopes are dropped and
+ *  counted in ProfileFrame::dropped.
+ */
+class Profiler {
+public:
+    /** @brief True when profiling is compiled in. */
+    static constexpr bool enabled = GOUD_PROFILING != 0;
+
+    /** @brief Scopes each thread can hold between endFrame() calls. */
+    static constexpr std::size_t kRingCapacity = 8192;
+
+    /** @brief Default number of frames kept for export. */
+    static constexpr std::size_t kDefaultHistory = 300;
+
+    /** @brief The process-wide profiler. */
+    static Profiler &instance() noexcept {
+        static Profiler profiler;
+        return profiler;
+    }
+
+    Profiler(const Profiler &) = delete;
+    Profiler &operator=(const Profiler &) = delete;
+
+    /** @brief Nanoseconds on the profiler's monotonic clock. */
+    static std::uint64_t now() noexcept {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    /** @brief Record a completed scope on the calling thread.
+     *  @param name      Scope name; must outlive the profiler (use a string literal).
+     *  @param begin_ns  Start time from now().
+     *  @param end_ns    End time from now().
+     */
+    void record(const char *name, std::uint64_t begin_ns, std::uint64_t end_ns) noexcept {
+        if (!enabled) {
+            return;
+        }
+        ThreadRing *ring = threadRing();
+        if (ring != nullptr) {
+            ring->push(ProfileEvent{ name, begin_ns, end_ns, ring->thread });
+        }
+    }
+
+    /** @brief Name the calling thread in exported traces.
+     *  @param name  Thread name; must outlive the profiler.
+     */
+    void setThreadName(const char *name) noexcept {
+        if (!enabled) {
+            return;
+        }
+        ThreadRing *ring = threadRing();
+        if (ring != nullptr) {
+            ring->name.store(name, std::memory_order_release);
+        }
+    }
+
+    /** @brief Mark the start of a frame.
+     *
+     *  Optional: without it, a frame starts where the previous endFrame()
+     *  finished.
+     */
+    void beginFrame() noexcept {
+        if (!enabled) {
+            return;
+        }
+        frame_begin_ns_ = now();
+    }
+
+    /** @brief Close the frame: drain every thread's scopes and read engine phases.
+     *
+     *  Call once per frame on the game-loop thread, after the context's
+     *  endFrame() so the engine's timings cover the same frame.
+     *
+     *  @return SUCCESS, or ERR_INTERNAL_ERROR if the frame could not be stored.
+     */
+    int endFrame() noexcept {
+        if (!enabled) {
+            return SUCCESS;
+        }
+        std::uint64_t end_ns = now();
+        try {
+            ProfileFrame frame = recycledFrame();
+            frame.index = frame_index_++;
+            frame.begin_ns = frame_begin_ns_ != 0 ? frame_begin_ns_ : end_ns;
+            frame.end_ns = end_ns;
+            frame.has_phases = ::goud_renderer_phase_timings(&frame.phases) == SUCCESS;
+            {
+                std::lock_guard<std::mutex> lock(rings_mutex_);
+                for (const std::shared_ptr<ThreadRing> &ring : rings_) {
+                    frame.dropped += ring->drain(frame.events);
+                }
+            }
+            std::sort(frame.events.begin(), frame.events.end(),
+                      [](const ProfileEvent &a, const ProfileEvent &b) { return a.begin_ns < b.begin_ns; });
+            frames_.push_back(std::move(frame));
+            while (frames_.size() > history_) {
+                spare_.swap(frames_.front().events);
+                frames_.pop_front();
+            }
+        } catch (const std::exception &) {
+            frame_begin_ns_ = end_ns;
+            return ERR_INTERNAL_ERROR;
+        }
+        frame_begin_ns_ = end_ns;
+        return SUCCESS;
+    }
+
+    /** @brief Most recent frame, or nullptr before the first endFrame(). */
+    const ProfileFrame *lastFrame() const noexcept {
+        return frames_.empty() ? nullptr : &frames_.back();
+    }
+
+    /** @brief Frames currently kept, oldest first. */
+    const std::deque<ProfileFrame> &frames() const noexcept {
+        return frames_;
+    }
+
+    /** @brief Set how many frames are kept for export (at least 1). */
+    void setHistory(std::size_t frames) noexcept {
+        history_ = std::max<std::size_t>(frames, 1);
+        while (frames_.size() > history_) {
+            frames_.pop_front();
+        }
+    }
+
+    /** @brief Drop all kept frames and any scopes not yet drained. */
+    void clear() noexcept {
+        frames_.clear();
+        std::lock_guard<std::mutex> lock(rings_mutex_);
+        for (const std::shared_ptr<ThreadRing> &ring : rings_) {
+            ring->skip();
+        }
+    }
+
+    /** @brief Write the kept frames as a Chrome trace (JSON) file.
+     *
+     *  Gameplay scopes appear on their own threads.  Engine phases appear on
+     *  an "engine phases" track, laid end to end from each frame's start:
+     *  their durations are exact, their offsets within the frame are not.
+     *
+     *  @param path  Output file path.
+     *  @return SUCCESS on success.
+     *  @retval ERR_INVALID_STATE         @p path is NULL or profiling is compiled out.
+     *  @retval ERR_RESOURCE_LOAD_FAILED  The file could not be written.
+     */
+    int writeChromeTrace(const char *path) const noexcept {
+        if (!enabled || path == nullptr) {
+            return ERR_INVALID_STATE;
+        }
+        std::FILE *file = std::fopen(path, "wb");
+        if (file == nullptr) {
+            return ERR_RESOURCE_LOAD_FAILED;
+        }
+        bool ok = false;
+        try {
+            ok = writeTrace(file);
+        } catch (const std::exception &) {
+            ok = false;
+        }
+        ok = std::fclose(file) == 0 && ok;
+        return ok ? SUCCESS : ERR_RESOURCE_LOAD_FAILED;
+    }
+
+private:
+    /** Single-producer / single-consumer ring of completed scopes. */
+    struct ThreadRing {
+        explicit ThreadRing(std::uint32_t index) : events(kRingCapacity), thread(index) {}
+
+        void push(const ProfileEvent &event) noexcept {
+            std::uint64_t head = head_.load(std::memory_order_relaxed);
+            if (head - tail_.load(std::memory_order_acquire) >= kRingCapacity) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            events[head % kRingCapacity] = event;
+            head_.store(head + 1, std::memory_order_release);
+        }
+
+        /** Append every pending event to @p out; returns the drop count. */
+        std::uint64_t drain(std::vector<ProfileEvent> &out) {
+            std::uint64_t tail = tail_.load(std::memory_order_relaxed);
+            std::uint64_t head = head_.load(std::memory_order_acquire);
+            out.reserve(out.size() + static_cast<std::size_t>(head - tail));
+            for (; tail != head; ++tail) {
+                out.push_back(events[tail % kRingCapacity]);
+            }
+            tail_.store(tail, std::memory_order_release);
+            return dropped_.exchange(0, std::memory_order_relaxed);
+        }
+
+        void skip() noexcept {
+            tail_.store(head_.load(std::memory_order_acquire), std::memory_order_release);
+            dropped_.store(0, std::memory_order_relaxed);
+        }
+
+        std::vector<ProfileEvent> events;
+        std::uint32_t thread;
+        std::atomic<const char *> name{ nullptr };
+
+    private:
+        std::atomic<std::uint64_t> head_{ 0 };
+        std::atomic<std::uint64_t> tail_{ 0 };
+        std::atomic<std::uint64_t> dropped_{ 0 };
+    };
+
+    Profiler() noexcept = default;
+
+    /** The calling thread's ring, registered on first use; nullptr if out of memory. */
+    ThreadRing *threadRing() noexcept {
+        thread_local std::shared_ptr<ThreadRing> ring;
+        if (ring == nullptr) {
+            try {
+                std::lock_guard<std::mutex> lock(rings_mutex_);
+                auto created = std::make_shared<ThreadRing>(static_cast<std::uint32_t>(rings_.size()));
+                rings_.push_back(created);
+                ring = std::move(created);
+            } catch (const std::exception &) {
+                return nullptr;
+            }
+        }
+        return ring.get();
+    }
+
+    ProfileFrame recycledFrame() noexcept {
+        ProfileFrame frame;
+        frame.events.swap(spare_);
+        frame.events.clear();
+        return frame;
+    }
+
+    static void writeString(std::FILE *file, const char *text) {
+        std::fputc('"', file);
+        for (const char *c = text != nullptr ? text : "?"; *c != '\0'; ++c) {
+            unsigned char ch = static_cast<unsigned char>(*c);
+            if (ch == '"' || ch == '\\') {
+                std::fputc('\\', file);
+                std::fputc(ch, file);
+            } else if (ch < 0x20) {
+                std::fprintf(file, "\\u%04x", ch);
+            } else {
+                std::fputc(ch, file);
+            }
+        }
+        std::fputc('"', file);
+    }
+
+    static void writeSpan(std::FILE *file, bool &first, const char *name, std::uint64_t tid,
+                          double ts_us, double dur_us) {
+        std::fputs(first ? "\n" : ",\n", file);
+        first = false;
+        std::fputs("{\"name\":", file);
+        writeString(file, name);
+        std::fprintf(file, ",\"ph\":\"X\",\"pid\":1,\"tid\":%llu,\"ts\":%.3f,\"dur\":%.3f}",
+                     static_cast<unsigned long long>(tid), ts_us, dur_us);
+    }
+
+    static void writeThreadName(std::FILE *file, bool &first, std::uint64_t tid, const char *name) {
+        std::fputs(first ? "\n" : ",\n", file);
+        first = false;
+        std::fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%llu,\"args\":{\"name\":",
+                     static_cast<unsigned long long>(tid));
+        writeString(file, name);
+        std::fputs("}}", file);
+    }
+
+    bool writeTrace(std::FILE *file) const {
+        // Engine phases use tid 0; gameplay thread N uses tid N + 1.
+        struct Phase {
+            const char *name;
+            std::uint64_t ::goud_frame_phase_timings::*field;
+        };
+        static const Phase kPhases[] = {
+            { "engine.begin_frame", &::goud_frame_phase_timings::begin_frame_us },
+            { "engine.surface_acquire", &::goud_frame_phase_timings::surface_acquire_us },
+            { "engine.anim_eval", &::goud_frame_phase_timings::anim_eval_us },
+            { "engine.bone_pack", &::goud_frame_phase_timings::bone_pack_us },
+            { "engine.bone_upload", &::goud_frame_phase_timings::bone_upload_us },
+            { "engine.shadow_build", &::goud_frame_phase_timings::shadow_build_us },
+            { "engine.shadow_pass", &::goud_frame_phase_timings::shadow_pass_us },
+            { "engine.render3d_scene", &::goud_frame_phase_timings::render3d_scene_us },
+            { "engine.uniform_upload", &::goud_frame_phase_timings::uniform_upload_us },
+            { "engine.render_pass", &::goud_frame_phase_timings::render_pass_us },
+            { "engine.gpu_submit", &::goud_frame_phase_timings::gpu_submit_us },
+            { "engine.readback_stall", &::goud_frame_phase_timings::readback_stall_us },
+            { "engine.end_frame", &::goud_frame_phase_timings::end_frame_us },
+            { "engine.surface_present", &::goud_frame_phase_timings::surface_present_us },
+        };
+
+        std::uint64_t origin = frames_.empty() ? 0 : frames_.front().begin_ns;
+        for (const ProfileFrame &frame : frames_) {
+            for (const ProfileEvent &event : frame.events) {
+                origin = std::min(origin, event.begin_ns);
+            }
+        }
+        auto us = [origin](std::uint64_t ns) { return static_cast<double>(ns - origin) / 1000.0; };
+
+        std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", file);
+        bool first = true;
+        writeThreadName(file, first, 0, "engine phases");
+        {
+            std::lock_guard<std::mutex> lock(rings_mutex_);
+            for (const std::shared_ptr<ThreadRing> &ring : rings_) {
+                const char *name = ring->name.load(std::memory_order_acquire);
+                std::string fallback = "thread " + std::to_string(ring->thread);
+                writeThreadName(file, first, ring->thread + 1u, name != nullptr ? name : fallback.c_str());
+            }
+        }
+        for (const ProfileFrame &frame : frames_) {
+            std::string frame_name = "frame " + std::to_string(frame.index);
+            writeSpan(file, first, frame_name.c_str(), 0, us(frame.begin_ns),
+                      static_cast<double>(frame.end_ns - frame.begin_ns) / 1000.0);
+            if (frame.has_phases) {
+                double cursor = us(frame.begin_ns);
+                for (const Phase &phase : kPhases) {
+                    std::uint64_t duration = frame.phases.*phase.field;
+                    if (duration != 0) {
+                        writeSpan(file, first, phase.name, 0, cursor, static_cast<double>(duration));
+                        cursor += static_cast<double>(duration);
+                    }
+                }
+            }
+            for (const ProfileEvent &event : frame.events) {
+                writeSpan(file, first, event.name, event.thread + 1u, us(event.begin_ns),
+                          static_cast<double>(event.end_ns - event.begin_ns) / 1000.0);
+            }
+        }
+        std::fputs("\n]}\n", file);
+        return std::ferror(file) == 0;
+    }
+
+    mutable std::mutex rings_mutex_;
+    std::vector<std::shared_ptr<ThreadRing>> rings_;
+    std::deque<ProfileFrame> frames_;
+    std::vector<ProfileEvent> spare_;
+    std::size_t history_ = kDefaultHistory;
+    std::uint64_t frame_index_ = 0;
+    std::uint64_t frame_begin_ns_ = 0;
+};
+
+/** @brief RAII scope timer behind GOUD_PROFILE_SCOPE. */
+class ProfileScope {
+public:
+    /** @brief Start timing.
+     *  @param name  Scope name; must outlive the profiler (use a string literal).
+     */
+    explicit ProfileScope(const char *name) noexcept
+        : name_(name), begin_ns_(Profiler::now()) {}
+
+    /** @brief Stop timing and record the scope. */
+    ~ProfileScope() noexcept {
+        Profiler::instance().record(name_, begin_ns_, Profiler::now());
+    }
+
+    ProfileScope(const ProfileScope &) = delete;
+    ProfileScope &operator=(const ProfileScope &) = delete;
+
+private:
+    const char *name_;
+    std::uint64_t begin_ns_;
+};
+
+}  // namespace goud
+
+#define GOUD_PROFILE_CONCAT_INNER(a, b) a##b
+#define GOUD_PROFILE_CONCAT(a, b) GOUD_PROFILE_CONCAT_INNER(a, b)
+
+#if GOUD_PROFILING
+/** @brief Time the enclosing block under @p name (a string literal). */
+#define GOUD_PROFILE_SCOPE(name) \
+    ::goud::ProfileScope GOUD_PROFILE_CONCAT(goud_profile_scope_, __LINE__)(name)
+#else
+#define GOUD_PROFILE_SCOPE(name) static_cast<void>(0)
+#endif
+
+#endif
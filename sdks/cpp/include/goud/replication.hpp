@@ -0,0 +1,865 @@
+#ifndef GOUD_CPP_REPLICATION_HPP
+#define GOUD_CPP_REPLICATION_HPP
+
+/** @file replication.hpp
+ *  @brief Delta-compressed snapshot replication of ECS components.
+ *
+ *  Sending every replicated component every tick costs the full struct size
+ *  per entity per peer, most of it unchanged.  SnapshotSender captures the
+ *  tracked component types once per tick and encodes, for each peer, only
+ *  the fields that differ from the last snapshot that peer acknowledged.
+ *  Changed fields are bit-packed, and float fields can be quantized to a
+ *  fixed range and bit count.  SnapshotReceiver rebuilds each snapshot from
+ *  its baseline and produces the acknowledgements.
+ *
+ *  Deltas tolerate loss: a lost delta is simply never acknowledged, and the
+ *  next one is encoded against an older baseline.  Send them unreliably
+ *  and the acknowledgements on any channel.
+ */
+
+#include <goud/component_view.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace goud {
+
+/** @brief How each field of a replicated component is compared and encoded.
+ *
+ *  Fields are compared independently: a changed field costs one mask bit
+ *  plus its encoded size, an unchanged one only its mask bit.  Bytes not
+ *  covered by a field are not replicated and read as zero on the receiver.
+ *  The builder methods may throw std::bad_alloc.
+ */
+class ReplicationSchema {
+public:
+    /** @brief One field of the schema. */
+    struct Field {
+        std::uint32_t offset = 0;  /**< Byte offset in the component. */
+        std::uint32_t size = 0;    /**< Byte size (4 for quantized fields). */
+        std::uint8_t bits = 0;     /**< Quantized bit count; 0 for raw bytes. */
+        float min = 0.0f;          /**< Quantized range minimum. */
+        float max = 0.0f;          /**< Quantized range maximum. */
+    };
+
+    /** @brief Start an empty schema for a component of @p component_size bytes. */
+    explicit ReplicationSchema(std::size_t component_size) noexcept
+        : component_size_(component_size) {}
+
+    /** @brief Schema splitting the whole component into raw 4-byte words. */
+    static ReplicationSchema words(std::size_t component_size) {
+        ReplicationSchema schema(component_size);
+        for (std::size_t offset = 0; offset < component_size; offset += 4) {
+            schema.raw(offset, std::min<std::size_t>(4, component_size - offset));
+        }
+        return schema;
+    }
+
+    /** @brief Replicate @p size bytes at @p offset exactly. */
+    ReplicationSchema &raw(std::size_t offset, std::size_t size) {
+        valid_ = valid_ && size > 0 && offset <= component_size_ && size <= component_size_ - offset;
+        fields_.push_back(Field{static_cast<std::uint32_t>(offset), static_cast<std::uint32_t>(size), 0, 0.0f, 0.0f});
+        return *this;
+    }
+
+    /** @brief Replicate the float at @p offset as a @p bits -bit fraction of [@p min, @p max].
+     *
+     *  Values outside the range (and NaN) are clamped.  The step is
+     *  (max - min) / (2^bits - 1).
+     */
+    ReplicationSchema &quantized(std::size_t offset, float min, float max, unsigned bits) {
+        valid_ = valid_ && bits >= 1 && bits <= 32 && max > min && offset <= component_size_ &&
+                 sizeof(float) <= component_size_ - offset;
+        fields_.push_back(Field{static_cast<std::uint32_t>(offset),
+                                static_cast<std::uint32_t>(sizeof(float)),
+                                static_cast<std::uint8_t>(bits),
+                                min,
+                                max});
+        return *this;
+    }
+
+    /** @brief Size of the component this schema describes. */
+    std::size_t componentSize() const noexcept {
+        return component_size_;
+    }
+
+    /** @brief Fields in declaration order. */
+    const std::vector<Field> &fields() const noexcept {
+        return fields_;
+    }
+
+    /** @brief False when a field lies outside the component or has an invalid range. */
+    bool valid() const noexcept {
+        return valid_ && !fields_.empty();
+    }
+
+private:
+    std::size_t component_size_;
+    std::vector<Field> fields_;
+    bool valid_ = true;
+};
+
+namespace detail {
+
+/** @brief Appends values of 1-64 bits, least significant bit first. */
+class BitWriter {
+public:
+    explicit BitWriter(std::vector<std::uint8_t> &out) noexcept
+        : out_(out) {}
+
+    void write(std::uint64_t value, unsigned bits) {
+        for (unsigned i = 0; i < bits; ++i) {
+            if (bit_ == 0) {
+                out_.push_back(0);
+            }
+            out_.back() |= static_cast<std::uint8_t>(((value >> i) & 1u) << bit_);
+            bit_ = (bit_ + 1) & 7u;
+        }
+    }
+
+    void writeVarint(std::uint64_t value) {
+        do {
+            std::uint64_t group = value & 0x7Fu;
+            value >>= 7;
+            write(group | (value != 0 ? 0x80u : 0u), 8);
+        } while (value != 0);
+    }
+
+private:
+    std::vector<std::uint8_t> &out_;
+    unsigned bit_ = 0;
+};
+
+/** @brief Reads what BitWriter wrote; ok() turns false on overrun. */
+class BitReader {
+public:
+    BitReader(const std::uint8_t *data, std::size_t size) noexcept
+        : data_(data), bits_(size * 8) {}
+
+    std::uint64_t read(unsigned bits) noexcept {
+        if (bits > bits_ - position_ || !ok_) {
+            ok_ = false;
+            return 0;
+        }
+        std::uint64_t value = 0;
+        for (unsigned i = 0; i < bits; ++i, ++position_) {
+            value |= static_cast<std::uint64_t>((data_[position_ >> 3] >> (position_ & 7u)) & 1u) << i;
+        }
+        return value;
+    }
+
+    std::uint64_t readVarint() noexcept {
+        std::uint64_t value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            std::uint64_t group = read(8);
+            value |= (group & 0x7Fu) << shift;
+            if ((group & 0x80u) == 0) {
+                return value;
+            }
+        }
+        ok_ = false;
+        return 0;
+    }
+
+    bool ok() const noexcept {
+        return ok_;
+    }
+
+    std::size_t remainingBits() const noexcept {
+        return bits_ - position_;
+    }
+
+private:
+    const std::uint8_t *data_;
+    std::size_t bits_;
+    std::size_t position_ = 0;
+    bool ok_ = true;
+};
+
+inline std::uint64_t quantize(float value, const ReplicationSchema::Field &field) noexcept {
+    std::uint64_t steps = (std::uint64_t{1} << field.bits) - 1;
+    if (!(value > field.min)) {
+        return 0;
+    }
+    if (!(value < field.max)) {
+        return steps;
+    }
+    double fraction = (static_cast<double>(value) - field.min) / (static_cast<double>(field.max) - field.min);
+    return static_cast<std::uint64_t>(std::llround(fraction * static_cast<double>(steps)));
+}
+
+inline float dequantize(std::uint64_t q, const ReplicationSchema::Field &field) noexcept {
+    std::uint64_t steps = (std::uint64_t{1} << field.bits) - 1;
+    double fraction = static_cast<double>(q) / static_cast<double>(steps);
+    return static_cast<float>(field.min + fraction * (static_cast<double>(field.max) - field.min));
+}
+
+/** @brief Components of one type in a snapshot, sorted by entity. */
+struct ReplicationTable {
+    std::vector<::goud_entity> entities;
+    std::vector<std::uint8_t> bytes;
+
+    const std::uint8_t *find(::goud_entity entity, std::size_t stride) const noexcept {
+        auto it = std::lower_bound(entities.begin(), entities.end(), entity);
+        if (it == entities.end() || *it != entity) {
+            return nullptr;
+        }
+        return bytes.data() + static_cast<std::size_t>(it - entities.begin()) * stride;
+    }
+};
+
+/** @brief One captured or rebuilt snapshot; sequence 0 marks an empty slot. */
+struct ReplicationSnapshot {
+    std::uint32_t sequence = 0;
+    std::vector<ReplicationTable> tables;
+};
+
+/** @brief Tracked type: engine type ID and its schema. */
+struct ReplicatedType {
+    std::uint64_t type_id;
+    ReplicationSchema schema;
+};
+
+inline constexpr std::uint8_t kReplicationDeltaTag = 'D';
+inline constexpr std::uint8_t kReplicationAckTag = 'A';
+
+/** @brief True when sequence @p a is newer than @p b, allowing for wrap-around. */
+inline bool sequenceNewer(std::uint32_t a, std::uint32_t b) noexcept {
+    return a != b && static_cast<std::uint32_t>(a - b) < 0x80000000u;
+}
+
+/** @brief Tracked types and the snapshot history shared by sender and receiver. */
+class ReplicationState {
+public:
+    explicit ReplicationState(std::size_t history) noexcept
+        : history_size_(history < 2 ? 2 : history) {}
+
+    template <typename T>
+    int trackType(const ReplicationSchema &schema) noexcept {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "replicated components must be trivially copyable");
+        if (!schema.valid() || schema.componentSize() != sizeof(T) || latest_ != 0) {
+            return ERR_INVALID_STATE;
+        }
+        try {
+            types_.push_back(ReplicatedType{ComponentTraits<T>::typeId(), schema});
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+        return SUCCESS;
+    }
+
+    template <typename T>
+    std::size_t typeIndex() const noexcept {
+        for (std::size_t i = 0; i < types_.size(); ++i) {
+            if (types_[i].type_id == ComponentTraits<T>::typeId()) {
+                return i;
+            }
+        }
+        return types_.size();
+    }
+
+    /** Snapshot with @p sequence, or nullptr once it has left the history. */
+    const ReplicationSnapshot *snapshot(std::uint32_t sequence) const noexcept {
+        if (sequence == 0 || history_.empty()) {
+            return nullptr;
+        }
+        const ReplicationSnapshot &slot = history_[sequence % history_.size()];
+        return slot.sequence == sequence ? &slot : nullptr;
+    }
+
+    /** Clear and return the slot for @p sequence. */
+    ReplicationSnapshot *claim(std::uint32_t sequence) noexcept {
+        try {
+            if (history_.empty()) {
+                history_.resize(history_size_);
+            }
+            ReplicationSnapshot &slot = history_[sequence % history_.size()];
+            slot.sequence = 0;
+            slot.tables.resize(types_.size());
+            for (ReplicationTable &table : slot.tables) {
+                table.entities.clear();
+                table.bytes.clear();
+            }
+            return &slot;
+        } catch (const std::bad_alloc &) {
+            return nullptr;
+        }
+    }
+
+protected:
+    std::size_t history_size_;
+    std::vector<ReplicatedType> types_;
+    std::vector<ReplicationSnapshot> history_;
+    std::uint32_t latest_ = 0;
+};
+
+}  // namespace detail
+
+/** @brief Captures tracked components each tick and encodes per-peer deltas.
+ *
+ *  Call track<T>() for every replicated type, then each tick capture()
+ *  (or beginSnapshot() plus captureTable()) and encodeDelta() once per
+ *  peer.  Feed the peer's acknowledgements to handleAck().  Not
+ *  thread-safe.
+ */
+class SnapshotSender : private detail::ReplicationState {
+public:
+    /** @brief Bind to @p context's World, keeping the last @p history snapshots.
+     *
+     *  A peer whose last acknowledgement is older than @p history snapshots
+     *  receives full state until it acknowledges again.
+     */
+    explicit SnapshotSender(const Context &context, std::size_t history = 32) noexcept
+        : ReplicationState(history), context_(context.raw()) {}
+
+    /** @brief Replicate components of type @p T, registering the type with the engine.
+     *
+     *  Types must be tracked in the same order on the receiver, before the
+     *  first snapshot.
+     *
+     *  @return SUCCESS on success.
+     *  @retval ERR_INVALID_STATE  The schema is invalid or does not match sizeof(T), or
+     *                             a snapshot was already captured.
+     */
+    template <typename T>
+    int track(const ReplicationSchema &schema) noexcept {
+        int status = ComponentView<T>::registerType();
+        return status == SUCCESS ? trackType<T>(schema) : status;
+    }
+
+    /** @brief track() with one raw field per 4-byte word of @p T. */
+    template <typename T>
+    int track() noexcept {
+        try {
+            return track<T>(ReplicationSchema::words(sizeof(T)));
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+    }
+
+    /** @brief Start a new, empty snapshot.
+     *  @return SUCCESS on success.
+     */
+    int beginSnapshot() noexcept {
+        std::uint32_t sequence = latest_ + 1 == 0 ? 1 : latest_ + 1;
+        current_ = claim(sequence);
+        if (current_ == nullptr) {
+            return ERR_INTERNAL_ERROR;
+        }
+        current_->sequence = sequence;
+        latest_ = sequence;
+        return SUCCESS;
+    }
+
+    /** @brief Set the current snapshot's @p T components from caller-owned state.
+     *
+     *  For state kept outside the World.  Quantized fields are rounded as
+     *  the receiver will see them.
+     *
+     *  @param entities    Array of @p count distinct entities.
+     *  @param components  Array of @p count components.
+     *  @param count       Number of components.
+     *  @return SUCCESS on success.
+     *  @retval ERR_INVALID_STATE  No snapshot was begun, @p T is not tracked, or an array
+     *                             is NULL with a non-zero @p count.
+     */
+    template <typename T>
+    int captureTable(const ::goud_entity *entities, const T *components, std::size_t count) noexcept {
+        std::size_t index = typeIndex<T>();
+        if (current_ == nullptr || index == types_.size() ||
+            (count != 0 && (entities == nullptr || components == nullptr))) {
+            return ERR_INVALID_STATE;
+        }
+        try {
+            pointers_.resize(count);
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            pointers_[i] = reinterpret_cast<const std::uint8_t *>(&components[i]);
+        }
+        return store(index, entities, pointers_.data(), count);
+    }
+
+    /** @brief Begin a snapshot and fill every tracked type from the World.
+     *  @return SUCCESS on success.
+     */
+    int capture() noexcept {
+        int status = beginSnapshot();
+        for (std::size_t index = 0; status == SUCCESS && index < types_.size(); ++index) {
+            std::uint64_t type_id = types_[index].type_id;
+            ::goud_clear_last_error();
+            std::uint32_t count = ::goud_component_count(context_, type_id);
+            try {
+                world_entities_.resize(count);
+                pointers_.resize(count);
+            } catch (const std::bad_alloc &) {
+                return ERR_INTERNAL_ERROR;
+            }
+            std::uint32_t filled = count == 0 ? 0
+                                              : ::goud_component_get_all(
+                                                    context_, type_id, world_entities_.data(), pointers_.data(), count);
+            status = filled == 0 ? ::goud_status_last_error_or(SUCCESS)
+                                 : store(index, world_entities_.data(), pointers_.data(), filled);
+        }
+        return status;
+    }
+
+    /** @brief Sequence number of the current snapshot (0 before the first). */
+    std::uint32_t sequence() const noexcept {
+        return latest_;
+    }
+
+    /** @brief Encode the current snapshot as a delta against @p peer_id's last acknowledged one.
+     *
+     *  @param peer_id  Destination peer.
+     *  @param[out] out Receives the message; its capacity is reused.
+     *  @return SUCCESS on success.
+     *  @retval ERR_INVALID_STATE  No snapshot was captured.
+     */
+    int encodeDelta(std::uint64_t peer_id, std::vector<std::uint8_t> &out) const noexcept {
+        out.clear();
+        if (current_ == nullptr) {
+            return ERR_INVALID_STATE;
+        }
+        auto acked = peers_.find(peer_id);
+        const detail::ReplicationSnapshot *base =
+            acked != peers_.end() ? snapshot(acked->second) : nullptr;
+
+        try {
+            detail::BitWriter writer(out);
+            writer.write(detail::kReplicationDeltaTag, 8);
+            writer.writeVarint(current_->sequence);
+            writer.writeVarint(base != nullptr ? base->sequence : 0);
+            writer.writeVarint(types_.size());
+            for (std::size_t index = 0; index < types_.size(); ++index) {
+                static const detail::ReplicationTable empty;
+                encodeTable(writer,
+                            types_[index].schema,
+                            base != nullptr ? base->tables[index] : empty,
+                            current_->tables[index]);
+            }
+        } catch (const std::bad_alloc &) {
+            out.clear();
+            return ERR_INTERNAL_ERROR;
+        }
+        return SUCCESS;
+    }
+
+    /** @brief Check whether @p data is an acknowledgement from SnapshotReceiver::encodeAck(). */
+    static bool isAck(const std::uint8_t *data, std::size_t size) noexcept {
+        return data != nullptr && size > 0 && data[0] == detail::kReplicationAckTag;
+    }
+
+    /** @brief Record @p peer_id's acknowledgement so later deltas use it as the baseline.
+     *
+     *  Acknowledgements older than the peer's current baseline, or for
+     *  snapshots no longer in the history, are ignored.
+     *
+     *  @return SUCCESS on success, including ignored acknowledgements.
+     *  @retval ERR_INVALID_STATE  @p data is not a well-formed acknowledgement.
+     */
+    int handleAck(std::uint64_t peer_id, const std::uint8_t *data, std::size_t size) noexcept {
+        if (!isAck(data, size)) {
+            return ERR_INVALID_STATE;
+        }
+        detail::BitReader reader(data + 1, size - 1);
+        std::uint64_t sequence = reader.readVarint();
+        if (!reader.ok() || sequence > UINT32_MAX) {
+            return ERR_INVALID_STATE;
+        }
+        auto sequence32 = static_cast<std::uint32_t>(sequence);
+        if (snapshot(sequence32) == nullptr) {
+            return SUCCESS;
+        }
+        try {
+            auto inserted = peers_.emplace(peer_id, sequence32);
+            if (!inserted.second && detail::sequenceNewer(sequence32, inserted.first->second)) {
+                inserted.first->second = sequence32;
+            }
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+        return SUCCESS;
+    }
+
+    /** @brief Forget @p peer_id's baseline; its next delta carries full state. */
+    void removePeer(std::uint64_t peer_id) noexcept {
+        peers_.erase(peer_id);
+    }
+
+private:
+    int store(std::size_t index, const ::goud_entity *entities, const std::uint8_t *const *data, std::size_t count) noexcept {
+        const ReplicationSchema &schema = types_[index].schema;
+        std::size_t stride = schema.componentSize();
+        detail::ReplicationTable &table = current_->tables[index];
+        try {
+            order_.resize(count);
+            table.entities.resize(count);
+            table.bytes.assign(count * stride, 0);
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            order_[i] = i;
+        }
+        std::sort(order_.begin(), order_.end(), [entities](std::size_t a, std::size_t b) {
+            return entities[a] < entities[b];
+        });
+
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::uint8_t *src = data[order_[i]];
+            std::uint8_t *dst = table.bytes.data() + i * stride;
+            table.entities[i] = entities[order_[i]];
+            for (const ReplicationSchema::Field &field : schema.fields()) {
+                std::memcpy(dst + field.offset, src + field.offset, field.size);
+                if (field.bits != 0) {
+                    float value;
+                    std::memcpy(&value, dst + field.offset, sizeof(value));
+                    value = detail::dequantize(detail::quantize(value, field), field);
+                    std::memcpy(dst + field.offset, &value, sizeof(value));
+                }
+            }
+        }
+        return SUCCESS;
+    }
+
+    static void encodeFields(detail::BitWriter &writer,
+                             const ReplicationSchema &schema,
+                             const std::uint8_t *base,
+                             const std::uint8_t *current) {
+        for (const ReplicationSchema::Field &field : schema.fields()) {
+            const std::uint8_t *value = current + field.offset;
+            bool changed = base == nullptr || std::memcmp(base + field.offset, value, field.size) != 0;
+            writer.write(changed ? 1u : 0u, 1);
+            if (!changed) {
+                continue;
+            }
+            if (field.bits != 0) {
+                float f;
+                std::memcpy(&f, value, sizeof(f));
+                writer.write(detail::quantize(f, field), field.bits);
+            } else {
+                for (std::uint32_t b = 0; b < field.size; ++b) {
+                    writer.write(value[b], 8);
+                }
+            }
+        }
+    }
+
+    static bool fieldsEqual(const ReplicationSchema &schema, const std::uint8_t *a, const std::uint8_t *b) noexcept {
+        for (const ReplicationSchema::Field &field : schema.fields()) {
+            if (std::memcmp(a + field.offset, b + field.offset, field.size) != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Per table: removed entities, then changed or added entities with a
+    // field mask and the changed fields.  Entity IDs are delta-coded in
+    // ascending order.
+    static void encodeTable(detail::BitWriter &writer,
+                            const ReplicationSchema &schema,
+                            const detail::ReplicationTable &base,
+                            const detail::ReplicationTable &current) {
+        std::size_t stride = schema.componentSize();
+
+        std::size_t removed = 0;
+        for (::goud_entity entity : base.entities) {
+            removed += current.find(entity, stride) == nullptr ? 1 : 0;
+        }
+        writer.writeVarint(removed);
+        ::goud_entity previous = 0;
+        for (::goud_entity entity : base.entities) {
+            if (current.find(entity, stride) == nullptr) {
+                writer.writeVarint(entity - previous);
+                previous = entity;
+            }
+        }
+
+        std::size_t changed = 0;
+        for (std::size_t j = 0; j < current.entities.size(); ++j) {
+            const std::uint8_t *old = base.find(current.entities[j], stride);
+            if (old == nullptr || !fieldsEqual(schema, old, current.bytes.data() + j * stride)) {
+                ++changed;
+            }
+        }
+        writer.writeVarint(changed);
+        previous = 0;
+        for (std::size_t j = 0; j < current.entities.size(); ++j) {
+            const std::uint8_t *value = current.bytes.data() + j * stride;
+            const std::uint8_t *old = base.find(current.entities[j], stride);
+            if (old != nullptr && fieldsEqual(schema, old, value)) {
+                continue;
+            }
+            writer.writeVarint(current.entities[j] - previous);
+            previous = current.entities[j];
+            encodeFields(writer, schema, old, value);
+        }
+    }
+
+    ::goud_context context_;
+    detail::ReplicationSnapshot *current_ = nullptr;
+    std::unordered_map<std::uint64_t, std::uint32_t> peers_;
+    std::vector<::goud_entity> world_entities_;
+    std::vector<const std::uint8_t *> pointers_;
+    std::vector<std::size_t> order_;
+};
+
+/** @brief Rebuilds snapshots from SnapshotSender deltas.
+ *
+ *  Track the same types in the same order as the sender.  Not thread-safe.
+ */
+class SnapshotReceiver : private detail::ReplicationState {
+public:
+    /** @brief Keep the last @p history rebuilt snapshots as baselines.
+     *
+     *  Use the same history length as the sender.
+     */
+    explicit SnapshotReceiver(std::size_t history = 32) noexcept
+        : ReplicationState(history) {}
+
+    /** @brief Expect components of type @p T, encoded with @p schema.
+     *  @return SUCCESS on success.
+     *  @retval ERR_INVALID_STATE  The schema is invalid or a delta was already applied.
+     */
+    template <typename T>
+    int track(const ReplicationSchema &schema) noexcept {
+        return trackType<T>(schema);
+    }
+
+    /** @brief track() with one raw field per 4-byte word of @p T. */
+    template <typename T>
+    int track() noexcept {
+        try {
+            return track<T>(ReplicationSchema::words(sizeof(T)));
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+    }
+
+    /** @brief Check whether @p data is a delta from SnapshotSender::encodeDelta(). */
+    static bool isDelta(const std::uint8_t *data, std::size_t size) noexcept {
+        return data != nullptr && size > 0 && data[0] == detail::kReplicationDeltaTag;
+    }
+
+    /** @brief Rebuild the snapshot carried by one delta.
+     *
+     *  @p callback is invoked as
+     *  <tt>callback(std::uint64_t type_id, goud_entity entity, const void *component)</tt>
+     *  for every added or changed component, and with a null @p component
+     *  for every removed one.  Deltas older than the latest applied one are
+     *  ignored.
+     *
+     *  @return SUCCESS on success, including ignored deltas.
+     *  @retval ERR_INVALID_STATE  The delta is malformed, was encoded for different types,
+     *                             or its baseline is no longer in the history.
+     */
+    template <typename Callback>
+    int applyDelta(const std::uint8_t *data, std::size_t size, Callback &&callback) noexcept {
+        if (!isDelta(data, size)) {
+            return ERR_INVALID_STATE;
+        }
+        detail::BitReader reader(data + 1, size - 1);
+        std::uint64_t sequence = reader.readVarint();
+        std::uint64_t baseline = reader.readVarint();
+        std::uint64_t type_count = reader.readVarint();
+        if (!reader.ok() || sequence == 0 || sequence > UINT32_MAX || baseline > UINT32_MAX ||
+            type_count != types_.size()) {
+            return ERR_INVALID_STATE;
+        }
+        auto sequence32 = static_cast<std::uint32_t>(sequence);
+        if (latest_ != 0 && !detail::sequenceNewer(sequence32, latest_)) {
+            return SUCCESS;
+        }
+        const detail::ReplicationSnapshot *base = snapshot(static_cast<std::uint32_t>(baseline));
+        if (baseline != 0 && (base == nullptr || &history_[sequence32 % history_.size()] == base)) {
+            return ERR_INVALID_STATE;
+        }
+
+        detail::ReplicationSnapshot *target = claim(sequence32);
+        if (target == nullptr) {
+            return ERR_INTERNAL_ERROR;
+        }
+        for (std::size_t index = 0; index < types_.size(); ++index) {
+            static const detail::ReplicationTable empty;
+            int status = decodeTable(reader, index, base != nullptr ? base->tables[index] : empty,
+                                     target->tables[index]);
+            if (status != SUCCESS) {
+                return status;
+            }
+        }
+        target->sequence = sequence32;
+        latest_ = sequence32;
+
+        for (const Change &change : changes_) {
+            const detail::ReplicationTable &table = target->tables[change.type];
+            const std::uint8_t *component =
+                change.removed ? nullptr : table.find(change.entity, types_[change.type].schema.componentSize());
+            callback(types_[change.type].type_id, change.entity, static_cast<const void *>(component));
+        }
+        return SUCCESS;
+    }
+
+    /** @brief applyDelta() without change notifications. */
+    int applyDelta(const std::uint8_t *data, std::size_t size) noexcept {
+        return applyDelta(data, size, [](std::uint64_t, ::goud_entity, const void *) {});
+    }
+
+    /** @brief Sequence of the latest applied snapshot (0 before the first). */
+    std::uint32_t sequence() const noexcept {
+        return latest_;
+    }
+
+    /** @brief Encode an acknowledgement of the latest applied snapshot.
+     *  @param[out] out  Receives the message; its capacity is reused.
+     *  @return SUCCESS on success.
+     *  @retval ERR_INVALID_STATE  No delta was applied yet.
+     */
+    int encodeAck(std::vector<std::uint8_t> &out) const noexcept {
+        out.clear();
+        if (latest_ == 0) {
+            return ERR_INVALID_STATE;
+        }
+        try {
+            detail::BitWriter writer(out);
+            writer.write(detail::kReplicationAckTag, 8);
+            writer.writeVarint(latest_);
+        } catch (const std::bad_alloc &) {
+            out.clear();
+            return ERR_INTERNAL_ERROR;
+        }
+        return SUCCESS;
+    }
+
+    /** @brief @p entity's @p T component in the latest snapshot, or nullptr. */
+    template <typename T>
+    const T *find(::goud_entity entity) const noexcept {
+        std::size_t index = typeIndex<T>();
+        const detail::ReplicationSnapshot *latest = snapshot(latest_);
+        if (latest == nullptr || index == types_.size()) {
+            return nullptr;
+        }
+        return reinterpret_cast<const T *>(latest->tables[index].find(entity, sizeof(T)));
+    }
+
+    /** @brief Number of @p T components in the latest snapshot. */
+    template <typename T>
+    std::size_t count() const noexcept {
+        std::size_t index = typeIndex<T>();
+        const detail::ReplicationSnapshot *latest = snapshot(latest_);
+        return latest == nullptr || index == types_.size() ? 0 : latest->tables[index].entities.size();
+    }
+
+private:
+    struct Change {
+        std::size_t type;
+        ::goud_entity entity;
+        bool removed;
+    };
+
+    static void decodeFields(detail::BitReader &reader, const ReplicationSchema &schema, std::uint8_t *dst) noexcept {
+        for (const ReplicationSchema::Field &field : schema.fields()) {
+            if (reader.read(1) == 0) {
+                continue;
+            }
+            if (field.bits != 0) {
+                float value = detail::dequantize(reader.read(field.bits), field);
+                std::memcpy(dst + field.offset, &value, sizeof(value));
+            } else {
+                for (std::uint32_t b = 0; b < field.size; ++b) {
+                    dst[field.offset + b] = static_cast<std::uint8_t>(reader.read(8));
+                }
+            }
+        }
+    }
+
+    // Mirrors SnapshotSender::encodeTable(): the rebuilt table is the
+    // baseline minus removed entities, with changed entities patched or
+    // inserted in order.
+    int decodeTable(detail::BitReader &reader,
+                    std::size_t index,
+                    const detail::ReplicationTable &base,
+                    detail::ReplicationTable &out) noexcept {
+        const ReplicationSchema &schema = types_[index].schema;
+        std::size_t stride = schema.componentSize();
+        if (index == 0) {
+            changes_.clear();
+        }
+
+        try {
+            removed_.clear();
+            std::uint64_t removed = reader.readVarint();
+            if (!reader.ok() || removed > base.entities.size()) {
+                return ERR_INVALID_STATE;
+            }
+            ::goud_entity entity = 0;
+            for (std::uint64_t i = 0; i < removed && reader.ok(); ++i) {
+                entity += reader.readVarint();
+                removed_.push_back(entity);
+                changes_.push_back(Change{index, entity, true});
+            }
+
+            // Every change costs at least one byte, which bounds a corrupt count.
+            std::uint64_t changed = reader.readVarint();
+            if (!reader.ok() || changed > reader.remainingBits() / 8) {
+                return ERR_INVALID_STATE;
+            }
+            out.entities.reserve(base.entities.size() + changed);
+            out.bytes.reserve((base.entities.size() + changed) * stride);
+
+            std::size_t next_base = 0;
+            auto copyBase = [&](bool all, ::goud_entity limit) {
+                for (; next_base < base.entities.size() && (all || base.entities[next_base] < limit); ++next_base) {
+                    ::goud_entity kept = base.entities[next_base];
+                    if (!std::binary_search(removed_.begin(), removed_.end(), kept)) {
+                        const std::uint8_t *src = base.bytes.data() + next_base * stride;
+                        out.entities.push_back(kept);
+                        out.bytes.insert(out.bytes.end(), src, src + stride);
+                    }
+                }
+            };
+
+            entity = 0;
+            for (std::uint64_t i = 0; i < changed && reader.ok(); ++i) {
+                ::goud_entity delta = reader.readVarint();
+                if (i > 0 && delta == 0) {
+                    return ERR_INVALID_STATE;
+                }
+                entity += delta;
+                copyBase(false, entity);
+                std::size_t offset = out.bytes.size();
+                if (next_base < base.entities.size() && base.entities[next_base] == entity) {
+                    const std::uint8_t *src = base.bytes.data() + next_base * stride;
+                    out.bytes.insert(out.bytes.end(), src, src + stride);
+                    ++next_base;
+                } else {
+                    out.bytes.resize(offset + stride, 0);
+                }
+                out.entities.push_back(entity);
+                decodeFields(reader, schema, out.bytes.data() + offset);
+                changes_.push_back(Change{index, entity, false});
+            }
+            copyBase(true, 0);
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+        return reader.ok() ? SUCCESS : ERR_INVALID_STATE;
+    }
+
+    std::vector<::goud_entity> removed_;
+    std::vector<Change> changes_;
+};
+
+}  // namespace goud
+
+#endif
@@ -0,0 +1,252 @@
+#ifndef GOUD_CPP_SKELETON_HPP
+#define GOUD_CPP_SKELETON_HPP
+
+/** @file skeleton.hpp
+ *  @brief 2D skeletons, blended skeletal clips and batched bone palettes.
+ *
+ *  Skeleton builds a skeleton and its clips on one entity.  SkeletonBatch
+ *  then advances every skeleton of a crowd with one call to
+ *  goud_skeleton_update_batch(), which samples clips, blends layers and
+ *  computes each bone's skinning matrix on the engine's worker threads,
+ *  writing them all into one palette ready for a single GPU upload:
+ *
+ *  @code
+ *  goud::SkeletonBatch crowd;
+ *  for (goud_entity e : characters) {
+ *      crowd.add(e);
+ *  }
+ *  // Each frame:
+ *  crowd.update(context, dt);
+ *  upload(crowd.palette(), crowd.paletteFloats() * sizeof(float));
+ *  // Character i skins with bones [crowd.firstBone(i), crowd.firstBone(i + 1)).
+ *  @endcode
+ */
+
+#include <goud/goud.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <vector>
+
+namespace goud {
+
+/** @brief Non-owning view of an entity's skeleton and skeletal clips. */
+class Skeleton {
+public:
+    /** @brief Base clip index for key(). */
+    static constexpr std::int32_t kBaseLayer = 0;
+
+    /** @brief Construct a view of @p entity in @p context. */
+    Skeleton(::goud_context context, ::goud_entity entity) noexcept
+        : context_(context), entity_(entity) {}
+
+    /** @brief Attach an empty skeleton to @p entity, replacing any existing one.
+     *  @param[out] out_status  Optional pointer to receive the status code.
+     */
+    static Skeleton attach(::goud_context context, ::goud_entity entity, int *out_status = nullptr) noexcept {
+        int status = ::goud_skeleton_attach(context, entity);
+        if (out_status != nullptr) {
+            *out_status = status;
+        }
+        return Skeleton(context, entity);
+    }
+
+    /** @brief Append a bone; parents must be added before their children.
+     *  @param parent         Parent bone index, or -1 for a root bone.
+     *  @param[out] out_bone  Optional; receives the new bone's index.
+     *  @return SUCCESS on success.
+     */
+    int addBone(const char *name,
+                std::int32_t parent,
+                float x,
+                float y,
+                float rotation,
+                std::int32_t *out_bone = nullptr) const noexcept {
+        return ::goud_skeleton_bone_add(context_, entity_, name, parent, x, y, rotation, out_bone);
+    }
+
+    /** @brief Set a bone's local position and rotation, keeping its scale.
+     *  @return SUCCESS on success.
+     */
+    int setBone(std::int32_t bone, float x, float y, float rotation) const noexcept {
+        return ::goud_skeleton_bone_set(context_, entity_, bone, x, y, rotation);
+    }
+
+    /** @brief Start a new, empty base clip, discarding previous clips and layers.
+     *  @return SUCCESS on success.
+     */
+    int play(const char *clip, bool looping = true) const noexcept {
+        return ::goud_skeleton_play(context_, entity_, clip, looping);
+    }
+
+    /** @brief Key a bone's local transform in the base clip or a layer.
+     *  @param layer  kBaseLayer, or an index from addLayer().
+     *  @param time   Seconds from the start of the clip; later keys extend it.
+     *  @return SUCCESS on success.
+     */
+    int key(std::int32_t layer,
+            std::int32_t bone,
+            float time,
+            float x,
+            float y,
+            float rotation,
+            float scale_x = 1.0f,
+            float scale_y = 1.0f) const noexcept {
+        return ::goud_skeleton_keyframe(context_, entity_, layer, bone, time, x, y, rotation, scale_x, scale_y);
+    }
+
+    /** @brief Add a clip blended over the base clip.
+     *
+     *  An animation layer of the same name on the entity supplies the
+     *  weight and blend mode while it exists.
+     *
+     *  @param blend_mode      0 = override, 1 = additive.
+     *  @param[out] out_layer  Optional; receives the layer index (>= 1).
+     *  @return SUCCESS on success.
+     */
+    int addLayer(const char *name,
+                 std::uint32_t blend_mode,
+                 bool looping = true,
+                 std::int32_t *out_layer = nullptr) const noexcept {
+        return ::goud_skeleton_layer_push(context_, entity_, name, blend_mode, looping, out_layer);
+    }
+
+    /** @brief Set a layer's blend weight, clamped to [0, 1].
+     *  @return SUCCESS on success.
+     */
+    int setLayerWeight(std::int32_t layer, float weight) const noexcept {
+        return ::goud_skeleton_layer_weight(context_, entity_, layer, weight);
+    }
+
+    /** @brief Access the viewed entity. */
+    ::goud_entity entity() const noexcept {
+        return entity_;
+    }
+
+private:
+    ::goud_context context_;
+    ::goud_entity entity_;
+};
+
+/** @brief A set of skeletons advanced together into one bone palette.
+ *
+ *  The palette holds GOUD_BONE_PALETTE_FLOATS floats per bone (two
+ *  vec4 rows of each skinning matrix), skeletons back to back in the
+ *  order they were added.  It is resized automatically when bones are
+ *  added, so steady-state frames cost one engine call.
+ */
+class SkeletonBatch {
+public:
+    /** @brief Construct an empty batch. */
+    SkeletonBatch() noexcept = default;
+
+    /** @brief Add an entity with a skeleton.
+     *  @return SUCCESS, or ERR_INTERNAL_ERROR if the batch could not grow.
+     */
+    int add(::goud_entity entity) noexcept {
+        if (entities_.size() >= std::numeric_limits<std::uint32_t>::max() - 1) {
+            return ERR_INTERNAL_ERROR;
+        }
+        try {
+            entities_.push_back(entity);
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+        return SUCCESS;
+    }
+
+    /** @brief Remove every entity, keeping the allocated buffers. */
+    void clear() noexcept {
+        entities_.clear();
+        offsets_.clear();
+        bones_ = 0;
+    }
+
+    /** @brief Number of entities in the batch. */
+    std::size_t size() const noexcept {
+        return entities_.size();
+    }
+
+    /** @brief Advance every skeleton by @p dt and rewrite the palette.
+     *  @return SUCCESS on success.
+     *  @retval ERR_INVALID_STATE  An entity was added twice.
+     */
+    int update(::goud_context context, float dt) noexcept {
+        const std::uint32_t count = static_cast<std::uint32_t>(entities_.size());
+        try {
+            offsets_.resize(entities_.size() + 1);
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+        int status = evaluate(context, dt, count);
+        if (status == SUCCESS) {
+            return SUCCESS;
+        }
+
+        // The palette may be too short for newly added bones: size it and retry.
+        std::uint32_t bones = 0;
+        if (::goud_skeleton_update_palettes(context, entities_.data(), count, dt, nullptr, 0,
+                                            offsets_.data(), &bones) != SUCCESS ||
+            static_cast<std::size_t>(bones) * GOUD_BONE_PALETTE_FLOATS <= palette_.size()) {
+            return status;
+        }
+        try {
+            palette_.resize(static_cast<std::size_t>(bones) * GOUD_BONE_PALETTE_FLOATS);
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+        return evaluate(context, dt, count);
+    }
+
+    /** @brief Palette written by the last update(); paletteFloats() floats. */
+    const float *palette() const noexcept {
+        return palette_.data();
+    }
+
+    /** @brief Number of palette floats the last update() wrote. */
+    std::size_t paletteFloats() const noexcept {
+        return static_cast<std::size_t>(bones_) * GOUD_BONE_PALETTE_FLOATS;
+    }
+
+    /** @brief Number of bones the last update() wrote. */
+    std::uint32_t boneCount() const noexcept {
+        return bones_;
+    }
+
+    /** @brief First palette bone of entity @p index; firstBone(size()) is boneCount().
+     *
+     *  Only valid after update(); entities without a skeleton span no bones.
+     */
+    std::uint32_t firstBone(std::size_t index) const noexcept {
+        return index < offsets_.size() ? offsets_[index] : bones_;
+    }
+
+private:
+    int evaluate(::goud_context context, float dt, std::uint32_t count) noexcept {
+        const std::size_t floats = palette_.size();
+        const std::uint32_t len = floats > std::numeric_limits<std::uint32_t>::max()
+                                      ? std::numeric_limits<std::uint32_t>::max()
+                                      : static_cast<std::uint32_t>(floats);
+        std::uint32_t bones = 0;
+        // A non-null palette, even empty, is an update rather than a size query.
+        float *out = palette_.empty() ? &empty_ : palette_.data();
+        int status = ::goud_skeleton_update_palettes(context, entities_.data(), count, dt, out, len,
+                                                     offsets_.data(), &bones);
+        if (status == SUCCESS) {
+            bones_ = bones;
+        }
+        return status;
+    }
+
+    std::vector<::goud_entity> entities_;
+    std::vector<std::uint32_t> offsets_;
+    std::vector<float> palette_;
+    std::uint32_t bones_ = 0;
+    float empty_ = 0.0f;
+};
+
+} // namespace goud
+
+#endif
@@ -0,0 +1,223 @@
+#ifndef GOUD_CPP_SNAPSHOT_HPP
+#define GOUD_CPP_SNAPSHOT_HPP
+
+/** @file snapshot.hpp
+ *  @brief RAII wrappers for rollback snapshots of worlds and 2D physics.
+ *
+ *  A WorldSnapshot holds a context's entities and components engine-side;
+ *  a PhysicsState holds its 2D physics simulation.  Rollback netcode keeps
+ *  a ring of both, refreshes one slot per frame with update(), and calls
+ *  restore() on the confirmed frame before resimulating.  Component types
+ *  that did not change since the previous save are shared between
+ *  snapshots rather than copied, so refreshing a slot is cheap when most
+ *  of the world is idle.
+ */
+
+#include <goud/goud.hpp>
+
+#include <cstdint>
+
+namespace goud {
+
+/** @brief RAII wrapper for a saved world snapshot.
+ *
+ *  Move-only.  The snapshot is freed on destruction.  It does not reference
+ *  the Context it was saved from and can be restored any number of times.
+ */
+class WorldSnapshot {
+public:
+    /** @brief Construct an invalid snapshot. */
+    WorldSnapshot() noexcept = default;
+
+    /** @brief Free the snapshot. */
+    ~WorldSnapshot() noexcept {
+        reset();
+    }
+
+    WorldSnapshot(const WorldSnapshot &) = delete;
+    WorldSnapshot &operator=(const WorldSnapshot &) = delete;
+
+    /** @brief Move-construct from another snapshot. */
+    WorldSnapshot(WorldSnapshot &&other) noexcept
+        : handle_(other.release()) {}
+
+    /** @brief Move-assign from another snapshot. */
+    WorldSnapshot &operator=(WorldSnapshot &&other) noexcept {
+        if (this != &other) {
+            reset();
+            handle_ = other.release();
+        }
+        return *this;
+    }
+
+    /** @brief Save the entities and components of @p context.
+     *  @param context          Context to save.
+     *  @param[out] out_status  Optional pointer to receive the status code.
+     *  @return A valid WorldSnapshot on success.
+     */
+    static WorldSnapshot save(const Context &context, int *out_status = nullptr) noexcept {
+        WorldSnapshot snapshot;
+        int status = ::goud_world_snapshot_take(context.raw(), &snapshot.handle_);
+        if (status != SUCCESS) {
+            snapshot.handle_ = -1;
+        }
+        if (out_status != nullptr) {
+            *out_status = status;
+        }
+        return snapshot;
+    }
+
+    /** @brief Check whether the snapshot handle is valid. */
+    bool valid() const noexcept {
+        return handle_ > 0;
+    }
+
+    /** @brief Overwrite the snapshot with the current state of @p context.
+     *  @return SUCCESS on success; the snapshot is unchanged on failure.
+     */
+    int update(const Context &context) noexcept {
+        return ::goud_world_snapshot_update(context.raw(), handle_);
+    }
+
+    /** @brief Roll @p context back to the snapshot.
+     *  @return SUCCESS on success.
+     */
+    int restore(const Context &context) const noexcept {
+        return ::goud_world_snapshot_rollback(context.raw(), handle_);
+    }
+
+    /** @brief Read the snapshot's entity, column and byte counts.
+     *  @param[out] out_stats  Receives the counts.
+     *  @return SUCCESS on success.
+     */
+    int stats(::goud_world_snapshot_stats &out_stats) const noexcept {
+        return ::goud_world_snapshot_stats_get(handle_, &out_stats);
+    }
+
+    /** @brief Access the raw FFI snapshot handle. */
+    ::goud_world_snapshot raw() const noexcept {
+        return handle_;
+    }
+
+    /** @brief Release ownership of the raw handle.
+     *  @return The underlying handle.  The snapshot is left invalid.
+     */
+    ::goud_world_snapshot release() noexcept {
+        ::goud_world_snapshot handle = handle_;
+        handle_ = -1;
+        return handle;
+    }
+
+    /** @brief Free the underlying snapshot and reset to invalid.
+     *  @return SUCCESS on success or if already invalid.
+     */
+    int reset() noexcept {
+        if (!valid()) {
+            return SUCCESS;
+        }
+        return ::goud_world_snapshot_free(release());
+    }
+
+private:
+    ::goud_world_snapshot handle_ = -1;
+};
+
+/** @brief RAII wrapper for a saved 2D physics state.
+ *
+ *  Move-only.  The state is freed on destruction.  Enable
+ *  PhysicsWorld::setDeterministic() so resimulated steps match the
+ *  originals.
+ */
+class PhysicsState {
+public:
+    /** @brief Construct an invalid state. */
+    PhysicsState() noexcept = default;
+
+    /** @brief Free the state. */
+    ~PhysicsState() noexcept {
+        reset();
+    }
+
+    PhysicsState(const PhysicsState &) = delete;
+    PhysicsState &operator=(const PhysicsState &) = delete;
+
+    /** @brief Move-construct from another state. */
+    PhysicsState(PhysicsState &&other) noexcept
+        : handle_(other.release()) {}
+
+    /** @brief Move-assign from another state. */
+    PhysicsState &operator=(PhysicsState &&other) noexcept {
+        if (this != &other) {
+            reset();
+            handle_ = other.release();
+        }
+        return *this;
+    }
+
+    /** @brief Save the 2D physics state of @p context.
+     *  @param context          Context with a 2D physics world.
+     *  @param[out] out_status  Optional pointer to receive the status code.
+     *  @return A valid PhysicsState on success.
+     */
+    static PhysicsState save(const Context &context, int *out_status = nullptr) noexcept {
+        PhysicsState state;
+        int status = ::goud_physics_state_capture(context.raw(), &state.handle_);
+        if (status != SUCCESS) {
+            state.handle_ = -1;
+        }
+        if (out_status != nullptr) {
+            *out_status = status;
+        }
+        return state;
+    }
+
+    /** @brief Check whether the state handle is valid. */
+    bool valid() const noexcept {
+        return handle_ > 0;
+    }
+
+    /** @brief Overwrite the state with the current physics of @p context.
+     *  @return SUCCESS on success.
+     */
+    int update(const Context &context) noexcept {
+        return ::goud_physics_state_update(context.raw(), handle_);
+    }
+
+    /** @brief Restore the physics of @p context to this state.
+     *  @return SUCCESS on success.
+     */
+    int restore(const Context &context) const noexcept {
+        return ::goud_physics_state_apply(context.raw(), handle_);
+    }
+
+    /** @brief Access the raw FFI state handle. */
+    ::goud_physics_state raw() const noexcept {
+        return handle_;
+    }
+
+    /** @brief Release ownership of the raw handle.
+     *  @return The underlying handle.  The state is left invalid.
+     */
+    ::goud_physics_state release() noexcept {
+        ::goud_physics_state handle = handle_;
+        handle_ = -1;
+        return handle;
+    }
+
+    /** @brief Free the underlying state and reset to invalid.
+     *  @return SUCCESS on success or if already invalid.
+     */
+    int reset() noexcept {
+        if (!valid()) {
+            return SUCCESS;
+        }
+        return ::goud_physics_state_release(release());
+    }
+
+private:
+    ::goud_physics_state handle_ = -1;
+};
+
+}  // namespace goud
+
+#endif
@@ -0,0 +1,97 @@
+#ifndef GOUD_CPP_SPRITE_ANIMATION_HPP
+#define GOUD_CPP_SPRITE_ANIMATION_HPP
+
+/** @file sprite_animation.hpp
+ *  @brief Batched sprite animator updates that feed a SpriteBatch.
+ *
+ *  Stepping each animated entity through goud_animation_controller_update()
+ *  and reading its frame back costs several FFI calls per entity.
+ *  updateAnimators() steps a whole array of entities with one call to
+ *  goud_animation_update_batch() and writes each entity's current frame into
+ *  the source rect of the matching sprite command.  Large batches are
+ *  advanced on the engine's worker threads.
+ */
+
+#include <goud/goud.h>
+#include <goud/sprite_batch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace goud {
+
+/** @brief Step the animation of @p count entities and write their frames.
+ *
+ *  @code
+ *  // One command per animated entity, recorded in entity order.
+ *  goud::updateAnimators(context, crowd.data(), count, dt, cmds.data());
+ *  goud_renderer_draw_sprite_cmds(context, cmds.data(), count, nullptr);
+ *  @endcode
+ *
+ *  @param context            Valid engine context.
+ *  @param entities           Array of @p count distinct entities.
+ *  @param count              Number of entities.
+ *  @param dt                 Seconds to advance.
+ *  @param[out] out_cmds      Optional; @p count commands whose source rects
+ *                            receive the entities' current frames.
+ *  @param[out] out_updated   Optional; receives the number of entities with a
+ *                            sprite animator.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p entities is NULL with a non-zero @p count, or
+ *                             an entity appears twice.
+ */
+inline int updateAnimators(
+    ::goud_context context,
+    const ::goud_entity *entities,
+    std::uint32_t count,
+    float dt,
+    ::goud_sprite_cmd *out_cmds = nullptr,
+    std::uint32_t *out_updated = nullptr
+) noexcept {
+    return ::goud_animation_update_animators(context, entities, count, dt, out_cmds, out_updated);
+}
+
+/** @brief Step the animation of @p entities and write their frames into @p batch.
+ *
+ *  Command @c i of @p batch receives the frame of @p entities[i], so the
+ *  batch must hold exactly one command per entity, recorded in entity order.
+ *
+ *  @param context            Valid engine context.
+ *  @param entities           Distinct entities to advance.
+ *  @param dt                 Seconds to advance.
+ *  @param batch              Batch holding one command per entity.
+ *  @param[out] out_updated   Optional; receives the number of entities with a
+ *                            sprite animator.
+ *  @return SUCCESS on success.
+ *  @retval ERR_INVALID_STATE  @p batch does not hold one command per entity, or
+ *                             an entity appears twice.
+ */
+inline int updateAnimators(
+    ::goud_context context,
+    const std::vector<::goud_entity> &entities,
+    float dt,
+    SpriteBatch &batch,
+    std::uint32_t *out_updated = nullptr
+) noexcept {
+    if (out_updated != nullptr) {
+        *out_updated = 0;
+    }
+    if (batch.size() != entities.size() ||
+        entities.size() > std::numeric_limits<std::uint32_t>::max()) {
+        return ERR_INVALID_STATE;
+    }
+    return updateAnimators(
+        context,
+        entities.data(),
+        static_cast<std::uint32_t>(entities.size()),
+        dt,
+        batch.data(),
+        out_updated
+    );
+}
+
+}  // namespace goud
+
+#endif
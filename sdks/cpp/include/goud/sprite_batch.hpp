@@ -0,0 +1,423 @@
+#ifndef GOUD_CPP_SPRITE_BATCH_HPP
+#define GOUD_CPP_SPRITE_BATCH_HPP
+
+/** @file sprite_batch.hpp
+ *  @brief Reusable sprite command buffer flushed in one FFI call.
+ *
+ *  goud::Context records drawSprite() calls into a SpriteBatch and flushes
+ *  it through goud_renderer_draw_sprite_batch() on endFrame(), so a frame of
+ *  sprites costs one FFI crossing instead of one per sprite.  SpriteBatch can
+ *  also be used on its own when the caller wants to own the buffer.
+ */
+
+#include <goud/goud.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <vector>
+
+namespace goud {
+
+/** @brief Order in which a SpriteBatch submits its commands. */
+enum class SpriteSortMode : std::uint32_t {
+    /** Draw in submission order (z_layer is assigned from texture runs). */
+    Submission = 0,
+    /** Stable-sort by (z_layer, texture) before flushing to cut texture binds. */
+    LayerTexture = 1,
+};
+
+/** @brief Pixel rectangle within a texture, such as one image in an atlas page. */
+struct TextureRegion {
+    ::goud_texture texture = 0;  /**< Texture the region lives in. */
+    float src_x = 0.0f;          /**< Left edge in texture pixels. */
+    float src_y = 0.0f;          /**< Top edge in texture pixels. */
+    float src_w = 0.0f;          /**< Width in texture pixels. */
+    float src_h = 0.0f;          /**< Height in texture pixels. */
+};
+
+/** @brief Contiguous, reusable buffer of goud_sprite_cmd entries.
+ *
+ *  In SpriteSortMode::Submission (the default) commands are drawn in
+ *  submission order.  The engine sorts every batch by (z_layer, texture), so
+ *  add() assigns z_layer itself: consecutive sprites that share a texture get
+ *  the same layer and are drawn together, and each texture change starts a
+ *  new layer.
+ *
+ *  In SpriteSortMode::LayerTexture the caller's layer (setLayer(), or the
+ *  command's own z_layer) is kept and flush() stable-sorts the buffer by
+ *  (z_layer, texture) with an LSD radix sort on a packed 64-bit key.  Sprites
+ *  that share a layer and texture keep their relative order; sprites on
+ *  different textures within one layer may be reordered.
+ *
+ *  Capacity, including the sort scratch buffers, is kept across flushes, so a
+ *  steady-state frame does not allocate.
+ */
+class SpriteBatch {
+public:
+    /** @brief Construct an empty batch. */
+    SpriteBatch() noexcept = default;
+
+    /** @brief Construct an empty batch with room for @p capacity commands.
+     *  @param capacity  Number of commands to reserve.
+     */
+    explicit SpriteBatch(std::size_t capacity) {
+        cmds_.reserve(capacity);
+    }
+
+    /** @brief Reserve room for at least @p capacity commands.
+     *  @param capacity  Number of commands to reserve.
+     *  @return SUCCESS, or ERR_INTERNAL_ERROR if the allocation failed.
+     */
+    int reserve(std::size_t capacity) noexcept {
+        try {
+            cmds_.reserve(capacity);
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+        return SUCCESS;
+    }
+
+    /** @brief Record a textured sprite.
+     *  @param texture   Texture handle.
+     *  @param x         X position.
+     *  @param y         Y position.
+     *  @param width     Sprite width.
+     *  @param height    Sprite height.
+     *  @param rotation  Rotation in radians.
+     *  @param color     Tint colour.
+     *  @return SUCCESS, or ERR_INTERNAL_ERROR if the buffer could not grow.
+     */
+    int add(
+        ::goud_texture texture,
+        float x,
+        float y,
+        float width,
+        float height,
+        float rotation,
+        ::goud_color color
+    ) noexcept {
+        ::goud_sprite_cmd cmd{};
+        cmd.texture = texture;
+        cmd.x = x;
+        cmd.y = y;
+        cmd.width = width;
+        cmd.height = height;
+        cmd.rotation = rotation;
+        cmd.r = color.r;
+        cmd.g = color.g;
+        cmd.b = color.b;
+        cmd.a = color.a;
+        cmd.z_layer = layer_;
+        return add(cmd);
+    }
+
+    /** @brief Record a sprite drawn from a texture region.
+     *  @param region    Texture and source rectangle to draw.
+     *  @param x         X position.
+     *  @param y         Y position.
+     *  @param width     Sprite width.
+     *  @param height    Sprite height.
+     *  @param rotation  Rotation in radians.
+     *  @param color     Tint colour.
+     *  @return SUCCESS, or ERR_INTERNAL_ERROR if the buffer could not grow.
+     */
+    int add(
+        const TextureRegion &region,
+        float x,
+        float y,
+        float width,
+        float height,
+        float rotation,
+        ::goud_color color
+    ) noexcept {
+        ::goud_sprite_cmd cmd{};
+        cmd.texture = region.texture;
+        cmd.x = x;
+        cmd.y = y;
+        cmd.width = width;
+        cmd.height = height;
+        cmd.rotation = rotation;
+        cmd.src_x = region.src_x;
+        cmd.src_y = region.src_y;
+        cmd.src_w = region.src_w;
+        cmd.src_h = region.src_h;
+        cmd.r = color.r;
+        cmd.g = color.g;
+        cmd.b = color.b;
+        cmd.a = color.a;
+        cmd.z_layer = layer_;
+        return add(cmd);
+    }
+
+    /** @brief Record a fully specified sprite command.
+     *
+     *  In Submission mode the command's z_layer is overwritten with the
+     *  submission layer; in LayerTexture mode it is kept as given.
+     *
+     *  @param cmd  Command to copy into the batch.
+     *  @return SUCCESS, or ERR_INTERNAL_ERROR if the buffer could not grow.
+     */
+    int add(const ::goud_sprite_cmd &cmd) noexcept {
+        if (cmds_.size() >= kMaxCommands) {
+            return ERR_INTERNAL_ERROR;
+        }
+        try {
+            cmds_.push_back(cmd);
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+        ::goud_sprite_cmd &stored = cmds_.back();
+        stored._padding = 0;
+        if (mode_ == SpriteSortMode::Submission) {
+            if (cmds_.size() > 1 && stored.texture != last_texture_) {
+                ++run_layer_;
+            }
+            last_texture_ = stored.texture;
+            stored.z_layer = run_layer_;
+        }
+        return SUCCESS;
+    }
+
+    /** @brief Record @p count fully specified commands at once.
+     *
+     *  Equivalent to add() for each command, but copies the whole span in
+     *  one step in LayerTexture mode.
+     *
+     *  @param cmds   Array of @p count commands.
+     *  @param count  Number of commands.
+     *  @return SUCCESS, ERR_INVALID_STATE if @p cmds is NULL with a non-zero
+     *          @p count, or ERR_INTERNAL_ERROR if the buffer could not grow
+     *          (nothing is recorded then).
+     */
+    int append(const ::goud_sprite_cmd *cmds, std::size_t count) noexcept {
+        if (count == 0) {
+            return SUCCESS;
+        }
+        if (cmds == nullptr) {
+            return ERR_INVALID_STATE;
+        }
+        if (count > kMaxCommands - cmds_.size()) {
+            return ERR_INTERNAL_ERROR;
+        }
+        std::size_t start = cmds_.size();
+        try {
+            cmds_.reserve(start + count);
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+        if (mode_ == SpriteSortMode::Submission) {
+            for (std::size_t i = 0; i < count; ++i) {
+                (void)add(cmds[i]);
+            }
+            return SUCCESS;
+        }
+        cmds_.insert(cmds_.end(), cmds, cmds + count);
+        for (std::size_t i = start; i < cmds_.size(); ++i) {
+            cmds_[i]._padding = 0;
+        }
+        return SUCCESS;
+    }
+
+    /** @brief Select how commands are ordered on flush.
+     *
+     *  Change the mode while the batch is empty; commands already recorded
+     *  keep the z_layer they were given.
+     *
+     *  @param mode  Sort mode.
+     */
+    void setSortMode(SpriteSortMode mode) noexcept {
+        mode_ = mode;
+    }
+
+    /** @brief Current sort mode. */
+    SpriteSortMode sortMode() const noexcept {
+        return mode_;
+    }
+
+    /** @brief Set the layer used by add() in LayerTexture mode.
+     *  @param layer  Z-layer (lower values drawn first).
+     */
+    void setLayer(std::int32_t layer) noexcept {
+        layer_ = layer;
+    }
+
+    /** @brief Layer used by add() in LayerTexture mode. */
+    std::int32_t layer() const noexcept {
+        return layer_;
+    }
+
+    /** @brief Stable-sort the recorded commands by (z_layer, texture).
+     *
+     *  flush() calls this in LayerTexture mode.  If the scratch buffers
+     *  cannot be allocated the commands are left in place; the engine still
+     *  groups them by (z_layer, texture), only with its own comparison sort.
+     *
+     *  @return SUCCESS, or ERR_INTERNAL_ERROR if scratch allocation failed.
+     */
+    int sort() noexcept {
+        std::size_t count = cmds_.size();
+        if (count < 2) {
+            return SUCCESS;
+        }
+        try {
+            keys_.resize(count);
+            keys_scratch_.resize(count);
+            cmds_scratch_.resize(count);
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+
+        // Build keys and find which key bytes differ at all.  An already
+        // sorted batch (the usual case for layer-ordered draw code) needs no
+        // reordering, and a byte shared by every key needs no radix pass.
+        std::uint64_t all_and = ~static_cast<std::uint64_t>(0);
+        std::uint64_t all_or = 0;
+        std::uint64_t previous = 0;
+        bool sorted = true;
+        for (std::size_t i = 0; i < count; ++i) {
+            std::uint64_t key = sortKey(cmds_[i]);
+            keys_[i] = SortEntry{ key, static_cast<std::uint32_t>(i) };
+            all_and &= key;
+            all_or |= key;
+            sorted = sorted && key >= previous;
+            previous = key;
+        }
+        if (sorted) {
+            return SUCCESS;
+        }
+
+        std::uint64_t varying = all_and ^ all_or;
+        std::array<std::uint32_t, 8> shifts{};
+        std::size_t pass_count = 0;
+        for (std::uint32_t shift = 0; shift < 64; shift += 8) {
+            if (((varying >> shift) & 0xFFu) != 0) {
+                shifts[pass_count++] = shift;
+            }
+        }
+
+        std::array<std::array<std::uint32_t, 256>, 8> histograms{};
+        for (std::size_t i = 0; i < count; ++i) {
+            std::uint64_t key = keys_[i].key;
+            for (std::size_t pass = 0; pass < pass_count; ++pass) {
+                ++histograms[pass][(key >> shifts[pass]) & 0xFFu];
+            }
+        }
+
+        SortEntry *src = keys_.data();
+        SortEntry *dst = keys_scratch_.data();
+        for (std::size_t pass = 0; pass < pass_count; ++pass) {
+            std::array<std::uint32_t, 256> &counts = histograms[pass];
+            std::uint32_t shift = shifts[pass];
+            std::uint32_t offset = 0;
+            for (std::uint32_t &bucket : counts) {
+                std::uint32_t bucket_count = bucket;
+                bucket = offset;
+                offset += bucket_count;
+            }
+            for (std::size_t i = 0; i < count; ++i) {
+                dst[counts[(src[i].key >> shift) & 0xFFu]++] = src[i];
+            }
+            SortEntry *swap = src;
+            src = dst;
+            dst = swap;
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            cmds_scratch_[i] = cmds_[src[i].index];
+        }
+        cmds_.swap(cmds_scratch_);
+        return SUCCESS;
+    }
+
+    /** @brief Submit all recorded commands and empty the batch.
+     *
+     *  Commands are sorted first in LayerTexture mode.
+     *
+     *  The batch is emptied even when the engine reports an error, so a
+     *  failed frame does not leak into the next one.
+     *
+     *  @param context          Valid engine context.
+     *  @param[out] out_drawn   Optional; receives the number of sprites drawn.
+     *  @return SUCCESS on success (including an empty batch).
+     */
+    int flush(::goud_context context, std::uint32_t *out_drawn = nullptr) noexcept {
+        if (mode_ == SpriteSortMode::LayerTexture) {
+            (void)sort();
+        }
+        int status = ::goud_renderer_draw_sprite_cmds(
+            context,
+            cmds_.data(),
+            static_cast<std::uint32_t>(cmds_.size()),
+            out_drawn
+        );
+        clear();
+        return status;
+    }
+
+    /** @brief Discard all recorded commands, keeping the allocation. */
+    void clear() noexcept {
+        cmds_.clear();
+        run_layer_ = 0;
+        last_texture_ = 0;
+    }
+
+    /** @brief Number of recorded commands. */
+    std::size_t size() const noexcept {
+        return cmds_.size();
+    }
+
+    /** @brief True when no commands are recorded. */
+    bool empty() const noexcept {
+        return cmds_.empty();
+    }
+
+    /** @brief Number of commands the buffer holds without reallocating. */
+    std::size_t capacity() const noexcept {
+        return cmds_.capacity();
+    }
+
+    /** @brief Pointer to the recorded commands (valid until the next add or flush). */
+    const ::goud_sprite_cmd *data() const noexcept {
+        return cmds_.data();
+    }
+
+    /** @brief Mutable pointer to the recorded commands, e.g. for goud::updateAnimators().
+     *
+     *  Valid until the next add or flush.  Changing a command's texture or
+     *  z_layer in Submission mode bypasses the layer assignment of add().
+     */
+    ::goud_sprite_cmd *data() noexcept {
+        return cmds_.data();
+    }
+
+private:
+    struct SortEntry {
+        std::uint64_t key;
+        std::uint32_t index;
+    };
+
+    static constexpr std::size_t kMaxCommands = std::numeric_limits<std::uint32_t>::max();
+
+    /** Layer in the high word (sign bit flipped so negative layers sort
+     *  first), texture slot index in the low word. */
+    static std::uint64_t sortKey(const ::goud_sprite_cmd &cmd) noexcept {
+        std::uint64_t layer = static_cast<std::uint32_t>(cmd.z_layer) ^ 0x80000000u;
+        return (layer << 32) | (cmd.texture & 0xFFFFFFFFu);
+    }
+
+    std::vector<::goud_sprite_cmd> cmds_;
+    std::vector<::goud_sprite_cmd> cmds_scratch_;
+    std::vector<SortEntry> keys_;
+    std::vector<SortEntry> keys_scratch_;
+    SpriteSortMode mode_ = SpriteSortMode::Submission;
+    std::int32_t layer_ = 0;
+    std::int32_t run_layer_ = 0;
+    ::goud_texture last_texture_ = 0;
+};
+
+}  // namespace goud
+
+#endif
@@ -0,0 +1,181 @@
+#ifndef GOUD_CPP_SPRITE_RECORDER_HPP
+#define GOUD_CPP_SPRITE_RECORDER_HPP
+
+/** @file sprite_recorder.hpp
+ *  @brief Double-buffered sprite recorders filled from worker threads.
+ *
+ *  ParallelSpriteBatch gives each worker its own SpriteBatch to record
+ *  into, so large effects can build their draw commands across cores.
+ *  The render thread then merges every recorder into one sorted batch and
+ *  submits it with a single goud_renderer_draw_sprite_batch() call.
+ *
+ *  Recorders are double-buffered: while the render thread submits the
+ *  frame recorded last, workers can already record the next one.
+ *
+ *  @code
+ *  // Frame loop, with `sprites` a ParallelSpriteBatch of N recorders.
+ *  goud::JobHandle recording = jobs.schedule([&] {
+ *      jobs.parallelFor(0, N, 1, [&](std::size_t lane, std::size_t) {
+ *          buildParticles(lane, sprites.recorder(lane));  // frame n + 1
+ *      });
+ *  });
+ *  ctx.beginFrame();
+ *  sprites.submit(ctx);                                   // frame n
+ *  ctx.endFrame();
+ *  jobs.wait(recording);
+ *  sprites.swap();
+ *  @endcode
+ */
+
+#include <goud/goud.hpp>
+#include <goud/sprite_batch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+namespace goud {
+
+/** @brief Per-worker sprite recorders merged into one draw call.
+ *
+ *  Each recorder is a SpriteBatch in SpriteSortMode::LayerTexture, so the
+ *  worker's setLayer() or per-command z_layer decides draw order.  merge()
+ *  concatenates the recorders in index order and stable-sorts the result
+ *  by (z_layer, texture), so the output does not depend on which thread
+ *  finished first: within one layer and texture, recorder 0's sprites
+ *  draw before recorder 1's, each in the order it recorded them.
+ *
+ *  recorder(i) may be used by one thread at a time, and only between two
+ *  swap() calls.  swap(), merge(), submit(), and setRecorderCount() are
+ *  for the render thread while no worker is recording.  Capacity is kept
+ *  across frames, so a steady-state frame does not allocate.
+ */
+class ParallelSpriteBatch {
+public:
+    /** @brief Construct with no recorders. */
+    ParallelSpriteBatch() noexcept = default;
+
+    /** @brief Construct with @p recorder_count recorders per buffer.
+     *  @param recorder_count  Number of recorders, usually one per worker or chunk.
+     */
+    explicit ParallelSpriteBatch(std::size_t recorder_count) {
+        merged_.setSortMode(SpriteSortMode::LayerTexture);
+        if (setRecorderCount(recorder_count) != SUCCESS) {
+            throw std::bad_alloc();
+        }
+    }
+
+    /** @brief Change the number of recorders.
+     *
+     *  Unsubmitted commands in both buffers are discarded.
+     *
+     *  @param recorder_count  Number of recorders per buffer.
+     *  @return SUCCESS, or ERR_INTERNAL_ERROR if the recorders could not be allocated.
+     */
+    int setRecorderCount(std::size_t recorder_count) noexcept {
+        merged_.setSortMode(SpriteSortMode::LayerTexture);
+        try {
+            for (std::vector<SpriteBatch> &buffer : buffers_) {
+                buffer.resize(recorder_count);
+                for (SpriteBatch &recorder : buffer) {
+                    recorder.clear();
+                    recorder.setSortMode(SpriteSortMode::LayerTexture);
+                }
+            }
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+        return SUCCESS;
+    }
+
+    /** @brief Number of recorders per buffer. */
+    std::size_t recorderCount() const noexcept {
+        return buffers_[recording_].size();
+    }
+
+    /** @brief Recorder @p index of the frame being recorded.
+     *  @param index  Recorder index, less than recorderCount().
+     */
+    SpriteBatch &recorder(std::size_t index) noexcept {
+        return buffers_[recording_][index];
+    }
+
+    /** @brief Finish recording: the recorded frame becomes the one submit() draws.
+     *
+     *  A frame that was recorded but never submitted is dropped.
+     */
+    void swap() noexcept {
+        recording_ ^= 1u;
+        for (SpriteBatch &recorder : buffers_[recording_]) {
+            recorder.clear();
+        }
+    }
+
+    /** @brief Number of commands waiting for submit(). */
+    std::size_t pending() const noexcept {
+        std::size_t total = 0;
+        for (const SpriteBatch &recorder : buffers_[recording_ ^ 1u]) {
+            total += recorder.size();
+        }
+        return total;
+    }
+
+    /** @brief Append the waiting frame to merged(), recorder by recorder.
+     *
+     *  The recorders are emptied.  submit() calls this; call it directly to
+     *  inspect or extend the merged batch before drawing it.  The merged
+     *  batch is put into draw order by its own sort() or flush().
+     *
+     *  @return SUCCESS, or ERR_INTERNAL_ERROR if the merged batch could not
+     *          grow (the frame is then dropped).
+     */
+    int merge() noexcept {
+        std::vector<SpriteBatch> &waiting = buffers_[recording_ ^ 1u];
+        int status = merged_.reserve(merged_.size() + pending());
+        for (SpriteBatch &recorder : waiting) {
+            if (status == SUCCESS) {
+                status = merged_.append(recorder.data(), recorder.size());
+            }
+            recorder.clear();
+        }
+        if (status != SUCCESS) {
+            merged_.clear();
+        }
+        return status;
+    }
+
+    /** @brief Batch built by merge(); submit() draws and empties it. */
+    SpriteBatch &merged() noexcept {
+        return merged_;
+    }
+
+    /** @brief Draw the waiting frame in one goud_renderer_draw_sprite_batch call.
+     *
+     *  Sprites already recorded through Context::drawSprite() are flushed
+     *  first, so they draw underneath.  Call between beginFrame() and
+     *  endFrame().
+     *
+     *  @param context         Context to draw into.
+     *  @param[out] out_drawn  Optional; receives the number of sprites drawn.
+     *  @return SUCCESS on success (including an empty frame).
+     */
+    int submit(const Context &context, std::uint32_t *out_drawn = nullptr) noexcept {
+        int merged = merge();
+        int flushed = context.flushSprites();
+        int status = merged_.flush(context.raw(), out_drawn);
+        if (merged != SUCCESS) {
+            return merged;
+        }
+        return flushed != SUCCESS ? flushed : status;
+    }
+
+private:
+    std::vector<SpriteBatch> buffers_[2];
+    unsigned recording_ = 0;
+    SpriteBatch merged_;
+};
+
+}  // namespace goud
+
+#endif
@@ -0,0 +1,173 @@
+#ifndef GOUD_CPP_STATIC_LAYER_HPP
+#define GOUD_CPP_STATIC_LAYER_HPP
+
+/** @file static_layer.hpp
+ *  @brief Sprite commands uploaded once and drawn from GPU buffers.
+ *
+ *  A StaticLayer hands a set of goud_sprite_cmd entries to
+ *  goud_static_layer_create() once; every frame after that costs one
+ *  goud_static_layer_draw() call and no vertex upload.  Backgrounds and
+ *  tilemaps that scroll with the camera but seldom change should live in a
+ *  StaticLayer instead of being re-recorded into the frame's SpriteBatch.
+ */
+
+#include <goud/goud.h>
+#include <goud/sprite_batch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace goud {
+
+/** @brief Move-only owner of one engine static sprite layer.
+ *
+ *  Commands keep the indices they were passed in, so update() can replace a
+ *  changed range in place.  The layer is destroyed with the object, so it
+ *  must not outlive its context.
+ */
+class StaticLayer {
+public:
+    /** @brief Construct an empty layer (draw() fails until create()). */
+    StaticLayer() noexcept = default;
+
+    /** @brief Destroy the engine layer. */
+    ~StaticLayer() noexcept {
+        reset();
+    }
+
+    StaticLayer(const StaticLayer &) = delete;
+    StaticLayer &operator=(const StaticLayer &) = delete;
+
+    /** @brief Move-construct from another layer. */
+    StaticLayer(StaticLayer &&other) noexcept
+        : context_(other.context_), layer_(other.layer_), size_(other.size_) {
+        other.release();
+    }
+
+    /** @brief Move-assign from another layer. */
+    StaticLayer &operator=(StaticLayer &&other) noexcept {
+        if (this != &other) {
+            reset();
+            context_ = other.context_;
+            layer_ = other.layer_;
+            size_ = other.size_;
+            other.release();
+        }
+        return *this;
+    }
+
+    /** @brief Upload @p count commands, replacing any previous layer.
+     *  @param context  Valid engine context.
+     *  @param cmds     Array of @p count sprite commands.
+     *  @param count    Number of commands in @p cmds (at least 1).
+     *  @return SUCCESS on success.
+     *  @retval ERR_INVALID_STATE  @p cmds is NULL, or @p count is 0 or too large.
+     */
+    int create(::goud_context context, const ::goud_sprite_cmd *cmds, std::size_t count) noexcept {
+        if (count > std::numeric_limits<std::uint32_t>::max()) {
+            return ERR_INVALID_STATE;
+        }
+        reset();
+
+        ::goud_static_layer layer = GOUD_INVALID_STATIC_LAYER;
+        int status = ::goud_static_layer_init(context, cmds, static_cast<std::uint32_t>(count), &layer);
+        if (status != SUCCESS) {
+            return status;
+        }
+        context_ = context;
+        layer_ = layer;
+        size_ = count;
+        return SUCCESS;
+    }
+
+    /** @brief Upload the commands recorded in @p batch.
+     *
+     *  The batch is not flushed or cleared.  In SpriteSortMode::Submission
+     *  the layer draws in the order the sprites were added.
+     */
+    int create(::goud_context context, const SpriteBatch &batch) noexcept {
+        return create(context, batch.data(), batch.size());
+    }
+
+    /** @brief Replace @p count commands starting at index @p first.
+     *
+     *  Only the changed sprites are re-uploaded unless a change moves a
+     *  sprite to another texture or z_layer.
+     *
+     *  @return SUCCESS on success, including when @p count is 0.
+     *  @retval ERR_INVALID_HANDLE  The layer was never created.
+     *  @retval ERR_INVALID_STATE   @p cmds is NULL, or the range runs past size().
+     */
+    int update(std::size_t first, const ::goud_sprite_cmd *cmds, std::size_t count) noexcept {
+        if (!valid()) {
+            return ERR_INVALID_HANDLE;
+        }
+        if (first > size_ || count > size_ - first) {
+            return ERR_INVALID_STATE;
+        }
+        return ::goud_static_layer_write(context_, layer_, static_cast<std::uint32_t>(first), cmds,
+                                         static_cast<std::uint32_t>(count));
+    }
+
+    /** @brief Replace the single command at index @p index. */
+    int update(std::size_t index, const ::goud_sprite_cmd &cmd) noexcept {
+        return update(index, &cmd, 1);
+    }
+
+    /** @brief Draw the layer shifted by (@p offset_x, @p offset_y).
+     *
+     *  Pass the negated camera position to scroll the layer.
+     *
+     *  @param[out] out_drawn  Optional; receives the number of sprites drawn.
+     *  @return SUCCESS on success.
+     *  @retval ERR_INVALID_HANDLE  The layer was never created.
+     */
+    int draw(float offset_x = 0.0f, float offset_y = 0.0f, std::uint32_t *out_drawn = nullptr) noexcept {
+        if (out_drawn != nullptr) {
+            *out_drawn = 0;
+        }
+        if (!valid()) {
+            return ERR_INVALID_HANDLE;
+        }
+        return ::goud_static_layer_render(context_, layer_, offset_x, offset_y, out_drawn);
+    }
+
+    /** @brief Destroy the engine layer.  The object becomes empty. */
+    void reset() noexcept {
+        if (valid()) {
+            (void)::goud_static_layer_dispose(context_, layer_);
+        }
+        release();
+    }
+
+    /** @brief Test whether the layer holds an engine layer. */
+    bool valid() const noexcept {
+        return layer_ != GOUD_INVALID_STATIC_LAYER;
+    }
+
+    /** @brief Number of commands in the layer. */
+    std::size_t size() const noexcept {
+        return size_;
+    }
+
+    /** @brief The raw layer handle, or GOUD_INVALID_STATIC_LAYER. */
+    ::goud_static_layer raw() const noexcept {
+        return layer_;
+    }
+
+private:
+    void release() noexcept {
+        context_ = ::goud_context_invalid();
+        layer_ = GOUD_INVALID_STATIC_LAYER;
+        size_ = 0;
+    }
+
+    ::goud_context context_ = ::goud_context_invalid();
+    ::goud_static_layer layer_ = GOUD_INVALID_STATIC_LAYER;
+    std::size_t size_ = 0;
+};
+
+}  // namespace goud
+
+#endif
@@ -0,0 +1,486 @@
+#ifndef GOUD_CPP_TASK_HPP
+#define GOUD_CPP_TASK_HPP
+
+/** @file task.hpp
+ *  @brief C++20 coroutine gameplay scripts resumed by the frame loop.
+ *
+ *  A goud::Task is a coroutine that reads like the behaviour it scripts
+ *  instead of a hand-written state machine:
+ *
+ *  @code
+ *  goud::Task bird(TweenSet &tweens, goud::AssetFuture<goud_texture> sprite) {
+ *      goud_texture texture = co_await goud::assetLoaded(sprite);
+ *      while (!dead) {
+ *          co_await goud::nextFrame();
+ *          flap(texture);
+ *      }
+ *      co_await goud::tweenDone(tweens, tweens.add(0.0f, 1.0f, 0.5f));
+ *      co_await goud::seconds(1.0f);
+ *  }
+ *
+ *  goud::TaskScheduler tasks;
+ *  tasks.spawn(bird(tweens, loader.loadTexture("bird.png")));
+ *  engine.run([&](float dt) { tasks.tick(dt); ... }, render);
+ *  @endcode
+ *
+ *  A suspended task sits in exactly one scheduler queue and costs nothing
+ *  until it is due: tick() resumes next-frame waiters, then expired timers,
+ *  then waiters whose asset or tween is done, with no virtual update call
+ *  per actor.  Coroutine frames come from a per-thread pool of size-classed
+ *  blocks, and the queues keep their capacity, so a steady population of
+ *  actors spawning and finishing does not touch the heap.
+ *
+ *  This header needs C++20 coroutines.  Under an older standard it defines
+ *  GOUD_HAS_COROUTINES as 0 and nothing else, so the rest of the C++17 SDK
+ *  is unaffected.
+ */
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && __has_include(<coroutine>)
+#define GOUD_HAS_COROUTINES 1
+#else
+#define GOUD_HAS_COROUTINES 0
+#endif
+
+#if GOUD_HAS_COROUTINES
+
+#include <goud/asset_loader.hpp>
+#include <goud/tween_set.hpp>
+
+#include <algorithm>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace goud {
+
+class TaskScheduler;
+
+namespace detail {
+
+/** Per-thread free lists of coroutine frames, one per 64-byte size class.
+ *
+ *  Frames larger than kMaxPooled bytes go straight to the global heap.
+ *  Blocks freed on another thread join that thread's lists.
+ */
+class TaskFramePool {
+public:
+    static constexpr std::size_t kGranule = 64;
+    static constexpr std::size_t kMaxPooled = 2048;
+
+    static void *allocate(std::size_t size) {
+        if (size > kMaxPooled) {
+            return ::operator new(size);
+        }
+        Block *&head = lists().heads[sizeClass(size)];
+        if (head != nullptr) {
+            Block *block = head;
+            head = block->next;
+            --lists().cached;
+            return block;
+        }
+        return ::operator new(roundUp(size));
+    }
+
+    static void deallocate(void *ptr, std::size_t size) noexcept {
+        if (size > kMaxPooled) {
+            ::operator delete(ptr);
+            return;
+        }
+        Block *block = static_cast<Block *>(ptr);
+        Block *&head = lists().heads[sizeClass(size)];
+        block->next = head;
+        head = block;
+        ++lists().cached;
+    }
+
+    /** Number of frames cached on the calling thread. */
+    static std::size_t cached() noexcept {
+        return lists().cached;
+    }
+
+private:
+    struct Block {
+        Block *next;
+    };
+
+    struct Lists {
+        Block *heads[kMaxPooled / kGranule] = {};
+        std::size_t cached = 0;
+
+        ~Lists() {
+            for (Block *head : heads) {
+                while (head != nullptr) {
+                    Block *next = head->next;
+                    ::operator delete(head);
+                    head = next;
+                }
+            }
+        }
+    };
+
+    static Lists &lists() noexcept {
+        thread_local Lists pool;
+        return pool;
+    }
+
+    static std::size_t sizeClass(std::size_t size) noexcept {
+        return size == 0 ? 0 : (size - 1) / kGranule;
+    }
+
+    static std::size_t roundUp(std::size_t size) noexcept {
+        return (sizeClass(size) + 1) * kGranule;
+    }
+};
+
+}  // namespace detail
+
+/** @brief A gameplay coroutine.  Move-only; hand it to TaskScheduler::spawn().
+ *
+ *  The body does not start until spawned.  Destroying a Task that was never
+ *  spawned destroys its frame.  Exceptions escaping the body terminate.
+ */
+class Task {
+public:
+    struct promise_type {
+        TaskScheduler *scheduler = nullptr;
+
+        Task get_return_object() noexcept {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept {
+            return {};
+        }
+        std::suspend_never final_suspend() noexcept {
+            return {};
+        }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept {
+            std::terminate();
+        }
+
+        inline ~promise_type();
+
+        static void *operator new(std::size_t size) {
+            return detail::TaskFramePool::allocate(size);
+        }
+        static void operator delete(void *ptr, std::size_t size) noexcept {
+            detail::TaskFramePool::deallocate(ptr, size);
+        }
+    };
+
+    using Handle = std::coroutine_handle<promise_type>;
+
+    /** @brief Construct an empty task. */
+    Task() noexcept = default;
+
+    ~Task() noexcept {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    Task(const Task &) = delete;
+    Task &operator=(const Task &) = delete;
+
+    /** @brief Move-construct; the source becomes empty. */
+    Task(Task &&other) noexcept
+        : handle_(std::exchange(other.handle_, nullptr)) {}
+
+    /** @brief Move-assign; the source becomes empty. */
+    Task &operator=(Task &&other) noexcept {
+        if (this != &other) {
+            if (handle_) {
+                handle_.destroy();
+            }
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    /** @brief True while the task holds a coroutine that was not spawned yet. */
+    bool valid() const noexcept {
+        return static_cast<bool>(handle_);
+    }
+
+private:
+    friend class TaskScheduler;
+
+    explicit Task(Handle handle) noexcept
+        : handle_(handle) {}
+
+    Handle release() noexcept {
+        return std::exchange(handle_, nullptr);
+    }
+
+    Handle handle_;
+};
+
+/** @brief Owns spawned tasks and resumes them from the frame loop.
+ *
+ *  Non-copyable and non-movable.  Use from one thread: the thread that
+ *  calls spawn() and tick().  The destructor destroys every task that is
+ *  still suspended, running the destructors of its locals.
+ */
+class TaskScheduler {
+public:
+    TaskScheduler() noexcept = default;
+
+    ~TaskScheduler() noexcept {
+        clear();
+    }
+
+    TaskScheduler(const TaskScheduler &) = delete;
+    TaskScheduler &operator=(const TaskScheduler &) = delete;
+
+    /** @brief Take ownership of @p task and run it to its first suspension.
+     *  @return false if @p task is empty.
+     */
+    bool spawn(Task &&task) noexcept {
+        Task::Handle handle = task.release();
+        if (!handle) {
+            return false;
+        }
+        handle.promise().scheduler = this;
+        ++live_;
+        handle.resume();
+        return true;
+    }
+
+    /** @brief Advance the clock by @p delta_time seconds and resume every due task.
+     *
+     *  A task that awaits again while being resumed is not resumed again
+     *  by the same stage, so every tick terminates.
+     */
+    void tick(float delta_time) noexcept {
+        time_ += delta_time > 0.0f ? delta_time : 0.0f;
+        ++frame_;
+
+        resuming_.swap(next_frame_);
+        for (std::coroutine_handle<> handle : resuming_) {
+            handle.resume();
+        }
+        resuming_.clear();
+
+        // seconds() never arms a timer that is already due, so this ends.
+        while (!timers_.empty() && timers_.front().wake <= time_) {
+            std::pop_heap(timers_.begin(), timers_.end(), Timer::later);
+            std::coroutine_handle<> handle = timers_.back().handle;
+            timers_.pop_back();
+            handle.resume();
+        }
+
+        polling_.swap(pollers_);
+        for (const Poller &poller : polling_) {
+            if (poller.ready(poller.awaiter)) {
+                poller.handle.resume();
+            } else {
+                pollers_.push_back(poller);
+            }
+        }
+        polling_.clear();
+    }
+
+    /** @brief Destroy every suspended task without resuming it. */
+    void clear() noexcept {
+        for (std::coroutine_handle<> handle : next_frame_) {
+            handle.destroy();
+        }
+        next_frame_.clear();
+        for (const Timer &timer : timers_) {
+            timer.handle.destroy();
+        }
+        timers_.clear();
+        for (const Poller &poller : pollers_) {
+            poller.handle.destroy();
+        }
+        pollers_.clear();
+    }
+
+    /** @brief Number of spawned tasks that have not finished. */
+    std::size_t live() const noexcept {
+        return live_;
+    }
+
+    /** @brief Seconds accumulated by tick(). */
+    double time() const noexcept {
+        return time_;
+    }
+
+    /** @brief Number of tick() calls so far. */
+    std::uint64_t frame() const noexcept {
+        return frame_;
+    }
+
+    /** @name Awaiter hooks
+     *  Called by the awaitables below from inside a task.
+     *  @{ */
+    void waitFrame(std::coroutine_handle<> handle) {
+        next_frame_.push_back(handle);
+    }
+
+    void waitUntil(double wake, std::coroutine_handle<> handle) {
+        timers_.push_back(Timer{ wake, next_timer_++, handle });
+        std::push_heap(timers_.begin(), timers_.end(), Timer::later);
+    }
+
+    void waitFor(bool (*ready)(const void *), const void *awaiter, std::coroutine_handle<> handle) {
+        pollers_.push_back(Poller{ ready, awaiter, handle });
+    }
+    /** @} */
+
+private:
+    friend struct Task::promise_type;
+
+    struct Timer {
+        double wake;
+        std::uint64_t order;  // FIFO among timers with the same wake time
+        std::coroutine_handle<> handle;
+
+        static bool later(const Timer &a, const Timer &b) noexcept {
+            return a.wake != b.wake ? a.wake > b.wake : a.order > b.order;
+        }
+    };
+
+    struct Poller {
+        bool (*ready)(const void *);
+        const void *awaiter;
+        std::coroutine_handle<> handle;
+    };
+
+    std::vector<std::coroutine_handle<>> next_frame_;
+    std::vector<std::coroutine_handle<>> resuming_;
+    std::vector<Timer> timers_;
+    std::vector<Poller> pollers_;
+    std::vector<Poller> polling_;
+    std::size_t live_ = 0;
+    std::uint64_t next_timer_ = 0;
+    std::uint64_t frame_ = 0;
+    double time_ = 0.0;
+};
+
+inline Task::promise_type::~promise_type() {
+    if (scheduler != nullptr) {
+        --scheduler->live_;
+    }
+}
+
+namespace detail {
+
+/** Base for awaitables: reaches the scheduler through the awaiting task. */
+struct TaskAwaiter {
+    template <typename Promise>
+    static TaskScheduler &schedulerOf(std::coroutine_handle<Promise> handle) noexcept {
+        return *handle.promise().scheduler;
+    }
+};
+
+struct NextFrameAwaiter : TaskAwaiter {
+    bool await_ready() const noexcept {
+        return false;
+    }
+    void await_suspend(Task::Handle handle) {
+        schedulerOf(handle).waitFrame(handle);
+    }
+    void await_resume() const noexcept {}
+};
+
+struct SecondsAwaiter : TaskAwaiter {
+    float delay;
+
+    bool await_ready() const noexcept {
+        return false;
+    }
+    void await_suspend(Task::Handle handle) {
+        TaskScheduler &scheduler = schedulerOf(handle);
+        double wake = scheduler.time() + delay;
+        if (wake > scheduler.time()) {
+            scheduler.waitUntil(wake, handle);
+        } else {
+            scheduler.waitFrame(handle);
+        }
+    }
+    void await_resume() const noexcept {}
+};
+
+template <typename T>
+struct AssetAwaiter : TaskAwaiter {
+    AssetFuture<T> future;
+
+    static bool isReady(const void *self) noexcept {
+        return static_cast<const AssetAwaiter *>(self)->future.ready();
+    }
+    bool await_ready() const noexcept {
+        return future.ready();
+    }
+    void await_suspend(Task::Handle handle) {
+        schedulerOf(handle).waitFor(&AssetAwaiter::isReady, this, handle);
+    }
+    T await_resume() const noexcept {
+        return future.get();
+    }
+};
+
+struct TweenAwaiter : TaskAwaiter {
+    const TweenSet *tweens;
+    TweenId id;
+
+    static bool isDone(const void *self) noexcept {
+        const TweenAwaiter *awaiter = static_cast<const TweenAwaiter *>(self);
+        return awaiter->tweens->finished(awaiter->id) || !awaiter->tweens->contains(awaiter->id);
+    }
+    bool await_ready() const noexcept {
+        return isDone(this);
+    }
+    void await_suspend(Task::Handle handle) {
+        schedulerOf(handle).waitFor(&TweenAwaiter::isDone, this, handle);
+    }
+    void await_resume() const noexcept {}
+};
+
+}  // namespace detail
+
+/** @brief Suspend until the next TaskScheduler::tick(). */
+inline detail::NextFrameAwaiter nextFrame() noexcept {
+    return {};
+}
+
+/** @brief Suspend for @p delay seconds of scheduler time (at least one tick). */
+inline detail::SecondsAwaiter seconds(float delay) noexcept {
+    detail::SecondsAwaiter awaiter;
+    awaiter.delay = delay;
+    return awaiter;
+}
+
+/** @brief Suspend until @p future is ready; resumes with its handle.
+ *
+ *  Returns immediately if it is already ready.  Check future.status() for
+ *  failures: the handle is UINT64_MAX when loading failed.
+ */
+template <typename T>
+inline detail::AssetAwaiter<T> assetLoaded(AssetFuture<T> future) noexcept {
+    detail::AssetAwaiter<T> awaiter;
+    awaiter.future = std::move(future);
+    return awaiter;
+}
+
+/** @brief Suspend until tween @p id in @p tweens finishes or is removed.
+ *
+ *  @p tweens must outlive the wait and be stepped by the caller.  The
+ *  tween is checked after each tick(), so step the set before ticking.
+ */
+inline detail::TweenAwaiter tweenDone(const TweenSet &tweens, TweenId id) noexcept {
+    detail::TweenAwaiter awaiter;
+    awaiter.tweens = &tweens;
+    awaiter.id = id;
+    return awaiter;
+}
+
+}  // namespace goud
+
+#endif  // GOUD_HAS_COROUTINES
+
+#endif
@@ -0,0 +1,285 @@
+#ifndef GOUD_CPP_TEXT_BATCH_HPP
+#define GOUD_CPP_TEXT_BATCH_HPP
+
+/** @file text_batch.hpp
+ *  @brief Reusable text label buffer flushed in one FFI call.
+ *
+ *  goud::Context records drawText() calls into a TextBatch and flushes it
+ *  through goud_renderer_draw_text_batch() on endFrame(), so a frame of HUD
+ *  labels costs one FFI crossing instead of one per label.  The label
+ *  strings are copied into one byte buffer owned by the batch, so dynamic
+ *  text does not need a heap string per label.
+ */
+
+#include <goud/goud.h>
+
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <string_view>
+#include <vector>
+
+namespace goud {
+
+/** @brief Font, size, colour, and layout shared by text labels. */
+struct TextStyle {
+    ::goud_font font = GOUD_INVALID_FONT;               /**< Font handle. */
+    float size = 16.0f;                                 /**< Font size in pixels. */
+    ::goud_color color{ 1.0f, 1.0f, 1.0f, 1.0f };      /**< Text colour. */
+    std::uint8_t alignment = 0;                         /**< 0 = left, 1 = center, 2 = right. */
+    std::uint8_t direction = 0;                         /**< 0 = auto, 1 = left-to-right, 2 = right-to-left. */
+    float max_width = 0.0f;                             /**< Wrap width in pixels; 0 disables wrapping. */
+    float line_spacing = 1.0f;                          /**< Line spacing multiplier. */
+};
+
+/** @brief Contiguous, reusable buffer of goud_text_cmd entries.
+ *
+ *  add() and addFormat() copy the label into the batch's string storage;
+ *  addBorrowed() keeps the caller's pointer, which must stay valid until
+ *  the next flush() or clear().  Empty labels are not recorded.  Labels are
+ *  drawn in the order they were added.
+ *
+ *  Command and string capacity is kept across flushes, so a steady-state
+ *  frame does not allocate.
+ */
+class TextBatch {
+public:
+    /** @brief Construct an empty batch. */
+    TextBatch() noexcept = default;
+
+    /** @brief Construct an empty batch with room for @p capacity labels.
+     *  @param capacity    Number of labels to reserve.
+     *  @param text_bytes  Bytes of string storage to reserve.
+     */
+    explicit TextBatch(std::size_t capacity, std::size_t text_bytes = 0) {
+        cmds_.reserve(capacity);
+        offsets_.reserve(capacity);
+        text_.reserve(text_bytes);
+    }
+
+    /** @brief Reserve room for at least @p capacity labels and @p text_bytes of text.
+     *  @param capacity    Number of labels to reserve.
+     *  @param text_bytes  Bytes of string storage to reserve, including terminators.
+     *  @return SUCCESS, or ERR_INTERNAL_ERROR if the allocation failed.
+     */
+    int reserve(std::size_t capacity, std::size_t text_bytes = 0) noexcept {
+        try {
+            cmds_.reserve(capacity);
+            offsets_.reserve(capacity);
+            text_.reserve(text_bytes);
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+        return SUCCESS;
+    }
+
+    /** @brief Record a label, copying @p text into the batch.
+     *  @param style  Font, size, colour, and layout.
+     *  @param x      X position in screen-space pixels.
+     *  @param y      Y position in screen-space pixels.
+     *  @param text   UTF-8 text (need not be null-terminated).
+     *  @return SUCCESS, or ERR_INTERNAL_ERROR if the buffers could not grow.
+     */
+    int add(const TextStyle &style, float x, float y, std::string_view text) noexcept {
+        if (text.empty()) {
+            return SUCCESS;
+        }
+        std::size_t offset = text_.size();
+        if (text.size() >= kMaxTextBytes - offset) {
+            return ERR_INTERNAL_ERROR;
+        }
+        try {
+            text_.resize(offset + text.size() + 1);
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+        std::memcpy(text_.data() + offset, text.data(), text.size());
+        text_[offset + text.size()] = '\0';
+        int status = record(style, x, y, nullptr, static_cast<std::uint32_t>(offset));
+        if (status != SUCCESS) {
+            text_.resize(offset);
+        }
+        return status;
+    }
+
+    /** @brief Record a label that points at caller-owned text.
+     *
+     *  Nothing is copied; @p text must stay valid until the next flush() or
+     *  clear().  Suited to string literals and other static labels.
+     *
+     *  @param style  Font, size, colour, and layout.
+     *  @param x      X position in screen-space pixels.
+     *  @param y      Y position in screen-space pixels.
+     *  @param text   Null-terminated UTF-8 text.
+     *  @return SUCCESS, or ERR_INTERNAL_ERROR if the buffer could not grow.
+     */
+    int addBorrowed(const TextStyle &style, float x, float y, const char *text) noexcept {
+        if (text == nullptr || text[0] == '\0') {
+            return SUCCESS;
+        }
+        return record(style, x, y, text, kBorrowed);
+    }
+
+    /** @brief Record a printf-formatted label, formatted straight into the batch.
+     *  @param style   Font, size, colour, and layout.
+     *  @param x       X position in screen-space pixels.
+     *  @param y       Y position in screen-space pixels.
+     *  @param format  printf format string.
+     *  @return SUCCESS, ERR_INVALID_STATE for a NULL or bad format, or
+     *          ERR_INTERNAL_ERROR if the buffers could not grow.
+     */
+    int addFormat(const TextStyle &style, float x, float y, const char *format, ...) noexcept {
+        if (format == nullptr) {
+            return ERR_INVALID_STATE;
+        }
+        std::va_list args;
+        va_start(args, format);
+        int status = formatInto(style, x, y, format, args);
+        va_end(args);
+        return status;
+    }
+
+    /** @brief Submit all recorded labels and empty the batch.
+     *
+     *  The batch is emptied even when the engine reports an error, so a
+     *  failed frame does not leak into the next one.
+     *
+     *  @param context          Valid engine context.
+     *  @param[out] out_drawn   Optional; receives the number of labels drawn.
+     *  @return SUCCESS on success (including an empty batch).
+     */
+    int flush(::goud_context context, std::uint32_t *out_drawn = nullptr) noexcept {
+        int status = ::goud_renderer_draw_text_cmds(
+            context,
+            data(),
+            static_cast<std::uint32_t>(cmds_.size()),
+            out_drawn
+        );
+        clear();
+        return status;
+    }
+
+    /** @brief Discard all recorded labels, keeping the allocations. */
+    void clear() noexcept {
+        cmds_.clear();
+        offsets_.clear();
+        text_.clear();
+    }
+
+    /** @brief Number of recorded labels. */
+    std::size_t size() const noexcept {
+        return cmds_.size();
+    }
+
+    /** @brief True when no labels are recorded. */
+    bool empty() const noexcept {
+        return cmds_.empty();
+    }
+
+    /** @brief Number of labels the buffer holds without reallocating. */
+    std::size_t capacity() const noexcept {
+        return cmds_.capacity();
+    }
+
+    /** @brief Bytes of copied text currently stored, including terminators. */
+    std::size_t textBytes() const noexcept {
+        return text_.size();
+    }
+
+    /** @brief Bytes of text the batch holds without reallocating. */
+    std::size_t textCapacity() const noexcept {
+        return text_.capacity();
+    }
+
+    /** @brief Pointer to the recorded commands with their text pointers filled in.
+     *  @return Commands valid until the next add, flush, or clear.
+     */
+    const ::goud_text_cmd *data() noexcept {
+        for (std::size_t i = 0; i < cmds_.size(); ++i) {
+            if (offsets_[i] != kBorrowed) {
+                cmds_[i].text = text_.data() + offsets_[i];
+            }
+        }
+        return cmds_.data();
+    }
+
+private:
+    static constexpr std::uint32_t kBorrowed = std::numeric_limits<std::uint32_t>::max();
+    static constexpr std::size_t kMaxTextBytes = kBorrowed;
+    static constexpr std::size_t kMaxCommands = std::numeric_limits<std::uint32_t>::max();
+    // First vsnprintf attempt; longer labels are formatted a second time.
+    static constexpr std::size_t kFormatGuess = 64;
+
+    int record(const TextStyle &style, float x, float y, const char *text, std::uint32_t offset) noexcept {
+        if (cmds_.size() >= kMaxCommands) {
+            return ERR_INTERNAL_ERROR;
+        }
+        ::goud_text_cmd cmd{};
+        cmd.font_handle = style.font;
+        cmd.text = text;
+        cmd.x = x;
+        cmd.y = y;
+        cmd.font_size = style.size;
+        cmd.alignment = style.alignment;
+        cmd.direction = style.direction;
+        cmd.max_width = style.max_width;
+        cmd.line_spacing = style.line_spacing;
+        cmd.r = style.color.r;
+        cmd.g = style.color.g;
+        cmd.b = style.color.b;
+        cmd.a = style.color.a;
+        try {
+            cmds_.push_back(cmd);
+            offsets_.push_back(offset);
+        } catch (const std::bad_alloc &) {
+            if (cmds_.size() > offsets_.size()) {
+                cmds_.pop_back();
+            }
+            return ERR_INTERNAL_ERROR;
+        }
+        return SUCCESS;
+    }
+
+    int formatInto(const TextStyle &style, float x, float y, const char *format, std::va_list args) noexcept {
+        std::size_t offset = text_.size();
+        std::va_list retry;
+        va_copy(retry, args);
+        int status = SUCCESS;
+        bool recorded = false;
+        try {
+            text_.resize(offset + kFormatGuess);
+            int length = std::vsnprintf(text_.data() + offset, kFormatGuess, format, args);
+            if (length < 0 || static_cast<std::size_t>(length) >= kMaxTextBytes - offset) {
+                status = ERR_INVALID_STATE;
+            } else if (length > 0) {
+                std::size_t bytes = static_cast<std::size_t>(length) + 1;
+                if (bytes > kFormatGuess) {
+                    text_.resize(offset + bytes);
+                    std::vsnprintf(text_.data() + offset, bytes, format, retry);
+                }
+                text_.resize(offset + bytes);
+                status = record(style, x, y, nullptr, static_cast<std::uint32_t>(offset));
+                recorded = status == SUCCESS;
+            }
+        } catch (const std::bad_alloc &) {
+            status = ERR_INTERNAL_ERROR;
+        }
+        va_end(retry);
+        if (!recorded) {
+            text_.resize(offset);
+        }
+        return status;
+    }
+
+    std::vector<::goud_text_cmd> cmds_;
+    std::vector<std::uint32_t> offsets_;
+    std::vector<char> text_;
+};
+
+}  // namespace goud
+
+#endif
@@ -0,0 +1,180 @@
+#ifndef GOUD_CPP_TILEMAP_HPP
+#define GOUD_CPP_TILEMAP_HPP
+
+/** @file tilemap.hpp
+ *  @brief Chunked tile grid drawn with view culling.
+ *
+ *  A Tilemap stores its tile IDs in the engine, split into square chunks.
+ *  goud_tilemap_draw() bakes each visible chunk into a static layer once,
+ *  rebuilds only chunks whose tiles changed, and skips chunks outside the
+ *  window, so a 2048 x 2048 map costs a handful of draw calls per frame and
+ *  never crosses the FFI boundary tile by tile.
+ */
+
+#include <goud/goud.h>
+
+#include <cstdint>
+
+namespace goud {
+
+/** @brief Move-only owner of one engine tilemap.
+ *
+ *  Tile ID @c n draws tileset cell @c n-1 (row-major from the tileset's
+ *  top-left corner) and ID 0 is empty.  The tilemap is destroyed with the
+ *  object, so it must not outlive its context.
+ */
+class Tilemap {
+public:
+    /** @brief Construct an empty tilemap (draw() fails until create()). */
+    Tilemap() noexcept = default;
+
+    /** @brief Destroy the engine tilemap. */
+    ~Tilemap() noexcept {
+        reset();
+    }
+
+    Tilemap(const Tilemap &) = delete;
+    Tilemap &operator=(const Tilemap &) = delete;
+
+    /** @brief Move-construct from another tilemap. */
+    Tilemap(Tilemap &&other) noexcept
+        : context_(other.context_), tilemap_(other.tilemap_), columns_(other.columns_), rows_(other.rows_) {
+        other.release();
+    }
+
+    /** @brief Move-assign from another tilemap. */
+    Tilemap &operator=(Tilemap &&other) noexcept {
+        if (this != &other) {
+            reset();
+            context_ = other.context_;
+            tilemap_ = other.tilemap_;
+            columns_ = other.columns_;
+            rows_ = other.rows_;
+            other.release();
+        }
+        return *this;
+    }
+
+    /** @brief Create an empty @p columns x @p rows map, replacing any previous one.
+     *  @param context      Valid engine context.
+     *  @param tileset      Tileset texture.
+     *  @param columns      Map width in tiles.
+     *  @param rows         Map height in tiles.
+     *  @param tile_width   Tile width in pixels, in the tileset and on screen.
+     *  @param tile_height  Tile height in pixels, in the tileset and on screen.
+     *  @param chunk_size   Chunk edge in tiles (0 = GOUD_TILEMAP_DEFAULT_CHUNK_SIZE).
+     *  @return SUCCESS on success.
+     */
+    int create(::goud_context context,
+               ::goud_texture tileset,
+               std::uint32_t columns,
+               std::uint32_t rows,
+               std::uint32_t tile_width,
+               std::uint32_t tile_height,
+               std::uint32_t chunk_size = 0) noexcept {
+        reset();
+
+        ::goud_tilemap tilemap = GOUD_INVALID_TILEMAP;
+        int status = ::goud_tilemap_init(context, tileset, columns, rows, tile_width, tile_height, chunk_size,
+                                         &tilemap);
+        if (status != SUCCESS) {
+            return status;
+        }
+        context_ = context;
+        tilemap_ = tilemap;
+        columns_ = columns;
+        rows_ = rows;
+        return SUCCESS;
+    }
+
+    /** @brief Write a @p width x @p height block of row-major tile IDs at (@p x, @p y).
+     *
+     *  Chunks whose tiles change are rebuilt the next time they are drawn;
+     *  batch edits into one call where possible.
+     *
+     *  @return SUCCESS on success, including for an empty block.
+     *  @retval ERR_INVALID_HANDLE  The tilemap was never created.
+     *  @retval ERR_INVALID_STATE   @p tiles is NULL, or the block runs past the map.
+     */
+    int setTiles(std::uint32_t x,
+                 std::uint32_t y,
+                 std::uint32_t width,
+                 std::uint32_t height,
+                 const std::uint32_t *tiles) noexcept {
+        if (!valid()) {
+            return ERR_INVALID_HANDLE;
+        }
+        if (x > columns_ || width > columns_ - x || y > rows_ || height > rows_ - y) {
+            return ERR_INVALID_STATE;
+        }
+        return ::goud_tilemap_write(context_, tilemap_, x, y, width, height, tiles);
+    }
+
+    /** @brief Set the single tile at (@p x, @p y). */
+    int setTile(std::uint32_t x, std::uint32_t y, std::uint32_t tile) noexcept {
+        return setTiles(x, y, 1, 1, &tile);
+    }
+
+    /** @brief Draw the visible chunks with the map's top-left corner at (@p offset_x, @p offset_y).
+     *
+     *  Pass the negated camera position to scroll.
+     *
+     *  @param[out] out_drawn  Optional; receives the number of tiles drawn.
+     *  @return SUCCESS on success, including when no tile is visible.
+     *  @retval ERR_INVALID_HANDLE  The tilemap was never created.
+     */
+    int draw(float offset_x = 0.0f, float offset_y = 0.0f, std::uint32_t *out_drawn = nullptr) noexcept {
+        if (out_drawn != nullptr) {
+            *out_drawn = 0;
+        }
+        if (!valid()) {
+            return ERR_INVALID_HANDLE;
+        }
+        return ::goud_tilemap_render(context_, tilemap_, offset_x, offset_y, out_drawn);
+    }
+
+    /** @brief Destroy the engine tilemap.  The object becomes empty. */
+    void reset() noexcept {
+        if (valid()) {
+            (void)::goud_tilemap_dispose(context_, tilemap_);
+        }
+        release();
+    }
+
+    /** @brief Test whether the object holds an engine tilemap. */
+    bool valid() const noexcept {
+        return tilemap_ != GOUD_INVALID_TILEMAP;
+    }
+
+    /** @brief Map width in tiles. */
+    std::uint32_t columns() const noexcept {
+        return columns_;
+    }
+
+    /** @brief Map height in tiles. */
+    std::uint32_t rows() const noexcept {
+        return rows_;
+    }
+
+    /** @brief The raw tilemap handle, or GOUD_INVALID_TILEMAP. */
+    ::goud_tilemap raw() const noexcept {
+        return tilemap_;
+    }
+
+private:
+    void release() noexcept {
+        context_ = ::goud_context_invalid();
+        tilemap_ = GOUD_INVALID_TILEMAP;
+        columns_ = 0;
+        rows_ = 0;
+    }
+
+    ::goud_context context_ = ::goud_context_invalid();
+    ::goud_tilemap tilemap_ = GOUD_INVALID_TILEMAP;
+    std::uint32_t columns_ = 0;
+    std::uint32_t rows_ = 0;
+};
+
+}  // namespace goud
+
+#endif
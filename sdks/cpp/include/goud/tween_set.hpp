@@ -0,0 +1,353 @@
+#ifndef GOUD_CPP_TWEEN_SET_HPP
+#define GOUD_CPP_TWEEN_SET_HPP
+
+/** @file tween_set.hpp
+ *  @brief Structure-of-arrays tween storage stepped in one FFI call.
+ *
+ *  goud_tween_create() and friends keep one engine tween per handle, so a
+ *  menu with thousands of hover, fade, and bounce tweens costs thousands of
+ *  FFI calls a frame plus one destroy per finished tween.  TweenSet keeps
+ *  start, end, duration, elapsed, and easing in parallel arrays, advances
+ *  them all with one goud_tween_step_batch() call, and drops finished tweens
+ *  with one compaction pass.  Values match goud_tween_update() followed by
+ *  goud_tween_value() for the same easing.
+ */
+
+#include <goud/goud.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <vector>
+
+namespace goud {
+
+/** @brief Easing curve of a TweenSet tween (same ids as goud_tween_create()). */
+enum class TweenEasing : std::uint8_t {
+    Linear = 0,
+    EaseIn = 1,
+    EaseOut = 2,
+    EaseInOut = 3,
+    EaseInBack = 4,
+    EaseOutBounce = 5,
+};
+
+/** @brief Packed tween ID (generation in the upper 32 bits, index in the lower). */
+using TweenId = std::uint64_t;
+
+/** @brief Sentinel for "no tween". */
+inline constexpr TweenId kInvalidTween = std::numeric_limits<TweenId>::max();
+
+/** @brief Set of scalar tweens stored as parallel arrays.
+ *
+ *  @code
+ *  goud::TweenSet tweens;
+ *  goud::TweenId fade = tweens.add(0.0f, 1.0f, 0.25f, goud::TweenEasing::EaseOut);
+ *  // each frame:
+ *  tweens.step(dt);
+ *  float alpha = tweens.value(fade);
+ *  tweens.removeFinished();
+ *  @endcode
+ *
+ *  IDs stay valid until their tween is removed; a stale ID is never
+ *  mistaken for a later tween.  Storage is dense, so step() and
+ *  removeFinished() are linear passes over contiguous arrays, and capacity
+ *  is kept so a steady-state set does not allocate.
+ */
+class TweenSet {
+public:
+    /** @brief Construct an empty set. */
+    TweenSet() noexcept = default;
+
+    /** @brief Reserve room for at least @p capacity tweens.
+     *  @return SUCCESS, or ERR_INTERNAL_ERROR if the allocation failed.
+     */
+    int reserve(std::size_t capacity) noexcept {
+        try {
+            start_.reserve(capacity);
+            end_.reserve(capacity);
+            duration_.reserve(capacity);
+            elapsed_.reserve(capacity);
+            values_.reserve(capacity);
+            easing_.reserve(capacity);
+            ids_.reserve(capacity);
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+        return SUCCESS;
+    }
+
+    /** @brief Add a tween from @p start to @p end over @p duration seconds.
+     *
+     *  Negative durations count as 0; such a tween is already finished and
+     *  holds @p end.
+     *
+     *  @return The new tween's ID, or kInvalidTween if @p easing is unknown
+     *          or the arrays could not grow.
+     */
+    TweenId add(float start, float end, float duration, TweenEasing easing = TweenEasing::Linear) noexcept {
+        if (static_cast<std::uint8_t>(easing) > static_cast<std::uint8_t>(TweenEasing::EaseOutBounce) ||
+            ids_.size() >= kMaxTweens) {
+            return kInvalidTween;
+        }
+        std::size_t count = ids_.size();
+        std::uint32_t index;
+        try {
+            if (free_.empty() && slots_.size() == slots_.capacity()) {
+                slots_.reserve(slots_.empty() ? 16 : slots_.size() * 2);
+            }
+            if (!hasRoom(count)) {
+                std::size_t grown = count == 0 ? 16 : count * 2;
+                start_.reserve(grown);
+                end_.reserve(grown);
+                duration_.reserve(grown);
+                elapsed_.reserve(grown);
+                values_.reserve(grown);
+                easing_.reserve(grown);
+                ids_.reserve(grown);
+            }
+        } catch (const std::bad_alloc &) {
+            return kInvalidTween;
+        }
+        // Every push below fits in reserved capacity and cannot throw.
+        if (free_.empty()) {
+            index = static_cast<std::uint32_t>(slots_.size());
+            slots_.push_back(Slot{});
+        } else {
+            index = free_.back();
+            free_.pop_back();
+        }
+        Slot &slot = slots_[index];
+        slot.dense = static_cast<std::uint32_t>(count);
+        TweenId id = (static_cast<TweenId>(slot.generation) << 32) | index;
+
+        duration = duration > 0.0f ? duration : 0.0f;
+        start_.push_back(start);
+        end_.push_back(end);
+        duration_.push_back(duration);
+        elapsed_.push_back(0.0f);
+        values_.push_back(duration > 0.0f ? start : end);
+        easing_.push_back(static_cast<std::uint8_t>(easing));
+        ids_.push_back(id);
+        return id;
+    }
+
+    /** @brief Check whether @p id names a tween in this set. */
+    bool contains(TweenId id) const noexcept {
+        return denseIndex(id) != kNoSlot;
+    }
+
+    /** @brief Value of @p id after the last step(), or @p fallback for unknown IDs. */
+    float value(TweenId id, float fallback = 0.0f) const noexcept {
+        std::uint32_t dense = denseIndex(id);
+        return dense == kNoSlot ? fallback : values_[dense];
+    }
+
+    /** @brief Check whether @p id has reached its duration (false for unknown IDs). */
+    bool finished(TweenId id) const noexcept {
+        std::uint32_t dense = denseIndex(id);
+        return dense != kNoSlot && elapsed_[dense] >= duration_[dense];
+    }
+
+    /** @brief Rewind @p id to its start.
+     *  @return SUCCESS, or ERR_INVALID_STATE for unknown IDs.
+     */
+    int restart(TweenId id) noexcept {
+        std::uint32_t dense = denseIndex(id);
+        if (dense == kNoSlot) {
+            return ERR_INVALID_STATE;
+        }
+        elapsed_[dense] = 0.0f;
+        values_[dense] = duration_[dense] > 0.0f ? start_[dense] : end_[dense];
+        return SUCCESS;
+    }
+
+    /** @brief Remove @p id; the last tween moves into its place.
+     *  @return true if @p id was in the set.
+     */
+    bool remove(TweenId id) noexcept {
+        std::uint32_t dense = denseIndex(id);
+        if (dense == kNoSlot) {
+            return false;
+        }
+        release(ids_[dense]);
+        std::size_t last = ids_.size() - 1;
+        if (dense != last) {
+            moveTween(last, dense);
+        }
+        popBack();
+        return true;
+    }
+
+    /** @brief Advance every tween by @p dt seconds and refresh its value.
+     *
+     *  One goud_tween_step_batch() call however many tweens are held.
+     *
+     *  @param dt                Seconds to advance.
+     *  @param[out] out_finished Optional; receives the number of finished tweens.
+     *  @return SUCCESS on success (including an empty set).
+     */
+    int step(float dt, std::uint32_t *out_finished = nullptr) noexcept {
+        if (out_finished != nullptr) {
+            *out_finished = 0;
+        }
+        if (ids_.empty()) {
+            return SUCCESS;
+        }
+        std::int32_t finished = ::goud_tween_step_batch(
+            start_.data(),
+            end_.data(),
+            duration_.data(),
+            elapsed_.data(),
+            easing_.data(),
+            static_cast<std::uint32_t>(ids_.size()),
+            dt,
+            values_.data()
+        );
+        if (finished < 0) {
+            return ::goud_status_last_error_or(-finished);
+        }
+        if (out_finished != nullptr) {
+            *out_finished = static_cast<std::uint32_t>(finished);
+        }
+        return SUCCESS;
+    }
+
+    /** @brief Drop every finished tween in one pass; their IDs become invalid.
+     *
+     *  Read final values before calling this.  Remaining tweens keep their
+     *  relative order.
+     *
+     *  @return Number of tweens removed.
+     */
+    std::size_t removeFinished() noexcept {
+        std::size_t count = ids_.size();
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (elapsed_[i] >= duration_[i]) {
+                release(ids_[i]);
+                continue;
+            }
+            if (kept != i) {
+                moveTween(i, kept);
+            }
+            ++kept;
+        }
+        std::size_t removed = count - kept;
+        while (ids_.size() > kept) {
+            popBack();
+        }
+        return removed;
+    }
+
+    /** @brief Remove every tween, keeping the allocations. */
+    void clear() noexcept {
+        for (TweenId id : ids_) {
+            release(id);
+        }
+        start_.clear();
+        end_.clear();
+        duration_.clear();
+        elapsed_.clear();
+        values_.clear();
+        easing_.clear();
+        ids_.clear();
+    }
+
+    /** @brief Number of tweens held. */
+    std::size_t size() const noexcept {
+        return ids_.size();
+    }
+
+    /** @brief True when no tweens are held. */
+    bool empty() const noexcept {
+        return ids_.empty();
+    }
+
+    /** @brief Tween IDs in storage order (valid until the next add or removal). */
+    const TweenId *ids() const noexcept {
+        return ids_.data();
+    }
+
+    /** @brief Values in storage order, parallel to ids(). */
+    const float *values() const noexcept {
+        return values_.data();
+    }
+
+private:
+    struct Slot {
+        std::uint32_t dense = 0;
+        std::uint32_t generation = 0;
+    };
+
+    static constexpr std::uint32_t kNoSlot = std::numeric_limits<std::uint32_t>::max();
+    static constexpr std::size_t kMaxTweens = static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max());
+
+    std::uint32_t denseIndex(TweenId id) const noexcept {
+        auto index = static_cast<std::uint32_t>(id & 0xFFFFFFFFu);
+        if (id == kInvalidTween || index >= slots_.size()) {
+            return kNoSlot;
+        }
+        const Slot &slot = slots_[index];
+        if (slot.generation != static_cast<std::uint32_t>(id >> 32) || slot.dense == kNoSlot) {
+            return kNoSlot;
+        }
+        return slot.dense;
+    }
+
+    /** True when every array can take one more tween without reallocating. */
+    bool hasRoom(std::size_t count) const noexcept {
+        return start_.capacity() > count && end_.capacity() > count &&
+               duration_.capacity() > count && elapsed_.capacity() > count &&
+               values_.capacity() > count && easing_.capacity() > count && ids_.capacity() > count;
+    }
+
+    /** Invalidate @p id and recycle its slot.  Does not touch the arrays. */
+    void release(TweenId id) noexcept {
+        auto index = static_cast<std::uint32_t>(id & 0xFFFFFFFFu);
+        Slot &slot = slots_[index];
+        slot.dense = kNoSlot;
+        ++slot.generation;
+        try {
+            free_.push_back(index);
+        } catch (const std::bad_alloc &) {
+            // The slot is leaked; IDs stay unique.
+        }
+    }
+
+    void moveTween(std::size_t from, std::size_t to) noexcept {
+        start_[to] = start_[from];
+        end_[to] = end_[from];
+        duration_[to] = duration_[from];
+        elapsed_[to] = elapsed_[from];
+        values_[to] = values_[from];
+        easing_[to] = easing_[from];
+        ids_[to] = ids_[from];
+        slots_[static_cast<std::uint32_t>(ids_[to] & 0xFFFFFFFFu)].dense = static_cast<std::uint32_t>(to);
+    }
+
+    void popBack() noexcept {
+        start_.pop_back();
+        end_.pop_back();
+        duration_.pop_back();
+        elapsed_.pop_back();
+        values_.pop_back();
+        easing_.pop_back();
+        ids_.pop_back();
+    }
+
+    std::vector<float> start_;
+    std::vector<float> end_;
+    std::vector<float> duration_;
+    std::vector<float> elapsed_;
+    std::vector<float> values_;
+    std::vector<std::uint8_t> easing_;
+    std::vector<TweenId> ids_;
+    std::vector<Slot> slots_;
+    std::vector<std::uint32_t> free_;
+};
+
+}  // namespace goud
+
+#endif
@@ -0,0 +1,449 @@
+#ifndef GOUD_CPP_UI_TREE_HPP
+#define GOUD_CPP_UI_TREE_HPP
+
+/** @file ui_tree.hpp
+ *  @brief RAII UI manager with batched node mutation.
+ *
+ *  Building a screen through the single-property goud_ui_* calls costs one
+ *  FFI crossing per node and per field.  UiTree::batch() records creates,
+ *  reparents, and property changes into a UiBatch and applies them with one
+ *  goud_ui_apply_commands() call.  The engine tracks which nodes a batch
+ *  touched, so the next update() re-lays-out only their sibling groups
+ *  rather than the whole tree.
+ */
+
+#include <goud/goud.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace goud {
+
+/** @brief Packed UI node ID (generation in the upper 32 bits, index in the lower). */
+using UiNodeId = std::uint64_t;
+
+/** @brief Sentinel for "no node". */
+inline constexpr UiNodeId kInvalidUiNode = INVALID_NODE_U64;
+
+/** @brief Style overrides for UiBatch::setStyle(); string pointers are borrowed. */
+using UiStyle = ::FfiUiStyle;
+
+/** @brief Widget attached to a UI node. */
+enum class UiWidget : std::int32_t {
+    None = -1,
+    Panel = 0,
+    Button = 1,
+    Label = 2,
+    Image = 3,
+    Slider = 4,
+};
+
+/** @brief Recorded UI mutations, applied in order by UiTree::apply().
+ *
+ *  createNode() returns a reference to the node the command will create,
+ *  usable by later commands in the same batch; after apply(), resolve()
+ *  maps it to the real node ID.  Text is copied into the batch; the string
+ *  pointers in a UiStyle are borrowed and must stay valid until apply().
+ *
+ *  A failed recording call (out of memory) is sticky: apply() then refuses
+ *  the whole batch, so a builder may ignore the per-call results.
+ *  Capacity is kept across clear(), so a reused batch does not allocate.
+ */
+class UiBatch {
+public:
+    /** @brief Construct an empty batch. */
+    UiBatch() noexcept = default;
+
+    /** @brief Record creating a node.
+     *  @return A reference to the new node, or kInvalidUiNode if recording failed.
+     */
+    UiNodeId createNode(UiWidget widget) noexcept {
+        std::size_t index = commands_.size();
+        if (index > kMaxCommandIndex) {
+            status_ = ERR_INTERNAL_ERROR;
+            return kInvalidUiNode;
+        }
+        ::FfiUiCommand command = makeCommand(UI_COMMAND_CREATE_NODE, kInvalidUiNode);
+        command.widget_kind = static_cast<std::int32_t>(widget);
+        if (record(command) != SUCCESS) {
+            return kInvalidUiNode;
+        }
+        return static_cast<UiNodeId>(UI_COMMAND_RESULT_REF) | index;
+    }
+
+    /** @brief Record removing @p node and its subtree. */
+    int removeNode(UiNodeId node) noexcept {
+        return record(makeCommand(UI_COMMAND_REMOVE_NODE, node));
+    }
+
+    /** @brief Record attaching @p child to @p parent (kInvalidUiNode detaches). */
+    int setParent(UiNodeId child, UiNodeId parent) noexcept {
+        ::FfiUiCommand command = makeCommand(UI_COMMAND_SET_PARENT, child);
+        command.parent_id = parent;
+        return record(command);
+    }
+
+    /** @brief Record replacing @p node's widget with a default one. */
+    int setWidget(UiNodeId node, UiWidget widget) noexcept {
+        ::FfiUiCommand command = makeCommand(UI_COMMAND_SET_WIDGET, node);
+        command.widget_kind = static_cast<std::int32_t>(widget);
+        return record(command);
+    }
+
+    /** @brief Record style overrides; a style with no @c has_* flag clears them. */
+    int setStyle(UiNodeId node, const UiStyle &style) noexcept {
+        std::size_t index = styles_.size();
+        try {
+            styles_.push_back(style);
+        } catch (const std::bad_alloc &) {
+            status_ = ERR_INTERNAL_ERROR;
+            return status_;
+        }
+        int status = record(makeCommand(UI_COMMAND_SET_STYLE, node), index);
+        if (status != SUCCESS) {
+            styles_.pop_back();
+        }
+        return status;
+    }
+
+    /** @brief Record setting a label's text, copying @p text into the batch. */
+    int setLabelText(UiNodeId node, std::string_view text) noexcept {
+        return recordText(UI_COMMAND_SET_LABEL_TEXT, node, text);
+    }
+
+    /** @brief Record setting a button's enabled flag. */
+    int setButtonEnabled(UiNodeId node, bool enabled) noexcept {
+        ::FfiUiCommand command = makeCommand(UI_COMMAND_SET_BUTTON_ENABLED, node);
+        command.flag = enabled;
+        return record(command);
+    }
+
+    /** @brief Record setting an image's texture path, copying @p path into the batch. */
+    int setImageTexturePath(UiNodeId node, std::string_view path) noexcept {
+        return recordText(UI_COMMAND_SET_IMAGE_TEXTURE_PATH, node, path);
+    }
+
+    /** @brief Record setting a slider's range, value, and enabled flag. */
+    int setSlider(UiNodeId node, float min, float max, float value, bool enabled = true) noexcept {
+        ::FfiUiCommand command = makeCommand(UI_COMMAND_SET_SLIDER, node);
+        command.x = min;
+        command.y = max;
+        command.z = value;
+        command.flag = enabled;
+        return record(command);
+    }
+
+    /** @brief Record an absolute screen-space position for @p node. */
+    int setPosition(UiNodeId node, float x, float y) noexcept {
+        ::FfiUiCommand command = makeCommand(UI_COMMAND_SET_NODE_POSITION, node);
+        command.x = x;
+        command.y = y;
+        return record(command);
+    }
+
+    /** @brief Record @p node's visibility. */
+    int setVisible(UiNodeId node, bool visible) noexcept {
+        ::FfiUiCommand command = makeCommand(UI_COMMAND_SET_NODE_VISIBLE, node);
+        command.flag = visible;
+        return record(command);
+    }
+
+    /** @brief Record @p node's layout size in pixels. */
+    int setSize(UiNodeId node, float width, float height) noexcept {
+        ::FfiUiCommand command = makeCommand(UI_COMMAND_SET_NODE_SIZE, node);
+        command.x = width;
+        command.y = height;
+        return record(command);
+    }
+
+    /** @brief Map a reference from createNode() to the node ID the last apply() created.
+     *  @return The node ID, @p node itself when it is not a reference, or
+     *          kInvalidUiNode when the referenced command was not applied.
+     */
+    UiNodeId resolve(UiNodeId node) const noexcept {
+        if ((node & kRefMask) != UI_COMMAND_RESULT_REF) {
+            return node;
+        }
+        std::size_t index = static_cast<std::size_t>(node & ~kRefMask);
+        return index < results_.size() ? results_[index] : kInvalidUiNode;
+    }
+
+    /** @brief Discard recorded commands, results, and a sticky error, keeping the allocations. */
+    void clear() noexcept {
+        commands_.clear();
+        payloads_.clear();
+        styles_.clear();
+        text_.clear();
+        results_.clear();
+        status_ = SUCCESS;
+    }
+
+    /** @brief Number of recorded commands. */
+    std::size_t size() const noexcept {
+        return commands_.size();
+    }
+
+    /** @brief True when no commands are recorded. */
+    bool empty() const noexcept {
+        return commands_.empty();
+    }
+
+    /** @brief SUCCESS, or ERR_INTERNAL_ERROR if a recording call failed since the last clear(). */
+    int status() const noexcept {
+        return status_;
+    }
+
+    /** @brief Bytes of copied text currently stored. */
+    std::size_t textBytes() const noexcept {
+        return text_.size();
+    }
+
+    /** @brief Pointer to the recorded commands with their text and style pointers filled in.
+     *  @return Commands valid until the next recording call or clear().
+     */
+    const ::FfiUiCommand *data() noexcept {
+        for (std::size_t i = 0; i < commands_.size(); ++i) {
+            ::FfiUiCommand &command = commands_[i];
+            if (payloads_[i] == kNoPayload) {
+                continue;
+            }
+            if (command.kind == UI_COMMAND_SET_STYLE) {
+                command.style = &styles_[payloads_[i]];
+            } else {
+                command.text_ptr = reinterpret_cast<const std::uint8_t *>(text_.data()) + payloads_[i];
+            }
+        }
+        return commands_.data();
+    }
+
+private:
+    friend class UiTree;
+
+    static constexpr std::size_t kNoPayload = std::numeric_limits<std::size_t>::max();
+    static constexpr std::size_t kMaxCommandIndex = std::numeric_limits<std::uint32_t>::max() - 1;
+    static constexpr UiNodeId kRefMask = 0xFFFFFFFF00000000ull;
+
+    static ::FfiUiCommand makeCommand(std::uint32_t kind, UiNodeId node) noexcept {
+        ::FfiUiCommand command{};
+        command.kind = kind;
+        command.widget_kind = static_cast<std::int32_t>(UiWidget::None);
+        command.node_id = node;
+        command.parent_id = kInvalidUiNode;
+        return command;
+    }
+
+    int record(const ::FfiUiCommand &command, std::size_t payload = kNoPayload) noexcept {
+        if (commands_.size() > kMaxCommandIndex) {
+            status_ = ERR_INTERNAL_ERROR;
+            return status_;
+        }
+        try {
+            commands_.push_back(command);
+            payloads_.push_back(payload);
+        } catch (const std::bad_alloc &) {
+            if (commands_.size() > payloads_.size()) {
+                commands_.pop_back();
+            }
+            status_ = ERR_INTERNAL_ERROR;
+            return status_;
+        }
+        return SUCCESS;
+    }
+
+    int recordText(std::uint32_t kind, UiNodeId node, std::string_view text) noexcept {
+        ::FfiUiCommand command = makeCommand(kind, node);
+        command.text_len = text.size();
+        if (text.empty()) {
+            return record(command);
+        }
+        std::size_t offset = text_.size();
+        try {
+            text_.resize(offset + text.size());
+        } catch (const std::bad_alloc &) {
+            status_ = ERR_INTERNAL_ERROR;
+            return status_;
+        }
+        std::memcpy(text_.data() + offset, text.data(), text.size());
+        int status = record(command, offset);
+        if (status != SUCCESS) {
+            text_.resize(offset);
+        }
+        return status;
+    }
+
+    std::vector<::FfiUiCommand> commands_;
+    std::vector<std::size_t> payloads_;
+    std::vector<UiStyle> styles_;
+    std::vector<char> text_;
+    std::vector<UiNodeId> results_;
+    int status_ = SUCCESS;
+};
+
+/** @brief Owning wrapper for a standalone UI manager.
+ *
+ *  Move-only; the manager is destroyed with the tree.  Layout is computed
+ *  by update(), which only revisits the sibling groups of nodes changed
+ *  since the previous update; creating, removing, or reparenting nodes
+ *  still lays out the whole tree once.  Not thread-safe.
+ */
+class UiTree {
+public:
+    /** @brief Create a UI manager; check valid() before use. */
+    UiTree() noexcept : manager_(::goud_ui_manager_create()) {}
+
+    /** @brief Destroy the UI manager and every node in it. */
+    ~UiTree() noexcept {
+        reset();
+    }
+
+    UiTree(const UiTree &) = delete;
+    UiTree &operator=(const UiTree &) = delete;
+
+    /** @brief Move-construct from another tree. */
+    UiTree(UiTree &&other) noexcept
+        : manager_(std::exchange(other.manager_, nullptr)), batch_(std::move(other.batch_)) {}
+
+    /** @brief Move-assign from another tree. */
+    UiTree &operator=(UiTree &&other) noexcept {
+        if (this != &other) {
+            reset();
+            manager_ = std::exchange(other.manager_, nullptr);
+            batch_ = std::move(other.batch_);
+        }
+        return *this;
+    }
+
+    /** @brief Check whether the tree holds a UI manager. */
+    bool valid() const noexcept {
+        return manager_ != nullptr;
+    }
+
+    /** @brief Underlying manager pointer for the raw goud_ui_* calls. */
+    ::UiManager *raw() const noexcept {
+        return manager_;
+    }
+
+    /** @brief Apply every command in @p batch with one FFI call.
+     *
+     *  Commands are applied in order and application stops at the first
+     *  one the engine rejects; the commands before it stay applied.  The
+     *  batch's recorded commands are kept, and batch.resolve() maps its
+     *  createNode() references to the created nodes.
+     *
+     *  @param batch              Commands to apply.
+     *  @param[out] out_applied   Optional; receives the number of commands applied.
+     *  @return SUCCESS when every command was applied (including an empty batch).
+     *  @retval ERR_INVALID_STATE   The tree is invalid or the engine rejected a command
+     *                              (unknown node, bad UTF-8, unknown widget).
+     *  @retval ERR_INTERNAL_ERROR  Recording into @p batch failed; nothing was applied.
+     */
+    int apply(UiBatch &batch, std::size_t *out_applied = nullptr) noexcept {
+        if (out_applied != nullptr) {
+            *out_applied = 0;
+        }
+        batch.results_.clear();
+        if (batch.status() != SUCCESS) {
+            return batch.status();
+        }
+        if (!valid()) {
+            return ERR_INVALID_STATE;
+        }
+        if (batch.empty()) {
+            return SUCCESS;
+        }
+        try {
+            batch.results_.resize(batch.size());
+        } catch (const std::bad_alloc &) {
+            return ERR_INTERNAL_ERROR;
+        }
+
+        std::uint32_t applied = 0;
+        std::int32_t code = ::goud_ui_apply_commands(manager_,
+                                                     batch.data(),
+                                                     static_cast<std::uint32_t>(batch.size()),
+                                                     batch.results_.data(),
+                                                     &applied);
+        if (out_applied != nullptr) {
+            *out_applied = applied;
+        }
+        return code == 0 ? SUCCESS : ERR_INVALID_STATE;
+    }
+
+    /** @brief Record mutations with @p build and apply them in one call.
+     *
+     *  @p build is invoked as <tt>build(goud::UiBatch &batch)</tt>.  The
+     *  batch is a member reused across calls, so steady-state batches do
+     *  not allocate.  Exceptions thrown by @p build propagate, and nothing
+     *  recorded is applied.
+     *
+     *  @param build             Records the mutations.
+     *  @param[out] out_applied  Optional; receives the number of commands applied.
+     *  @return As apply().
+     */
+    template <typename Build>
+    int batch(Build &&build, std::size_t *out_applied = nullptr) {
+        batch_.clear();
+        build(batch_);
+        return apply(batch_, out_applied);
+    }
+
+    /** @brief The batch used by the last batch() call, for resolve(). */
+    const UiBatch &lastBatch() const noexcept {
+        return batch_;
+    }
+
+    /** @brief Create one node immediately.
+     *  @return The node ID, or kInvalidUiNode if the tree is invalid.
+     */
+    UiNodeId createNode(UiWidget widget) noexcept {
+        if (!valid()) {
+            return kInvalidUiNode;
+        }
+        return ::goud_ui_create_node(manager_, static_cast<std::int32_t>(widget));
+    }
+
+    /** @brief Remove @p node and its subtree immediately.
+     *  @return SUCCESS, or ERR_INVALID_STATE if the tree is invalid or the node does not exist.
+     */
+    int removeNode(UiNodeId node) noexcept {
+        return valid() && ::goud_ui_remove_node(manager_, node) == 0 ? SUCCESS : ERR_INVALID_STATE;
+    }
+
+    /** @brief Parent of @p node, or kInvalidUiNode for roots, unknown nodes, and invalid trees. */
+    UiNodeId parent(UiNodeId node) const noexcept {
+        return valid() ? ::goud_ui_get_parent(manager_, node) : kInvalidUiNode;
+    }
+
+    /** @brief Number of live nodes (0 for an invalid tree). */
+    std::size_t nodeCount() const noexcept {
+        return valid() ? ::goud_ui_manager_node_count(manager_) : 0;
+    }
+
+    /** @brief Recompute layout for the nodes changed since the last update. */
+    void update() noexcept {
+        if (valid()) {
+            ::goud_ui_manager_update(manager_);
+        }
+    }
+
+private:
+    void reset() noexcept {
+        if (manager_ != nullptr) {
+            ::goud_ui_manager_destroy(manager_);
+            manager_ = nullptr;
+        }
+    }
+
+    ::UiManager *manager_ = nullptr;
+    UiBatch batch_;
+};
+
+}  // namespace goud
+
+#endif
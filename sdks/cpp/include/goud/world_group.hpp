@@ -0,0 +1,269 @@
+#ifndef GOUD_CPP_WORLD_GROUP_HPP
+#define GOUD_CPP_WORLD_GROUP_HPP
+
+/** @file world_group.hpp
+ *  @brief Many headless worlds ticked in parallel, one private context registry per thread.
+ *
+ *  WorldGroup runs N standalone contexts ("worlds") on a fixed set of
+ *  worker threads, for servers that host many small matches per process.
+ *  Each worker isolates itself with goud_context_thread_isolate() before
+ *  creating its worlds, so looking their contexts up locks only that
+ *  worker's context registry, and each world resets its own frame arena at
+ *  the start of its tick.  WorldGroup itself only synchronises workers at
+ *  the start and end of tick(); the engine calls a world makes may still
+ *  contend, see below.
+ *
+ *  @par What is isolated
+ *  Only two things are per thread or per world:
+ *  - the context registry, for every call that takes an isolated
+ *    context's ID, and
+ *  - the per-context frame arena (goud_context_frame_arena_*).
+ *
+ *  @par Pinning
+ *  A context must stay on the thread that created it, so world @c i lives
+ *  on worker <tt>i % threadCount()</tt> for the group's whole life.  Pick a
+ *  world count that is a multiple of the thread count to balance the load.
+ *
+ *  @par What stays shared
+ *  Every other registry is process-wide and takes one mutex per call, so
+ *  worlds on different workers serialise on these:
+ *  - 2D and 3D physics worlds, physics state saves and world snapshots;
+ *  - spatial hashes, spatial grids and entity pools;
+ *  - network sessions, RPC and rollback registries;
+ *  - FFI component storage and the component type registry;
+ *  - provider registries, UI event callbacks, asset packs and the
+ *    process-wide goud_frame_arena_* calls.
+ *
+ *  The goud_renderer_get_frame_phase_timings() counters are per thread, not
+ *  per world.
+ */
+
+#include <goud/goud.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace goud {
+
+/** @brief Fixed pool of worker threads, each owning a slice of the worlds.
+ *
+ *  Non-copyable and non-movable.  Callbacks must not throw.  The destructor
+ *  destroys every world on the thread that owns it, then joins the workers.
+ */
+class WorldGroup {
+public:
+    /** @brief Called once per world, on its worker, right after creation. */
+    using InitFn = std::function<int(std::size_t world, Context &context)>;
+
+    /** @brief Called once per world per tick(), on its worker. */
+    using TickFn = std::function<void(std::size_t world, Context &context, float delta_time)>;
+
+    /** @brief Default number of worker threads (one per hardware thread, at least 1). */
+    static unsigned defaultThreadCount() noexcept {
+        unsigned hardware = std::thread::hardware_concurrency();
+        return hardware > 0 ? hardware : 1;
+    }
+
+    /** @brief Start @p thread_count worker threads (0 is treated as 1).
+     *
+     *  If the threads cannot be started, threadCount() reports how many did.
+     */
+    explicit WorldGroup(unsigned thread_count = defaultThreadCount()) noexcept {
+        if (thread_count == 0) {
+            thread_count = 1;
+        }
+        try {
+            status_.assign(thread_count, SUCCESS);
+            workers_.reserve(thread_count);
+            for (unsigned i = 0; i < thread_count; ++i) {
+                workers_.emplace_back([this, i] { workerLoop(i); });
+            }
+        } catch (...) {
+            // Keep whatever workers did start; they still index status_.
+        }
+    }
+
+    ~WorldGroup() noexcept {
+        destroyWorlds();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        for (std::thread &worker : workers_) {
+            worker.join();
+        }
+    }
+
+    WorldGroup(const WorldGroup &) = delete;
+    WorldGroup &operator=(const WorldGroup &) = delete;
+
+    /** @brief Create @p world_count worlds spread across the workers.
+     *
+     *  Blocks until every world exists.  If any creation or @p init call
+     *  fails, every world is destroyed again and the group stays empty.
+     *
+     *  @param init  Optional; sets each world up on its own worker.  A
+     *               non-SUCCESS return aborts the whole creation.
+     *  @return SUCCESS on success, else the first failing status.
+     *  @retval ERR_INVALID_STATE  The group already holds worlds or has no workers.
+     */
+    int create(std::size_t world_count, InitFn init = nullptr) noexcept {
+        if (!worlds_.empty() || workers_.empty()) {
+            return ERR_INVALID_STATE;
+        }
+        try {
+            worlds_.resize(world_count);
+        } catch (...) {
+            worlds_.clear();
+            return ERR_INTERNAL_ERROR;
+        }
+
+        int status = run([this, &init](unsigned worker) {
+            int worker_status = SUCCESS;
+            for (std::size_t i = worker; i < worlds_.size() && worker_status == SUCCESS; i += workers_.size()) {
+                worlds_[i].context = Context::create(&worker_status);
+                if (worker_status == SUCCESS && init) {
+                    worker_status = init(i, worlds_[i].context);
+                }
+            }
+            return worker_status;
+        });
+        if (status != SUCCESS) {
+            destroyWorlds();
+        }
+        return status;
+    }
+
+    /** @brief Advance every world once, each on its own worker, and wait.
+     *
+     *  Each world's frame arena is cleared before @p fn runs for it, so
+     *  goud_context_frame_arena_allocate() memory lasts one tick.
+     *
+     *  @param delta_time  Seconds passed to every @p fn call.
+     *  @param fn          Per-world update.
+     *  @return SUCCESS on success, else the first arena reset failure.
+     */
+    int tick(float delta_time, const TickFn &fn) noexcept {
+        return run([this, delta_time, &fn](unsigned worker) {
+            int status = SUCCESS;
+            for (std::size_t i = worker; i < worlds_.size(); i += workers_.size()) {
+                World &world = worlds_[i];
+                auto started = std::chrono::steady_clock::now();
+                int reset = ::goud_context_frame_arena_clear(world.context.raw());
+                if (reset != SUCCESS && status == SUCCESS) {
+                    status = reset;
+                }
+                if (fn) {
+                    fn(i, world.context, delta_time);
+                }
+                world.tick_nanos = static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - started).count());
+            }
+            return status;
+        });
+    }
+
+    /** @brief Number of worlds created by create(). */
+    std::size_t size() const noexcept {
+        return worlds_.size();
+    }
+
+    /** @brief Number of worker threads running. */
+    unsigned threadCount() const noexcept {
+        return static_cast<unsigned>(workers_.size());
+    }
+
+    /** @brief Wall time world @p world spent in the last tick(), or 0. */
+    std::uint64_t lastTickNanos(std::size_t world) const noexcept {
+        return world < worlds_.size() ? worlds_[world].tick_nanos : 0;
+    }
+
+private:
+    struct World {
+        Context context;
+        std::uint64_t tick_nanos = 0;
+    };
+
+    /** Runs @p command on every worker and returns the first failing status. */
+    int run(std::function<int(unsigned)> command) noexcept {
+        if (workers_.empty()) {
+            return ERR_INVALID_STATE;
+        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        command_ = std::move(command);
+        pending_ = workers_.size();
+        ++epoch_;
+        wake_.notify_all();
+        done_.wait(lock, [this] { return pending_ == 0; });
+        command_ = nullptr;
+
+        for (int status : status_) {
+            if (status != SUCCESS) {
+                return status;
+            }
+        }
+        return SUCCESS;
+    }
+
+    void destroyWorlds() noexcept {
+        if (worlds_.empty()) {
+            return;
+        }
+        (void)run([this](unsigned worker) {
+            for (std::size_t i = worker; i < worlds_.size(); i += workers_.size()) {
+                worlds_[i].context.reset();
+            }
+            return SUCCESS;
+        });
+        worlds_.clear();
+    }
+
+    void workerLoop(unsigned index) noexcept {
+        int isolated = ::goud_context_thread_isolate();
+        std::uint64_t seen = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [this, seen] { return stopping_ || epoch_ != seen; });
+                if (epoch_ == seen) {
+                    break;
+                }
+                seen = epoch_;
+            }
+
+            // command_ is only replaced once every worker has reported back.
+            status_[index] = isolated != SUCCESS ? isolated : command_(index);
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--pending_ == 0) {
+                done_.notify_all();
+            }
+        }
+        (void)::goud_context_thread_release();
+    }
+
+    std::vector<std::thread> workers_;
+    std::vector<int> status_;
+    std::vector<World> worlds_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    std::function<int(unsigned)> command_;
+    std::uint64_t epoch_ = 0;
+    std::size_t pending_ = 0;
+    bool stopping_ = false;
+};
+
+}  // namespace goud
+
+#endif
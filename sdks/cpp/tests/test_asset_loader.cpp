@@ -0,0 +1,99 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/goud.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+namespace {
+
+const char *kMissingPath = "goud_cpp_tests_missing_asset.png";
+
+}  // namespace
+
+TEST_CASE("AssetFuture default is empty and ready", "[asset_loader]") {
+    goud::AssetFuture<goud_texture> future;
+    REQUIRE_FALSE(future.valid());
+    REQUIRE(future.ready());
+    REQUIRE(future.status() == ERR_INTERNAL_ERROR);
+    REQUIRE(future.get() == UINT64_MAX);
+}
+
+TEST_CASE("AssetLoader rejects a NULL path immediately", "[asset_loader]") {
+    goud::AssetLoader loader(goud_context_invalid(), 0);
+    goud::AssetFuture<goud_texture> future = loader.loadTexture(nullptr);
+    REQUIRE(future.valid());
+    REQUIRE(future.ready());
+    REQUIRE(future.status() == ERR_INVALID_STATE);
+    REQUIRE(loader.pending() == 0);
+}
+
+TEST_CASE("AssetLoader reports a missing file", "[asset_loader]") {
+    unsigned worker_counts[] = { 0, 2 };
+    for (unsigned workers : worker_counts) {
+        goud::AssetLoader loader(goud_context_invalid(), workers);
+        REQUIRE(loader.workerCount() == workers);
+
+        goud::AssetFuture<goud_texture> texture = loader.loadTexture(kMissingPath);
+        goud::AssetFuture<goud_font> font = loader.loadFont(kMissingPath);
+        REQUIRE(loader.finish() == 2);
+        REQUIRE(loader.pending() == 0);
+
+        REQUIRE(texture.ready());
+        REQUIRE(texture.status() == ERR_RESOURCE_NOT_FOUND);
+        REQUIRE(texture.get() == UINT64_MAX);
+        REQUIRE(font.ready());
+        REQUIRE(font.status() == ERR_RESOURCE_NOT_FOUND);
+    }
+}
+
+TEST_CASE("AssetLoader fails undecodable images", "[asset_loader]") {
+    const std::string path = "goud_cpp_tests_not_an_image.png";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "not an image";
+    }
+
+    goud::AssetLoader loader(goud_context_invalid(), 1);
+    goud::AssetFuture<goud_texture> texture = loader.loadTexture(path.c_str());
+    loader.finish();
+    std::remove(path.c_str());
+
+    REQUIRE(texture.ready());
+    REQUIRE(texture.status() != SUCCESS);
+    REQUIRE(texture.get() == UINT64_MAX);
+}
+
+TEST_CASE("AssetLoader pumpUploads makes progress on a zero budget", "[asset_loader]") {
+    goud::AssetLoader loader(goud_context_invalid(), 0);
+    loader.loadTexture(kMissingPath);
+    loader.loadTexture(kMissingPath);
+    loader.loadTexture(kMissingPath);
+
+    REQUIRE(loader.pumpUploads(0) == 1);
+    REQUIRE(loader.pending() == 2);
+    REQUIRE(loader.pumpUploads(UINT64_MAX) == 2);
+    REQUIRE(loader.pumpUploads(UINT64_MAX) == 0);
+}
+
+TEST_CASE("AssetLoader fails pending requests on destruction", "[asset_loader]") {
+    goud::AssetFuture<goud_texture> future;
+    {
+        goud::AssetLoader loader(goud_context_invalid(), 0);
+        future = loader.loadTexture(kMissingPath);
+        REQUIRE_FALSE(future.ready());
+    }
+    REQUIRE(future.ready());
+    REQUIRE(future.status() == ERR_INVALID_STATE);
+}
+
+TEST_CASE("Context async loads go through its AssetLoader", "[asset_loader][context]") {
+    goud::Context ctx;
+    REQUIRE(ctx.pumpAssetUploads(1000) == 0);
+    REQUIRE(ctx.finishAssetLoads() == 0);
+
+    goud::AssetFuture<goud_texture> texture = ctx.loadTextureAsync(kMissingPath);
+    REQUIRE(ctx.assetLoader() != nullptr);
+    REQUIRE(ctx.finishAssetLoads() == 1);
+    REQUIRE(texture.status() == ERR_RESOURCE_NOT_FOUND);
+}
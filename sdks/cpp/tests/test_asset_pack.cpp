@@ -0,0 +1,71 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/asset_pack.hpp>
+
+#include <cstdint>
+#include <utility>
+
+namespace {
+
+constexpr std::uint64_t kPlayer = goud::AssetPack::hash("sprites/player.png");
+
+} // namespace
+
+TEST_CASE("AssetPack::hash is FNV-1a and matches the C helper", "[asset_pack]") {
+    static_assert(goud::AssetPack::hash("") == 0xcbf29ce484222325ULL, "empty name hashes to the offset basis");
+    static_assert(goud::AssetPack::hash("a") == 0xaf63dc4c8601ec8cULL, "FNV-1a 64 of \"a\"");
+    REQUIRE(goud_asset_pack_name_hash("sprites/player.png") == kPlayer);
+    REQUIRE(goud_asset_pack_name_hash(NULL) == goud::AssetPack::hash(""));
+    REQUIRE(goud::AssetPack::hash(nullptr) == goud::AssetPack::hash(""));
+}
+
+TEST_CASE("AssetPack defaults to invalid", "[asset_pack]") {
+    goud::AssetPack pack;
+    REQUIRE_FALSE(pack.valid());
+    REQUIRE(pack.raw() == GOUD_INVALID_ASSET_PACK);
+    REQUIRE(pack.reset() == SUCCESS);
+}
+
+TEST_CASE("AssetPack move transfers ownership", "[asset_pack]") {
+    goud::AssetPack pack;
+    goud::AssetPack moved(std::move(pack));
+    REQUIRE_FALSE(pack.valid());
+    REQUIRE_FALSE(moved.valid());
+    pack = std::move(moved);
+    REQUIRE(pack.release() == GOUD_INVALID_ASSET_PACK);
+}
+
+TEST_CASE("Asset pack C wrappers reject NULL arguments", "[asset_pack]") {
+    goud_context context = goud_context_invalid();
+    goud_asset_pack pack = GOUD_INVALID_ASSET_PACK;
+    const void *data = nullptr;
+    std::size_t len = 0;
+    unsigned char buf[4];
+    std::uint32_t scene = 0;
+
+    REQUIRE(goud_asset_pack_load(NULL, &pack) == ERR_INVALID_STATE);
+    REQUIRE(goud_asset_pack_load("game.goud", NULL) == ERR_INVALID_STATE);
+    REQUIRE(goud_asset_pack_load_bytes(NULL, 0, &pack) == ERR_INVALID_STATE);
+    REQUIRE(goud_asset_pack_size(pack, kPlayer, NULL) == ERR_INVALID_STATE);
+    REQUIRE(goud_asset_pack_view(pack, kPlayer, NULL, &len) == ERR_INVALID_STATE);
+    REQUIRE(goud_asset_pack_view(pack, kPlayer, &data, NULL) == ERR_INVALID_STATE);
+    REQUIRE(goud_asset_pack_copy(pack, kPlayer, NULL, 0, &len) == ERR_INVALID_STATE);
+    REQUIRE(goud_asset_pack_copy(pack, kPlayer, buf, sizeof buf, NULL) == ERR_INVALID_STATE);
+    REQUIRE(goud_texture_load_pack(context, pack, kPlayer, NULL) == ERR_INVALID_STATE);
+    REQUIRE(goud_font_load_pack(context, pack, kPlayer, NULL) == ERR_INVALID_STATE);
+    REQUIRE(goud_audio_play_pack(context, pack, kPlayer, NULL) == ERR_INVALID_STATE);
+    REQUIRE(goud_scene_load_pack(context, pack, kPlayer, NULL, &scene) == ERR_INVALID_STATE);
+    REQUIRE(goud_scene_load_pack(context, pack, kPlayer, "level", NULL) == ERR_INVALID_STATE);
+}
+
+TEST_CASE("AssetPack rejects a missing file and junk bytes", "[asset_pack][gl_required]") {
+    int status = SUCCESS;
+    goud::AssetPack missing = goud::AssetPack::open("does/not/exist.goud", &status);
+    REQUIRE(status != SUCCESS);
+    REQUIRE_FALSE(missing.valid());
+
+    const unsigned char junk[] = {'n', 'o', 'p', 'e'};
+    goud::AssetPack bad = goud::AssetPack::fromMemory(junk, sizeof junk, &status);
+    REQUIRE(status != SUCCESS);
+    REQUIRE_FALSE(bad.valid());
+    REQUIRE(bad.entryCount() == -1);
+}
@@ -0,0 +1,133 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/atlas_builder.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+std::vector<std::uint8_t> solidPixels(std::uint32_t width, std::uint32_t height, std::uint8_t value) {
+    return std::vector<std::uint8_t>(static_cast<std::size_t>(width) * height * 4u, value);
+}
+
+}  // namespace
+
+TEST_CASE("AtlasBuilder rejects invalid input", "[atlas]") {
+    goud::AtlasBuilder builder(goud_context_invalid(), 64);
+    std::uint8_t pixel[4] = { 255, 255, 255, 255 };
+
+    REQUIRE(builder.add(nullptr) == ERR_INVALID_STATE);
+    REQUIRE(builder.addPixels(nullptr, 1, 1) == ERR_INVALID_STATE);
+    REQUIRE(builder.addPixels(pixel, 0, 1) == ERR_INVALID_STATE);
+    REQUIRE(builder.addPixels(pixel, 1, 0) == ERR_INVALID_STATE);
+    REQUIRE(builder.size() == 0);
+}
+
+TEST_CASE("AtlasBuilder deduplicates paths", "[atlas]") {
+    goud::AtlasBuilder builder;
+    std::uint32_t first = 99, second = 99, other = 99;
+    REQUIRE(builder.add("digits/0.png", &first) == SUCCESS);
+    REQUIRE(builder.add("digits/1.png", &other) == SUCCESS);
+    REQUIRE(builder.add("digits/0.png", &second) == SUCCESS);
+    REQUIRE(first == 0);
+    REQUIRE(other == 1);
+    REQUIRE(second == first);
+    REQUIRE(builder.size() == 2);
+}
+
+TEST_CASE("AtlasBuilder clamps the page size", "[atlas]") {
+    REQUIRE(goud::AtlasBuilder(goud_context_invalid(), 0).pageSize() == goud::AtlasBuilder::kDefaultPageSize);
+    REQUIRE(goud::AtlasBuilder(goud_context_invalid(), 1u << 20).pageSize() == goud::AtlasBuilder::kMaxPageSize);
+}
+
+TEST_CASE("AtlasBuilder build of an empty queue succeeds", "[atlas]") {
+    goud::AtlasBuilder builder;
+    std::uint32_t pages = 99;
+    REQUIRE(builder.build(&pages) == SUCCESS);
+    REQUIRE(pages == 0);
+    REQUIRE(builder.built());
+    REQUIRE(builder.build() == ERR_INVALID_STATE);
+    REQUIRE(builder.add("late.png") == ERR_INVALID_STATE);
+}
+
+TEST_CASE("AtlasBuilder reports a missing file and keeps its queue", "[atlas]") {
+    goud::AtlasBuilder builder;
+    REQUIRE(builder.add("goud_cpp_tests_missing_atlas_image.png") == SUCCESS);
+    REQUIRE(builder.build() == ERR_RESOURCE_NOT_FOUND);
+    REQUIRE_FALSE(builder.built());
+    REQUIRE(builder.size() == 1);
+    REQUIRE(builder.pageCount() == 0);
+    REQUIRE(builder.region(0).texture == 0);
+}
+
+TEST_CASE("AtlasBuilder rejects images over the engine limit", "[atlas]") {
+    goud::AtlasBuilder builder;
+    std::vector<std::uint8_t> wide = solidPixels(goud::AtlasBuilder::kMaxPageSize + 1, 1, 0);
+    REQUIRE(builder.addPixels(wide.data(), goud::AtlasBuilder::kMaxPageSize + 1, 1) == SUCCESS);
+    REQUIRE(builder.build() == ERR_INVALID_STATE);
+}
+
+TEST_CASE("AtlasBuilder region is empty before build", "[atlas]") {
+    goud::AtlasBuilder builder;
+    std::vector<std::uint8_t> pixels = solidPixels(4, 4, 1);
+    std::uint32_t id = 99;
+    REQUIRE(builder.addPixels(pixels.data(), 4, 4, &id) == SUCCESS);
+    goud::TextureRegion region = builder.region(id);
+    REQUIRE(region.texture == 0);
+    REQUIRE(region.src_w == 0.0f);
+
+    goud::TextureRegion found{};
+    REQUIRE(builder.find("anything.png", found) == ERR_INVALID_STATE);
+}
+
+TEST_CASE("SpriteBatch records texture regions in pixels", "[atlas][sprite_batch]") {
+    goud::SpriteBatch batch;
+    goud::TextureRegion region{ 5, 16.0f, 32.0f, 24.0f, 36.0f };
+    REQUIRE(batch.add(region, 1.0f, 2.0f, 24.0f, 36.0f, 0.0f, goud_color{ 1.0f, 1.0f, 1.0f, 1.0f }) == SUCCESS);
+
+    const goud_sprite_cmd &cmd = batch.data()[0];
+    REQUIRE(cmd.texture == 5);
+    REQUIRE(cmd.src_x == 16.0f);
+    REQUIRE(cmd.src_y == 32.0f);
+    REQUIRE(cmd.src_w == 24.0f);
+    REQUIRE(cmd.src_h == 36.0f);
+}
+
+TEST_CASE("AtlasBuilder packs small images onto one page", "[atlas][gl_required]") {
+    auto config = goud::EngineConfig::create();
+    config.setTitle("test_atlas_builder");
+    config.setSize(64, 64);
+    auto engine = goud::Engine::create(std::move(config));
+    REQUIRE(engine.valid());
+
+    goud::AtlasBuilder builder(engine.context(), 256);
+    std::vector<std::uint32_t> ids;
+    for (std::uint32_t i = 0; i < 10; ++i) {
+        std::vector<std::uint8_t> pixels = solidPixels(24, 36, static_cast<std::uint8_t>(i));
+        std::uint32_t id = 0;
+        REQUIRE(builder.addPixels(pixels.data(), 24, 36, &id) == SUCCESS);
+        ids.push_back(id);
+    }
+    std::vector<std::uint8_t> large = solidPixels(300, 20, 7);
+    std::uint32_t large_id = 0;
+    REQUIRE(builder.addPixels(large.data(), 300, 20, &large_id) == SUCCESS);
+
+    std::uint32_t pages = 0;
+    REQUIRE(builder.build(&pages) == SUCCESS);
+    REQUIRE(pages == 2);
+
+    goud::TextureRegion first = builder.region(ids[0]);
+    for (std::uint32_t id : ids) {
+        goud::TextureRegion region = builder.region(id);
+        REQUIRE(region.texture == first.texture);
+        REQUIRE(region.src_w == 24.0f);
+        REQUIRE(region.src_h == 36.0f);
+        REQUIRE(region.src_x + region.src_w <= 256.0f);
+        REQUIRE(region.src_y + region.src_h <= 256.0f);
+    }
+    REQUIRE(builder.region(large_id).texture != first.texture);
+    REQUIRE(builder.region(large_id).src_w == 300.0f);
+
+    REQUIRE(builder.reset() == SUCCESS);
+    REQUIRE(builder.pageCount() == 0);
+}
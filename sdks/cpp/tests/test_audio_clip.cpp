@@ -0,0 +1,48 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/audio_clip.hpp>
+
+#include <utility>
+
+TEST_CASE("AudioClip default is invalid", "[audio_clip]") {
+    goud::AudioClip clip;
+    REQUIRE_FALSE(clip.valid());
+    REQUIRE(clip.raw() == GOUD_INVALID_AUDIO_CLIP);
+    REQUIRE(clip.reset() == SUCCESS);
+}
+
+TEST_CASE("AudioClip load rejects NULL data", "[audio_clip]") {
+    goud::Context context;
+    int status = SUCCESS;
+    goud::AudioClip clip = goud::AudioClip::load(context, nullptr, 16, &status);
+    REQUIRE(status == ERR_INVALID_STATE);
+    REQUIRE_FALSE(clip.valid());
+}
+
+TEST_CASE("AudioClip load on an invalid context fails cleanly", "[audio_clip][gl_required]") {
+    goud::Context context;
+    const unsigned char bytes[4] = { 'R', 'I', 'F', 'F' };
+    int status = SUCCESS;
+    goud::AudioClip clip = goud::AudioClip::load(context, bytes, sizeof bytes, &status);
+    REQUIRE(status != SUCCESS);
+    REQUIRE_FALSE(clip.valid());
+}
+
+TEST_CASE("AudioClip C wrappers check their buffers", "[audio_clip]") {
+    goud_context context = goud_context_invalid();
+    goud_audio_clip clip = 1;
+    const float position[3] = { 0.0f, 0.0f, 0.0f };
+    REQUIRE(goud_audio_clip_load_memory(context, position, sizeof position, nullptr) == ERR_INVALID_STATE);
+    REQUIRE(goud_audio_clip_play_ex(context, clip, 1.0f, 1.0f, false, 1, nullptr) == ERR_INVALID_STATE);
+    REQUIRE(goud_audio_clip_play_spatial(context, clip, nullptr, position, 10.0f, 1.0f, nullptr) ==
+            ERR_INVALID_STATE);
+    REQUIRE(goud_audio_clip_cache_stats(context, nullptr) == ERR_INVALID_STATE);
+}
+
+TEST_CASE("AudioClip move transfers ownership", "[audio_clip]") {
+    goud::AudioClip a;
+    goud::AudioClip b(std::move(a));
+    REQUIRE_FALSE(a.valid());
+    REQUIRE_FALSE(b.valid());
+    a = std::move(b);
+    REQUIRE_FALSE(a.valid());
+}
@@ -0,0 +1,34 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/goud.hpp>
+
+TEST_CASE("Audio stream C wrappers check their arguments", "[audio_stream]") {
+    goud_context context = goud_context_invalid();
+    goud_audio_player player = 0;
+    REQUIRE(goud_audio_stream_play_file(context, nullptr, 1.0f, true, 0, &player) == ERR_INVALID_STATE);
+    REQUIRE(goud_audio_stream_play_file(context, "theme.ogg", 1.0f, true, 0, nullptr) == ERR_INVALID_STATE);
+    REQUIRE(goud_audio_stream_crossfade_to_file(context, -1, "theme.ogg", 2.0f, true, 0, &player) ==
+            ERR_INVALID_STATE);
+    REQUIRE(goud_audio_stream_crossfade_to_file(context, 1, nullptr, 2.0f, true, 0, &player) ==
+            ERR_INVALID_STATE);
+    REQUIRE(goud_audio_stream_mix_with_file(context, -1, "layer.ogg", 0.5f, true, 0, &player) ==
+            ERR_INVALID_STATE);
+    REQUIRE(goud_audio_stream_mix_with_file(context, 1, "layer.ogg", 0.5f, true, 0, nullptr) ==
+            ERR_INVALID_STATE);
+    REQUIRE(goud_audio_stream_stats_get(context, nullptr) == ERR_INVALID_STATE);
+}
+
+TEST_CASE("Context stream helpers forward argument checks", "[audio_stream]") {
+    goud::Context context;
+    goud_audio_player player = 0;
+    REQUIRE(context.playAudioStream(nullptr, player) == ERR_INVALID_STATE);
+    REQUIRE(context.crossfadeToAudioStream(-1, "theme.ogg", 1.0f, player) == ERR_INVALID_STATE);
+    REQUIRE(context.mixWithAudioStream(-1, "layer.ogg", 0.5f, player) == ERR_INVALID_STATE);
+}
+
+TEST_CASE("Context streams fail cleanly on an invalid context", "[audio_stream][gl_required]") {
+    goud::Context context;
+    goud_audio_player player = 0;
+    REQUIRE(context.playAudioStream("music/theme.ogg", player) != SUCCESS);
+    goud_audio_stream_stats stats{};
+    REQUIRE(context.audioStreamStats(stats) != SUCCESS);
+}
@@ -0,0 +1,107 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/component_view.hpp>
+
+namespace {
+
+struct Position {
+    float x;
+    float y;
+};
+
+struct Velocity {
+    float x;
+    float y;
+};
+
+struct Health {
+    int current;
+    int max;
+};
+
+}  // namespace
+
+template <>
+struct goud::ComponentTraits<Health> {
+    static constexpr std::string_view name() noexcept {
+        return "Health";
+    }
+    static constexpr std::uint64_t typeId() noexcept {
+        return 0x4845414C5448ull;
+    }
+};
+
+TEST_CASE("ComponentTraits derives a stable name and ID", "[component]") {
+    constexpr std::string_view name = goud::ComponentTraits<Position>::name();
+    REQUIRE(name.find("Position") != std::string_view::npos);
+    REQUIRE(name.find("Velocity") == std::string_view::npos);
+
+    constexpr std::uint64_t position_id = goud::ComponentView<Position>::typeId();
+    constexpr std::uint64_t velocity_id = goud::ComponentView<Velocity>::typeId();
+    REQUIRE(position_id != velocity_id);
+    REQUIRE(position_id == goud::detail::fnv1a64(name));
+}
+
+TEST_CASE("ComponentTraits can be specialized", "[component]") {
+    REQUIRE(goud::ComponentView<Health>::typeId() == 0x4845414C5448ull);
+    REQUIRE(goud::ComponentTraits<Health>::name() == "Health");
+}
+
+TEST_CASE("ComponentView starts empty", "[component]") {
+    goud::Context ctx;
+    goud::ComponentView<Position> view(ctx);
+    REQUIRE(view.empty());
+    REQUIRE(view.size() == 0);
+    REQUIRE(view.begin() == view.end());
+}
+
+TEST_CASE("ComponentView refresh on an invalid context stays empty", "[component]") {
+    goud::ComponentView<Position> view(goud_context_invalid());
+    (void)view.refresh();
+    REQUIRE(view.empty());
+    REQUIRE(view.get(1) == nullptr);
+    REQUIRE(view.getMut(1) == nullptr);
+}
+
+TEST_CASE("ComponentView addBatch validates its arguments", "[component]") {
+    goud::ComponentView<Position> view(goud_context_invalid());
+    std::uint32_t added = 99;
+    REQUIRE(view.addBatch(nullptr, 0, nullptr, &added) == SUCCESS);
+    REQUIRE(added == 0);
+
+    goud_entity entity = 1;
+    REQUIRE(view.addBatch(&entity, 1, nullptr) == ERR_INVALID_STATE);
+}
+
+TEST_CASE("goud_component_register rejects a NULL name", "[component]") {
+    REQUIRE(goud_component_register(1, NULL, sizeof(Position), alignof(Position)) == ERR_INVALID_STATE);
+}
+
+TEST_CASE("ComponentView round-trips components", "[component][gl_required]") {
+    int status = ERR_INTERNAL_ERROR;
+    goud::Context ctx = goud::Context::create(&status);
+    REQUIRE(status == SUCCESS);
+    REQUIRE(goud::ComponentView<Position>::registerType() == SUCCESS);
+    REQUIRE(goud::ComponentView<Position>::registerType() == SUCCESS);
+
+    goud_entity entities[3];
+    for (goud_entity &entity : entities) {
+        REQUIRE(goud_entity_spawn(ctx.raw(), &entity) == SUCCESS);
+    }
+    const Position positions[3] = { { 1.0f, 2.0f }, { 3.0f, 4.0f }, { 5.0f, 6.0f } };
+
+    goud::ComponentView<Position> view(ctx);
+    REQUIRE(view.addBatch(entities, 3, positions) == SUCCESS);
+    REQUIRE(view.refresh() == SUCCESS);
+    REQUIRE(view.size() == 3);
+
+    float sum = 0.0f;
+    for (auto item : view) {
+        REQUIRE(view.has(item.entity));
+        sum += item.component.x;
+    }
+    REQUIRE(sum == 9.0f);
+
+    REQUIRE(view.remove(entities[1]) == SUCCESS);
+    REQUIRE(view.refresh() == SUCCESS);
+    REQUIRE(view.size() == 2);
+}
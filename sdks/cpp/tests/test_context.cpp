@@ -1,6 +1,9 @@
 #include <catch2/catch_test_macros.hpp>
 #include <goud/goud.hpp>
 
+#include <algorithm>
+#include <vector>
+
 TEST_CASE("Context default is invalid", "[context]") {
     goud::Context ctx;
     REQUIRE_FALSE(ctx.valid());
@@ -33,3 +36,46 @@ TEST_CASE("Context::create with engine", "[context][gl_required]") {
     REQUIRE(ctx.destroyEntity(entity) == SUCCESS);
     REQUIRE_FALSE(ctx.isEntityAlive(entity));
 }
+
+TEST_CASE("Context bulk entity calls accept empty spans", "[context]") {
+    goud::Context ctx;
+    std::vector<std::uint64_t> entities{ 1, 2, 3 };
+    std::uint32_t destroyed = 99;
+
+    REQUIRE(ctx.spawnEntities(0, entities) == SUCCESS);
+    REQUIRE(entities.empty());
+    REQUIRE(ctx.destroyEntities(entities, &destroyed) == SUCCESS);
+    REQUIRE(destroyed == 0);
+
+    std::vector<std::uint8_t> alive{ 1 };
+    REQUIRE(ctx.aliveMask(entities, alive) == SUCCESS);
+    REQUIRE(alive.empty());
+}
+
+TEST_CASE("Context bulk entity calls reject NULL buffers", "[context]") {
+    goud::Context ctx;
+    std::uint64_t entity = 1;
+    REQUIRE(ctx.spawnEntities(4, nullptr) == ERR_INVALID_STATE);
+    REQUIRE(ctx.destroyEntities(nullptr, 4) == ERR_INVALID_STATE);
+    REQUIRE(ctx.aliveMask(&entity, 1, nullptr) == ERR_INVALID_STATE);
+}
+
+TEST_CASE("Context bulk spawn, aliveMask, and destroy", "[context][gl_required]") {
+    int status = ERR_INTERNAL_ERROR;
+    goud::Context ctx = goud::Context::create(&status);
+    REQUIRE(status == SUCCESS);
+
+    std::vector<std::uint64_t> entities;
+    REQUIRE(ctx.spawnEntities(5000, entities) == SUCCESS);
+    REQUIRE(entities.size() == 5000);
+
+    std::vector<std::uint8_t> alive;
+    REQUIRE(ctx.aliveMask(entities, alive) == SUCCESS);
+    REQUIRE(std::count(alive.begin(), alive.end(), 1) == 5000);
+
+    std::uint32_t destroyed = 0;
+    REQUIRE(ctx.destroyEntities(entities, &destroyed) == SUCCESS);
+    REQUIRE(destroyed == 5000);
+    REQUIRE(ctx.aliveMask(entities, alive) == SUCCESS);
+    REQUIRE(std::count(alive.begin(), alive.end(), 1) == 0);
+}
@@ -42,3 +42,11 @@ TEST_CASE("EngineConfig::createUnique", "[config]") {
     REQUIRE(config != nullptr);
     REQUIRE(config->valid());
 }
+
+TEST_CASE("EngineConfig::setHeadless selects the windowless pair", "[config]") {
+    auto config = goud::EngineConfig::create();
+    REQUIRE(config.setHeadless() == SUCCESS);
+
+    config.reset();
+    REQUIRE(config.setHeadless() == ERR_INVALID_STATE);
+}
@@ -0,0 +1,98 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/entity_pool.hpp>
+
+#include <vector>
+
+TEST_CASE("EntityPool default is invalid", "[entity_pool]") {
+    goud::EntityPool pool;
+    REQUIRE_FALSE(pool.valid());
+    REQUIRE(pool.raw() == GOUD_INVALID_POOL_HANDLE);
+    REQUIRE(pool.entities().empty());
+    REQUIRE(pool.entity(0) == GOUD_INVALID_ENTITY_ID);
+    REQUIRE(pool.hitRate() == 1.0);
+    REQUIRE(pool.reset() == SUCCESS);
+}
+
+TEST_CASE("EntityPool batch calls accept empty spans", "[entity_pool]") {
+    goud::EntityPool pool;
+    std::uint32_t acquired = 99;
+    std::uint32_t released = 99;
+    REQUIRE(pool.acquireBatch(0, nullptr, &acquired) == SUCCESS);
+    REQUIRE(acquired == 0);
+    REQUIRE(pool.releaseBatch(nullptr, 0, &released) == SUCCESS);
+    REQUIRE(released == 0);
+}
+
+TEST_CASE("EntityPool batch calls reject NULL buffers", "[entity_pool]") {
+    goud::EntityPool pool;
+    std::uint32_t slot = 0;
+    REQUIRE(pool.acquireBatch(4, nullptr) == ERR_INVALID_STATE);
+    REQUIRE(pool.acquireEntities(1, nullptr, &slot) == ERR_INVALID_STATE);
+    REQUIRE(pool.releaseBatch(nullptr, 4) == ERR_INVALID_STATE);
+    REQUIRE(goud_entity_pool_get_stats(pool.raw(), NULL) == ERR_INVALID_STATE);
+}
+
+TEST_CASE("EntityPool acquire, release, and stats", "[entity_pool][gl_required]") {
+    int status = ERR_INTERNAL_ERROR;
+    goud::EntityPool pool = goud::EntityPool::create(8, &status);
+    REQUIRE(status == SUCCESS);
+    REQUIRE(pool.valid());
+
+    std::vector<std::uint32_t> slots(10);
+    std::uint32_t acquired = 0;
+    REQUIRE(pool.acquireBatch(6, slots.data(), &acquired) == SUCCESS);
+    REQUIRE(acquired == 6);
+    REQUIRE(pool.releaseBatch(slots.data(), 6) == SUCCESS);
+    REQUIRE(pool.releaseBatch(slots.data(), 1) == ERR_INVALID_STATE);
+
+    REQUIRE(pool.acquireBatch(10, slots.data(), &acquired) != SUCCESS);
+    REQUIRE(acquired == 8);
+
+    goud_pool_stats stats{};
+    REQUIRE(pool.stats(stats) == SUCCESS);
+    REQUIRE(stats.capacity == 8);
+    REQUIRE(stats.active == 8);
+    REQUIRE(pool.highWaterMark() == 8);
+    REQUIRE(pool.hitRate() == 14.0 / 16.0);
+
+    goud::EntityPool moved(std::move(pool));
+    REQUIRE_FALSE(pool.valid());
+    REQUIRE(moved.valid());
+    REQUIRE(moved.reset() == SUCCESS);
+    REQUIRE_FALSE(moved.valid());
+}
+
+TEST_CASE("EntityPool backed by a Context reports entities", "[entity_pool][gl_required]") {
+    int status = ERR_INTERNAL_ERROR;
+    goud::Context ctx = goud::Context::create(&status);
+    REQUIRE(status == SUCCESS);
+
+    goud::EntityPool pool = goud::EntityPool::create(ctx, 4, &status);
+    REQUIRE(status == SUCCESS);
+    REQUIRE(pool.entities().size() == 4);
+
+    std::uint64_t entities[2] = {};
+    std::uint32_t slots[2] = {};
+    REQUIRE(pool.acquireEntities(2, entities, slots) == SUCCESS);
+    for (int i = 0; i < 2; ++i) {
+        REQUIRE(entities[i] == pool.entity(slots[i]));
+        REQUIRE(ctx.isEntityAlive(entities[i]));
+    }
+}
+
+TEST_CASE("EntityPool despawns its entities on reset", "[entity_pool][gl_required]") {
+    int status = ERR_INTERNAL_ERROR;
+    goud::Context ctx = goud::Context::create(&status);
+    REQUIRE(status == SUCCESS);
+
+    goud::EntityPool pool = goud::EntityPool::create(ctx, 3, &status);
+    REQUIRE(status == SUCCESS);
+    const std::vector<std::uint64_t> entities = pool.entities();
+    REQUIRE(entities.size() == 3);
+
+    REQUIRE(pool.reset() == SUCCESS);
+    REQUIRE(pool.entities().empty());
+    for (std::uint64_t entity : entities) {
+        REQUIRE_FALSE(ctx.isEntityAlive(entity));
+    }
+}
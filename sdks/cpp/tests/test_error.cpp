@@ -1,6 +1,8 @@
 #include <catch2/catch_test_macros.hpp>
 #include <goud/goud.hpp>
 
+#include <cstring>
+
 TEST_CASE("Error default construction", "[error]") {
     goud::Error err;
     REQUIRE(err.code() == SUCCESS);
@@ -16,3 +18,58 @@ TEST_CASE("Error::last returns current error state", "[error]") {
     // After program init with no engine calls, last error should be SUCCESS
     REQUIRE(err.code() == SUCCESS);
 }
+
+namespace {
+
+void raiseInvalidContext() {
+    goud_entity entity = 0;
+    (void)goud_entity_spawn(goud_context_invalid(), &entity);
+}
+
+}  // namespace
+
+TEST_CASE("Error::lastCode matches Error::last", "[error]") {
+    goud_clear_last_error();
+    REQUIRE(goud::Error::lastCode() == SUCCESS);
+
+    raiseInvalidContext();
+    REQUIRE(goud::Error::lastCode() == ERR_INVALID_CONTEXT);
+    auto err = goud::Error::last();
+    REQUIRE(static_cast<bool>(err));
+    REQUIRE(err.code() == ERR_INVALID_CONTEXT);
+    goud_clear_last_error();
+}
+
+TEST_CASE("Error text is fetched on first access", "[error]") {
+    raiseInvalidContext();
+    auto err = goud::Error::last();
+    REQUIRE_FALSE(err.message().empty());
+    REQUIRE(err.message().data()[err.message().size()] == '\0');
+
+    // Once fetched, the text survives the engine error being cleared.
+    goud_clear_last_error();
+    auto copy = err;
+    REQUIRE(copy.message() == err.message());
+    REQUIRE(copy.subsystem() == err.subsystem());
+}
+
+TEST_CASE("Error text is empty when the error changed before access", "[error]") {
+    raiseInvalidContext();
+    auto err = goud::Error::last();
+    goud_clear_last_error();
+    REQUIRE(err.code() == ERR_INVALID_CONTEXT);
+    REQUIRE(err.message().empty());
+    REQUIRE(err.subsystem().empty());
+    REQUIRE(err.operation().empty());
+}
+
+TEST_CASE("goud_get_last_error skips text when no error is set", "[error]") {
+    goud_clear_last_error();
+    goud_error_info info;
+    std::memset(&info, 'x', sizeof(info));
+    REQUIRE(goud_get_last_error(&info) == SUCCESS);
+    REQUIRE(info.recovery_class == 0);
+    REQUIRE(info.message[0] == '\0');
+    REQUIRE(info.subsystem[0] == '\0');
+    REQUIRE(info.operation[0] == '\0');
+}
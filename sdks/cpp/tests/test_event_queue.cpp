@@ -0,0 +1,71 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/event_queue.hpp>
+#include <goud/ui_tree.hpp>
+
+#include <cstdint>
+#include <string_view>
+
+TEST_CASE("EventQueue with an invalid UI source drains nothing", "[event_queue]") {
+    goud::UiEventQueue queue;
+    REQUIRE(queue.source().manager == nullptr);
+    REQUIRE(queue.drain() == ERR_INVALID_STATE);
+    REQUIRE(queue.empty());
+    REQUIRE(queue.size() == 0);
+    REQUIRE(queue.begin() == queue.end());
+    REQUIRE(goud_ui_events_copy(nullptr, nullptr, 4) == 0);
+}
+
+TEST_CASE("EventQueue over an invalid context stays empty", "[event_queue]") {
+    goud::AnimationEventQueue animations;
+    (void)animations.drain();
+    REQUIRE(animations.empty());
+
+    goud::CollisionEventQueue collisions({goud_context_invalid(), 0x2u});
+    REQUIRE(collisions.source().layer_mask == 0x2u);
+    (void)collisions.drain();
+    REQUIRE(collisions.events().empty());
+    collisions.setSource({});
+    REQUIRE(collisions.source().layer_mask == UINT32_MAX);
+}
+
+TEST_CASE("Animation event copy wrappers check their buffers", "[event_queue]") {
+    goud_context context = goud_context_invalid();
+    std::uint32_t written = 7;
+    REQUIRE(goud_animation_event_total(context, NULL) == ERR_INVALID_STATE);
+    REQUIRE(goud_animation_copy_events(context, NULL, 4, &written) == ERR_INVALID_STATE);
+    REQUIRE(written == 0);
+    written = 7;
+    REQUIRE(goud_animation_copy_events(context, NULL, 0, &written) == SUCCESS);
+    REQUIRE(written == 0);
+}
+
+TEST_CASE("Animation event strings are views into the event", "[event_queue]") {
+    const char name[] = "footstep";
+    const char sound[] = "step.wav";
+    goud::AnimationEvent event{};
+    REQUIRE(goud::eventName(event).empty());
+    REQUIRE(goud::payloadString(event).empty());
+
+    event.name_ptr = reinterpret_cast<const std::uint8_t *>(name);
+    event.name_len = 4;
+    event.payload_type = 3;
+    event.payload_str_ptr = reinterpret_cast<const std::uint8_t *>(sound);
+    event.payload_str_len = sizeof(sound) - 1;
+    REQUIRE(goud::eventName(event) == std::string_view("foot"));
+    REQUIRE(goud::payloadString(event) == std::string_view("step.wav"));
+}
+
+TEST_CASE("EventQueue drains a UiTree's events every frame", "[event_queue][gl_required]") {
+    goud::UiTree tree;
+    REQUIRE(tree.valid());
+    REQUIRE(tree.createNode(goud::UiWidget::Button) != goud::kInvalidUiNode);
+
+    goud::UiEventQueue queue({tree.raw()});
+    for (int frame = 0; frame < 3; ++frame) {
+        tree.update();
+        REQUIRE(queue.drain() == SUCCESS);
+        REQUIRE(queue.size() == goud_ui_event_count(tree.raw()));
+    }
+    queue.clear();
+    REQUIRE(queue.empty());
+}
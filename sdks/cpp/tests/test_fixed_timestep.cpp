@@ -0,0 +1,89 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/goud.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+
+TEST_CASE("FixedTimestep hands out whole steps and keeps the remainder", "[loop]") {
+    goud::FixedTimestep timestep(0.25f, 8);
+    REQUIRE(timestep.advance(0.625) == 2);
+    REQUIRE(timestep.alpha() == 0.5f);
+    REQUIRE(timestep.advance(0.125) == 1);
+    REQUIRE(timestep.alpha() == 0.0f);
+    REQUIRE_FALSE(timestep.clamped());
+}
+
+TEST_CASE("FixedTimestep drops time past the step cap", "[loop]") {
+    goud::FixedTimestep timestep(0.25f, 4);
+    REQUIRE(timestep.advance(10.1) == 4);
+    REQUIRE(timestep.clamped());
+    REQUIRE(timestep.alpha() < 1.0f);
+    // The backlog is gone: a normal frame afterwards runs a normal count.
+    REQUIRE(timestep.advance(0.25) <= 2);
+    REQUIRE_FALSE(timestep.clamped());
+}
+
+TEST_CASE("FixedTimestep ignores bad input and clamps its settings", "[loop]") {
+    goud::FixedTimestep timestep(-1.0f, 0);
+    REQUIRE(timestep.dt() > 0.0f);
+    REQUIRE(timestep.maxSteps() == 1);
+    REQUIRE(timestep.advance(-1.0) == 0);
+    REQUIRE(timestep.advance(std::numeric_limits<double>::infinity()) == 0);
+    REQUIRE(timestep.advance(1.0) == 1);
+    timestep.reset();
+    REQUIRE(timestep.alpha() == 0.0f);
+}
+
+TEST_CASE("FramePacer holds frames to the target period", "[loop]") {
+    using Clock = goud::FramePacer::Clock;
+    goud::FramePacer unpaced;
+    REQUIRE(unpaced.period() == Clock::duration::zero());
+    unpaced.wait();
+
+    goud::FramePacer pacer(500);
+    REQUIRE(pacer.period() == std::chrono::milliseconds(2));
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < 10; ++i) {
+        pacer.wait();
+    }
+    REQUIRE(Clock::now() - start >= std::chrono::milliseconds(20));
+}
+
+TEST_CASE("Engine::run rejects an invalid engine", "[loop]") {
+    goud::Engine engine;
+    int updates = 0;
+    int status = engine.run([&](float) { ++updates; }, [&](float) { ++updates; });
+    REQUIRE(status == ERR_INVALID_CONTEXT);
+    REQUIRE(updates == 0);
+}
+
+TEST_CASE("Engine::run steps until stop()", "[loop][gl_required]") {
+    auto config = goud::EngineConfig::create();
+    config.setTitle("test_run");
+    config.setSize(64, 64);
+    auto engine = goud::Engine::create(std::move(config));
+    REQUIRE(engine.valid());
+
+    goud::RunOptions options;
+    options.fixed_dt = 1.0f / 240.0f;
+    options.target_fps = 120;
+    int frames = 0;
+    std::uint32_t updates = 0;
+    int status = engine.run(
+        [&](float dt) {
+            REQUIRE(dt == options.fixed_dt);
+            ++updates;
+        },
+        [&](float alpha) {
+            REQUIRE(alpha >= 0.0f);
+            REQUIRE(alpha < 1.0f);
+            if (++frames == 30) {
+                engine.stop();
+            }
+        },
+        options);
+    REQUIRE(status == SUCCESS);
+    REQUIRE(frames == 30);
+    REQUIRE(updates > 0);
+}
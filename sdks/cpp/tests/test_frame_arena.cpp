@@ -0,0 +1,110 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/frame_arena.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <thread>
+
+TEST_CASE("FrameArena honours alignment", "[frame_arena]") {
+    goud::FrameArena &arena = goud::FrameArena::instance();
+    REQUIRE(arena.reset() == SUCCESS);
+
+    REQUIRE(arena.allocate(3, 1) != nullptr);
+    for (std::size_t align : { 2u, 8u, 16u, 64u, 256u }) {
+        void *ptr = arena.allocate(24, align);
+        REQUIRE(ptr != nullptr);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(ptr) % align == 0);
+    }
+    REQUIRE(arena.allocate(8, 3) == nullptr);
+    REQUIRE(arena.allocate(8, 0) == nullptr);
+    REQUIRE(arena.reset() == SUCCESS);
+}
+
+TEST_CASE("FrameArena allocations do not overlap", "[frame_arena]") {
+    goud::FrameArena &arena = goud::FrameArena::instance();
+    REQUIRE(arena.reset() == SUCCESS);
+
+    std::uint8_t *a = static_cast<std::uint8_t *>(arena.allocate(100, 4));
+    std::uint8_t *b = static_cast<std::uint8_t *>(arena.allocate(100, 4));
+    std::uint8_t *large = static_cast<std::uint8_t *>(arena.allocate(goud::FrameArena::kChunkSize, 16));
+    REQUIRE(a != nullptr);
+    REQUIRE(b != nullptr);
+    REQUIRE(large != nullptr);
+    REQUIRE((b >= a + 100 || a >= b + 100));
+    std::fill(a, a + 100, std::uint8_t{ 1 });
+    std::fill(b, b + 100, std::uint8_t{ 2 });
+    std::fill(large, large + goud::FrameArena::kChunkSize, std::uint8_t{ 3 });
+    REQUIRE(a[99] == 1);
+    REQUIRE(b[0] == 2);
+    REQUIRE(arena.reset() == SUCCESS);
+}
+
+TEST_CASE("FrameArena tracks bytes used until reset", "[frame_arena]") {
+    goud::FrameArena &arena = goud::FrameArena::instance();
+    REQUIRE(arena.reset() == SUCCESS);
+    REQUIRE(arena.bytesUsed() == 0);
+
+    REQUIRE(arena.allocate(128) != nullptr);
+    REQUIRE(arena.allocate(64) != nullptr);
+    REQUIRE(arena.bytesUsed() == 192);
+    REQUIRE(arena.bytesAllocated() >= 192);
+
+    goud_arena_stats before{};
+    REQUIRE(arena.stats(before) == SUCCESS);
+    REQUIRE(arena.reset() == SUCCESS);
+    goud_arena_stats after{};
+    REQUIRE(arena.stats(after) == SUCCESS);
+    REQUIRE(after.reset_count == before.reset_count + 1);
+    REQUIRE(arena.bytesUsed() == 0);
+}
+
+TEST_CASE("frame_vector grows inside the arena", "[frame_arena]") {
+    goud::FrameArena &arena = goud::FrameArena::instance();
+    REQUIRE(arena.reset() == SUCCESS);
+    {
+        goud::frame_vector<std::uint32_t> keys;
+        keys.reserve(16);
+        for (std::uint32_t i = 0; i < 10000; ++i) {
+            keys.push_back(i);
+        }
+        REQUIRE(std::accumulate(keys.begin(), keys.end(), std::uint64_t{ 0 }) == 49995000u);
+        REQUIRE(arena.bytesUsed() >= keys.size() * sizeof(std::uint32_t));
+    }
+    REQUIRE(arena.reset() == SUCCESS);
+}
+
+TEST_CASE("frame_allocator rebinds and compares equal", "[frame_arena]") {
+    goud::frame_allocator<int> ints;
+    goud::frame_allocator<double> doubles(ints);
+    REQUIRE(ints == doubles);
+    REQUIRE_FALSE(ints != doubles);
+}
+
+TEST_CASE("FrameArena serves several threads at once", "[frame_arena]") {
+    goud::FrameArena &arena = goud::FrameArena::instance();
+    REQUIRE(arena.reset() == SUCCESS);
+
+    bool ok[4] = {};
+    std::thread threads[4];
+    for (int t = 0; t < 4; ++t) {
+        threads[t] = std::thread([t, &ok] {
+            goud::frame_vector<int> values;
+            for (int i = 0; i < 5000; ++i) {
+                values.push_back(t * 100000 + i);
+            }
+            bool intact = true;
+            for (int i = 0; i < 5000; ++i) {
+                intact = intact && values[static_cast<std::size_t>(i)] == t * 100000 + i;
+            }
+            ok[t] = intact;
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    for (bool thread_ok : ok) {
+        REQUIRE(thread_ok);
+    }
+    REQUIRE(arena.reset() == SUCCESS);
+}
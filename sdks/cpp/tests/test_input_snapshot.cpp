@@ -0,0 +1,63 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/goud.hpp>
+
+#include <cstring>
+
+TEST_CASE("InputSnapshot default has nothing pressed", "[input_snapshot]") {
+    goud::InputSnapshot snapshot;
+    REQUIRE_FALSE(snapshot.keyDown(KEY_SPACE));
+    REQUIRE_FALSE(snapshot.mouseDown(MOUSE_BUTTON_LEFT));
+    REQUIRE_FALSE(snapshot.gamepadConnected(0));
+    REQUIRE(snapshot.touchCount() == 0);
+    REQUIRE(snapshot == goud::InputSnapshot());
+}
+
+TEST_CASE("InputSnapshot queries are bit tests on the raw struct", "[input_snapshot]") {
+    goud_input_snapshot raw;
+    std::memset(&raw, 0, sizeof(raw));
+    raw.keys_down[KEY_RIGHT_SUPER / 64] |= 1ull << (KEY_RIGHT_SUPER % 64);
+    raw.keys_pressed[KEY_A / 64] |= 1ull << (KEY_A % 64);
+    raw.mouse_released = 1u << MOUSE_BUTTON_RIGHT;
+    raw.gamepads_connected = 0b10;
+    raw.gamepad_down[1] = 1u << GAMEPAD_BUTTON_START;
+    raw.gamepad_axes[GOUD_GAMEPAD_AXIS_COUNT + GAMEPAD_AXIS_RIGHT_TRIGGER] = 0.5f;
+    raw.touch_count = 1;
+    raw.touch_ids[0] = 42;
+    raw.touch_active = 1;
+    raw.touch_x[0] = 3.0f;
+    raw.touch_y[0] = 4.0f;
+
+    goud::InputSnapshot snapshot(raw);
+    REQUIRE(snapshot.keyDown(KEY_RIGHT_SUPER));
+    REQUIRE_FALSE(snapshot.keyPressed(KEY_RIGHT_SUPER));
+    REQUIRE(snapshot.keyPressed(KEY_A));
+    REQUIRE_FALSE(snapshot.keyDown(KEY_UNKNOWN));
+    REQUIRE(snapshot.mouseReleased(MOUSE_BUTTON_RIGHT));
+    REQUIRE_FALSE(snapshot.mouseReleased(MOUSE_BUTTON_LEFT));
+    REQUIRE(snapshot.gamepadConnected(1));
+    REQUIRE(snapshot.gamepadDown(1, GAMEPAD_BUTTON_START));
+    REQUIRE_FALSE(snapshot.gamepadDown(MAX_GAMEPAD_SLOTS, GAMEPAD_BUTTON_START));
+    REQUIRE(snapshot.gamepadAxis(1, GAMEPAD_AXIS_RIGHT_TRIGGER) == 0.5f);
+    REQUIRE(snapshot.gamepadAxis(1, GOUD_GAMEPAD_AXIS_COUNT) == 0.0f);
+    REQUIRE(snapshot.touchId(0) == 42);
+    REQUIRE(snapshot.touchActive(0));
+    REQUIRE_FALSE(snapshot.touchActive(1));
+    REQUIRE(snapshot.touchPosition(0).x == 3.0f);
+    REQUIRE(snapshot.touchPosition(0).y == 4.0f);
+
+    goud::InputSnapshot copy = snapshot;
+    REQUIRE(copy == snapshot);
+    copy.raw().mouse_x = 1.0f;
+    REQUIRE(copy != snapshot);
+}
+
+TEST_CASE("InputSnapshot capture rejects bad arguments", "[input_snapshot]") {
+    REQUIRE(goud_input_snapshot_capture(goud_context_invalid(), nullptr) == ERR_INVALID_STATE);
+
+    goud::InputSnapshot snapshot;
+    snapshot.raw().mouse_down = 1;
+    goud::Context context;
+    REQUIRE(context.captureInput(snapshot) != SUCCESS);
+    REQUIRE(snapshot == goud::InputSnapshot());
+    REQUIRE(context.captureInput() == goud::InputSnapshot());
+}
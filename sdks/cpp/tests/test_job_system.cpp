@@ -0,0 +1,135 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/job_system.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+/** Minimal stand-in for ComponentView<int>. */
+struct FakeView {
+    std::vector<goud_entity> ids;
+    std::vector<int> values;
+    std::size_t size() const { return ids.size(); }
+    goud_entity entity(std::size_t i) const { return ids[i]; }
+    const int &operator[](std::size_t i) const { return values[i]; }
+};
+
+}  // namespace
+
+TEST_CASE("JobSystem::parallelFor visits every index once", "[jobs]") {
+    for (unsigned workers : { 0u, 1u, 3u }) {
+        goud::JobSystem jobs(workers);
+        REQUIRE(jobs.workerCount() == workers);
+        std::vector<std::atomic<int>> hits(10007);
+        jobs.parallelFor(0, hits.size(), 64, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                hits[i].fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+        for (const auto &hit : hits) {
+            REQUIRE(hit.load() == 1);
+        }
+    }
+}
+
+TEST_CASE("JobSystem::parallelFor handles empty and automatic grains", "[jobs]") {
+    goud::JobSystem jobs(2);
+    int calls = 0;
+    jobs.parallelFor(5, 5, 0, [&](std::size_t, std::size_t) { ++calls; });
+    REQUIRE(calls == 0);
+
+    std::atomic<std::size_t> total{ 0 };
+    jobs.parallelFor(10, 1010, 0, [&](std::size_t begin, std::size_t end) {
+        REQUIRE(begin >= 10);
+        REQUIRE(end <= 1010);
+        total.fetch_add(end - begin);
+    });
+    REQUIRE(total.load() == 1000);
+}
+
+TEST_CASE("JobSystem runs jobs after their dependencies", "[jobs]") {
+    goud::JobSystem jobs(3);
+    std::mutex mutex;
+    std::vector<int> order;
+    auto record = [&](int id) {
+        return [&, id] {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(id);
+        };
+    };
+
+    goud::JobHandle a = jobs.schedule(record(1));
+    goud::JobHandle b = jobs.schedule(record(2), { a });
+    goud::JobHandle c = jobs.schedule(record(3), { a });
+    goud::JobHandle d = jobs.schedule(record(4), { b, c, goud::JobHandle() });
+    jobs.wait(d);
+
+    REQUIRE(a.done());
+    REQUIRE(b.done());
+    REQUIRE(c.done());
+    REQUIRE(order.size() == 4);
+    REQUIRE(order.front() == 1);
+    REQUIRE(order.back() == 4);
+}
+
+TEST_CASE("JobSystem without workers runs ready jobs inside schedule()", "[jobs]") {
+    goud::JobSystem jobs(0);
+    int value = 0;
+    goud::JobHandle first = jobs.schedule([&] { value += 1; });
+    REQUIRE(first.done());
+    REQUIRE(value == 1);
+    goud::JobHandle second = jobs.schedule([&] { value *= 10; }, { first });
+    REQUIRE(second.done());
+    jobs.wait({ first, second });
+    REQUIRE(value == 10);
+}
+
+TEST_CASE("JobSystem destroys a job's callable after running it", "[jobs]") {
+    goud::JobSystem jobs(0);
+    auto token = std::make_shared<int>(7);
+    std::weak_ptr<int> watch = token;
+    int seen = 0;
+    goud::JobHandle job = jobs.schedule([&seen, token = std::move(token)] { seen = *token; });
+    jobs.wait(job);
+    REQUIRE(seen == 7);
+    REQUIRE(watch.expired());
+}
+
+TEST_CASE("JobSystem handles many dependent jobs", "[jobs]") {
+    goud::JobSystem jobs(3);
+    std::atomic<int> finished{ 0 };
+    std::vector<goud::JobHandle> layer(16);
+    for (int depth = 0; depth < 20; ++depth) {
+        std::vector<goud::JobHandle> next;
+        for (std::size_t i = 0; i < layer.size(); ++i) {
+            next.push_back(jobs.schedule([&] { finished.fetch_add(1); }, layer.data(), layer.size()));
+        }
+        layer = next;
+    }
+    for (const goud::JobHandle &job : layer) {
+        jobs.wait(job);
+    }
+    REQUIRE(finished.load() == 16 * 20);
+}
+
+TEST_CASE("JobSystem::forEach iterates a view in parallel", "[jobs]") {
+    FakeView view;
+    for (int i = 0; i < 1000; ++i) {
+        view.ids.push_back(static_cast<goud_entity>(i));
+        view.values.push_back(i * 2);
+    }
+    std::vector<int> out(view.size());
+
+    goud::JobSystem jobs(2);
+    jobs.forEach(view, 32, [&](goud_entity entity, const int &value) {
+        out[static_cast<std::size_t>(entity)] = value + 1;
+    });
+    for (int i = 0; i < 1000; ++i) {
+        REQUIRE(out[static_cast<std::size_t>(i)] == i * 2 + 1);
+    }
+}
@@ -0,0 +1,44 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/metrics.hpp>
+
+#include <cstddef>
+
+TEST_CASE("Metrics buffer layout matches the documented protocol", "[metrics]") {
+    REQUIRE(offsetof(goud_metrics_double_buffer, published) == 8);
+    REQUIRE(offsetof(goud_metrics_double_buffer, slots) == 16);
+    REQUIRE(sizeof(GoudMetricsSlot) == sizeof(std::uint64_t) + sizeof(goud_metrics_block));
+    REQUIRE(alignof(goud_metrics_double_buffer) == alignof(std::uint64_t));
+    REQUIRE(GOUD_METRICS_BLOCK_VERSION == 1);
+}
+
+TEST_CASE("Metrics C wrappers reject NULL arguments", "[metrics]") {
+    goud_metrics_block block{};
+    goud_metrics_double_buffer buffer{};
+
+    REQUIRE(goud_metrics_get_buffer(goud_context_invalid(), NULL) == ERR_INVALID_STATE);
+    REQUIRE(goud_metrics_copy(NULL, &block) == ERR_INVALID_STATE);
+    REQUIRE(goud_metrics_copy(&buffer, NULL) == ERR_INVALID_STATE);
+}
+
+TEST_CASE("Metrics views are invalid without a context", "[metrics]") {
+    goud::Context ctx;
+    goud_metrics_block block{};
+    int status = SUCCESS;
+
+    goud::Metrics empty;
+    REQUIRE_FALSE(empty.valid());
+    REQUIRE(empty.read(block) == ERR_INVALID_STATE);
+
+    goud::Metrics metrics = goud::Metrics::forContext(ctx, &status);
+    REQUIRE(status != SUCCESS);
+    REQUIRE_FALSE(metrics.valid());
+    REQUIRE(metrics.raw() == nullptr);
+}
+
+TEST_CASE("Metrics publishing fails without a context", "[metrics][gl_required]") {
+    goud::Context ctx;
+    goud_metrics_double_buffer shared{};
+
+    REQUIRE(goud::Metrics::publish(ctx) != SUCCESS);
+    REQUIRE(goud::Metrics::share(ctx, &shared) != SUCCESS);
+}
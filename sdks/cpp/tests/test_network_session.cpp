@@ -0,0 +1,141 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/network_session.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Network C wrappers check their arguments", "[network_session]") {
+    goud_context context = goud_context_invalid();
+    goud_network network = 5;
+    std::uint8_t buffer[16] = {};
+    goud_network_message messages[4] = {};
+    std::uint32_t count = 7;
+
+    REQUIRE(goud_network_open_host(context, 0, 0, nullptr) == ERR_INVALID_STATE);
+    REQUIRE(goud_network_open_client(context, 0, nullptr, 9000, &network, nullptr) == ERR_INVALID_STATE);
+    REQUIRE(network == 0);
+    REQUIRE(goud_network_send_bytes(context, 1, 1, nullptr, 4, 0) == ERR_INVALID_STATE);
+    REQUIRE(goud_network_receive_batch(context, 1, buffer, sizeof(buffer), messages, 4, nullptr) ==
+            ERR_INVALID_STATE);
+    REQUIRE(goud_network_receive_batch(context, 1, nullptr, sizeof(buffer), messages, 4, &count) ==
+            ERR_INVALID_STATE);
+    REQUIRE(count == 0);
+    REQUIRE(goud_network_receive_batch(context, 1, buffer, sizeof(buffer), messages, 0, &count) ==
+            ERR_INVALID_STATE);
+    REQUIRE(goud_network_stats_get(context, 1, nullptr) == ERR_INVALID_STATE);
+}
+
+TEST_CASE("Coalesced datagrams are recognised only when well formed", "[network_session]") {
+    std::vector<std::uint8_t> datagram(std::begin(goud::detail::kNetworkBatchMagic),
+                                       std::end(goud::detail::kNetworkBatchMagic));
+    REQUIRE(goud::detail::isNetworkBatch(datagram.data(), datagram.size()));
+
+    datagram.insert(datagram.end(), {3, 0, 'a', 'b', 'c', 0, 0, 1, 0, 'd'});
+    REQUIRE(goud::detail::isNetworkBatch(datagram.data(), datagram.size()));
+
+    REQUIRE_FALSE(goud::detail::isNetworkBatch(datagram.data(), datagram.size() - 1));
+    datagram.push_back(9);
+    REQUIRE_FALSE(goud::detail::isNetworkBatch(datagram.data(), datagram.size()));
+
+    const std::uint8_t plain[] = {'G', 'N', 'B', '2', 0, 0};
+    REQUIRE_FALSE(goud::detail::isNetworkBatch(plain, sizeof(plain)));
+    REQUIRE_FALSE(goud::detail::isNetworkBatch(plain, 2));
+}
+
+TEST_CASE("Framed messages round-trip even when they look like coalesced datagrams", "[network_session]") {
+    const std::vector<std::vector<std::uint8_t>> payloads = {
+        {'G', 'N', 'B', '1'},
+        {'G', 'N', 'B', '1', 1, 0, 'x'},
+        {},
+    };
+    for (const std::vector<std::uint8_t> &payload : payloads) {
+        std::vector<std::uint8_t> datagram;
+        goud::detail::appendNetworkRecord(datagram, payload.data(), payload.size());
+        REQUIRE(goud::detail::isNetworkBatch(datagram.data(), datagram.size()));
+
+        std::vector<std::vector<std::uint8_t>> received;
+        std::size_t count = goud::detail::forEachNetworkRecord(
+            datagram.data(), datagram.size(), [&](const std::uint8_t *data, std::size_t size) {
+                received.emplace_back(data, data + size);
+            });
+        REQUIRE(count == 1);
+        REQUIRE(received.size() == 1);
+        REQUIRE(received[0] == payload);
+    }
+}
+
+TEST_CASE("An invalid NetworkSession rejects batched sends", "[network_session]") {
+    goud::NetworkSession session;
+    REQUIRE_FALSE(session.valid());
+    REQUIRE(session.sendBatch(nullptr, 0) == SUCCESS);
+
+    const std::uint8_t payload[] = {1, 2, 3};
+    goud::OutgoingMessage message{7, payload, sizeof(payload)};
+    REQUIRE(session.sendBatch(&message, 1) == ERR_INVALID_STATE);
+    REQUIRE(session.flush() == SUCCESS);
+    std::vector<std::uint8_t> oversized(goud::NetworkSession::kMaxBatchedMessageBytes + 1);
+    REQUIRE(session.send(7, oversized.data(), oversized.size()) == ERR_INVALID_STATE);
+    REQUIRE(session.send(7, nullptr, 1) == ERR_INVALID_STATE);
+
+    goud::PeerTraffic traffic = session.peerTraffic(7);
+    REQUIRE(traffic.bytes_sent == 0);
+    REQUIRE(traffic.messages_received == 0);
+
+    goud::NetworkSession moved = std::move(session);
+    REQUIRE_FALSE(moved.valid());
+    REQUIRE(moved.raw() == 0);
+}
+
+TEST_CASE("NetworkSession calls fail cleanly without a network handle", "[network_session][gl_required]") {
+    goud::Context context;
+    int status = SUCCESS;
+    goud::NetworkSession session =
+        goud::NetworkSession::connect(context, goud::NetworkSession::Protocol::Udp, "", 9000, &status);
+    REQUIRE(status != SUCCESS);
+    REQUIRE_FALSE(session.valid());
+
+    std::size_t delivered = 1;
+    REQUIRE(session.drain([](std::uint64_t, const std::uint8_t *, std::size_t) {}, &delivered) != SUCCESS);
+    REQUIRE(delivered == 0);
+    REQUIRE(session.poll() != SUCCESS);
+    goud::NetworkStats stats{};
+    REQUIRE(session.stats(stats) != SUCCESS);
+}
+
+TEST_CASE("NetworkSession drains past a message larger than its receive buffer", "[network_session][gl_required]") {
+    int status = ERR_INTERNAL_ERROR;
+    goud::Context context = goud::Context::create(&status);
+    REQUIRE(status == SUCCESS);
+    constexpr std::uint16_t kPort = 47813;
+    goud::NetworkSessionOptions options;
+    options.receive_buffer_bytes = 64;
+    goud::NetworkSession host =
+        goud::NetworkSession::host(context, goud::NetworkSession::Protocol::Tcp, kPort, &status, options);
+    REQUIRE(status == SUCCESS);
+    goud::NetworkSession client = goud::NetworkSession::connect(
+        context, goud::NetworkSession::Protocol::Tcp, "127.0.0.1", kPort, &status);
+    REQUIRE(status == SUCCESS);
+
+    const std::vector<std::uint8_t> oversized(1000, 0x5A);
+    const std::uint8_t small[] = {1, 2, 3};
+    REQUIRE(client.send(client.serverPeer(), oversized.data(), oversized.size()) == SUCCESS);
+    REQUIRE(client.send(client.serverPeer(), small, sizeof(small)) == SUCCESS);
+    REQUIRE(client.send(client.serverPeer(), small, sizeof(small)) == SUCCESS);
+
+    std::vector<std::vector<std::uint8_t>> received;
+    for (int attempt = 0; attempt < 500 && received.size() < 3; ++attempt) {
+        REQUIRE(client.poll() == SUCCESS);
+        REQUIRE(host.poll() == SUCCESS);
+        REQUIRE(host.drain([&](std::uint64_t, const std::uint8_t *data, std::size_t size) {
+            received.emplace_back(data, data + size);
+        }) == SUCCESS);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    REQUIRE(received.size() == 3);
+    REQUIRE(received[0] == oversized);
+    REQUIRE(received[1] == std::vector<std::uint8_t>(std::begin(small), std::end(small)));
+    REQUIRE(received[2] == received[1]);
+}
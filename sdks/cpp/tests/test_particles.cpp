@@ -0,0 +1,54 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/goud.hpp>
+
+#include <cstdint>
+#include <utility>
+
+TEST_CASE("ParticleEmitter default is empty and rejects use", "[particles]") {
+    goud::ParticleEmitter emitter;
+    std::uint32_t count = 99;
+
+    REQUIRE_FALSE(emitter.valid());
+    REQUIRE(emitter.raw() == GOUD_INVALID_PARTICLE_EMITTER);
+    REQUIRE(emitter.capacity() == 0);
+    REQUIRE(emitter.draw(0.0f, 0.0f, &count) == ERR_INVALID_HANDLE);
+    REQUIRE(count == 0);
+    count = 99;
+    REQUIRE(emitter.burst(10, &count) == ERR_INVALID_HANDLE);
+    REQUIRE(count == 0);
+    REQUIRE(emitter.setPosition(1.0f, 2.0f) == ERR_INVALID_HANDLE);
+    REQUIRE(emitter.setRate(5.0f) == ERR_INVALID_HANDLE);
+    emitter.reset();
+    REQUIRE_FALSE(emitter.valid());
+}
+
+TEST_CASE("Particle C wrappers check arguments before the FFI call", "[particles]") {
+    goud_particle_config config = goud::defaultParticleConfig();
+    goud_particle_emitter emitter = 7;
+
+    REQUIRE(goud_particle_emitter_init(goud_context_invalid(), nullptr, &emitter) == ERR_INVALID_STATE);
+    REQUIRE(goud_particle_emitter_init(goud_context_invalid(), &config, nullptr) == ERR_INVALID_STATE);
+}
+
+TEST_CASE("Default particle config is valid", "[particles]") {
+    goud_particle_config config = goud::defaultParticleConfig();
+
+    REQUIRE(config.max_particles > 0);
+    REQUIRE(config.max_particles <= GOUD_PARTICLE_MAX_PER_EMITTER);
+    REQUIRE(config.lifetime_min > 0.0f);
+    REQUIRE(config.lifetime_max >= config.lifetime_min);
+    REQUIRE(config.texture == 0);
+    REQUIRE(config.end_a == 0.0f);
+}
+
+TEST_CASE("ParticleEmitter moves leave the source empty", "[particles]") {
+    goud::ParticleEmitter first;
+    goud::ParticleEmitter second(std::move(first));
+    REQUIRE_FALSE(first.valid());
+    REQUIRE_FALSE(second.valid());
+
+    goud::ParticleEmitter third;
+    third = std::move(second);
+    REQUIRE_FALSE(second.valid());
+    REQUIRE(third.capacity() == 0);
+}
@@ -0,0 +1,161 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/physics_world.hpp>
+
+#include <cstdint>
+#include <vector>
+
+TEST_CASE("PhysicsWorld default is invalid", "[physics]") {
+    goud::PhysicsWorld world;
+    REQUIRE_FALSE(world.valid());
+    REQUIRE_FALSE(goud_context_valid(world.raw()));
+    REQUIRE(world.reset() == SUCCESS);
+}
+
+TEST_CASE("PhysicsWorld bulk calls accept empty spans", "[physics]") {
+    goud::PhysicsWorld world;
+    goud::BodyStates states;
+    REQUIRE(world.readBodies(nullptr, 0, nullptr) == SUCCESS);
+    REQUIRE(world.readBodies(nullptr, 0, states) == SUCCESS);
+    REQUIRE(states.positions.empty());
+    REQUIRE(world.setVelocities(nullptr, nullptr, 0) == SUCCESS);
+}
+
+TEST_CASE("PhysicsWorld bulk calls reject NULL buffers", "[physics]") {
+    goud::PhysicsWorld world;
+    goud_vec2 velocity{1.0f, 0.0f};
+    goud_physics_body body = 1;
+    REQUIRE(world.readBodies(nullptr, 2, nullptr) == ERR_INVALID_STATE);
+    REQUIRE(world.setVelocities(nullptr, &velocity, 1) == ERR_INVALID_STATE);
+    REQUIRE(world.setVelocities(&body, nullptr, 1) == ERR_INVALID_STATE);
+    REQUIRE(goud_physics_body_add(world.raw(), 1, velocity, 1.0f, NULL) == ERR_INVALID_STATE);
+}
+
+TEST_CASE("PhysicsWorld drain on an invalid world leaves no events", "[physics]") {
+    goud::PhysicsWorld world;
+    std::vector<goud::CollisionEvent> events(4);
+    (void)world.drainCollisionEvents(events);
+    REQUIRE(events.empty());
+    REQUIRE(goud_physics_copy_collision_events(world.raw(), UINT32_MAX, NULL, 4, NULL) == ERR_INVALID_STATE);
+    REQUIRE(goud_physics_collision_event_total(world.raw(), NULL) == ERR_INVALID_STATE);
+}
+
+TEST_CASE("PhysicsWorld query batches check their buffers", "[physics]") {
+    goud::PhysicsWorld world;
+    goud::Ray ray{0.0f, 0.0f, 1.0f, 0.0f, 10.0f};
+    goud::RayHit hit{};
+    goud_rect rect{0.0f, 0.0f, 1.0f, 1.0f};
+    goud_physics_body body = 0;
+    std::uint32_t found = 99;
+    REQUIRE(world.raycastBatch(nullptr, 0, UINT32_MAX, nullptr, &found) == SUCCESS);
+    REQUIRE(found == 0);
+    REQUIRE(world.overlapBatch(nullptr, 0, UINT32_MAX, nullptr) == SUCCESS);
+    REQUIRE(world.raycastBatch(&ray, 1, UINT32_MAX, nullptr) == ERR_INVALID_STATE);
+    REQUIRE(world.raycastBatch(nullptr, 1, UINT32_MAX, &hit) == ERR_INVALID_STATE);
+    REQUIRE(world.overlapBatch(&rect, 1, UINT32_MAX, nullptr) == ERR_INVALID_STATE);
+    REQUIRE(world.overlapBatch(nullptr, 1, UINT32_MAX, &body) == ERR_INVALID_STATE);
+}
+
+TEST_CASE("PhysicsWorld move transfers ownership", "[physics]") {
+    goud::PhysicsWorld a;
+    goud::PhysicsWorld b(std::move(a));
+    REQUIRE_FALSE(a.valid());
+    REQUIRE_FALSE(b.valid());
+    a = std::move(b);
+    REQUIRE_FALSE(b.valid());
+}
+
+TEST_CASE("PhysicsWorld reads and writes body state in bulk", "[physics][gl_required]") {
+    int status = ERR_INTERNAL_ERROR;
+    goud::Context context = goud::Context::create(&status);
+    REQUIRE(status == SUCCESS);
+
+    goud::PhysicsWorld world = goud::PhysicsWorld::create(
+        context, goud_vec2{0.0f, 0.0f}, goud::PhysicsWorld::Backend::Rapier, &status);
+    REQUIRE(status == SUCCESS);
+    REQUIRE(world.valid());
+
+    std::vector<goud_physics_body> bodies(3);
+    for (std::size_t i = 0; i < bodies.size(); ++i) {
+        goud_vec2 position{static_cast<float>(i) * 10.0f, 0.0f};
+        REQUIRE(world.addBody(1, position, bodies[i], 0.0f) == SUCCESS);
+        REQUIRE(world.addCollider(bodies[i], 0, goud_vec2{0.0f, 0.0f}, 1.0f) == SUCCESS);
+    }
+
+    std::vector<goud_vec2> velocities(bodies.size(), goud_vec2{0.0f, 4.0f});
+    REQUIRE(world.setVelocities(bodies.data(), velocities.data(),
+                                static_cast<std::uint32_t>(bodies.size())) == SUCCESS);
+    REQUIRE(world.step(0.5f) == SUCCESS);
+
+    goud::BodyStates states;
+    REQUIRE(world.readBodies(bodies.data(), static_cast<std::uint32_t>(bodies.size()), states) == SUCCESS);
+    REQUIRE(states.positions.size() == bodies.size());
+    for (std::size_t i = 0; i < bodies.size(); ++i) {
+        REQUIRE(states.positions[i].x == static_cast<float>(i) * 10.0f);
+        REQUIRE(states.positions[i].y > 0.0f);
+        REQUIRE(states.velocities[i].y == 4.0f);
+        REQUIRE(states.rotations[i] == 0.0f);
+    }
+
+    REQUIRE(world.removeBody(bodies[1]) == SUCCESS);
+    REQUIRE(world.readBodies(bodies.data(), 3, states) == ERR_INVALID_HANDLE);
+    REQUIRE(states.positions[1].x == 0.0f);
+    REQUIRE(states.positions[2].x == 20.0f);
+}
+
+TEST_CASE("PhysicsWorld drains collision events by layer", "[physics][gl_required]") {
+    int status = ERR_INTERNAL_ERROR;
+    goud::Context context = goud::Context::create(&status);
+    REQUIRE(status == SUCCESS);
+    goud::PhysicsWorld world = goud::PhysicsWorld::create(
+        context, goud_vec2{0.0f, 0.0f}, goud::PhysicsWorld::Backend::Rapier, &status);
+    REQUIRE(status == SUCCESS);
+
+    goud_physics_body sensor = 0;
+    goud_physics_body mover = 0;
+    REQUIRE(world.addBody(0, goud_vec2{0.0f, 0.0f}, sensor, 0.0f) == SUCCESS);
+    REQUIRE(world.addBody(1, goud_vec2{0.0f, 0.0f}, mover, 0.0f) == SUCCESS);
+    REQUIRE(goud_physics_add_collider_ex(context.raw(), sensor, 0, 0.0f, 0.0f, 2.0f, 0.5f, 0.0f,
+                                         true, 0x1, UINT32_MAX) > 0);
+    REQUIRE(goud_physics_add_collider_ex(context.raw(), mover, 0, 0.0f, 0.0f, 0.5f, 0.5f, 0.0f,
+                                         false, 0x1, UINT32_MAX) > 0);
+
+    std::vector<goud::CollisionEvent> events;
+    REQUIRE(world.step(1.0f / 60.0f) == SUCCESS);
+    REQUIRE(world.drainCollisionEvents(events) == SUCCESS);
+    REQUIRE(events.size() == 1);
+    REQUIRE(events[0].kind == 0);
+
+    REQUIRE(world.drainCollisionEvents(events, 0x2) == SUCCESS);
+    REQUIRE(events.empty());
+}
+
+TEST_CASE("PhysicsWorld answers ray and overlap batches", "[physics][gl_required]") {
+    int status = ERR_INTERNAL_ERROR;
+    goud::Context context = goud::Context::create(&status);
+    REQUIRE(status == SUCCESS);
+    goud::PhysicsWorld world = goud::PhysicsWorld::create(
+        context, goud_vec2{0.0f, 0.0f}, goud::PhysicsWorld::Backend::Rapier, &status);
+    REQUIRE(status == SUCCESS);
+
+    goud_physics_body wall = 0;
+    REQUIRE(world.addBody(0, goud_vec2{10.0f, 0.0f}, wall, 0.0f) == SUCCESS);
+    REQUIRE(world.addCollider(wall, 1, goud_vec2{1.0f, 1.0f}, 0.0f) == SUCCESS);
+    REQUIRE(world.step(1.0f / 60.0f) == SUCCESS);
+
+    std::vector<goud::Ray> rays(1000, goud::Ray{0.0f, 0.0f, 1.0f, 0.0f, 100.0f});
+    rays[1].dir_x = -1.0f;
+    std::vector<goud::RayHit> hits(rays.size());
+    std::uint32_t hit_count = 0;
+    REQUIRE(world.raycastBatch(rays.data(), rays.size(), UINT32_MAX, hits.data(), &hit_count) == SUCCESS);
+    REQUIRE(hit_count == rays.size() - 1);
+    REQUIRE(hits[0].body == wall);
+    REQUIRE(hits[1].hit == 0);
+
+    goud_rect rects[2] = {{9.5f, -0.5f, 1.0f, 1.0f}, {-5.0f, -5.0f, 1.0f, 1.0f}};
+    goud_physics_body bodies[2] = {};
+    std::uint32_t overlaps = 0;
+    REQUIRE(world.overlapBatch(rects, 2, UINT32_MAX, bodies, &overlaps) == SUCCESS);
+    REQUIRE(overlaps == 1);
+    REQUIRE(bodies[0] == wall);
+    REQUIRE(bodies[1] == 0);
+}
@@ -0,0 +1,57 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/prefab.hpp>
+
+#include <algorithm>
+#include <vector>
+
+TEST_CASE("Prefab default is invalid", "[prefab]") {
+    goud::Prefab prefab;
+    REQUIRE_FALSE(prefab.valid());
+    REQUIRE(prefab.root() == GOUD_INVALID_ENTITY_ID);
+    REQUIRE(prefab.instantiated() == 0);
+}
+
+TEST_CASE("Prefab instantiate checks its buffer", "[prefab]") {
+    goud::Prefab prefab;
+    std::uint32_t spawned = 99;
+    REQUIRE(prefab.instantiate(0, nullptr, &spawned) == SUCCESS);
+    REQUIRE(spawned == 0);
+    REQUIRE(prefab.instantiate(4, nullptr, &spawned) == ERR_INVALID_STATE);
+    REQUIRE(spawned == 0);
+}
+
+TEST_CASE("Prefab on an invalid context creates nothing", "[prefab]") {
+    goud::Prefab prefab(goud_context_invalid(), 1);
+    REQUIRE_FALSE(prefab.valid());
+
+    std::vector<std::uint64_t> instances(3, 7);
+    REQUIRE(prefab.instantiate(8, instances) != SUCCESS);
+    REQUIRE(instances.empty());
+    REQUIRE(prefab.instantiated() == 0);
+}
+
+TEST_CASE("Prefab instantiates a wave in one call", "[prefab][gl_required]") {
+    int status = ERR_INTERNAL_ERROR;
+    goud::Context ctx = goud::Context::create(&status);
+    REQUIRE(status == SUCCESS);
+
+    std::uint64_t root = GOUD_INVALID_ENTITY_ID;
+    REQUIRE(ctx.spawnEntity(root) == SUCCESS);
+    goud::Prefab prefab(ctx, root);
+    REQUIRE(prefab.valid());
+
+    std::vector<std::uint64_t> wave;
+    REQUIRE(prefab.instantiate(500, wave) == SUCCESS);
+    REQUIRE(wave.size() == 500);
+    REQUIRE(prefab.instantiated() == 500);
+    REQUIRE(std::find(wave.begin(), wave.end(), prefab.root()) == wave.end());
+
+    std::vector<std::uint8_t> alive;
+    REQUIRE(ctx.aliveMask(wave, alive) == SUCCESS);
+    REQUIRE(std::count(alive.begin(), alive.end(), 1) == 500);
+
+    REQUIRE(ctx.destroyEntity(prefab.root()) == SUCCESS);
+    REQUIRE_FALSE(prefab.valid());
+    REQUIRE(prefab.instantiate(1, wave) != SUCCESS);
+    REQUIRE(wave.empty());
+}
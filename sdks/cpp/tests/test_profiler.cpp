@@ -0,0 +1,124 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/profiler.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace {
+
+std::size_t countEvents(const goud::ProfileFrame &frame, const char *name) {
+    std::size_t count = 0;
+    for (const goud::ProfileEvent &event : frame.events) {
+        count += std::string(event.name) == name ? 1u : 0u;
+    }
+    return count;
+}
+
+}  // namespace
+
+TEST_CASE("Profiler is compiled in for the tests", "[profiler]") {
+    REQUIRE(goud::Profiler::enabled);
+}
+
+TEST_CASE("GOUD_PROFILE_SCOPE records nested scopes", "[profiler]") {
+    goud::Profiler &profiler = goud::Profiler::instance();
+    profiler.clear();
+    profiler.beginFrame();
+    {
+        GOUD_PROFILE_SCOPE("test.outer");
+        {
+            GOUD_PROFILE_SCOPE("test.inner");
+        }
+    }
+    REQUIRE(profiler.endFrame() == SUCCESS);
+
+    const goud::ProfileFrame *frame = profiler.lastFrame();
+    REQUIRE(frame != nullptr);
+    REQUIRE(countEvents(*frame, "test.outer") == 1);
+    REQUIRE(countEvents(*frame, "test.inner") == 1);
+    REQUIRE(frame->dropped == 0);
+
+    // Sorted by start: the outer scope opened first and encloses the inner one.
+    const goud::ProfileEvent &outer = frame->events[0];
+    const goud::ProfileEvent &inner = frame->events[1];
+    REQUIRE(std::string(outer.name) == "test.outer");
+    REQUIRE(outer.begin_ns <= inner.begin_ns);
+    REQUIRE(outer.end_ns >= inner.end_ns);
+    REQUIRE(frame->begin_ns <= outer.begin_ns);
+    REQUIRE(frame->end_ns >= outer.end_ns);
+}
+
+TEST_CASE("Profiler drains scopes from several threads", "[profiler]") {
+    goud::Profiler &profiler = goud::Profiler::instance();
+    profiler.clear();
+
+    std::thread workers[3];
+    for (std::thread &worker : workers) {
+        worker = std::thread([] {
+            for (int i = 0; i < 100; ++i) {
+                GOUD_PROFILE_SCOPE("test.worker");
+            }
+        });
+    }
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+    REQUIRE(profiler.endFrame() == SUCCESS);
+    REQUIRE(countEvents(*profiler.lastFrame(), "test.worker") == 300);
+}
+
+TEST_CASE("Profiler counts scopes dropped by a full ring", "[profiler]") {
+    goud::Profiler &profiler = goud::Profiler::instance();
+    profiler.clear();
+    for (std::size_t i = 0; i < goud::Profiler::kRingCapacity + 10; ++i) {
+        profiler.record("test.flood", i, i + 1);
+    }
+    REQUIRE(profiler.endFrame() == SUCCESS);
+    REQUIRE(profiler.lastFrame()->events.size() == goud::Profiler::kRingCapacity);
+    REQUIRE(profiler.lastFrame()->dropped == 10);
+
+    REQUIRE(profiler.endFrame() == SUCCESS);
+    REQUIRE(profiler.lastFrame()->events.empty());
+    REQUIRE(profiler.lastFrame()->dropped == 0);
+}
+
+TEST_CASE("Profiler keeps a bounded history", "[profiler]") {
+    goud::Profiler &profiler = goud::Profiler::instance();
+    profiler.clear();
+    profiler.setHistory(4);
+    for (int i = 0; i < 10; ++i) {
+        REQUIRE(profiler.endFrame() == SUCCESS);
+    }
+    REQUIRE(profiler.frames().size() == 4);
+    REQUIRE(profiler.frames().back().index == profiler.frames().front().index + 3);
+    profiler.setHistory(goud::Profiler::kDefaultHistory);
+}
+
+TEST_CASE("Profiler writes a Chrome trace", "[profiler]") {
+    goud::Profiler &profiler = goud::Profiler::instance();
+    profiler.clear();
+    profiler.setThreadName("main \"game\"");
+    {
+        GOUD_PROFILE_SCOPE("test.trace");
+    }
+    REQUIRE(profiler.endFrame() == SUCCESS);
+
+    const char *path = "goud_cpp_tests_profile.json";
+    REQUIRE(profiler.writeChromeTrace(path) == SUCCESS);
+    std::ifstream file(path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    file.close();
+    std::remove(path);
+
+    std::string json = contents.str();
+    REQUIRE(json.find("\"traceEvents\"") != std::string::npos);
+    REQUIRE(json.find("\"name\":\"test.trace\",\"ph\":\"X\"") != std::string::npos);
+    REQUIRE(json.find("main \\\"game\\\"") != std::string::npos);
+    REQUIRE(json.find("\"engine phases\"") != std::string::npos);
+
+    REQUIRE(profiler.writeChromeTrace(nullptr) == ERR_INVALID_STATE);
+}
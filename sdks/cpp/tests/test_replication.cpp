@@ -0,0 +1,200 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/replication.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+struct NetTransform {
+    float x;
+    float y;
+    std::uint32_t flags;
+};
+
+struct NetHealth {
+    std::int32_t current;
+};
+
+goud::ReplicationSchema transformSchema() {
+    goud::ReplicationSchema schema(sizeof(NetTransform));
+    schema.quantized(offsetof(NetTransform, x), -1024.0f, 1024.0f, 16)
+        .quantized(offsetof(NetTransform, y), -1024.0f, 1024.0f, 16)
+        .raw(offsetof(NetTransform, flags), sizeof(std::uint32_t));
+    return schema;
+}
+
+struct Replication {
+    goud::Context context;
+    goud::SnapshotSender sender{context};
+    goud::SnapshotReceiver receiver;
+    std::vector<std::uint8_t> delta;
+    std::vector<std::uint8_t> ack;
+
+    Replication() {
+        REQUIRE(sender.track<NetTransform>(transformSchema()) == SUCCESS);
+        REQUIRE(sender.track<NetHealth>() == SUCCESS);
+        REQUIRE(receiver.track<NetTransform>(transformSchema()) == SUCCESS);
+        REQUIRE(receiver.track<NetHealth>() == SUCCESS);
+    }
+
+    void tick(const std::vector<goud_entity> &entities, const std::vector<NetTransform> &transforms) {
+        REQUIRE(sender.beginSnapshot() == SUCCESS);
+        REQUIRE(sender.captureTable(entities.data(), transforms.data(), entities.size()) == SUCCESS);
+        REQUIRE(sender.encodeDelta(7, delta) == SUCCESS);
+    }
+
+    void acknowledge() {
+        REQUIRE(receiver.encodeAck(ack) == SUCCESS);
+        REQUIRE(goud::SnapshotSender::isAck(ack.data(), ack.size()));
+        REQUIRE(sender.handleAck(7, ack.data(), ack.size()) == SUCCESS);
+    }
+};
+
+}  // namespace
+
+TEST_CASE("ReplicationSchema validates its fields", "[replication]") {
+    REQUIRE(goud::ReplicationSchema::words(10).fields().size() == 3);
+    REQUIRE(goud::ReplicationSchema::words(10).fields()[2].size == 2);
+    REQUIRE(transformSchema().valid());
+    REQUIRE_FALSE(goud::ReplicationSchema(8).valid());
+
+    goud::ReplicationSchema overrun(8);
+    overrun.raw(6, 4);
+    REQUIRE_FALSE(overrun.valid());
+
+    goud::ReplicationSchema bad_range(8);
+    bad_range.quantized(0, 1.0f, 1.0f, 8);
+    REQUIRE_FALSE(bad_range.valid());
+
+    goud::ReplicationSchema bad_bits(8);
+    bad_bits.quantized(0, 0.0f, 1.0f, 33);
+    REQUIRE_FALSE(bad_bits.valid());
+
+    goud::SnapshotReceiver receiver;
+    REQUIRE(receiver.track<NetTransform>(goud::ReplicationSchema::words(4)) == ERR_INVALID_STATE);
+}
+
+TEST_CASE("Bit writer and reader round-trip values and varints", "[replication]") {
+    std::vector<std::uint8_t> bytes;
+    goud::detail::BitWriter writer(bytes);
+    writer.write(1, 1);
+    writer.write(0x2A, 6);
+    writer.writeVarint(300);
+    writer.write(0xFFFFFFFFFFull, 40);
+    REQUIRE(bytes.size() == 8);
+
+    goud::detail::BitReader reader(bytes.data(), bytes.size());
+    REQUIRE(reader.read(1) == 1);
+    REQUIRE(reader.read(6) == 0x2A);
+    REQUIRE(reader.readVarint() == 300);
+    REQUIRE(reader.read(40) == 0xFFFFFFFFFFull);
+    REQUIRE(reader.ok());
+    reader.read(8);
+    REQUIRE_FALSE(reader.ok());
+}
+
+TEST_CASE("Snapshot deltas rebuild state and shrink after acknowledgement", "[replication]") {
+    Replication replication;
+    std::vector<goud_entity> entities = {30, 10, 20};
+    std::vector<NetTransform> transforms = {{3.0f, -3.0f, 3}, {1.0f, -1.0f, 1}, {2.0f, -2.0f, 2}};
+
+    replication.tick(entities, transforms);
+    std::size_t full_size = replication.delta.size();
+    std::size_t notified = 0;
+    REQUIRE(replication.receiver.applyDelta(
+                replication.delta.data(), replication.delta.size(),
+                [&](std::uint64_t type_id, goud_entity, const void *component) {
+                    REQUIRE(type_id == goud::ComponentTraits<NetTransform>::typeId());
+                    REQUIRE(component != nullptr);
+                    ++notified;
+                }) == SUCCESS);
+    REQUIRE(notified == 3);
+    REQUIRE(replication.receiver.count<NetTransform>() == 3);
+    const NetTransform *second = replication.receiver.find<NetTransform>(20);
+    REQUIRE(second != nullptr);
+    REQUIRE(std::fabs(second->x - 2.0f) < 0.02f);
+    REQUIRE(second->flags == 2);
+
+    // Unacknowledged: the next delta still carries full state.
+    replication.tick(entities, transforms);
+    REQUIRE(replication.delta.size() == full_size);
+    REQUIRE(replication.receiver.applyDelta(replication.delta.data(), replication.delta.size()) == SUCCESS);
+    replication.acknowledge();
+
+    // Nothing changed since the acknowledged snapshot.
+    replication.tick(entities, transforms);
+    REQUIRE(replication.delta.size() < full_size / 2);
+    REQUIRE(replication.receiver.applyDelta(replication.delta.data(), replication.delta.size()) == SUCCESS);
+    REQUIRE(replication.receiver.count<NetTransform>() == 3);
+
+    // One field moves, one entity leaves, one arrives.
+    replication.acknowledge();
+    entities = {10, 20, 40};
+    transforms = {{1.0f, 5.0f, 1}, {2.0f, -2.0f, 2}, {4.0f, -4.0f, 4}};
+    replication.tick(entities, transforms);
+    REQUIRE(replication.delta.size() < full_size);
+
+    std::vector<goud_entity> removed;
+    std::vector<goud_entity> changed;
+    REQUIRE(replication.receiver.applyDelta(
+                replication.delta.data(), replication.delta.size(),
+                [&](std::uint64_t, goud_entity entity, const void *component) {
+                    (component == nullptr ? removed : changed).push_back(entity);
+                }) == SUCCESS);
+    REQUIRE(removed == std::vector<goud_entity>{30});
+    REQUIRE(changed == std::vector<goud_entity>{10, 40});
+    REQUIRE(replication.receiver.find<NetTransform>(30) == nullptr);
+    REQUIRE(std::fabs(replication.receiver.find<NetTransform>(10)->y - 5.0f) < 0.02f);
+    REQUIRE(replication.receiver.find<NetTransform>(40)->flags == 4);
+    REQUIRE(replication.receiver.find<NetTransform>(20)->flags == 2);
+}
+
+TEST_CASE("Quantized jitter below one step is not resent", "[replication]") {
+    Replication replication;
+    std::vector<goud_entity> entities = {1};
+    std::vector<NetTransform> transforms = {{100.0f, 0.0f, 0}};
+    replication.tick(entities, transforms);
+    REQUIRE(replication.receiver.applyDelta(replication.delta.data(), replication.delta.size()) == SUCCESS);
+    replication.acknowledge();
+
+    transforms[0].x = 100.001f;
+    replication.tick(entities, transforms);
+    std::size_t notified = 0;
+    REQUIRE(replication.receiver.applyDelta(replication.delta.data(), replication.delta.size(),
+                                            [&](std::uint64_t, goud_entity, const void *) { ++notified; }) ==
+            SUCCESS);
+    REQUIRE(notified == 0);
+}
+
+TEST_CASE("SnapshotReceiver rejects malformed and unknown-baseline deltas", "[replication]") {
+    Replication replication;
+    std::vector<goud_entity> entities = {1, 2};
+    std::vector<NetTransform> transforms = {{1.0f, 1.0f, 1}, {2.0f, 2.0f, 2}};
+    replication.tick(entities, transforms);
+
+    std::vector<std::uint8_t> truncated(replication.delta.begin(), replication.delta.end() - 1);
+    REQUIRE(replication.receiver.applyDelta(truncated.data(), truncated.size()) == ERR_INVALID_STATE);
+    REQUIRE(replication.receiver.applyDelta(nullptr, 0) == ERR_INVALID_STATE);
+    REQUIRE(replication.receiver.encodeAck(replication.ack) == ERR_INVALID_STATE);
+
+    REQUIRE(replication.receiver.applyDelta(replication.delta.data(), replication.delta.size()) == SUCCESS);
+    replication.acknowledge();
+    replication.tick(entities, transforms);
+
+    goud::SnapshotReceiver fresh;
+    REQUIRE(fresh.track<NetTransform>(transformSchema()) == SUCCESS);
+    REQUIRE(fresh.track<NetHealth>() == SUCCESS);
+    REQUIRE(fresh.applyDelta(replication.delta.data(), replication.delta.size()) == ERR_INVALID_STATE);
+
+    std::vector<std::uint8_t> stale = replication.delta;
+    REQUIRE(replication.receiver.applyDelta(stale.data(), stale.size()) == SUCCESS);
+    std::uint32_t latest = replication.receiver.sequence();
+    REQUIRE(replication.receiver.applyDelta(stale.data(), stale.size()) == SUCCESS);
+    REQUIRE(replication.receiver.sequence() == latest);
+
+    REQUIRE(replication.sender.handleAck(7, replication.delta.data(), replication.delta.size()) ==
+            ERR_INVALID_STATE);
+}
@@ -0,0 +1,53 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/skeleton.hpp>
+
+#include <cstdint>
+
+TEST_CASE("Skeleton C wrappers reject NULL arguments", "[skeleton]") {
+    goud_context context = goud_context_invalid();
+    std::int32_t index = -1;
+    float palette[GOUD_BONE_PALETTE_FLOATS] = {};
+
+    REQUIRE(goud_skeleton_bone_add(context, 1, NULL, -1, 0.0f, 0.0f, 0.0f, &index) == ERR_INVALID_STATE);
+    REQUIRE(goud_skeleton_play(context, 1, NULL, true) == ERR_INVALID_STATE);
+    REQUIRE(goud_skeleton_layer_push(context, 1, NULL, 0, true, &index) == ERR_INVALID_STATE);
+    REQUIRE(goud_skeleton_update_palettes(context, NULL, 2, 0.016f, palette, GOUD_BONE_PALETTE_FLOATS, NULL, NULL) ==
+            ERR_INVALID_STATE);
+    REQUIRE(index == -1);
+}
+
+TEST_CASE("SkeletonBatch starts empty and tracks its entities", "[skeleton]") {
+    goud::SkeletonBatch batch;
+
+    REQUIRE(batch.size() == 0);
+    REQUIRE(batch.boneCount() == 0);
+    REQUIRE(batch.paletteFloats() == 0);
+    REQUIRE(batch.firstBone(0) == 0);
+
+    REQUIRE(batch.add(1) == SUCCESS);
+    REQUIRE(batch.add(2) == SUCCESS);
+    REQUIRE(batch.size() == 2);
+
+    batch.clear();
+    REQUIRE(batch.size() == 0);
+    REQUIRE(batch.boneCount() == 0);
+}
+
+TEST_CASE("Skeleton operations fail without a context", "[skeleton][gl_required]") {
+    goud_context context = goud_context_invalid();
+    int status = SUCCESS;
+
+    goud::Skeleton skeleton = goud::Skeleton::attach(context, 1, &status);
+    REQUIRE(status != SUCCESS);
+    REQUIRE(skeleton.entity() == 1);
+    REQUIRE(skeleton.addBone("root", -1, 0.0f, 0.0f, 0.0f) != SUCCESS);
+    REQUIRE(skeleton.play("walk") != SUCCESS);
+    REQUIRE(skeleton.key(goud::Skeleton::kBaseLayer, 0, 0.5f, 0.0f, 0.0f, 1.0f) != SUCCESS);
+    REQUIRE(skeleton.addLayer("aim", 1) != SUCCESS);
+    REQUIRE(skeleton.setLayerWeight(1, 0.5f) != SUCCESS);
+
+    goud::SkeletonBatch batch;
+    REQUIRE(batch.add(1) == SUCCESS);
+    REQUIRE(batch.update(context, 0.016f) != SUCCESS);
+    REQUIRE(batch.boneCount() == 0);
+}
@@ -0,0 +1,79 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/physics_world.hpp>
+#include <goud/snapshot.hpp>
+
+#include <utility>
+
+TEST_CASE("WorldSnapshot and PhysicsState default to invalid", "[snapshot]") {
+    goud::WorldSnapshot snapshot;
+    REQUIRE_FALSE(snapshot.valid());
+    REQUIRE(snapshot.raw() < 0);
+    REQUIRE(snapshot.reset() == SUCCESS);
+
+    goud::PhysicsState state;
+    REQUIRE_FALSE(state.valid());
+    REQUIRE(state.raw() < 0);
+    REQUIRE(state.reset() == SUCCESS);
+}
+
+TEST_CASE("Snapshot C wrappers reject NULL outputs", "[snapshot]") {
+    goud_context context = goud_context_invalid();
+    REQUIRE(goud_world_snapshot_take(context, NULL) == ERR_INVALID_STATE);
+    REQUIRE(goud_world_snapshot_stats_get(1, NULL) == ERR_INVALID_STATE);
+    REQUIRE(goud_physics_state_capture(context, NULL) == ERR_INVALID_STATE);
+}
+
+TEST_CASE("WorldSnapshot move transfers ownership", "[snapshot]") {
+    goud::WorldSnapshot snapshot;
+    goud::WorldSnapshot moved(std::move(snapshot));
+    REQUIRE_FALSE(snapshot.valid());
+    REQUIRE_FALSE(moved.valid());
+    snapshot = std::move(moved);
+    REQUIRE(snapshot.release() < 0);
+}
+
+TEST_CASE("WorldSnapshot rolls a context back", "[snapshot][gl_required]") {
+    int status = ERR_INTERNAL_ERROR;
+    goud::Context context = goud::Context::create(&status);
+    REQUIRE(status == SUCCESS);
+
+    goud_entity entity = GOUD_INVALID_ENTITY_ID;
+    REQUIRE(goud_entity_spawn(context.raw(), &entity) == SUCCESS);
+    goud::WorldSnapshot snapshot = goud::WorldSnapshot::save(context, &status);
+    REQUIRE(status == SUCCESS);
+    REQUIRE(snapshot.valid());
+
+    goud_world_snapshot_stats stats{};
+    REQUIRE(snapshot.stats(stats) == SUCCESS);
+    REQUIRE(stats.entity_count == 1);
+
+    REQUIRE(goud_entity_remove(context.raw(), entity) == SUCCESS);
+    REQUIRE(snapshot.restore(context) == SUCCESS);
+    REQUIRE(goud_entity_is_alive(context.raw(), entity));
+    REQUIRE(snapshot.update(context) == SUCCESS);
+}
+
+TEST_CASE("PhysicsState rewinds a deterministic world", "[snapshot][gl_required]") {
+    int status = ERR_INTERNAL_ERROR;
+    goud::Context context = goud::Context::create(&status);
+    REQUIRE(status == SUCCESS);
+    goud::PhysicsWorld world = goud::PhysicsWorld::create(
+        context, goud_vec2{0.0f, -9.81f}, goud::PhysicsWorld::Backend::Rapier, &status);
+    REQUIRE(status == SUCCESS);
+    REQUIRE(world.setDeterministic(true) == SUCCESS);
+
+    goud_physics_body body = 0;
+    REQUIRE(world.addBody(1, goud_vec2{0.0f, 10.0f}, body) == SUCCESS);
+    goud::PhysicsState state = goud::PhysicsState::save(context, &status);
+    REQUIRE(status == SUCCESS);
+
+    goud_vec2 before{};
+    REQUIRE(world.step(1.0f / 60.0f) == SUCCESS);
+    REQUIRE(world.readBodies(&body, 1, &before) == SUCCESS);
+    REQUIRE(state.restore(context) == SUCCESS);
+
+    goud_vec2 after{};
+    REQUIRE(world.step(0.5f) == SUCCESS);
+    REQUIRE(world.readBodies(&body, 1, &after) == SUCCESS);
+    REQUIRE(after.y == before.y);
+}
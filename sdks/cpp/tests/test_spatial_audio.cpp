@@ -0,0 +1,46 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/goud.hpp>
+
+TEST_CASE("Spatial batch C wrapper checks its arguments", "[spatial_audio]") {
+    goud_context context = goud_context_invalid();
+    const float listener[3] = {0.0f, 0.0f, 0.0f};
+    goud_spatial_source_update update{};
+    std::uint32_t applied = 7;
+
+    REQUIRE(goud_audio_spatial_update_batch(context, nullptr, &update, 1, &applied) == ERR_INVALID_STATE);
+    REQUIRE(applied == 0);
+    REQUIRE(goud_audio_spatial_update_batch(context, listener, nullptr, 1, &applied) == ERR_INVALID_STATE);
+}
+
+TEST_CASE("Spatial source update matches the engine layout", "[spatial_audio]") {
+    REQUIRE(sizeof(goud_spatial_source_update) == 32);
+    goud_spatial_source_update update{};
+    update.player_id = 3;
+    update.max_distance = 25.0f;
+    REQUIRE(update.player_id == 3);
+    REQUIRE(update.rolloff == 0.0f);
+}
+
+TEST_CASE("Context spatial batch rejects oversized counts", "[spatial_audio]") {
+    goud::Context context;
+    const float listener[3] = {0.0f, 0.0f, 0.0f};
+    goud_spatial_source_update update{};
+    std::size_t applied = 7;
+    if (sizeof(std::size_t) > sizeof(std::uint32_t)) {
+        std::size_t oversized = static_cast<std::size_t>(std::numeric_limits<std::uint32_t>::max()) + 1;
+        REQUIRE(context.updateSpatialSources(listener, &update, oversized, &applied) == ERR_INVALID_STATE);
+        REQUIRE(applied == 0);
+    }
+    REQUIRE(context.updateSpatialSources(listener, nullptr, 2, &applied) == ERR_INVALID_STATE);
+}
+
+TEST_CASE("Context spatial batch fails cleanly on an invalid context", "[spatial_audio][gl_required]") {
+    goud::Context context;
+    const float listener[3] = {0.0f, 0.0f, 0.0f};
+    goud_spatial_source_update update{};
+    update.player_id = 1;
+    update.max_distance = 10.0f;
+    update.rolloff = 1.0f;
+    update.volume = 1.0f;
+    REQUIRE(context.updateSpatialSources(listener, &update, 1) != SUCCESS);
+}
@@ -0,0 +1,72 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/sprite_animation.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+constexpr goud_color kWhite{ 1.0f, 1.0f, 1.0f, 1.0f };
+
+}  // namespace
+
+TEST_CASE("updateAnimators checks its arguments", "[sprite_animation]") {
+    goud_context context = goud_context_invalid();
+    std::uint32_t updated = 7;
+    REQUIRE(goud::updateAnimators(context, nullptr, 3, 0.016f, nullptr, &updated) ==
+            ERR_INVALID_STATE);
+    REQUIRE(updated == 0);
+
+    updated = 7;
+    REQUIRE(goud::updateAnimators(context, nullptr, 0, 0.016f, nullptr, &updated) == SUCCESS);
+    REQUIRE(updated == 0);
+    REQUIRE(goud_animation_update_animators(context, nullptr, 0, 0.016f, nullptr, nullptr) ==
+            SUCCESS);
+}
+
+TEST_CASE("updateAnimators needs one batch command per entity", "[sprite_animation]") {
+    goud_context context = goud_context_invalid();
+    std::vector<goud_entity> entities{ 1, 2, 3 };
+    goud::SpriteBatch batch;
+    REQUIRE(batch.add(1, 0.0f, 0.0f, 16.0f, 16.0f, 0.0f, kWhite) == SUCCESS);
+
+    std::uint32_t updated = 7;
+    REQUIRE(goud::updateAnimators(context, entities, 0.016f, batch, &updated) ==
+            ERR_INVALID_STATE);
+    REQUIRE(updated == 0);
+    REQUIRE(batch.data()[0].src_w == 0.0f);
+
+    std::vector<goud_entity> none;
+    goud::SpriteBatch empty;
+    REQUIRE(goud::updateAnimators(context, none, 0.016f, empty) == SUCCESS);
+}
+
+TEST_CASE("SpriteBatch exposes its commands for in-place updates", "[sprite_animation]") {
+    goud::SpriteBatch batch;
+    REQUIRE(batch.add(4, 0.0f, 0.0f, 16.0f, 16.0f, 0.0f, kWhite) == SUCCESS);
+    goud_sprite_cmd *cmds = batch.data();
+    cmds[0].src_x = 32.0f;
+    cmds[0].src_w = 16.0f;
+    const goud::SpriteBatch &view = batch;
+    REQUIRE(view.data()[0].src_x == 32.0f);
+    REQUIRE(view.data()[0].texture == 4);
+}
+
+TEST_CASE("updateAnimators rejects invalid contexts and repeated entities",
+          "[sprite_animation][gl_required]") {
+    std::vector<goud_entity> entities{ 1, 2 };
+    std::vector<goud_sprite_cmd> cmds(2);
+    REQUIRE(goud::updateAnimators(goud_context_invalid(), entities.data(), 2, 0.016f,
+                                  cmds.data()) == ERR_INVALID_CONTEXT);
+
+    goud_context context = goud_context_create();
+    std::vector<goud_entity> repeated{ 5, 5 };
+    REQUIRE(goud::updateAnimators(context, repeated.data(), 2, 0.016f, cmds.data()) ==
+            ERR_INVALID_STATE);
+
+    std::uint32_t updated = 7;
+    REQUIRE(goud::updateAnimators(context, entities.data(), 2, 0.016f, cmds.data(),
+                                  &updated) == SUCCESS);
+    REQUIRE(updated == 0);
+    REQUIRE(goud_context_destroy(context));
+}
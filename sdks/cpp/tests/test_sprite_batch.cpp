@@ -0,0 +1,212 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/goud.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr goud_color kWhite{ 1.0f, 1.0f, 1.0f, 1.0f };
+
+}  // namespace
+
+TEST_CASE("SpriteBatch records commands in order", "[sprite_batch]") {
+    goud::SpriteBatch batch;
+    REQUIRE(batch.empty());
+
+    REQUIRE(batch.add(7, 1.0f, 2.0f, 3.0f, 4.0f, 0.5f, kWhite) == SUCCESS);
+    REQUIRE(batch.add(7, 5.0f, 6.0f, 7.0f, 8.0f, 0.0f, kWhite) == SUCCESS);
+    REQUIRE(batch.size() == 2);
+
+    const goud_sprite_cmd *cmds = batch.data();
+    REQUIRE(cmds[0].texture == 7);
+    REQUIRE(cmds[0].x == 1.0f);
+    REQUIRE(cmds[0].height == 4.0f);
+    REQUIRE(cmds[0].rotation == 0.5f);
+    REQUIRE(cmds[0].src_w == 0.0f);
+    REQUIRE(cmds[0].src_h == 0.0f);
+    REQUIRE(cmds[1].x == 5.0f);
+}
+
+TEST_CASE("SpriteBatch layers follow texture changes", "[sprite_batch]") {
+    goud::SpriteBatch batch;
+    batch.add(1, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, kWhite);
+    batch.add(1, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, kWhite);
+    batch.add(2, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, kWhite);
+    batch.add(1, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, kWhite);
+
+    const goud_sprite_cmd *cmds = batch.data();
+    REQUIRE(cmds[0].z_layer == 0);
+    REQUIRE(cmds[1].z_layer == 0);
+    REQUIRE(cmds[2].z_layer == 1);
+    REQUIRE(cmds[3].z_layer == 2);
+}
+
+TEST_CASE("SpriteBatch clear keeps capacity", "[sprite_batch]") {
+    goud::SpriteBatch batch(64);
+    REQUIRE(batch.capacity() >= 64);
+
+    batch.add(1, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, kWhite);
+    batch.clear();
+    REQUIRE(batch.empty());
+    REQUIRE(batch.capacity() >= 64);
+
+    batch.add(3, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, kWhite);
+    REQUIRE(batch.data()[0].z_layer == 0);
+}
+
+TEST_CASE("SpriteBatch flush of an empty batch succeeds", "[sprite_batch]") {
+    goud::SpriteBatch batch;
+    std::uint32_t drawn = 99;
+    REQUIRE(batch.flush(goud_context_invalid(), &drawn) == SUCCESS);
+    REQUIRE(drawn == 0);
+}
+
+TEST_CASE("SpriteBatch flush empties the batch on error", "[sprite_batch]") {
+    goud::SpriteBatch batch;
+    batch.add(1, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, kWhite);
+
+    REQUIRE(batch.flush(goud_context_invalid()) != SUCCESS);
+    REQUIRE(batch.empty());
+}
+
+TEST_CASE("Context::drawSprite records into the sprite batch", "[sprite_batch][context]") {
+    goud::Context ctx;
+    REQUIRE(ctx.spriteBatching());
+
+    REQUIRE(ctx.drawSprite(1, 0.0f, 0.0f, 8.0f, 8.0f, 0.0f, kWhite) == SUCCESS);
+    REQUIRE(ctx.drawSprite(2, 0.0f, 0.0f, 8.0f, 8.0f, 0.0f, kWhite) == SUCCESS);
+    REQUIRE(ctx.spriteBatch().size() == 2);
+
+    goud::Context moved(std::move(ctx));
+    REQUIRE(moved.spriteBatch().size() == 2);
+
+    moved.setSpriteBatching(false);
+    REQUIRE(moved.spriteBatch().empty());
+    REQUIRE_FALSE(moved.spriteBatching());
+}
+
+TEST_CASE("SpriteBatch LayerTexture sort restores flappy_bird layer order", "[sprite_batch]") {
+    // Layers as drawn by flappy::GameManager::draw.
+    enum Layer : std::int32_t { Background, Score, Pipes, Bird, Base };
+    const goud_texture background = 10, digit = 20, pipe = 30, bird = 40, base = 50;
+
+    goud::SpriteBatch batch;
+    batch.setSortMode(goud::SpriteSortMode::LayerTexture);
+
+    auto add = [&](std::int32_t layer, goud_texture texture, float x) {
+        batch.setLayer(layer);
+        batch.add(texture, x, 0.0f, 1.0f, 1.0f, 0.0f, kWhite);
+    };
+    add(Base, base, 0.0f);
+    add(Pipes, pipe, 0.0f);
+    add(Bird, bird, 0.0f);
+    add(Score, digit, 0.0f);
+    add(Pipes, pipe, 1.0f);
+    add(Background, background, 0.0f);
+    add(Score, digit, 1.0f);
+    add(Pipes, pipe, 2.0f);
+
+    REQUIRE(batch.sort() == SUCCESS);
+
+    const goud_sprite_cmd *cmds = batch.data();
+    const goud_texture expected[] = { background, digit, digit, pipe, pipe, pipe, bird, base };
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        REQUIRE(cmds[i].texture == expected[i]);
+    }
+    // Same layer and texture keeps submission order.
+    REQUIRE(cmds[1].x == 0.0f);
+    REQUIRE(cmds[2].x == 1.0f);
+    REQUIRE(cmds[3].x == 0.0f);
+    REQUIRE(cmds[4].x == 1.0f);
+    REQUIRE(cmds[5].x == 2.0f);
+}
+
+TEST_CASE("SpriteBatch LayerTexture sort groups textures within a layer", "[sprite_batch]") {
+    goud::SpriteBatch batch;
+    batch.setSortMode(goud::SpriteSortMode::LayerTexture);
+    batch.setLayer(-3);
+    batch.add(2, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, kWhite);
+    batch.add(1, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, kWhite);
+    batch.add(2, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, kWhite);
+    batch.setLayer(-4);
+    batch.add(3, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, kWhite);
+
+    REQUIRE(batch.sort() == SUCCESS);
+
+    const goud_sprite_cmd *cmds = batch.data();
+    REQUIRE(cmds[0].texture == 3);
+    REQUIRE(cmds[0].z_layer == -4);
+    REQUIRE(cmds[1].texture == 1);
+    REQUIRE(cmds[2].texture == 2);
+    REQUIRE(cmds[2].x == 0.0f);
+    REQUIRE(cmds[3].texture == 2);
+    REQUIRE(cmds[3].x == 1.0f);
+}
+
+TEST_CASE("SpriteBatch radix sort matches std::stable_sort", "[sprite_batch]") {
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<std::int32_t> layers(-8, 8);
+    std::uniform_int_distribution<std::uint32_t> textures(0, 5);
+
+    goud::SpriteBatch batch;
+    batch.setSortMode(goud::SpriteSortMode::LayerTexture);
+    std::vector<goud_sprite_cmd> reference;
+    for (int i = 0; i < 5000; ++i) {
+        goud_sprite_cmd cmd{};
+        cmd.texture = (static_cast<goud_texture>(1) << 32) | textures(rng);
+        cmd.z_layer = layers(rng);
+        cmd.x = static_cast<float>(i);
+        batch.add(cmd);
+        reference.push_back(cmd);
+    }
+    std::stable_sort(reference.begin(), reference.end(),
+        [](const goud_sprite_cmd &a, const goud_sprite_cmd &b) {
+            if (a.z_layer != b.z_layer) {
+                return a.z_layer < b.z_layer;
+            }
+            return a.texture < b.texture;
+        });
+
+    REQUIRE(batch.sort() == SUCCESS);
+    REQUIRE(batch.size() == reference.size());
+    std::vector<float> sorted_x, expected_x;
+    for (std::size_t i = 0; i < reference.size(); ++i) {
+        sorted_x.push_back(batch.data()[i].x);
+        expected_x.push_back(reference[i].x);
+    }
+    REQUIRE(sorted_x == expected_x);
+}
+
+TEST_CASE("SpriteBatch Submission mode ignores setLayer", "[sprite_batch]") {
+    goud::SpriteBatch batch;
+    batch.setLayer(9);
+    batch.add(1, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, kWhite);
+    REQUIRE(batch.data()[0].z_layer == 0);
+}
+
+TEST_CASE("SpriteBatch::append matches add", "[sprite_batch]") {
+    goud_sprite_cmd cmds[3] = {};
+    cmds[0].texture = 1;
+    cmds[1].texture = 2;
+    cmds[2].texture = 2;
+    cmds[2].z_layer = 5;
+    cmds[2]._padding = 7;
+
+    goud::SpriteBatch submission;
+    REQUIRE(submission.append(cmds, 3) == SUCCESS);
+    REQUIRE(submission.data()[1].z_layer == 1);
+    REQUIRE(submission.data()[2].z_layer == 1);
+
+    goud::SpriteBatch layered;
+    layered.setSortMode(goud::SpriteSortMode::LayerTexture);
+    REQUIRE(layered.append(cmds, 3) == SUCCESS);
+    REQUIRE(layered.size() == 3);
+    REQUIRE(layered.data()[2].z_layer == 5);
+    REQUIRE(layered.data()[2]._padding == 0);
+
+    REQUIRE(layered.append(nullptr, 0) == SUCCESS);
+    REQUIRE(layered.append(nullptr, 1) == ERR_INVALID_STATE);
+    REQUIRE(layered.size() == 3);
+}
@@ -0,0 +1,112 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/job_system.hpp>
+#include <goud/sprite_recorder.hpp>
+
+#include <vector>
+
+namespace {
+
+constexpr goud_color kWhite{ 1.0f, 1.0f, 1.0f, 1.0f };
+
+}  // namespace
+
+TEST_CASE("ParallelSpriteBatch recorders use caller layers", "[sprite_recorder]") {
+    goud::ParallelSpriteBatch sprites(3);
+    REQUIRE(sprites.recorderCount() == 3);
+
+    goud::SpriteBatch &recorder = sprites.recorder(1);
+    REQUIRE(recorder.sortMode() == goud::SpriteSortMode::LayerTexture);
+    recorder.setLayer(4);
+    REQUIRE(recorder.add(1, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, kWhite) == SUCCESS);
+    REQUIRE(recorder.data()[0].z_layer == 4);
+}
+
+TEST_CASE("ParallelSpriteBatch::swap hands the recorded frame to submit", "[sprite_recorder]") {
+    goud::ParallelSpriteBatch sprites(2);
+    sprites.recorder(0).add(1, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, kWhite);
+    sprites.recorder(1).add(1, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, kWhite);
+    REQUIRE(sprites.pending() == 0);
+
+    sprites.swap();
+    REQUIRE(sprites.pending() == 2);
+    REQUIRE(sprites.recorder(0).empty());
+
+    // Recording the next frame does not disturb the waiting one.
+    sprites.recorder(0).add(2, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, kWhite);
+    REQUIRE(sprites.pending() == 2);
+
+    REQUIRE(sprites.merge() == SUCCESS);
+    REQUIRE(sprites.pending() == 0);
+    REQUIRE(sprites.merged().size() == 2);
+    sprites.merged().clear();
+
+    // An unsubmitted frame is dropped by the next swap.
+    sprites.swap();
+    REQUIRE(sprites.pending() == 1);
+    sprites.swap();
+    REQUIRE(sprites.pending() == 0);
+}
+
+TEST_CASE("ParallelSpriteBatch merge order does not depend on scheduling", "[sprite_recorder]") {
+    constexpr std::size_t kLanes = 8;
+    constexpr std::size_t kPerLane = 100;
+    goud::JobSystem jobs(3);
+    goud::ParallelSpriteBatch sprites(kLanes);
+
+    jobs.parallelFor(0, kLanes, 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t lane = begin; lane < end; ++lane) {
+            goud::SpriteBatch &recorder = sprites.recorder(lane);
+            for (std::size_t i = 0; i < kPerLane; ++i) {
+                recorder.setLayer(static_cast<std::int32_t>(i % 3));
+                recorder.add(static_cast<goud_texture>(1 + i % 2),
+                             static_cast<float>(lane * kPerLane + i),
+                             0.0f, 1.0f, 1.0f, 0.0f, kWhite);
+            }
+        }
+    });
+    sprites.swap();
+    REQUIRE(sprites.merge() == SUCCESS);
+    REQUIRE(sprites.merged().sort() == SUCCESS);
+
+    // Sorted by (layer, texture); ties keep recorder order, then record order.
+    const goud::SpriteBatch &merged = sprites.merged();
+    REQUIRE(merged.size() == kLanes * kPerLane);
+    std::vector<float> expected;
+    for (std::int32_t layer = 0; layer < 3; ++layer) {
+        for (goud_texture texture = 1; texture <= 2; ++texture) {
+            for (std::size_t lane = 0; lane < kLanes; ++lane) {
+                for (std::size_t i = 0; i < kPerLane; ++i) {
+                    if (static_cast<std::int32_t>(i % 3) == layer && 1 + i % 2 == texture) {
+                        expected.push_back(static_cast<float>(lane * kPerLane + i));
+                    }
+                }
+            }
+        }
+    }
+    std::vector<float> actual;
+    for (std::size_t i = 0; i < merged.size(); ++i) {
+        actual.push_back(merged.data()[i].x);
+    }
+    REQUIRE(actual == expected);
+}
+
+TEST_CASE("ParallelSpriteBatch::submit empties the waiting frame", "[sprite_recorder]") {
+    goud::ParallelSpriteBatch sprites(2);
+    goud::Context context;
+    REQUIRE(sprites.submit(context) == SUCCESS);
+
+    sprites.recorder(0).add(1, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, kWhite);
+    sprites.swap();
+    REQUIRE(sprites.submit(context) != SUCCESS);
+    REQUIRE(sprites.pending() == 0);
+    REQUIRE(sprites.merged().empty());
+}
+
+TEST_CASE("ParallelSpriteBatch::setRecorderCount discards recorded frames", "[sprite_recorder]") {
+    goud::ParallelSpriteBatch sprites(1);
+    sprites.recorder(0).add(1, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, kWhite);
+    sprites.swap();
+    REQUIRE(sprites.setRecorderCount(4) == SUCCESS);
+    REQUIRE(sprites.recorderCount() == 4);
+    REQUIRE(sprites.pending() == 0);
+}
@@ -0,0 +1,65 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/goud.hpp>
+
+#include <utility>
+
+namespace {
+
+goud_sprite_cmd tile(goud_texture texture, float x) {
+    goud_sprite_cmd cmd{};
+    cmd.texture = texture;
+    cmd.x = x;
+    cmd.width = 16.0f;
+    cmd.height = 16.0f;
+    cmd.r = cmd.g = cmd.b = cmd.a = 1.0f;
+    return cmd;
+}
+
+}  // namespace
+
+TEST_CASE("StaticLayer default is empty and rejects use", "[static_layer]") {
+    goud::StaticLayer layer;
+    goud_sprite_cmd cmd = tile(1, 0.0f);
+    std::uint32_t drawn = 99;
+
+    REQUIRE_FALSE(layer.valid());
+    REQUIRE(layer.size() == 0);
+    REQUIRE(layer.raw() == GOUD_INVALID_STATIC_LAYER);
+    REQUIRE(layer.draw(0.0f, 0.0f, &drawn) == ERR_INVALID_HANDLE);
+    REQUIRE(drawn == 0);
+    REQUIRE(layer.update(0, cmd) == ERR_INVALID_HANDLE);
+    layer.reset();
+    REQUIRE_FALSE(layer.valid());
+}
+
+TEST_CASE("StaticLayer create rejects empty input", "[static_layer]") {
+    goud::StaticLayer layer;
+    goud::SpriteBatch batch;
+
+    REQUIRE(layer.create(goud_context_invalid(), nullptr, 4) == ERR_INVALID_STATE);
+    REQUIRE(layer.create(goud_context_invalid(), batch) == ERR_INVALID_STATE);
+    REQUIRE_FALSE(layer.valid());
+}
+
+TEST_CASE("StaticLayer C wrappers check arguments before the FFI call", "[static_layer]") {
+    goud_sprite_cmd cmd = tile(1, 0.0f);
+    goud_static_layer layer = 7;
+
+    REQUIRE(goud_static_layer_init(goud_context_invalid(), &cmd, 1, nullptr) == ERR_INVALID_STATE);
+    REQUIRE(goud_static_layer_init(goud_context_invalid(), &cmd, 0, &layer) == ERR_INVALID_STATE);
+    REQUIRE(layer == 7);
+    REQUIRE(goud_static_layer_write(goud_context_invalid(), layer, 0, nullptr, 0) == SUCCESS);
+    REQUIRE(goud_static_layer_write(goud_context_invalid(), layer, 0, nullptr, 1) == ERR_INVALID_STATE);
+}
+
+TEST_CASE("StaticLayer moves leave the source empty", "[static_layer]") {
+    goud::StaticLayer first;
+    goud::StaticLayer second(std::move(first));
+    REQUIRE_FALSE(first.valid());
+    REQUIRE_FALSE(second.valid());
+
+    goud::StaticLayer third;
+    third = std::move(second);
+    REQUIRE_FALSE(second.valid());
+    REQUIRE(third.size() == 0);
+}
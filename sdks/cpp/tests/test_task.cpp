@@ -0,0 +1,139 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/task.hpp>
+
+// Coroutine tasks need C++20; configure with -DCMAKE_CXX_STANDARD=20 to run these.
+#if GOUD_HAS_COROUTINES
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace {
+
+goud::Task countFrames(int &frames, int total) {
+    for (int i = 0; i < total; ++i) {
+        co_await goud::nextFrame();
+        ++frames;
+    }
+}
+
+goud::Task wake(std::vector<int> &order, int id, float delay) {
+    co_await goud::seconds(delay);
+    order.push_back(id);
+}
+
+goud::Task waitTween(const goud::TweenSet &tweens, goud::TweenId id, bool &done) {
+    co_await goud::tweenDone(tweens, id);
+    done = true;
+}
+
+goud::Task waitAsset(goud::AssetFuture<goud_texture> future, goud_texture &out) {
+    out = co_await goud::assetLoaded(std::move(future));
+}
+
+struct Flag {
+    bool *destroyed;
+    ~Flag() { *destroyed = true; }
+};
+
+goud::Task waitForever(bool &destroyed) {
+    Flag flag{ &destroyed };
+    for (;;) {
+        co_await goud::nextFrame();
+    }
+}
+
+}  // namespace
+
+TEST_CASE("Task bodies start on spawn and resume once per tick", "[task]") {
+    goud::TaskScheduler tasks;
+    int frames = 0;
+
+    goud::Task task = countFrames(frames, 3);
+    REQUIRE(task.valid());
+    REQUIRE(tasks.spawn(std::move(task)));
+    REQUIRE_FALSE(task.valid());
+    REQUIRE_FALSE(tasks.spawn(goud::Task{}));
+    REQUIRE(tasks.live() == 1);
+
+    for (int tick = 1; tick <= 3; ++tick) {
+        tasks.tick(1.0f / 60.0f);
+        REQUIRE(frames == tick);
+    }
+    REQUIRE(tasks.live() == 0);
+    REQUIRE(tasks.frame() == 3);
+}
+
+TEST_CASE("seconds() wakes tasks in deadline order", "[task]") {
+    goud::TaskScheduler tasks;
+    std::vector<int> order;
+
+    tasks.spawn(wake(order, 1, 0.5f));
+    tasks.spawn(wake(order, 2, 0.25f));
+    tasks.spawn(wake(order, 3, 0.0f));
+    REQUIRE(order.empty());
+
+    tasks.tick(0.1f);
+    REQUIRE(order == std::vector<int>{ 3 });
+    tasks.tick(0.2f);
+    REQUIRE(order == std::vector<int>{ 3, 2 });
+    tasks.tick(0.1f);
+    REQUIRE(order.size() == 2);
+    tasks.tick(0.1f);
+    REQUIRE(order == std::vector<int>{ 3, 2, 1 });
+    REQUIRE(tasks.live() == 0);
+}
+
+TEST_CASE("tweenDone() and assetLoaded() resume when their source is done", "[task]") {
+    goud::TaskScheduler tasks;
+    goud::TweenSet tweens;
+    goud::TweenId id = tweens.add(0.0f, 1.0f, 10.0f);
+    bool tween_done = false;
+    tasks.spawn(waitTween(tweens, id, tween_done));
+
+    auto request = std::make_shared<goud::detail::AssetRequest>();
+    goud_texture texture = 0;
+    tasks.spawn(waitAsset(goud::AssetFuture<goud_texture>(request), texture));
+
+    tasks.tick(0.0f);
+    REQUIRE_FALSE(tween_done);
+    REQUIRE(texture == 0);
+
+    REQUIRE(tweens.remove(id));
+    request->handle.store(42);
+    request->done.store(true);
+    tasks.tick(0.0f);
+    REQUIRE(tween_done);
+    REQUIRE(texture == 42);
+    REQUIRE(tasks.live() == 0);
+
+    goud_texture empty = 0;
+    tasks.spawn(waitAsset(goud::AssetFuture<goud_texture>(), empty));
+    REQUIRE(empty == static_cast<goud_texture>(UINT64_MAX));
+}
+
+TEST_CASE("TaskScheduler destroys suspended tasks and pools their frames", "[task]") {
+    bool destroyed = false;
+    {
+        goud::TaskScheduler tasks;
+        tasks.spawn(waitForever(destroyed));
+        tasks.tick(0.0f);
+        REQUIRE(tasks.live() == 1);
+        REQUIRE_FALSE(destroyed);
+    }
+    REQUIRE(destroyed);
+
+    // The next frame of the same size reuses the block just returned.
+    std::size_t cached = goud::detail::TaskFramePool::cached();
+    REQUIRE(cached > 0);
+    goud::TaskScheduler tasks;
+    destroyed = false;
+    tasks.spawn(waitForever(destroyed));
+    REQUIRE(goud::detail::TaskFramePool::cached() == cached - 1);
+    tasks.clear();
+    REQUIRE(destroyed);
+    REQUIRE(tasks.live() == 0);
+    REQUIRE(goud::detail::TaskFramePool::cached() == cached);
+}
+
+#endif  // GOUD_HAS_COROUTINES
@@ -0,0 +1,148 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/goud.hpp>
+
+#include <cstring>
+#include <string>
+
+namespace {
+
+goud::TextStyle hudStyle() {
+    goud::TextStyle style;
+    style.font = 3;
+    style.size = 24.0f;
+    style.color = goud_color{ 1.0f, 0.5f, 0.25f, 1.0f };
+    style.alignment = 1;
+    style.max_width = 200.0f;
+    style.line_spacing = 1.25f;
+    return style;
+}
+
+}  // namespace
+
+TEST_CASE("TextBatch records style and position", "[text_batch]") {
+    goud::TextBatch batch;
+    REQUIRE(batch.empty());
+
+    REQUIRE(batch.add(hudStyle(), 10.0f, 20.0f, "Score") == SUCCESS);
+    REQUIRE(batch.size() == 1);
+
+    const goud_text_cmd *cmds = batch.data();
+    REQUIRE(cmds[0].font_handle == 3);
+    REQUIRE(std::strcmp(cmds[0].text, "Score") == 0);
+    REQUIRE(cmds[0].x == 10.0f);
+    REQUIRE(cmds[0].y == 20.0f);
+    REQUIRE(cmds[0].font_size == 24.0f);
+    REQUIRE(cmds[0].alignment == 1);
+    REQUIRE(cmds[0].direction == 0);
+    REQUIRE(cmds[0].max_width == 200.0f);
+    REQUIRE(cmds[0].line_spacing == 1.25f);
+    REQUIRE(cmds[0].g == 0.5f);
+    REQUIRE(cmds[0].a == 1.0f);
+}
+
+TEST_CASE("TextBatch copies text that need not outlive the call", "[text_batch]") {
+    goud::TextBatch batch;
+    for (int i = 0; i < 400; ++i) {
+        std::string label = "label " + std::to_string(i);
+        REQUIRE(batch.add(hudStyle(), 0.0f, static_cast<float>(i), label) == SUCCESS);
+    }
+
+    const goud_text_cmd *cmds = batch.data();
+    REQUIRE(std::strcmp(cmds[0].text, "label 0") == 0);
+    REQUIRE(std::strcmp(cmds[399].text, "label 399") == 0);
+
+    // A view into a longer string is copied without the tail.
+    std::string_view word = std::string_view("Level Up").substr(0, 5);
+    REQUIRE(batch.add(hudStyle(), 0.0f, 0.0f, word) == SUCCESS);
+    REQUIRE(std::strcmp(batch.data()[400].text, "Level") == 0);
+}
+
+TEST_CASE("TextBatch borrows caller text without copying", "[text_batch]") {
+    static const char kTitle[] = "Flappy Goud";
+    goud::TextBatch batch;
+    REQUIRE(batch.add(hudStyle(), 0.0f, 0.0f, "copied") == SUCCESS);
+    REQUIRE(batch.addBorrowed(hudStyle(), 0.0f, 0.0f, kTitle) == SUCCESS);
+    REQUIRE(batch.textBytes() == sizeof("copied"));
+    REQUIRE(batch.data()[1].text == kTitle);
+    REQUIRE(std::strcmp(batch.data()[0].text, "copied") == 0);
+}
+
+TEST_CASE("TextBatch formats labels in place", "[text_batch]") {
+    goud::TextBatch batch;
+    REQUIRE(batch.addFormat(hudStyle(), 0.0f, 0.0f, "%d", 42) == SUCCESS);
+
+    // Longer than the first formatting attempt.
+    std::string longer(100, 'x');
+    REQUIRE(batch.addFormat(hudStyle(), 0.0f, 0.0f, "hp %s %d", longer.c_str(), 7) == SUCCESS);
+    REQUIRE(batch.size() == 2);
+    REQUIRE(std::strcmp(batch.data()[0].text, "42") == 0);
+    REQUIRE(std::string(batch.data()[1].text) == "hp " + longer + " 7");
+    REQUIRE(batch.textBytes() == 3 + longer.size() + 6);
+
+    REQUIRE(batch.addFormat(hudStyle(), 0.0f, 0.0f, "%s", "") == SUCCESS);
+    REQUIRE(batch.size() == 2);
+    REQUIRE(batch.addFormat(hudStyle(), 0.0f, 0.0f, nullptr) == ERR_INVALID_STATE);
+}
+
+TEST_CASE("TextBatch skips empty labels", "[text_batch]") {
+    goud::TextBatch batch;
+    REQUIRE(batch.add(hudStyle(), 0.0f, 0.0f, "") == SUCCESS);
+    REQUIRE(batch.addBorrowed(hudStyle(), 0.0f, 0.0f, nullptr) == SUCCESS);
+    REQUIRE(batch.addBorrowed(hudStyle(), 0.0f, 0.0f, "") == SUCCESS);
+    REQUIRE(batch.empty());
+    REQUIRE(batch.textBytes() == 0);
+}
+
+TEST_CASE("TextBatch clear keeps capacity", "[text_batch]") {
+    goud::TextBatch batch(64, 1024);
+    REQUIRE(batch.capacity() >= 64);
+    REQUIRE(batch.textCapacity() >= 1024);
+
+    batch.add(hudStyle(), 0.0f, 0.0f, "frame");
+    batch.clear();
+    REQUIRE(batch.empty());
+    REQUIRE(batch.textBytes() == 0);
+    REQUIRE(batch.capacity() >= 64);
+    REQUIRE(batch.textCapacity() >= 1024);
+}
+
+TEST_CASE("TextBatch flush of an empty batch succeeds", "[text_batch]") {
+    goud::TextBatch batch;
+    std::uint32_t drawn = 99;
+    REQUIRE(batch.flush(goud_context_invalid(), &drawn) == SUCCESS);
+    REQUIRE(drawn == 0);
+}
+
+TEST_CASE("TextBatch flush empties the batch even on error", "[text_batch]") {
+    goud::TextBatch batch;
+    batch.add(hudStyle(), 0.0f, 0.0f, "lost");
+    REQUIRE(batch.flush(goud_context_invalid()) != SUCCESS);
+    REQUIRE(batch.empty());
+    REQUIRE(batch.textBytes() == 0);
+}
+
+TEST_CASE("goud_renderer_draw_text_cmds rejects NULL commands", "[text_batch]") {
+    std::uint32_t drawn = 99;
+    REQUIRE(goud_renderer_draw_text_cmds(goud_context_invalid(), nullptr, 0, &drawn) == SUCCESS);
+    REQUIRE(drawn == 0);
+    REQUIRE(goud_renderer_draw_text_cmds(goud_context_invalid(), nullptr, 1, &drawn) == ERR_INVALID_STATE);
+}
+
+TEST_CASE("Context::drawText records into the text batch", "[text_batch]") {
+    goud::Context ctx;
+    REQUIRE(ctx.drawText(hudStyle(), 5.0f, 6.0f, "HUD") == SUCCESS);
+    REQUIRE(ctx.textBatch().size() == 1);
+    REQUIRE(std::strcmp(ctx.textBatch().data()[0].text, "HUD") == 0);
+
+    (void)ctx.flushText();
+    REQUIRE(ctx.textBatch().empty());
+}
+
+TEST_CASE("Text layout cache calls fail without a context", "[text_batch]") {
+    goud::Context ctx;
+    goud_text_cache_stats stats{};
+    REQUIRE(ctx.setTextCacheBudget(64 * 1024) != SUCCESS);
+    REQUIRE(ctx.textCacheStats(stats) != SUCCESS);
+    REQUIRE(ctx.clearTextCache() != SUCCESS);
+    REQUIRE(goud_renderer_text_cache_stats(goud_context_invalid(), nullptr) == ERR_INVALID_STATE);
+}
@@ -0,0 +1,36 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/asset_pack.hpp>
+#include <goud/goud.hpp>
+
+#include <cstdint>
+
+TEST_CASE("Texture streaming C wrappers reject NULL arguments", "[texture_streaming]") {
+    goud_context context = goud_context_invalid();
+    goud_texture texture = GOUD_INVALID_TEXTURE;
+    const unsigned char png[] = { 0x89, 'P', 'N', 'G' };
+
+    REQUIRE(goud_texture_stream_path(context, "sprites/hero.png", NULL) == ERR_INVALID_STATE);
+    REQUIRE(goud_texture_stream_bytes(context, NULL, sizeof png, &texture) == ERR_INVALID_STATE);
+    REQUIRE(goud_texture_stream_bytes(context, png, sizeof png, NULL) == ERR_INVALID_STATE);
+    REQUIRE(goud_texture_stream_pack(context, GOUD_INVALID_ASSET_PACK, 1, NULL) == ERR_INVALID_STATE);
+    REQUIRE(goud_texture_streaming_stats(context, NULL) == ERR_INVALID_STATE);
+}
+
+TEST_CASE("Texture streaming budget and stats fail without a context", "[texture_streaming]") {
+    goud::Context ctx;
+    goud_texture_stream_stats stats{};
+
+    REQUIRE(ctx.setTextureStreamingBudget(64ULL * 1024 * 1024) != SUCCESS);
+    REQUIRE(ctx.textureStreamingStats(stats) != SUCCESS);
+}
+
+TEST_CASE("Streamed texture loads fail without a context", "[texture_streaming][gl_required]") {
+    goud::Context ctx;
+    goud::AssetPack pack;
+    goud_texture texture = GOUD_INVALID_TEXTURE;
+    const unsigned char png[] = { 0x89, 'P', 'N', 'G' };
+
+    REQUIRE(ctx.streamTexture("sprites/hero.png", texture) != SUCCESS);
+    REQUIRE(ctx.streamTexture(png, sizeof png, texture) != SUCCESS);
+    REQUIRE(pack.streamTexture(ctx, goud::AssetPack::hash("sprites/hero.png"), texture) != SUCCESS);
+}
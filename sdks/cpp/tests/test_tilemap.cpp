@@ -0,0 +1,41 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/goud.hpp>
+
+#include <cstdint>
+#include <utility>
+
+TEST_CASE("Tilemap default is empty and rejects use", "[tilemap]") {
+    goud::Tilemap map;
+    std::uint32_t drawn = 99;
+    std::uint32_t tile = 1;
+
+    REQUIRE_FALSE(map.valid());
+    REQUIRE(map.raw() == GOUD_INVALID_TILEMAP);
+    REQUIRE(map.columns() == 0);
+    REQUIRE(map.draw(0.0f, 0.0f, &drawn) == ERR_INVALID_HANDLE);
+    REQUIRE(drawn == 0);
+    REQUIRE(map.setTiles(0, 0, 1, 1, &tile) == ERR_INVALID_HANDLE);
+    REQUIRE(map.setTile(0, 0, 1) == ERR_INVALID_HANDLE);
+    map.reset();
+    REQUIRE_FALSE(map.valid());
+}
+
+TEST_CASE("Tilemap C wrappers check arguments before the FFI call", "[tilemap]") {
+    goud_tilemap map = 7;
+
+    REQUIRE(goud_tilemap_init(goud_context_invalid(), 0, 8, 8, 16, 16, 0, nullptr) == ERR_INVALID_STATE);
+    REQUIRE(goud_tilemap_write(goud_context_invalid(), map, 0, 0, 0, 4, nullptr) == SUCCESS);
+    REQUIRE(goud_tilemap_write(goud_context_invalid(), map, 0, 0, 2, 2, nullptr) == ERR_INVALID_STATE);
+}
+
+TEST_CASE("Tilemap moves leave the source empty", "[tilemap]") {
+    goud::Tilemap first;
+    goud::Tilemap second(std::move(first));
+    REQUIRE_FALSE(first.valid());
+    REQUIRE_FALSE(second.valid());
+
+    goud::Tilemap third;
+    third = std::move(second);
+    REQUIRE_FALSE(second.valid());
+    REQUIRE(third.rows() == 0);
+}
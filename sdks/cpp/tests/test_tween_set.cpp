@@ -0,0 +1,99 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/tween_set.hpp>
+
+#include <cstdint>
+#include <vector>
+
+TEST_CASE("TweenSet adds tweens with their start values", "[tween_set]") {
+    goud::TweenSet tweens;
+    REQUIRE(tweens.empty());
+    REQUIRE(tweens.reserve(64) == SUCCESS);
+
+    goud::TweenId fade = tweens.add(0.0f, 1.0f, 0.5f, goud::TweenEasing::EaseOut);
+    goud::TweenId snap = tweens.add(2.0f, 8.0f, -1.0f);
+    REQUIRE(fade != goud::kInvalidTween);
+    REQUIRE(snap != fade);
+    REQUIRE(tweens.size() == 2);
+    REQUIRE(tweens.value(fade) == 0.0f);
+    REQUIRE_FALSE(tweens.finished(fade));
+    REQUIRE(tweens.value(snap) == 8.0f);
+    REQUIRE(tweens.finished(snap));
+    REQUIRE(tweens.ids()[0] == fade);
+    REQUIRE(tweens.values()[1] == 8.0f);
+
+    REQUIRE(tweens.add(0.0f, 1.0f, 1.0f, static_cast<goud::TweenEasing>(6)) == goud::kInvalidTween);
+    REQUIRE(tweens.size() == 2);
+}
+
+TEST_CASE("TweenSet IDs go stale when their tween is removed", "[tween_set]") {
+    goud::TweenSet tweens;
+    goud::TweenId a = tweens.add(0.0f, 1.0f, 1.0f);
+    goud::TweenId b = tweens.add(5.0f, 6.0f, 1.0f);
+    goud::TweenId c = tweens.add(7.0f, 9.0f, 1.0f);
+
+    REQUIRE(tweens.remove(a));
+    REQUIRE_FALSE(tweens.remove(a));
+    REQUIRE_FALSE(tweens.contains(a));
+    REQUIRE(tweens.value(a, -1.0f) == -1.0f);
+    REQUIRE(tweens.value(b) == 5.0f);
+    REQUIRE(tweens.value(c) == 7.0f);
+    REQUIRE(tweens.restart(a) == ERR_INVALID_STATE);
+
+    goud::TweenId reused = tweens.add(3.0f, 4.0f, 1.0f);
+    REQUIRE(reused != a);
+    REQUIRE((reused & 0xFFFFFFFFu) == (a & 0xFFFFFFFFu));
+    REQUIRE_FALSE(tweens.contains(a));
+    REQUIRE(tweens.value(reused) == 3.0f);
+    REQUIRE_FALSE(tweens.contains(goud::kInvalidTween));
+}
+
+TEST_CASE("TweenSet removes finished tweens in one pass", "[tween_set]") {
+    goud::TweenSet tweens;
+    std::vector<goud::TweenId> running;
+    std::vector<goud::TweenId> done;
+    for (int i = 0; i < 100; ++i) {
+        float start = static_cast<float>(i);
+        if (i % 3 == 0) {
+            done.push_back(tweens.add(start, -start, 0.0f));
+        } else {
+            running.push_back(tweens.add(start, start + 1.0f, 1.0f));
+        }
+    }
+
+    REQUIRE(tweens.removeFinished() == done.size());
+    REQUIRE(tweens.size() == running.size());
+    REQUIRE(tweens.removeFinished() == 0);
+    for (goud::TweenId id : done) {
+        REQUIRE_FALSE(tweens.contains(id));
+    }
+    for (std::size_t i = 0; i < running.size(); ++i) {
+        REQUIRE(tweens.ids()[i] == running[i]);
+        REQUIRE(tweens.value(running[i]) == tweens.values()[i]);
+    }
+
+    tweens.clear();
+    REQUIRE(tweens.empty());
+    REQUIRE_FALSE(tweens.contains(running[0]));
+    REQUIRE(tweens.step(0.1f) == SUCCESS);
+}
+
+TEST_CASE("TweenSet steps every tween in one call", "[tween_set][gl_required]") {
+    goud::TweenSet tweens;
+    goud::TweenId linear = tweens.add(0.0f, 10.0f, 1.0f);
+    goud::TweenId ease_in = tweens.add(0.0f, 4.0f, 1.0f, goud::TweenEasing::EaseIn);
+    goud::TweenId quick = tweens.add(1.0f, 2.0f, 0.25f, goud::TweenEasing::EaseOutBounce);
+
+    std::uint32_t finished = 7;
+    REQUIRE(tweens.step(0.5f, &finished) == SUCCESS);
+    REQUIRE(finished == 1);
+    REQUIRE(tweens.value(linear) == 5.0f);
+    REQUIRE(tweens.value(ease_in) == 1.0f);
+    REQUIRE(tweens.value(quick) == 2.0f);
+    REQUIRE(tweens.finished(quick));
+
+    REQUIRE(tweens.removeFinished() == 1);
+    REQUIRE(tweens.restart(linear) == SUCCESS);
+    REQUIRE(tweens.step(0.25f) == SUCCESS);
+    REQUIRE(tweens.value(linear) == 2.5f);
+    REQUIRE(tweens.value(ease_in) == 4.0f * 0.75f * 0.75f);
+}
@@ -0,0 +1,147 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/ui_tree.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+TEST_CASE("UiBatch records commands with references to created nodes", "[ui_tree]") {
+    goud::UiBatch batch;
+    REQUIRE(batch.empty());
+
+    goud::UiNodeId panel = batch.createNode(goud::UiWidget::Panel);
+    goud::UiNodeId label = batch.createNode(goud::UiWidget::Label);
+    REQUIRE(panel != label);
+    REQUIRE(batch.setParent(label, panel) == SUCCESS);
+    REQUIRE(batch.setSize(label, 64.0f, 16.0f) == SUCCESS);
+    REQUIRE(batch.setVisible(panel, false) == SUCCESS);
+    REQUIRE(batch.size() == 5);
+    REQUIRE(batch.status() == SUCCESS);
+
+    const FfiUiCommand *commands = batch.data();
+    REQUIRE(commands[0].kind == UI_COMMAND_CREATE_NODE);
+    REQUIRE(commands[0].widget_kind == 0);
+    REQUIRE(commands[1].widget_kind == 2);
+    REQUIRE(commands[2].kind == UI_COMMAND_SET_PARENT);
+    REQUIRE(commands[2].node_id == label);
+    REQUIRE(commands[2].parent_id == panel);
+    REQUIRE(commands[3].x == 64.0f);
+    REQUIRE(commands[3].y == 16.0f);
+    REQUIRE_FALSE(commands[4].flag);
+
+    // References resolve only once a batch has been applied.
+    REQUIRE(batch.resolve(label) == goud::kInvalidUiNode);
+    REQUIRE(batch.resolve(42) == 42);
+
+    batch.clear();
+    REQUIRE(batch.empty());
+    REQUIRE(batch.createNode(goud::UiWidget::None) == panel);
+}
+
+TEST_CASE("UiBatch copies text and keeps style payloads", "[ui_tree]") {
+    goud::UiBatch batch;
+    std::string text = "Gold: 12";
+    REQUIRE(batch.setLabelText(7, text) == SUCCESS);
+    REQUIRE(batch.setImageTexturePath(8, "") == SUCCESS);
+    text.assign("changed!");
+    for (int i = 0; i < 64; ++i) {
+        REQUIRE(batch.setLabelText(9, "x") == SUCCESS);
+    }
+
+    goud::UiStyle style{};
+    style.has_font_size = true;
+    style.font_size = 18.0f;
+    REQUIRE(batch.setStyle(7, style) == SUCCESS);
+    REQUIRE(batch.textBytes() == 8 + 64);
+
+    const FfiUiCommand *commands = batch.data();
+    REQUIRE(commands[0].text_len == 8);
+    REQUIRE(std::memcmp(commands[0].text_ptr, "Gold: 12", 8) == 0);
+    REQUIRE(commands[1].kind == UI_COMMAND_SET_IMAGE_TEXTURE_PATH);
+    REQUIRE(commands[1].text_ptr == nullptr);
+    REQUIRE(commands[1].text_len == 0);
+    REQUIRE(commands[66].kind == UI_COMMAND_SET_STYLE);
+    REQUIRE(commands[66].style != nullptr);
+    REQUIRE(commands[66].style->has_font_size);
+    REQUIRE(commands[66].style->font_size == 18.0f);
+}
+
+TEST_CASE("An invalid UiTree rejects batches", "[ui_tree]") {
+    goud::UiTree owner;
+    goud::UiTree moved_to = std::move(owner);
+    goud::UiTree &tree = owner;
+    REQUIRE_FALSE(tree.valid());
+    REQUIRE(tree.nodeCount() == 0);
+    REQUIRE(tree.createNode(goud::UiWidget::Panel) == goud::kInvalidUiNode);
+    REQUIRE(tree.removeNode(1) == ERR_INVALID_STATE);
+    REQUIRE(tree.parent(1) == goud::kInvalidUiNode);
+    tree.update();
+
+    bool built = false;
+    std::size_t applied = 9;
+    int status = tree.batch(
+        [&](goud::UiBatch &batch) {
+            built = true;
+            batch.createNode(goud::UiWidget::Label);
+        },
+        &applied);
+    REQUIRE(built);
+    REQUIRE(status == ERR_INVALID_STATE);
+    REQUIRE(applied == 0);
+    REQUIRE(tree.lastBatch().size() == 1);
+
+    moved_to = std::move(tree);
+    REQUIRE_FALSE(moved_to.valid());
+    REQUIRE(moved_to.lastBatch().size() == 1);
+}
+
+TEST_CASE("UiTree batches build and update an inventory screen", "[ui_tree][gl_required]") {
+    goud::UiTree tree;
+    REQUIRE(tree.valid());
+
+    constexpr std::size_t kSlots = 500;
+    std::vector<goud::UiNodeId> labels;
+    REQUIRE(tree.batch([&](goud::UiBatch &batch) {
+        goud::UiNodeId root = batch.createNode(goud::UiWidget::Panel);
+        for (std::size_t i = 0; i < kSlots; ++i) {
+            goud::UiNodeId slot = batch.createNode(goud::UiWidget::Panel);
+            goud::UiNodeId icon = batch.createNode(goud::UiWidget::Image);
+            goud::UiNodeId label = batch.createNode(goud::UiWidget::Label);
+            batch.setParent(slot, root);
+            batch.setParent(icon, slot);
+            batch.setParent(label, slot);
+            batch.setSize(slot, 48.0f, 48.0f);
+            batch.setImageTexturePath(icon, "ui/slot.png");
+            batch.setLabelText(label, std::to_string(i));
+            labels.push_back(label);
+        }
+    }) == SUCCESS);
+    REQUIRE(tree.nodeCount() == 1 + kSlots * 3);
+    for (goud::UiNodeId &label : labels) {
+        label = tree.lastBatch().resolve(label);
+        REQUIRE(label != goud::kInvalidUiNode);
+    }
+    tree.update();
+
+    std::size_t applied = 0;
+    REQUIRE(tree.batch(
+                [&](goud::UiBatch &batch) {
+                    for (std::size_t i = 0; i < 8; ++i) {
+                        batch.setLabelText(labels[i * 50], "99");
+                    }
+                },
+                &applied) == SUCCESS);
+    REQUIRE(applied == 8);
+    tree.update();
+
+    REQUIRE(tree.batch([&](goud::UiBatch &batch) {
+        batch.setLabelText(labels[0], "1");
+        batch.removeNode(labels[1]);
+        batch.removeNode(labels[1]);
+        batch.setLabelText(labels[2], "never applied");
+    }, &applied) == ERR_INVALID_STATE);
+    REQUIRE(applied == 2);
+    REQUIRE(tree.nodeCount() == kSlots * 3);
+}
@@ -0,0 +1,68 @@
+#include <catch2/catch_test_macros.hpp>
+#include <goud/world_group.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+TEST_CASE("WorldGroup pins each world to one worker", "[world_group]") {
+    goud::WorldGroup group(3);
+    REQUIRE(group.threadCount() == 3);
+
+    std::vector<std::thread::id> owners(6);
+    std::vector<int> ticks(6, 0);
+    REQUIRE(group.create(6, [&](std::size_t world, goud::Context &context) {
+        owners[world] = std::this_thread::get_id();
+        return context.valid() ? SUCCESS : ERR_INVALID_CONTEXT;
+    }) == SUCCESS);
+    REQUIRE(group.size() == 6);
+
+    // Catch2 assertions are not thread-safe, so workers only record.
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    bool pinned = true;
+    for (int frame = 0; frame < 3; ++frame) {
+        REQUIRE(group.tick(1.0f / 60.0f, [&](std::size_t world, goud::Context &, float) {
+            ++ticks[world];
+            std::lock_guard<std::mutex> lock(mutex);
+            pinned = pinned && owners[world] == std::this_thread::get_id();
+            threads.insert(std::this_thread::get_id());
+        }) == SUCCESS);
+    }
+
+    REQUIRE(pinned);
+
+    for (int count : ticks) {
+        REQUIRE(count == 3);
+    }
+    REQUIRE(threads.size() == 3);
+    REQUIRE(threads.count(std::this_thread::get_id()) == 0);
+    REQUIRE(group.lastTickNanos(group.size()) == 0);
+}
+
+TEST_CASE("WorldGroup create fails atomically and only once", "[world_group]") {
+    goud::WorldGroup group(2);
+
+    REQUIRE(group.create(4, [](std::size_t world, goud::Context &) {
+        return world == 2 ? ERR_INVALID_STATE : SUCCESS;
+    }) == ERR_INVALID_STATE);
+    REQUIRE(group.size() == 0);
+
+    REQUIRE(group.create(4) == SUCCESS);
+    REQUIRE(group.size() == 4);
+    REQUIRE(group.create(1) == ERR_INVALID_STATE);
+    REQUIRE(group.tick(0.0f, nullptr) == SUCCESS);
+}
+
+TEST_CASE("WorldGroup with zero threads still runs one worker", "[world_group]") {
+    goud::WorldGroup group(0);
+    REQUIRE(group.threadCount() == 1);
+    REQUIRE(group.tick(0.0f, nullptr) == SUCCESS);
+}
+
+TEST_CASE("Per-context frame arena wrappers check arguments", "[world_group]") {
+    REQUIRE(goud_context_frame_arena_allocate(goud_context_invalid(), 16, 8, nullptr) == ERR_INVALID_STATE);
+    REQUIRE(goud_context_frame_arena_get_stats(goud_context_invalid(), nullptr) == ERR_INVALID_STATE);
+}
@@ -6,5 +6,6 @@ namespace GoudEngine
     {
         Wgpu = 0,
         OpenGlLegacy = 1,
+        Null = 3,
     }
 }
\ No newline at end of file
@@ -6,5 +6,6 @@ namespace GoudEngine
     {
         Winit = 0,
         GlfwLegacy = 1,
+        Headless = 5,
     }
 }
\ No newline at end of file
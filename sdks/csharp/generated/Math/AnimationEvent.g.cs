@@ -0,0 +1,37 @@
+// This file is AUTO-GENERATED by GoudEngine codegen. DO NOT EDIT.
+#nullable enable
+using System;
+
+namespace GoudEngine
+{
+    /// <summary>A fired animation event, copied in bulk by AnimationEventsCopy; string pointers borrow the event buffer</summary>
+    public struct AnimationEvent
+    {
+        public ulong Entity;
+        public IntPtr NamePtr;
+        public IntPtr PayloadStrPtr;
+        public uint NameLen;
+        public uint Frame;
+        public uint PayloadType;
+        public int PayloadInt;
+        public float PayloadFloat;
+        public uint PayloadStrLen;
+
+        public AnimationEvent(ulong entity, IntPtr nameptr, IntPtr payloadstrptr, uint namelen, uint frame, uint payloadtype, int payloadint, float payloadfloat, uint payloadstrlen)
+        {
+            Entity = entity;
+            NamePtr = nameptr;
+            PayloadStrPtr = payloadstrptr;
+            NameLen = namelen;
+            Frame = frame;
+            PayloadType = payloadtype;
+            PayloadInt = payloadint;
+            PayloadFloat = payloadfloat;
+            PayloadStrLen = payloadstrlen;
+        }
+
+
+
+        public override string ToString() => $"AnimationEvent({Entity}, {NamePtr}, {PayloadStrPtr}, {NameLen}, {Frame}, {PayloadType}, {PayloadInt}, {PayloadFloat}, {PayloadStrLen})";
+    }
+}
\ No newline at end of file
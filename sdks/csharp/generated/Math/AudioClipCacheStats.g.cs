@@ -0,0 +1,35 @@
+// This file is AUTO-GENERATED by GoudEngine codegen. DO NOT EDIT.
+#nullable enable
+using System;
+
+namespace GoudEngine
+{
+    /// <summary>Occupancy, hit, and eviction counters for the decoded audio clip cache</summary>
+    public struct AudioClipCacheStats
+    {
+        public ulong Clips;
+        public ulong ResidentClips;
+        public ulong PcmBytes;
+        public ulong EncodedBytes;
+        public ulong BudgetBytes;
+        public ulong Hits;
+        public ulong Misses;
+        public ulong Evictions;
+
+        public AudioClipCacheStats(ulong clips, ulong residentclips, ulong pcmbytes, ulong encodedbytes, ulong budgetbytes, ulong hits, ulong misses, ulong evictions)
+        {
+            Clips = clips;
+            ResidentClips = residentclips;
+            PcmBytes = pcmbytes;
+            EncodedBytes = encodedbytes;
+            BudgetBytes = budgetbytes;
+            Hits = hits;
+            Misses = misses;
+            Evictions = evictions;
+        }
+
+
+
+        public override string ToString() => $"AudioClipCacheStats({Clips}, {ResidentClips}, {PcmBytes}, {EncodedBytes}, {BudgetBytes}, {Hits}, {Misses}, {Evictions})";
+    }
+}
\ No newline at end of file
@@ -0,0 +1,25 @@
+// This file is AUTO-GENERATED by GoudEngine codegen. DO NOT EDIT.
+#nullable enable
+using System;
+
+namespace GoudEngine
+{
+    /// <summary>Active stream, buffer footprint, and underrun counters for streamed audio</summary>
+    public struct AudioStreamStats
+    {
+        public ulong ActiveStreams;
+        public ulong BufferBytes;
+        public ulong Underruns;
+
+        public AudioStreamStats(ulong activestreams, ulong bufferbytes, ulong underruns)
+        {
+            ActiveStreams = activestreams;
+            BufferBytes = bufferbytes;
+            Underruns = underruns;
+        }
+
+
+
+        public override string ToString() => $"AudioStreamStats({ActiveStreams}, {BufferBytes}, {Underruns})";
+    }
+}
\ No newline at end of file
@@ -0,0 +1,25 @@
+// This file is AUTO-GENERATED by GoudEngine codegen. DO NOT EDIT.
+#nullable enable
+using System;
+
+namespace GoudEngine
+{
+    /// <summary>A collision between two 2D physics bodies, copied in bulk by CollisionEventsCopy</summary>
+    public struct CollisionEvent
+    {
+        public ulong BodyA;
+        public ulong BodyB;
+        public uint Kind;
+
+        public CollisionEvent(ulong bodya, ulong bodyb, uint kind)
+        {
+            BodyA = bodya;
+            BodyB = bodyb;
+            Kind = kind;
+        }
+
+
+
+        public override string ToString() => $"CollisionEvent({BodyA}, {BodyB}, {Kind})";
+    }
+}
\ No newline at end of file
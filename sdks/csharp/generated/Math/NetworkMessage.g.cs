@@ -0,0 +1,25 @@
+// This file is AUTO-GENERATED by GoudEngine codegen. DO NOT EDIT.
+#nullable enable
+using System;
+
+namespace GoudEngine
+{
+    /// <summary>Location of one received message inside a batched receive buffer</summary>
+    public struct NetworkMessage
+    {
+        public ulong PeerId;
+        public uint Offset;
+        public uint Len;
+
+        public NetworkMessage(ulong peerid, uint offset, uint len)
+        {
+            PeerId = peerid;
+            Offset = offset;
+            Len = len;
+        }
+
+
+
+        public override string ToString() => $"NetworkMessage({PeerId}, {Offset}, {Len})";
+    }
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+// This file is AUTO-GENERATED by GoudEngine codegen. DO NOT EDIT.
+#nullable enable
+using System;
+
+namespace GoudEngine
+{
+    /// <summary>A ray for batched raycasts via RaycastBatch</summary>
+    public struct PhysicsRay2D
+    {
+        public float OriginX;
+        public float OriginY;
+        public float DirX;
+        public float DirY;
+        public float MaxDist;
+
+        public PhysicsRay2D(float originx, float originy, float dirx, float diry, float maxdist)
+        {
+            OriginX = originx;
+            OriginY = originy;
+            DirX = dirx;
+            DirY = diry;
+            MaxDist = maxdist;
+        }
+
+
+
+        public override string ToString() => $"PhysicsRay2D({OriginX}, {OriginY}, {DirX}, {DirY}, {MaxDist})";
+    }
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+// This file is AUTO-GENERATED by GoudEngine codegen. DO NOT EDIT.
+#nullable enable
+using System;
+
+namespace GoudEngine
+{
+    /// <summary>Result of one ray in RaycastBatch</summary>
+    public struct PhysicsRayHit2D
+    {
+        public ulong Body;
+        public ulong Collider;
+        public float PointX;
+        public float PointY;
+        public float NormalX;
+        public float NormalY;
+        public float Distance;
+        public uint Hit;
+
+        public PhysicsRayHit2D(ulong body, ulong collider, float pointx, float pointy, float normalx, float normaly, float distance, uint hit)
+        {
+            Body = body;
+            Collider = collider;
+            PointX = pointx;
+            PointY = pointy;
+            NormalX = normalx;
+            NormalY = normaly;
+            Distance = distance;
+            Hit = hit;
+        }
+
+
+
+        public override string ToString() => $"PhysicsRayHit2D({Body}, {Collider}, {PointX}, {PointY}, {NormalX}, {NormalY}, {Distance}, {Hit})";
+    }
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+// This file is AUTO-GENERATED by GoudEngine codegen. DO NOT EDIT.
+#nullable enable
+using System;
+
+namespace GoudEngine
+{
+    /// <summary>One emitter's position and attenuation for a batched spatial audio update</summary>
+    public struct SpatialSourceUpdate
+    {
+        public ulong PlayerId;
+        public float X;
+        public float Y;
+        public float Z;
+        public float MaxDistance;
+        public float Rolloff;
+        public float Volume;
+
+        public SpatialSourceUpdate(ulong playerid, float x, float y, float z, float maxdistance, float rolloff, float volume)
+        {
+            PlayerId = playerid;
+            X = x;
+            Y = y;
+            Z = z;
+            MaxDistance = maxdistance;
+            Rolloff = rolloff;
+            Volume = volume;
+        }
+
+
+
+        public override string ToString() => $"SpatialSourceUpdate({PlayerId}, {X}, {Y}, {Z}, {MaxDistance}, {Rolloff}, {Volume})";
+    }
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+// This file is AUTO-GENERATED by GoudEngine codegen. DO NOT EDIT.
+#nullable enable
+using System;
+
+namespace GoudEngine
+{
+    /// <summary>Hit, miss, and occupancy counters for the text layout cache</summary>
+    public struct TextLayoutCacheStats
+    {
+        public ulong Hits;
+        public ulong Misses;
+        public ulong Evictions;
+        public ulong Entries;
+        public ulong Bytes;
+        public ulong BudgetBytes;
+
+        public TextLayoutCacheStats(ulong hits, ulong misses, ulong evictions, ulong entries, ulong bytes, ulong budgetbytes)
+        {
+            Hits = hits;
+            Misses = misses;
+            Evictions = evictions;
+            Entries = entries;
+            Bytes = bytes;
+            BudgetBytes = budgetbytes;
+        }
+
+
+
+        public override string ToString() => $"TextLayoutCacheStats({Hits}, {Misses}, {Evictions}, {Entries}, {Bytes}, {BudgetBytes})";
+    }
+}
\ No newline at end of file
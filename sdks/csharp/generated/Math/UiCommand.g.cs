@@ -0,0 +1,41 @@
+// This file is AUTO-GENERATED by GoudEngine codegen. DO NOT EDIT.
+#nullable enable
+using System;
+
+namespace GoudEngine
+{
+    /// <summary>One queued UI mutation for batched application.</summary>
+    public struct UiCommand
+    {
+        public uint Kind;
+        public int WidgetKind;
+        public ulong NodeId;
+        public ulong ParentId;
+        public float X;
+        public float Y;
+        public float Z;
+        public bool Flag;
+        public IntPtr TextPtr;
+        public nuint TextLen;
+        public IntPtr Style;
+
+        public UiCommand(uint kind, int widgetkind, ulong nodeid, ulong parentid, float x, float y, float z, bool flag, IntPtr textptr, nuint textlen, IntPtr style)
+        {
+            Kind = kind;
+            WidgetKind = widgetkind;
+            NodeId = nodeid;
+            ParentId = parentid;
+            X = x;
+            Y = y;
+            Z = z;
+            Flag = flag;
+            TextPtr = textptr;
+            TextLen = textlen;
+            Style = style;
+        }
+
+
+
+        public override string ToString() => $"UiCommand({Kind}, {WidgetKind}, {NodeId}, {ParentId}, {X}, {Y}, {Z}, {Flag}, {TextPtr}, {TextLen}, {Style})";
+    }
+}
\ No newline at end of file
@@ -177,6 +177,14 @@ namespace GoudEngine
         public float Penetration;
     }
 
+    [StructLayout(LayoutKind.Sequential)]
+    public struct FfiNetworkMessage
+    {
+        public ulong PeerId;
+        public uint Offset;
+        public uint Len;
+    }
+
     [StructLayout(LayoutKind.Sequential)]
     public struct FfiNetworkStats
     {
@@ -270,6 +278,23 @@ namespace GoudEngine
         public float WidgetSpacing;
     }
 
+    [StructLayout(LayoutKind.Sequential)]
+    public struct FfiUiCommand
+    {
+        public uint Kind;
+        public int WidgetKind;
+        public ulong NodeId;
+        public ulong ParentId;
+        public float X;
+        public float Y;
+        public float Z;
+        [MarshalAs(UnmanagedType.U1)]
+        public bool Flag;
+        public IntPtr TextPtr;
+        public nuint TextLen;
+        public IntPtr Style;
+    }
+
     [StructLayout(LayoutKind.Sequential)]
     public struct FfiUiEvent
     {
@@ -323,6 +348,95 @@ namespace GoudEngine
         public ulong ResetCount;
     }
 
+    [StructLayout(LayoutKind.Sequential)]
+    public struct FfiAudioClipCacheStats
+    {
+        public ulong Clips;
+        public ulong ResidentClips;
+        public ulong PcmBytes;
+        public ulong EncodedBytes;
+        public ulong BudgetBytes;
+        public ulong Hits;
+        public ulong Misses;
+        public ulong Evictions;
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    public struct FfiAudioStreamStats
+    {
+        public ulong ActiveStreams;
+        public ulong BufferBytes;
+        public ulong Underruns;
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    public struct FfiSpatialSourceUpdate
+    {
+        public ulong PlayerId;
+        public float X;
+        public float Y;
+        public float Z;
+        public float MaxDistance;
+        public float Rolloff;
+        public float Volume;
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    public struct FfiTextLayoutCacheStats
+    {
+        public ulong Hits;
+        public ulong Misses;
+        public ulong Evictions;
+        public ulong Entries;
+        public ulong Bytes;
+        public ulong BudgetBytes;
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    public struct FfiCollisionEvent
+    {
+        public ulong BodyA;
+        public ulong BodyB;
+        public uint Kind;
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    public struct FfiAnimationEvent
+    {
+        public ulong Entity;
+        public IntPtr NamePtr;
+        public IntPtr PayloadStrPtr;
+        public uint NameLen;
+        public uint Frame;
+        public uint PayloadType;
+        public int PayloadInt;
+        public float PayloadFloat;
+        public uint PayloadStrLen;
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    public struct FfiRay
+    {
+        public float OriginX;
+        public float OriginY;
+        public float DirX;
+        public float DirY;
+        public float MaxDist;
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    public struct FfiRaycastHit
+    {
+        public ulong Body;
+        public ulong Collider;
+        public float PointX;
+        public float PointY;
+        public float NormalX;
+        public float NormalY;
+        public float Distance;
+        public uint Hit;
+    }
+
     [StructLayout(LayoutKind.Sequential)]
     public unsafe struct FfiMat3x3
     {
@@ -437,6 +551,16 @@ namespace GoudEngine
         [return: MarshalAs(UnmanagedType.U1)]
         public static extern bool goud_context_is_valid(GoudContextId context_id);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_context_isolate_thread();
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_context_release_thread();
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool goud_context_thread_is_isolated();
+
         // scene
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern uint goud_scene_create(GoudContextId context_id, IntPtr name_ptr, uint name_len);
@@ -450,6 +574,12 @@ namespace GoudEngine
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern uint goud_scene_load(GoudContextId context_id, IntPtr name_ptr, uint name_len, IntPtr json_ptr, uint json_len);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern uint goud_scene_load_packed(GoudContextId context_id, IntPtr name_ptr, uint name_len, IntPtr data_ptr, uint data_len);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_scene_pack_json(IntPtr json_ptr, uint json_len, IntPtr buf, nuint buf_len);
+
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern GoudResult goud_scene_unload(GoudContextId context_id, IntPtr name_ptr, uint name_len);
 
@@ -482,6 +612,18 @@ namespace GoudEngine
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern GoudResult goud_scene_transition_tick(GoudContextId context_id, float delta_time);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern uint goud_scene_stream_begin(GoudContextId context_id, IntPtr name_ptr, uint name_len, IntPtr data_ptr, uint data_len);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern float goud_scene_stream_step(GoudContextId context_id, uint scene_id, uint budget_us);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern float goud_scene_stream_progress(GoudContextId context_id, uint scene_id);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern GoudResult goud_scene_stream_cancel(GoudContextId context_id, uint scene_id);
+
         // window
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern GoudContextId goud_window_create(uint width, uint height, string title);
@@ -585,13 +727,41 @@ namespace GoudEngine
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern ulong goud_texture_load(GoudContextId context_id, string path);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern ulong goud_texture_create_rgba8(GoudContextId context_id, IntPtr pixels, uint width, uint height);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool goud_image_get_size(IntPtr data, nuint len, ref uint out_width, ref uint out_height);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool goud_image_decode_rgba8(IntPtr data, nuint len, IntPtr out_pixels, nuint out_capacity);
+
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.U1)]
         public static extern bool goud_texture_destroy(GoudContextId context_id, ulong texture);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern ulong goud_texture_stream_load(GoudContextId context_id, string path);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern ulong goud_texture_stream_load_memory(GoudContextId context_id, IntPtr data, nuint len);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool goud_texture_streaming_set_budget(GoudContextId context_id, ulong budget_bytes);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool goud_texture_streaming_get_stats(GoudContextId context_id, ref FfiTextureStreamingStats out_stats);
+
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern ulong goud_font_load(GoudContextId context_id, string path);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern ulong goud_font_load_memory(GoudContextId context_id, IntPtr data, nuint len);
+
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.U1)]
         public static extern bool goud_font_destroy(GoudContextId context_id, ulong font_handle);
@@ -611,9 +781,70 @@ namespace GoudEngine
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern uint goud_renderer_draw_sprite_batch(GoudContextId context_id, ref FfiSpriteCmd cmds, uint count);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern ulong goud_static_layer_create(GoudContextId context_id, ref FfiSpriteCmd cmds, uint count);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_static_layer_update(GoudContextId context_id, ulong layer, uint first, ref FfiSpriteCmd cmds, uint count);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern uint goud_static_layer_draw(GoudContextId context_id, ulong layer, float offset_x, float offset_y);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool goud_static_layer_destroy(GoudContextId context_id, ulong layer);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern ulong goud_tilemap_create(GoudContextId context_id, ulong tileset, uint columns, uint rows, uint tile_width, uint tile_height, uint chunk_size);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_tilemap_set_tiles(GoudContextId context_id, ulong tilemap, uint x, uint y, uint width, uint height, IntPtr tiles);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern uint goud_tilemap_draw(GoudContextId context_id, ulong tilemap, float offset_x, float offset_y);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool goud_tilemap_destroy(GoudContextId context_id, ulong tilemap);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern ulong goud_particle_emitter_create(GoudContextId context_id, IntPtr config);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool goud_particle_emitter_set_position(GoudContextId context_id, ulong emitter, float x, float y);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_particle_emitter_set_rate(GoudContextId context_id, ulong emitter, float rate);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern uint goud_particle_emitter_burst(GoudContextId context_id, ulong emitter, uint count);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern uint goud_particles_update(GoudContextId context_id, float delta_time);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern uint goud_particle_emitter_draw(GoudContextId context_id, ulong emitter, float offset_x, float offset_y);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool goud_particle_emitter_destroy(GoudContextId context_id, ulong emitter);
+
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern uint goud_renderer_draw_text_batch(GoudContextId context_id, ref FfiTextCmd cmds, uint count);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool goud_text_layout_cache_set_budget(GoudContextId context_id, ulong budget_bytes);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool goud_text_layout_cache_clear(GoudContextId context_id);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool goud_text_layout_cache_get_stats(GoudContextId context_id, ref FfiTextLayoutCacheStats out_stats);
+
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern void goud_renderer_set_viewport(GoudContextId context_id, int x, int y, uint width, uint height);
 
@@ -745,6 +976,18 @@ namespace GoudEngine
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_debugger_stop_replay(GoudContextId context_id);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern IntPtr goud_metrics_buffer(GoudContextId context_id);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_metrics_attach_buffer(GoudContextId context_id, ref GoudMetricsBuffer buffer);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_metrics_publish(GoudContextId context_id);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_metrics_read(ref GoudMetricsBuffer buffer, ref GoudMetricsBlock out_block);
+
         // renderer_3d
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern uint goud_renderer3d_create_cube(GoudContextId context_id, uint texture_id, float width, float height, float depth);
@@ -1293,6 +1536,10 @@ namespace GoudEngine
         [return: MarshalAs(UnmanagedType.U1)]
         public static extern bool goud_input_touch_delta(GoudContextId context_id, ulong touch_id, ref float out_dx, ref float out_dy);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool goud_input_capture_snapshot(GoudContextId context_id, IntPtr out_snapshot);
+
         // input_actions
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.U1)]
@@ -1339,6 +1586,9 @@ namespace GoudEngine
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern ulong goud_entity_clone_recursive(GoudContextId context_id, ulong entity_id);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern uint goud_entity_instantiate(GoudContextId context_id, ulong template_id, uint count, ref ulong out_entities);
+
         // collision
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.U1)]
@@ -1833,6 +2083,62 @@ namespace GoudEngine
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern uint goud_component_get_all(GoudContextId context_id, ulong type_id_hash, ref ulong out_entities, ref IntPtr out_data_ptrs, uint max_count);
 
+        // world_snapshot
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern long goud_world_snapshot_save(GoudContextId context_id);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_world_snapshot_save_into(GoudContextId context_id, long handle);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_world_snapshot_restore(GoudContextId context_id, long handle);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_world_snapshot_destroy(long handle);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_world_snapshot_get_stats(long handle, ref FfiWorldSnapshotStats out_stats);
+
+        // asset_pack
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern GoudAssetPackHandle goud_asset_pack_open(string path);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern GoudAssetPackHandle goud_asset_pack_open_memory(IntPtr data, nuint len);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_asset_pack_close(GoudAssetPackHandle pack);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern ulong goud_asset_pack_hash(IntPtr name, nuint len);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern long goud_asset_pack_entry_count(GoudAssetPackHandle pack);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_asset_pack_entry_size(GoudAssetPackHandle pack, ulong name_hash, ref ulong out_size);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_asset_pack_entry_data(GoudAssetPackHandle pack, ulong name_hash, ref IntPtr out_data, IntPtr out_len);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_asset_pack_read(GoudAssetPackHandle pack, ulong name_hash, IntPtr out_buf, nuint capacity, IntPtr out_len);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern ulong goud_texture_load_from_pack(GoudContextId context_id, GoudAssetPackHandle pack, ulong name_hash);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern ulong goud_texture_stream_load_from_pack(GoudContextId context_id, GoudAssetPackHandle pack, ulong name_hash);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern ulong goud_font_load_from_pack(GoudContextId context_id, GoudAssetPackHandle pack, ulong name_hash);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern long goud_audio_play_from_pack(GoudContextId context_id, GoudAssetPackHandle pack, ulong name_hash);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern uint goud_scene_load_from_pack(GoudContextId context_id, GoudAssetPackHandle pack, ulong name_hash, IntPtr name_ptr, uint name_len);
+
         // error
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_last_error_code();
@@ -1912,6 +2218,12 @@ namespace GoudEngine
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_physics_set_velocity(GoudContextId ctx, ulong handle, float vx, float vy);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern uint goud_physics_get_bodies(GoudContextId ctx, IntPtr handles, uint count, ref FfiVec2 out_positions, ref FfiVec2 out_velocities, ref float out_rotations);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern uint goud_physics_set_velocities(GoudContextId ctx, IntPtr handles, uint count, ref FfiVec2 velocities);
+
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_physics_apply_force(GoudContextId ctx, ulong handle, float fx, float fy);
 
@@ -1933,6 +2245,15 @@ namespace GoudEngine
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_physics_collision_events_read(GoudContextId ctx, uint index, ref ulong out_body_a, ref ulong out_body_b, ref uint out_kind);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern uint goud_physics_collision_events_copy(GoudContextId ctx, uint layer_mask, ref FfiCollisionEvent out_events, uint capacity);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern uint goud_physics_raycast_batch(GoudContextId ctx, ref FfiRay rays, uint count, uint layer_mask, ref FfiRaycastHit out_hits);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern uint goud_physics_overlap_rect_batch(GoudContextId ctx, ref FfiRect rects, uint count, uint layer_mask, ref ulong out_bodies);
+
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_physics_collision_event_read(GoudContextId ctx, uint index, ref ulong out_body_a, ref ulong out_body_b, ref uint out_kind);
 
@@ -1966,6 +2287,21 @@ namespace GoudEngine
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_physics_get_timestep(GoudContextId ctx, ref float out_dt);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern long goud_physics_save_state(GoudContextId ctx);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_physics_save_state_into(GoudContextId ctx, long state);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_physics_load_state(GoudContextId ctx, long state);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_physics_free_state(long state);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_physics_set_deterministic(GoudContextId ctx, [MarshalAs(UnmanagedType.U1)] bool enabled);
+
         // physics3d
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_physics3d_create(GoudContextId ctx, float gx, float gy, float gz);
@@ -2071,6 +2407,9 @@ namespace GoudEngine
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_animation_controller_update(GoudContextId context_id, ulong entity_id, float dt);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_animation_update_batch(GoudContextId context_id, IntPtr entity_ids, uint count, float dt, ref FfiSpriteCmd out_cmds);
+
         // animation_events
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_animation_clip_add_event(GoudContextId context_id, ulong entity_id, uint clip_event_frame, IntPtr name_ptr, uint name_len, uint payload_type, int payload_int, float payload_float, IntPtr payload_str_ptr, uint payload_str_len);
@@ -2081,6 +2420,9 @@ namespace GoudEngine
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_animation_events_read(GoudContextId context_id, uint index, ref ulong out_entity, ref IntPtr out_name_ptr, ref uint out_name_len, ref uint out_frame, ref uint out_payload_type, ref int out_payload_int, ref float out_payload_float, ref IntPtr out_payload_str_ptr, ref uint out_payload_str_len);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern uint goud_animation_events_copy(GoudContextId context_id, ref FfiAnimationEvent out_events, uint capacity);
+
         // tween
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern long goud_tween_create(GoudContextId _context_id, float start, float end, float duration, int easing_type);
@@ -2100,6 +2442,9 @@ namespace GoudEngine
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_tween_destroy(GoudContextId _context_id, long handle);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_tween_step_batch(IntPtr start, IntPtr end, IntPtr duration, ref float elapsed, IntPtr easing, uint count, float dt, ref float out_values);
+
         // skeleton
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_skeleton_create(GoudContextId context_id, ulong entity_id);
@@ -2113,6 +2458,18 @@ namespace GoudEngine
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_skeleton_play_clip(GoudContextId context_id, ulong entity_id, IntPtr clip_name_ptr, int clip_name_len, [MarshalAs(UnmanagedType.U1)] bool looping);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_skeleton_add_keyframe(GoudContextId context_id, ulong entity_id, int layer, int bone_index, float time, float x, float y, float rotation, float scale_x, float scale_y);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_skeleton_layer_add(GoudContextId context_id, ulong entity_id, IntPtr name_ptr, int name_len, uint blend_mode, [MarshalAs(UnmanagedType.U1)] bool looping);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_skeleton_layer_set_weight(GoudContextId context_id, ulong entity_id, int layer, float weight);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_skeleton_update_batch(GoudContextId context_id, IntPtr entity_ids, uint count, float dt, ref float out_palette, uint palette_len, ref uint out_offsets);
+
         // animation_layer
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_animation_layer_stack_create(GoudContextId context_id, ulong entity_id);
@@ -2170,6 +2527,12 @@ namespace GoudEngine
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_network_receive(GoudContextId _context_id, long handle, IntPtr out_buf, int buf_len, ref ulong out_peer_id);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_network_receive_many(GoudContextId _context_id, long handle, IntPtr out_buf, uint buf_len, ref FfiNetworkMessage out_messages, uint max_messages, ref uint out_count);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_network_peek_size(GoudContextId _context_id, long handle, ref ulong out_peer_id, ref uint out_len);
+
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_network_poll(GoudContextId _context_id, long handle);
 
@@ -2353,6 +2716,9 @@ namespace GoudEngine
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_audio_update_spatial_volume_3d(GoudContextId context_id, ulong player_id, float source_x, float source_y, float source_z, float listener_x, float listener_y, float listener_z, float max_distance, float rolloff);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_audio_update_spatial_sources(GoudContextId context_id, float listener_x, float listener_y, float listener_z, ref FfiSpatialSourceUpdate updates, uint count);
+
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_audio_set_listener_position(GoudContextId context_id, float x, float y);
 
@@ -2386,6 +2752,36 @@ namespace GoudEngine
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_audio_active_crossfade_count(GoudContextId context_id);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern long goud_audio_clip_load(GoudContextId context_id, IntPtr asset_data, nuint asset_len);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_audio_clip_unload(GoudContextId context_id, ulong clip_id);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern long goud_audio_clip_play(GoudContextId context_id, ulong clip_id, float volume, float speed, [MarshalAs(UnmanagedType.U1)] bool looping, byte channel);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern long goud_audio_clip_play_spatial_3d(GoudContextId context_id, ulong clip_id, float source_x, float source_y, float source_z, float listener_x, float listener_y, float listener_z, float max_distance, float rolloff);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_audio_clip_cache_set_budget(GoudContextId context_id, ulong budget_bytes);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_audio_clip_cache_get_stats(GoudContextId context_id, ref FfiAudioClipCacheStats out_stats);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern long goud_audio_stream_play(GoudContextId context_id, string path, float volume, [MarshalAs(UnmanagedType.U1)] bool looping, byte channel);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern long goud_audio_stream_crossfade_to(GoudContextId context_id, ulong from_player_id, string path, float duration_sec, [MarshalAs(UnmanagedType.U1)] bool looping, byte channel);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern long goud_audio_stream_mix_with(GoudContextId context_id, ulong primary_player_id, string path, float secondary_volume, [MarshalAs(UnmanagedType.U1)] bool looping, byte secondary_channel);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_audio_stream_get_stats(GoudContextId context_id, ref FfiAudioStreamStats out_stats);
+
         // ui_manager
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern IntPtr goud_ui_manager_create();
@@ -2444,6 +2840,9 @@ namespace GoudEngine
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_ui_set_node_visible(IntPtr mgr, ulong node_id, [MarshalAs(UnmanagedType.U1)] bool visible);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_ui_apply_commands(IntPtr mgr, ref FfiUiCommand commands, uint count, ref ulong out_results, ref uint out_applied);
+
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_ui_set_event_callback(IntPtr mgr, IntPtr callback, IntPtr user_data);
 
@@ -2459,6 +2858,9 @@ namespace GoudEngine
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_ui_events_read(IntPtr mgr, uint index, ref FfiUiEvent out_event);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern uint goud_ui_events_copy(IntPtr mgr, ref FfiUiEvent out_events, uint capacity);
+
         // spatial_grid
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern uint goud_spatial_grid_create(float cell_size);
@@ -2531,6 +2933,9 @@ namespace GoudEngine
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern uint goud_entity_pool_acquire_batch(uint handle, uint count, ref ulong out_entities);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern uint goud_entity_pool_acquire_batch_slots(uint handle, uint count, ref ulong out_entities, ref uint out_slots);
+
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_entity_pool_release(uint handle, uint slot_index);
 
@@ -2541,12 +2946,24 @@ namespace GoudEngine
         public static extern int goud_entity_pool_stats(uint handle, ref FfiPoolStats out_stats);
 
         // frame_arena
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern IntPtr goud_frame_arena_alloc(nuint size, nuint align);
+
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_frame_arena_reset();
 
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_frame_arena_stats(ref FfiArenaStats out_stats);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern IntPtr goud_context_frame_arena_alloc(GoudContextId context_id, nuint size, nuint align);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_context_frame_arena_reset(GoudContextId context_id);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int goud_context_frame_arena_stats(GoudContextId context_id, ref FfiArenaStats out_stats);
+
         // render_metrics
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int goud_renderer_get_frame_metrics(GoudContextId context_id, ref FfiRenderMetrics out_metrics);
@@ -202,6 +202,7 @@ type RenderBackendKind uint32
 const (
 	RenderBackendKindWgpu RenderBackendKind = 0
 	RenderBackendKindOpenGlLegacy RenderBackendKind = 1
+	RenderBackendKindNull RenderBackendKind = 3
 )
 
 // WindowBackendKind Native window backend selection
@@ -211,6 +212,7 @@ type WindowBackendKind uint32
 const (
 	WindowBackendKindWinit WindowBackendKind = 0
 	WindowBackendKindGlfwLegacy WindowBackendKind = 1
+	WindowBackendKindHeadless WindowBackendKind = 5
 )
 
 // EasingType Easing function for tweens
@@ -45,6 +45,41 @@ extern "C" {
  */
 #define MAX_GAMEPAD_SLOTS 4
 
+/**
+ * Number of 64-bit words in each keyboard bitset (covers key codes 0-383).
+ */
+#define GOUD_INPUT_KEY_WORDS 6
+
+/**
+ * Maximum number of touches recorded in an input snapshot.
+ */
+#define GOUD_INPUT_SNAPSHOT_TOUCHES 10
+
+/**
+ * Number of analog axes recorded per gamepad.
+ */
+#define GOUD_GAMEPAD_AXIS_COUNT 6
+
+/**
+ * Chunk edge length, in tiles, used when `goud_tilemap_create` is given 0.
+ */
+#define GOUD_TILEMAP_DEFAULT_CHUNK_SIZE 32
+
+/**
+ * Largest `max_particles` one emitter accepts.
+ */
+#define GOUD_PARTICLE_MAX_PER_EMITTER (1 << 20)
+
+/**
+ * Window backend value for the windowless headless runtime.
+ */
+#define GOUD_WINDOW_BACKEND_HEADLESS 5
+
+/**
+ * Render backend value for the GPU-free null recorder used by headless engines.
+ */
+#define GOUD_RENDER_BACKEND_NULL 3
+
 /**
  * Sentinel value for an invalid entity ID.
  */
@@ -150,6 +185,71 @@ extern "C" {
  */
 #define INVALID_NODE_U64 UINT64_MAX
 
+/**
+ * Node id tag referring to an earlier command's result; OR in the command index.
+ */
+#define UI_COMMAND_RESULT_REF 18446744065119617024ull
+
+/**
+ * `goud_ui_create_node(widget_kind)`; the new id is the command's result.
+ */
+#define UI_COMMAND_CREATE_NODE 0
+
+/**
+ * `goud_ui_remove_node(node_id)`.
+ */
+#define UI_COMMAND_REMOVE_NODE 1
+
+/**
+ * `goud_ui_set_parent(node_id, parent_id)`.
+ */
+#define UI_COMMAND_SET_PARENT 2
+
+/**
+ * `goud_ui_set_widget(node_id, widget_kind)`.
+ */
+#define UI_COMMAND_SET_WIDGET 3
+
+/**
+ * `goud_ui_set_style(node_id, style)`.
+ */
+#define UI_COMMAND_SET_STYLE 4
+
+/**
+ * `goud_ui_set_label_text(node_id, text_ptr, text_len)`.
+ */
+#define UI_COMMAND_SET_LABEL_TEXT 5
+
+/**
+ * `goud_ui_set_button_enabled(node_id, flag)`.
+ */
+#define UI_COMMAND_SET_BUTTON_ENABLED 6
+
+/**
+ * `goud_ui_set_image_texture_path(node_id, text_ptr, text_len)`.
+ */
+#define UI_COMMAND_SET_IMAGE_TEXTURE_PATH 7
+
+/**
+ * `goud_ui_set_slider(node_id, x = min, y = max, z = value, flag = enabled)`.
+ */
+#define UI_COMMAND_SET_SLIDER 8
+
+/**
+ * `goud_ui_set_node_position(node_id, x, y)`.
+ */
+#define UI_COMMAND_SET_NODE_POSITION 9
+
+/**
+ * `goud_ui_set_node_visible(node_id, flag)`.
+ */
+#define UI_COMMAND_SET_NODE_VISIBLE 10
+
+/**
+ * Sets the node's layout size to `(x, y)`.
+ */
+#define UI_COMMAND_SET_NODE_SIZE 11
+
 /**
  * Size (bytes) of the per-shader uniform staging buffer.
  */
@@ -274,6 +374,52 @@ typedef struct GoudContextId {
     uint64_t _0;
 } GoudContextId;
 
+/**
+ * FFI-safe fired animation event.
+ *
+ * The string pointers borrow from the event buffer and are only valid until
+ * `Events<AnimationEventFired>::update()` is called; they are not
+ * null-terminated.
+ */
+typedef struct FfiAnimationEvent {
+    /**
+     * Entity whose animation fired the event.
+     */
+    uint64_t entity;
+    /**
+     * Event name (UTF-8).
+     */
+    const uint8_t *name_ptr;
+    /**
+     * String payload (UTF-8) when `payload_type == 3`, otherwise null.
+     */
+    const uint8_t *payload_str_ptr;
+    /**
+     * Byte length of the event name.
+     */
+    uint32_t name_len;
+    /**
+     * Frame index that triggered the event.
+     */
+    uint32_t frame;
+    /**
+     * `0` = None, `1` = Int, `2` = Float, `3` = String.
+     */
+    uint32_t payload_type;
+    /**
+     * Integer payload (valid when `payload_type == 1`).
+     */
+    int32_t payload_int;
+    /**
+     * Float payload (valid when `payload_type == 2`).
+     */
+    float payload_float;
+    /**
+     * Byte length of the string payload.
+     */
+    uint32_t payload_str_len;
+} FfiAnimationEvent;
+
 /**
  * FFI-safe arena statistics snapshot.
  */
@@ -843,6 +989,51 @@ typedef struct FfiRollbackConfig {
     uint8_t desync_detection;
 } FfiRollbackConfig;
 
+/**
+ * Counts describing one world snapshot.
+ */
+typedef struct FfiWorldSnapshotStats {
+    /**
+     * Entities alive when the snapshot was saved.
+     */
+    uint32_t entity_count;
+    /**
+     * Typed ECS component storages saved.
+     */
+    uint32_t column_count;
+    /**
+     * Typed storages shared with an earlier snapshot instead of copied.
+     */
+    uint32_t shared_column_count;
+    /**
+     * Raw (`goud_component_*`) component storages saved.
+     */
+    uint32_t raw_column_count;
+    /**
+     * Bytes of raw component data held.
+     */
+    uint64_t raw_bytes;
+} FfiWorldSnapshotStats;
+
+/**
+ * Location of one received message inside a `goud_network_receive_many`
+ * buffer.
+ */
+typedef struct FfiNetworkMessage {
+    /**
+     * Connection the message arrived from.
+     */
+    uint64_t peer_id;
+    /**
+     * Byte offset of the payload in the output buffer.
+     */
+    uint32_t offset;
+    /**
+     * Payload length in bytes.
+     */
+    uint32_t len;
+} FfiNetworkMessage;
+
 /**
  * FFI-safe aggregate network statistics for a provider handle.
  */
@@ -919,6 +1110,116 @@ typedef struct FfiPoolStats {
     uint64_t total_releases;
 } FfiPoolStats;
 
+/**
+ * FFI-safe copy of one frame's input state.
+ */
+typedef struct FfiInputSnapshot {
+    /**
+     * Keys held this frame.
+     */
+    uint64_t keys_down[GOUD_INPUT_KEY_WORDS];
+    /**
+     * Keys pressed this frame (not held last frame).
+     */
+    uint64_t keys_pressed[GOUD_INPUT_KEY_WORDS];
+    /**
+     * Keys released this frame (held last frame).
+     */
+    uint64_t keys_released[GOUD_INPUT_KEY_WORDS];
+    /**
+     * Touch ID of each used touch slot.
+     */
+    uint64_t touch_ids[GOUD_INPUT_SNAPSHOT_TOUCHES];
+    /**
+     * Mouse buttons held this frame.
+     */
+    uint32_t mouse_down;
+    /**
+     * Mouse buttons pressed this frame.
+     */
+    uint32_t mouse_pressed;
+    /**
+     * Mouse buttons released this frame.
+     */
+    uint32_t mouse_released;
+    /**
+     * Bit `p` is set when gamepad `p` is connected.
+     */
+    uint32_t gamepads_connected;
+    /**
+     * Mouse cursor X position.
+     */
+    float mouse_x;
+    /**
+     * Mouse cursor Y position.
+     */
+    float mouse_y;
+    /**
+     * Mouse X movement since last frame.
+     */
+    float mouse_dx;
+    /**
+     * Mouse Y movement since last frame.
+     */
+    float mouse_dy;
+    /**
+     * Horizontal scroll this frame.
+     */
+    float scroll_x;
+    /**
+     * Vertical scroll this frame.
+     */
+    float scroll_y;
+    /**
+     * Gamepad buttons held this frame, one mask per gamepad.
+     */
+    uint32_t gamepad_down[MAX_GAMEPAD_SLOTS];
+    /**
+     * Gamepad buttons pressed this frame, one mask per gamepad.
+     */
+    uint32_t gamepad_pressed[MAX_GAMEPAD_SLOTS];
+    /**
+     * Gamepad buttons released this frame, one mask per gamepad.
+     */
+    uint32_t gamepad_released[MAX_GAMEPAD_SLOTS];
+    /**
+     * Axis values after the dead zone, `GOUD_GAMEPAD_AXIS_COUNT` per gamepad.
+     */
+    float gamepad_axes[(MAX_GAMEPAD_SLOTS * GOUD_GAMEPAD_AXIS_COUNT)];
+    /**
+     * Number of used touch slots.
+     */
+    uint32_t touch_count;
+    /**
+     * Touch slots that are active this frame.
+     */
+    uint32_t touch_active;
+    /**
+     * Touch slots that began this frame.
+     */
+    uint32_t touch_pressed;
+    /**
+     * Touch slots that ended this frame.
+     */
+    uint32_t touch_released;
+    /**
+     * X position of each touch.
+     */
+    float touch_x[GOUD_INPUT_SNAPSHOT_TOUCHES];
+    /**
+     * Y position of each touch.
+     */
+    float touch_y[GOUD_INPUT_SNAPSHOT_TOUCHES];
+    /**
+     * X movement of each touch since last frame.
+     */
+    float touch_dx[GOUD_INPUT_SNAPSHOT_TOUCHES];
+    /**
+     * Y movement of each touch since last frame.
+     */
+    float touch_dy[GOUD_INPUT_SNAPSHOT_TOUCHES];
+} FfiInputSnapshot;
+
 /**
  * Capabilities reported by a render provider.
  */
@@ -1026,6 +1327,11 @@ typedef struct NetworkCapabilities {
  */
 typedef uint64_t GoudAtlasHandle;
 
+/**
+ * Opaque asset pack handle for FFI.
+ */
+typedef uint64_t GoudAssetPackHandle;
+
 /**
  * Opaque texture handle for FFI.
  */
@@ -1173,6 +1479,112 @@ typedef struct FfiSpriteCmd {
     int32_t _padding;
 } FfiSpriteCmd;
 
+/**
+ * FFI-safe particle emitter configuration.
+ */
+typedef struct FfiParticleEmitterConfig {
+    /**
+     * Particle texture from `goud_texture_load` (0 = solid white quads).
+     */
+    GoudTextureHandle texture;
+    /**
+     * Maximum live particles (1 to `GOUD_PARTICLE_MAX_PER_EMITTER`).
+     */
+    uint32_t max_particles;
+    /**
+     * Seed for the emitter's random ranges (0 picks a fixed default).
+     */
+    uint32_t seed;
+    /**
+     * Particles spawned per second by `goud_particles_update`.
+     */
+    float emission_rate;
+    /**
+     * Shortest particle lifetime in seconds.
+     */
+    float lifetime_min;
+    /**
+     * Longest particle lifetime in seconds.
+     */
+    float lifetime_max;
+    /**
+     * Minimum launch velocity X in pixels per second.
+     */
+    float velocity_min_x;
+    /**
+     * Minimum launch velocity Y in pixels per second.
+     */
+    float velocity_min_y;
+    /**
+     * Maximum launch velocity X in pixels per second.
+     */
+    float velocity_max_x;
+    /**
+     * Maximum launch velocity Y in pixels per second.
+     */
+    float velocity_max_y;
+    /**
+     * Constant acceleration X in pixels per second squared.
+     */
+    float gravity_x;
+    /**
+     * Constant acceleration Y in pixels per second squared.
+     */
+    float gravity_y;
+    /**
+     * Fraction of velocity lost per second (0 = none).
+     */
+    float drag;
+    /**
+     * Width of the spawn rectangle centred on the emitter.
+     */
+    float spawn_width;
+    /**
+     * Height of the spawn rectangle centred on the emitter.
+     */
+    float spawn_height;
+    /**
+     * Quad edge in pixels when a particle spawns.
+     */
+    float start_size;
+    /**
+     * Quad edge in pixels when a particle dies.
+     */
+    float end_size;
+    /**
+     * Red component at spawn.
+     */
+    float start_r;
+    /**
+     * Green component at spawn.
+     */
+    float start_g;
+    /**
+     * Blue component at spawn.
+     */
+    float start_b;
+    /**
+     * Alpha component at spawn.
+     */
+    float start_a;
+    /**
+     * Red component at death.
+     */
+    float end_r;
+    /**
+     * Green component at death.
+     */
+    float end_g;
+    /**
+     * Blue component at death.
+     */
+    float end_b;
+    /**
+     * Alpha component at death.
+     */
+    float end_a;
+} FfiParticleEmitterConfig;
+
 /**
  * FFI-safe rendering statistics.
  */
@@ -1320,6 +1732,291 @@ typedef struct FfiTextCmd {
     float a;
 } FfiTextCmd;
 
+/**
+ * FFI-safe text layout cache counters.
+ */
+typedef struct FfiTextLayoutCacheStats {
+    /**
+     * Draws whose layout came from the cache.
+     */
+    uint64_t hits;
+    /**
+     * Draws that shaped and laid out their text.
+     */
+    uint64_t misses;
+    /**
+     * Entries evicted to stay within the byte budget.
+     */
+    uint64_t evictions;
+    /**
+     * Layouts currently cached.
+     */
+    uint64_t entries;
+    /**
+     * Estimated bytes held by cached layouts.
+     */
+    uint64_t bytes;
+    /**
+     * Configured byte budget.
+     */
+    uint64_t budget_bytes;
+} FfiTextLayoutCacheStats;
+
+/**
+ * FFI-safe texture streaming counters.
+ */
+typedef struct FfiTextureStreamingStats {
+    /**
+     * Streamed textures currently loaded.
+     */
+    uint64_t textures;
+    /**
+     * Bytes of texel storage currently resident on the GPU.
+     */
+    uint64_t resident_bytes;
+    /**
+     * Bytes the same textures would occupy fully resident.
+     */
+    uint64_t full_bytes;
+    /**
+     * Configured residency budget in bytes.
+     */
+    uint64_t budget_bytes;
+    /**
+     * Textures uploaded at a finer tier since the context was created.
+     */
+    uint64_t upgrades;
+    /**
+     * Textures returned to their base tier to stay within the budget.
+     */
+    uint64_t evictions;
+} FfiTextureStreamingStats;
+
+/**
+ * FFI-safe audio clip cache counters.
+ */
+typedef struct FfiAudioClipCacheStats {
+    /**
+     * Loaded clip handles.
+     */
+    uint64_t clips;
+    /**
+     * Clips whose decoded PCM is in memory.
+     */
+    uint64_t resident_clips;
+    /**
+     * Bytes of decoded PCM in memory.
+     */
+    uint64_t pcm_bytes;
+    /**
+     * Bytes of encoded source data kept for re-decoding.
+     */
+    uint64_t encoded_bytes;
+    /**
+     * Configured PCM byte budget.
+     */
+    uint64_t budget_bytes;
+    /**
+     * Plays served from resident PCM.
+     */
+    uint64_t hits;
+    /**
+     * Plays that had to decode an evicted clip again.
+     */
+    uint64_t misses;
+    /**
+     * Clips whose PCM was evicted to stay within the budget.
+     */
+    uint64_t evictions;
+} FfiAudioClipCacheStats;
+
+/**
+ * FFI-safe audio stream counters.
+ */
+typedef struct FfiAudioStreamStats {
+    /**
+     * Streams whose decoder thread is still running.
+     */
+    uint64_t active_streams;
+    /**
+     * Decoded-audio buffers the active streams can hold at most.
+     */
+    uint64_t buffer_bytes;
+    /**
+     * Times playback found a stream's queue empty and played silence.
+     */
+    uint64_t underruns;
+} FfiAudioStreamStats;
+
+/**
+ * One emitter's position and attenuation for
+ * `goud_audio_update_spatial_sources`.
+ */
+typedef struct FfiSpatialSourceUpdate {
+    /**
+     * Player ID of the emitter's sink.
+     */
+    uint64_t player_id;
+    /**
+     * Source position X.
+     */
+    float x;
+    /**
+     * Source position Y.
+     */
+    float y;
+    /**
+     * Source position Z (0 for 2D).
+     */
+    float z;
+    /**
+     * Distance at which the source is silent.
+     */
+    float max_distance;
+    /**
+     * Attenuation curve exponent.
+     */
+    float rolloff;
+    /**
+     * Volume before attenuation (0.0-1.0, clamped).
+     */
+    float volume;
+} FfiSpatialSourceUpdate;
+
+/**
+ * FFI-safe collision event.
+ */
+typedef struct FfiCollisionEvent {
+    /**
+     * First body involved in the collision.
+     */
+    uint64_t body_a;
+    /**
+     * Second body involved in the collision.
+     */
+    uint64_t body_b;
+    /**
+     * 0 = Enter, 1 = Stay, 2 = Exit.
+     */
+    uint32_t kind;
+} FfiCollisionEvent;
+
+/**
+ * A ray for `goud_physics_raycast_batch`.
+ */
+typedef struct FfiRay {
+    /**
+     * Ray origin X.
+     */
+    float origin_x;
+    /**
+     * Ray origin Y.
+     */
+    float origin_y;
+    /**
+     * Ray direction X.
+     */
+    float dir_x;
+    /**
+     * Ray direction Y.
+     */
+    float dir_y;
+    /**
+     * Maximum distance along the ray.
+     */
+    float max_dist;
+} FfiRay;
+
+/**
+ * Result of one ray in `goud_physics_raycast_batch`.
+ */
+typedef struct FfiRaycastHit {
+    /**
+     * Body that was hit, or 0.
+     */
+    uint64_t body;
+    /**
+     * Collider that was hit, or 0.
+     */
+    uint64_t collider;
+    /**
+     * Hit point X.
+     */
+    float point_x;
+    /**
+     * Hit point Y.
+     */
+    float point_y;
+    /**
+     * Surface normal X.
+     */
+    float normal_x;
+    /**
+     * Surface normal Y.
+     */
+    float normal_y;
+    /**
+     * Distance from the ray origin to the hit point.
+     */
+    float distance;
+    /**
+     * 1 if the ray hit something, 0 otherwise.
+     */
+    uint32_t hit;
+} FfiRaycastHit;
+
+/**
+ * One queued UI mutation for [`goud_ui_apply_commands`].
+ *
+ * Fields a command kind does not use are ignored.
+ */
+typedef struct FfiUiCommand {
+    /**
+     * One of the `UI_COMMAND_*` kinds.
+     */
+    uint32_t kind;
+    /**
+     * Widget kind for create/set-widget commands (same codes as `goud_ui_create_node`).
+     */
+    int32_t widget_kind;
+    /**
+     * Target node id, or a result reference.
+     */
+    uint64_t node_id;
+    /**
+     * Parent for set-parent (`u64::MAX` detaches), or a result reference.
+     */
+    uint64_t parent_id;
+    /**
+     * First float argument.
+     */
+    float x;
+    /**
+     * Second float argument.
+     */
+    float y;
+    /**
+     * Third float argument.
+     */
+    float z;
+    /**
+     * Boolean argument.
+     */
+    bool flag;
+    /**
+     * UTF-8 bytes for label text and texture paths; nullable when `text_len` is 0.
+     */
+    const uint8_t *text_ptr;
+    /**
+     * Length in bytes for `text_ptr`.
+     */
+    size_t text_len;
+    /**
+     * Style payload for set-style commands.
+     */
+    const struct FfiUiStyle *style;
+} FfiUiCommand;
+
 /**
  * FFI-safe event payload used by deterministic event polling/read APIs.
  */
@@ -1462,6 +2159,21 @@ typedef uint64_t GoudShaderHandle;
  */
 typedef uint64_t GoudBufferHandle;
 
+/**
+ * Opaque static layer handle for FFI.
+ */
+typedef uint64_t GoudStaticLayerHandle;
+
+/**
+ * Opaque tilemap handle for FFI.
+ */
+typedef uint64_t GoudTilemapHandle;
+
+/**
+ * Opaque particle emitter handle for FFI.
+ */
+typedef uint64_t GoudParticleEmitterHandle;
+
 /**
  * FFI-safe result type for returning success/failure status across the FFI boundary.
  */
@@ -1770,6 +2482,26 @@ typedef struct GoudResult {
  */
 #define GOUD_INVALID_ATLAS UINT64_MAX
 
+/**
+ * Invalid asset pack handle constant.
+ */
+#define GOUD_INVALID_ASSET_PACK UINT64_MAX
+
+/**
+ * Layout version written to [`GoudMetricsBuffer::version`].
+ */
+#define GOUD_METRICS_BLOCK_VERSION 1
+
+/**
+ * Floats per bone in the palette written by `goud_skeleton_update_batch`.
+ */
+#define GOUD_BONE_PALETTE_FLOATS 8
+
+/**
+ * Invalid audio clip handle constant.
+ */
+#define GOUD_INVALID_AUDIO_CLIP 0
+
 /**
  * Invalid shader handle constant.
  */
@@ -1790,6 +2522,21 @@ typedef struct GoudResult {
  */
 #define GOUD_INVALID_TEXTURE UINT64_MAX
 
+/**
+ * Invalid static layer handle constant.
+ */
+#define GOUD_INVALID_STATIC_LAYER UINT64_MAX
+
+/**
+ * Invalid tilemap handle constant.
+ */
+#define GOUD_INVALID_TILEMAP UINT64_MAX
+
+/**
+ * Invalid particle emitter handle constant.
+ */
+#define GOUD_INVALID_PARTICLE_EMITTER UINT64_MAX
+
 /* === ECS === */
 
 /**
@@ -1872,6 +2619,21 @@ bool goud_context_destroy(struct GoudContextId context_id);
  */
 bool goud_context_is_valid(struct GoudContextId context_id);
 
+/**
+ * Gives the calling thread a private context registry.
+ */
+int32_t goud_context_isolate_thread(void);
+
+/**
+ * Returns the calling thread to the process-wide context registry.
+ */
+int32_t goud_context_release_thread(void);
+
+/**
+ * Returns `true` if the calling thread has a private context registry.
+ */
+bool goud_context_thread_is_isolated(void);
+
 /**
  * Spawns a new empty entity in the world.
  */
@@ -1902,6 +2664,11 @@ uint64_t goud_entity_clone(struct GoudContextId context_id, uint64_t entity_id);
  */
 uint64_t goud_entity_clone_recursive(struct GoudContextId context_id, uint64_t entity_id);
 
+/**
+ * Clones the entity hierarchy rooted at `template_id` `count` times.
+ */
+uint32_t goud_entity_instantiate(struct GoudContextId context_id, uint64_t template_id, uint32_t count, uint64_t *out_entities);
+
 /**
  * Checks if an entity is currently alive in the world.
  */
@@ -1937,6 +2704,11 @@ uint64_t goud_entity_pool_acquire(uint32_t handle);
  */
 uint32_t goud_entity_pool_acquire_batch(uint32_t handle, uint32_t count, uint64_t *out_entities);
 
+/**
+ * Acquires multiple entities from the pool and reports their slot indices.
+ */
+uint32_t goud_entity_pool_acquire_batch_slots(uint32_t handle, uint32_t count, uint64_t *out_entities, uint32_t *out_slots);
+
 /**
  * Releases an entity back to the pool by slot index.
  */
@@ -2019,6 +2791,11 @@ GoudResult goud_scene_transition_tick(struct GoudContextId context_id, float del
  */
 GoudFontHandle goud_font_load(struct GoudContextId context_id, const char *path);
 
+/**
+ * Loads a font from an in-memory TTF/OTF buffer and returns an opaque handle.
+ */
+GoudFontHandle goud_font_load_memory(struct GoudContextId context_id, const uint8_t *data, size_t len);
+
 /**
  * Destroys a loaded font and frees associated GPU atlases.
  */
@@ -2029,21 +2806,88 @@ bool goud_font_destroy(struct GoudContextId context_id, GoudFontHandle font_hand
  */
 GoudTextureHandle goud_texture_load(struct GoudContextId context_id, const char *path);
 
+/**
+ * Creates a texture from tightly packed RGBA8 pixels.
+ */
+GoudTextureHandle goud_texture_create_rgba8(struct GoudContextId context_id, const uint8_t *pixels, uint32_t width, uint32_t height);
+
+/**
+ * Reads the dimensions of an encoded image (PNG, JPEG, ...) without
+ * decoding its pixels.
+ */
+bool goud_image_get_size(const uint8_t *data, size_t len, uint32_t *out_width, uint32_t *out_height);
+
+/**
+ * Decodes an encoded image (PNG, JPEG, ...) into tightly packed RGBA8.
+ */
+bool goud_image_decode_rgba8(const uint8_t *data, size_t len, uint8_t *out_pixels, size_t out_capacity);
+
 /**
  * Destroys a texture and releases its GPU resources.
  */
 bool goud_texture_destroy(struct GoudContextId context_id, GoudTextureHandle texture);
 
+/**
+ * Loads an image file as a streamed texture.
+ */
+GoudTextureHandle goud_texture_stream_load(struct GoudContextId context_id, const char *path);
+
+/**
+ * Loads an encoded image (PNG, JPEG, ...) from memory as a streamed texture.
+ */
+GoudTextureHandle goud_texture_stream_load_memory(struct GoudContextId context_id, const uint8_t *data, size_t len);
+
+/**
+ * Sets the context's texture residency budget in bytes.
+ */
+bool goud_texture_streaming_set_budget(struct GoudContextId context_id, uint64_t budget_bytes);
+
+/**
+ * Writes residency, budget, and upgrade/eviction counters for the
+ * context's streamed textures.
+ */
+bool goud_texture_streaming_get_stats(struct GoudContextId context_id, struct FfiTextureStreamingStats *out_stats);
+
 /**
  * Loads a scene from JSON.
  */
 uint32_t goud_scene_load(struct GoudContextId context_id, const uint8_t *name_ptr, uint32_t name_len, const uint8_t *json_ptr, uint32_t json_len);
 
+/**
+ * Loads a scene from packed binary data.
+ */
+uint32_t goud_scene_load_packed(struct GoudContextId context_id, const uint8_t *name_ptr, uint32_t name_len, const uint8_t *data_ptr, uint32_t data_len);
+
+/**
+ * Converts a JSON scene to the packed binary format.
+ */
+int32_t goud_scene_pack_json(const uint8_t *json_ptr, uint32_t json_len, uint8_t *buf, size_t buf_len);
+
 /**
  * Unloads a scene by name.
  */
 GoudResult goud_scene_unload(struct GoudContextId context_id, const uint8_t *name_ptr, uint32_t name_len);
 
+/**
+ * Starts loading a packed scene over several frames.
+ */
+uint32_t goud_scene_stream_begin(struct GoudContextId context_id, const uint8_t *name_ptr, uint32_t name_len, const uint8_t *data_ptr, uint32_t data_len);
+
+/**
+ * Advances the streamed load of a scene for up to `budget_us` microseconds.
+ */
+float goud_scene_stream_step(struct GoudContextId context_id, uint32_t scene_id, uint32_t budget_us);
+
+/**
+ * Returns the progress of a scene's streamed load.
+ */
+float goud_scene_stream_progress(struct GoudContextId context_id, uint32_t scene_id);
+
+/**
+ * Cancels a scene's streamed load and destroys the scene.
+ */
+GoudResult goud_scene_stream_cancel(struct GoudContextId context_id, uint32_t scene_id);
+
 /* === Renderer === */
 
 /**
@@ -2063,56 +2907,210 @@ typedef struct FfiFramePhaseTimings {
      */
     uint64_t surface_acquire_us;
     /**
-     * GPU shadow depth pass recording and execution time (us).
+     * GPU shadow depth pass recording and execution time (us).
+     */
+    uint64_t shadow_pass_us;
+    /**
+     * Shadow map build time (us).
+     */
+    uint64_t shadow_build_us;
+    /**
+     * 3D scene render time (us).
+     */
+    uint64_t render3d_scene_us;
+    /**
+     * Uniform upload and pipeline creation time (us).
+     */
+    uint64_t uniform_upload_us;
+    /**
+     * GPU render pass recording time (us).
+     */
+    uint64_t render_pass_us;
+    /**
+     * GPU command submission time (us).
+     */
+    uint64_t gpu_submit_us;
+    /**
+     * GPU readback stall time (us).
+     */
+    uint64_t readback_stall_us;
+    /**
+     * Surface present / vsync wait time (us).
+     */
+    uint64_t surface_present_us;
+    /**
+     * Animation evaluation time (us).
+     */
+    uint64_t anim_eval_us;
+    /**
+     * Bone matrix packing time (us).
+     */
+    uint64_t bone_pack_us;
+    /**
+     * Bone matrix GPU upload time (us).
+     */
+    uint64_t bone_upload_us;
+} FfiFramePhaseTimings;
+
+/**
+ * One frame's engine counters in a fixed binary layout.
+ */
+typedef struct GoudMetricsBlock {
+    /**
+     * Publish number of this block, starting at 1; 0 before the first publish.
+     */
+    uint64_t publish_index;
+    /**
+     * Debugger frame index, or 0 when the context has no debugger route.
+     */
+    uint64_t frame_index;
+    /**
+     * Frame phase timings recorded on the publishing thread.
+     */
+    struct FfiFramePhaseTimings phases;
+    /**
+     * The context's frame arena statistics.
+     */
+    struct FfiArenaStats arena;
+    /**
+     * Stats of the context's active network handle, or the debugger's byte
+     * totals when it has none.
      */
-    uint64_t shadow_pass_us;
+    struct FfiNetworkStats network;
     /**
-     * Shadow map build time (us).
+     * Debugger memory category totals.
      */
-    uint64_t shadow_build_us;
+    struct GoudMemorySummary memory;
     /**
-     * 3D scene render time (us).
+     * Render metrics accumulated for the frame.
      */
-    uint64_t render3d_scene_us;
+    struct FfiRenderMetrics render;
     /**
-     * Uniform upload and pipeline creation time (us).
+     * Frame rate statistics.
      */
-    uint64_t uniform_upload_us;
+    struct FpsStats fps;
     /**
-     * GPU render pass recording time (us).
+     * Alive entities in the context's world.
      */
-    uint64_t render_pass_us;
+    uint32_t entity_count;
+} GoudMetricsBlock;
+
+/**
+ * One half of a [`GoudMetricsBuffer`].
+ */
+typedef struct GoudMetricsSlot {
     /**
-     * GPU command submission time (us).
+     * Odd while the slot is being written, even once it is stable.
      */
-    uint64_t gpu_submit_us;
+    uint64_t sequence;
     /**
-     * GPU readback stall time (us).
+     * The block last published into this slot.
      */
-    uint64_t readback_stall_us;
+    struct GoudMetricsBlock block;
+} GoudMetricsSlot;
+
+/**
+ * Double-buffered metrics block shared between a context and its readers.
+ */
+typedef struct GoudMetricsBuffer {
     /**
-     * Surface present / vsync wait time (us).
+     * Layout version; [`GOUD_METRICS_BLOCK_VERSION`].
      */
-    uint64_t surface_present_us;
+    uint32_t version;
     /**
-     * Animation evaluation time (us).
+     * Size in bytes of one [`GoudMetricsBlock`].
      */
-    uint64_t anim_eval_us;
+    uint32_t block_size;
     /**
-     * Bone matrix packing time (us).
+     * Blocks published so far; the latest is in `slots[published % 2]`.
      */
-    uint64_t bone_pack_us;
+    uint64_t published;
     /**
-     * Bone matrix GPU upload time (us).
+     * The two block slots.
      */
-    uint64_t bone_upload_us;
-} FfiFramePhaseTimings;
+    struct GoudMetricsSlot slots[2];
+} GoudMetricsBuffer;
 
 /**
  * Draws a batch of sprites in a single GPU pass. Sprites are sorted by
  */
 uint32_t goud_renderer_draw_sprite_batch(struct GoudContextId context_id, const struct FfiSpriteCmd *cmds, uint32_t count);
 
+/**
+ * Uploads `count` sprite commands into a new static layer.
+ */
+GoudStaticLayerHandle goud_static_layer_create(struct GoudContextId context_id, const struct FfiSpriteCmd *cmds, uint32_t count);
+
+/**
+ * Replaces `count` commands of a static layer, starting at command `first`.
+ */
+int32_t goud_static_layer_update(struct GoudContextId context_id, GoudStaticLayerHandle layer, uint32_t first, const struct FfiSpriteCmd *cmds, uint32_t count);
+
+/**
+ * Draws a static layer with every sprite shifted by (`offset_x`, `offset_y`).
+ */
+uint32_t goud_static_layer_draw(struct GoudContextId context_id, GoudStaticLayerHandle layer, float offset_x, float offset_y);
+
+/**
+ * Destroys a static layer and frees its GPU buffers.
+ */
+bool goud_static_layer_destroy(struct GoudContextId context_id, GoudStaticLayerHandle layer);
+
+/**
+ * Creates an empty `columns` x `rows` tilemap drawn from `tileset`.
+ */
+GoudTilemapHandle goud_tilemap_create(struct GoudContextId context_id, GoudTextureHandle tileset, uint32_t columns, uint32_t rows, uint32_t tile_width, uint32_t tile_height, uint32_t chunk_size);
+
+/**
+ * Writes a `width` x `height` block of row-major tile IDs at tile (`x`, `y`).
+ */
+int32_t goud_tilemap_set_tiles(struct GoudContextId context_id, GoudTilemapHandle tilemap, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint32_t *tiles);
+
+/**
+ * Draws the chunks of a tilemap that overlap the window.
+ */
+uint32_t goud_tilemap_draw(struct GoudContextId context_id, GoudTilemapHandle tilemap, float offset_x, float offset_y);
+
+/**
+ * Destroys a tilemap and frees the GPU buffers of its baked chunks.
+ */
+bool goud_tilemap_destroy(struct GoudContextId context_id, GoudTilemapHandle tilemap);
+
+/**
+ * Creates a particle emitter at (0, 0) from `config`.
+ */
+GoudParticleEmitterHandle goud_particle_emitter_create(struct GoudContextId context_id, const struct FfiParticleEmitterConfig *config);
+
+/**
+ * Moves an emitter; particles already alive keep their positions.
+ */
+bool goud_particle_emitter_set_position(struct GoudContextId context_id, GoudParticleEmitterHandle emitter, float x, float y);
+
+/**
+ * Changes an emitter's continuous emission rate in particles per second.
+ */
+int32_t goud_particle_emitter_set_rate(struct GoudContextId context_id, GoudParticleEmitterHandle emitter, float rate);
+
+/**
+ * Spawns up to `count` particles from an emitter immediately.
+ */
+uint32_t goud_particle_emitter_burst(struct GoudContextId context_id, GoudParticleEmitterHandle emitter, uint32_t count);
+
+/**
+ * Advances every emitter of the context by `delta_time` seconds.
+ */
+uint32_t goud_particles_update(struct GoudContextId context_id, float delta_time);
+
+/**
+ * Draws an emitter's live particles as instanced quads in one draw call.
+ */
+uint32_t goud_particle_emitter_draw(struct GoudContextId context_id, GoudParticleEmitterHandle emitter, float offset_x, float offset_y);
+
+/**
+ * Destroys an emitter, its particles, and its instance buffer.
+ */
+bool goud_particle_emitter_destroy(struct GoudContextId context_id, GoudParticleEmitterHandle emitter);
+
 /**
  * Draws a textured sprite at the given position.
  */
@@ -2208,6 +3206,21 @@ GOUD_DEPRECATED_MSG("Use goud_renderer_draw_text instead.") bool goud_draw_text(
  */
 uint32_t goud_renderer_draw_text_batch(struct GoudContextId context_id, const struct FfiTextCmd *cmds, uint32_t count);
 
+/**
+ * Sets the byte budget of the context's text layout cache.
+ */
+bool goud_text_layout_cache_set_budget(struct GoudContextId context_id, uint64_t budget_bytes);
+
+/**
+ * Drops every cached text layout for the context.
+ */
+bool goud_text_layout_cache_clear(struct GoudContextId context_id);
+
+/**
+ * Writes hit, miss, eviction, and occupancy counters for the context's
+ */
+bool goud_text_layout_cache_get_stats(struct GoudContextId context_id, struct FfiTextLayoutCacheStats *out_stats);
+
 /**
  * Returns the number of animations in a model, or -1 if invalid.
  */
@@ -3185,8 +4198,133 @@ bool goud_input_touch_just_released(struct GoudContextId context_id, uint64_t to
  */
 bool goud_input_touch_delta(struct GoudContextId context_id, uint64_t touch_id, float *out_dx, float *out_dy);
 
+/**
+ * Copies the context's current input state into `out_snapshot`.
+ */
+bool goud_input_capture_snapshot(struct GoudContextId context_id, struct FfiInputSnapshot *out_snapshot);
+
 /* === Audio === */
 
+/**
+ * Opens a GOUD archive by memory-mapping it.
+ */
+GoudAssetPackHandle goud_asset_pack_open(const char *path);
+
+/**
+ * Opens a GOUD archive from an in-memory buffer.
+ */
+GoudAssetPackHandle goud_asset_pack_open_memory(const uint8_t *data, size_t len);
+
+/**
+ * Closes an asset pack.
+ */
+int32_t goud_asset_pack_close(GoudAssetPackHandle pack);
+
+/**
+ * Returns the 64-bit name hash that identifies an entry in a pack.
+ */
+uint64_t goud_asset_pack_hash(const uint8_t *name, size_t len);
+
+/**
+ * Returns the number of entries in a pack, or -1 if the handle is unknown.
+ */
+int64_t goud_asset_pack_entry_count(GoudAssetPackHandle pack);
+
+/**
+ * Writes the decompressed size of an entry into `out_size`.
+ */
+int32_t goud_asset_pack_entry_size(GoudAssetPackHandle pack, uint64_t name_hash, uint64_t *out_size);
+
+/**
+ * Returns a pointer to an uncompressed entry's bytes inside the pack.
+ */
+int32_t goud_asset_pack_entry_data(GoudAssetPackHandle pack, uint64_t name_hash, const uint8_t **out_data, size_t *out_len);
+
+/**
+ * Copies an entry's decompressed bytes into `out_buf`.
+ */
+int32_t goud_asset_pack_read(GoudAssetPackHandle pack, uint64_t name_hash, uint8_t *out_buf, size_t capacity, size_t *out_len);
+
+/**
+ * Loads a texture from an encoded image (PNG, JPEG, ...) in a pack.
+ */
+GoudTextureHandle goud_texture_load_from_pack(struct GoudContextId context_id, GoudAssetPackHandle pack, uint64_t name_hash);
+
+/**
+ * Loads an encoded image entry as a streamed texture.
+ */
+GoudTextureHandle goud_texture_stream_load_from_pack(struct GoudContextId context_id, GoudAssetPackHandle pack, uint64_t name_hash);
+
+/**
+ * Loads a TTF/OTF font from a pack.
+ */
+GoudFontHandle goud_font_load_from_pack(struct GoudContextId context_id, GoudAssetPackHandle pack, uint64_t name_hash);
+
+/**
+ * Plays encoded audio (WAV/OGG/MP3/FLAC) from a pack on the SFX channel.
+ */
+int64_t goud_audio_play_from_pack(struct GoudContextId context_id, GoudAssetPackHandle pack, uint64_t name_hash);
+
+/**
+ * Loads a scene from a pack under the given name.
+ */
+uint32_t goud_scene_load_from_pack(struct GoudContextId context_id, GoudAssetPackHandle pack, uint64_t name_hash, const uint8_t *name_ptr, uint32_t name_len);
+
+/**
+ * Decodes audio bytes once and caches them as a clip.
+ */
+int64_t goud_audio_clip_load(struct GoudContextId context_id, const uint8_t *asset_data, size_t asset_len);
+
+/**
+ * Unloads a clip.  Players already started from it keep playing.
+ */
+int32_t goud_audio_clip_unload(struct GoudContextId context_id, uint64_t clip_id);
+
+/**
+ * Plays a cached clip with full control over volume, speed, looping, and
+ */
+int64_t goud_audio_clip_play(struct GoudContextId context_id, uint64_t clip_id, float volume, float speed, bool looping, uint8_t channel);
+
+/**
+ * Plays a cached clip on the SFX channel with spatial attenuation in 3D.
+ */
+int64_t goud_audio_clip_play_spatial_3d(struct GoudContextId context_id, uint64_t clip_id, float source_x, float source_y, float source_z, float listener_x, float listener_y, float listener_z, float max_distance, float rolloff);
+
+/**
+ * Sets the byte budget for decoded clip PCM.
+ */
+int32_t goud_audio_clip_cache_set_budget(struct GoudContextId context_id, uint64_t budget_bytes);
+
+/**
+ * Writes the clip cache's occupancy, hit, and eviction counters.
+ */
+int32_t goud_audio_clip_cache_get_stats(struct GoudContextId context_id, struct FfiAudioClipCacheStats *out_stats);
+
+/**
+ * Streams an audio file from disk.
+ */
+int64_t goud_audio_stream_play(struct GoudContextId context_id, const char *path, float volume, bool looping, uint8_t channel);
+
+/**
+ * Starts a timed crossfade from an active sink to a newly streamed file.
+ */
+int64_t goud_audio_stream_crossfade_to(struct GoudContextId context_id, uint64_t from_player_id, const char *path, float duration_sec, bool looping, uint8_t channel);
+
+/**
+ * Layers a streamed file on top of an active primary sink.
+ */
+int64_t goud_audio_stream_mix_with(struct GoudContextId context_id, uint64_t primary_player_id, const char *path, float secondary_volume, bool looping, uint8_t secondary_channel);
+
+/**
+ * Writes the active stream count, buffer footprint, and underrun counter.
+ */
+int32_t goud_audio_stream_get_stats(struct GoudContextId context_id, struct FfiAudioStreamStats *out_stats);
+
+/**
+ * Sets the listener and applies `count` emitter updates in one pass.
+ */
+int32_t goud_audio_update_spatial_sources(struct GoudContextId context_id, float listener_x, float listener_y, float listener_z, const struct FfiSpatialSourceUpdate *updates, uint32_t count);
+
 /**
  * Activates audio playback on platforms that require explicit initialization.
  */
@@ -4027,6 +5165,16 @@ int32_t goud_animation_events_count(struct GoudContextId context_id);
  */
 int32_t goud_animation_events_read(struct GoudContextId context_id, uint32_t index, uint64_t *out_entity, const uint8_t **out_name_ptr, uint32_t *out_name_len, uint32_t *out_frame, uint32_t *out_payload_type, int32_t *out_payload_int, float *out_payload_float, const uint8_t **out_payload_str_ptr, uint32_t *out_payload_str_len);
 
+/**
+ * Copies the fired animation events in the read buffer into `out_events`.
+ */
+uint32_t goud_animation_events_copy(struct GoudContextId context_id, struct FfiAnimationEvent *out_events, uint32_t capacity);
+
+/**
+ * Advances the animation of `count` entities by `dt` seconds.
+ */
+int32_t goud_animation_update_batch(struct GoudContextId context_id, const uint64_t *entity_ids, uint32_t count, float dt, struct FfiSpriteCmd *out_cmds);
+
 /**
  * Creates an empty `AnimationLayerStack` component on the given entity.
  */
@@ -4134,6 +5282,16 @@ int32_t goud_physics_get_velocity(struct GoudContextId ctx, uint64_t handle, flo
  */
 int32_t goud_physics_set_velocity(struct GoudContextId ctx, uint64_t handle, float vx, float vy);
 
+/**
+ * Reads position, velocity, and rotation for `count` bodies.
+ */
+uint32_t goud_physics_get_bodies(struct GoudContextId ctx, const uint64_t *handles, uint32_t count, struct FfiVec2 *out_positions, struct FfiVec2 *out_velocities, float *out_rotations);
+
+/**
+ * Sets the linear velocity of `count` bodies.
+ */
+uint32_t goud_physics_set_velocities(struct GoudContextId ctx, const uint64_t *handles, uint32_t count, const struct FfiVec2 *velocities);
+
 /**
  * Applies a force to a body (accumulated over the frame).
  */
@@ -4174,6 +5332,21 @@ int32_t goud_physics_collision_events_read(struct GoudContextId ctx, uint32_t in
  */
 int32_t goud_physics_collision_event_read(struct GoudContextId ctx, uint32_t index, uint64_t *out_body_a, uint64_t *out_body_b, uint32_t *out_kind);
 
+/**
+ * Copies collision events captured by the last `goud_physics_step` call
+ */
+uint32_t goud_physics_collision_events_copy(struct GoudContextId ctx, uint32_t layer_mask, struct FfiCollisionEvent *out_events, uint32_t capacity);
+
+/**
+ * Casts `count` rays and writes the first hit of each into `out_hits`.
+ */
+uint32_t goud_physics_raycast_batch(struct GoudContextId ctx, const struct FfiRay *rays, uint32_t count, uint32_t layer_mask, struct FfiRaycastHit *out_hits);
+
+/**
+ * Tests `count` rectangles for overlap with any collider.
+ */
+uint32_t goud_physics_overlap_rect_batch(struct GoudContextId ctx, const struct FfiRect *rects, uint32_t count, uint32_t layer_mask, uint64_t *out_bodies);
+
 /**
  * Attaches a collider with explicit sensor/layer/mask filtering data.
  */
@@ -4229,6 +5402,31 @@ int32_t goud_physics_set_timestep(struct GoudContextId ctx, float dt);
  */
 int32_t goud_physics_get_timestep(struct GoudContextId ctx, float *out_dt);
 
+/**
+ * Saves the full 2D physics state of a context.
+ */
+int64_t goud_physics_save_state(struct GoudContextId ctx);
+
+/**
+ * Overwrites an existing state handle with the context's current 2D physics state.
+ */
+int32_t goud_physics_save_state_into(struct GoudContextId ctx, int64_t state);
+
+/**
+ * Restores a context's 2D physics to a saved state.
+ */
+int32_t goud_physics_load_state(struct GoudContextId ctx, int64_t state);
+
+/**
+ * Frees a saved 2D physics state.
+ */
+int32_t goud_physics_free_state(int64_t state);
+
+/**
+ * Switches deterministic stepping on or off for a context's 2D physics.
+ */
+int32_t goud_physics_set_deterministic(struct GoudContextId ctx, bool enabled);
+
 /**
  * Creates a rigid body in the 3D physics world.
  */
@@ -4418,6 +5616,49 @@ float goud_collision_distance_squared(float x1, float y1, float x2, float y2);
 
 /* === Network === */
 
+/**
+ * Moves buffered messages (queued by `goud_network_poll`) into `out_buf`.
+ *
+ * Payloads are written back to back from the start of `out_buf`, and one
+ * [`FfiNetworkMessage`] per payload is written to `out_messages`.  Stops at
+ * `max_messages`, when the queue is empty, or at the first message that
+ * does not fit in the remaining space; that message stays queued.
+ *
+ * # Returns
+ *
+ * `0` on success, with the message count in `out_count` (0 if the queue is
+ * empty), or an error code.  Fails with `ERR_INVALID_STATE` when the next
+ * message is larger than `buf_len`, leaving it queued; call
+ * `goud_network_peek_size` for the size it needs.
+ *
+ * # Safety
+ *
+ * `out_buf` must be valid for `buf_len` writable bytes, `out_messages` for
+ * `max_messages` writable [`FfiNetworkMessage`] values, and `out_count`
+ * must point to a writable `u32`. None are retained.
+ */
+int32_t goud_network_receive_many(struct GoudContextId _context_id, int64_t handle, uint8_t *out_buf, uint32_t buf_len, struct FfiNetworkMessage *out_messages, uint32_t max_messages, uint32_t *out_count);
+
+/**
+ * Reports the sender and size of the next buffered message without
+ * moving it.
+ *
+ * Lets a caller whose `goud_network_receive_many` buffer is too small for
+ * the next message grow the buffer and retry, instead of leaving that
+ * message blocking the queue.
+ *
+ * # Returns
+ *
+ * `0` on success, with the peer in `out_peer_id` and the payload length in
+ * `out_len` (both 0 when the queue is empty), or an error code.
+ *
+ * # Safety
+ *
+ * `out_peer_id` must point to a writable `u64` and `out_len` to a
+ * writable `u32`. Neither is retained.
+ */
+int32_t goud_network_peek_size(struct GoudContextId _context_id, int64_t handle, uint64_t *out_peer_id, uint32_t *out_len);
+
 /**
  * Returns the number of active connections, or a negative error code.
  */
@@ -4515,6 +5756,11 @@ int32_t goud_ui_event_read(const struct UiManager *mgr, uint32_t index, struct F
  */
 int32_t goud_ui_events_read(const struct UiManager *mgr, uint32_t index, struct FfiUiEvent *out_event);
 
+/**
+ * Copies the UI events captured in the latest FFI UI update tick into
+ */
+uint32_t goud_ui_events_copy(const struct UiManager *mgr, struct FfiUiEvent *out_events, uint32_t capacity);
+
 /**
  * Creates a new [`UiManager`] and returns an owning pointer.
  */
@@ -4610,6 +5856,15 @@ int32_t goud_ui_set_node_position(struct UiManager *mgr, uint64_t node_id, float
  */
 int32_t goud_ui_set_node_visible(struct UiManager *mgr, uint64_t node_id, bool visible);
 
+/**
+ * Applies `count` UI mutations in order.
+ *
+ * Each command behaves exactly like the matching single-property
+ * `goud_ui_*` call.  Application stops at the first failing command, whose
+ * error code is returned; the commands before it stay applied.
+ */
+int32_t goud_ui_apply_commands(struct UiManager *mgr, const struct FfiUiCommand *commands, uint32_t count, uint64_t *out_results, uint32_t *out_applied);
+
 /* === Debugger === */
 
 /**
@@ -4974,6 +6229,26 @@ int32_t goud_skeleton_set_bone_transform(struct GoudContextId context_id, uint64
  */
 int32_t goud_skeleton_play_clip(struct GoudContextId context_id, uint64_t entity_id, const uint8_t *clip_name_ptr, int32_t clip_name_len, bool looping);
 
+/**
+ * Adds a keyframe to a clip of the entity's `SkeletalAnimator`.
+ */
+int32_t goud_skeleton_add_keyframe(struct GoudContextId context_id, uint64_t entity_id, int32_t layer, int32_t bone_index, float time, float x, float y, float rotation, float scale_x, float scale_y);
+
+/**
+ * Adds a blend layer with an empty one-second clip to the entity's
+ */
+int32_t goud_skeleton_layer_add(struct GoudContextId context_id, uint64_t entity_id, const uint8_t *name_ptr, int32_t name_len, uint32_t blend_mode, bool looping);
+
+/**
+ * Sets the blend weight of a skeletal layer, clamped to `0.0..=1.0`.
+ */
+int32_t goud_skeleton_layer_set_weight(struct GoudContextId context_id, uint64_t entity_id, int32_t layer, float weight);
+
+/**
+ * Advances `count` skeletons by `dt` seconds and writes their bone palette.
+ */
+int32_t goud_skeleton_update_batch(struct GoudContextId context_id, const uint64_t *entity_ids, uint32_t count, float dt, float *out_palette, uint32_t palette_len, uint32_t *out_offsets);
+
 /**
  * Creates a new tween interpolating from `start` to `end` over
  */
@@ -5004,16 +6279,41 @@ int32_t goud_tween_reset(struct GoudContextId _context_id, int64_t handle);
  */
 int32_t goud_tween_destroy(struct GoudContextId _context_id, int64_t handle);
 
+/**
+ * Advances `count` tweens stored as parallel arrays by `dt` seconds.
+ */
+int32_t goud_tween_step_batch(const float *start, const float *end, const float *duration, float *elapsed, const uint8_t *easing, uint32_t count, float dt, float *out_values);
+
 /**
  * Resets the global frame arena, freeing all allocations at once.
  */
 int32_t goud_frame_arena_reset(void);
 
+/**
+ * Allocates `size` bytes aligned to `align` from the global frame arena.
+ */
+uint8_t *goud_frame_arena_alloc(size_t size, size_t align);
+
 /**
  * Retrieves diagnostic statistics for the global frame arena.
  */
 int32_t goud_frame_arena_stats(struct FfiArenaStats *out_stats);
 
+/**
+ * Resets a context's frame arena, freeing all its allocations at once.
+ */
+int32_t goud_context_frame_arena_reset(struct GoudContextId context_id);
+
+/**
+ * Allocates `size` bytes aligned to `align` from a context's frame arena.
+ */
+uint8_t *goud_context_frame_arena_alloc(struct GoudContextId context_id, size_t size, size_t align);
+
+/**
+ * Retrieves diagnostic statistics for a context's frame arena.
+ */
+int32_t goud_context_frame_arena_stats(struct GoudContextId context_id, struct FfiArenaStats *out_stats);
+
 /**
  * Returns the white color constant.
  */
@@ -5104,6 +6404,26 @@ int32_t goud_debug_set_fps_update_interval(struct GoudContextId context_id, floa
  */
 int32_t goud_debug_set_fps_overlay_corner(struct GoudContextId context_id, int32_t corner);
 
+/**
+ * Returns the buffer a context publishes its metrics into.
+ */
+const struct GoudMetricsBuffer *goud_metrics_buffer(struct GoudContextId context_id);
+
+/**
+ * Publishes a context's metrics into caller-provided storage instead.
+ */
+int32_t goud_metrics_attach_buffer(struct GoudContextId context_id, struct GoudMetricsBuffer *buffer);
+
+/**
+ * Gathers and publishes a context's metrics now.
+ */
+int32_t goud_metrics_publish(struct GoudContextId context_id);
+
+/**
+ * Copies the latest published block out of `buffer` without locking.
+ */
+int32_t goud_metrics_read(const struct GoudMetricsBuffer *buffer, struct GoudMetricsBlock *out_block);
+
 /**
  * Enables or disables diagnostic mode.
  */
@@ -5444,6 +6764,31 @@ bool goud_get_logical_size(struct GoudContextId context_id, uint32_t *width, uin
  */
 bool goud_get_framebuffer_size(struct GoudContextId context_id, uint32_t *width, uint32_t *height);
 
+/**
+ * Saves a context's entities and components into a new snapshot.
+ */
+int64_t goud_world_snapshot_save(struct GoudContextId context_id);
+
+/**
+ * Overwrites an existing snapshot with the context's current state.
+ */
+int32_t goud_world_snapshot_save_into(struct GoudContextId context_id, int64_t handle);
+
+/**
+ * Rolls a context's entities and components back to a snapshot.
+ */
+int32_t goud_world_snapshot_restore(struct GoudContextId context_id, int64_t handle);
+
+/**
+ * Frees a world snapshot.
+ */
+int32_t goud_world_snapshot_destroy(int64_t handle);
+
+/**
+ * Writes the counts describing a snapshot into `out_stats`.
+ */
+int32_t goud_world_snapshot_get_stats(int64_t handle, struct FfiWorldSnapshotStats *out_stats);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -85,6 +85,14 @@ func GoudAnimationControllerUpdate(context_id C.GoudContextId, entity_id uint64,
 	return int32(C.goud_animation_controller_update(context_id, C.uint64_t(entity_id), C.float(dt)))
 }
 
+// GoudAnimationEventsCopy wraps goud_animation_events_copy.
+func GoudAnimationEventsCopy(context_id C.GoudContextId, out_events *C.FfiAnimationEvent, capacity uint32) uint32 {
+	if out_events == nil {
+		return 0
+	}
+	return uint32(C.goud_animation_events_copy(context_id, out_events, C.uint32_t(capacity)))
+}
+
 // GoudAnimationEventsCount wraps goud_animation_events_count.
 func GoudAnimationEventsCount(context_id C.GoudContextId) int32 {
 	return int32(C.goud_animation_events_count(context_id))
@@ -194,6 +202,81 @@ func GoudAnimationStop(context_id C.GoudContextId, entity_id uint64) int32 {
 	return int32(C.goud_animation_stop(context_id, C.uint64_t(entity_id)))
 }
 
+// GoudAnimationUpdateBatch wraps goud_animation_update_batch.
+func GoudAnimationUpdateBatch(context_id C.GoudContextId, entity_ids *C.uint64_t, count uint32, dt float32, out_cmds *C.FfiSpriteCmd) int32 {
+	if entity_ids == nil {
+		return -1
+	}
+	if out_cmds == nil {
+		return -1
+	}
+	return int32(C.goud_animation_update_batch(context_id, entity_ids, C.uint32_t(count), C.float(dt), out_cmds))
+}
+
+// GoudAssetPackClose wraps goud_asset_pack_close.
+func GoudAssetPackClose(pack C.GoudAssetPackHandle) int32 {
+	return int32(C.goud_asset_pack_close(pack))
+}
+
+// GoudAssetPackEntryCount wraps goud_asset_pack_entry_count.
+func GoudAssetPackEntryCount(pack C.GoudAssetPackHandle) int64 {
+	return int64(C.goud_asset_pack_entry_count(pack))
+}
+
+// GoudAssetPackEntryData wraps goud_asset_pack_entry_data.
+func GoudAssetPackEntryData(pack C.GoudAssetPackHandle, name_hash uint64, out_data **C.uint8_t, out_len *C.size_t) int32 {
+	if out_data == nil {
+		return -1
+	}
+	if out_len == nil {
+		return -1
+	}
+	return int32(C.goud_asset_pack_entry_data(pack, C.uint64_t(name_hash), out_data, out_len))
+}
+
+// GoudAssetPackEntrySize wraps goud_asset_pack_entry_size.
+func GoudAssetPackEntrySize(pack C.GoudAssetPackHandle, name_hash uint64, out_size *C.uint64_t) int32 {
+	if out_size == nil {
+		return -1
+	}
+	return int32(C.goud_asset_pack_entry_size(pack, C.uint64_t(name_hash), out_size))
+}
+
+// GoudAssetPackHash wraps goud_asset_pack_hash.
+func GoudAssetPackHash(name *C.uint8_t, len uint) uint64 {
+	if name == nil {
+		return 0
+	}
+	return uint64(C.goud_asset_pack_hash(name, C.size_t(len)))
+}
+
+// GoudAssetPackOpen wraps goud_asset_pack_open.
+func GoudAssetPackOpen(path *C.char) C.GoudAssetPackHandle {
+	if path == nil {
+		return 0
+	}
+	return C.goud_asset_pack_open(path)
+}
+
+// GoudAssetPackOpenMemory wraps goud_asset_pack_open_memory.
+func GoudAssetPackOpenMemory(data *C.uint8_t, len uint) C.GoudAssetPackHandle {
+	if data == nil {
+		return 0
+	}
+	return C.goud_asset_pack_open_memory(data, C.size_t(len))
+}
+
+// GoudAssetPackRead wraps goud_asset_pack_read.
+func GoudAssetPackRead(pack C.GoudAssetPackHandle, name_hash uint64, out_buf *C.uint8_t, capacity uint, out_len *C.size_t) int32 {
+	if out_buf == nil {
+		return -1
+	}
+	if out_len == nil {
+		return -1
+	}
+	return int32(C.goud_asset_pack_read(pack, C.uint64_t(name_hash), out_buf, C.size_t(capacity), out_len))
+}
+
 // GoudAtlasAddFromFile wraps goud_atlas_add_from_file.
 func GoudAtlasAddFromFile(context_id C.GoudContextId, atlas C.GoudAtlasHandle, key *C.char, path *C.char) bool {
 	if key == nil {
@@ -286,6 +369,42 @@ func GoudAudioCleanupFinished(context_id C.GoudContextId) int32 {
 	return int32(C.goud_audio_cleanup_finished(context_id))
 }
 
+// GoudAudioClipCacheGetStats wraps goud_audio_clip_cache_get_stats.
+func GoudAudioClipCacheGetStats(context_id C.GoudContextId, out_stats *C.FfiAudioClipCacheStats) int32 {
+	if out_stats == nil {
+		return -1
+	}
+	return int32(C.goud_audio_clip_cache_get_stats(context_id, out_stats))
+}
+
+// GoudAudioClipCacheSetBudget wraps goud_audio_clip_cache_set_budget.
+func GoudAudioClipCacheSetBudget(context_id C.GoudContextId, budget_bytes uint64) int32 {
+	return int32(C.goud_audio_clip_cache_set_budget(context_id, C.uint64_t(budget_bytes)))
+}
+
+// GoudAudioClipLoad wraps goud_audio_clip_load.
+func GoudAudioClipLoad(context_id C.GoudContextId, asset_data *C.uint8_t, asset_len uint) int64 {
+	if asset_data == nil {
+		return -1
+	}
+	return int64(C.goud_audio_clip_load(context_id, asset_data, C.size_t(asset_len)))
+}
+
+// GoudAudioClipPlay wraps goud_audio_clip_play.
+func GoudAudioClipPlay(context_id C.GoudContextId, clip_id uint64, volume float32, speed float32, looping bool, channel uint8) int64 {
+	return int64(C.goud_audio_clip_play(context_id, C.uint64_t(clip_id), C.float(volume), C.float(speed), C._Bool(looping), C.uint8_t(channel)))
+}
+
+// GoudAudioClipPlaySpatial3d wraps goud_audio_clip_play_spatial_3d.
+func GoudAudioClipPlaySpatial3d(context_id C.GoudContextId, clip_id uint64, source_x float32, source_y float32, source_z float32, listener_x float32, listener_y float32, listener_z float32, max_distance float32, rolloff float32) int64 {
+	return int64(C.goud_audio_clip_play_spatial_3d(context_id, C.uint64_t(clip_id), C.float(source_x), C.float(source_y), C.float(source_z), C.float(listener_x), C.float(listener_y), C.float(listener_z), C.float(max_distance), C.float(rolloff)))
+}
+
+// GoudAudioClipUnload wraps goud_audio_clip_unload.
+func GoudAudioClipUnload(context_id C.GoudContextId, clip_id uint64) int32 {
+	return int32(C.goud_audio_clip_unload(context_id, C.uint64_t(clip_id)))
+}
+
 // GoudAudioCrossfade wraps goud_audio_crossfade.
 func GoudAudioCrossfade(context_id C.GoudContextId, from_player_id uint64, to_player_id uint64, mix float32) int32 {
 	return int32(C.goud_audio_crossfade(context_id, C.uint64_t(from_player_id), C.uint64_t(to_player_id), C.float(mix)))
@@ -335,6 +454,11 @@ func GoudAudioPlay(context_id C.GoudContextId, asset_data *C.uint8_t, asset_len
 	return int64(C.goud_audio_play(context_id, asset_data, C.size_t(asset_len)))
 }
 
+// GoudAudioPlayFromPack wraps goud_audio_play_from_pack.
+func GoudAudioPlayFromPack(context_id C.GoudContextId, pack C.GoudAssetPackHandle, name_hash uint64) int64 {
+	return int64(C.goud_audio_play_from_pack(context_id, pack, C.uint64_t(name_hash)))
+}
+
 // GoudAudioPlayOnChannel wraps goud_audio_play_on_channel.
 func GoudAudioPlayOnChannel(context_id C.GoudContextId, asset_data *C.uint8_t, asset_len uint, channel uint8) int64 {
 	if asset_data == nil {
@@ -422,11 +546,51 @@ func GoudAudioStopAll(context_id C.GoudContextId) int32 {
 	return int32(C.goud_audio_stop_all(context_id))
 }
 
+// GoudAudioStreamCrossfadeTo wraps goud_audio_stream_crossfade_to.
+func GoudAudioStreamCrossfadeTo(context_id C.GoudContextId, from_player_id uint64, path *C.char, duration_sec float32, looping bool, channel uint8) int64 {
+	if path == nil {
+		return -1
+	}
+	return int64(C.goud_audio_stream_crossfade_to(context_id, C.uint64_t(from_player_id), path, C.float(duration_sec), C._Bool(looping), C.uint8_t(channel)))
+}
+
+// GoudAudioStreamGetStats wraps goud_audio_stream_get_stats.
+func GoudAudioStreamGetStats(context_id C.GoudContextId, out_stats *C.FfiAudioStreamStats) int32 {
+	if out_stats == nil {
+		return -1
+	}
+	return int32(C.goud_audio_stream_get_stats(context_id, out_stats))
+}
+
+// GoudAudioStreamMixWith wraps goud_audio_stream_mix_with.
+func GoudAudioStreamMixWith(context_id C.GoudContextId, primary_player_id uint64, path *C.char, secondary_volume float32, looping bool, secondary_channel uint8) int64 {
+	if path == nil {
+		return -1
+	}
+	return int64(C.goud_audio_stream_mix_with(context_id, C.uint64_t(primary_player_id), path, C.float(secondary_volume), C._Bool(looping), C.uint8_t(secondary_channel)))
+}
+
+// GoudAudioStreamPlay wraps goud_audio_stream_play.
+func GoudAudioStreamPlay(context_id C.GoudContextId, path *C.char, volume float32, looping bool, channel uint8) int64 {
+	if path == nil {
+		return -1
+	}
+	return int64(C.goud_audio_stream_play(context_id, path, C.float(volume), C._Bool(looping), C.uint8_t(channel)))
+}
+
 // GoudAudioUpdateCrossfades wraps goud_audio_update_crossfades.
 func GoudAudioUpdateCrossfades(context_id C.GoudContextId, delta_sec float32) int32 {
 	return int32(C.goud_audio_update_crossfades(context_id, C.float(delta_sec)))
 }
 
+// GoudAudioUpdateSpatialSources wraps goud_audio_update_spatial_sources.
+func GoudAudioUpdateSpatialSources(context_id C.GoudContextId, listener_x float32, listener_y float32, listener_z float32, updates *C.FfiSpatialSourceUpdate, count uint32) int32 {
+	if updates == nil {
+		return -1
+	}
+	return int32(C.goud_audio_update_spatial_sources(context_id, C.float(listener_x), C.float(listener_y), C.float(listener_z), updates, C.uint32_t(count)))
+}
+
 // GoudAudioUpdateSpatialVolume wraps goud_audio_update_spatial_volume.
 func GoudAudioUpdateSpatialVolume(context_id C.GoudContextId, player_id uint64, source_x float32, source_y float32, listener_x float32, listener_y float32, max_distance float32, rolloff float32) int32 {
 	return int32(C.goud_audio_update_spatial_volume(context_id, C.uint64_t(player_id), C.float(source_x), C.float(source_y), C.float(listener_x), C.float(listener_y), C.float(max_distance), C.float(rolloff)))
@@ -669,11 +833,44 @@ func GoudContextDestroy(context_id C.GoudContextId) bool {
 	return bool(C.goud_context_destroy(context_id))
 }
 
+// GoudContextFrameArenaAlloc wraps goud_context_frame_arena_alloc.
+func GoudContextFrameArenaAlloc(context_id C.GoudContextId, size uint, align uint) *C.uint8_t {
+	return C.goud_context_frame_arena_alloc(context_id, C.size_t(size), C.size_t(align))
+}
+
+// GoudContextFrameArenaReset wraps goud_context_frame_arena_reset.
+func GoudContextFrameArenaReset(context_id C.GoudContextId) int32 {
+	return int32(C.goud_context_frame_arena_reset(context_id))
+}
+
+// GoudContextFrameArenaStats wraps goud_context_frame_arena_stats.
+func GoudContextFrameArenaStats(context_id C.GoudContextId, out_stats *C.FfiArenaStats) int32 {
+	if out_stats == nil {
+		return -1
+	}
+	return int32(C.goud_context_frame_arena_stats(context_id, out_stats))
+}
+
 // GoudContextIsValid wraps goud_context_is_valid.
 func GoudContextIsValid(context_id C.GoudContextId) bool {
 	return bool(C.goud_context_is_valid(context_id))
 }
 
+// GoudContextIsolateThread wraps goud_context_isolate_thread.
+func GoudContextIsolateThread() int32 {
+	return int32(C.goud_context_isolate_thread())
+}
+
+// GoudContextReleaseThread wraps goud_context_release_thread.
+func GoudContextReleaseThread() int32 {
+	return int32(C.goud_context_release_thread())
+}
+
+// GoudContextThreadIsIsolated wraps goud_context_thread_is_isolated.
+func GoudContextThreadIsIsolated() bool {
+	return bool(C.goud_context_thread_is_isolated())
+}
+
 // GoudDebugGetFpsStats wraps goud_debug_get_fps_stats.
 func GoudDebugGetFpsStats(context_id C.GoudContextId, out_stats *C.FpsStats) int32 {
 	if out_stats == nil {
@@ -971,6 +1168,14 @@ func GoudEntityDespawnBatch(context_id C.GoudContextId, entity_ids *C.uint64_t,
 	return uint32(C.goud_entity_despawn_batch(context_id, entity_ids, C.uint32_t(count)))
 }
 
+// GoudEntityInstantiate wraps goud_entity_instantiate.
+func GoudEntityInstantiate(context_id C.GoudContextId, template_id uint64, count uint32, out_entities *C.uint64_t) uint32 {
+	if out_entities == nil {
+		return 0
+	}
+	return uint32(C.goud_entity_instantiate(context_id, C.uint64_t(template_id), C.uint32_t(count), out_entities))
+}
+
 // GoudEntityIsAlive wraps goud_entity_is_alive.
 func GoudEntityIsAlive(context_id C.GoudContextId, entity_id uint64) bool {
 	return bool(C.goud_entity_is_alive(context_id, C.uint64_t(entity_id)))
@@ -1000,6 +1205,17 @@ func GoudEntityPoolAcquireBatch(handle uint32, count uint32, out_entities *C.uin
 	return uint32(C.goud_entity_pool_acquire_batch(C.uint32_t(handle), C.uint32_t(count), out_entities))
 }
 
+// GoudEntityPoolAcquireBatchSlots wraps goud_entity_pool_acquire_batch_slots.
+func GoudEntityPoolAcquireBatchSlots(handle uint32, count uint32, out_entities *C.uint64_t, out_slots *C.uint32_t) uint32 {
+	if out_entities == nil {
+		return 0
+	}
+	if out_slots == nil {
+		return 0
+	}
+	return uint32(C.goud_entity_pool_acquire_batch_slots(C.uint32_t(handle), C.uint32_t(count), out_entities, out_slots))
+}
+
 // GoudEntityPoolCreate wraps goud_entity_pool_create.
 func GoudEntityPoolCreate(capacity uint32) uint32 {
 	return uint32(C.goud_entity_pool_create(C.uint32_t(capacity)))
@@ -1100,6 +1316,24 @@ func GoudFontLoad(context_id C.GoudContextId, path *C.char) C.GoudFontHandle {
 	return C.goud_font_load(context_id, path)
 }
 
+// GoudFontLoadFromPack wraps goud_font_load_from_pack.
+func GoudFontLoadFromPack(context_id C.GoudContextId, pack C.GoudAssetPackHandle, name_hash uint64) C.GoudFontHandle {
+	return C.goud_font_load_from_pack(context_id, pack, C.uint64_t(name_hash))
+}
+
+// GoudFontLoadMemory wraps goud_font_load_memory.
+func GoudFontLoadMemory(context_id C.GoudContextId, data *C.uint8_t, len uint) C.GoudFontHandle {
+	if data == nil {
+		return 0
+	}
+	return C.goud_font_load_memory(context_id, data, C.size_t(len))
+}
+
+// GoudFrameArenaAlloc wraps goud_frame_arena_alloc.
+func GoudFrameArenaAlloc(size uint, align uint) *C.uint8_t {
+	return C.goud_frame_arena_alloc(C.size_t(size), C.size_t(align))
+}
+
 // GoudFrameArenaReset wraps goud_frame_arena_reset.
 func GoudFrameArenaReset() int32 {
 	return int32(C.goud_frame_arena_reset())
@@ -1113,6 +1347,31 @@ func GoudFrameArenaStats(out_stats *C.FfiArenaStats) int32 {
 	return int32(C.goud_frame_arena_stats(out_stats))
 }
 
+// GoudImageDecodeRgba8 wraps goud_image_decode_rgba8.
+func GoudImageDecodeRgba8(data *C.uint8_t, len uint, out_pixels *C.uint8_t, out_capacity uint) bool {
+	if data == nil {
+		return false
+	}
+	if out_pixels == nil {
+		return false
+	}
+	return bool(C.goud_image_decode_rgba8(data, C.size_t(len), out_pixels, C.size_t(out_capacity)))
+}
+
+// GoudImageGetSize wraps goud_image_get_size.
+func GoudImageGetSize(data *C.uint8_t, len uint, out_width *C.uint32_t, out_height *C.uint32_t) bool {
+	if data == nil {
+		return false
+	}
+	if out_width == nil {
+		return false
+	}
+	if out_height == nil {
+		return false
+	}
+	return bool(C.goud_image_get_size(data, C.size_t(len), out_width, out_height))
+}
+
 // GoudInputActionJustPressed wraps goud_input_action_just_pressed.
 func GoudInputActionJustPressed(context_id C.GoudContextId, action_name *C.char) bool {
 	if action_name == nil {
@@ -1137,6 +1396,14 @@ func GoudInputActionPressed(context_id C.GoudContextId, action_name *C.char) boo
 	return bool(C.goud_input_action_pressed(context_id, action_name))
 }
 
+// GoudInputCaptureSnapshot wraps goud_input_capture_snapshot.
+func GoudInputCaptureSnapshot(context_id C.GoudContextId, out_snapshot *C.FfiInputSnapshot) bool {
+	if out_snapshot == nil {
+		return false
+	}
+	return bool(C.goud_input_capture_snapshot(context_id, out_snapshot))
+}
+
 // GoudInputGamepadAxis wraps goud_input_gamepad_axis.
 func GoudInputGamepadAxis(context_id C.GoudContextId, gamepad_id uint32, axis uint32) float32 {
 	return float32(C.goud_input_gamepad_axis(context_id, C.uint32_t(gamepad_id), C.uint32_t(axis)))
@@ -1346,6 +1613,35 @@ func GoudLastErrorSubsystem(buf *C.uint8_t, buf_len uint) int32 {
 	return int32(C.goud_last_error_subsystem(buf, C.size_t(buf_len)))
 }
 
+// GoudMetricsAttachBuffer wraps goud_metrics_attach_buffer.
+func GoudMetricsAttachBuffer(context_id C.GoudContextId, buffer *C.GoudMetricsBuffer) int32 {
+	if buffer == nil {
+		return -1
+	}
+	return int32(C.goud_metrics_attach_buffer(context_id, buffer))
+}
+
+// GoudMetricsBuffer wraps goud_metrics_buffer.
+func GoudMetricsBuffer(context_id C.GoudContextId) *C.GoudMetricsBuffer {
+	return C.goud_metrics_buffer(context_id)
+}
+
+// GoudMetricsPublish wraps goud_metrics_publish.
+func GoudMetricsPublish(context_id C.GoudContextId) int32 {
+	return int32(C.goud_metrics_publish(context_id))
+}
+
+// GoudMetricsRead wraps goud_metrics_read.
+func GoudMetricsRead(buffer *C.GoudMetricsBuffer, out_block *C.GoudMetricsBlock) int32 {
+	if buffer == nil {
+		return -1
+	}
+	if out_block == nil {
+		return -1
+	}
+	return int32(C.goud_metrics_read(buffer, out_block))
+}
+
 // GoudNetworkClearOverlayHandle wraps goud_network_clear_overlay_handle.
 func GoudNetworkClearOverlayHandle(context_id C.GoudContextId) int32 {
 	return int32(C.goud_network_clear_overlay_handle(context_id))
@@ -1413,6 +1709,17 @@ func GoudNetworkHost(context_id C.GoudContextId, protocol int32, port uint16) in
 	return int64(C.goud_network_host(context_id, C.int32_t(protocol), C.uint16_t(port)))
 }
 
+// GoudNetworkPeekSize wraps goud_network_peek_size.
+func GoudNetworkPeekSize(_context_id C.GoudContextId, handle int64, out_peer_id *C.uint64_t, out_len *C.uint32_t) int32 {
+	if out_peer_id == nil {
+		return -1
+	}
+	if out_len == nil {
+		return -1
+	}
+	return int32(C.goud_network_peek_size(_context_id, C.int64_t(handle), out_peer_id, out_len))
+}
+
 // GoudNetworkPeerCount wraps goud_network_peer_count.
 func GoudNetworkPeerCount(_context_id C.GoudContextId, handle int64) int32 {
 	return int32(C.goud_network_peer_count(_context_id, C.int64_t(handle)))
@@ -1434,6 +1741,20 @@ func GoudNetworkReceive(_context_id C.GoudContextId, handle int64, out_buf *C.ui
 	return int32(C.goud_network_receive(_context_id, C.int64_t(handle), out_buf, C.int32_t(buf_len), out_peer_id))
 }
 
+// GoudNetworkReceiveMany wraps goud_network_receive_many.
+func GoudNetworkReceiveMany(_context_id C.GoudContextId, handle int64, out_buf *C.uint8_t, buf_len uint32, out_messages *C.FfiNetworkMessage, max_messages uint32, out_count *C.uint32_t) int32 {
+	if out_buf == nil {
+		return -1
+	}
+	if out_messages == nil {
+		return -1
+	}
+	if out_count == nil {
+		return -1
+	}
+	return int32(C.goud_network_receive_many(_context_id, C.int64_t(handle), out_buf, C.uint32_t(buf_len), out_messages, C.uint32_t(max_messages), out_count))
+}
+
 // GoudNetworkSend wraps goud_network_send.
 func GoudNetworkSend(_context_id C.GoudContextId, handle int64, peer_id uint64, data_ptr *C.uint8_t, data_len int32, channel uint8) int32 {
 	if data_ptr == nil {
@@ -1480,6 +1801,44 @@ func GoudP2pLeaveMesh(_context_id C.GoudContextId, handle int64) int32 {
 	return int32(C.goud_p2p_leave_mesh(_context_id, C.int64_t(handle)))
 }
 
+// GoudParticleEmitterBurst wraps goud_particle_emitter_burst.
+func GoudParticleEmitterBurst(context_id C.GoudContextId, emitter C.GoudParticleEmitterHandle, count uint32) uint32 {
+	return uint32(C.goud_particle_emitter_burst(context_id, emitter, C.uint32_t(count)))
+}
+
+// GoudParticleEmitterCreate wraps goud_particle_emitter_create.
+func GoudParticleEmitterCreate(context_id C.GoudContextId, config *C.FfiParticleEmitterConfig) C.GoudParticleEmitterHandle {
+	if config == nil {
+		return 0
+	}
+	return C.goud_particle_emitter_create(context_id, config)
+}
+
+// GoudParticleEmitterDestroy wraps goud_particle_emitter_destroy.
+func GoudParticleEmitterDestroy(context_id C.GoudContextId, emitter C.GoudParticleEmitterHandle) bool {
+	return bool(C.goud_particle_emitter_destroy(context_id, emitter))
+}
+
+// GoudParticleEmitterDraw wraps goud_particle_emitter_draw.
+func GoudParticleEmitterDraw(context_id C.GoudContextId, emitter C.GoudParticleEmitterHandle, offset_x float32, offset_y float32) uint32 {
+	return uint32(C.goud_particle_emitter_draw(context_id, emitter, C.float(offset_x), C.float(offset_y)))
+}
+
+// GoudParticleEmitterSetPosition wraps goud_particle_emitter_set_position.
+func GoudParticleEmitterSetPosition(context_id C.GoudContextId, emitter C.GoudParticleEmitterHandle, x float32, y float32) bool {
+	return bool(C.goud_particle_emitter_set_position(context_id, emitter, C.float(x), C.float(y)))
+}
+
+// GoudParticleEmitterSetRate wraps goud_particle_emitter_set_rate.
+func GoudParticleEmitterSetRate(context_id C.GoudContextId, emitter C.GoudParticleEmitterHandle, rate float32) int32 {
+	return int32(C.goud_particle_emitter_set_rate(context_id, emitter, C.float(rate)))
+}
+
+// GoudParticlesUpdate wraps goud_particles_update.
+func GoudParticlesUpdate(context_id C.GoudContextId, delta_time float32) uint32 {
+	return uint32(C.goud_particles_update(context_id, C.float(delta_time)))
+}
+
 // GoudPhysics3dAddCollider wraps goud_physics3d_add_collider.
 func GoudPhysics3dAddCollider(ctx C.GoudContextId, body_handle uint64, shape_type uint32, hx float32, hy float32, hz float32, radius float32, friction float32, restitution float32) int64 {
 	return int64(C.goud_physics3d_add_collider(ctx, C.uint64_t(body_handle), C.uint32_t(shape_type), C.float(hx), C.float(hy), C.float(hz), C.float(radius), C.float(friction), C.float(restitution)))
@@ -1720,6 +2079,14 @@ func GoudPhysicsCollisionEventRead(ctx C.GoudContextId, index uint32, out_body_a
 	return int32(C.goud_physics_collision_event_read(ctx, C.uint32_t(index), out_body_a, out_body_b, out_kind))
 }
 
+// GoudPhysicsCollisionEventsCopy wraps goud_physics_collision_events_copy.
+func GoudPhysicsCollisionEventsCopy(ctx C.GoudContextId, layer_mask uint32, out_events *C.FfiCollisionEvent, capacity uint32) uint32 {
+	if out_events == nil {
+		return 0
+	}
+	return uint32(C.goud_physics_collision_events_copy(ctx, C.uint32_t(layer_mask), out_events, C.uint32_t(capacity)))
+}
+
 // GoudPhysicsCollisionEventsCount wraps goud_physics_collision_events_count.
 func GoudPhysicsCollisionEventsCount(ctx C.GoudContextId) int32 {
 	return int32(C.goud_physics_collision_events_count(ctx))
@@ -1759,6 +2126,28 @@ func GoudPhysicsDestroy(ctx C.GoudContextId) int32 {
 	return int32(C.goud_physics_destroy(ctx))
 }
 
+// GoudPhysicsFreeState wraps goud_physics_free_state.
+func GoudPhysicsFreeState(state int64) int32 {
+	return int32(C.goud_physics_free_state(C.int64_t(state)))
+}
+
+// GoudPhysicsGetBodies wraps goud_physics_get_bodies.
+func GoudPhysicsGetBodies(ctx C.GoudContextId, handles *C.uint64_t, count uint32, out_positions *C.FfiVec2, out_velocities *C.FfiVec2, out_rotations *C.float) uint32 {
+	if handles == nil {
+		return 0
+	}
+	if out_positions == nil {
+		return 0
+	}
+	if out_velocities == nil {
+		return 0
+	}
+	if out_rotations == nil {
+		return 0
+	}
+	return uint32(C.goud_physics_get_bodies(ctx, handles, C.uint32_t(count), out_positions, out_velocities, out_rotations))
+}
+
 // GoudPhysicsGetBodyGravityScale wraps goud_physics_get_body_gravity_scale.
 func GoudPhysicsGetBodyGravityScale(ctx C.GoudContextId, handle uint64, out_scale *C.float) int32 {
 	if out_scale == nil {
@@ -1824,6 +2213,22 @@ func GoudPhysicsGetVelocity(ctx C.GoudContextId, handle uint64, out_x *C.float,
 	return int32(C.goud_physics_get_velocity(ctx, C.uint64_t(handle), out_x, out_y))
 }
 
+// GoudPhysicsLoadState wraps goud_physics_load_state.
+func GoudPhysicsLoadState(ctx C.GoudContextId, state int64) int32 {
+	return int32(C.goud_physics_load_state(ctx, C.int64_t(state)))
+}
+
+// GoudPhysicsOverlapRectBatch wraps goud_physics_overlap_rect_batch.
+func GoudPhysicsOverlapRectBatch(ctx C.GoudContextId, rects *C.FfiRect, count uint32, layer_mask uint32, out_bodies *C.uint64_t) uint32 {
+	if rects == nil {
+		return 0
+	}
+	if out_bodies == nil {
+		return 0
+	}
+	return uint32(C.goud_physics_overlap_rect_batch(ctx, rects, C.uint32_t(count), C.uint32_t(layer_mask), out_bodies))
+}
+
 // GoudPhysicsRaycast wraps goud_physics_raycast.
 func GoudPhysicsRaycast(ctx C.GoudContextId, ox float32, oy float32, dx float32, dy float32, max_dist float32, out_hit_x *C.float, out_hit_y *C.float) int32 {
 	if out_hit_x == nil {
@@ -1835,6 +2240,17 @@ func GoudPhysicsRaycast(ctx C.GoudContextId, ox float32, oy float32, dx float32,
 	return int32(C.goud_physics_raycast(ctx, C.float(ox), C.float(oy), C.float(dx), C.float(dy), C.float(max_dist), out_hit_x, out_hit_y))
 }
 
+// GoudPhysicsRaycastBatch wraps goud_physics_raycast_batch.
+func GoudPhysicsRaycastBatch(ctx C.GoudContextId, rays *C.FfiRay, count uint32, layer_mask uint32, out_hits *C.FfiRaycastHit) uint32 {
+	if rays == nil {
+		return 0
+	}
+	if out_hits == nil {
+		return 0
+	}
+	return uint32(C.goud_physics_raycast_batch(ctx, rays, C.uint32_t(count), C.uint32_t(layer_mask), out_hits))
+}
+
 // GoudPhysicsRaycastEx wraps goud_physics_raycast_ex.
 func GoudPhysicsRaycastEx(ctx C.GoudContextId, ox float32, oy float32, dx float32, dy float32, max_dist float32, layer_mask uint32, out_body_handle *C.uint64_t, out_collider_handle *C.uint64_t, out_hit_x *C.float, out_hit_y *C.float, out_normal_x *C.float, out_normal_y *C.float, out_distance *C.float) int32 {
 	if out_body_handle == nil {
@@ -1871,6 +2287,16 @@ func GoudPhysicsRemoveJoint(ctx C.GoudContextId, handle uint64) int32 {
 	return int32(C.goud_physics_remove_joint(ctx, C.uint64_t(handle)))
 }
 
+// GoudPhysicsSaveState wraps goud_physics_save_state.
+func GoudPhysicsSaveState(ctx C.GoudContextId) int64 {
+	return int64(C.goud_physics_save_state(ctx))
+}
+
+// GoudPhysicsSaveStateInto wraps goud_physics_save_state_into.
+func GoudPhysicsSaveStateInto(ctx C.GoudContextId, state int64) int32 {
+	return int32(C.goud_physics_save_state_into(ctx, C.int64_t(state)))
+}
+
 // GoudPhysicsSetBodyGravityScale wraps goud_physics_set_body_gravity_scale.
 func GoudPhysicsSetBodyGravityScale(ctx C.GoudContextId, handle uint64, scale float32) int32 {
 	return int32(C.goud_physics_set_body_gravity_scale(ctx, C.uint64_t(handle), C.float(scale)))
@@ -1886,6 +2312,11 @@ func GoudPhysicsSetColliderRestitution(ctx C.GoudContextId, handle uint64, resti
 	return int32(C.goud_physics_set_collider_restitution(ctx, C.uint64_t(handle), C.float(restitution)))
 }
 
+// GoudPhysicsSetDeterministic wraps goud_physics_set_deterministic.
+func GoudPhysicsSetDeterministic(ctx C.GoudContextId, enabled bool) int32 {
+	return int32(C.goud_physics_set_deterministic(ctx, C._Bool(enabled)))
+}
+
 // GoudPhysicsSetGravity wraps goud_physics_set_gravity.
 func GoudPhysicsSetGravity(ctx C.GoudContextId, x float32, y float32) int32 {
 	return int32(C.goud_physics_set_gravity(ctx, C.float(x), C.float(y)))
@@ -1896,6 +2327,17 @@ func GoudPhysicsSetTimestep(ctx C.GoudContextId, dt float32) int32 {
 	return int32(C.goud_physics_set_timestep(ctx, C.float(dt)))
 }
 
+// GoudPhysicsSetVelocities wraps goud_physics_set_velocities.
+func GoudPhysicsSetVelocities(ctx C.GoudContextId, handles *C.uint64_t, count uint32, velocities *C.FfiVec2) uint32 {
+	if handles == nil {
+		return 0
+	}
+	if velocities == nil {
+		return 0
+	}
+	return uint32(C.goud_physics_set_velocities(ctx, handles, C.uint32_t(count), velocities))
+}
+
 // GoudPhysicsSetVelocity wraps goud_physics_set_velocity.
 func GoudPhysicsSetVelocity(ctx C.GoudContextId, handle uint64, vx float32, vy float32) int32 {
 	return int32(C.goud_physics_set_velocity(ctx, C.uint64_t(handle), C.float(vx), C.float(vy)))
@@ -2979,6 +3421,36 @@ func GoudSceneLoad(context_id C.GoudContextId, name_ptr *C.uint8_t, name_len uin
 	return uint32(C.goud_scene_load(context_id, name_ptr, C.uint32_t(name_len), json_ptr, C.uint32_t(json_len)))
 }
 
+// GoudSceneLoadFromPack wraps goud_scene_load_from_pack.
+func GoudSceneLoadFromPack(context_id C.GoudContextId, pack C.GoudAssetPackHandle, name_hash uint64, name_ptr *C.uint8_t, name_len uint32) uint32 {
+	if name_ptr == nil {
+		return 0
+	}
+	return uint32(C.goud_scene_load_from_pack(context_id, pack, C.uint64_t(name_hash), name_ptr, C.uint32_t(name_len)))
+}
+
+// GoudSceneLoadPacked wraps goud_scene_load_packed.
+func GoudSceneLoadPacked(context_id C.GoudContextId, name_ptr *C.uint8_t, name_len uint32, data_ptr *C.uint8_t, data_len uint32) uint32 {
+	if name_ptr == nil {
+		return 0
+	}
+	if data_ptr == nil {
+		return 0
+	}
+	return uint32(C.goud_scene_load_packed(context_id, name_ptr, C.uint32_t(name_len), data_ptr, C.uint32_t(data_len)))
+}
+
+// GoudScenePackJson wraps goud_scene_pack_json.
+func GoudScenePackJson(json_ptr *C.uint8_t, json_len uint32, buf *C.uint8_t, buf_len uint) int32 {
+	if json_ptr == nil {
+		return -1
+	}
+	if buf == nil {
+		return -1
+	}
+	return int32(C.goud_scene_pack_json(json_ptr, C.uint32_t(json_len), buf, C.size_t(buf_len)))
+}
+
 // GoudSceneSetActive wraps goud_scene_set_active.
 func GoudSceneSetActive(context_id C.GoudContextId, scene_id uint32, active bool) C.GoudResult {
 	return C.goud_scene_set_active(context_id, C.uint32_t(scene_id), C._Bool(active))
@@ -2989,6 +3461,32 @@ func GoudSceneSetCurrent(context_id C.GoudContextId, scene_id uint32) C.GoudResu
 	return C.goud_scene_set_current(context_id, C.uint32_t(scene_id))
 }
 
+// GoudSceneStreamBegin wraps goud_scene_stream_begin.
+func GoudSceneStreamBegin(context_id C.GoudContextId, name_ptr *C.uint8_t, name_len uint32, data_ptr *C.uint8_t, data_len uint32) uint32 {
+	if name_ptr == nil {
+		return 0
+	}
+	if data_ptr == nil {
+		return 0
+	}
+	return uint32(C.goud_scene_stream_begin(context_id, name_ptr, C.uint32_t(name_len), data_ptr, C.uint32_t(data_len)))
+}
+
+// GoudSceneStreamCancel wraps goud_scene_stream_cancel.
+func GoudSceneStreamCancel(context_id C.GoudContextId, scene_id uint32) C.GoudResult {
+	return C.goud_scene_stream_cancel(context_id, C.uint32_t(scene_id))
+}
+
+// GoudSceneStreamProgress wraps goud_scene_stream_progress.
+func GoudSceneStreamProgress(context_id C.GoudContextId, scene_id uint32) float32 {
+	return float32(C.goud_scene_stream_progress(context_id, C.uint32_t(scene_id)))
+}
+
+// GoudSceneStreamStep wraps goud_scene_stream_step.
+func GoudSceneStreamStep(context_id C.GoudContextId, scene_id uint32, budget_us uint32) float32 {
+	return float32(C.goud_scene_stream_step(context_id, C.uint32_t(scene_id), C.uint32_t(budget_us)))
+}
+
 // GoudSceneTransitionIsActive wraps goud_scene_transition_is_active.
 func GoudSceneTransitionIsActive(context_id C.GoudContextId) bool {
 	return bool(C.goud_scene_transition_is_active(context_id))
@@ -3025,11 +3523,29 @@ func GoudSkeletonAddBone(context_id C.GoudContextId, entity_id uint64, bone_name
 	return int32(C.goud_skeleton_add_bone(context_id, C.uint64_t(entity_id), bone_name_ptr, C.int32_t(bone_name_len), C.int32_t(parent_index), C.float(x), C.float(y), C.float(rotation)))
 }
 
+// GoudSkeletonAddKeyframe wraps goud_skeleton_add_keyframe.
+func GoudSkeletonAddKeyframe(context_id C.GoudContextId, entity_id uint64, layer int32, bone_index int32, time float32, x float32, y float32, rotation float32, scale_x float32, scale_y float32) int32 {
+	return int32(C.goud_skeleton_add_keyframe(context_id, C.uint64_t(entity_id), C.int32_t(layer), C.int32_t(bone_index), C.float(time), C.float(x), C.float(y), C.float(rotation), C.float(scale_x), C.float(scale_y)))
+}
+
 // GoudSkeletonCreate wraps goud_skeleton_create.
 func GoudSkeletonCreate(context_id C.GoudContextId, entity_id uint64) int32 {
 	return int32(C.goud_skeleton_create(context_id, C.uint64_t(entity_id)))
 }
 
+// GoudSkeletonLayerAdd wraps goud_skeleton_layer_add.
+func GoudSkeletonLayerAdd(context_id C.GoudContextId, entity_id uint64, name_ptr *C.uint8_t, name_len int32, blend_mode uint32, looping bool) int32 {
+	if name_ptr == nil {
+		return -1
+	}
+	return int32(C.goud_skeleton_layer_add(context_id, C.uint64_t(entity_id), name_ptr, C.int32_t(name_len), C.uint32_t(blend_mode), C._Bool(looping)))
+}
+
+// GoudSkeletonLayerSetWeight wraps goud_skeleton_layer_set_weight.
+func GoudSkeletonLayerSetWeight(context_id C.GoudContextId, entity_id uint64, layer int32, weight float32) int32 {
+	return int32(C.goud_skeleton_layer_set_weight(context_id, C.uint64_t(entity_id), C.int32_t(layer), C.float(weight)))
+}
+
 // GoudSkeletonPlayClip wraps goud_skeleton_play_clip.
 func GoudSkeletonPlayClip(context_id C.GoudContextId, entity_id uint64, clip_name_ptr *C.uint8_t, clip_name_len int32, looping bool) int32 {
 	if clip_name_ptr == nil {
@@ -3043,6 +3559,20 @@ func GoudSkeletonSetBoneTransform(context_id C.GoudContextId, entity_id uint64,
 	return int32(C.goud_skeleton_set_bone_transform(context_id, C.uint64_t(entity_id), C.int32_t(bone_index), C.float(x), C.float(y), C.float(rotation)))
 }
 
+// GoudSkeletonUpdateBatch wraps goud_skeleton_update_batch.
+func GoudSkeletonUpdateBatch(context_id C.GoudContextId, entity_ids *C.uint64_t, count uint32, dt float32, out_palette *C.float, palette_len uint32, out_offsets *C.uint32_t) int32 {
+	if entity_ids == nil {
+		return -1
+	}
+	if out_palette == nil {
+		return -1
+	}
+	if out_offsets == nil {
+		return -1
+	}
+	return int32(C.goud_skeleton_update_batch(context_id, entity_ids, C.uint32_t(count), C.float(dt), out_palette, C.uint32_t(palette_len), out_offsets))
+}
+
 // GoudSpatialGridClear wraps goud_spatial_grid_clear.
 func GoudSpatialGridClear(handle uint32) int32 {
 	return int32(C.goud_spatial_grid_clear(C.uint32_t(handle)))
@@ -3541,6 +4071,32 @@ func GoudSpriteWithZLayer(sprite C.FfiSprite, z_layer int32) C.FfiSprite {
 	return C.goud_sprite_with_z_layer(sprite, C.int32_t(z_layer))
 }
 
+// GoudStaticLayerCreate wraps goud_static_layer_create.
+func GoudStaticLayerCreate(context_id C.GoudContextId, cmds *C.FfiSpriteCmd, count uint32) C.GoudStaticLayerHandle {
+	if cmds == nil {
+		return 0
+	}
+	return C.goud_static_layer_create(context_id, cmds, C.uint32_t(count))
+}
+
+// GoudStaticLayerDestroy wraps goud_static_layer_destroy.
+func GoudStaticLayerDestroy(context_id C.GoudContextId, layer C.GoudStaticLayerHandle) bool {
+	return bool(C.goud_static_layer_destroy(context_id, layer))
+}
+
+// GoudStaticLayerDraw wraps goud_static_layer_draw.
+func GoudStaticLayerDraw(context_id C.GoudContextId, layer C.GoudStaticLayerHandle, offset_x float32, offset_y float32) uint32 {
+	return uint32(C.goud_static_layer_draw(context_id, layer, C.float(offset_x), C.float(offset_y)))
+}
+
+// GoudStaticLayerUpdate wraps goud_static_layer_update.
+func GoudStaticLayerUpdate(context_id C.GoudContextId, layer C.GoudStaticLayerHandle, first uint32, cmds *C.FfiSpriteCmd, count uint32) int32 {
+	if cmds == nil {
+		return -1
+	}
+	return int32(C.goud_static_layer_update(context_id, layer, C.uint32_t(first), cmds, C.uint32_t(count)))
+}
+
 // GoudTextClearMaxWidth wraps goud_text_clear_max_width.
 func GoudTextClearMaxWidth(text *C.FfiText) {
 	if text == nil {
@@ -3626,6 +4182,24 @@ func GoudTextHasMaxWidth(text *C.FfiText) bool {
 	return bool(C.goud_text_has_max_width(text))
 }
 
+// GoudTextLayoutCacheClear wraps goud_text_layout_cache_clear.
+func GoudTextLayoutCacheClear(context_id C.GoudContextId) bool {
+	return bool(C.goud_text_layout_cache_clear(context_id))
+}
+
+// GoudTextLayoutCacheGetStats wraps goud_text_layout_cache_get_stats.
+func GoudTextLayoutCacheGetStats(context_id C.GoudContextId, out_stats *C.FfiTextLayoutCacheStats) bool {
+	if out_stats == nil {
+		return false
+	}
+	return bool(C.goud_text_layout_cache_get_stats(context_id, out_stats))
+}
+
+// GoudTextLayoutCacheSetBudget wraps goud_text_layout_cache_set_budget.
+func GoudTextLayoutCacheSetBudget(context_id C.GoudContextId, budget_bytes uint64) bool {
+	return bool(C.goud_text_layout_cache_set_budget(context_id, C.uint64_t(budget_bytes)))
+}
+
 // GoudTextNew wraps goud_text_new.
 func GoudTextNew(font_handle uint64) C.FfiText {
 	return C.goud_text_new(C.uint64_t(font_handle))
@@ -3671,6 +4245,14 @@ func GoudTextSetMaxWidth(text *C.FfiText, width float32) {
 	C.goud_text_set_max_width(text, C.float(width))
 }
 
+// GoudTextureCreateRgba8 wraps goud_texture_create_rgba8.
+func GoudTextureCreateRgba8(context_id C.GoudContextId, pixels *C.uint8_t, width uint32, height uint32) C.GoudTextureHandle {
+	if pixels == nil {
+		return 0
+	}
+	return C.goud_texture_create_rgba8(context_id, pixels, C.uint32_t(width), C.uint32_t(height))
+}
+
 // GoudTextureDestroy wraps goud_texture_destroy.
 func GoudTextureDestroy(context_id C.GoudContextId, texture C.GoudTextureHandle) bool {
 	return bool(C.goud_texture_destroy(context_id, texture))
@@ -3684,6 +4266,68 @@ func GoudTextureLoad(context_id C.GoudContextId, path *C.char) C.GoudTextureHand
 	return C.goud_texture_load(context_id, path)
 }
 
+// GoudTextureLoadFromPack wraps goud_texture_load_from_pack.
+func GoudTextureLoadFromPack(context_id C.GoudContextId, pack C.GoudAssetPackHandle, name_hash uint64) C.GoudTextureHandle {
+	return C.goud_texture_load_from_pack(context_id, pack, C.uint64_t(name_hash))
+}
+
+// GoudTextureStreamLoad wraps goud_texture_stream_load.
+func GoudTextureStreamLoad(context_id C.GoudContextId, path *C.char) C.GoudTextureHandle {
+	if path == nil {
+		return 0
+	}
+	return C.goud_texture_stream_load(context_id, path)
+}
+
+// GoudTextureStreamLoadFromPack wraps goud_texture_stream_load_from_pack.
+func GoudTextureStreamLoadFromPack(context_id C.GoudContextId, pack C.GoudAssetPackHandle, name_hash uint64) C.GoudTextureHandle {
+	return C.goud_texture_stream_load_from_pack(context_id, pack, C.uint64_t(name_hash))
+}
+
+// GoudTextureStreamLoadMemory wraps goud_texture_stream_load_memory.
+func GoudTextureStreamLoadMemory(context_id C.GoudContextId, data *C.uint8_t, len uint) C.GoudTextureHandle {
+	if data == nil {
+		return 0
+	}
+	return C.goud_texture_stream_load_memory(context_id, data, C.size_t(len))
+}
+
+// GoudTextureStreamingGetStats wraps goud_texture_streaming_get_stats.
+func GoudTextureStreamingGetStats(context_id C.GoudContextId, out_stats *C.FfiTextureStreamingStats) bool {
+	if out_stats == nil {
+		return false
+	}
+	return bool(C.goud_texture_streaming_get_stats(context_id, out_stats))
+}
+
+// GoudTextureStreamingSetBudget wraps goud_texture_streaming_set_budget.
+func GoudTextureStreamingSetBudget(context_id C.GoudContextId, budget_bytes uint64) bool {
+	return bool(C.goud_texture_streaming_set_budget(context_id, C.uint64_t(budget_bytes)))
+}
+
+// GoudTilemapCreate wraps goud_tilemap_create.
+func GoudTilemapCreate(context_id C.GoudContextId, tileset C.GoudTextureHandle, columns uint32, rows uint32, tile_width uint32, tile_height uint32, chunk_size uint32) C.GoudTilemapHandle {
+	return C.goud_tilemap_create(context_id, tileset, C.uint32_t(columns), C.uint32_t(rows), C.uint32_t(tile_width), C.uint32_t(tile_height), C.uint32_t(chunk_size))
+}
+
+// GoudTilemapDestroy wraps goud_tilemap_destroy.
+func GoudTilemapDestroy(context_id C.GoudContextId, tilemap C.GoudTilemapHandle) bool {
+	return bool(C.goud_tilemap_destroy(context_id, tilemap))
+}
+
+// GoudTilemapDraw wraps goud_tilemap_draw.
+func GoudTilemapDraw(context_id C.GoudContextId, tilemap C.GoudTilemapHandle, offset_x float32, offset_y float32) uint32 {
+	return uint32(C.goud_tilemap_draw(context_id, tilemap, C.float(offset_x), C.float(offset_y)))
+}
+
+// GoudTilemapSetTiles wraps goud_tilemap_set_tiles.
+func GoudTilemapSetTiles(context_id C.GoudContextId, tilemap C.GoudTilemapHandle, x uint32, y uint32, width uint32, height uint32, tiles *C.uint32_t) int32 {
+	if tiles == nil {
+		return -1
+	}
+	return int32(C.goud_tilemap_set_tiles(context_id, tilemap, C.uint32_t(x), C.uint32_t(y), C.uint32_t(width), C.uint32_t(height), tiles))
+}
+
 // GoudTransform2dBackward wraps goud_transform2d_backward.
 func GoudTransform2dBackward(transform *C.FfiTransform2D) C.FfiVec2 {
 	if transform == nil {
@@ -4057,6 +4701,29 @@ func GoudTweenReset(_context_id C.GoudContextId, handle int64) int32 {
 	return int32(C.goud_tween_reset(_context_id, C.int64_t(handle)))
 }
 
+// GoudTweenStepBatch wraps goud_tween_step_batch.
+func GoudTweenStepBatch(start *C.float, end *C.float, duration *C.float, elapsed *C.float, easing *C.uint8_t, count uint32, dt float32, out_values *C.float) int32 {
+	if start == nil {
+		return -1
+	}
+	if end == nil {
+		return -1
+	}
+	if duration == nil {
+		return -1
+	}
+	if elapsed == nil {
+		return -1
+	}
+	if easing == nil {
+		return -1
+	}
+	if out_values == nil {
+		return -1
+	}
+	return int32(C.goud_tween_step_batch(start, end, duration, elapsed, easing, C.uint32_t(count), C.float(dt), out_values))
+}
+
 // GoudTweenUpdate wraps goud_tween_update.
 func GoudTweenUpdate(_context_id C.GoudContextId, handle int64, dt float32) int32 {
 	return int32(C.goud_tween_update(_context_id, C.int64_t(handle), C.float(dt)))
@@ -4070,6 +4737,23 @@ func GoudTweenValue(_context_id C.GoudContextId, handle int64, out_value *C.floa
 	return int32(C.goud_tween_value(_context_id, C.int64_t(handle), out_value))
 }
 
+// GoudUiApplyCommands wraps goud_ui_apply_commands.
+func GoudUiApplyCommands(mgr *C.UiManager, commands *C.FfiUiCommand, count uint32, out_results *C.uint64_t, out_applied *C.uint32_t) int32 {
+	if mgr == nil {
+		return -1
+	}
+	if commands == nil {
+		return -1
+	}
+	if out_results == nil {
+		return -1
+	}
+	if out_applied == nil {
+		return -1
+	}
+	return int32(C.goud_ui_apply_commands(mgr, commands, C.uint32_t(count), out_results, out_applied))
+}
+
 // GoudUiCreateNode wraps goud_ui_create_node.
 func GoudUiCreateNode(mgr *C.UiManager, component_type int32) uint64 {
 	if mgr == nil {
@@ -4097,6 +4781,17 @@ func GoudUiEventRead(mgr *C.UiManager, index uint32, out_event *C.FfiUiEvent) in
 	return int32(C.goud_ui_event_read(mgr, C.uint32_t(index), out_event))
 }
 
+// GoudUiEventsCopy wraps goud_ui_events_copy.
+func GoudUiEventsCopy(mgr *C.UiManager, out_events *C.FfiUiEvent, capacity uint32) uint32 {
+	if mgr == nil {
+		return 0
+	}
+	if out_events == nil {
+		return 0
+	}
+	return uint32(C.goud_ui_events_copy(mgr, out_events, C.uint32_t(capacity)))
+}
+
 // GoudUiEventsCount wraps goud_ui_events_count.
 func GoudUiEventsCount(mgr *C.UiManager) uint32 {
 	if mgr == nil {
@@ -4355,3 +5050,31 @@ func GoudWindowSwapBuffers(context_id C.GoudContextId) {
 func GoudWindowToggleFullscreen(context_id C.GoudContextId) int32 {
 	return int32(C.goud_window_toggle_fullscreen(context_id))
 }
+
+// GoudWorldSnapshotDestroy wraps goud_world_snapshot_destroy.
+func GoudWorldSnapshotDestroy(handle int64) int32 {
+	return int32(C.goud_world_snapshot_destroy(C.int64_t(handle)))
+}
+
+// GoudWorldSnapshotGetStats wraps goud_world_snapshot_get_stats.
+func GoudWorldSnapshotGetStats(handle int64, out_stats *C.FfiWorldSnapshotStats) int32 {
+	if out_stats == nil {
+		return -1
+	}
+	return int32(C.goud_world_snapshot_get_stats(C.int64_t(handle), out_stats))
+}
+
+// GoudWorldSnapshotRestore wraps goud_world_snapshot_restore.
+func GoudWorldSnapshotRestore(context_id C.GoudContextId, handle int64) int32 {
+	return int32(C.goud_world_snapshot_restore(context_id, C.int64_t(handle)))
+}
+
+// GoudWorldSnapshotSave wraps goud_world_snapshot_save.
+func GoudWorldSnapshotSave(context_id C.GoudContextId) int64 {
+	return int64(C.goud_world_snapshot_save(context_id))
+}
+
+// GoudWorldSnapshotSaveInto wraps goud_world_snapshot_save_into.
+func GoudWorldSnapshotSaveInto(context_id C.GoudContextId, handle int64) int32 {
+	return int32(C.goud_world_snapshot_save_into(context_id, C.int64_t(handle)))
+}
@@ -4,7 +4,8 @@ package com.goudengine.core
 /** Native render backend selection */
 enum class RenderBackendKind(val value: Int) {
     Wgpu(0),
-    OpenGlLegacy(1);
+    OpenGlLegacy(1),
+    Null(3);
 
     companion object {
         fun fromValue(value: Int): RenderBackendKind? =
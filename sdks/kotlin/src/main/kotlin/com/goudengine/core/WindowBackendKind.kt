@@ -4,7 +4,8 @@ package com.goudengine.core
 /** Native window backend selection */
 enum class WindowBackendKind(val value: Int) {
     Winit(0),
-    GlfwLegacy(1);
+    GlfwLegacy(1),
+    Headless(5);
 
     companion object {
         fun fromValue(value: Int): WindowBackendKind? =
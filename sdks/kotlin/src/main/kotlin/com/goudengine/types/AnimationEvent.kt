@@ -0,0 +1,6 @@
+// This file is AUTO-GENERATED by GoudEngine codegen. DO NOT EDIT.
+package com.goudengine.types
+
+/** A fired animation event, copied in bulk by AnimationEventsCopy; string pointers borrow the event buffer */
+data class AnimationEvent(val entity: Long, val namePtr: Long, val payloadStrPtr: Long, val nameLen: Int, val frame: Int, val payloadType: Int, val payloadInt: Int, val payloadFloat: Float, val payloadStrLen: Int) {
+}
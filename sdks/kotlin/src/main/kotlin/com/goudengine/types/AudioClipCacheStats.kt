@@ -0,0 +1,6 @@
+// This file is AUTO-GENERATED by GoudEngine codegen. DO NOT EDIT.
+package com.goudengine.types
+
+/** Occupancy, hit, and eviction counters for the decoded audio clip cache */
+data class AudioClipCacheStats(val clips: Long, val residentClips: Long, val pcmBytes: Long, val encodedBytes: Long, val budgetBytes: Long, val hits: Long, val misses: Long, val evictions: Long) {
+}
@@ -0,0 +1,6 @@
+// This file is AUTO-GENERATED by GoudEngine codegen. DO NOT EDIT.
+package com.goudengine.types
+
+/** Active stream, buffer footprint, and underrun counters for streamed audio */
+data class AudioStreamStats(val activeStreams: Long, val bufferBytes: Long, val underruns: Long) {
+}
@@ -0,0 +1,6 @@
+// This file is AUTO-GENERATED by GoudEngine codegen. DO NOT EDIT.
+package com.goudengine.types
+
+/** A collision between two 2D physics bodies, copied in bulk by CollisionEventsCopy */
+data class CollisionEvent(val bodyA: Long, val bodyB: Long, val kind: Int) {
+}
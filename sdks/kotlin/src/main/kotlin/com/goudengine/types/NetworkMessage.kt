@@ -0,0 +1,6 @@
+// This file is AUTO-GENERATED by GoudEngine codegen. DO NOT EDIT.
+package com.goudengine.types
+
+/** Location of one received message inside a batched receive buffer */
+data class NetworkMessage(val peerId: Long, val offset: Int, val len: Int) {
+}
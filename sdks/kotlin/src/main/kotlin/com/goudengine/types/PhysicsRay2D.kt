@@ -0,0 +1,6 @@
+// This file is AUTO-GENERATED by GoudEngine codegen. DO NOT EDIT.
+package com.goudengine.types
+
+/** A ray for batched raycasts via RaycastBatch */
+data class PhysicsRay2D(val originX: Float, val originY: Float, val dirX: Float, val dirY: Float, val maxDist: Float) {
+}
@@ -0,0 +1,6 @@
+// This file is AUTO-GENERATED by GoudEngine codegen. DO NOT EDIT.
+package com.goudengine.types
+
+/** Result of one ray in RaycastBatch */
+data class PhysicsRayHit2D(val body: Long, val collider: Long, val pointX: Float, val pointY: Float, val normalX: Float, val normalY: Float, val distance: Float, val hit: Int) {
+}
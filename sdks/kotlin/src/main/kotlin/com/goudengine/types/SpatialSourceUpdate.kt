@@ -0,0 +1,6 @@
+// This file is AUTO-GENERATED by GoudEngine codegen. DO NOT EDIT.
+package com.goudengine.types
+
+/** One emitter's position and attenuation for a batched spatial audio update */
+data class SpatialSourceUpdate(val playerId: Long, val x: Float, val y: Float, val z: Float, val maxDistance: Float, val rolloff: Float, val volume: Float) {
+}
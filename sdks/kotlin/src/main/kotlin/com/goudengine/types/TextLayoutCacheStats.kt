@@ -0,0 +1,6 @@
+// This file is AUTO-GENERATED by GoudEngine codegen. DO NOT EDIT.
+package com.goudengine.types
+
+/** Hit, miss, and occupancy counters for the text layout cache */
+data class TextLayoutCacheStats(val hits: Long, val misses: Long, val evictions: Long, val entries: Long, val bytes: Long, val budgetBytes: Long) {
+}
@@ -0,0 +1,6 @@
+// This file is AUTO-GENERATED by GoudEngine codegen. DO NOT EDIT.
+package com.goudengine.types
+
+/** One queued UI mutation for batched application. */
+data class UiCommand(val kind: Int, val widgetKind: Int, val nodeId: Long, val parentId: Long, val x: Float, val y: Float, val z: Float, val flag: Boolean, val textPtr: Long, val textLen: Long, val style: Long) {
+}
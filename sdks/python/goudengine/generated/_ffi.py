@@ -254,6 +254,13 @@ class NetworkCapabilities(ctypes.Structure):
         ("max_message_size", ctypes.c_uint32)
     ]
 
+class FfiNetworkMessage(ctypes.Structure):
+    _fields_ = [
+        ("peer_id", ctypes.c_uint64),
+        ("offset", ctypes.c_uint32),
+        ("len", ctypes.c_uint32)
+    ]
+
 class FfiNetworkStats(ctypes.Structure):
     _fields_ = [
         ("bytes_sent", ctypes.c_uint64),
@@ -341,6 +348,21 @@ class FfiUiStyle(ctypes.Structure):
         ("widget_spacing", ctypes.c_float)
     ]
 
+class FfiUiCommand(ctypes.Structure):
+    _fields_ = [
+        ("kind", ctypes.c_uint32),
+        ("widget_kind", ctypes.c_int32),
+        ("node_id", ctypes.c_uint64),
+        ("parent_id", ctypes.c_uint64),
+        ("x", ctypes.c_float),
+        ("y", ctypes.c_float),
+        ("z", ctypes.c_float),
+        ("flag", ctypes.c_bool),
+        ("text_ptr", ctypes.c_void_p),
+        ("text_len", ctypes.c_size_t),
+        ("style", ctypes.c_void_p)
+    ]
+
 class FfiUiEvent(ctypes.Structure):
     _fields_ = [
         ("event_kind", ctypes.c_uint32),
@@ -389,6 +411,87 @@ class FfiArenaStats(ctypes.Structure):
         ("reset_count", ctypes.c_uint64)
     ]
 
+class FfiAudioClipCacheStats(ctypes.Structure):
+    _fields_ = [
+        ("clips", ctypes.c_uint64),
+        ("resident_clips", ctypes.c_uint64),
+        ("pcm_bytes", ctypes.c_uint64),
+        ("encoded_bytes", ctypes.c_uint64),
+        ("budget_bytes", ctypes.c_uint64),
+        ("hits", ctypes.c_uint64),
+        ("misses", ctypes.c_uint64),
+        ("evictions", ctypes.c_uint64)
+    ]
+
+class FfiAudioStreamStats(ctypes.Structure):
+    _fields_ = [
+        ("active_streams", ctypes.c_uint64),
+        ("buffer_bytes", ctypes.c_uint64),
+        ("underruns", ctypes.c_uint64)
+    ]
+
+class FfiSpatialSourceUpdate(ctypes.Structure):
+    _fields_ = [
+        ("player_id", ctypes.c_uint64),
+        ("x", ctypes.c_float),
+        ("y", ctypes.c_float),
+        ("z", ctypes.c_float),
+        ("max_distance", ctypes.c_float),
+        ("rolloff", ctypes.c_float),
+        ("volume", ctypes.c_float)
+    ]
+
+class FfiTextLayoutCacheStats(ctypes.Structure):
+    _fields_ = [
+        ("hits", ctypes.c_uint64),
+        ("misses", ctypes.c_uint64),
+        ("evictions", ctypes.c_uint64),
+        ("entries", ctypes.c_uint64),
+        ("bytes", ctypes.c_uint64),
+        ("budget_bytes", ctypes.c_uint64)
+    ]
+
+class FfiCollisionEvent(ctypes.Structure):
+    _fields_ = [
+        ("body_a", ctypes.c_uint64),
+        ("body_b", ctypes.c_uint64),
+        ("kind", ctypes.c_uint32)
+    ]
+
+class FfiAnimationEvent(ctypes.Structure):
+    _fields_ = [
+        ("entity", ctypes.c_uint64),
+        ("name_ptr", ctypes.c_void_p),
+        ("payload_str_ptr", ctypes.c_void_p),
+        ("name_len", ctypes.c_uint32),
+        ("frame", ctypes.c_uint32),
+        ("payload_type", ctypes.c_uint32),
+        ("payload_int", ctypes.c_int32),
+        ("payload_float", ctypes.c_float),
+        ("payload_str_len", ctypes.c_uint32)
+    ]
+
+class FfiRay(ctypes.Structure):
+    _fields_ = [
+        ("origin_x", ctypes.c_float),
+        ("origin_y", ctypes.c_float),
+        ("dir_x", ctypes.c_float),
+        ("dir_y", ctypes.c_float),
+        ("max_dist", ctypes.c_float)
+    ]
+
+class FfiRaycastHit(ctypes.Structure):
+    _fields_ = [
+        ("body", ctypes.c_uint64),
+        ("collider", ctypes.c_uint64),
+        ("point_x", ctypes.c_float),
+        ("point_y", ctypes.c_float),
+        ("normal_x", ctypes.c_float),
+        ("normal_y", ctypes.c_float),
+        ("distance", ctypes.c_float),
+        ("hit", ctypes.c_uint32)
+    ]
+
 class FfiSpriteCmd(ctypes.Structure):
     _fields_ = [
         ("texture", ctypes.c_uint64),
@@ -475,6 +578,12 @@ def _setup():
     _lib.goud_context_destroy.restype = ctypes.c_bool
     _lib.goud_context_is_valid.argtypes = [GoudContextId]
     _lib.goud_context_is_valid.restype = ctypes.c_bool
+    _lib.goud_context_isolate_thread.argtypes = []
+    _lib.goud_context_isolate_thread.restype = ctypes.c_int32
+    _lib.goud_context_release_thread.argtypes = []
+    _lib.goud_context_release_thread.restype = ctypes.c_int32
+    _lib.goud_context_thread_is_isolated.argtypes = []
+    _lib.goud_context_thread_is_isolated.restype = ctypes.c_bool
 
     # scene
     _lib.goud_scene_create.argtypes = [GoudContextId, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32]
@@ -485,6 +594,10 @@ def _setup():
     _lib.goud_scene_get_by_name.restype = ctypes.c_uint32
     _lib.goud_scene_load.argtypes = [GoudContextId, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32]
     _lib.goud_scene_load.restype = ctypes.c_uint32
+    _lib.goud_scene_load_packed.argtypes = [GoudContextId, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32]
+    _lib.goud_scene_load_packed.restype = ctypes.c_uint32
+    _lib.goud_scene_pack_json.argtypes = [ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint8), ctypes.c_size_t]
+    _lib.goud_scene_pack_json.restype = ctypes.c_int32
     _lib.goud_scene_unload.argtypes = [GoudContextId, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32]
     _lib.goud_scene_unload.restype = GoudResult
     _lib.goud_scene_set_active.argtypes = [GoudContextId, ctypes.c_uint32, ctypes.c_bool]
@@ -505,6 +618,14 @@ def _setup():
     _lib.goud_scene_transition_is_active.restype = ctypes.c_bool
     _lib.goud_scene_transition_tick.argtypes = [GoudContextId, ctypes.c_float]
     _lib.goud_scene_transition_tick.restype = GoudResult
+    _lib.goud_scene_stream_begin.argtypes = [GoudContextId, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32]
+    _lib.goud_scene_stream_begin.restype = ctypes.c_uint32
+    _lib.goud_scene_stream_step.argtypes = [GoudContextId, ctypes.c_uint32, ctypes.c_uint32]
+    _lib.goud_scene_stream_step.restype = ctypes.c_float
+    _lib.goud_scene_stream_progress.argtypes = [GoudContextId, ctypes.c_uint32]
+    _lib.goud_scene_stream_progress.restype = ctypes.c_float
+    _lib.goud_scene_stream_cancel.argtypes = [GoudContextId, ctypes.c_uint32]
+    _lib.goud_scene_stream_cancel.restype = GoudResult
 
     # window
     _lib.goud_window_create.argtypes = [ctypes.c_uint32, ctypes.c_uint32, ctypes.c_char_p]
@@ -567,10 +688,26 @@ def _setup():
     _lib.goud_renderer_draw_quad.restype = ctypes.c_bool
     _lib.goud_texture_load.argtypes = [GoudContextId, ctypes.c_char_p]
     _lib.goud_texture_load.restype = ctypes.c_uint64
+    _lib.goud_texture_create_rgba8.argtypes = [GoudContextId, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32, ctypes.c_uint32]
+    _lib.goud_texture_create_rgba8.restype = ctypes.c_uint64
+    _lib.goud_image_get_size.argtypes = [ctypes.POINTER(ctypes.c_uint8), ctypes.c_size_t, ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_uint32)]
+    _lib.goud_image_get_size.restype = ctypes.c_bool
+    _lib.goud_image_decode_rgba8.argtypes = [ctypes.POINTER(ctypes.c_uint8), ctypes.c_size_t, ctypes.POINTER(ctypes.c_uint8), ctypes.c_size_t]
+    _lib.goud_image_decode_rgba8.restype = ctypes.c_bool
     _lib.goud_texture_destroy.argtypes = [GoudContextId, ctypes.c_uint64]
     _lib.goud_texture_destroy.restype = ctypes.c_bool
+    _lib.goud_texture_stream_load.argtypes = [GoudContextId, ctypes.c_char_p]
+    _lib.goud_texture_stream_load.restype = ctypes.c_uint64
+    _lib.goud_texture_stream_load_memory.argtypes = [GoudContextId, ctypes.POINTER(ctypes.c_uint8), ctypes.c_size_t]
+    _lib.goud_texture_stream_load_memory.restype = ctypes.c_uint64
+    _lib.goud_texture_streaming_set_budget.argtypes = [GoudContextId, ctypes.c_uint64]
+    _lib.goud_texture_streaming_set_budget.restype = ctypes.c_bool
+    _lib.goud_texture_streaming_get_stats.argtypes = [GoudContextId, ctypes.POINTER(FfiTextureStreamingStats)]
+    _lib.goud_texture_streaming_get_stats.restype = ctypes.c_bool
     _lib.goud_font_load.argtypes = [GoudContextId, ctypes.c_char_p]
     _lib.goud_font_load.restype = ctypes.c_uint64
+    _lib.goud_font_load_memory.argtypes = [GoudContextId, ctypes.POINTER(ctypes.c_uint8), ctypes.c_size_t]
+    _lib.goud_font_load_memory.restype = ctypes.c_uint64
     _lib.goud_font_destroy.argtypes = [GoudContextId, ctypes.c_uint64]
     _lib.goud_font_destroy.restype = ctypes.c_bool
     _lib.goud_renderer_draw_text.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_char_p, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_uint8, ctypes.c_float, ctypes.c_float, ctypes.c_uint8, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float]
@@ -581,8 +718,44 @@ def _setup():
     _lib.goud_renderer_draw_sprite_rect.restype = ctypes.c_bool
     _lib.goud_renderer_draw_sprite_batch.argtypes = [GoudContextId, ctypes.POINTER(FfiSpriteCmd), ctypes.c_uint32]
     _lib.goud_renderer_draw_sprite_batch.restype = ctypes.c_uint32
+    _lib.goud_static_layer_create.argtypes = [GoudContextId, ctypes.POINTER(FfiSpriteCmd), ctypes.c_uint32]
+    _lib.goud_static_layer_create.restype = ctypes.c_uint64
+    _lib.goud_static_layer_update.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_uint32, ctypes.POINTER(FfiSpriteCmd), ctypes.c_uint32]
+    _lib.goud_static_layer_update.restype = ctypes.c_int32
+    _lib.goud_static_layer_draw.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_float, ctypes.c_float]
+    _lib.goud_static_layer_draw.restype = ctypes.c_uint32
+    _lib.goud_static_layer_destroy.argtypes = [GoudContextId, ctypes.c_uint64]
+    _lib.goud_static_layer_destroy.restype = ctypes.c_bool
+    _lib.goud_tilemap_create.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_uint32, ctypes.c_uint32, ctypes.c_uint32, ctypes.c_uint32, ctypes.c_uint32]
+    _lib.goud_tilemap_create.restype = ctypes.c_uint64
+    _lib.goud_tilemap_set_tiles.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_uint32, ctypes.c_uint32, ctypes.c_uint32, ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint32)]
+    _lib.goud_tilemap_set_tiles.restype = ctypes.c_int32
+    _lib.goud_tilemap_draw.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_float, ctypes.c_float]
+    _lib.goud_tilemap_draw.restype = ctypes.c_uint32
+    _lib.goud_tilemap_destroy.argtypes = [GoudContextId, ctypes.c_uint64]
+    _lib.goud_tilemap_destroy.restype = ctypes.c_bool
+    _lib.goud_particle_emitter_create.argtypes = [GoudContextId, ctypes.c_void_p]
+    _lib.goud_particle_emitter_create.restype = ctypes.c_uint64
+    _lib.goud_particle_emitter_set_position.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_float, ctypes.c_float]
+    _lib.goud_particle_emitter_set_position.restype = ctypes.c_bool
+    _lib.goud_particle_emitter_set_rate.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_float]
+    _lib.goud_particle_emitter_set_rate.restype = ctypes.c_int32
+    _lib.goud_particle_emitter_burst.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_uint32]
+    _lib.goud_particle_emitter_burst.restype = ctypes.c_uint32
+    _lib.goud_particles_update.argtypes = [GoudContextId, ctypes.c_float]
+    _lib.goud_particles_update.restype = ctypes.c_uint32
+    _lib.goud_particle_emitter_draw.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_float, ctypes.c_float]
+    _lib.goud_particle_emitter_draw.restype = ctypes.c_uint32
+    _lib.goud_particle_emitter_destroy.argtypes = [GoudContextId, ctypes.c_uint64]
+    _lib.goud_particle_emitter_destroy.restype = ctypes.c_bool
     _lib.goud_renderer_draw_text_batch.argtypes = [GoudContextId, ctypes.POINTER(FfiTextCmd), ctypes.c_uint32]
     _lib.goud_renderer_draw_text_batch.restype = ctypes.c_uint32
+    _lib.goud_text_layout_cache_set_budget.argtypes = [GoudContextId, ctypes.c_uint64]
+    _lib.goud_text_layout_cache_set_budget.restype = ctypes.c_bool
+    _lib.goud_text_layout_cache_clear.argtypes = [GoudContextId]
+    _lib.goud_text_layout_cache_clear.restype = ctypes.c_bool
+    _lib.goud_text_layout_cache_get_stats.argtypes = [GoudContextId, ctypes.POINTER(FfiTextLayoutCacheStats)]
+    _lib.goud_text_layout_cache_get_stats.restype = ctypes.c_bool
     _lib.goud_renderer_set_viewport.argtypes = [GoudContextId, ctypes.c_int32, ctypes.c_int32, ctypes.c_uint32, ctypes.c_uint32]
     _lib.goud_renderer_set_viewport.restype = None
     _lib.goud_renderer_enable_depth_test.argtypes = [GoudContextId]
@@ -667,6 +840,14 @@ def _setup():
     _lib.goud_debugger_start_replay.restype = ctypes.c_int32
     _lib.goud_debugger_stop_replay.argtypes = [GoudContextId]
     _lib.goud_debugger_stop_replay.restype = ctypes.c_int32
+    _lib.goud_metrics_buffer.argtypes = [GoudContextId]
+    _lib.goud_metrics_buffer.restype = ctypes.POINTER(GoudMetricsBuffer)
+    _lib.goud_metrics_attach_buffer.argtypes = [GoudContextId, ctypes.POINTER(GoudMetricsBuffer)]
+    _lib.goud_metrics_attach_buffer.restype = ctypes.c_int32
+    _lib.goud_metrics_publish.argtypes = [GoudContextId]
+    _lib.goud_metrics_publish.restype = ctypes.c_int32
+    _lib.goud_metrics_read.argtypes = [ctypes.POINTER(GoudMetricsBuffer), ctypes.POINTER(GoudMetricsBlock)]
+    _lib.goud_metrics_read.restype = ctypes.c_int32
 
     # renderer_3d
     _lib.goud_renderer3d_create_cube.argtypes = [GoudContextId, ctypes.c_uint32, ctypes.c_float, ctypes.c_float, ctypes.c_float]
@@ -985,6 +1166,8 @@ def _setup():
     _lib.goud_input_touch_just_released.restype = ctypes.c_bool
     _lib.goud_input_touch_delta.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.POINTER(ctypes.c_float), ctypes.POINTER(ctypes.c_float)]
     _lib.goud_input_touch_delta.restype = ctypes.c_bool
+    _lib.goud_input_capture_snapshot.argtypes = [GoudContextId, ctypes.c_void_p]
+    _lib.goud_input_capture_snapshot.restype = ctypes.c_bool
 
     # input_actions
     _lib.goud_input_map_action_key.argtypes = [GoudContextId, ctypes.c_char_p, ctypes.c_uint64]
@@ -1015,6 +1198,8 @@ def _setup():
     _lib.goud_entity_clone.restype = ctypes.c_uint64
     _lib.goud_entity_clone_recursive.argtypes = [GoudContextId, ctypes.c_uint64]
     _lib.goud_entity_clone_recursive.restype = ctypes.c_uint64
+    _lib.goud_entity_instantiate.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint64)]
+    _lib.goud_entity_instantiate.restype = ctypes.c_uint32
 
     # collision
     _lib.goud_collision_aabb_aabb.argtypes = [ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.POINTER(GoudContact)]
@@ -1342,6 +1527,46 @@ def _setup():
     _lib.goud_component_get_all.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.POINTER(ctypes.c_uint8)), ctypes.c_uint32]
     _lib.goud_component_get_all.restype = ctypes.c_uint32
 
+    # world_snapshot
+    _lib.goud_world_snapshot_save.argtypes = [GoudContextId]
+    _lib.goud_world_snapshot_save.restype = ctypes.c_int64
+    _lib.goud_world_snapshot_save_into.argtypes = [GoudContextId, ctypes.c_int64]
+    _lib.goud_world_snapshot_save_into.restype = ctypes.c_int32
+    _lib.goud_world_snapshot_restore.argtypes = [GoudContextId, ctypes.c_int64]
+    _lib.goud_world_snapshot_restore.restype = ctypes.c_int32
+    _lib.goud_world_snapshot_destroy.argtypes = [ctypes.c_int64]
+    _lib.goud_world_snapshot_destroy.restype = ctypes.c_int32
+    _lib.goud_world_snapshot_get_stats.argtypes = [ctypes.c_int64, ctypes.POINTER(FfiWorldSnapshotStats)]
+    _lib.goud_world_snapshot_get_stats.restype = ctypes.c_int32
+
+    # asset_pack
+    _lib.goud_asset_pack_open.argtypes = [ctypes.c_char_p]
+    _lib.goud_asset_pack_open.restype = ctypes.c_uint64
+    _lib.goud_asset_pack_open_memory.argtypes = [ctypes.POINTER(ctypes.c_uint8), ctypes.c_size_t]
+    _lib.goud_asset_pack_open_memory.restype = ctypes.c_uint64
+    _lib.goud_asset_pack_close.argtypes = [ctypes.c_uint64]
+    _lib.goud_asset_pack_close.restype = ctypes.c_int32
+    _lib.goud_asset_pack_hash.argtypes = [ctypes.POINTER(ctypes.c_uint8), ctypes.c_size_t]
+    _lib.goud_asset_pack_hash.restype = ctypes.c_uint64
+    _lib.goud_asset_pack_entry_count.argtypes = [ctypes.c_uint64]
+    _lib.goud_asset_pack_entry_count.restype = ctypes.c_int64
+    _lib.goud_asset_pack_entry_size.argtypes = [ctypes.c_uint64, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64)]
+    _lib.goud_asset_pack_entry_size.restype = ctypes.c_int32
+    _lib.goud_asset_pack_entry_data.argtypes = [ctypes.c_uint64, ctypes.c_uint64, ctypes.POINTER(ctypes.POINTER(ctypes.c_uint8)), ctypes.POINTER(ctypes.c_size_t)]
+    _lib.goud_asset_pack_entry_data.restype = ctypes.c_int32
+    _lib.goud_asset_pack_read.argtypes = [ctypes.c_uint64, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint8), ctypes.c_size_t, ctypes.POINTER(ctypes.c_size_t)]
+    _lib.goud_asset_pack_read.restype = ctypes.c_int32
+    _lib.goud_texture_load_from_pack.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_uint64]
+    _lib.goud_texture_load_from_pack.restype = ctypes.c_uint64
+    _lib.goud_texture_stream_load_from_pack.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_uint64]
+    _lib.goud_texture_stream_load_from_pack.restype = ctypes.c_uint64
+    _lib.goud_font_load_from_pack.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_uint64]
+    _lib.goud_font_load_from_pack.restype = ctypes.c_uint64
+    _lib.goud_audio_play_from_pack.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_uint64]
+    _lib.goud_audio_play_from_pack.restype = ctypes.c_int64
+    _lib.goud_scene_load_from_pack.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32]
+    _lib.goud_scene_load_from_pack.restype = ctypes.c_uint32
+
     # error
     _lib.goud_last_error_code.argtypes = []
     _lib.goud_last_error_code.restype = ctypes.c_uint64
@@ -1398,6 +1623,10 @@ def _setup():
         _lib.goud_physics_get_velocity.restype = ctypes.c_int32
         _lib.goud_physics_set_velocity.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_float, ctypes.c_float]
         _lib.goud_physics_set_velocity.restype = ctypes.c_int32
+        _lib.goud_physics_get_bodies.argtypes = [GoudContextId, ctypes.POINTER(ctypes.c_uint64), ctypes.c_uint32, ctypes.POINTER(FfiVec2), ctypes.POINTER(FfiVec2), ctypes.POINTER(ctypes.c_float)]
+        _lib.goud_physics_get_bodies.restype = ctypes.c_uint32
+        _lib.goud_physics_set_velocities.argtypes = [GoudContextId, ctypes.POINTER(ctypes.c_uint64), ctypes.c_uint32, ctypes.POINTER(FfiVec2)]
+        _lib.goud_physics_set_velocities.restype = ctypes.c_uint32
         _lib.goud_physics_apply_force.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_float, ctypes.c_float]
         _lib.goud_physics_apply_force.restype = ctypes.c_int32
         _lib.goud_physics_apply_impulse.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_float, ctypes.c_float]
@@ -1412,6 +1641,12 @@ def _setup():
         _lib.goud_physics_collision_event_count.restype = ctypes.c_int32
         _lib.goud_physics_collision_events_read.argtypes = [GoudContextId, ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_uint32)]
         _lib.goud_physics_collision_events_read.restype = ctypes.c_int32
+        _lib.goud_physics_collision_events_copy.argtypes = [GoudContextId, ctypes.c_uint32, ctypes.POINTER(FfiCollisionEvent), ctypes.c_uint32]
+        _lib.goud_physics_collision_events_copy.restype = ctypes.c_uint32
+        _lib.goud_physics_raycast_batch.argtypes = [GoudContextId, ctypes.POINTER(FfiRay), ctypes.c_uint32, ctypes.c_uint32, ctypes.POINTER(FfiRaycastHit)]
+        _lib.goud_physics_raycast_batch.restype = ctypes.c_uint32
+        _lib.goud_physics_overlap_rect_batch.argtypes = [GoudContextId, ctypes.POINTER(FfiRect), ctypes.c_uint32, ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint64)]
+        _lib.goud_physics_overlap_rect_batch.restype = ctypes.c_uint32
         _lib.goud_physics_collision_event_read.argtypes = [GoudContextId, ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_uint32)]
         _lib.goud_physics_collision_event_read.restype = ctypes.c_int32
         _lib.goud_physics_set_collision_callback.argtypes = [GoudContextId, ctypes.c_void_p, ctypes.c_void_p]
@@ -1434,6 +1669,16 @@ def _setup():
         _lib.goud_physics_set_timestep.restype = ctypes.c_int32
         _lib.goud_physics_get_timestep.argtypes = [GoudContextId, ctypes.POINTER(ctypes.c_float)]
         _lib.goud_physics_get_timestep.restype = ctypes.c_int32
+        _lib.goud_physics_save_state.argtypes = [GoudContextId]
+        _lib.goud_physics_save_state.restype = ctypes.c_int64
+        _lib.goud_physics_save_state_into.argtypes = [GoudContextId, ctypes.c_int64]
+        _lib.goud_physics_save_state_into.restype = ctypes.c_int32
+        _lib.goud_physics_load_state.argtypes = [GoudContextId, ctypes.c_int64]
+        _lib.goud_physics_load_state.restype = ctypes.c_int32
+        _lib.goud_physics_free_state.argtypes = [ctypes.c_int64]
+        _lib.goud_physics_free_state.restype = ctypes.c_int32
+        _lib.goud_physics_set_deterministic.argtypes = [GoudContextId, ctypes.c_bool]
+        _lib.goud_physics_set_deterministic.restype = ctypes.c_int32
     except AttributeError:
         pass  # feature not compiled in
 
@@ -1511,6 +1756,8 @@ def _setup():
     _lib.goud_animation_controller_get_state.restype = ctypes.c_int32
     _lib.goud_animation_controller_update.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_float]
     _lib.goud_animation_controller_update.restype = ctypes.c_int32
+    _lib.goud_animation_update_batch.argtypes = [GoudContextId, ctypes.POINTER(ctypes.c_uint64), ctypes.c_uint32, ctypes.c_float, ctypes.POINTER(FfiSpriteCmd)]
+    _lib.goud_animation_update_batch.restype = ctypes.c_int32
 
     # animation_events
     _lib.goud_animation_clip_add_event.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32, ctypes.c_uint32, ctypes.c_int32, ctypes.c_float, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32]
@@ -1519,6 +1766,8 @@ def _setup():
     _lib.goud_animation_events_count.restype = ctypes.c_int32
     _lib.goud_animation_events_read.argtypes = [GoudContextId, ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.POINTER(ctypes.c_uint8)), ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_int32), ctypes.POINTER(ctypes.c_float), ctypes.POINTER(ctypes.POINTER(ctypes.c_uint8)), ctypes.POINTER(ctypes.c_uint32)]
     _lib.goud_animation_events_read.restype = ctypes.c_int32
+    _lib.goud_animation_events_copy.argtypes = [GoudContextId, ctypes.POINTER(FfiAnimationEvent), ctypes.c_uint32]
+    _lib.goud_animation_events_copy.restype = ctypes.c_uint32
 
     # tween
     _lib.goud_tween_create.argtypes = [GoudContextId, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_int32]
@@ -1533,6 +1782,8 @@ def _setup():
     _lib.goud_tween_reset.restype = ctypes.c_int32
     _lib.goud_tween_destroy.argtypes = [GoudContextId, ctypes.c_int64]
     _lib.goud_tween_destroy.restype = ctypes.c_int32
+    _lib.goud_tween_step_batch.argtypes = [ctypes.POINTER(ctypes.c_float), ctypes.POINTER(ctypes.c_float), ctypes.POINTER(ctypes.c_float), ctypes.POINTER(ctypes.c_float), ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32, ctypes.c_float, ctypes.POINTER(ctypes.c_float)]
+    _lib.goud_tween_step_batch.restype = ctypes.c_int32
 
     # skeleton
     _lib.goud_skeleton_create.argtypes = [GoudContextId, ctypes.c_uint64]
@@ -1543,6 +1794,14 @@ def _setup():
     _lib.goud_skeleton_set_bone_transform.restype = ctypes.c_int32
     _lib.goud_skeleton_play_clip.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint8), ctypes.c_int32, ctypes.c_bool]
     _lib.goud_skeleton_play_clip.restype = ctypes.c_int32
+    _lib.goud_skeleton_add_keyframe.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_int32, ctypes.c_int32, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float]
+    _lib.goud_skeleton_add_keyframe.restype = ctypes.c_int32
+    _lib.goud_skeleton_layer_add.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint8), ctypes.c_int32, ctypes.c_uint32, ctypes.c_bool]
+    _lib.goud_skeleton_layer_add.restype = ctypes.c_int32
+    _lib.goud_skeleton_layer_set_weight.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_int32, ctypes.c_float]
+    _lib.goud_skeleton_layer_set_weight.restype = ctypes.c_int32
+    _lib.goud_skeleton_update_batch.argtypes = [GoudContextId, ctypes.POINTER(ctypes.c_uint64), ctypes.c_uint32, ctypes.c_float, ctypes.POINTER(ctypes.c_float), ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint32)]
+    _lib.goud_skeleton_update_batch.restype = ctypes.c_int32
 
     # animation_layer
     _lib.goud_animation_layer_stack_create.argtypes = [GoudContextId, ctypes.c_uint64]
@@ -1586,6 +1845,10 @@ def _setup():
         _lib.goud_network_send.restype = ctypes.c_int32
         _lib.goud_network_receive.argtypes = [GoudContextId, ctypes.c_int64, ctypes.POINTER(ctypes.c_uint8), ctypes.c_int32, ctypes.POINTER(ctypes.c_uint64)]
         _lib.goud_network_receive.restype = ctypes.c_int32
+        _lib.goud_network_receive_many.argtypes = [GoudContextId, ctypes.c_int64, ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32, ctypes.POINTER(FfiNetworkMessage), ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint32)]
+        _lib.goud_network_receive_many.restype = ctypes.c_int32
+        _lib.goud_network_peek_size.argtypes = [GoudContextId, ctypes.c_int64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_uint32)]
+        _lib.goud_network_peek_size.restype = ctypes.c_int32
         _lib.goud_network_poll.argtypes = [GoudContextId, ctypes.c_int64]
         _lib.goud_network_poll.restype = ctypes.c_int32
         _lib.goud_network_get_stats.argtypes = [GoudContextId, ctypes.c_int64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_uint64)]
@@ -1714,6 +1977,8 @@ def _setup():
     _lib.goud_audio_update_spatial_volume.restype = ctypes.c_int32
     _lib.goud_audio_update_spatial_volume_3d.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float]
     _lib.goud_audio_update_spatial_volume_3d.restype = ctypes.c_int32
+    _lib.goud_audio_update_spatial_sources.argtypes = [GoudContextId, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.POINTER(FfiSpatialSourceUpdate), ctypes.c_uint32]
+    _lib.goud_audio_update_spatial_sources.restype = ctypes.c_int32
     _lib.goud_audio_set_listener_position.argtypes = [GoudContextId, ctypes.c_float, ctypes.c_float]
     _lib.goud_audio_set_listener_position.restype = ctypes.c_int32
     _lib.goud_audio_set_listener_position_3d.argtypes = [GoudContextId, ctypes.c_float, ctypes.c_float, ctypes.c_float]
@@ -1736,6 +2001,26 @@ def _setup():
     _lib.goud_audio_update_crossfades.restype = ctypes.c_int32
     _lib.goud_audio_active_crossfade_count.argtypes = [GoudContextId]
     _lib.goud_audio_active_crossfade_count.restype = ctypes.c_int32
+    _lib.goud_audio_clip_load.argtypes = [GoudContextId, ctypes.POINTER(ctypes.c_uint8), ctypes.c_size_t]
+    _lib.goud_audio_clip_load.restype = ctypes.c_int64
+    _lib.goud_audio_clip_unload.argtypes = [GoudContextId, ctypes.c_uint64]
+    _lib.goud_audio_clip_unload.restype = ctypes.c_int32
+    _lib.goud_audio_clip_play.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_float, ctypes.c_float, ctypes.c_bool, ctypes.c_uint8]
+    _lib.goud_audio_clip_play.restype = ctypes.c_int64
+    _lib.goud_audio_clip_play_spatial_3d.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float]
+    _lib.goud_audio_clip_play_spatial_3d.restype = ctypes.c_int64
+    _lib.goud_audio_clip_cache_set_budget.argtypes = [GoudContextId, ctypes.c_uint64]
+    _lib.goud_audio_clip_cache_set_budget.restype = ctypes.c_int32
+    _lib.goud_audio_clip_cache_get_stats.argtypes = [GoudContextId, ctypes.POINTER(FfiAudioClipCacheStats)]
+    _lib.goud_audio_clip_cache_get_stats.restype = ctypes.c_int32
+    _lib.goud_audio_stream_play.argtypes = [GoudContextId, ctypes.c_char_p, ctypes.c_float, ctypes.c_bool, ctypes.c_uint8]
+    _lib.goud_audio_stream_play.restype = ctypes.c_int64
+    _lib.goud_audio_stream_crossfade_to.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_char_p, ctypes.c_float, ctypes.c_bool, ctypes.c_uint8]
+    _lib.goud_audio_stream_crossfade_to.restype = ctypes.c_int64
+    _lib.goud_audio_stream_mix_with.argtypes = [GoudContextId, ctypes.c_uint64, ctypes.c_char_p, ctypes.c_float, ctypes.c_bool, ctypes.c_uint8]
+    _lib.goud_audio_stream_mix_with.restype = ctypes.c_int64
+    _lib.goud_audio_stream_get_stats.argtypes = [GoudContextId, ctypes.POINTER(FfiAudioStreamStats)]
+    _lib.goud_audio_stream_get_stats.restype = ctypes.c_int32
 
     # ui_manager
     _lib.goud_ui_manager_create.argtypes = []
@@ -1776,6 +2061,8 @@ def _setup():
     _lib.goud_ui_set_node_position.restype = ctypes.c_int32
     _lib.goud_ui_set_node_visible.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.c_bool]
     _lib.goud_ui_set_node_visible.restype = ctypes.c_int32
+    _lib.goud_ui_apply_commands.argtypes = [ctypes.c_void_p, ctypes.POINTER(FfiUiCommand), ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_uint32)]
+    _lib.goud_ui_apply_commands.restype = ctypes.c_int32
     _lib.goud_ui_set_event_callback.argtypes = [ctypes.c_void_p, ctypes.c_void_p, ctypes.c_void_p]
     _lib.goud_ui_set_event_callback.restype = ctypes.c_int32
     _lib.goud_ui_event_count.argtypes = [ctypes.c_void_p]
@@ -1786,6 +2073,8 @@ def _setup():
     _lib.goud_ui_events_count.restype = ctypes.c_uint32
     _lib.goud_ui_events_read.argtypes = [ctypes.c_void_p, ctypes.c_uint32, ctypes.POINTER(FfiUiEvent)]
     _lib.goud_ui_events_read.restype = ctypes.c_int32
+    _lib.goud_ui_events_copy.argtypes = [ctypes.c_void_p, ctypes.POINTER(FfiUiEvent), ctypes.c_uint32]
+    _lib.goud_ui_events_copy.restype = ctypes.c_uint32
 
     # spatial_grid
     _lib.goud_spatial_grid_create.argtypes = [ctypes.c_float]
@@ -1838,6 +2127,8 @@ def _setup():
     _lib.goud_entity_pool_acquire.restype = ctypes.c_uint64
     _lib.goud_entity_pool_acquire_batch.argtypes = [ctypes.c_uint32, ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint64)]
     _lib.goud_entity_pool_acquire_batch.restype = ctypes.c_uint32
+    _lib.goud_entity_pool_acquire_batch_slots.argtypes = [ctypes.c_uint32, ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_uint32)]
+    _lib.goud_entity_pool_acquire_batch_slots.restype = ctypes.c_uint32
     _lib.goud_entity_pool_release.argtypes = [ctypes.c_uint32, ctypes.c_uint32]
     _lib.goud_entity_pool_release.restype = ctypes.c_int32
     _lib.goud_entity_pool_release_batch.argtypes = [ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint32), ctypes.c_uint32]
@@ -1846,10 +2137,18 @@ def _setup():
     _lib.goud_entity_pool_stats.restype = ctypes.c_int32
 
     # frame_arena
+    _lib.goud_frame_arena_alloc.argtypes = [ctypes.c_size_t, ctypes.c_size_t]
+    _lib.goud_frame_arena_alloc.restype = ctypes.POINTER(ctypes.c_uint8)
     _lib.goud_frame_arena_reset.argtypes = []
     _lib.goud_frame_arena_reset.restype = ctypes.c_int32
     _lib.goud_frame_arena_stats.argtypes = [ctypes.POINTER(FfiArenaStats)]
     _lib.goud_frame_arena_stats.restype = ctypes.c_int32
+    _lib.goud_context_frame_arena_alloc.argtypes = [GoudContextId, ctypes.c_size_t, ctypes.c_size_t]
+    _lib.goud_context_frame_arena_alloc.restype = ctypes.POINTER(ctypes.c_uint8)
+    _lib.goud_context_frame_arena_reset.argtypes = [GoudContextId]
+    _lib.goud_context_frame_arena_reset.restype = ctypes.c_int32
+    _lib.goud_context_frame_arena_stats.argtypes = [GoudContextId, ctypes.POINTER(FfiArenaStats)]
+    _lib.goud_context_frame_arena_stats.restype = ctypes.c_int32
 
     # render_metrics
     _lib.goud_renderer_get_frame_metrics.argtypes = [GoudContextId, ctypes.POINTER(FfiRenderMetrics)]
@@ -161,11 +161,13 @@ class RenderBackendKind:
     """Native render backend selection"""
     WGPU = 0
     OPEN_GL_LEGACY = 1
+    NULL = 3
 
 class WindowBackendKind:
     """Native window backend selection"""
     WINIT = 0
     GLFW_LEGACY = 1
+    HEADLESS = 5
 
 class EasingType:
     """Easing function for tweens"""
@@ -1602,6 +1602,16 @@ class NetworkCapabilities:
     def __repr__(self):
         return f"NetworkCapabilities(supports_hosting={self.supports_hosting}, max_connections={self.max_connections}, max_channels={self.max_channels}, max_message_size={self.max_message_size})"
 
+class NetworkMessage:
+    """Location of one received message inside a batched receive buffer"""
+    def __init__(self, peer_id: int = 0, offset: int = 0, len: int = 0):
+        self.peer_id = peer_id
+        self.offset = offset
+        self.len = len
+
+    def __repr__(self):
+        return f"NetworkMessage(peer_id={self.peer_id}, offset={self.offset}, len={self.len})"
+
 class NetworkStats:
     """Aggregate network statistics for a network handle"""
     def __init__(self, bytes_sent: int = 0, bytes_received: int = 0, packets_sent: int = 0, packets_received: int = 0, packets_lost: int = 0, rtt_ms: float = 0.0, send_bandwidth_bytes_per_sec: float = 0.0, receive_bandwidth_bytes_per_sec: float = 0.0, packet_loss_percent: float = 0.0, jitter_ms: float = 0.0):
@@ -1670,6 +1680,24 @@ class UiStyle:
     def __repr__(self):
         return f"UiStyle(has_background_color={self.has_background_color}, background_color={self.background_color}, has_foreground_color={self.has_foreground_color}, foreground_color={self.foreground_color}, has_border_color={self.has_border_color}, border_color={self.border_color}, has_border_width={self.has_border_width}, border_width={self.border_width}, has_font_family={self.has_font_family}, font_family={self.font_family}, has_font_size={self.has_font_size}, font_size={self.font_size}, has_texture_path={self.has_texture_path}, texture_path={self.texture_path}, has_widget_spacing={self.has_widget_spacing}, widget_spacing={self.widget_spacing})"
 
+class UiCommand:
+    """One queued UI mutation for batched application."""
+    def __init__(self, kind: int = 0, widget_kind: int = 0, node_id: int = 0, parent_id: int = 0, x: float = 0.0, y: float = 0.0, z: float = 0.0, flag: bool = False, text_ptr: int = 0, text_len: int = 0, style: int = 0):
+        self.kind = kind
+        self.widget_kind = widget_kind
+        self.node_id = node_id
+        self.parent_id = parent_id
+        self.x = x
+        self.y = y
+        self.z = z
+        self.flag = flag
+        self.text_ptr = text_ptr
+        self.text_len = text_len
+        self.style = style
+
+    def __repr__(self):
+        return f"UiCommand(kind={self.kind}, widget_kind={self.widget_kind}, node_id={self.node_id}, parent_id={self.parent_id}, x={self.x}, y={self.y}, z={self.z}, flag={self.flag}, text_ptr={self.text_ptr}, text_len={self.text_len}, style={self.style})"
+
 class UiEvent:
     """UI event payload returned by deterministic polling APIs."""
     def __init__(self, event_kind: int = 0, node_id: int = 0, previous_node_id: int = 0, current_node_id: int = 0):
@@ -1753,6 +1781,111 @@ class ArenaStats:
     def __repr__(self):
         return f"ArenaStats(bytes_allocated={self.bytes_allocated}, bytes_capacity={self.bytes_capacity}, reset_count={self.reset_count})"
 
+class AudioClipCacheStats:
+    """Occupancy, hit, and eviction counters for the decoded audio clip cache"""
+    def __init__(self, clips: int = 0, resident_clips: int = 0, pcm_bytes: int = 0, encoded_bytes: int = 0, budget_bytes: int = 0, hits: int = 0, misses: int = 0, evictions: int = 0):
+        self.clips = clips
+        self.resident_clips = resident_clips
+        self.pcm_bytes = pcm_bytes
+        self.encoded_bytes = encoded_bytes
+        self.budget_bytes = budget_bytes
+        self.hits = hits
+        self.misses = misses
+        self.evictions = evictions
+
+    def __repr__(self):
+        return f"AudioClipCacheStats(clips={self.clips}, resident_clips={self.resident_clips}, pcm_bytes={self.pcm_bytes}, encoded_bytes={self.encoded_bytes}, budget_bytes={self.budget_bytes}, hits={self.hits}, misses={self.misses}, evictions={self.evictions})"
+
+class AudioStreamStats:
+    """Active stream, buffer footprint, and underrun counters for streamed audio"""
+    def __init__(self, active_streams: int = 0, buffer_bytes: int = 0, underruns: int = 0):
+        self.active_streams = active_streams
+        self.buffer_bytes = buffer_bytes
+        self.underruns = underruns
+
+    def __repr__(self):
+        return f"AudioStreamStats(active_streams={self.active_streams}, buffer_bytes={self.buffer_bytes}, underruns={self.underruns})"
+
+class SpatialSourceUpdate:
+    """One emitter's position and attenuation for a batched spatial audio update"""
+    def __init__(self, player_id: int = 0, x: float = 0.0, y: float = 0.0, z: float = 0.0, max_distance: float = 0.0, rolloff: float = 0.0, volume: float = 0.0):
+        self.player_id = player_id
+        self.x = x
+        self.y = y
+        self.z = z
+        self.max_distance = max_distance
+        self.rolloff = rolloff
+        self.volume = volume
+
+    def __repr__(self):
+        return f"SpatialSourceUpdate(player_id={self.player_id}, x={self.x}, y={self.y}, z={self.z}, max_distance={self.max_distance}, rolloff={self.rolloff}, volume={self.volume})"
+
+class TextLayoutCacheStats:
+    """Hit, miss, and occupancy counters for the text layout cache"""
+    def __init__(self, hits: int = 0, misses: int = 0, evictions: int = 0, entries: int = 0, bytes: int = 0, budget_bytes: int = 0):
+        self.hits = hits
+        self.misses = misses
+        self.evictions = evictions
+        self.entries = entries
+        self.bytes = bytes
+        self.budget_bytes = budget_bytes
+
+    def __repr__(self):
+        return f"TextLayoutCacheStats(hits={self.hits}, misses={self.misses}, evictions={self.evictions}, entries={self.entries}, bytes={self.bytes}, budget_bytes={self.budget_bytes})"
+
+class CollisionEvent:
+    """A collision between two 2D physics bodies, copied in bulk by CollisionEventsCopy"""
+    def __init__(self, body_a: int = 0, body_b: int = 0, kind: int = 0):
+        self.body_a = body_a
+        self.body_b = body_b
+        self.kind = kind
+
+    def __repr__(self):
+        return f"CollisionEvent(body_a={self.body_a}, body_b={self.body_b}, kind={self.kind})"
+
+class AnimationEvent:
+    """A fired animation event, copied in bulk by AnimationEventsCopy; string pointers borrow the event buffer"""
+    def __init__(self, entity: int = 0, name_ptr: int = 0, payload_str_ptr: int = 0, name_len: int = 0, frame: int = 0, payload_type: int = 0, payload_int: int = 0, payload_float: float = 0.0, payload_str_len: int = 0):
+        self.entity = entity
+        self.name_ptr = name_ptr
+        self.payload_str_ptr = payload_str_ptr
+        self.name_len = name_len
+        self.frame = frame
+        self.payload_type = payload_type
+        self.payload_int = payload_int
+        self.payload_float = payload_float
+        self.payload_str_len = payload_str_len
+
+    def __repr__(self):
+        return f"AnimationEvent(entity={self.entity}, name_ptr={self.name_ptr}, payload_str_ptr={self.payload_str_ptr}, name_len={self.name_len}, frame={self.frame}, payload_type={self.payload_type}, payload_int={self.payload_int}, payload_float={self.payload_float}, payload_str_len={self.payload_str_len})"
+
+class PhysicsRay2D:
+    """A ray for batched raycasts via RaycastBatch"""
+    def __init__(self, origin_x: float = 0.0, origin_y: float = 0.0, dir_x: float = 0.0, dir_y: float = 0.0, max_dist: float = 0.0):
+        self.origin_x = origin_x
+        self.origin_y = origin_y
+        self.dir_x = dir_x
+        self.dir_y = dir_y
+        self.max_dist = max_dist
+
+    def __repr__(self):
+        return f"PhysicsRay2D(origin_x={self.origin_x}, origin_y={self.origin_y}, dir_x={self.dir_x}, dir_y={self.dir_y}, max_dist={self.max_dist})"
+
+class PhysicsRayHit2D:
+    """Result of one ray in RaycastBatch"""
+    def __init__(self, body: int = 0, collider: int = 0, point_x: float = 0.0, point_y: float = 0.0, normal_x: float = 0.0, normal_y: float = 0.0, distance: float = 0.0, hit: int = 0):
+        self.body = body
+        self.collider = collider
+        self.point_x = point_x
+        self.point_y = point_y
+        self.normal_x = normal_x
+        self.normal_y = normal_y
+        self.distance = distance
+        self.hit = hit
+
+    def __repr__(self):
+        return f"PhysicsRayHit2D(body={self.body}, collider={self.collider}, point_x={self.point_x}, point_y={self.point_y}, normal_x={self.normal_x}, normal_y={self.normal_y}, distance={self.distance}, hit={self.hit})"
+
 class SpriteCmd:
     """Describes a single sprite for batched rendering via DrawSpriteBatch"""
     def __init__(self, texture: int = 0, x: float = 0.0, y: float = 0.0, width: float = 0.0, height: float = 0.0, rotation: float = 0.0, src_x: float = 0.0, src_y: float = 0.0, src_w: float = 0.0, src_h: float = 0.0, r: float = 0.0, g: float = 0.0, b: float = 0.0, a: float = 0.0, z_layer: int = 0):
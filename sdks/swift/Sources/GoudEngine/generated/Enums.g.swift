@@ -171,12 +171,14 @@ public enum PhysicsBackend2D: UInt32 {
 public enum RenderBackendKind: UInt32 {
     case WGPU = 0
     case OPEN_GL_LEGACY = 1
+    case NULL = 3
 }
 
 /// Native window backend selection
 public enum WindowBackendKind: UInt32 {
     case WINIT = 0
     case GLFW_LEGACY = 1
+    case HEADLESS = 5
 }
 
 /// Easing function for tweens
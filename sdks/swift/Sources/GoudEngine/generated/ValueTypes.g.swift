@@ -934,6 +934,37 @@ public struct NetworkCapabilities: Equatable {
 
 }
 
+/// Location of one received message inside a batched receive buffer
+public struct NetworkMessage: Equatable {
+    /// Connection the message arrived from
+    public var peerId: UInt64
+    /// Byte offset of the payload in the receive buffer
+    public var offset: UInt32
+    /// Payload length in bytes
+    public var len: UInt32
+
+    public init(peerId: UInt64 = 0, offset: UInt32 = 0, len: UInt32 = 0) {
+        self.peerId = peerId
+        self.offset = offset
+        self.len = len
+    }
+
+    internal init(ffi: FfiNetworkMessage) {
+        self.peerId = ffi.peer_id
+        self.offset = ffi.offset
+        self.len = ffi.len
+    }
+
+    internal func toFFI() -> FfiNetworkMessage {
+        var ffi = FfiNetworkMessage()
+        ffi.peer_id = peerId
+        ffi.offset = offset
+        ffi.len = len
+        return ffi
+    }
+
+}
+
 /// Aggregate network statistics for a network handle
 public struct NetworkStats: Equatable {
     /// Total bytes sent across all connections
@@ -1059,6 +1090,77 @@ public struct NetworkPacket: Equatable {
 
 }
 
+/// One queued UI mutation for batched application.
+public struct UiCommand: Equatable {
+    /// One of the UI_COMMAND_* kinds
+    public var kind: UInt32
+    /// Widget kind for create and set-widget commands
+    public var widgetKind: Int32
+    /// Target node id, or a result reference
+    public var nodeId: UInt64
+    /// Parent for set-parent (u64::MAX detaches), or a result reference
+    public var parentId: UInt64
+    /// First float argument
+    public var x: Float
+    /// Second float argument
+    public var y: Float
+    /// Third float argument
+    public var z: Float
+    /// Boolean argument
+    public var flag: Bool
+    /// UTF-8 bytes for label text and texture paths
+    public var textPtr: UnsafeMutableRawPointer
+    /// Length in bytes for textPtr
+    public var textLen: Int
+    /// Style payload for set-style commands
+    public var style: UnsafeMutableRawPointer
+
+    public init(kind: UInt32 = 0, widgetKind: Int32 = 0, nodeId: UInt64 = 0, parentId: UInt64 = 0, x: Float = 0, y: Float = 0, z: Float = 0, flag: Bool = false, textPtr: UnsafeMutableRawPointer = 0, textLen: Int = 0, style: UnsafeMutableRawPointer = 0) {
+        self.kind = kind
+        self.widgetKind = widgetKind
+        self.nodeId = nodeId
+        self.parentId = parentId
+        self.x = x
+        self.y = y
+        self.z = z
+        self.flag = flag
+        self.textPtr = textPtr
+        self.textLen = textLen
+        self.style = style
+    }
+
+    internal init(ffi: FfiUiCommand) {
+        self.kind = ffi.kind
+        self.widgetKind = ffi.widget_kind
+        self.nodeId = ffi.node_id
+        self.parentId = ffi.parent_id
+        self.x = ffi.x
+        self.y = ffi.y
+        self.z = ffi.z
+        self.flag = ffi.flag
+        self.textPtr = ffi.text_ptr
+        self.textLen = ffi.text_len
+        self.style = ffi.style
+    }
+
+    internal func toFFI() -> FfiUiCommand {
+        var ffi = FfiUiCommand()
+        ffi.kind = kind
+        ffi.widget_kind = widgetKind
+        ffi.node_id = nodeId
+        ffi.parent_id = parentId
+        ffi.x = x
+        ffi.y = y
+        ffi.z = z
+        ffi.flag = flag
+        ffi.text_ptr = textPtr
+        ffi.text_len = textLen
+        ffi.style = style
+        return ffi
+    }
+
+}
+
 /// Configuration for P2P mesh networking
 public struct P2pMeshConfig: Equatable {
     /// Maximum number of peers including self
@@ -1305,6 +1407,379 @@ public struct ArenaStats: Equatable {
 
 }
 
+/// Occupancy, hit, and eviction counters for the decoded audio clip cache
+public struct AudioClipCacheStats: Equatable {
+    /// Loaded clip handles
+    public var clips: UInt64
+    /// Clips whose decoded PCM is in memory
+    public var residentClips: UInt64
+    /// Bytes of decoded PCM in memory
+    public var pcmBytes: UInt64
+    /// Bytes of encoded source data kept for re-decoding
+    public var encodedBytes: UInt64
+    /// Configured PCM byte budget
+    public var budgetBytes: UInt64
+    /// Plays served from resident PCM
+    public var hits: UInt64
+    /// Plays that had to decode an evicted clip again
+    public var misses: UInt64
+    /// Clips whose PCM was evicted to stay within the budget
+    public var evictions: UInt64
+
+    public init(clips: UInt64 = 0, residentClips: UInt64 = 0, pcmBytes: UInt64 = 0, encodedBytes: UInt64 = 0, budgetBytes: UInt64 = 0, hits: UInt64 = 0, misses: UInt64 = 0, evictions: UInt64 = 0) {
+        self.clips = clips
+        self.residentClips = residentClips
+        self.pcmBytes = pcmBytes
+        self.encodedBytes = encodedBytes
+        self.budgetBytes = budgetBytes
+        self.hits = hits
+        self.misses = misses
+        self.evictions = evictions
+    }
+
+    internal init(ffi: FfiAudioClipCacheStats) {
+        self.clips = ffi.clips
+        self.residentClips = ffi.resident_clips
+        self.pcmBytes = ffi.pcm_bytes
+        self.encodedBytes = ffi.encoded_bytes
+        self.budgetBytes = ffi.budget_bytes
+        self.hits = ffi.hits
+        self.misses = ffi.misses
+        self.evictions = ffi.evictions
+    }
+
+    internal func toFFI() -> FfiAudioClipCacheStats {
+        var ffi = FfiAudioClipCacheStats()
+        ffi.clips = clips
+        ffi.resident_clips = residentClips
+        ffi.pcm_bytes = pcmBytes
+        ffi.encoded_bytes = encodedBytes
+        ffi.budget_bytes = budgetBytes
+        ffi.hits = hits
+        ffi.misses = misses
+        ffi.evictions = evictions
+        return ffi
+    }
+
+}
+
+/// Active stream, buffer footprint, and underrun counters for streamed audio
+public struct AudioStreamStats: Equatable {
+    /// Streams whose decoder thread is still running
+    public var activeStreams: UInt64
+    /// Decoded-audio buffers the active streams can hold at most
+    public var bufferBytes: UInt64
+    /// Times playback found a stream's queue empty and played silence
+    public var underruns: UInt64
+
+    public init(activeStreams: UInt64 = 0, bufferBytes: UInt64 = 0, underruns: UInt64 = 0) {
+        self.activeStreams = activeStreams
+        self.bufferBytes = bufferBytes
+        self.underruns = underruns
+    }
+
+    internal init(ffi: FfiAudioStreamStats) {
+        self.activeStreams = ffi.active_streams
+        self.bufferBytes = ffi.buffer_bytes
+        self.underruns = ffi.underruns
+    }
+
+    internal func toFFI() -> FfiAudioStreamStats {
+        var ffi = FfiAudioStreamStats()
+        ffi.active_streams = activeStreams
+        ffi.buffer_bytes = bufferBytes
+        ffi.underruns = underruns
+        return ffi
+    }
+
+}
+
+/// One emitter's position and attenuation for a batched spatial audio update
+public struct SpatialSourceUpdate: Equatable {
+    /// Player ID of the emitter's sink
+    public var playerId: UInt64
+    /// Source position X
+    public var x: Float
+    /// Source position Y
+    public var y: Float
+    /// Source position Z (0 for 2D)
+    public var z: Float
+    /// Distance at which the source is silent
+    public var maxDistance: Float
+    /// Attenuation curve exponent
+    public var rolloff: Float
+    /// Volume before attenuation (0.0-1.0, clamped)
+    public var volume: Float
+
+    public init(playerId: UInt64 = 0, x: Float = 0, y: Float = 0, z: Float = 0, maxDistance: Float = 0, rolloff: Float = 0, volume: Float = 0) {
+        self.playerId = playerId
+        self.x = x
+        self.y = y
+        self.z = z
+        self.maxDistance = maxDistance
+        self.rolloff = rolloff
+        self.volume = volume
+    }
+
+    internal init(ffi: FfiSpatialSourceUpdate) {
+        self.playerId = ffi.player_id
+        self.x = ffi.x
+        self.y = ffi.y
+        self.z = ffi.z
+        self.maxDistance = ffi.max_distance
+        self.rolloff = ffi.rolloff
+        self.volume = ffi.volume
+    }
+
+    internal func toFFI() -> FfiSpatialSourceUpdate {
+        var ffi = FfiSpatialSourceUpdate()
+        ffi.player_id = playerId
+        ffi.x = x
+        ffi.y = y
+        ffi.z = z
+        ffi.max_distance = maxDistance
+        ffi.rolloff = rolloff
+        ffi.volume = volume
+        return ffi
+    }
+
+}
+
+/// Hit, miss, and occupancy counters for the text layout cache
+public struct TextLayoutCacheStats: Equatable {
+    /// Draws whose layout came from the cache
+    public var hits: UInt64
+    /// Draws that shaped and laid out their text
+    public var misses: UInt64
+    /// Entries evicted to stay within the byte budget
+    public var evictions: UInt64
+    /// Layouts currently cached
+    public var entries: UInt64
+    /// Estimated bytes held by cached layouts
+    public var bytes: UInt64
+    /// Configured byte budget
+    public var budgetBytes: UInt64
+
+    public init(hits: UInt64 = 0, misses: UInt64 = 0, evictions: UInt64 = 0, entries: UInt64 = 0, bytes: UInt64 = 0, budgetBytes: UInt64 = 0) {
+        self.hits = hits
+        self.misses = misses
+        self.evictions = evictions
+        self.entries = entries
+        self.bytes = bytes
+        self.budgetBytes = budgetBytes
+    }
+
+    internal init(ffi: FfiTextLayoutCacheStats) {
+        self.hits = ffi.hits
+        self.misses = ffi.misses
+        self.evictions = ffi.evictions
+        self.entries = ffi.entries
+        self.bytes = ffi.bytes
+        self.budgetBytes = ffi.budget_bytes
+    }
+
+    internal func toFFI() -> FfiTextLayoutCacheStats {
+        var ffi = FfiTextLayoutCacheStats()
+        ffi.hits = hits
+        ffi.misses = misses
+        ffi.evictions = evictions
+        ffi.entries = entries
+        ffi.bytes = bytes
+        ffi.budget_bytes = budgetBytes
+        return ffi
+    }
+
+}
+
+/// A collision between two 2D physics bodies, copied in bulk by CollisionEventsCopy
+public struct CollisionEvent: Equatable {
+    /// First body involved in the collision
+    public var bodyA: UInt64
+    /// Second body involved in the collision
+    public var bodyB: UInt64
+    /// 0 = Enter, 1 = Stay, 2 = Exit
+    public var kind: UInt32
+
+    public init(bodyA: UInt64 = 0, bodyB: UInt64 = 0, kind: UInt32 = 0) {
+        self.bodyA = bodyA
+        self.bodyB = bodyB
+        self.kind = kind
+    }
+
+    internal init(ffi: FfiCollisionEvent) {
+        self.bodyA = ffi.body_a
+        self.bodyB = ffi.body_b
+        self.kind = ffi.kind
+    }
+
+    internal func toFFI() -> FfiCollisionEvent {
+        var ffi = FfiCollisionEvent()
+        ffi.body_a = bodyA
+        ffi.body_b = bodyB
+        ffi.kind = kind
+        return ffi
+    }
+
+}
+
+/// A fired animation event, copied in bulk by AnimationEventsCopy; string pointers borrow the event buffer
+public struct AnimationEvent: Equatable {
+    /// Entity whose animation fired the event
+    public var entity: UInt64
+    /// Event name (UTF-8, not null-terminated)
+    public var namePtr: UnsafeMutableRawPointer
+    /// String payload (UTF-8) when payloadType == 3, otherwise null
+    public var payloadStrPtr: UnsafeMutableRawPointer
+    /// Byte length of the event name
+    public var nameLen: UInt32
+    /// Frame index that triggered the event
+    public var frame: UInt32
+    /// 0 = None, 1 = Int, 2 = Float, 3 = String
+    public var payloadType: UInt32
+    /// Integer payload (valid when payloadType == 1)
+    public var payloadInt: Int32
+    /// Float payload (valid when payloadType == 2)
+    public var payloadFloat: Float
+    /// Byte length of the string payload
+    public var payloadStrLen: UInt32
+
+    public init(entity: UInt64 = 0, namePtr: UnsafeMutableRawPointer = 0, payloadStrPtr: UnsafeMutableRawPointer = 0, nameLen: UInt32 = 0, frame: UInt32 = 0, payloadType: UInt32 = 0, payloadInt: Int32 = 0, payloadFloat: Float = 0, payloadStrLen: UInt32 = 0) {
+        self.entity = entity
+        self.namePtr = namePtr
+        self.payloadStrPtr = payloadStrPtr
+        self.nameLen = nameLen
+        self.frame = frame
+        self.payloadType = payloadType
+        self.payloadInt = payloadInt
+        self.payloadFloat = payloadFloat
+        self.payloadStrLen = payloadStrLen
+    }
+
+    internal init(ffi: FfiAnimationEvent) {
+        self.entity = ffi.entity
+        self.namePtr = ffi.name_ptr
+        self.payloadStrPtr = ffi.payload_str_ptr
+        self.nameLen = ffi.name_len
+        self.frame = ffi.frame
+        self.payloadType = ffi.payload_type
+        self.payloadInt = ffi.payload_int
+        self.payloadFloat = ffi.payload_float
+        self.payloadStrLen = ffi.payload_str_len
+    }
+
+    internal func toFFI() -> FfiAnimationEvent {
+        var ffi = FfiAnimationEvent()
+        ffi.entity = entity
+        ffi.name_ptr = namePtr
+        ffi.payload_str_ptr = payloadStrPtr
+        ffi.name_len = nameLen
+        ffi.frame = frame
+        ffi.payload_type = payloadType
+        ffi.payload_int = payloadInt
+        ffi.payload_float = payloadFloat
+        ffi.payload_str_len = payloadStrLen
+        return ffi
+    }
+
+}
+
+/// A ray for batched raycasts via RaycastBatch
+public struct PhysicsRay2D: Equatable {
+    /// Ray origin X
+    public var originX: Float
+    /// Ray origin Y
+    public var originY: Float
+    /// Ray direction X
+    public var dirX: Float
+    /// Ray direction Y
+    public var dirY: Float
+    /// Maximum distance along the ray
+    public var maxDist: Float
+
+    public init(originX: Float = 0, originY: Float = 0, dirX: Float = 0, dirY: Float = 0, maxDist: Float = 0) {
+        self.originX = originX
+        self.originY = originY
+        self.dirX = dirX
+        self.dirY = dirY
+        self.maxDist = maxDist
+    }
+
+    internal init(ffi: FfiRay) {
+        self.originX = ffi.origin_x
+        self.originY = ffi.origin_y
+        self.dirX = ffi.dir_x
+        self.dirY = ffi.dir_y
+        self.maxDist = ffi.max_dist
+    }
+
+    internal func toFFI() -> FfiRay {
+        var ffi = FfiRay()
+        ffi.origin_x = originX
+        ffi.origin_y = originY
+        ffi.dir_x = dirX
+        ffi.dir_y = dirY
+        ffi.max_dist = maxDist
+        return ffi
+    }
+
+}
+
+/// Result of one ray in RaycastBatch
+public struct PhysicsRayHit2D: Equatable {
+    /// Body that was hit, or 0
+    public var body: UInt64
+    /// Collider that was hit, or 0
+    public var collider: UInt64
+    /// Hit point X
+    public var pointX: Float
+    /// Hit point Y
+    public var pointY: Float
+    /// Surface normal X
+    public var normalX: Float
+    /// Surface normal Y
+    public var normalY: Float
+    /// Distance from the ray origin to the hit point
+    public var distance: Float
+    /// 1 if the ray hit something, 0 otherwise
+    public var hit: UInt32
+
+    public init(body: UInt64 = 0, collider: UInt64 = 0, pointX: Float = 0, pointY: Float = 0, normalX: Float = 0, normalY: Float = 0, distance: Float = 0, hit: UInt32 = 0) {
+        self.body = body
+        self.collider = collider
+        self.pointX = pointX
+        self.pointY = pointY
+        self.normalX = normalX
+        self.normalY = normalY
+        self.distance = distance
+        self.hit = hit
+    }
+
+    internal init(ffi: FfiRaycastHit) {
+        self.body = ffi.body
+        self.collider = ffi.collider
+        self.pointX = ffi.point_x
+        self.pointY = ffi.point_y
+        self.normalX = ffi.normal_x
+        self.normalY = ffi.normal_y
+        self.distance = ffi.distance
+        self.hit = ffi.hit
+    }
+
+    internal func toFFI() -> FfiRaycastHit {
+        var ffi = FfiRaycastHit()
+        ffi.body = body
+        ffi.collider = collider
+        ffi.point_x = pointX
+        ffi.point_y = pointY
+        ffi.normal_x = normalX
+        ffi.normal_y = normalY
+        ffi.distance = distance
+        ffi.hit = hit
+        return ffi
+    }
+
+}
+
 /// Describes a single sprite for batched rendering via DrawSpriteBatch
 public struct SpriteCmd: Equatable {
     /// Texture handle from goud_texture_load
@@ -170,12 +170,14 @@ export enum PhysicsBackend2D {
 export enum RenderBackendKind {
   Wgpu = 0,
   OpenGlLegacy = 1,
+  Null = 3,
 }
 
 /** Native window backend selection */
 export enum WindowBackendKind {
   Winit = 0,
   GlfwLegacy = 1,
+  Headless = 5,
 }
 
 /** Easing function for tweens */